@@ -95,6 +95,46 @@ if (HDF5_ENABLE_Z_LIB_SUPPORT)
   message (STATUS "Filter ZLIB is ON")
 endif ()
 
+#-----------------------------------------------------------------------------
+# Option for zstd support
+#-----------------------------------------------------------------------------
+option (HDF5_ENABLE_ZSTD_SUPPORT "Enable zstd Filter" OFF)
+if (HDF5_ENABLE_ZSTD_SUPPORT)
+  find_path (ZSTD_INCLUDE_DIR zstd.h)
+  find_library (ZSTD_LIBRARY NAMES zstd zstd_static)
+  if (ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+    set (H5_HAVE_FILTER_ZSTD 1)
+    set (H5_HAVE_ZSTD_H 1)
+    set (H5_HAVE_LIBZSTD 1)
+    set (EXTERNAL_FILTERS "${EXTERNAL_FILTERS} ZSTD")
+    set (LINK_COMP_LIBS ${LINK_COMP_LIBS} ${ZSTD_LIBRARY})
+    INCLUDE_DIRECTORIES (${ZSTD_INCLUDE_DIR})
+    message (STATUS "Filter ZSTD is ON")
+  else ()
+    message (FATAL_ERROR " zstd is Required for zstd support in HDF5")
+  endif ()
+endif ()
+
+#-----------------------------------------------------------------------------
+# Option for lz4 support
+#-----------------------------------------------------------------------------
+option (HDF5_ENABLE_LZ4_SUPPORT "Enable lz4 Filter" OFF)
+if (HDF5_ENABLE_LZ4_SUPPORT)
+  find_path (LZ4_INCLUDE_DIR lz4.h)
+  find_library (LZ4_LIBRARY NAMES lz4 liblz4)
+  if (LZ4_INCLUDE_DIR AND LZ4_LIBRARY)
+    set (H5_HAVE_FILTER_LZ4 1)
+    set (H5_HAVE_LZ4_H 1)
+    set (H5_HAVE_LIBLZ4 1)
+    set (EXTERNAL_FILTERS "${EXTERNAL_FILTERS} LZ4")
+    set (LINK_COMP_LIBS ${LINK_COMP_LIBS} ${LZ4_LIBRARY})
+    INCLUDE_DIRECTORIES (${LZ4_INCLUDE_DIR})
+    message (STATUS "Filter LZ4 is ON")
+  else ()
+    message (FATAL_ERROR " lz4 is Required for lz4 support in HDF5")
+  endif ()
+endif ()
+
 #-----------------------------------------------------------------------------
 # Option for SzLib support
 #-----------------------------------------------------------------------------
@@ -196,6 +196,36 @@ option (HDF5_ENABLE_ROS3_VFD "Build the ROS3 Virtual File Driver" OFF)
     endif ()
 endif ()
 
+#-----------------------------------------------------------------------------
+#  Check if the io_uring driver can be built
+#-----------------------------------------------------------------------------
+if (CMAKE_SYSTEM_NAME STREQUAL "Linux")
+  option (HDF5_ENABLE_IOURING_VFD "Build the Linux io_uring Virtual File Driver (requires liburing)" OFF)
+  if (HDF5_ENABLE_IOURING_VFD)
+    find_path (LIBURING_INCLUDE_DIR liburing.h)
+    find_library (LIBURING_LIBRARY NAMES uring)
+    if (LIBURING_INCLUDE_DIR AND LIBURING_LIBRARY)
+      set (${HDF_PREFIX}_HAVE_IOURING_VFD 1)
+      list (APPEND LINK_LIBS ${LIBURING_LIBRARY})
+      INCLUDE_DIRECTORIES (${LIBURING_INCLUDE_DIR})
+    else ()
+      message (STATUS "The io_uring VFD was requested but cannot be built.\nPlease check that liburing is available on your\nsystem, and/or re-configure without option HDF5_ENABLE_IOURING_VFD.")
+    endif ()
+  endif ()
+endif ()
+
+#-----------------------------------------------------------------------------
+#  Check if the read-only mmap driver can be built
+#-----------------------------------------------------------------------------
+option (HDF5_ENABLE_MMAP_VFD "Build the read-only memory-mapped Virtual File Driver" ON)
+if (HDF5_ENABLE_MMAP_VFD)
+  if (${HDF_PREFIX}_HAVE_SYS_MMAN_H AND ${HDF_PREFIX}_HAVE_MMAP)
+    set (${HDF_PREFIX}_HAVE_MMAP_VFD 1)
+  else ()
+    message (STATUS "The mmap VFD cannot be built on this system: mmap() is not available.")
+  endif ()
+endif ()
+
 # ----------------------------------------------------------------------
 # Check whether we can build the Mirror VFD
 # Header-check flags set in config/cmake_ext_mod/ConfigureChecks.cmake
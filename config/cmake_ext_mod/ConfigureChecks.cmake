@@ -131,6 +131,8 @@ CHECK_INCLUDE_FILE_CONCAT ("sys/socket.h"    ${HDF_PREFIX}_HAVE_SYS_SOCKET_H)
 CHECK_INCLUDE_FILE_CONCAT ("sys/stat.h"      ${HDF_PREFIX}_HAVE_SYS_STAT_H)
 CHECK_INCLUDE_FILE_CONCAT ("sys/time.h"      ${HDF_PREFIX}_HAVE_SYS_TIME_H)
 CHECK_INCLUDE_FILE_CONCAT ("sys/types.h"     ${HDF_PREFIX}_HAVE_SYS_TYPES_H)
+CHECK_INCLUDE_FILE_CONCAT ("sys/uio.h"       ${HDF_PREFIX}_HAVE_SYS_UIO_H)
+CHECK_INCLUDE_FILE_CONCAT ("sys/mman.h"      ${HDF_PREFIX}_HAVE_SYS_MMAN_H)
 CHECK_INCLUDE_FILE_CONCAT ("features.h"      ${HDF_PREFIX}_HAVE_FEATURES_H)
 CHECK_INCLUDE_FILE_CONCAT ("dirent.h"        ${HDF_PREFIX}_HAVE_DIRENT_H)
 CHECK_INCLUDE_FILE_CONCAT ("setjmp.h"        ${HDF_PREFIX}_HAVE_SETJMP_H)
@@ -504,9 +506,13 @@ CHECK_FUNCTION_EXISTS (llroundf          ${HDF_PREFIX}_HAVE_LLROUNDF)
 CHECK_FUNCTION_EXISTS (lround            ${HDF_PREFIX}_HAVE_LROUND)
 CHECK_FUNCTION_EXISTS (lroundf           ${HDF_PREFIX}_HAVE_LROUNDF)
 CHECK_FUNCTION_EXISTS (lstat             ${HDF_PREFIX}_HAVE_LSTAT)
+CHECK_FUNCTION_EXISTS (madvise           ${HDF_PREFIX}_HAVE_MADVISE)
+CHECK_FUNCTION_EXISTS (mmap              ${HDF_PREFIX}_HAVE_MMAP)
 
 CHECK_FUNCTION_EXISTS (pread             ${HDF_PREFIX}_HAVE_PREAD)
 CHECK_FUNCTION_EXISTS (pwrite            ${HDF_PREFIX}_HAVE_PWRITE)
+CHECK_FUNCTION_EXISTS (preadv            ${HDF_PREFIX}_HAVE_PREADV)
+CHECK_FUNCTION_EXISTS (pwritev           ${HDF_PREFIX}_HAVE_PWRITEV)
 CHECK_FUNCTION_EXISTS (rand_r            ${HDF_PREFIX}_HAVE_RAND_R)
 CHECK_FUNCTION_EXISTS (random            ${HDF_PREFIX}_HAVE_RANDOM)
 CHECK_FUNCTION_EXISTS (round             ${HDF_PREFIX}_HAVE_ROUND)
@@ -558,6 +564,8 @@ endif ()
 if (MINGW OR NOT WINDOWS)
   foreach (other_test
       HAVE_ATTRIBUTE
+      HAVE_AVX2_DISPATCH
+      HAVE_SSE42_DISPATCH
       HAVE_C99_FUNC
 #      STDC_HEADERS
       HAVE_FUNCTION
@@ -123,6 +123,47 @@ int __attribute__((unused)) x
 
 #endif /* HAVE_ATTRIBUTE */
 
+#ifdef HAVE_AVX2_DISPATCH
+#include <immintrin.h>
+
+__attribute__((target("avx2"))) static int
+avx2_add(int a)
+{
+    __m256i v = _mm256_set1_epi32(a);
+
+    v = _mm256_add_epi32(v, v);
+    return _mm_cvtsi128_si32(_mm256_castsi256_si128(v));
+}
+
+int
+main(void)
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return avx2_add(1) == 2 ? 0 : 1;
+    return 0;
+}
+#endif /* HAVE_AVX2_DISPATCH */
+
+#ifdef HAVE_SSE42_DISPATCH
+#include <nmmintrin.h>
+
+__attribute__((target("sse4.2"))) static unsigned
+sse42_crc32c(unsigned crc, unsigned char c)
+{
+    return _mm_crc32_u8(crc, c);
+}
+
+int
+main(void)
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2"))
+        return sse42_crc32c(0, 1) != 0 ? 0 : 1;
+    return 0;
+}
+#endif /* HAVE_SSE42_DISPATCH */
+
 #ifdef HAVE_FUNCTION
 
 #ifdef FC_DUMMY_MAIN
@@ -615,6 +615,44 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5get_alloc_stats() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5get_free_list_stats
+ *
+ * Purpose:	Gets statistics about the use of the library's free lists:
+ *      for each kind of free list, the number of allocations made from it,
+ *      how many of those reused a freed block instead of allocating a new
+ *      one, and the amount of freed memory it holds now.  In thread-safe
+ *      builds, the number of reuses served by the per-thread caches in
+ *      front of the "regular" free lists and the memory held in them is
+ *      also returned.  These statistics are global for the entire library.
+ *
+ * Parameters:
+ *  H5_free_list_stats_t *stats;        OUT: Free list statistics
+ *
+ * Return:	Success:	non-negative
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5get_free_list_stats(H5_free_list_stats_t *stats)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "*x", stats);
+
+    if (!stats)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null stats pointer")
+
+    /* Call the free list function to get the values */
+    if (H5FL_get_free_list_stats(stats) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGET, FAIL, "can't get free list stats")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5get_free_list_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5__debug_mask
  *
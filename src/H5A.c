@@ -690,7 +690,7 @@ H5Aread(hid_t attr_id, hid_t dtype_id, void *buf)
     H5VL_object_t *vol_obj;   /* Attribute object for ID */
     herr_t         ret_value; /* Return value */
 
-    FUNC_ENTER_API(FAIL)
+    FUNC_ENTER_API_SHARED(FAIL)
     H5TRACE3("e", "ii*x", attr_id, dtype_id, buf);
 
     /* Check arguments */
@@ -243,15 +243,19 @@ typedef struct H5CX_t {
     hbool_t  mpio_chunk_opt_ratio_valid; /* Whether collective chunk ratio is valid */
 #endif                                   /* H5_HAVE_PARALLEL */
     H5Z_EDC_t             err_detect;    /* Error detection info (H5D_XFER_EDC_NAME) */
-    hbool_t               err_detect_valid;     /* Whether error detection info is valid */
-    H5Z_cb_t              filter_cb;            /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
-    hbool_t               filter_cb_valid;      /* Whether filter callback function is valid */
-    H5Z_data_xform_t *    data_transform;       /* Data transform info (H5D_XFER_XFORM_NAME) */
-    hbool_t               data_transform_valid; /* Whether data transform info is valid */
-    H5T_vlen_alloc_info_t vl_alloc_info;        /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
-    hbool_t               vl_alloc_info_valid;  /* Whether VL datatype alloc info is valid */
-    H5T_conv_cb_t         dt_conv_cb;           /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
-    hbool_t               dt_conv_cb_valid;     /* Whether datatype conversion struct is valid */
+    hbool_t               err_detect_valid;      /* Whether error detection info is valid */
+    H5Z_cb_t              filter_cb;             /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
+    hbool_t               filter_cb_valid;       /* Whether filter callback function is valid */
+    H5Z_data_xform_t *    data_transform;        /* Data transform info (H5D_XFER_XFORM_NAME) */
+    hbool_t               data_transform_valid;  /* Whether data transform info is valid */
+    H5T_vlen_alloc_info_t vl_alloc_info;         /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
+    hbool_t               vl_alloc_info_valid;   /* Whether VL datatype alloc info is valid */
+    H5T_conv_cb_t         dt_conv_cb;            /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
+    hbool_t               dt_conv_cb_valid;      /* Whether datatype conversion struct is valid */
+    unsigned              filter_nthreads;       /* Filter thread count (H5D_XFER_FILTER_NTHREADS_NAME) */
+    hbool_t               filter_nthreads_valid; /* Whether filter thread count is valid */
+    size_t                filter_block_size; /* Filter block size (H5D_XFER_FILTER_BLOCK_SIZE_NAME) */
+    hbool_t               filter_block_size_valid; /* Whether filter block size is valid */
 
     /* Return-only DXPL properties to return to application */
 #ifdef H5_HAVE_PARALLEL
@@ -379,6 +383,8 @@ typedef struct H5CX_dxpl_cache_t {
     H5Z_data_xform_t *    data_transform; /* Data transform info (H5D_XFER_XFORM_NAME) */
     H5T_vlen_alloc_info_t vl_alloc_info;  /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
     H5T_conv_cb_t         dt_conv_cb;     /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
+    unsigned              filter_nthreads; /* Filter thread count (H5D_XFER_FILTER_NTHREADS_NAME) */
+    size_t                filter_block_size; /* Filter block size (H5D_XFER_FILTER_BLOCK_SIZE_NAME) */
 } H5CX_dxpl_cache_t;
 
 /* Typedef for cached default link creation property list information */
@@ -570,6 +576,14 @@ H5CX__init_package(void)
     if (H5P_get(dx_plist, H5D_XFER_CONV_CB_NAME, &H5CX_def_dxpl_cache.dt_conv_cb) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve datatype conversion exception callback")
 
+    /* Get filter pipeline thread count */
+    if (H5P_get(dx_plist, H5D_XFER_FILTER_NTHREADS_NAME, &H5CX_def_dxpl_cache.filter_nthreads) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve filter pipeline thread count")
+
+    /* Get filter block size */
+    if (H5P_get(dx_plist, H5D_XFER_FILTER_BLOCK_SIZE_NAME, &H5CX_def_dxpl_cache.filter_block_size) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve filter block size")
+
     /* Reset the "default LCPL cache" information */
     HDmemset(&H5CX_def_lcpl_cache, 0, sizeof(H5CX_lcpl_cache_t));
 
@@ -2526,6 +2540,71 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_get_dt_conv_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_filter_nthreads
+ *
+ * Purpose:     Retrieves the filter pipeline thread count for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_filter_nthreads(unsigned *filter_nthreads)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(filter_nthreads);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_FILTER_NTHREADS_NAME, filter_nthreads)
+
+    /* Get the value */
+    *filter_nthreads = (*head)->ctx.filter_nthreads;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_filter_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_filter_block_size
+ *
+ * Purpose:     Retrieves the filter block size for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_filter_block_size(size_t *filter_block_size)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(filter_block_size);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_FILTER_BLOCK_SIZE_NAME,
+                             filter_block_size)
+
+    /* Get the value */
+    *filter_block_size = (*head)->ctx.filter_block_size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_filter_block_size() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5CX_get_encoding
  *
@@ -106,6 +106,16 @@
 
 /*#define H5D_CHUNK_DEBUG */
 
+/* Whether a cache entry is dirty, will be filtered when flushed and hasn't
+ * been filtered yet */
+#define H5D_CHUNK_FILTER_PENDING(dset, ent)                                                                  \
+    ((dset)->shared->dcpl_cache.pline.nused && (ent)->dirty && !(ent)->locked && NULL == (ent)->filt_chunk && \
+     !((ent)->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS))
+
+/* Marks a hash table slot whose chunk has been preempted, so that lookups
+ * keep probing past it (see H5D__chunk_cache_find()) */
+#define H5D_RDCC_DELETED (&H5D_rdcc_deleted_g)
+
 /* Flags for the "edge_chunk_state" field below */
 #define H5D_RDCC_DISABLE_FILTERS 0x01u /* Disable filters on this chunk */
 #define H5D_RDCC_NEWLY_DISABLED_FILTERS                                                                      \
@@ -119,6 +129,7 @@
 /* Raw data chunks are cached.  Each entry in the cache is: */
 typedef struct H5D_rdcc_ent_t {
     hbool_t                locked;                   /*entry is locked in cache        */
+    unsigned               npinned;                  /*# of times pinned by the application */
     hbool_t                dirty;                    /*needs to be written to disk?        */
     hbool_t                deleted;                  /*chunk about to be deleted        */
     unsigned               edge_chunk_state;         /*states related to edge chunks (see above) */
@@ -128,14 +139,39 @@ typedef struct H5D_rdcc_ent_t {
     H5F_block_t            chunk_block;              /*offset/length of chunk in file        */
     hsize_t                chunk_idx;                /*index of chunk in dataset             */
     uint8_t *              chunk;                    /*the unfiltered chunk data        */
+    uint8_t *              filt_chunk;               /*filtered image of dirty chunk, if computed early */
+    size_t                 filt_nbytes;              /*size of filtered image        */
+    size_t                 filt_alloc;               /*bytes allocated for filtered image    */
+    unsigned               filt_mask;                /*filter mask for filtered image    */
     unsigned               idx;                      /*index in hash table            */
     struct H5D_rdcc_ent_t *next;                     /*next item in doubly-linked list    */
     struct H5D_rdcc_ent_t *prev;                     /*previous item in doubly-linked list    */
-    struct H5D_rdcc_ent_t *tmp_next;                 /*next item in temporary doubly-linked list */
-    struct H5D_rdcc_ent_t *tmp_prev;                 /*previous item in temporary doubly-linked list */
+    hbool_t                prefetched;               /*read ahead & not locked since    */
+    H5D_shared_t *         owner;                    /*dataset the chunk belongs to        */
+    struct H5D_rdcc_ent_t *gnext;                    /*next item in file's shared cache list */
+    struct H5D_rdcc_ent_t *gprev;                    /*previous item in shared cache list    */
 } H5D_rdcc_ent_t;
 typedef H5D_rdcc_ent_t *H5D_rdcc_ent_ptr_t; /* For free lists */
 
+/* Chunk read from the file and unfiltered before it was locked */
+typedef struct H5D_chunk_prefilt_ent_t {
+    haddr_t  addr;        /* Address of chunk in file */
+    void *   chunk;       /* Unfiltered chunk data (NULL once taken) */
+    unsigned filter_mask; /* Filter mask of chunk in file */
+} H5D_chunk_prefilt_ent_t;
+
+/* Batch of chunks read & unfiltered together by a read operation */
+typedef struct H5D_chunk_prefilt_t {
+    H5D_chunk_prefilt_ent_t *ents;  /* Chunks in the batch */
+    size_t                   nents; /* Number of entries in 'ents' */
+} H5D_chunk_prefilt_t;
+
+/* Chunk being read ahead of a sequential reader */
+typedef struct H5D_chunk_prefetch_t {
+    hsize_t        scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of chunk */
+    H5D_chunk_ud_t udata;                    /* Chunk index info */
+} H5D_chunk_prefetch_t;
+
 /* Callback info for iteration to prune chunks */
 typedef struct H5D_chunk_it_ud1_t {
     H5D_chunk_common_ud_t     common;          /* Common info for B-tree user data (must be first) */
@@ -299,6 +335,8 @@ static herr_t   H5D__chunk_file_cb(void *elem, const H5T_t *type, unsigned ndims
 static herr_t   H5D__chunk_mem_cb(void *elem, const H5T_t *type, unsigned ndims, const hsize_t *coords,
                                   void *fm);
 static unsigned H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled);
+static H5D_rdcc_ent_t *H5D__chunk_cache_find(const H5D_shared_t *shared, const hsize_t *scaled);
+static herr_t          H5D__chunk_cache_rebuild(const H5D_t *dset, size_t nslots);
 static herr_t   H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset);
 static herr_t   H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush);
 static hbool_t  H5D__chunk_is_partial_edge_chunk(unsigned dset_ndims, const uint32_t *chunk_dims,
@@ -308,6 +346,19 @@ static void *   H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *ud
 static herr_t   H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbool_t dirty,
                                   void *chunk, uint32_t naccessed);
 static herr_t   H5D__chunk_cache_prune(const H5D_t *dset, size_t size);
+static herr_t   H5D__chunk_cache_prune_shared(const H5D_t *dset, size_t size);
+static herr_t   H5D__chunk_cache_evict_other(H5F_t *f, H5D_rdcc_ent_t *ent);
+static herr_t   H5D__chunk_filter_entries(const H5D_t *dset, H5D_rdcc_ent_t *start);
+static uint8_t *H5D__chunk_detach_filt(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent);
+static herr_t   H5D__chunk_prefilt_read(const H5D_io_info_t *io_info, const H5D_chunk_map_t *fm,
+                                        H5SL_node_t *chunk_node, unsigned nthreads);
+static void     H5D__chunk_prefilt_reset(H5D_chunk_prefilt_t *prefilt);
+static H5D_rdcc_ent_t *H5D__chunk_cache_insert(const H5D_t *dset, const hsize_t *scaled,
+                                               const H5F_block_t *chunk_block, hsize_t chunk_idx,
+                                               unsigned edge_chunk_state, void *chunk);
+static herr_t H5D__chunk_unfilter_bufs(const H5D_t *dset, unsigned nthreads, size_t nbufs,
+                                       H5Z_pipeline_buf_t bufs[]);
+static herr_t H5D__chunk_prefetch(const H5D_io_info_t *io_info, const hsize_t *scaled);
 static herr_t   H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk);
 #ifdef H5_HAVE_PARALLEL
 static herr_t H5D__chunk_collective_fill(const H5D_t *dset, H5D_chunk_coll_info_t *chunk_info,
@@ -342,6 +393,9 @@ const H5D_layout_ops_t H5D_LOPS_NONEXISTENT[1] = {{NULL, NULL, NULL, NULL, NULL,
 #endif /* H5_HAVE_PARALLEL */
                                                    H5D__nonexistent_readvv, NULL, NULL, NULL, NULL}};
 
+/* Sentinel entry for deleted hash table slots */
+static H5D_rdcc_ent_t H5D_rdcc_deleted_g;
+
 /* Declare a free list to manage the H5F_rdcc_ent_ptr_t sequence information */
 H5FL_SEQ_DEFINE_STATIC(H5D_rdcc_ent_ptr_t);
 
@@ -410,6 +464,10 @@ H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset, ui
     HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
              (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
 
+    /* A pinned chunk must stay in the cache, so it can't be replaced */
+    if (UINT_MAX != udata.idx_hint && dset->shared->cache.chunk.slot[udata.idx_hint]->npinned)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't overwrite a pinned chunk")
+
     /* Set the file block information for the old chunk */
     /* (Which is only defined when overwriting an existing chunk) */
     old_chunk.offset = udata.chunk_block.offset;
@@ -428,6 +486,9 @@ H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset, ui
     /* Set up the size of chunk for user data */
     udata.chunk_block.length = data_size;
 
+    /* Set the chunk's filter mask to the new settings, before it's cached */
+    udata.filter_mask = filters;
+
     if (0 == idx_info.pline->nused && H5F_addr_defined(old_chunk.offset))
         /* If there are no filters and we are overwriting the chunk we can just set values */
         need_insert = FALSE;
@@ -462,9 +523,6 @@ H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset, ui
 
     /* Insert the chunk record into the index */
     if (need_insert && layout->storage.u.chunk.ops->insert) {
-        /* Set the chunk's filter mask to the new settings */
-        udata.filter_mask = filters;
-
         if ((layout->storage.u.chunk.ops->insert)(&idx_info, &udata, dset) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
     } /* end if */
@@ -532,13 +590,18 @@ H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_t *filters, vo
         hbool_t         flush;
 
         /* Sanity checks  */
-        HDassert(udata.idx_hint < rdcc->nslots);
+        HDassert(udata.idx_hint < rdcc->nslots_alloc);
         HDassert(rdcc->slot[udata.idx_hint]);
 
         flush = (ent->dirty == TRUE) ? TRUE : FALSE;
 
-        /* Flush the chunk to disk and clear the cache entry */
-        if (H5D__chunk_cache_evict(dset, rdcc->slot[udata.idx_hint], flush) < 0)
+        /* Flush the chunk to disk and clear the cache entry.  A pinned chunk
+         * must stay in the cache, so it's only flushed. */
+        if (ent->npinned) {
+            if (flush && H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush chunk")
+        } /* end if */
+        else if (H5D__chunk_cache_evict(dset, rdcc->slot[udata.idx_hint], flush) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
 
         /* Reset fields about the chunk we are looking for */
@@ -568,6 +631,143 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__chunk_direct_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_pin
+ *
+ * Purpose:     Pins the chunk at OFFSET in the dataset's chunk cache,
+ *              reading and unfiltering it first if it isn't cached yet,
+ *              and returns a pointer to the cached chunk in BUF and its
+ *              size in BUF_SIZE.  A pinned chunk is never preempted, so
+ *              the caller can read the chunk's elements in place until
+ *              H5D__chunk_unpin() has been called as many times as the
+ *              chunk was pinned, or the dataset is closed.
+ *
+ *              The elements are handed out as they are stored, so
+ *              MEM_TYPE must be a datatype that needs no conversion from
+ *              the dataset's datatype.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_pin(const H5D_t *dset, const H5T_t *mem_type, const hsize_t *offset, const void **buf,
+               size_t *buf_size)
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);      /* Dataset layout */
+    H5D_rdcc_t *        rdcc   = &(dset->shared->cache.chunk); /* Raw data chunk cache */
+    H5T_path_t *        tpath;                                 /* Datatype conversion path */
+    H5D_io_info_t       io_info;                               /* Dataset I/O info */
+    H5D_storage_t       store;                                 /* Chunk storage information */
+    H5D_chunk_ud_t      udata;                                 /* User data for locking the chunk */
+    hsize_t             scaled[H5S_MAX_RANK];                  /* Scaled coordinates for this chunk */
+    size_t              chunk_size;                            /* Size of a chunk */
+    void *              chunk;                                 /* Pointer to locked chunk buffer */
+    hbool_t             pinned = FALSE;                        /* Whether the chunk was pinned */
+    unsigned            u;                                     /* Local index variable */
+    herr_t              ret_value = SUCCEED;                   /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(mem_type);
+    HDassert(offset);
+    HDassert(buf);
+    HDassert(buf_size);
+
+    /* The chunk is returned as it's stored, so it must not need converting */
+    if (NULL == (tpath = H5T_path_find(dset->shared->type, mem_type)))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to convert between src and dest datatype")
+    if (!H5T_path_noop(tpath))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "can't pin a chunk that needs datatype conversion")
+
+    /* The chunk must be inside the dataset */
+    for (u = 0; u < dset->shared->ndims; u++)
+        if (offset[u] >= dset->shared->curr_dims[u])
+            HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "chunk offset is outside the dataset")
+
+    /* Only chunks that fit in the chunk cache can be pinned there */
+    H5_CHECKED_ASSIGN(chunk_size, size_t, layout->u.chunk.size, uint32_t);
+    if (0 == rdcc->nslots || chunk_size > rdcc->nbytes_max)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTPIN, FAIL, "chunk is too large for the dataset's chunk cache")
+
+    /* Calculate the index of this chunk */
+    H5VM_chunk_scaled(dset->shared->ndims, offset, layout->u.chunk.dim, scaled);
+    scaled[dset->shared->ndims] = 0;
+
+    /* Find out where the chunk is */
+    if (H5D__chunk_lookup(dset, scaled, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+    /* Lock the chunk into the cache */
+    store.chunk.scaled = scaled;
+    H5D_BUILD_IO_INFO_RD(&io_info, dset, &store, NULL);
+    if (NULL == (chunk = H5D__chunk_lock(&io_info, &udata, FALSE, FALSE)))
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+
+    /* Pin the cache entry, which outlives the lock */
+    if (UINT_MAX != udata.idx_hint) {
+        rdcc->slot[udata.idx_hint]->npinned++;
+        rdcc->npinned++;
+        pinned = TRUE;
+    } /* end if */
+
+    if (H5D__chunk_unlock(&io_info, &udata, FALSE, chunk, (uint32_t)chunk_size) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
+
+    if (!pinned)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTPIN, FAIL, "unable to keep chunk in the chunk cache")
+
+    /* Return the chunk */
+    *buf      = chunk;
+    *buf_size = chunk_size;
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_pin() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_unpin
+ *
+ * Purpose:     Releases one pin taken on the chunk at OFFSET with
+ *              H5D__chunk_pin().  Once its last pin is released the chunk
+ *              can be preempted from the cache again.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_unpin(const H5D_t *dset, const hsize_t *offset)
+{
+    H5D_rdcc_t *    rdcc = &(dset->shared->cache.chunk); /* Raw data chunk cache */
+    H5D_rdcc_ent_t *ent;                                 /* Chunk's entry in the cache */
+    hsize_t         scaled[H5S_MAX_RANK];                /* Scaled coordinates for this chunk */
+    herr_t          ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == dset->shared->layout.type);
+    HDassert(offset);
+
+    /* Calculate the index of this chunk */
+    H5VM_chunk_scaled(dset->shared->ndims, offset, dset->shared->layout.u.chunk.dim, scaled);
+    scaled[dset->shared->ndims] = 0;
+
+    /* Find the chunk in the cache */
+    if (NULL == (ent = H5D__chunk_cache_find(dset->shared, scaled)) || 0 == ent->npinned)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTUNPIN, FAIL, "chunk is not pinned")
+
+    /* Release the pin */
+    ent->npinned--;
+    rdcc->npinned--;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_unpin() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__get_chunk_storage_size
  *
@@ -630,13 +830,18 @@ H5D__get_chunk_storage_size(H5D_t *dset, const hsize_t *offset, hsize_t *storage
             H5D_rdcc_ent_t *ent = rdcc->slot[udata.idx_hint];
 
             /* Sanity checks  */
-            HDassert(udata.idx_hint < rdcc->nslots);
+            HDassert(udata.idx_hint < rdcc->nslots_alloc);
             HDassert(rdcc->slot[udata.idx_hint]);
 
             /* If the cached chunk is dirty, it must be flushed to get accurate size */
             if (ent->dirty == TRUE) {
-                /* Flush the chunk to disk and clear the cache entry */
-                if (H5D__chunk_cache_evict(dset, rdcc->slot[udata.idx_hint], TRUE) < 0)
+                /* Flush the chunk to disk and clear the cache entry (a pinned
+                 * chunk is only flushed) */
+                if (ent->npinned) {
+                    if (H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush chunk")
+                } /* end if */
+                else if (H5D__chunk_cache_evict(dset, rdcc->slot[udata.idx_hint], TRUE) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
 
                 /* Reset fields about the chunk we are looking for */
@@ -924,7 +1129,13 @@ H5D__chunk_init(H5F_t *f, const H5D_t *const dset, hid_t dapl_id)
 
     if (H5P_get(dapl, H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME, &rdcc->nbytes_max) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get data cache byte size")
-    if (rdcc->nbytes_max == H5D_CHUNK_CACHE_NBYTES_DEFAULT)
+    if (H5F_RDCC_SHARED_NBYTES(f) > 0) {
+        /* The dataset's chunks can't take more than all of the file's shared cache */
+        if (rdcc->nbytes_max == H5D_CHUNK_CACHE_NBYTES_DEFAULT ||
+            rdcc->nbytes_max > H5F_RDCC_SHARED_NBYTES(f))
+            rdcc->nbytes_max = H5F_RDCC_SHARED_NBYTES(f);
+    } /* end if */
+    else if (rdcc->nbytes_max == H5D_CHUNK_CACHE_NBYTES_DEFAULT)
         rdcc->nbytes_max = H5F_RDCC_NBYTES(f);
 
     if (H5P_get(dapl, H5D_ACS_PREEMPT_READ_CHUNKS_NAME, &rdcc->w0) < 0)
@@ -932,6 +1143,9 @@ H5D__chunk_init(H5F_t *f, const H5D_t *const dset, hid_t dapl_id)
     if (rdcc->w0 < 0)
         rdcc->w0 = H5F_RDCC_W0(f);
 
+    if (H5P_get(dapl, H5D_ACS_CHUNK_PREFETCH_NAME, &rdcc->prefetch.nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get number of chunks to read ahead")
+
     /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
     if (!rdcc->nbytes_max || !rdcc->nslots)
         rdcc->nbytes_max = rdcc->nslots = 0;
@@ -939,10 +1153,23 @@ H5D__chunk_init(H5F_t *f, const H5D_t *const dset, hid_t dapl_id)
         rdcc->slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, rdcc->nslots);
         if (NULL == rdcc->slot)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        rdcc->nslots_alloc = rdcc->nslots;
 
         /* Reset any cached chunk info for this dataset */
         H5D__chunk_cinfo_cache_reset(&(rdcc->last));
-    } /* end else */
+
+        /* Use the chunk cache shared by the file's datasets, if there is one.
+         * (The file creates it for the first dataset & frees it when it's closed) */
+        if (H5F_RDCC_SHARED_NBYTES(f) > 0) {
+            if (NULL == (rdcc->shared = H5F_RDCC_SHARED(f))) {
+                if (NULL == (rdcc->shared = (H5D_rdcc_shared_t *)H5MM_calloc(sizeof(H5D_rdcc_shared_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for shared cache")
+                rdcc->shared->nbytes_max = H5F_RDCC_SHARED_NBYTES(f);
+                H5F_SET_RDCC_SHARED(f, rdcc->shared);
+            } /* end if */
+            rdcc->oh_addr = dset->oloc.addr;
+        } /* end if */
+    }     /* end else */
 
     /* Compute scaled dimension info, if dataset dims > 1 */
     if (dset->shared->ndims > 1) {
@@ -1167,28 +1394,46 @@ H5D__chunk_io_init_selections(const H5D_io_info_t *io_info, const H5D_type_info_
         fm->sel_chunks = NULL;
         fm->use_single = TRUE;
 
+        /* Use the dataset's single chunk dataspace & information, unless
+         * another I/O operation is using them (in a thread that has given
+         * up the API lock to read raw data) */
+        if (dataset->shared->cache.chunk.map_in_use) {
+            fm->single_space      = NULL;
+            fm->single_chunk_info = NULL;
+            fm->map_in_use        = NULL;
+        } /* end if */
+        else {
+            fm->single_space      = dataset->shared->cache.chunk.single_space;
+            fm->single_chunk_info = dataset->shared->cache.chunk.single_chunk_info;
+            fm->map_in_use        = &dataset->shared->cache.chunk.map_in_use;
+            *fm->map_in_use       = TRUE;
+        } /* end else */
+
         /* Initialize single chunk dataspace */
-        if (NULL == dataset->shared->cache.chunk.single_space) {
+        if (NULL == fm->single_space) {
             /* Make a copy of the dataspace for the dataset */
-            if ((dataset->shared->cache.chunk.single_space = H5S_copy(fm->file_space, TRUE, FALSE)) == NULL)
+            if ((fm->single_space = H5S_copy(fm->file_space, TRUE, FALSE)) == NULL)
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space")
+            if (fm->map_in_use)
+                dataset->shared->cache.chunk.single_space = fm->single_space;
 
             /* Resize chunk's dataspace dimensions to size of chunk */
-            if (H5S_set_extent_real(dataset->shared->cache.chunk.single_space, fm->chunk_dim) < 0)
+            if (H5S_set_extent_real(fm->single_space, fm->chunk_dim) < 0)
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't adjust chunk dimensions")
 
             /* Set the single chunk dataspace to 'all' selection */
-            if (H5S_select_all(dataset->shared->cache.chunk.single_space, TRUE) < 0)
+            if (H5S_select_all(fm->single_space, TRUE) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to set all selection")
         } /* end if */
-        fm->single_space = dataset->shared->cache.chunk.single_space;
         HDassert(fm->single_space);
 
         /* Allocate the single chunk information */
-        if (NULL == dataset->shared->cache.chunk.single_chunk_info)
-            if (NULL == (dataset->shared->cache.chunk.single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
+        if (NULL == fm->single_chunk_info) {
+            if (NULL == (fm->single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
-        fm->single_chunk_info = dataset->shared->cache.chunk.single_chunk_info;
+            if (fm->map_in_use)
+                dataset->shared->cache.chunk.single_chunk_info = fm->single_chunk_info;
+        } /* end if */
         HDassert(fm->single_chunk_info);
 
         /* Reset chunk template information */
@@ -1202,11 +1447,29 @@ H5D__chunk_io_init_selections(const H5D_io_info_t *io_info, const H5D_type_info_
     else {
         hbool_t sel_hyper_flag; /* Whether file selection is a hyperslab */
 
+        /* No single chunk dataspace & information */
+        fm->single_space      = NULL;
+        fm->single_chunk_info = NULL;
+
+        /* Use the dataset's skip list for chunk selections, unless another
+         * I/O operation is using it (see above) */
+        if (dataset->shared->cache.chunk.map_in_use) {
+            fm->sel_chunks = NULL;
+            fm->map_in_use = NULL;
+        } /* end if */
+        else {
+            fm->sel_chunks  = dataset->shared->cache.chunk.sel_chunks;
+            fm->map_in_use  = &dataset->shared->cache.chunk.map_in_use;
+            *fm->map_in_use = TRUE;
+        } /* end else */
+
         /* Initialize skip list for chunk selections */
-        if (NULL == dataset->shared->cache.chunk.sel_chunks)
-            if (NULL == (dataset->shared->cache.chunk.sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+        if (NULL == fm->sel_chunks) {
+            if (NULL == (fm->sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for chunk selections")
-        fm->sel_chunks = dataset->shared->cache.chunk.sel_chunks;
+            if (fm->map_in_use)
+                dataset->shared->cache.chunk.sel_chunks = fm->sel_chunks;
+        } /* end if */
         HDassert(fm->sel_chunks);
 
         /* We are not using single element mode */
@@ -2452,16 +2715,19 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_
                 const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
                 H5D_chunk_map_t *fm)
 {
-    H5SL_node_t * chunk_node;                    /* Current node in chunk skip list */
-    H5D_io_info_t nonexistent_io_info;           /* "nonexistent" I/O info object */
-    H5D_io_info_t ctg_io_info;                   /* Contiguous I/O info object */
-    H5D_storage_t ctg_store;                     /* Chunk storage information as contiguous dataset */
-    H5D_io_info_t cpt_io_info;                   /* Compact I/O info object */
-    H5D_storage_t cpt_store;                     /* Chunk storage information as compact dataset */
-    hbool_t       cpt_dirty;                     /* Temporary placeholder for compact storage "dirty" flag */
-    uint32_t      src_accessed_bytes  = 0;       /* Total accessed size in a chunk */
-    hbool_t       skip_missing_chunks = FALSE;   /* Whether to skip missing chunks */
-    herr_t        ret_value           = SUCCEED; /*return value        */
+    H5SL_node_t *       chunk_node;                      /* Current node in chunk skip list */
+    H5D_io_info_t       nonexistent_io_info;             /* "nonexistent" I/O info object */
+    H5D_io_info_t       ctg_io_info;                     /* Contiguous I/O info object */
+    H5D_storage_t       ctg_store;                       /* Chunk storage information as contiguous dataset */
+    H5D_io_info_t       cpt_io_info;                     /* Compact I/O info object */
+    H5D_storage_t       cpt_store;                       /* Chunk storage information as compact dataset */
+    hbool_t             cpt_dirty;                       /* Placeholder for compact storage "dirty" flag */
+    uint32_t            src_accessed_bytes  = 0;         /* Total accessed size in a chunk */
+    hbool_t             skip_missing_chunks = FALSE;     /* Whether to skip missing chunks */
+    unsigned            filter_nthreads     = 1;         /* # of threads for running the filter pipeline */
+    size_t              nchunks             = 0;         /* # of chunks visited */
+    H5D_chunk_prefilt_t prefilt             = {NULL, 0}; /* Chunks read & unfiltered ahead of being locked */
+    herr_t              ret_value           = SUCCEED;   /*return value        */
 
     FUNC_ENTER_STATIC
 
@@ -2509,12 +2775,24 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_
             skip_missing_chunks = TRUE;
     }
 
+    /* Check whether to unfilter several chunks at once */
+    if (io_info->dset->shared->dcpl_cache.pline.nused && !fm->use_single)
+        if (H5CX_get_filter_nthreads(&filter_nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get filter thread count")
+    if (filter_nthreads > 1)
+        io_info->prefilt = &prefilt;
+
     /* Iterate through nodes in chunk skip list */
     chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
     while (chunk_node) {
         H5D_chunk_info_t *chunk_info; /* Chunk information */
         H5D_chunk_ud_t    udata;      /* Chunk index pass-through    */
 
+        /* Read & unfilter the next batch of chunks together */
+        if (filter_nthreads > 1 && 0 == (nchunks++ % (2 * (size_t)filter_nthreads)))
+            if (H5D__chunk_prefilt_read(io_info, fm, chunk_node, filter_nthreads) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read batch of chunks")
+
         /* Get the actual chunk information from the skip list node */
         chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
 
@@ -2583,6 +2861,10 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_
     } /* end while */
 
 done:
+    /* Release any chunks unfiltered ahead of time that weren't used */
+    H5D__chunk_prefilt_reset(&prefilt);
+    io_info->prefilt = NULL;
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_read() */
 
@@ -2620,6 +2902,14 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
     HDassert(type_info);
     HDassert(fm);
 
+    /* Remember how many threads to use for filtering chunks when they're flushed */
+    if (io_info->dset->shared->dcpl_cache.pline.nused) {
+        if (H5CX_get_filter_nthreads(&io_info->dset->shared->cache.chunk.filter_nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get filter thread count")
+        if (H5CX_get_filter_block_size(&io_info->dset->shared->cache.chunk.filter_block_size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get filter block size")
+    } /* end if */
+
     /* Set up contiguous I/O info object */
     H5MM_memcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
     ctg_io_info.store      = &ctg_store;
@@ -2779,6 +3069,9 @@ H5D__chunk_flush(H5D_t *dset)
     /* Loop over all entries in the chunk cache */
     for (ent = rdcc->head; ent; ent = next) {
         next = ent->next;
+        if (rdcc->filter_nthreads > 1 && H5D_CHUNK_FILTER_PENDING(dset, ent))
+            if (H5D__chunk_filter_entries(dset, ent) < 0)
+                nerrors++;
         if (H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
             nerrors++;
     } /* end for */
@@ -2826,6 +3119,18 @@ H5D__chunk_io_term(const H5D_chunk_map_t *fm)
                 HGOTO_ERROR(H5E_PLIST, H5E_CANTNEXT, FAIL, "can't iterate over chunks")
     } /* end else */
 
+    /* Hand the dataset's selection structures back, or release the map's own */
+    if (fm->map_in_use)
+        *fm->map_in_use = FALSE;
+    else {
+        if (fm->single_space && H5S_close(fm->single_space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release single chunk dataspace")
+        if (fm->single_chunk_info)
+            (void)H5FL_FREE(H5D_chunk_info_t, fm->single_chunk_info);
+        if (fm->sel_chunks && H5SL_close(fm->sel_chunks) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "can't release chunk selection skip list")
+    } /* end else */
+
     /* Free the memory chunk dataspace template */
     if (fm->mchunk_tmpl)
         if (H5S_close(fm->mchunk_tmpl) < 0)
@@ -2871,6 +3176,9 @@ H5D__chunk_dest(H5D_t *dset)
     /* Flush all the cached chunks */
     for (ent = rdcc->head; ent; ent = next) {
         next = ent->next;
+        if (rdcc->filter_nthreads > 1 && H5D_CHUNK_FILTER_PENDING(dset, ent))
+            if (H5D__chunk_filter_entries(dset, ent) < 0)
+                nerrors++;
         if (H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
             nerrors++;
     } /* end for */
@@ -2930,6 +3238,40 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D_chunk_idx_reset() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D_chunk_get_shared_cache_stats
+ *
+ * Purpose:     Retrieve the current size of the raw data chunk cache
+ *              shared by the chunked datasets in file F, and the number
+ *              of hits and misses in it.  These are all zero if no
+ *              dataset has used a shared cache.  Any of the pointers may
+ *              be NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_chunk_get_shared_cache_stats(const H5F_t *f, size_t *cur_size, hsize_t *nhits, hsize_t *nmisses)
+{
+    const H5D_rdcc_shared_t *shared; /* File's shared chunk cache */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+
+    shared = H5F_RDCC_SHARED(f);
+    if (cur_size)
+        *cur_size = shared ? shared->nbytes_used : 0;
+    if (nhits)
+        *nhits = shared ? shared->stats.nhits : 0;
+    if (nmisses)
+        *nmisses = shared ? shared->stats.nmisses : 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D_chunk_get_shared_cache_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_cinfo_cache_reset
  *
@@ -3130,11 +3472,112 @@ H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
     } /* end for */
 
     /* Modulo value against the number of array slots */
-    ret = (unsigned)(val % shared->cache.chunk.nslots);
+    ret = (unsigned)(val % shared->cache.chunk.nslots_alloc);
 
     FUNC_LEAVE_NOAPI(ret)
 } /* H5D__chunk_hash_val() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_find
+ *
+ * Purpose:     Find the chunk with the scaled coordinates SCALED in the
+ *              chunk cache.  Chunks that hash to the same slot are placed
+ *              in the next free slots after it, so the slots are probed
+ *              from the chunk's hash value until the chunk or an empty
+ *              slot is found.
+ *
+ * Return:      Success:    Pointer to the chunk's cache entry
+ *              Failure:    NULL, if the chunk isn't cached
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_rdcc_ent_t *
+H5D__chunk_cache_find(const H5D_shared_t *shared, const hsize_t *scaled)
+{
+    const H5D_rdcc_t *rdcc = &(shared->cache.chunk); /* Dataset's chunk cache */
+    size_t            idx;                           /* Index of slot */
+    size_t            n;                             /* # of slots probed */
+    H5D_rdcc_ent_t *  ret_value = NULL;              /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(scaled);
+
+    if (rdcc->nslots_alloc > 0) {
+        idx = H5D__chunk_hash_val(shared, scaled);
+        for (n = 0; n < rdcc->nslots_alloc && rdcc->slot[idx]; n++) {
+            H5D_rdcc_ent_t *ent = rdcc->slot[idx]; /* Cache entry */
+
+            if (ent != H5D_RDCC_DELETED) {
+                unsigned u; /* Local index variable */
+
+                /* Check if the cache entry is the correct chunk */
+                for (u = 0; u < shared->ndims; u++)
+                    if (scaled[u] != ent->scaled[u])
+                        break;
+                if (u == shared->ndims)
+                    HGOTO_DONE(ent)
+            } /* end if */
+
+            if (++idx == rdcc->nslots_alloc)
+                idx = 0;
+        } /* end for */
+    }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_cache_find() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_rebuild
+ *
+ * Purpose:     Rebuild the chunk cache's hash table with NSLOTS slots,
+ *              dropping the slots marked deleted.  This is used to grow
+ *              the table as it fills and when the hash values of the
+ *              cached chunks change.  Every cached chunk keeps its place
+ *              in the cache, but (locked ones included) moves to a new
+ *              slot.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_rebuild(const H5D_t *dset, size_t nslots)
+{
+    H5D_rdcc_t *        rdcc = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
+    H5D_rdcc_ent_ptr_t *new_slot;                            /* New hash table */
+    H5D_rdcc_ent_t *    ent;                                 /* Cache entry */
+    herr_t              ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(nslots > (size_t)rdcc->nused);
+
+    if (NULL == (new_slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, nslots)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk cache hash table")
+    rdcc->slot         = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
+    rdcc->slot         = new_slot;
+    rdcc->nslots_alloc = nslots;
+    rdcc->ndeleted     = 0;
+
+    /* Re-insert the cached chunks */
+    for (ent = rdcc->head; ent; ent = ent->next) {
+        size_t idx = H5D__chunk_hash_val(dset->shared, ent->scaled); /* Index of slot */
+
+        while (rdcc->slot[idx])
+            if (++idx == rdcc->nslots_alloc)
+                idx = 0;
+        rdcc->slot[idx] = ent;
+        ent->idx        = (unsigned)idx;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_cache_rebuild() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_lookup
  *
@@ -3151,10 +3594,8 @@ H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
 herr_t
 H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled, H5D_chunk_ud_t *udata)
 {
-    H5D_rdcc_ent_t *     ent = NULL; /* Cache entry */
-    H5O_storage_chunk_t *sc  = &(dset->shared->layout.storage.u.chunk);
-    unsigned             idx;                 /* Index of chunk in cache, if present */
-    hbool_t              found     = FALSE;   /* In cache? */
+    H5D_rdcc_ent_t *     ent;                 /* Cache entry */
+    H5O_storage_chunk_t *sc        = &(dset->shared->layout.storage.u.chunk);
     herr_t               ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -3178,30 +3619,11 @@ H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled, H5D_chunk_ud_t *udat
     udata->new_unfilt_chunk   = FALSE;
 
     /* Check for chunk in cache */
-    if (dset->shared->cache.chunk.nslots > 0) {
-        /* Determine the chunk's location in the hash table */
-        idx = H5D__chunk_hash_val(dset->shared, scaled);
-
-        /* Get the chunk cache entry for that location */
-        ent = dset->shared->cache.chunk.slot[idx];
-        if (ent) {
-            unsigned u; /* Counter */
-
-            /* Speculatively set the 'found' flag */
-            found = TRUE;
-
-            /* Verify that the cache entry is the correct chunk */
-            for (u = 0; u < dset->shared->ndims; u++)
-                if (scaled[u] != ent->scaled[u]) {
-                    found = FALSE;
-                    break;
-                } /* end if */
-        }         /* end if */
-    }             /* end if */
+    ent = H5D__chunk_cache_find(dset->shared, scaled);
 
     /* Retrieve chunk addr */
-    if (found) {
-        udata->idx_hint           = idx;
+    if (ent) {
+        udata->idx_hint           = ent->idx;
         udata->chunk_block.offset = ent->chunk_block.offset;
         udata->chunk_block.length = ent->chunk_block.length;
         ;
@@ -3294,6 +3716,7 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
     void *               buf                = NULL; /* Temporary buffer        */
     hbool_t              point_of_no_return = FALSE;
     H5O_storage_chunk_t *sc                 = &(dset->shared->layout.storage.u.chunk);
+    H5D_rdcc_t *         rdcc               = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
     herr_t               ret_value          = SUCCEED; /* Return value            */
 
     FUNC_ENTER_STATIC
@@ -3322,42 +3745,71 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
 
         /* Should the chunk be filtered before writing it to disk? */
         if (dset->shared->dcpl_cache.pline.nused && !(ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)) {
-            H5Z_EDC_t err_detect;                       /* Error detection info */
-            H5Z_cb_t  filter_cb;                        /* I/O filter callback function */
-            size_t    alloc = udata.chunk_block.length; /* Bytes allocated for BUF    */
-            size_t    nbytes;                           /* Chunk size (in bytes) */
-
-            /* Retrieve filter settings from API context */
-            if (H5CX_get_err_detect(&err_detect) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
-            if (H5CX_get_filter_cb(&filter_cb) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
-
-            if (!reset) {
-                /*
-                 * Copy the chunk to a new buffer before running it through
-                 * the pipeline because we'll want to save the original buffer
-                 * for later.
-                 */
-                if (NULL == (buf = H5MM_malloc(alloc)))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
-                H5MM_memcpy(buf, ent->chunk, alloc);
+            size_t alloc = udata.chunk_block.length; /* Bytes allocated for BUF    */
+            size_t nbytes;                           /* Chunk size (in bytes) */
+
+            if (ent->filt_chunk) {
+                /* The chunk was already run through the pipeline, along with
+                 * other dirty chunks */
+                nbytes            = ent->filt_nbytes;
+                udata.filter_mask = ent->filt_mask;
+                buf               = H5D__chunk_detach_filt(rdcc, ent);
             } /* end if */
             else {
-                /*
-                 * If we are resetting and something goes wrong after this
-                 * point then it's too late to recover because we may have
-                 * destroyed the original data by calling H5Z_pipeline().
-                 * The only safe option is to continue with the reset
-                 * even if we can't write the data to disk.
-                 */
-                point_of_no_return = TRUE;
-                ent->chunk         = NULL;
+                H5Z_EDC_t err_detect; /* Error detection info */
+                H5Z_cb_t  filter_cb;  /* I/O filter callback function */
+
+                /* Retrieve filter settings from API context */
+                if (H5CX_get_err_detect(&err_detect) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+                if (H5CX_get_filter_cb(&filter_cb) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+                if (!reset) {
+                    /*
+                     * Copy the chunk to a new buffer before running it through
+                     * the pipeline because we'll want to save the original buffer
+                     * for later.
+                     */
+                    if (NULL == (buf = H5MM_malloc(alloc)))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+                    H5MM_memcpy(buf, ent->chunk, alloc);
+                } /* end if */
+                else {
+                    /*
+                     * If we are resetting and something goes wrong after this
+                     * point then it's too late to recover because we may have
+                     * destroyed the original data by calling H5Z_pipeline().
+                     * The only safe option is to continue with the reset
+                     * even if we can't write the data to disk.
+                     */
+                    point_of_no_return = TRUE;
+                    ent->chunk         = NULL;
+                } /* end else */
+                H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
+                if (rdcc->filter_nthreads > 1 && rdcc->filter_block_size > 0) {
+                    H5Z_pipeline_buf_t pbuf;   /* The chunk, for the pipeline */
+                    herr_t             status; /* Status of the pipeline */
+
+                    /* Let the filters use the filter threads on blocks of the chunk */
+                    pbuf.filter_mask = 0;
+                    pbuf.nbytes      = nbytes;
+                    pbuf.buf_size    = alloc;
+                    pbuf.buf         = buf;
+                    status = H5Z_pipeline_multi(&(dset->shared->dcpl_cache.pline), 0, err_detect, filter_cb,
+                                                rdcc->filter_nthreads, rdcc->filter_block_size, (size_t)1,
+                                                &pbuf);
+                    udata.filter_mask = pbuf.filter_mask;
+                    nbytes            = pbuf.nbytes;
+                    alloc             = pbuf.buf_size;
+                    buf               = pbuf.buf;
+                    if (status < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
+                } /* end if */
+                else if (H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), err_detect,
+                                      filter_cb, &nbytes, &alloc, &buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
             } /* end else */
-            H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
-            if (H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), err_detect,
-                             filter_cb, &nbytes, &alloc, &buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
 #if H5_SIZEOF_SIZE_T > 4
             /* Check for the chunk expanding too much to encode in a 32-bit value */
             if (nbytes > ((size_t)0xffffffff))
@@ -3491,7 +3943,7 @@ H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
     HDassert(dset);
     HDassert(ent);
     HDassert(!ent->locked);
-    HDassert(ent->idx < rdcc->nslots);
+    HDassert(ent->idx < rdcc->nslots_alloc);
 
     if (flush) {
         /* Flush */
@@ -3518,28 +3970,54 @@ H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
         rdcc->tail = ent->prev;
     ent->prev = ent->next = NULL;
 
-    /* Unlink from temporary list */
-    if (ent->tmp_prev) {
-        HDassert(rdcc->tmp_head->tmp_next);
-        ent->tmp_prev->tmp_next = ent->tmp_next;
-        if (ent->tmp_next) {
-            ent->tmp_next->tmp_prev = ent->tmp_prev;
-            ent->tmp_next           = NULL;
-        } /* end if */
-        ent->tmp_prev = NULL;
+    /* Unlink from the file's shared cache */
+    if (rdcc->shared) {
+        if (ent->gprev)
+            ent->gprev->gnext = ent->gnext;
+        else
+            rdcc->shared->head = ent->gnext;
+        if (ent->gnext)
+            ent->gnext->gprev = ent->gprev;
+        else
+            rdcc->shared->tail = ent->gprev;
+        ent->gprev = ent->gnext = NULL;
+        rdcc->shared->nbytes_used -= dset->shared->layout.u.chunk.size;
     } /* end if */
-    else
-        /* Only clear hash table slot if the chunk was not on the temporary list
-         */
-        rdcc->slot[ent->idx] = NULL;
+
+    /* Free the hash table slot.  If the next slot is empty no lookup can
+     * probe past this one, so it (and any deleted slots before it) can be
+     * emptied.  Otherwise mark it deleted, so lookups continue past it. */
+    HDassert(rdcc->slot[ent->idx] == ent);
+    if (NULL == rdcc->slot[(ent->idx + 1) % rdcc->nslots_alloc]) {
+        size_t idx = ent->idx; /* Index of slot */
+
+        rdcc->slot[idx] = NULL;
+        idx             = (idx + rdcc->nslots_alloc - 1) % rdcc->nslots_alloc;
+        while (rdcc->slot[idx] == H5D_RDCC_DELETED) {
+            rdcc->slot[idx] = NULL;
+            rdcc->ndeleted--;
+            idx = (idx + rdcc->nslots_alloc - 1) % rdcc->nslots_alloc;
+        } /* end while */
+    }     /* end if */
+    else {
+        rdcc->slot[ent->idx] = H5D_RDCC_DELETED;
+        rdcc->ndeleted++;
+    } /* end else */
 
     /* Remove from cache */
-    HDassert(rdcc->slot[ent->idx] != ent);
     ent->idx = UINT_MAX;
     rdcc->nbytes_used -= dset->shared->layout.u.chunk.size;
     --rdcc->nused;
 
+    /* Drop any pins still held on the chunk (when the dataset is closed) */
+    rdcc->npinned -= ent->npinned;
+
+    /* Count chunks that were read ahead but never used */
+    if (ent->prefetched)
+        rdcc->stats.nprefetch_misses++;
+
     /* Free */
+    H5MM_xfree(H5D__chunk_detach_filt(rdcc, ent));
     ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
 
     FUNC_LEAVE_NOAPI(ret_value)
@@ -3549,8 +4027,8 @@ H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
  * Function:    H5D__chunk_cache_prune
  *
  * Purpose:    Prune the cache by preempting some things until the cache has
- *        room for something which is SIZE bytes.  Only unlocked
- *        entries are considered for preemption.
+ *        room for something which is SIZE bytes.  Only unlocked,
+ *        unpinned entries are considered for preemption.
  *
  * Return:    Non-negative on success/Negative on failure
  *
@@ -3587,6 +4065,20 @@ H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
     p[0] = rdcc->head;
     p[1] = NULL;
 
+    /*
+     * When several filter threads are in use, filter the next batch of dirty
+     * entries at the least recently used end of the list together, so that
+     * they don't each run the filter pipeline serially as they're preempted.
+     */
+    if (rdcc->filter_nthreads > 1 && (rdcc->nbytes_used + size) > total) {
+        for (cur = rdcc->head; cur; cur = cur->next)
+            if (cur->dirty && !cur->locked && !(cur->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS))
+                break;
+        if (cur && H5D_CHUNK_FILTER_PENDING(dset, cur))
+            if (H5D__chunk_filter_entries(dset, cur) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTFILTER, FAIL, "unable to filter raw data cache entries")
+    } /* end if */
+
     while ((p[0] || p[1]) && (rdcc->nbytes_used + size) > total) {
         int i; /* Local index variable */
 
@@ -3601,7 +4093,7 @@ H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
 
         /* Give each method a chance */
         for (i = 0; i < nmeth && (rdcc->nbytes_used + size) > total; i++) {
-            if (0 == i && p[0] && !p[0]->locked &&
+            if (0 == i && p[0] && !p[0]->locked && 0 == p[0]->npinned &&
                 ((0 == p[0]->rd_count && 0 == p[0]->wr_count) ||
                  (0 == p[0]->rd_count && dset->shared->layout.u.chunk.size == p[0]->wr_count) ||
                  (dset->shared->layout.u.chunk.size == p[0]->rd_count && 0 == p[0]->wr_count))) {
@@ -3612,10 +4104,10 @@ H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
                  */
                 cur = p[0];
             }
-            else if (1 == i && p[1] && !p[1]->locked) {
+            else if (1 == i && p[1] && !p[1]->locked && 0 == p[1]->npinned) {
                 /*
                  * Method 1: Preempt the entry without regard to
-                 * considerations other than being locked.  This is the last
+                 * considerations other than being locked or pinned.  This is the last
                  * resort preemption.
                  */
                 cur = p[1];
@@ -3653,6 +4145,712 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_cache_prune() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_prune_shared
+ *
+ * Purpose:     Prune the file's shared chunk cache by preempting the
+ *              least recently used chunks of any of the file's datasets,
+ *              until it has room for something which is SIZE bytes.  Only
+ *              unlocked, unpinned entries are considered for preemption.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_prune_shared(const H5D_t *dset, size_t size)
+{
+    H5D_rdcc_shared_t *shared = dset->shared->cache.chunk.shared; /* File's shared chunk cache */
+    H5D_rdcc_ent_t *   ent, *next;                                 /* Cache entries */
+    int                nerrors   = 0;                              /* Accumulated error count */
+    herr_t             ret_value = SUCCEED;                        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(shared);
+
+    for (ent = shared->head; ent && (shared->nbytes_used + size) > shared->nbytes_max; ent = next) {
+        next = ent->gnext;
+        if (ent->locked || ent->npinned)
+            continue;
+
+        if (ent->owner == dset->shared) {
+            if (H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
+                nerrors++;
+        } /* end if */
+        else if (H5D__chunk_cache_evict_other(dset->oloc.file, ent) < 0)
+            nerrors++;
+    } /* end for */
+
+    if (nerrors)
+        HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_prune_shared() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_evict_other
+ *
+ * Purpose:     Preempt an entry belonging to another of the file's
+ *              datasets from the shared chunk cache, flushing it to the
+ *              file F if it's dirty.  There may be no handle for the
+ *              other dataset to hand, so one is made up from its shared
+ *              info (which holds its layout, filter pipeline and cache)
+ *              and its object header's address.
+ *
+ *              The transfer properties of the current call were chosen
+ *              for a different dataset, so the chunk is flushed in an API
+ *              context of its own, with the default transfer properties,
+ *              as when the other dataset flushes its chunks itself on
+ *              H5Dflush() or H5Dclose().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_evict_other(H5F_t *f, H5D_rdcc_ent_t *ent)
+{
+    H5D_t   dset;                     /* Dataset the entry belongs to */
+    hbool_t api_ctx_pushed = FALSE;   /* Whether an API context was pushed */
+    herr_t  ret_value      = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(!ent->locked);
+
+    /* Push API context */
+    if (H5CX_push() < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set API context")
+    api_ctx_pushed = TRUE;
+
+    /* Make up a dataset handle */
+    HDmemset(&dset, 0, sizeof(dset));
+    H5O_loc_reset(&dset.oloc);
+    dset.oloc.file = f;
+    dset.oloc.addr = ent->owner->cache.chunk.oh_addr;
+    dset.shared    = ent->owner;
+
+    H5_BEGIN_TAG(dset.oloc.addr)
+    if (H5D__chunk_cache_evict(&dset, ent, TRUE) < 0)
+        HGOTO_ERROR_TAG(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt raw data cache entry")
+    H5_END_TAG
+
+done:
+    if (api_ctx_pushed && H5CX_pop() < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "can't reset API context")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_evict_other() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_filter_entries
+ *
+ * Purpose:     Run a batch of dirty cache entries through the filter
+ *              pipeline together, using the number of threads that was
+ *              set for the last write to the dataset.  The batch begins
+ *              with START and continues toward the most recently used end
+ *              of the cache.  The filtered image of each chunk is kept in
+ *              its entry, to be written when the entry is flushed.
+ *
+ *              Entries that fail to filter are left as they are, so that
+ *              flushing them reports the error in the usual way.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_filter_entries(const H5D_t *dset, H5D_rdcc_ent_t *start)
+{
+    H5D_rdcc_t *        rdcc = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
+    H5D_rdcc_ent_t **   ents = NULL;                         /* Entries being filtered */
+    H5Z_pipeline_buf_t *bufs = NULL;                         /* Chunk images being filtered */
+    H5D_rdcc_ent_t *    ent;                                 /* Current cache entry */
+    H5Z_EDC_t           err_detect;                          /* Error detection info */
+    H5Z_cb_t            filter_cb;                           /* I/O filter callback function */
+    size_t              chunk_size;                          /* Size of a chunk */
+    size_t              max_ents;                            /* Maximum # of entries to filter */
+    size_t              nents = 0;                           /* # of entries being filtered */
+    size_t              u;                                   /* Local index variable */
+    herr_t              ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(start);
+    HDassert(rdcc->filter_nthreads > 1);
+
+    H5_CHECKED_ASSIGN(chunk_size, size_t, dset->shared->layout.u.chunk.size, uint32_t);
+    max_ents = 2 * (size_t)rdcc->filter_nthreads;
+
+    if (NULL == (ents = (H5D_rdcc_ent_t **)H5MM_malloc(max_ents * sizeof(H5D_rdcc_ent_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for cache entry list")
+    if (NULL == (bufs = (H5Z_pipeline_buf_t *)H5MM_calloc(max_ents * sizeof(H5Z_pipeline_buf_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline buffers")
+
+    /* Copy each chunk to a new buffer, since the entry keeps its unfiltered data */
+    for (ent = start; ent && nents < max_ents; ent = ent->next)
+        if (H5D_CHUNK_FILTER_PENDING(dset, ent)) {
+            if (NULL == (bufs[nents].buf = H5MM_malloc(chunk_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+            H5MM_memcpy(bufs[nents].buf, ent->chunk, chunk_size);
+            bufs[nents].nbytes   = chunk_size;
+            bufs[nents].buf_size = chunk_size;
+            ents[nents++]        = ent;
+        } /* end if */
+
+    /* Retrieve filter settings from API context */
+    if (H5CX_get_err_detect(&err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+    if (H5CX_get_filter_cb(&filter_cb) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+    /* Filter the chunks.  Any chunk that fails will be filtered again (and
+     * the failure reported) when its entry is flushed. */
+    if (H5Z_pipeline_multi(&(dset->shared->dcpl_cache.pline), 0, err_detect, filter_cb, rdcc->filter_nthreads,
+                           rdcc->filter_block_size, nents, bufs) < 0)
+        H5E_clear_stack(NULL);
+
+    /* Hand the filtered images over to the entries, counting them against
+     * the cache's size until they're written */
+    for (u = 0; u < nents; u++)
+        if (bufs[u].status >= 0) {
+            ents[u]->filt_chunk  = (uint8_t *)bufs[u].buf;
+            ents[u]->filt_nbytes = bufs[u].nbytes;
+            ents[u]->filt_alloc  = bufs[u].buf_size;
+            ents[u]->filt_mask   = bufs[u].filter_mask;
+            bufs[u].buf          = NULL;
+            rdcc->nbytes_used += bufs[u].buf_size;
+            if (rdcc->shared)
+                rdcc->shared->nbytes_used += bufs[u].buf_size;
+        } /* end if */
+
+done:
+    if (bufs) {
+        for (u = 0; u < max_ents; u++)
+            H5MM_xfree(bufs[u].buf);
+        H5MM_xfree(bufs);
+    } /* end if */
+    H5MM_xfree(ents);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filter_entries() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_detach_filt
+ *
+ * Purpose:     Take the filtered image of a chunk, if any, from its cache
+ *              entry, and stop counting it against the cache's size.
+ *
+ * Return:      The filtered image (which the caller must free), or NULL
+ *              if the entry has none
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint8_t *
+H5D__chunk_detach_filt(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent)
+{
+    uint8_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(rdcc);
+    HDassert(ent);
+
+    if (ent->filt_chunk) {
+        HDassert(rdcc->nbytes_used >= ent->filt_alloc);
+        rdcc->nbytes_used -= ent->filt_alloc;
+        if (rdcc->shared) {
+            HDassert(rdcc->shared->nbytes_used >= ent->filt_alloc);
+            rdcc->shared->nbytes_used -= ent->filt_alloc;
+        } /* end if */
+
+        ret_value       = ent->filt_chunk;
+        ent->filt_chunk = NULL;
+        ent->filt_alloc = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_detach_filt() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_prefilt_read
+ *
+ * Purpose:     Read the next batch of chunks for a read operation,
+ *              beginning with CHUNK_NODE, and run them through the filter
+ *              pipeline together using up to NTHREADS threads.  The
+ *              unfiltered chunks are held in the read operation's
+ *              PREFILT batch until H5D__chunk_lock() takes them, instead
+ *              of reading and unfiltering each chunk itself.
+ *
+ *              Chunks that are already cached, that don't exist in the
+ *              file or that are stored unfiltered are skipped, as are
+ *              chunks that fail to unfilter (H5D__chunk_lock() will read
+ *              those again and report the failure).
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_prefilt_read(const H5D_io_info_t *io_info, const H5D_chunk_map_t *fm, H5SL_node_t *chunk_node,
+                        unsigned nthreads)
+{
+    const H5D_t *        dset    = io_info->dset;                     /* Local pointer to the dataset info */
+    const H5O_layout_t * layout  = &(dset->shared->layout);           /* Dataset layout */
+    const H5O_pline_t *  pline   = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    H5D_chunk_prefilt_t *prefilt = io_info->prefilt;                  /* Operation's batch of chunks */
+    H5Z_pipeline_buf_t * bufs    = NULL;                              /* Chunks being unfiltered */
+    size_t               max_chunks;                                  /* Maximum # of chunks to read */
+    size_t               nbufs     = 0;                               /* # of chunks being unfiltered */
+    size_t               u;                                           /* Local index variable */
+    herr_t               ret_value = SUCCEED;                         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(fm);
+    HDassert(chunk_node);
+    HDassert(pline->nused);
+    HDassert(nthreads > 1);
+    HDassert(prefilt);
+
+    /* Release any chunks from the previous batch that weren't used */
+    H5D__chunk_prefilt_reset(prefilt);
+
+    max_chunks = 2 * (size_t)nthreads;
+    if (NULL == (prefilt->ents =
+                     (H5D_chunk_prefilt_ent_t *)H5MM_calloc(max_chunks * sizeof(H5D_chunk_prefilt_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for unfiltered chunk list")
+    if (NULL == (bufs = (H5Z_pipeline_buf_t *)H5MM_calloc(max_chunks * sizeof(H5Z_pipeline_buf_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline buffers")
+
+    /* Read the chunks in the batch */
+    for (u = 0; chunk_node && u < max_chunks; u++, chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node)) {
+        H5D_chunk_info_t *chunk_info; /* Chunk information */
+        H5D_chunk_ud_t    udata;      /* Chunk index pass-through */
+        size_t            nbytes;     /* Size of chunk in file */
+
+        /* Get the chunk information from the skip list node */
+        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+
+        /* Get the info for the chunk in the file */
+        if (H5D__chunk_lookup(dset, chunk_info->scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Skip chunks that are cached, not in the file, or stored unfiltered */
+        if (UINT_MAX != udata.idx_hint || !H5F_addr_defined(udata.chunk_block.offset))
+            continue;
+        if ((layout->u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS) &&
+            H5D__chunk_is_partial_edge_chunk(dset->shared->ndims, layout->u.chunk.dim, chunk_info->scaled,
+                                             dset->shared->curr_dims))
+            continue;
+
+        H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
+        if (NULL == (bufs[nbufs].buf = H5D__chunk_mem_alloc(nbytes, pline)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+        bufs[nbufs].nbytes        = nbytes;
+        bufs[nbufs].buf_size      = nbytes;
+        bufs[nbufs].filter_mask   = udata.filter_mask;
+        prefilt->ents[nbufs].addr = udata.chunk_block.offset;
+        if (H5F_shared_block_read(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, udata.chunk_block.offset,
+                                  nbytes, bufs[nbufs].buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+        nbufs++;
+    } /* end for */
+
+    if (nbufs > 0) {
+        /* Unfilter the chunks.  Any chunk that fails will be read again (and
+         * the failure reported) when it's locked. */
+        if (H5D__chunk_unfilter_bufs(dset, nthreads, nbufs, bufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "unable to unfilter raw data chunks")
+
+        /* Keep the unfiltered chunks for H5D__chunk_lock() */
+        for (u = 0; u < nbufs; u++)
+            if (bufs[u].status >= 0) {
+                prefilt->ents[u].chunk       = bufs[u].buf;
+                prefilt->ents[u].filter_mask = bufs[u].filter_mask;
+                bufs[u].buf                  = NULL;
+            } /* end if */
+        prefilt->nents = nbufs;
+    } /* end if */
+
+done:
+    if (bufs) {
+        for (u = 0; u < max_chunks; u++)
+            if (bufs[u].buf)
+                bufs[u].buf = H5D__chunk_mem_xfree(bufs[u].buf, pline);
+        H5MM_xfree(bufs);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_prefilt_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_prefilt_reset
+ *
+ * Purpose:     Release the chunks held by H5D__chunk_prefilt_read() that
+ *              weren't taken by H5D__chunk_lock().
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_prefilt_reset(H5D_chunk_prefilt_t *prefilt)
+{
+    size_t u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(prefilt);
+
+    /* (Chunks are only held for filtered datasets, so they were allocated
+     *  with H5MM_malloc(), see H5D__chunk_mem_alloc()) */
+    for (u = 0; u < prefilt->nents; u++)
+        H5MM_xfree(prefilt->ents[u].chunk);
+    prefilt->ents  = (H5D_chunk_prefilt_ent_t *)H5MM_xfree(prefilt->ents);
+    prefilt->nents = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_prefilt_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_unfilter_bufs
+ *
+ * Purpose:     Run the chunks read into BUFS back through the dataset's
+ *              filter pipeline together, using up to NTHREADS threads.
+ *              A chunk that fails to unfilter is left with a negative
+ *              status, for the caller to skip, and doesn't cause this
+ *              routine to fail.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_unfilter_bufs(const H5D_t *dset, unsigned nthreads, size_t nbufs, H5Z_pipeline_buf_t bufs[])
+{
+    H5Z_EDC_t err_detect;          /* Error detection info */
+    H5Z_cb_t  filter_cb;           /* I/O filter callback function */
+    herr_t    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+    HDassert(dset->shared->dcpl_cache.pline.nused);
+    HDassert(bufs);
+
+    /* Retrieve filter settings from API context */
+    if (H5CX_get_err_detect(&err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+    if (H5CX_get_filter_cb(&filter_cb) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+    if (H5Z_pipeline_multi(&(dset->shared->dcpl_cache.pline), H5Z_FLAG_REVERSE, err_detect, filter_cb,
+                           nthreads, (size_t)0, nbufs, bufs) < 0)
+        H5E_clear_stack(NULL);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_unfilter_bufs() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_insert
+ *
+ * Purpose:     Add the unfiltered chunk CHUNK to the chunk cache, at the
+ *              most recently used end of the list, preempting other
+ *              chunks if needed to make room.  When the file has a chunk
+ *              cache shared by its datasets, the chunk is added to that
+ *              too, and chunks of other datasets may be preempted to
+ *              keep within its budget.  The hash table is grown when it
+ *              becomes three-quarters full, so chunks are never
+ *              preempted because their hash values collide.  The new
+ *              entry takes ownership of CHUNK.
+ *
+ * Return:      Success:    Pointer to the new cache entry
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_rdcc_ent_t *
+H5D__chunk_cache_insert(const H5D_t *dset, const hsize_t *scaled, const H5F_block_t *chunk_block,
+                        hsize_t chunk_idx, unsigned edge_chunk_state, void *chunk)
+{
+    H5D_rdcc_t *    rdcc = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
+    H5D_rdcc_ent_t *ent;                                 /* New cache entry */
+    size_t          chunk_size;                          /* Size of a chunk */
+    size_t          idx;                                 /* Index of slot for chunk */
+    H5D_rdcc_ent_t *ret_value = NULL;                    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(rdcc->nslots_alloc > 0);
+    HDassert(scaled);
+    HDassert(chunk_block);
+    HDassert(chunk);
+
+    /* Get the chunk's size */
+    H5_CHECKED_ASSIGN(chunk_size, size_t, dset->shared->layout.u.chunk.size, uint32_t);
+
+    /* Preempt enough things from the cache to make room */
+    if (H5D__chunk_cache_prune(dset, chunk_size) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
+    if (rdcc->shared && H5D__chunk_cache_prune_shared(dset, chunk_size) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from shared cache")
+
+    /* Grow the hash table (or just clear its deleted slots) if it's too full */
+    if (((size_t)rdcc->nused + rdcc->ndeleted + 1) * 4 > rdcc->nslots_alloc * 3) {
+        size_t nslots = rdcc->nslots_alloc; /* New # of slots */
+
+        while (((size_t)rdcc->nused + 1) * 2 > nslots)
+            nslots *= 2;
+        if (H5D__chunk_cache_rebuild(dset, nslots) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "unable to grow chunk cache hash table")
+    } /* end if */
+
+    /* Find a free slot, starting at the chunk's hash value */
+    idx = H5D__chunk_hash_val(dset->shared, scaled);
+    while (rdcc->slot[idx] && rdcc->slot[idx] != H5D_RDCC_DELETED)
+        if (++idx == rdcc->nslots_alloc)
+            idx = 0;
+
+    /* Create a new entry */
+    if (NULL == (ent = H5FL_CALLOC(H5D_rdcc_ent_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "can't allocate raw data chunk entry")
+
+    /* Initialize the new entry */
+    ent->edge_chunk_state = edge_chunk_state;
+    ent->chunk_block      = *chunk_block;
+    ent->chunk_idx        = chunk_idx;
+    H5MM_memcpy(ent->scaled, scaled, sizeof(hsize_t) * dset->shared->layout.u.chunk.ndims);
+    H5_CHECKED_ASSIGN(ent->rd_count, uint32_t, chunk_size, size_t);
+    H5_CHECKED_ASSIGN(ent->wr_count, uint32_t, chunk_size, size_t);
+    ent->chunk = (uint8_t *)chunk;
+
+    /* Add it to the cache */
+    if (rdcc->slot[idx] == H5D_RDCC_DELETED)
+        rdcc->ndeleted--;
+    rdcc->slot[idx] = ent;
+    ent->idx        = (unsigned)idx;
+    rdcc->nbytes_used += chunk_size;
+    rdcc->nused++;
+
+    /* Add it to the linked list */
+    if (rdcc->tail) {
+        rdcc->tail->next = ent;
+        ent->prev        = rdcc->tail;
+        rdcc->tail       = ent;
+    } /* end if */
+    else
+        rdcc->head = rdcc->tail = ent;
+
+    /* Add it to the file's shared cache, at the most recently used end */
+    ent->owner = dset->shared;
+    if (rdcc->shared) {
+        if (rdcc->shared->tail) {
+            rdcc->shared->tail->gnext = ent;
+            ent->gprev                = rdcc->shared->tail;
+            rdcc->shared->tail        = ent;
+        } /* end if */
+        else
+            rdcc->shared->head = rdcc->shared->tail = ent;
+        rdcc->shared->nbytes_used += chunk_size;
+    } /* end if */
+
+    /* Set return value */
+    ret_value = ent;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_prefetch
+ *
+ * Purpose:     Track the chunks locked for reading, and once a run of
+ *              them has been found with a constant stride through the
+ *              dataset's chunk grid (in row-major order), read the next
+ *              chunks along that stride into the chunk cache before
+ *              they're asked for.
+ *
+ *              Up to the dataset access property list's read-ahead
+ *              count of chunks are read, but no more than fill half of
+ *              the cache.  More are read when the reader has used half
+ *              of those.  The chunks are read together and, for filtered
+ *              datasets, unfiltered together using the transfer property
+ *              list's filter threads.
+ *
+ *              Chunks that are cached already or that don't exist in the
+ *              file are skipped, as are unfiltered partial edge chunks and
+ *              chunks that fail to unfilter.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_prefetch(const H5D_io_info_t *io_info, const hsize_t *scaled)
+{
+    const H5D_t *         dset   = io_info->dset;                     /* Local pointer to the dataset info */
+    const H5O_layout_t *  layout = &(dset->shared->layout);           /* Dataset layout */
+    const H5O_pline_t *   pline  = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    H5D_rdcc_t *          rdcc   = &(dset->shared->cache.chunk);      /* Dataset's chunk cache */
+    unsigned              ndims  = dset->shared->ndims;               /* Rank of dataset */
+    hsize_t               nchunks[H5O_LAYOUT_NDIMS];                  /* # of chunks in each dimension */
+    hsize_t               down[H5O_LAYOUT_NDIMS];                     /* "down" sizes of chunk grid */
+    hsize_t               total;                                      /* Total # of chunks in dataset */
+    hsize_t               curr;                                       /* Linear index of chunk locked */
+    hssize_t              stride;                                     /* Stride between chunks locked */
+    hssize_t              ahead;                                      /* # of chunks read ahead already */
+    hssize_t              k;                                          /* # of strides ahead of chunk */
+    size_t                chunk_size;                                 /* Size of a chunk */
+    size_t                max_ahead;                                  /* Max. # of chunks to read ahead */
+    H5D_chunk_prefetch_t *cands = NULL;                               /* Chunks to read ahead */
+    H5Z_pipeline_buf_t *  bufs  = NULL;                               /* Chunks read */
+    size_t                ncands = 0;                                 /* # of chunks to read ahead */
+    size_t                u;                                          /* Local index variable */
+    herr_t                ret_value = SUCCEED;                        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(scaled);
+    HDassert(rdcc->prefetch.nchunks > 0);
+    HDassert(rdcc->nslots > 0);
+
+    /* Compute the linear index of the chunk in the dataset's chunk grid */
+    for (u = 0; u < ndims; u++) {
+        nchunks[u] = (dset->shared->curr_dims[u] + layout->u.chunk.dim[u] - 1) / layout->u.chunk.dim[u];
+        if (0 == nchunks[u])
+            HGOTO_DONE(SUCCEED)
+    } /* end for */
+    if (H5VM_array_down(ndims, nchunks, down) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't compute 'down' chunk size values")
+    total = down[0] * nchunks[0];
+    curr  = H5VM_array_offset_pre(ndims, down, scaled);
+
+    /* Look for a constant stride between the chunks locked, ignoring
+     * repeated locks of the same chunk */
+    if (rdcc->prefetch.have_last) {
+        if (curr == rdcc->prefetch.last)
+            HGOTO_DONE(SUCCEED)
+        stride                    = (hssize_t)curr - (hssize_t)rdcc->prefetch.last;
+        rdcc->prefetch.sequential = (stride == rdcc->prefetch.stride);
+        rdcc->prefetch.stride     = stride;
+    } /* end if */
+    else
+        rdcc->prefetch.have_last = TRUE;
+    rdcc->prefetch.last = curr;
+    if (!rdcc->prefetch.sequential) {
+        rdcc->prefetch.next = (hssize_t)curr;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    stride = rdcc->prefetch.stride;
+
+    /* Limit the read-ahead to half of the cache */
+    H5_CHECKED_ASSIGN(chunk_size, size_t, layout->u.chunk.size, uint32_t);
+    max_ahead = MIN(rdcc->prefetch.nchunks, (rdcc->nbytes_max / 2) / chunk_size);
+    if (0 == max_ahead)
+        HGOTO_DONE(SUCCEED)
+
+    /* Only read more chunks once half of those read ahead have been used */
+    ahead = ((rdcc->prefetch.next - (hssize_t)curr) / stride) - 1;
+    if (ahead < 0)
+        ahead = 0;
+    if ((size_t)ahead > max_ahead / 2)
+        HGOTO_DONE(SUCCEED)
+
+    if (NULL == (cands = (H5D_chunk_prefetch_t *)H5MM_malloc(max_ahead * sizeof(H5D_chunk_prefetch_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for read ahead chunk list")
+    if (NULL == (bufs = (H5Z_pipeline_buf_t *)H5MM_calloc(max_ahead * sizeof(H5Z_pipeline_buf_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for read ahead buffers")
+
+    /* Choose the chunks to read */
+    for (k = ahead + 1; k <= (hssize_t)max_ahead; k++) {
+        H5D_chunk_prefetch_t *cand = &cands[ncands]; /* Chunk to read ahead */
+        hssize_t              idx  = (hssize_t)curr + (k * stride);
+
+        if (idx < 0 || idx >= (hssize_t)total)
+            break;
+
+        /* Get the info for the chunk in the file */
+        HDmemset(cand->scaled, 0, sizeof(cand->scaled));
+        if (H5VM_array_calc_pre((hsize_t)idx, ndims, down, cand->scaled) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't compute chunk coordinates")
+        if (H5D__chunk_lookup(dset, cand->scaled, &cand->udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Skip chunks that are cached, not in the file, or stored unfiltered */
+        if (UINT_MAX != cand->udata.idx_hint || !H5F_addr_defined(cand->udata.chunk_block.offset))
+            continue;
+        if (pline->nused && (layout->u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS) &&
+            H5D__chunk_is_partial_edge_chunk(ndims, layout->u.chunk.dim, cand->scaled,
+                                             dset->shared->curr_dims))
+            continue;
+
+        ncands++;
+    } /* end for */
+    rdcc->prefetch.next = (hssize_t)curr + (k * stride);
+
+    /* Read the chunks */
+    for (u = 0; u < ncands; u++) {
+        size_t nbytes; /* Size of chunk in file */
+
+        H5_CHECKED_ASSIGN(nbytes, size_t, cands[u].udata.chunk_block.length, hsize_t);
+        if (NULL == (bufs[u].buf = H5D__chunk_mem_alloc(nbytes, pline)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+        bufs[u].nbytes      = nbytes;
+        bufs[u].buf_size    = nbytes;
+        bufs[u].filter_mask = cands[u].udata.filter_mask;
+        if (H5F_shared_block_read(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW,
+                                  cands[u].udata.chunk_block.offset, nbytes, bufs[u].buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+    } /* end for */
+
+    /* Unfilter the chunks */
+    if (ncands > 0 && pline->nused) {
+        unsigned nthreads; /* # of filter threads */
+
+        if (H5CX_get_filter_nthreads(&nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of filter threads")
+        if (H5D__chunk_unfilter_bufs(dset, nthreads, ncands, bufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "unable to unfilter raw data chunks")
+    } /* end if */
+
+    /* Add the chunks to the cache */
+    for (u = 0; u < ncands; u++)
+        if (bufs[u].status >= 0) {
+            H5D_rdcc_ent_t *ent; /* New cache entry */
+
+            if (NULL == (ent = H5D__chunk_cache_insert(dset, cands[u].scaled, &cands[u].udata.chunk_block,
+                                                       cands[u].udata.chunk_idx, 0, bufs[u].buf)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk into cache")
+            bufs[u].buf     = NULL;
+            ent->prefetched = TRUE;
+            rdcc->stats.nprefetches++;
+        } /* end if */
+
+done:
+    if (bufs) {
+        for (u = 0; u < ncands; u++)
+            if (bufs[u].buf)
+                bufs[u].buf = H5D__chunk_mem_xfree(bufs[u].buf, pline);
+        H5MM_xfree(bufs);
+    } /* end if */
+    H5MM_xfree(cands);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_prefetch() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_lock
  *
@@ -3696,6 +4894,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
     H5D_rdcc_ent_t *    ent;                                         /*cache entry        */
     size_t              chunk_size;                                  /*size of a chunk    */
     hbool_t             disable_filters = FALSE; /* Whether to disable filters (when adding to cache) */
+    hbool_t             unlocked        = FALSE; /* Whether the API lock was given up to read the chunk */
     void *              chunk           = NULL;  /*the file chunk    */
     void *              ret_value       = NULL;  /* Return value         */
 
@@ -3707,7 +4906,6 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
     HDassert(udata);
     HDassert(dset);
     HDassert(!(udata->new_unfilt_chunk && prev_unfilt_chunk));
-    HDassert(!rdcc->tmp_head);
 
     /* Get the chunk's size */
     HDassert(layout->u.chunk.size > 0);
@@ -3716,7 +4914,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
     /* Check if the chunk is in the cache */
     if (UINT_MAX != udata->idx_hint) {
         /* Sanity check */
-        HDassert(udata->idx_hint < rdcc->nslots);
+        HDassert(udata->idx_hint < rdcc->nslots_alloc);
         HDassert(rdcc->slot[udata->idx_hint]);
 
         /* Get the entry */
@@ -3736,6 +4934,12 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
          * Already in the cache.  Count a hit.
          */
         rdcc->stats.nhits++;
+        if (rdcc->shared)
+            rdcc->shared->stats.nhits++;
+        if (ent->prefetched) {
+            ent->prefetched = FALSE;
+            rdcc->stats.nprefetch_hits++;
+        } /* end if */
 
         /* Make adjustments if the edge chunk status changed recently */
         if (pline->nused) {
@@ -3815,6 +5019,20 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
             ent->next       = ent->next->next;
             ent->prev->next = ent;
         } /* end if */
+
+        /* The file's shared cache is preempted in strict LRU order, so move
+         * the chunk to the most recently used end of its list */
+        if (rdcc->shared && ent->gnext) {
+            if (ent->gprev)
+                ent->gprev->gnext = ent->gnext;
+            else
+                rdcc->shared->head = ent->gnext;
+            ent->gnext->gprev         = ent->gprev;
+            ent->gprev                = rdcc->shared->tail;
+            ent->gnext                = NULL;
+            rdcc->shared->tail->gnext = ent;
+            rdcc->shared->tail        = ent;
+        } /* end if */
     }     /* end if */
     else {
         haddr_t chunk_addr;  /* Address of chunk on disk */
@@ -3862,6 +5080,8 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
              * miss because we saved ourselves lots of work.
              */
             rdcc->stats.nhits++;
+            if (rdcc->shared)
+                rdcc->shared->stats.nhits++;
 
             if (NULL == (chunk = H5D__chunk_mem_alloc(chunk_size, pline)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
@@ -3881,32 +5101,72 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
                 size_t my_chunk_alloc = chunk_alloc; /* Allocated buffer size */
                 size_t buf_alloc      = chunk_alloc; /* [Re-]allocated buffer size */
 
-                /* Chunk size on disk isn't [likely] the same size as the final chunk
-                 * size in memory, so allocate memory big enough. */
-                if (NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc,
-                                                          (udata->new_unfilt_chunk ? old_pline : pline))))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL,
-                                "memory allocation failed for raw data chunk")
-                if (H5F_shared_block_read(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, chunk_addr,
-                                          my_chunk_alloc, chunk) < 0)
-                    HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
-
-                if (old_pline && old_pline->nused) {
-                    H5Z_EDC_t err_detect; /* Error detection info */
-                    H5Z_cb_t  filter_cb;  /* I/O filter callback function */
+                /* Check if the chunk was already read & unfiltered, along with others */
+                if (io_info->prefilt && io_info->prefilt->nents > 0 && old_pline && old_pline->nused &&
+                    !udata->new_unfilt_chunk) {
+                    H5D_chunk_prefilt_ent_t *ents = io_info->prefilt->ents; /* Chunks in the batch */
+                    size_t                   u;
+
+                    for (u = 0; u < io_info->prefilt->nents; u++)
+                        if (ents[u].chunk && H5F_addr_eq(ents[u].addr, chunk_addr)) {
+                            chunk              = ents[u].chunk;
+                            udata->filter_mask = ents[u].filter_mask;
+                            ents[u].chunk      = NULL;
+                            break;
+                        } /* end if */
+                }         /* end if */
 
-                    /* Retrieve filter settings from API context */
-                    if (H5CX_get_err_detect(&err_detect) < 0)
-                        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't get error detection info")
-                    if (H5CX_get_filter_cb(&filter_cb) < 0)
-                        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't get I/O filter callback function")
+                if (!chunk) {
+                    H5F_shared_t *f_sh        = H5F_SHARED(dset->oloc.file); /* Shared file info */
+                    H5Z_EDC_t     err_detect  = H5Z_ENABLE_EDC;              /* Error detection info */
+                    H5Z_cb_t      filter_cb   = {NULL, NULL};                /* I/O filter callback */
+                    htri_t        unlockable  = TRUE;    /* Whether to give up the API lock */
+                    herr_t        read_status = FAIL;    /* Status of reading the chunk */
+                    herr_t        filt_status = SUCCEED; /* Status of unfiltering the chunk */
+
+                    /* Chunk size on disk isn't [likely] the same size as the final chunk
+                     * size in memory, so allocate memory big enough. */
+                    if (NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc,
+                                                              (udata->new_unfilt_chunk ? old_pline : pline))))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL,
+                                    "memory allocation failed for raw data chunk")
+
+                    if (old_pline && old_pline->nused) {
+                        /* Retrieve filter settings from API context */
+                        if (H5CX_get_err_detect(&err_detect) < 0)
+                            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't get error detection info")
+                        if (H5CX_get_filter_cb(&filter_cb) < 0)
+                            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL,
+                                        "can't get I/O filter callback function")
+
+                        /* Only the library's own filters are known to be safe to run
+                         * without the API lock, and not with an application callback */
+                        if ((unlockable = H5Z_builtin_filters(old_pline)) < 0)
+                            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't check filters")
+                        if (filter_cb.func)
+                            unlockable = FALSE;
+                    } /* end if */
 
-                    if (H5Z_pipeline(old_pline, H5Z_FLAG_REVERSE, &(udata->filter_mask), err_detect,
-                                     filter_cb, &my_chunk_alloc, &buf_alloc, &chunk) < 0)
+                    /* The chunk is read and decoded in a buffer that nothing else can
+                     * see yet, so other threads may use the library meanwhile.
+                     */
+                    if (unlockable)
+                        if (H5F_shared_raw_read_begin(f_sh, &unlocked) < 0)
+                            HGOTO_ERROR(H5E_DATASET, H5E_CANTUNLOCK, NULL, "can't give up API lock")
+                    read_status = H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, chunk_addr, my_chunk_alloc, chunk);
+                    if (read_status >= 0 && old_pline && old_pline->nused)
+                        filt_status =
+                            H5Z_pipeline(old_pline, H5Z_FLAG_REVERSE, &(udata->filter_mask), err_detect,
+                                         filter_cb, &my_chunk_alloc, &buf_alloc, &chunk);
+                    if (H5F_shared_raw_read_end(unlocked) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTLOCK, NULL, "can't take back API lock")
+                    if (read_status < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
+                    if (filt_status < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, NULL, "data pipeline read failed")
 
                     /* Reallocate chunk if necessary */
-                    if (udata->new_unfilt_chunk) {
+                    if (old_pline && old_pline->nused && udata->new_unfilt_chunk) {
                         void *tmp_chunk = chunk;
 
                         if (NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, pline))) {
@@ -3921,6 +5181,8 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
 
                 /* Increment # of cache misses */
                 rdcc->stats.nmisses++;
+                if (rdcc->shared)
+                    rdcc->shared->stats.nmisses++;
             } /* end if */
             else {
                 H5D_fill_value_t fill_status;
@@ -3967,62 +5229,25 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
             } /* end else */
         }     /* end else */
 
-        /* See if the chunk can be cached */
-        if (rdcc->nslots > 0 && chunk_size <= rdcc->nbytes_max) {
-            /* Calculate the index */
-            udata->idx_hint = H5D__chunk_hash_val(io_info->dset->shared, udata->common.scaled);
-
-            /* Add the chunk to the cache only if the slot is not already locked */
-            ent = rdcc->slot[udata->idx_hint];
-            if (!ent || !ent->locked) {
-                /* Preempt enough things from the cache to make room */
-                if (ent) {
-                    if (H5D__chunk_cache_evict(io_info->dset, ent, TRUE) < 0)
-                        HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk from cache")
-                } /* end if */
-                if (H5D__chunk_cache_prune(io_info->dset, chunk_size) < 0)
-                    HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
-
-                /* Create a new entry */
-                if (NULL == (ent = H5FL_CALLOC(H5D_rdcc_ent_t)))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "can't allocate raw data chunk entry")
-
-                ent->edge_chunk_state = disable_filters ? H5D_RDCC_DISABLE_FILTERS : 0;
-                if (udata->new_unfilt_chunk)
-                    ent->edge_chunk_state |= H5D_RDCC_NEWLY_DISABLED_FILTERS;
-
-                /* Initialize the new entry */
-                ent->chunk_block.offset = chunk_addr;
-                ent->chunk_block.length = chunk_alloc;
-                ent->chunk_idx          = udata->chunk_idx;
-                H5MM_memcpy(ent->scaled, udata->common.scaled, sizeof(hsize_t) * layout->u.chunk.ndims);
-                H5_CHECKED_ASSIGN(ent->rd_count, uint32_t, chunk_size, size_t);
-                H5_CHECKED_ASSIGN(ent->wr_count, uint32_t, chunk_size, size_t);
-                ent->chunk = (uint8_t *)chunk;
-
-                /* Add it to the cache */
-                HDassert(NULL == rdcc->slot[udata->idx_hint]);
-                rdcc->slot[udata->idx_hint] = ent;
-                ent->idx                    = udata->idx_hint;
-                rdcc->nbytes_used += chunk_size;
-                rdcc->nused++;
-
-                /* Add it to the linked list */
-                if (rdcc->tail) {
-                    rdcc->tail->next = ent;
-                    ent->prev        = rdcc->tail;
-                    rdcc->tail       = ent;
-                } /* end if */
-                else
-                    rdcc->head = rdcc->tail = ent;
-                ent->tmp_next = NULL;
-                ent->tmp_prev = NULL;
+        /* See if another thread cached the chunk while this one had given up
+         * the API lock, then if the chunk can be cached */
+        if (unlocked && NULL != (ent = H5D__chunk_cache_find(dset->shared, udata->common.scaled)))
+            chunk = H5D__chunk_mem_xfree(chunk, pline);
+        else if (rdcc->nslots > 0 && chunk_size <= rdcc->nbytes_max) {
+            H5F_block_t chunk_block;      /* Offset/length of chunk in file */
+            unsigned    edge_chunk_state; /* States related to edge chunks */
 
-            } /* end if */
-            else
-                /* We did not add the chunk to cache */
-                ent = NULL;
-        }    /* end else */
+            edge_chunk_state = disable_filters ? H5D_RDCC_DISABLE_FILTERS : 0;
+            if (udata->new_unfilt_chunk)
+                edge_chunk_state |= H5D_RDCC_NEWLY_DISABLED_FILTERS;
+            chunk_block.offset = chunk_addr;
+            chunk_block.length = chunk_alloc;
+
+            /* Add the chunk to the cache */
+            if (NULL == (ent = H5D__chunk_cache_insert(io_info->dset, udata->common.scaled, &chunk_block,
+                                                       udata->chunk_idx, edge_chunk_state, chunk)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, NULL, "unable to insert chunk into cache")
+        }    /* end if */
         else /* No cache set up, or chunk is too large: chunk is uncacheable */
             ent = NULL;
     } /* end else */
@@ -4030,8 +5255,9 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
     /* Lock the chunk into the cache */
     if (ent) {
         HDassert(!ent->locked);
-        ent->locked = TRUE;
-        chunk       = ent->chunk;
+        ent->locked     = TRUE;
+        chunk           = ent->chunk;
+        udata->idx_hint = ent->idx;
     } /* end if */
     else
         /*
@@ -4041,6 +5267,17 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
          */
         udata->idx_hint = UINT_MAX;
 
+    /* Read the next chunks ahead of a sequential reader.  This is only
+     * advisory, so a failure is left for the reads of those chunks to report. */
+    if (rdcc->prefetch.nchunks > 0 && ent && io_info->op_type == H5D_IO_OP_READ &&
+        (NULL == io_info->prefilt || NULL == io_info->prefilt->ents)) {
+        if (H5D__chunk_prefetch(io_info, udata->common.scaled) < 0)
+            H5E_clear_stack(NULL);
+
+        /* (Growing the hash table may have moved the chunk) */
+        udata->idx_hint = ent->idx;
+    } /* end if */
+
     /* Set return value */
     ret_value = chunk;
 
@@ -4084,7 +5321,7 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbo
                   uint32_t naccessed)
 {
     const H5O_layout_t *layout    = &(io_info->dset->shared->layout); /* Dataset layout */
-    const H5D_rdcc_t *  rdcc      = &(io_info->dset->shared->cache.chunk);
+    H5D_rdcc_t *        rdcc      = &(io_info->dset->shared->cache.chunk);
     herr_t              ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -4142,7 +5379,7 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbo
         H5D_rdcc_ent_t *ent; /* Chunk's entry in the cache */
 
         /* Sanity check */
-        HDassert(udata->idx_hint < rdcc->nslots);
+        HDassert(udata->idx_hint < rdcc->nslots_alloc);
         HDassert(rdcc->slot[udata->idx_hint]);
         HDassert(rdcc->slot[udata->idx_hint]->chunk == chunk);
 
@@ -4152,6 +5389,9 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbo
         ent = rdcc->slot[udata->idx_hint];
         HDassert(ent->locked);
         if (dirty) {
+            /* Any filtered image of the chunk is now out of date */
+            H5MM_xfree(H5D__chunk_detach_filt(rdcc, ent));
+
             ent->dirty = TRUE;
             ent->wr_count -= MIN(ent->wr_count, naccessed);
         } /* end if */
@@ -5805,11 +7045,8 @@ done:
 herr_t
 H5D__chunk_update_cache(H5D_t *dset)
 {
-    H5D_rdcc_t *    rdcc = &(dset->shared->cache.chunk); /*raw data chunk cache */
-    H5D_rdcc_ent_t *ent, *next;                          /*cache entry  */
-    H5D_rdcc_ent_t  tmp_head;                            /* Sentinel entry for temporary entry list */
-    H5D_rdcc_ent_t *tmp_tail;                            /* Tail pointer for temporary entry list */
-    herr_t          ret_value = SUCCEED;                 /* Return value */
+    H5D_rdcc_t *rdcc      = &(dset->shared->cache.chunk); /*raw data chunk cache */
+    herr_t      ret_value = SUCCEED;                      /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -5821,83 +7058,12 @@ H5D__chunk_update_cache(H5D_t *dset)
     /* Check the rank */
     HDassert((dset->shared->layout.u.chunk.ndims - 1) > 1);
 
-    /* Add temporary entry list to rdcc */
-    (void)HDmemset(&tmp_head, 0, sizeof(tmp_head));
-    rdcc->tmp_head = &tmp_head;
-    tmp_tail       = &tmp_head;
-
-    /* Recompute the index for each cached chunk that is in a dataset */
-    for (ent = rdcc->head; ent; ent = next) {
-        unsigned old_idx; /* Previous index number    */
-
-        /* Get the pointer to the next cache entry */
-        next = ent->next;
-
-        /* Compute the index for the chunk entry */
-        old_idx  = ent->idx; /* Save for later */
-        ent->idx = H5D__chunk_hash_val(dset->shared, ent->scaled);
-
-        if (old_idx != ent->idx) {
-            H5D_rdcc_ent_t *old_ent; /* Old cache entry  */
-
-            /* Check if there is already a chunk at this chunk's new location */
-            old_ent = rdcc->slot[ent->idx];
-            if (old_ent != NULL) {
-                HDassert(old_ent->locked == FALSE);
-                HDassert(old_ent->deleted == FALSE);
-
-                /* Insert the old entry into the temporary list, but do not
-                 * evict (yet).  Make sure we do not make any calls to the index
-                 * until all chunks have updated indices! */
-                HDassert(!old_ent->tmp_next);
-                HDassert(!old_ent->tmp_prev);
-                tmp_tail->tmp_next = old_ent;
-                old_ent->tmp_prev  = tmp_tail;
-                tmp_tail           = old_ent;
-            } /* end if */
-
-            /* Insert this chunk into correct location in hash table */
-            rdcc->slot[ent->idx] = ent;
-
-            /* If this chunk was previously on the temporary list and therefore
-             * not in the hash table, remove it from the temporary list.
-             * Otherwise clear the old hash table slot. */
-            if (ent->tmp_prev) {
-                HDassert(tmp_head.tmp_next);
-                HDassert(tmp_tail != &tmp_head);
-                ent->tmp_prev->tmp_next = ent->tmp_next;
-                if (ent->tmp_next) {
-                    ent->tmp_next->tmp_prev = ent->tmp_prev;
-                    ent->tmp_next           = NULL;
-                } /* end if */
-                else {
-                    HDassert(tmp_tail == ent);
-                    tmp_tail = ent->tmp_prev;
-                } /* end else */
-                ent->tmp_prev = NULL;
-            } /* end if */
-            else
-                rdcc->slot[old_idx] = NULL;
-        } /* end if */
-    }     /* end for */
-
-    /* tmp_tail is no longer needed, and will be invalidated by
-     * H5D_chunk_cache_evict anyways. */
-    tmp_tail = NULL;
-
-    /* Evict chunks that are still on the temporary list */
-    while (tmp_head.tmp_next) {
-        ent = tmp_head.tmp_next;
-
-        /* Remove the old entry from the cache */
-        if (H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
-            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
-    } /* end while */
+    /* Rehash the cached chunks into a new table of the same size */
+    if (rdcc->nslots_alloc > 0)
+        if (H5D__chunk_cache_rebuild(dset, rdcc->nslots_alloc) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to rebuild chunk cache hash table")
 
 done:
-    /* Remove temporary list from rdcc */
-    rdcc->tmp_head = NULL;
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_update_cache() */
 
@@ -5995,30 +7161,12 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
         udata->chunk = NULL;
     }
     else {
-        H5D_rdcc_ent_t *ent = NULL; /* Cache entry */
-        unsigned        idx;        /* Index of chunk in cache, if present */
-        unsigned        u;          /* Counter */
+        H5D_rdcc_ent_t *ent       = NULL; /* Cache entry */
         H5D_shared_t *  shared_fo = (H5D_shared_t *)udata->cpy_info->shared_fo;
 
         /* See if the written chunk is in the chunk cache */
-        if (shared_fo && shared_fo->cache.chunk.nslots > 0) {
-            /* Determine the chunk's location in the hash table */
-            idx = H5D__chunk_hash_val(shared_fo, chunk_rec->scaled);
-
-            /* Get the chunk cache entry for that location */
-            ent = shared_fo->cache.chunk.slot[idx];
-            if (ent) {
-                /* Speculatively set the 'found' flag */
-                udata->chunk_in_cache = TRUE;
-
-                /* Verify that the cache entry is the correct chunk */
-                for (u = 0; u < shared_fo->ndims; u++)
-                    if (chunk_rec->scaled[u] != ent->scaled[u]) {
-                        udata->chunk_in_cache = FALSE;
-                        break;
-                    } /* end if */
-            }         /* end if */
-        }             /* end if */
+        if (shared_fo && NULL != (ent = H5D__chunk_cache_find(shared_fo, chunk_rec->scaled)))
+            udata->chunk_in_cache = TRUE;
 
         if (udata->chunk_in_cache) {
             HDassert(H5F_addr_defined(chunk_rec->chunk_addr));
@@ -6668,6 +7816,9 @@ H5D__chunk_stats(const H5D_t *dset, hbool_t headers)
         HDfprintf(H5DEBUG(AC), "   %-18s %8u %8u %7s %8d+%-9ld\n", "raw data chunks", rdcc->stats.nhits,
                   rdcc->stats.nmisses, ascii, rdcc->stats.ninits,
                   (long)(rdcc->stats.nflushes) - (long)(rdcc->stats.ninits));
+        if (rdcc->stats.nprefetches > 0)
+            HDfprintf(H5DEBUG(AC), "   %-18s %8u %8u (of %u read ahead)\n", "read ahead chunks",
+                      rdcc->stats.nprefetch_hits, rdcc->stats.nprefetch_misses, rdcc->stats.nprefetches);
     }
 
 done:
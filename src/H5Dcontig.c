@@ -61,13 +61,6 @@ typedef struct H5D_contig_readvv_sieve_ud_t {
     unsigned char *             rbuf;         /* Pointer to buffer to fill */
 } H5D_contig_readvv_sieve_ud_t;
 
-/* Callback info for [plain] readvv operation */
-typedef struct H5D_contig_readvv_ud_t {
-    H5F_shared_t * f_sh;      /* Shared file for dataset */
-    haddr_t        dset_addr; /* Address of dataset */
-    unsigned char *rbuf;      /* Pointer to buffer to fill */
-} H5D_contig_readvv_ud_t;
-
 /* Callback info for sieve buffer writevv operation */
 typedef struct H5D_contig_writevv_sieve_ud_t {
     H5F_shared_t *              f_sh;         /* Shared file for dataset */
@@ -76,12 +69,19 @@ typedef struct H5D_contig_writevv_sieve_ud_t {
     const unsigned char *       wbuf;         /* Pointer to buffer to write */
 } H5D_contig_writevv_sieve_ud_t;
 
-/* Callback info for [plain] writevv operation */
-typedef struct H5D_contig_writevv_ud_t {
-    H5F_shared_t *       f_sh;      /* Shared file for dataset */
+/* Callback info for [plain] readvv & writevv operations, which gather the
+ * blocks to transfer into a vector for the file driver
+ */
+typedef struct H5D_contig_vector_ud_t {
     haddr_t              dset_addr; /* Address of dataset */
-    const unsigned char *wbuf;      /* Pointer to buffer to write */
-} H5D_contig_writevv_ud_t;
+    unsigned char *      rbuf;      /* Pointer to buffer to fill (reads) */
+    const unsigned char *wbuf;      /* Pointer to buffer to write (writes) */
+    size_t               nblocks;   /* # of blocks gathered */
+    haddr_t *            addrs;     /* File address of each block */
+    size_t *             sizes;     /* Size of each block */
+    void **              rbufs;     /* Memory buffer for each block (reads) */
+    const void **        wbufs;     /* Memory buffer for each block (writes) */
+} H5D_contig_vector_ud_t;
 
 /********************/
 /* Local Prototypes */
@@ -102,7 +102,13 @@ static ssize_t H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max
 static herr_t  H5D__contig_flush(H5D_t *dset);
 
 /* Helper routines */
-static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset, size_t size);
+static herr_t  H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset, size_t size);
+static herr_t  H5D__contig_read_direct(H5F_shared_t *f_sh, haddr_t addr, size_t len, void *buf);
+static herr_t  H5D__contig_vector_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata);
+static ssize_t H5D__contig_vector_io(const H5D_io_info_t *io_info, hbool_t do_write, size_t dset_max_nseq,
+                                     size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
+                                     size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[],
+                                     hsize_t mem_off_arr[]);
 
 /*********************/
 /* Package Variables */
@@ -668,6 +674,39 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_write_one() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_read_direct
+ *
+ * Purpose:	Reads a block of raw data straight into the application's
+ *		(or the type conversion) buffer, bypassing the sieve
+ *		buffer.  As that buffer belongs to this I/O operation, the
+ *		read may run without holding the API lock.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_read_direct(H5F_shared_t *f_sh, haddr_t addr, size_t len, void *buf)
+{
+    hbool_t unlocked  = FALSE;   /* Whether the API lock was given up */
+    herr_t  status;              /* Status of the read */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (H5F_shared_raw_read_begin(f_sh, &unlocked) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTUNLOCK, FAIL, "can't give up API lock")
+    status = H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf);
+    if (H5F_shared_raw_read_end(unlocked) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTLOCK, FAIL, "can't take back API lock")
+    if (status < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_read_direct() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv_sieve_cb
  *
@@ -718,7 +757,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
     if (NULL == dset_contig->sieve_buf) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
         if (len > dset_contig->sieve_buf_size) {
-            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+            if (H5D__contig_read_direct(f_sh, addr, len, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
         } /* end if */
         else {
@@ -783,7 +822,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
                 }     /* end if */
 
                 /* Read directly into the user's buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+                if (H5D__contig_read_direct(f_sh, addr, len, buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
             } /* end if */
             /* Element size fits within the buffer size */
@@ -836,33 +875,118 @@ done:
 } /* end H5D__contig_readvv_sieve_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__contig_readvv_cb
+ * Function:	H5D__contig_vector_cb
  *
- * Purpose:	Callback operator for H5D__contig_readvv() without sieve buffer.
+ * Purpose:	Callback operator for H5D__contig_readvv() and
+ *		H5D__contig_writevv() without sieve buffer.  Appends the
+ *		block to the vector being gathered for the file driver.
  *
  * Return:	Non-negative on success/Negative on failure
  *
- * Programmer:	Quincey Koziol
- *              Thursday, Sept 30, 2010
- *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__contig_readvv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata)
+H5D__contig_vector_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata)
 {
-    H5D_contig_readvv_ud_t *udata = (H5D_contig_readvv_ud_t *)_udata; /* User data for H5VM_opvv() operator */
-    herr_t                  ret_value = SUCCEED;                      /* Return value */
+    H5D_contig_vector_ud_t *udata = (H5D_contig_vector_ud_t *)_udata; /* User data for H5VM_opvv() operator */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Append the block (the vector was sized by the caller) */
+    udata->addrs[udata->nblocks] = udata->dset_addr + dst_off;
+    udata->sizes[udata->nblocks] = len;
+    if (udata->rbufs)
+        udata->rbufs[udata->nblocks] = udata->rbuf + src_off;
+    else
+        udata->wbufs[udata->nblocks] = udata->wbuf + src_off;
+    udata->nblocks++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__contig_vector_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vector_io
+ *
+ * Purpose:	Reads or writes some data vectors without the sieve buffer,
+ *		gathering every block into one vector I/O request so that
+ *		the file driver can combine them into as few operations as
+ *		it is able to.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static ssize_t
+H5D__contig_vector_io(const H5D_io_info_t *io_info, hbool_t do_write, size_t dset_max_nseq,
+                      size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
+                      size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[])
+{
+    H5D_contig_vector_ud_t udata;          /* User data for H5VM_opvv() operator */
+    size_t                 max_nblocks;    /* Upper bound on # of blocks */
+    ssize_t                ret_value = -1; /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Write data */
-    if (H5F_shared_block_read(udata->f_sh, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len,
-                              (udata->rbuf + src_off)) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+    HDmemset(&udata, 0, sizeof(udata));
+
+    /* Each block ends at least one dataset or memory sequence */
+    max_nblocks = (dset_max_nseq - *dset_curr_seq) + (mem_max_nseq - *mem_curr_seq);
+    if (0 == max_nblocks)
+        HGOTO_DONE(0)
+
+    /* Set up user data for H5VM_opvv() */
+    udata.dset_addr = io_info->store->contig.dset_addr;
+    if (NULL == (udata.addrs = (haddr_t *)H5MM_malloc(max_nblocks * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate address vector")
+    if (NULL == (udata.sizes = (size_t *)H5MM_malloc(max_nblocks * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate size vector")
+    if (do_write) {
+        udata.wbuf = (const unsigned char *)io_info->u.wbuf;
+        if (NULL == (udata.wbufs = (const void **)H5MM_malloc(max_nblocks * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer vector")
+    } /* end if */
+    else {
+        udata.rbuf = (unsigned char *)io_info->u.rbuf;
+        if (NULL == (udata.rbufs = (void **)H5MM_malloc(max_nblocks * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer vector")
+    } /* end else */
+
+    /* Gather the blocks */
+    if ((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr, mem_max_nseq,
+                               mem_curr_seq, mem_len_arr, mem_off_arr, H5D__contig_vector_cb, &udata)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't gather I/O vector")
+    HDassert(udata.nblocks <= max_nblocks);
+
+    /* Transfer them all at once */
+    if (do_write) {
+        if (H5F_shared_vector_write(io_info->f_sh, H5FD_MEM_DRAW, udata.nblocks, udata.addrs, udata.sizes,
+                                    udata.wbufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+    } /* end if */
+    else {
+        hbool_t unlocked = FALSE; /* Whether the API lock was given up */
+        herr_t  status;           /* Status of the read */
+
+        /* The blocks all land in the application's buffer, so other threads
+         * may use the library meanwhile */
+        if (H5F_shared_raw_read_begin(io_info->f_sh, &unlocked) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTUNLOCK, FAIL, "can't give up API lock")
+        status = H5F_shared_vector_read(io_info->f_sh, H5FD_MEM_DRAW, udata.nblocks, udata.addrs, udata.sizes,
+                                        udata.rbufs);
+        if (H5F_shared_raw_read_end(unlocked) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTLOCK, FAIL, "can't take back API lock")
+        if (status < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+    } /* end else */
 
 done:
+    H5MM_xfree(udata.addrs);
+    H5MM_xfree(udata.sizes);
+    H5MM_xfree(udata.rbufs);
+    H5MM_xfree((void *)udata.wbufs);
+
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__contig_readvv_cb() */
+} /* end H5D__contig_vector_io() */
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv
@@ -900,8 +1024,13 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
-    /* Check if data sieving is enabled */
-    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    /* Check if data sieving is enabled (a sieve buffer of zero size that
+     * hasn't been allocated would send each sequence straight to the file,
+     * so the sequences are handed to the file driver together instead)
+     */
+    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE) &&
+        (io_info->dset->shared->cache.contig.sieve_buf_size > 0 ||
+         NULL != io_info->dset->shared->cache.contig.sieve_buf)) {
         H5D_contig_readvv_sieve_ud_t udata; /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -917,17 +1046,10 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
             HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized sieve buffer read")
     } /* end if */
     else {
-        H5D_contig_readvv_ud_t udata; /* User data for H5VM_opvv() operator */
-
-        /* Set up user data for H5VM_opvv() */
-        udata.f_sh      = io_info->f_sh;
-        udata.dset_addr = io_info->store->contig.dset_addr;
-        udata.rbuf      = (unsigned char *)io_info->u.rbuf;
-
-        /* Call generic sequence operation routine */
-        if ((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr, mem_max_nseq,
-                                   mem_curr_seq, mem_len_arr, mem_off_arr, H5D__contig_readvv_cb, &udata)) <
-            0)
+        /* Hand all the sequences to the file driver at once */
+        if ((ret_value = H5D__contig_vector_io(io_info, FALSE, dset_max_nseq, dset_curr_seq, dset_len_arr,
+                                               dset_off_arr, mem_max_nseq, mem_curr_seq, mem_len_arr,
+                                               mem_off_arr)) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized read")
     } /* end else */
 
@@ -1152,36 +1274,6 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_writevv_sieve_cb() */
 
-/*-------------------------------------------------------------------------
- * Function:	H5D__contig_writevv_cb
- *
- * Purpose:	Callback operator for H5D__contig_writevv().
- *
- * Return:	Non-negative on success/Negative on failure
- *
- * Programmer:	Quincey Koziol
- *              Thursday, Sept 30, 2010
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5D__contig_writevv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata)
-{
-    H5D_contig_writevv_ud_t *udata =
-        (H5D_contig_writevv_ud_t *)_udata; /* User data for H5VM_opvv() operator */
-    herr_t ret_value = SUCCEED;            /* Return value */
-
-    FUNC_ENTER_STATIC
-
-    /* Write data */
-    if (H5F_shared_block_write(udata->f_sh, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len,
-                               (udata->wbuf + src_off)) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__contig_writevv_cb() */
-
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_writevv
  *
@@ -1218,8 +1310,13 @@ H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
-    /* Check if data sieving is enabled */
-    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    /* Check if data sieving is enabled (a sieve buffer of zero size that
+     * hasn't been allocated would send each sequence straight to the file,
+     * so the sequences are handed to the file driver together instead)
+     */
+    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE) &&
+        (io_info->dset->shared->cache.contig.sieve_buf_size > 0 ||
+         NULL != io_info->dset->shared->cache.contig.sieve_buf)) {
         H5D_contig_writevv_sieve_ud_t udata; /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -1235,18 +1332,11 @@ H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *
             HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized sieve buffer write")
     } /* end if */
     else {
-        H5D_contig_writevv_ud_t udata; /* User data for H5VM_opvv() operator */
-
-        /* Set up user data for H5VM_opvv() */
-        udata.f_sh      = io_info->f_sh;
-        udata.dset_addr = io_info->store->contig.dset_addr;
-        udata.wbuf      = (const unsigned char *)io_info->u.wbuf;
-
-        /* Call generic sequence operation routine */
-        if ((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr, mem_max_nseq,
-                                   mem_curr_seq, mem_len_arr, mem_off_arr, H5D__contig_writevv_cb, &udata)) <
-            0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized read")
+        /* Hand all the sequences to the file driver at once */
+        if ((ret_value = H5D__contig_vector_io(io_info, TRUE, dset_max_nseq, dset_curr_seq, dset_len_arr,
+                                               dset_off_arr, mem_max_nseq, mem_curr_seq, mem_len_arr,
+                                               mem_off_arr)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized write")
     } /* end else */
 
 done:
@@ -2009,6 +2009,12 @@ H5D_close(H5D_t *dataset)
 #endif                     /* NDEBUG */
         } /* end switch */ /*lint !e788 All appropriate cases are covered */
 
+        /* Free the sequence lists cached for I/O on the dataset */
+        if (dataset->shared->file_seq_cache)
+            H5S_hyper_seq_cache_free(dataset->shared->file_seq_cache);
+        if (dataset->shared->mem_seq_cache)
+            H5S_hyper_seq_cache_free(dataset->shared->mem_seq_cache);
+
         /* Destroy any cached layout information for the dataset */
         if (dataset->shared->layout.ops->dest && (dataset->shared->layout.ops->dest)(dataset) < 0)
             HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to destroy layout info")
@@ -3037,6 +3043,10 @@ H5D__set_extent(H5D_t *dset, const hsize_t *size)
     if (H5D_CONTIGUOUS == dset->shared->layout.type && 0 == dset->shared->dcpl_cache.efl.nused)
         HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "dataset has contiguous storage")
 
+    /* Pinned chunks must not move or be deleted while the application is using them */
+    if (H5D_CHUNKED == dset->shared->layout.type && dset->shared->cache.chunk.npinned > 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't change extent of dataset with pinned chunks")
+
     /* Check if the filters in the DCPL will need to encode, and if so, can they? */
     if (H5D__check_filters(dset) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't apply filters")
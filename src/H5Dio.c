@@ -39,6 +39,17 @@
 /* Local Typedefs */
 /******************/
 
+/* Information about a dataset whose raw data is transferred as one block
+ * during a multi-dataset I/O operation
+ */
+typedef struct H5D_multi_io_seg_t {
+    size_t        idx;      /* Index of the dataset in the caller's arrays */
+    H5F_shared_t *f_sh;     /* Shared file holding the dataset's storage */
+    size_t        file_idx; /* Index of the shared file, for grouping blocks by file */
+    haddr_t       addr;     /* Address of the dataset's storage */
+    size_t        size;     /* Size of the dataset's storage, in bytes */
+} H5D_multi_io_seg_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -54,6 +65,15 @@ static herr_t H5D__ioinfo_adjust(H5D_io_info_t *io_info, const H5D_t *dset, cons
 #endif /* H5_HAVE_PARALLEL */
 static herr_t H5D__typeinfo_term(const H5D_type_info_t *type_info);
 
+/* Multi-dataset I/O routines */
+static htri_t H5D__multi_io_is_block(const H5D_t *dset, hid_t mem_type_id, const H5S_t *mem_space,
+                                     const H5S_t *file_space, hbool_t do_write, size_t *size);
+static int    H5D__multi_io_seg_cmp(const void *_seg1, const void *_seg2);
+static int    H5D__multi_io_dset_cmp(const void *_dset1, const void *_dset2);
+static herr_t H5D__multi_io(size_t count, H5D_t *dset[], hid_t mem_type_id[], const H5S_t *mem_space[],
+                            const H5S_t *file_space[], H5D_io_op_type_t op_type, void *rbuf[],
+                            const void *wbuf[]);
+
 /*********************/
 /* Package Variables */
 /*********************/
@@ -154,7 +174,7 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_i
     H5VL_object_t *vol_obj   = NULL;
     herr_t         ret_value = SUCCEED; /* Return value */
 
-    FUNC_ENTER_API(FAIL)
+    FUNC_ENTER_API_SHARED(FAIL)
     H5TRACE6("e", "iiiiix", dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
 
     /* Check arguments */
@@ -228,6 +248,104 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread_chunk() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dpin_chunk
+ *
+ * Purpose:     Pins the chunk at OFFSET in the dataset's chunk cache and
+ *              returns a read-only pointer to its data in BUF, so that
+ *              the chunk can be used without copying it into an
+ *              application buffer.  The chunk is read in and run through
+ *              the filter pipeline first, if it isn't in the cache yet,
+ *              and its size is returned in BUF_SIZE.
+ *
+ *              The elements are laid out as in the chunk, with the
+ *              chunk's dimensions (partial edge chunks included), and are
+ *              not converted, so MEM_TYPE_ID must be a datatype that needs
+ *              no conversion from the dataset's datatype.  Data transforms
+ *              are not applied.
+ *
+ *              The pointer is valid until the chunk is released with
+ *              H5Dunpin_chunk, once for each time it was pinned, or the
+ *              dataset is closed.  Writes to the chunk through H5Dwrite
+ *              while it's pinned are visible through the pointer.  The
+ *              extent of a dataset with pinned chunks can't be changed
+ *              and pinned chunks can't be overwritten by H5Dwrite_chunk.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dpin_chunk(hid_t dset_id, hid_t dxpl_id, hid_t mem_type_id, const hsize_t *offset,
+             const void **buf /*out*/, size_t *buf_size /*out*/)
+{
+    H5VL_object_t *vol_obj   = NULL;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "iii*hxx", dset_id, dxpl_id, mem_type_id, offset, buf, buf_size);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    if (!offset)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offset cannot be NULL")
+    if (!buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf cannot be NULL")
+    if (!buf_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf_size cannot be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    /* Pin the chunk */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_PIN, dxpl_id, H5_REQUEST_NULL, mem_type_id,
+                              offset, buf, buf_size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTPIN, FAIL, "can't pin chunk")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dpin_chunk() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dunpin_chunk
+ *
+ * Purpose:     Releases a pin taken on the chunk at OFFSET with
+ *              H5Dpin_chunk.  The pointer returned when it was pinned
+ *              must not be used afterwards, unless the chunk is still
+ *              pinned by another call.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dunpin_chunk(hid_t dset_id, const hsize_t *offset)
+{
+    H5VL_object_t *vol_obj   = NULL;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*h", dset_id, offset);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    if (!offset)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offset cannot be NULL")
+
+    /* Unpin the chunk */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_UNPIN, H5P_DATASET_XFER_DEFAULT,
+                              H5_REQUEST_NULL, offset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTUNPIN, FAIL, "can't unpin chunk")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dunpin_chunk() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite
  *
@@ -347,6 +465,150 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite_chunk() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_multi
+ *
+ * Purpose:     Reads (part of) COUNT datasets into application memory, as
+ *              if H5Dread() were called for each element of the DSET_ID,
+ *              MEM_TYPE_ID, MEM_SPACE_ID, FILE_SPACE_ID and BUF arrays
+ *              with the data transfer property list DXPL_ID.
+ *
+ *              Passing all of the datasets to the library at once lets it
+ *              combine their I/O: datasets with contiguous storage that
+ *              are read in their entirety without datatype conversion are
+ *              read from the file in address order, with the reads of
+ *              adjacent datasets merged together.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+              hid_t file_space_id[], hid_t dxpl_id, void *buf[] /*out*/)
+{
+    H5VL_object_t **vol_obj   = NULL;    /* VOL objects for the datasets */
+    size_t          u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API_SHARED(FAIL)
+    H5TRACE7("e", "z*i*i*i*iix", count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
+
+    /* Check arguments */
+    if (count == 0)
+        HGOTO_DONE(SUCCEED)
+    if (!dset_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dset_id array not provided")
+    if (!mem_type_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_type_id array not provided")
+    if (!mem_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_space_id array not provided")
+    if (!file_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file_space_id array not provided")
+    if (!buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf array not provided")
+
+    /* Get the dataset pointers */
+    if (NULL == (vol_obj = (H5VL_object_t **)H5MM_malloc(count * sizeof(H5VL_object_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataset object array")
+    for (u = 0; u < count; u++) {
+        if (mem_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+        if (file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+        if (NULL == (vol_obj[u] = (H5VL_object_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    } /* end for */
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Read the data */
+    if (H5VL_dataset_read_multi(count, vol_obj, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf,
+                                H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    H5MM_xfree(vol_obj);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_multi
+ *
+ * Purpose:     Writes (part of) COUNT datasets from application memory,
+ *              as if H5Dwrite() were called for each element of the
+ *              DSET_ID, MEM_TYPE_ID, MEM_SPACE_ID, FILE_SPACE_ID and BUF
+ *              arrays with the data transfer property list DXPL_ID.
+ *
+ *              Passing all of the datasets to the library at once lets it
+ *              combine their I/O: datasets with contiguous storage that
+ *              are written in their entirety without datatype conversion
+ *              are written to the file in address order, with the writes
+ *              of adjacent datasets merged together.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+               hid_t file_space_id[], hid_t dxpl_id, const void *buf[])
+{
+    H5VL_object_t **vol_obj   = NULL;    /* VOL objects for the datasets */
+    size_t          u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
+
+    /* Check arguments */
+    if (count == 0)
+        HGOTO_DONE(SUCCEED)
+    if (!dset_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dset_id array not provided")
+    if (!mem_type_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_type_id array not provided")
+    if (!mem_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_space_id array not provided")
+    if (!file_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file_space_id array not provided")
+    if (!buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf array not provided")
+
+    /* Get the dataset pointers */
+    if (NULL == (vol_obj = (H5VL_object_t **)H5MM_malloc(count * sizeof(H5VL_object_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataset object array")
+    for (u = 0; u < count; u++) {
+        if (mem_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+        if (file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+        if (NULL == (vol_obj[u] = (H5VL_object_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    } /* end for */
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Write the data */
+    if (H5VL_dataset_write_multi(count, vol_obj, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf,
+                                 H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    H5MM_xfree(vol_obj);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__read
  *
@@ -798,6 +1060,380 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__write() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_io_is_block
+ *
+ * Purpose:	Checks whether a dataset's part of a multi-dataset I/O
+ *              operation moves its whole storage, unchanged, between the
+ *              file and the application's buffer, so that it can be done
+ *              as a single block transfer.  Anything else (including
+ *              requests that are in error) is left to H5D__read() or
+ *              H5D__write().
+ *
+ * Return:	TRUE/FALSE/FAIL.  On TRUE, the size of the block is
+ *              returned in *SIZE.
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__multi_io_is_block(const H5D_t *dset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
+                       hbool_t do_write, size_t *size)
+{
+    const H5T_t *     mem_type;         /* Memory datatype */
+    H5T_path_t *      tpath;            /* Datatype conversion path */
+    H5Z_data_xform_t *data_transform;   /* Data transform info */
+    hsize_t           nelmts;           /* Number of elements transferred */
+    hsize_t           nbytes;           /* Number of bytes transferred */
+    htri_t            ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+    HDassert(size);
+
+    /* Only contiguous storage in the file itself, which has been allocated */
+    if (dset->shared->layout.type != H5D_CONTIGUOUS || dset->shared->dcpl_cache.efl.nused > 0 ||
+        !(*dset->shared->layout.ops->is_space_alloc)(&dset->shared->layout.storage))
+        HGOTO_DONE(FALSE)
+
+#ifdef H5_HAVE_PARALLEL
+    /* MPI-based VFDs have their own I/O paths */
+    if (H5F_HAS_FEATURE(dset->oloc.file, H5FD_FEAT_HAS_MPI))
+        HGOTO_DONE(FALSE)
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Let H5D__write() report writes to read-only files */
+    if (do_write && 0 == (H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR))
+        HGOTO_DONE(FALSE)
+
+    /* Only whole dataset selections, in file & memory */
+    if (!file_space)
+        file_space = dset->shared->space;
+    if (!mem_space)
+        mem_space = file_space;
+    if (H5S_GET_SELECT_TYPE(file_space) != H5S_SEL_ALL || H5S_GET_SELECT_TYPE(mem_space) != H5S_SEL_ALL)
+        HGOTO_DONE(FALSE)
+    if (!H5S_has_extent(file_space) || !H5S_has_extent(mem_space))
+        HGOTO_DONE(FALSE)
+    nelmts = H5S_GET_SELECT_NPOINTS(file_space);
+    if (nelmts == 0 || nelmts != H5S_GET_SELECT_NPOINTS(mem_space) ||
+        nelmts != (hsize_t)H5S_GET_EXTENT_NPOINTS(dset->shared->space))
+        HGOTO_DONE(FALSE)
+
+    /* Only without datatype conversion or data transforms */
+    if (NULL == (mem_type = (const H5T_t *)H5I_object_verify(mem_type_id, H5I_DATATYPE)))
+        HGOTO_DONE(FALSE)
+    if (NULL == (tpath = do_write ? H5T_path_find(mem_type, dset->shared->type)
+                                  : H5T_path_find(dset->shared->type, mem_type)))
+        HGOTO_DONE(FALSE)
+    if (!H5T_path_noop(tpath))
+        HGOTO_DONE(FALSE)
+    if (H5CX_get_data_transform(&data_transform) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get data transform info")
+    if (!H5Z_xform_noop(data_transform))
+        HGOTO_DONE(FALSE)
+
+    /* The block must cover exactly the dataset's storage */
+    nbytes = nelmts * H5T_get_size(dset->shared->type);
+    if (nbytes != dset->shared->layout.storage.u.contig.size || nbytes != (hsize_t)((size_t)nbytes))
+        HGOTO_DONE(FALSE)
+    *size = (size_t)nbytes;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_io_is_block() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_io_seg_cmp
+ *
+ * Purpose:	Compares two blocks of a multi-dataset I/O operation, for
+ *              sorting them by file, then by address, then by their
+ *              position in the caller's arrays.
+ *
+ * Return:	<0, 0 or >0, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__multi_io_seg_cmp(const void *_seg1, const void *_seg2)
+{
+    const H5D_multi_io_seg_t *seg1 = (const H5D_multi_io_seg_t *)_seg1;
+    const H5D_multi_io_seg_t *seg2      = (const H5D_multi_io_seg_t *)_seg2;
+    int                       ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (seg1->file_idx != seg2->file_idx)
+        ret_value = seg1->file_idx < seg2->file_idx ? -1 : 1;
+    else if (H5F_addr_ne(seg1->addr, seg2->addr))
+        ret_value = H5F_addr_lt(seg1->addr, seg2->addr) ? -1 : 1;
+    else
+        ret_value = seg1->idx < seg2->idx ? -1 : (seg1->idx > seg2->idx ? 1 : 0);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_io_seg_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_io_dset_cmp
+ *
+ * Purpose:	Compares the shared info of two datasets of a multi-dataset
+ *              I/O operation, for finding datasets that appear more than
+ *              once.
+ *
+ * Return:	<0, 0 or >0, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__multi_io_dset_cmp(const void *_dset1, const void *_dset2)
+{
+    uintptr_t dset1     = (uintptr_t)(*(const H5D_shared_t *const *)_dset1);
+    uintptr_t dset2     = (uintptr_t)(*(const H5D_shared_t *const *)_dset2);
+    int       ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (dset1 != dset2)
+        ret_value = dset1 < dset2 ? -1 : 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_io_dset_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_io
+ *
+ * Purpose:	Reads or writes (part of) several datasets.  Datasets that
+ *              H5D__multi_io_is_block() accepts are transferred as blocks
+ *              sorted by address, with blocks that are adjacent in the
+ *              file merged (through a buffer of at most the DXPL's
+ *              maximum temporary buffer size) into one block read or
+ *              write.  All other datasets go through H5D__read() or
+ *              H5D__write().
+ *
+ *              If a dataset appears more than once (through the same or
+ *              different handles), every dataset goes through H5D__read()
+ *              or H5D__write() in the order given, so that the outcome is
+ *              the same as transferring each element in turn.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__multi_io(size_t count, H5D_t *dset[], hid_t mem_type_id[], const H5S_t *mem_space[],
+              const H5S_t *file_space[], H5D_io_op_type_t op_type, void *rbuf[], const void *wbuf[])
+{
+    size_t              max_temp_buf;         /* Size of merge buffer */
+    hbool_t             do_write;             /* Whether the operation is a write */
+    size_t              u, v;                 /* Local index variables */
+    H5D_multi_io_seg_t *segs       = NULL;    /* Blocks to transfer */
+    H5F_shared_t **     files      = NULL;    /* Distinct shared files of the blocks */
+    size_t              nsegs      = 0;       /* Number of blocks */
+    size_t              nfiles     = 0;       /* Number of distinct shared files */
+    uint8_t *           merge_buf  = NULL;    /* Buffer for merging adjacent blocks */
+    hbool_t             try_blocks = TRUE;    /* Whether to look for datasets to transfer as blocks */
+    herr_t              ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(count > 0);
+    HDassert(dset);
+
+    do_write = (hbool_t)(op_type == H5D_IO_OP_WRITE);
+
+    if (NULL == (segs = (H5D_multi_io_seg_t *)H5MM_malloc(count * sizeof(H5D_multi_io_seg_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate block array")
+    if (NULL == (files = (H5F_shared_t **)H5MM_malloc(count * sizeof(H5F_shared_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate file array")
+
+#ifdef H5_HAVE_PARALLEL
+    {
+        H5FD_mpio_xfer_t io_xfer_mode; /* MPI I/O transfer mode */
+
+        /* Leave collective requests to H5D__read() & H5D__write() */
+        if (H5CX_get_io_xfer_mode(&io_xfer_mode) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+        if (io_xfer_mode == H5FD_MPIO_COLLECTIVE)
+            try_blocks = FALSE;
+    }
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Only transfer blocks out of order when no dataset appears twice */
+    if (try_blocks && count > 1) {
+        H5D_shared_t **shared = NULL; /* Shared info of the datasets */
+
+        if (NULL == (shared = (H5D_shared_t **)H5MM_malloc(count * sizeof(H5D_shared_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataset array")
+        for (u = 0; u < count; u++)
+            shared[u] = dset[u]->shared;
+        HDqsort(shared, count, sizeof(H5D_shared_t *), H5D__multi_io_dset_cmp);
+        for (u = 1; u < count; u++)
+            if (shared[u] == shared[u - 1]) {
+                try_blocks = FALSE;
+                break;
+            } /* end if */
+        H5MM_xfree(shared);
+    } /* end if */
+
+    /* Sort the datasets into blocks and everything else */
+    for (u = 0; u < count; u++) {
+        htri_t is_block = FALSE; /* Whether the dataset is transferred as one block */
+        size_t size     = 0;     /* Size of the block */
+
+        if (try_blocks)
+            if ((is_block = H5D__multi_io_is_block(dset[u], mem_type_id[u], mem_space[u], file_space[u],
+                                                   do_write, &size)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't check dataset for block I/O")
+
+        if (is_block) {
+            H5F_shared_t *f_sh = H5F_SHARED(dset[u]->oloc.file);
+
+            /* The sieve buffer must not hold data newer than the file, and
+             * must not be left holding data older than the file
+             */
+            if (H5D__flush_sieve_buf(dset[u]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush sieve buffer")
+            if (do_write)
+                dset[u]->shared->cache.contig.sieve_size = 0;
+
+            for (v = 0; v < nfiles; v++)
+                if (files[v] == f_sh)
+                    break;
+            if (v == nfiles)
+                files[nfiles++] = f_sh;
+
+            segs[nsegs].idx      = u;
+            segs[nsegs].f_sh     = f_sh;
+            segs[nsegs].file_idx = v;
+            segs[nsegs].addr     = dset[u]->shared->layout.storage.u.contig.addr;
+            segs[nsegs].size     = size;
+            nsegs++;
+        } /* end if */
+        else if (do_write) {
+            if (H5D__write(dset[u], mem_type_id[u], mem_space[u], file_space[u], wbuf[u]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+        } /* end if */
+        else if (H5D__read(dset[u], mem_type_id[u], mem_space[u], file_space[u], rbuf[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end for */
+
+    if (nsegs == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Put the blocks in file address order */
+    HDqsort(segs, nsegs, sizeof(H5D_multi_io_seg_t), H5D__multi_io_seg_cmp);
+
+    if (H5CX_get_max_temp_buf(&max_temp_buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve max. temp. buf size")
+
+    /* Transfer runs of adjacent blocks */
+    for (u = 0; u < nsegs; u = v) {
+        size_t run_size = segs[u].size; /* Size of the run of blocks */
+
+        /* Find the blocks adjacent to this one, which fit in the merge buffer with it */
+        for (v = u + 1; v < nsegs; v++)
+            if (segs[v].file_idx != segs[u].file_idx ||
+                H5F_addr_ne(segs[v].addr, segs[v - 1].addr + segs[v - 1].size) ||
+                run_size + segs[v].size > max_temp_buf)
+                break;
+            else
+                run_size += segs[v].size;
+
+        if (v == u + 1) {
+            /* Transfer a single block directly to/from the application's buffer */
+            if (do_write) {
+                if (H5F_shared_block_write(segs[u].f_sh, H5FD_MEM_DRAW, segs[u].addr, segs[u].size,
+                                           wbuf[segs[u].idx]) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+            } /* end if */
+            else if (H5F_shared_block_read(segs[u].f_sh, H5FD_MEM_DRAW, segs[u].addr, segs[u].size,
+                                           rbuf[segs[u].idx]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+        } /* end if */
+        else {
+            uint8_t *p; /* Pointer into the merge buffer */
+            size_t   w; /* Local index variable */
+
+            if (NULL == merge_buf)
+                if (NULL == (merge_buf = H5FL_BLK_MALLOC(type_conv, max_temp_buf)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for merge buffer")
+
+            /* Transfer the whole run through the merge buffer */
+            if (do_write) {
+                for (w = u, p = merge_buf; w < v; p += segs[w].size, w++)
+                    H5MM_memcpy(p, wbuf[segs[w].idx], segs[w].size);
+                if (H5F_shared_block_write(segs[u].f_sh, H5FD_MEM_DRAW, segs[u].addr, run_size, merge_buf) <
+                    0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+            } /* end if */
+            else {
+                if (H5F_shared_block_read(segs[u].f_sh, H5FD_MEM_DRAW, segs[u].addr, run_size, merge_buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+                for (w = u, p = merge_buf; w < v; p += segs[w].size, w++)
+                    H5MM_memcpy(rbuf[segs[w].idx], p, segs[w].size);
+            } /* end else */
+        }     /* end else */
+    }         /* end for */
+
+done:
+    if (merge_buf)
+        merge_buf = H5FL_BLK_FREE(type_conv, merge_buf);
+    H5MM_xfree(files);
+    H5MM_xfree(segs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read_multi
+ *
+ * Purpose:	Reads (part of) several datasets into application memory.
+ *              See H5Dread_multi() for complete details.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__read_multi(size_t count, H5D_t *dset[], hid_t mem_type_id[], const H5S_t *mem_space[],
+                const H5S_t *file_space[], void *buf[] /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5D__multi_io(count, dset, mem_type_id, mem_space, file_space, H5D_IO_OP_READ, buf, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__write_multi
+ *
+ * Purpose:	Writes (part of) several datasets from application memory.
+ *              See H5Dwrite_multi() for complete details.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__write_multi(size_t count, H5D_t *dset[], hid_t mem_type_id[], const H5S_t *mem_space[],
+                 const H5S_t *file_space[], const void *buf[])
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5D__multi_io(count, dset, mem_type_id, mem_space, file_space, H5D_IO_OP_WRITE, NULL, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__write_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__ioinfo_init
  *
@@ -826,7 +1462,8 @@ H5D__ioinfo_init(H5D_t *dset, const H5D_type_info_t *type_info, H5D_storage_t *s
     /* Set up "normal" I/O fields */
     io_info->dset  = dset;
     io_info->f_sh  = H5F_SHARED(dset->oloc.file);
-    io_info->store = store;
+    io_info->store   = store;
+    io_info->prefilt = NULL;
 
     /* Set I/O operations to initial values */
     io_info->layout_ops = *dset->shared->layout.ops;
@@ -932,6 +1569,7 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_t
     type_info->max_type_size = MAX(type_info->src_type_size, type_info->dst_type_size);
     type_info->is_conv_noop  = H5T_path_noop(type_info->tpath);
     type_info->is_xform_noop = H5Z_xform_noop(data_transform);
+    type_info->is_conv_swap  = !type_info->is_conv_noop && H5T_path_swap(type_info->tpath);
     if (type_info->is_xform_noop && type_info->is_conv_noop) {
         type_info->cmpd_subset = NULL;
         type_info->need_bkg    = H5T_BKG_NO;
@@ -971,6 +1609,19 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_t
                 type_info->need_bkg = H5T_BKG_NO; /*never needed even if app says yes*/
         }                                         /* end else */
 
+        /* Check if elements read can be gathered into the application's buffer
+         * and converted there: conversions between numbers that don't make
+         * them smaller and don't need a background buffer */
+        if (!do_write && H5T_BKG_NO == type_info->need_bkg &&
+            type_info->dst_type_size >= type_info->src_type_size) {
+            H5T_class_t src_class = H5T_get_class(src_type, FALSE); /* Class of source datatype */
+            H5T_class_t dst_class = H5T_get_class(dst_type, FALSE); /* Class of destination datatype */
+
+            if ((H5T_INTEGER == src_class || H5T_FLOAT == src_class) &&
+                (H5T_INTEGER == dst_class || H5T_FLOAT == dst_class))
+                type_info->is_conv_in_place = TRUE;
+        } /* end if */
+
         /* Set up datatype conversion/background buffers */
 
         target_size = max_temp_buf;
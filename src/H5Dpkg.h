@@ -50,12 +50,14 @@
     (io_info)->f_sh    = H5F_SHARED((ds)->oloc.file);                                                        \
     (io_info)->store   = str;                                                                                \
     (io_info)->op_type = H5D_IO_OP_WRITE;                                                                    \
+    (io_info)->prefilt = NULL;                                                                               \
     (io_info)->u.wbuf  = buf
 #define H5D_BUILD_IO_INFO_RD(io_info, ds, str, buf)                                                          \
     (io_info)->dset    = ds;                                                                                 \
     (io_info)->f_sh    = H5F_SHARED((ds)->oloc.file);                                                        \
     (io_info)->store   = str;                                                                                \
     (io_info)->op_type = H5D_IO_OP_READ;                                                                     \
+    (io_info)->prefilt = NULL;                                                                               \
     (io_info)->u.rbuf  = buf
 
 /* Flags for marking aspects of a dataset dirty */
@@ -102,6 +104,7 @@ typedef struct H5D_type_info_t {
     size_t                   max_type_size;  /* Size of largest source/destination type */
     hbool_t                  is_conv_noop;   /* Whether the type conversion is a NOOP */
     hbool_t                  is_xform_noop;  /* Whether the data transform is a NOOP */
+    hbool_t                  is_conv_swap;   /* Whether the type conversion only reverses byte order */
     const H5T_subset_info_t *cmpd_subset;    /* Info related to the compound subset conversion functions */
     H5T_bkg_t                need_bkg;       /* Type of background buf needed */
     size_t                   request_nelmts; /* Requested strip mine */
@@ -109,6 +112,7 @@ typedef struct H5D_type_info_t {
     hbool_t                  tconv_buf_allocated; /* Whether the type conversion buffer was allocated */
     uint8_t *                bkg_buf;             /* Background buffer */
     hbool_t                  bkg_buf_allocated;   /* Whether the background buffer was allocated */
+    hbool_t                  is_conv_in_place;    /* Whether to convert read elements in the app's buffer */
 } H5D_type_info_t;
 
 /* Forward declaration of structs used below */
@@ -219,10 +223,11 @@ typedef struct H5D_io_info_t {
     MPI_Comm comm;               /* MPI communicator for file */
     hbool_t  using_mpi_vfd;      /* Whether the file is using an MPI-based VFD */
 #endif                           /* H5_HAVE_PARALLEL */
-    H5D_storage_t *  store;      /* Dataset storage info */
-    H5D_layout_ops_t layout_ops; /* Dataset layout I/O operation function pointers */
-    H5D_io_ops_t     io_ops;     /* I/O operation function pointers */
-    H5D_io_op_type_t op_type;
+    H5D_storage_t *             store;      /* Dataset storage info */
+    H5D_layout_ops_t            layout_ops; /* Dataset layout I/O operation function pointers */
+    H5D_io_ops_t                io_ops;     /* I/O operation function pointers */
+    H5D_io_op_type_t            op_type;
+    struct H5D_chunk_prefilt_t *prefilt; /* Chunks read & unfiltered ahead of being locked (chunked reads) */
     union {
         void *      rbuf; /* Pointer to buffer for read */
         const void *wbuf; /* Pointer to buffer to write */
@@ -361,6 +366,8 @@ typedef struct H5D_chunk_map_t {
     H5S_t *           single_space;      /* Dataspace for single chunk */
     H5D_chunk_info_t *single_chunk_info; /* Pointer to single chunk's info */
     hbool_t           use_single;        /* Whether I/O is on a single element */
+    hbool_t *map_in_use; /* Dataset's flag to reset when done with its 'sel_chunks' & single chunk info,
+                          * or NULL if the map has its own */
 
     hsize_t           last_index;      /* Index of last chunk operated on */
     H5D_chunk_info_t *last_chunk_info; /* Pointer to last chunk's info */
@@ -392,35 +399,71 @@ typedef struct H5D_virtual_held_file_t {
     struct H5D_virtual_held_file_t *next; /* Pointer to next node in list */
 } H5D_virtual_held_file_t;
 
-/* The raw data chunk cache */
 struct H5D_rdcc_ent_t; /* Forward declaration of struct used below */
+
+/* The raw data chunk cache shared by all the chunked datasets in a file */
+typedef struct H5D_rdcc_shared_t {
+    struct {
+        hsize_t nhits;   /* Number of cache hits            */
+        hsize_t nmisses; /* Number of cache misses        */
+    } stats;
+    size_t                 nbytes_max;  /* Maximum cached raw data in bytes    */
+    size_t                 nbytes_used; /* Current cached raw data in bytes */
+    struct H5D_rdcc_ent_t *head;        /* Head of doubly linked list of all datasets' entries */
+    struct H5D_rdcc_ent_t *tail;        /* Tail of doubly linked list of all datasets' entries */
+} H5D_rdcc_shared_t;
+
+/* The raw data chunk cache */
 typedef struct H5D_rdcc_t {
     struct {
-        unsigned ninits;   /* Number of chunk creations        */
-        unsigned nhits;    /* Number of cache hits            */
-        unsigned nmisses;  /* Number of cache misses        */
-        unsigned nflushes; /* Number of cache flushes        */
+        unsigned ninits;           /* Number of chunk creations        */
+        unsigned nhits;            /* Number of cache hits            */
+        unsigned nmisses;          /* Number of cache misses        */
+        unsigned nflushes;         /* Number of cache flushes        */
+        unsigned nprefetches;      /* Number of chunks read ahead        */
+        unsigned nprefetch_hits;   /* Number of chunks read ahead & then accessed */
+        unsigned nprefetch_misses; /* Number of chunks read ahead & preempted unused */
     } stats;
-    size_t                 nbytes_max; /* Maximum cached raw data in bytes    */
-    size_t                 nslots;     /* Number of chunk slots allocated    */
-    double                 w0;         /* Chunk preemption policy          */
-    struct H5D_rdcc_ent_t *head;       /* Head of doubly linked list        */
-    struct H5D_rdcc_ent_t *tail;       /* Tail of doubly linked list        */
-    struct H5D_rdcc_ent_t
-        *tmp_head; /* Head of temporary doubly linked list.  Chunks on this list are not in the hash table
-                      (slot).  The head entry is a sentinel (does not refer to an actual chunk). */
+    size_t                  nbytes_max;        /* Maximum cached raw data in bytes    */
+    size_t                  nslots;            /* Number of chunk slots requested (0 disables the cache) */
+    double                  w0;                /* Chunk preemption policy          */
+    struct H5D_rdcc_ent_t * head;              /* Head of doubly linked list        */
+    struct H5D_rdcc_ent_t * tail;              /* Tail of doubly linked list        */
     size_t                  nbytes_used;       /* Current cached raw data in bytes */
     int                     nused;             /* Number of chunk slots in use        */
     H5D_chunk_cached_t      last;              /* Cached copy of last chunk information */
-    struct H5D_rdcc_ent_t **slot;              /* Chunk slots, each points to a chunk*/
+    struct H5D_rdcc_ent_t **slot;              /* Hash table of chunks, with linear probing */
+    size_t                  nslots_alloc;      /* Number of chunk slots allocated (grows as needed) */
+    size_t                  ndeleted;          /* Number of slots marked deleted */
     H5SL_t *                sel_chunks;        /* Skip list containing information for each chunk selected */
     H5S_t *                 single_space;      /* Dataspace for single element I/O on chunks */
     H5D_chunk_info_t *      single_chunk_info; /* Pointer to single chunk's info */
+    hbool_t                 map_in_use;        /* Whether the 3 fields above are used by an I/O operation */
 
     /* Cached information about scaled dataspace dimensions */
     hsize_t  scaled_dims[H5S_MAX_RANK];        /* The scaled dim sizes */
     hsize_t  scaled_power2up[H5S_MAX_RANK];    /* The scaled dim sizes, rounded up to next power of 2 */
     unsigned scaled_encode_bits[H5S_MAX_RANK]; /* The number of bits needed to encode the scaled dim sizes */
+
+    /* Information for reading chunks ahead */
+    struct {
+        unsigned nchunks;    /* # of chunks to read ahead (0 disables read-ahead) */
+        hbool_t  have_last;  /* Whether 'last' is valid */
+        hsize_t  last;       /* Linear index of last chunk locked */
+        hssize_t stride;     /* Distance between last two distinct chunks locked */
+        hbool_t  sequential; /* Whether the last three distinct chunks had the same stride */
+        hssize_t next;       /* Linear index one stride past the chunks read ahead */
+    } prefetch;
+
+    /* Information for running the filter pipeline on several chunks at once */
+    unsigned filter_nthreads;   /* # of filter threads for flushing (from last write) */
+    size_t   filter_block_size; /* Block size for splitting chunks (from last write) */
+
+    unsigned npinned; /* # of pins the application holds on the dataset's chunks */
+
+    /* Information for the chunk cache shared by all the file's datasets */
+    H5D_rdcc_shared_t *shared;  /* File's shared chunk cache (NULL if not used) */
+    haddr_t            oh_addr; /* Address of dataset's object header, for flushing its chunks */
 } H5D_rdcc_t;
 
 /* The raw data contiguous data cache */
@@ -466,6 +509,10 @@ struct H5D_shared_t {
         H5D_rdcc_t chunk;   /* Information about chunked data */
     } cache;
 
+    /* Sequence lists cached for the selections of I/O on the dataset */
+    H5S_hyper_seq_cache_t *file_seq_cache; /* For selections in the dataset's dataspace */
+    H5S_hyper_seq_cache_t *mem_seq_cache;  /* For selections in the application's buffers */
+
     H5D_append_flush_t append_flush;   /* Append flush property information */
     char *             extfile_prefix; /* expanded external file prefix */
     char *             vds_prefix;     /* expanded vds prefix */
@@ -584,6 +631,10 @@ H5_DLL herr_t H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_spac
                         void *buf /*out*/);
 H5_DLL herr_t H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
                          const void *buf);
+H5_DLL herr_t H5D__read_multi(size_t count, H5D_t *dset[], hid_t mem_type_id[], const H5S_t *mem_space[],
+                              const H5S_t *file_space[], void *buf[] /*out*/);
+H5_DLL herr_t H5D__write_multi(size_t count, H5D_t *dset[], hid_t mem_type_id[], const H5S_t *mem_space[],
+                               const H5S_t *file_space[], const void *buf[]);
 
 /* Functions that perform direct serial I/O operations */
 H5_DLL herr_t H5D__select_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
@@ -652,6 +703,9 @@ H5_DLL herr_t H5D__get_offset_copy(const H5D_t *dset, const hsize_t *offset, hsi
 H5_DLL herr_t H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset,
                                       uint32_t data_size, const void *buf);
 H5_DLL herr_t H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_t *filters, void *buf);
+H5_DLL herr_t H5D__chunk_pin(const H5D_t *dset, const H5T_t *mem_type, const hsize_t *offset,
+                             const void **buf, size_t *buf_size);
+H5_DLL herr_t H5D__chunk_unpin(const H5D_t *dset, const hsize_t *offset);
 #ifdef H5D_CHUNK_DEBUG
 H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 #endif /* H5D_CHUNK_DEBUG */
@@ -737,6 +791,8 @@ H5_DLL herr_t H5D__layout_compact_dirty_test(hid_t did, hbool_t *dirty);
 H5_DLL herr_t H5D__layout_idx_type_test(hid_t did, H5D_chunk_index_t *idx_type);
 H5_DLL herr_t H5D__layout_type_test(hid_t did, H5D_layout_t *layout_type);
 H5_DLL herr_t H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused);
+H5_DLL herr_t H5D__chunk_prefetch_stats_test(hid_t did, unsigned *nprefetches, unsigned *nprefetch_hits,
+                                             unsigned *nprefetch_misses);
 #endif /* H5D_TESTING */
 
 #endif /*_H5Dpkg_H*/
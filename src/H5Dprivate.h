@@ -55,6 +55,7 @@
 #define H5D_ACS_VDS_PREFIX_NAME           "vds_prefix"           /* VDS file prefix */
 #define H5D_ACS_APPEND_FLUSH_NAME         "append_flush"         /* Append flush actions */
 #define H5D_ACS_EFILE_PREFIX_NAME         "external file prefix" /* External file prefix */
+#define H5D_ACS_CHUNK_PREFETCH_NAME       "chunk_prefetch"       /* # of chunks to read ahead */
 
 /* ======== Data transfer properties ======== */
 #define H5D_XFER_MAX_TEMP_BUF_NAME          "max_temp_buf"        /* Maximum temp buffer size */
@@ -80,10 +81,12 @@
     "local_no_collective_cause" /* cause of broken collective I/O in each process */
 #define H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME                                                             \
     "global_no_collective_cause"                 /* cause of broken collective I/O in all processes */
-#define H5D_XFER_EDC_NAME       "err_detect"     /* EDC */
-#define H5D_XFER_FILTER_CB_NAME "filter_cb"      /* Filter callback function */
-#define H5D_XFER_CONV_CB_NAME   "type_conv_cb"   /* Type conversion callback function */
-#define H5D_XFER_XFORM_NAME     "data_transform" /* Data transform */
+#define H5D_XFER_EDC_NAME               "err_detect"        /* EDC */
+#define H5D_XFER_FILTER_CB_NAME         "filter_cb"         /* Filter callback function */
+#define H5D_XFER_CONV_CB_NAME           "type_conv_cb"      /* Type conversion callback function */
+#define H5D_XFER_XFORM_NAME             "data_transform"    /* Data transform */
+#define H5D_XFER_FILTER_NTHREADS_NAME   "filter_nthreads"   /* Filter pipeline thread count */
+#define H5D_XFER_FILTER_BLOCK_SIZE_NAME "filter_block_size" /* Size of blocks to split chunks into */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
 /* Collective chunk instrumentation properties */
 #define H5D_XFER_COLL_CHUNK_LINK_HARD_NAME        "coll_chunk_link_hard"
@@ -170,6 +173,8 @@ H5_DLL hid_t       H5D_get_access_plist(const H5D_t *dset);
 
 /* Functions that operate on chunked storage */
 H5_DLL herr_t H5D_chunk_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr);
+H5_DLL herr_t H5D_chunk_get_shared_cache_stats(const H5F_t *f, size_t *cur_size, hsize_t *nhits,
+                                               hsize_t *nmisses);
 
 /* Functions that operate on virtual storage */
 H5_DLL herr_t H5D_virtual_check_mapping_pre(const H5S_t *vspace, const H5S_t *src_space,
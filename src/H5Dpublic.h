@@ -149,10 +149,17 @@ H5_DLL herr_t  H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id, hid
                        hid_t plist_id, void *buf /*out*/);
 H5_DLL herr_t  H5Dwrite(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
                         hid_t plist_id, const void *buf);
+H5_DLL herr_t  H5Dread_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+                             hid_t file_space_id[], hid_t dxpl_id, void *buf[] /*out*/);
+H5_DLL herr_t  H5Dwrite_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+                              hid_t file_space_id[], hid_t dxpl_id, const void *buf[]);
 H5_DLL herr_t  H5Dwrite_chunk(hid_t dset_id, hid_t dxpl_id, uint32_t filters, const hsize_t *offset,
                               size_t data_size, const void *buf);
 H5_DLL herr_t  H5Dread_chunk(hid_t dset_id, hid_t dxpl_id, const hsize_t *offset, uint32_t *filters,
                              void *buf);
+H5_DLL herr_t  H5Dpin_chunk(hid_t dset_id, hid_t dxpl_id, hid_t mem_type_id, const hsize_t *offset,
+                            const void **buf /*out*/, size_t *buf_size /*out*/);
+H5_DLL herr_t  H5Dunpin_chunk(hid_t dset_id, const hsize_t *offset);
 H5_DLL herr_t  H5Diterate(void *buf, hid_t type_id, hid_t space_id, H5D_operator_t op, void *operator_data);
 H5_DLL herr_t  H5Dvlen_get_buf_size(hid_t dataset_id, hid_t type_id, hid_t space_id, hsize_t *size);
 H5_DLL herr_t  H5Dfill(const void *fill, hid_t fill_type, void *buf, hid_t buf_type, hid_t space);
@@ -43,6 +43,8 @@ static herr_t H5D__scatter_file(const H5D_io_info_t *io_info, H5S_sel_iter_t *fi
                                 const void *buf);
 static size_t H5D__gather_file(const H5D_io_info_t *io_info, H5S_sel_iter_t *file_iter, size_t nelmts,
                                void *buf);
+static herr_t H5D__scatter_mem_swap(const void *tscat_buf, H5S_sel_iter_t *iter, size_t nelmts,
+                                    size_t elmt_size, void *buf);
 static herr_t H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_t *type_info,
                                      void *user_buf /*out*/);
 static herr_t H5D__compound_opt_write(size_t nelmts, const H5D_type_info_t *type_info);
@@ -338,6 +340,91 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__scatter_mem() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatter_mem_swap
+ *
+ * Purpose:	Scatters NELMTS data points from the scatter buffer
+ *		TSCAT_BUF to the application buffer BUF, as
+ *		H5D__scatter_mem() does, reversing the order of the bytes
+ *		in each ELMT_SIZE-byte element as it copies them.  This
+ *		converts the elements when byte order is all that differs
+ *		between the file and memory types, without another pass
+ *		over the scatter buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__scatter_mem_swap(const void *_tscat_buf, H5S_sel_iter_t *iter, size_t nelmts, size_t elmt_size,
+                      void *_buf /*out*/)
+{
+    uint8_t *      buf       = (uint8_t *)_buf; /* Get local copies for address arithmetic */
+    const uint8_t *tscat_buf = (const uint8_t *)_tscat_buf;
+    hsize_t *      off       = NULL;    /* Pointer to sequence offsets */
+    size_t *       len       = NULL;    /* Pointer to sequence lengths */
+    size_t         curr_len;            /* Length of bytes left to process in sequence */
+    size_t         nseq;                /* Number of sequences generated */
+    size_t         curr_seq;            /* Current sequence being processed */
+    size_t         nelem;               /* Number of elements used in sequences */
+    size_t         dxpl_vec_size;       /* Vector length from API context's DXPL */
+    size_t         vec_size;            /* Vector length */
+    herr_t         ret_value = SUCCEED; /* Number of elements scattered */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(tscat_buf);
+    HDassert(iter);
+    HDassert(nelmts > 0);
+    HDassert(elmt_size > 0);
+    HDassert(buf);
+
+    /* Get info from API context */
+    if (H5CX_get_vec_size(&dxpl_vec_size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve I/O vector size")
+
+    /* Allocate the vector I/O arrays */
+    if (dxpl_vec_size > H5D_IO_VECTOR_SIZE)
+        vec_size = dxpl_vec_size;
+    else
+        vec_size = H5D_IO_VECTOR_SIZE;
+    if (NULL == (len = H5FL_SEQ_MALLOC(size_t, vec_size)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O length vector array")
+    if (NULL == (off = H5FL_SEQ_MALLOC(hsize_t, vec_size)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O offset vector array")
+
+    /* Loop until all elements are written */
+    while (nelmts > 0) {
+        /* Get list of sequences for selection to write */
+        if (H5S_SELECT_ITER_GET_SEQ_LIST(iter, vec_size, nelmts, &nseq, &nelem, off, len) < 0)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+
+        /* Loop, while sequences left to process */
+        for (curr_seq = 0; curr_seq < nseq; curr_seq++) {
+            /* Get the number of bytes in sequence */
+            curr_len = len[curr_seq];
+
+            H5T_swap_copy(buf + off[curr_seq], tscat_buf, curr_len / elmt_size, elmt_size);
+
+            /* Advance offset in destination buffer */
+            tscat_buf += curr_len;
+        } /* end for */
+
+        /* Decrement number of elements left to process */
+        nelmts -= nelem;
+    } /* end while */
+
+done:
+    /* Release resources, if allocated */
+    if (len)
+        len = H5FL_SEQ_FREE(size_t, len);
+    if (off)
+        off = H5FL_SEQ_FREE(hsize_t, off);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__scatter_mem_swap() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__gather_mem
  *
@@ -448,6 +535,7 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     hbool_t         file_iter_init = FALSE; /* File selection iteration info has been initialized */
     hsize_t         smine_start;            /* Strip mine start loc	*/
     size_t          smine_nelmts;           /* Elements per strip	*/
+    hbool_t         in_place  = FALSE;      /* Whether to convert in the application's buffer */
     herr_t          ret_value = SUCCEED;    /* Return value		*/
 
     FUNC_ENTER_PACKAGE
@@ -483,12 +571,74 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize background selection information")
     bkg_iter_init = TRUE; /*file selection iteration info has been initialized */
 
+    /* Replay the sequence lists cached for the dataset's selections */
+    if (H5S_hyper_iter_cache_seq(file_iter, file_space, &io_info->dset->shared->file_seq_cache) < 0 ||
+        H5S_hyper_iter_cache_seq(mem_iter, mem_space, &io_info->dset->shared->mem_seq_cache) < 0 ||
+        H5S_hyper_iter_cache_seq(bkg_iter, mem_space, &io_info->dset->shared->mem_seq_cache) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't use cached sequence list")
+
+    /* If the elements can be converted where they belong in the application's
+     * buffer, and the memory selection is contiguous, don't use the type
+     * conversion buffer.
+     */
+    if (type_info->is_conv_in_place) {
+        htri_t is_contig; /* Whether the memory selection is contiguous */
+
+        if ((is_contig = H5S_SELECT_IS_CONTIGUOUS(mem_space)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check if memory selection is contiguous")
+        in_place = (hbool_t)is_contig;
+    } /* end if */
+
     /* Start strip mining... */
     for (smine_start = 0; smine_start < nelmts; smine_start += smine_nelmts) {
         size_t n; /* Elements operated on */
 
         /* Go figure out how many elements to read from the file */
         HDassert(H5S_SELECT_ITER_NELMTS(file_iter) == (nelmts - smine_start));
+
+        if (in_place) {
+            uint8_t *mem_buf; /* Elements' location in the application's buffer */
+            hsize_t  mem_off; /* Offset of the elements in the application's buffer */
+            size_t   mem_len; /* Length of the elements in the application's buffer */
+            size_t   nseq;    /* Number of sequences generated */
+
+            /* Find where the next run of elements goes in the application's
+             * buffer.  There's a single run, unless the selection iterator
+             * splits it up, or a data transform (which needs temporary
+             * buffers for the elements) limits it to a strip. */
+            smine_nelmts = (size_t)MIN(nelmts - smine_start, SIZET_MAX);
+            if (!type_info->is_xform_noop)
+                smine_nelmts = MIN(smine_nelmts, type_info->request_nelmts);
+            if (H5S_SELECT_ITER_GET_SEQ_LIST(mem_iter, (size_t)1, smine_nelmts, &nseq, &smine_nelmts,
+                                             &mem_off, &mem_len) < 0)
+                HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+            HDassert(nseq == 1 && smine_nelmts > 0);
+            mem_buf = (uint8_t *)buf + mem_off;
+
+            /* Gather the elements from the file into the application's buffer,
+             * and convert and transform them there */
+            n = H5D__gather_file(io_info, file_iter, smine_nelmts, mem_buf /*out*/);
+            if (n != smine_nelmts)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file gather failed")
+
+            if (H5T_convert(type_info->tpath, type_info->src_type_id, type_info->dst_type_id, smine_nelmts,
+                            (size_t)0, (size_t)0, mem_buf, NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+            if (!type_info->is_xform_noop) {
+                H5Z_data_xform_t *data_transform; /* Data transform info */
+
+                /* Retrieve info from API context */
+                if (H5CX_get_data_transform(&data_transform) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get data transform info")
+
+                if (H5Z_xform_eval(data_transform, mem_buf, smine_nelmts, type_info->mem_type) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "Error performing data transform")
+            } /* end if */
+
+            continue;
+        } /* end if */
+
         smine_nelmts = (size_t)MIN(type_info->request_nelmts, (nelmts - smine_start));
 
         /*
@@ -512,6 +662,15 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
             if (H5D__compound_opt_read(smine_nelmts, mem_iter, type_info, buf /*out*/) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "datatype conversion failed")
         } /* end if */
+        /* If byte order is the only difference between the types and there's no
+         * data transform, reverse the bytes of the elements as they're scattered
+         * into the user's buffer, rather than converting them in place first.
+         */
+        else if (type_info->is_conv_swap && type_info->is_xform_noop) {
+            if (H5D__scatter_mem_swap(type_info->tconv_buf, mem_iter, smine_nelmts, type_info->src_type_size,
+                                      buf /*out*/) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "scatter failed")
+        } /* end else-if */
         else {
             if (H5T_BKG_YES == type_info->need_bkg) {
                 n = H5D__gather_mem(buf, bkg_iter, smine_nelmts, type_info->bkg_buf /*out*/);
@@ -624,6 +783,12 @@ H5D__scatgath_write(const H5D_io_info_t *io_info, const H5D_type_info_t *type_in
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize background selection information")
     bkg_iter_init = TRUE; /*file selection iteration info has been initialized */
 
+    /* Replay the sequence lists cached for the dataset's selections */
+    if (H5S_hyper_iter_cache_seq(file_iter, file_space, &io_info->dset->shared->file_seq_cache) < 0 ||
+        H5S_hyper_iter_cache_seq(mem_iter, mem_space, &io_info->dset->shared->mem_seq_cache) < 0 ||
+        H5S_hyper_iter_cache_seq(bkg_iter, file_space, &io_info->dset->shared->file_seq_cache) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't use cached sequence list")
+
     /* Start strip mining... */
     for (smine_start = 0; smine_start < nelmts; smine_start += smine_nelmts) {
         size_t n; /* Elements operated on */
@@ -175,11 +175,15 @@ H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size, size_t nelmts, co
         if (H5S_select_iter_init(file_iter, file_space, elmt_size, H5S_SEL_ITER_GET_SEQ_LIST_SORTED) < 0)
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
         file_iter_init = 1; /* File selection iteration info has been initialized */
+        if (H5S_hyper_iter_cache_seq(file_iter, file_space, &io_info->dset->shared->file_seq_cache) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't use cached sequence list")
 
         /* Initialize memory iterator */
         if (H5S_select_iter_init(mem_iter, mem_space, elmt_size, 0) < 0)
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
         mem_iter_init = 1; /* Memory selection iteration info has been initialized */
+        if (H5S_hyper_iter_cache_seq(mem_iter, mem_space, &io_info->dset->shared->mem_seq_cache) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't use cached sequence list")
 
         /* Initialize sequence counts */
         curr_mem_seq = curr_file_seq = 0;
@@ -295,3 +295,50 @@ H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__current_cache_size_test() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__chunk_prefetch_stats_test
+ PURPOSE
+    Retrieve the read-ahead statistics of a dataset's chunk cache
+ USAGE
+    herr_t H5D__chunk_prefetch_stats_test(did, nprefetches, nprefetch_hits, nprefetch_misses)
+        hid_t did;                  IN: Dataset to query
+        unsigned *nprefetches;      OUT: # of chunks read ahead
+        unsigned *nprefetch_hits;   OUT: # of chunks read ahead & then accessed
+        unsigned *nprefetch_misses; OUT: # of chunks read ahead & preempted unused
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Returns the read-ahead counters of a chunked dataset's chunk cache.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__chunk_prefetch_stats_test(hid_t did, unsigned *nprefetches, unsigned *nprefetch_hits,
+                               unsigned *nprefetch_misses)
+{
+    H5D_t *dset;                /* Pointer to dataset to query */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if (NULL == (dset = (H5D_t *)H5VL_object_verify(did, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if (dset->shared->layout.type != H5D_CHUNKED)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+    if (nprefetches)
+        *nprefetches = dset->shared->cache.chunk.stats.nprefetches;
+    if (nprefetch_hits)
+        *nprefetch_hits = dset->shared->cache.chunk.stats.nprefetch_hits;
+    if (nprefetch_misses)
+        *nprefetch_misses = dset->shared->cache.chunk.stats.nprefetch_misses;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_prefetch_stats_test() */
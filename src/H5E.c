@@ -193,7 +193,8 @@ H5E__init_package(void)
         HGOTO_ERROR(H5E_ATOM, H5E_CANTINIT, FAIL, "unable to initialize ID group")
 
 #ifndef H5_HAVE_THREADSAFE
-    H5E_stack_g[0].nused = 0;
+    H5E_stack_g[0].nused  = 0;
+    H5E_stack_g[0].paused = FALSE;
     H5E__set_default_auto(H5E_stack_g);
 #endif /* H5_HAVE_THREADSAFE */
 
@@ -361,7 +362,8 @@ H5E__get_stack(void)
         HDassert(estack);
 
         /* Set the thread-specific info */
-        estack->nused = 0;
+        estack->nused  = 0;
+        estack->paused = FALSE;
         H5E__set_default_auto(estack);
 
         /* (It's not necessary to release this in this API, it is
@@ -723,6 +723,9 @@ herr_t
 H5E__push_stack(H5E_t *estack, const char *file, const char *func, unsigned line, hid_t cls_id, hid_t maj_id,
                 hid_t min_id, const char *desc)
 {
+#ifdef H5_HAVE_THREADSAFE
+    hbool_t relocked = FALSE; /* Whether the API lock was taken back */
+#endif /* H5_HAVE_THREADSAFE */
     herr_t ret_value = SUCCEED; /* Return value */
 
     /*
@@ -757,20 +760,25 @@ H5E__push_stack(H5E_t *estack, const char *file, const char *func, unsigned line
         desc = "No description given";
 
     /*
-     * Push the error if there's room.  Otherwise just forget it.
+     * Push the error if there's room and the stack isn't paused.  Otherwise
+     * just forget it.
      */
     HDassert(estack);
 
-    if (estack->nused < H5E_NSLOTS) {
-        /* Increment the IDs to indicate that they are used in this stack */
-        if (H5I_inc_ref(cls_id, FALSE) < 0)
-            HGOTO_DONE(FAIL)
-        estack->slot[estack->nused].cls_id = cls_id;
-        if (H5I_inc_ref(maj_id, FALSE) < 0)
+    if (estack->nused < H5E_NSLOTS && !estack->paused) {
+        /* Increment the IDs to indicate that they are used in this stack.
+         * (Errors can be pushed while a thread has given up the API lock
+         * around raw data I/O, so take it back for the ID operations)
+         */
+        H5_API_RELOCK(relocked)
+        if (H5I_inc_ref(cls_id, FALSE) < 0 || H5I_inc_ref(maj_id, FALSE) < 0 ||
+            H5I_inc_ref(min_id, FALSE) < 0)
+            ret_value = FAIL;
+        H5_API_RELOCK_END(relocked)
+        if (ret_value < 0)
             HGOTO_DONE(FAIL)
+        estack->slot[estack->nused].cls_id  = cls_id;
         estack->slot[estack->nused].maj_num = maj_id;
-        if (H5I_inc_ref(min_id, FALSE) < 0)
-            HGOTO_DONE(FAIL)
         estack->slot[estack->nused].min_num = min_id;
         if (NULL == (estack->slot[estack->nused].func_name = H5MM_xstrdup(func)))
             HGOTO_DONE(FAIL)
@@ -803,8 +811,12 @@ static herr_t
 H5E__clear_entries(H5E_t *estack, size_t nentries)
 {
     H5E_error2_t *error;               /* Pointer to error stack entry to clear */
+    const char *  dec_failed = NULL;   /* Why decrementing an ID failed */
     unsigned      u;                   /* Local index variable */
     herr_t        ret_value = SUCCEED; /* Return value */
+#ifdef H5_HAVE_THREADSAFE
+    hbool_t relocked = FALSE; /* Whether the API lock was taken back */
+#endif /* H5_HAVE_THREADSAFE */
 
     FUNC_ENTER_STATIC
 
@@ -818,12 +830,17 @@ H5E__clear_entries(H5E_t *estack, size_t nentries)
 
         /* Decrement the IDs to indicate that they are no longer used by this stack */
         /* (In reverse order that they were incremented, so that reference counts work well) */
+        /* (And under the API lock, which a thread may have given up around raw data I/O) */
+        H5_API_RELOCK(relocked)
         if (H5I_dec_ref(error->min_num) < 0)
-            HGOTO_ERROR(H5E_ERROR, H5E_CANTDEC, FAIL, "unable to decrement ref count on error message")
-        if (H5I_dec_ref(error->maj_num) < 0)
-            HGOTO_ERROR(H5E_ERROR, H5E_CANTDEC, FAIL, "unable to decrement ref count on error message")
-        if (H5I_dec_ref(error->cls_id) < 0)
-            HGOTO_ERROR(H5E_ERROR, H5E_CANTDEC, FAIL, "unable to decrement ref count on error class")
+            dec_failed = "unable to decrement ref count on error message";
+        else if (H5I_dec_ref(error->maj_num) < 0)
+            dec_failed = "unable to decrement ref count on error message";
+        else if (H5I_dec_ref(error->cls_id) < 0)
+            dec_failed = "unable to decrement ref count on error class";
+        H5_API_RELOCK_END(relocked)
+        if (dec_failed)
+            HGOTO_ERROR(H5E_ERROR, H5E_CANTDEC, FAIL, "%s", dec_failed)
 
         /* Release strings */
         if (error->func_name)
@@ -877,6 +894,37 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5E_clear_stack() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5E_pause_stack
+ *
+ * Purpose:     Private function to stop (PAUSE is TRUE) or restart
+ *              recording errors on the calling thread's default error
+ *              stack.  Code that runs without the API lock uses this,
+ *              since pushing an error changes the reference counts of the
+ *              error class and message IDs.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5E_pause_stack(hbool_t pause)
+{
+    H5E_t *estack;              /* Default error stack */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if (NULL == (estack = H5E__get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in
+                                                   non-threaded case */
+        HGOTO_DONE(FAIL)
+
+    estack->paused = pause;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E_pause_stack() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5E__pop
  *
@@ -110,6 +110,7 @@ struct H5E_t {
     H5E_error2_t  slot[H5E_NSLOTS]; /* Array of error records	     */
     H5E_auto_op_t auto_op;          /* Operator for 'automatic' error reporting */
     void *        auto_data;        /* Callback data for 'automatic error reporting */
+    hbool_t       paused;           /* Whether errors pushed on the stack are dropped */
 };
 
 /*****************************/
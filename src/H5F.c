@@ -1179,6 +1179,43 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_mdc_size() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_shared_chunk_cache_stats
+ *
+ * Purpose:     Retrieves the current size of the raw data chunk cache
+ *              shared by all the chunked datasets in the file (see
+ *              H5Pset_shared_chunk_cache), and the number of hits and
+ *              misses in it since the file was opened.  The statistics
+ *              are zero if the file isn't using a shared chunk cache.
+ *              If any of the pointers are NULL, the associated datum is
+ *              not returned.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_shared_chunk_cache_stats(hid_t file_id, size_t *cur_size, hsize_t *nhits, hsize_t *nmisses)
+{
+    H5VL_object_t *vol_obj;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "i*z*h*h", file_id, cur_size, nhits, nmisses);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+
+    /* Get the statistics */
+    if (H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_GET_SHARED_CHUNK_CACHE_STATS, H5P_DATASET_XFER_DEFAULT,
+                           H5_REQUEST_NULL, cur_size, nhits, nmisses) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to get shared chunk cache statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_shared_chunk_cache_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Freset_mdc_hit_rate_stats
  *
@@ -144,6 +144,11 @@ static herr_t  H5FD__core_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, ha
                                void *buf);
 static herr_t  H5FD__core_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                 const void *buf);
+static herr_t  H5FD__core_grow(H5FD_core_t *file, haddr_t end);
+static herr_t  H5FD__core_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+                                      const haddr_t addrs[], const size_t sizes[], void *bufs[]);
+static herr_t  H5FD__core_write_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+                                       const haddr_t addrs[], const size_t sizes[], const void *bufs[]);
 static herr_t  H5FD__core_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__core_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__core_lock(H5FD_t *_file, hbool_t rw);
@@ -181,7 +186,9 @@ static const H5FD_class_t H5FD_core_g = {
     H5FD__core_truncate,      /* truncate             */
     H5FD__core_lock,          /* lock                 */
     H5FD__core_unlock,        /* unlock               */
-    H5FD_FLMAP_DICHOTOMY      /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,     /* fl_map               */
+    H5FD__core_read_vector,   /* read_vector          */
+    H5FD__core_write_vector   /* write_vector         */
 };
 
 /* Define a free list to manage the region type */
@@ -1383,40 +1390,10 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
 
-    /*
-     * Allocate more memory if necessary, careful of overflow. Also, if the
-     * allocation fails then the file should remain in a usable state.  Be
-     * careful of non-Posix realloc() that doesn't understand what to do when
-     * the first argument is null.
-     */
-    if (addr + size > file->eof) {
-        unsigned char *x;
-        size_t         new_eof;
-
-        /* Determine new size of memory buffer */
-        H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * ((addr + size) / file->increment), hsize_t);
-        if ((addr + size) % file->increment)
-            new_eof += file->increment;
-
-        /* (Re)allocate memory for the file buffer, using callbacks if available */
-        if (file->fi_callbacks.image_realloc) {
-            if (NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(
-                             file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                            "unable to allocate memory block of %llu bytes with callback",
-                            (unsigned long long)new_eof)
-        } /* end if */
-        else {
-            if (NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                            "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof)
-        } /* end else */
-
-        HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-        file->mem = x;
-
-        file->eof = new_eof;
-    } /* end if */
+    /* Allocate more memory if necessary */
+    if (addr + size > file->eof)
+        if (H5FD__core_grow(file, addr + size) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to extend memory buffer")
 
     /* Add the buffer region to the dirty list if using that optimization */
     if (file->dirty_list) {
@@ -1440,6 +1417,162 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_grow
+ *
+ * Purpose:     Extends the memory buffer of FILE to hold at least END
+ *              bytes, rounded up to a multiple of the allocation
+ *              increment.
+ *
+ *              Allocate more memory if necessary, careful of overflow.
+ *              Also, if the allocation fails then the file should remain
+ *              in a usable state.  Be careful of non-Posix realloc() that
+ *              doesn't understand what to do when the first argument is
+ *              null.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_grow(H5FD_core_t *file, haddr_t end)
+{
+    unsigned char *x;
+    size_t         new_eof;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(end > file->eof);
+
+    /* Determine new size of memory buffer */
+    H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * (end / file->increment), hsize_t);
+    if (end % file->increment)
+        new_eof += file->increment;
+
+    /* (Re)allocate memory for the file buffer, using callbacks if available */
+    if (file->fi_callbacks.image_realloc) {
+        if (NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(
+                         file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                        "unable to allocate memory block of %llu bytes with callback",
+                        (unsigned long long)new_eof)
+    } /* end if */
+    else {
+        if (NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes",
+                        (unsigned long long)new_eof)
+    } /* end else */
+
+    HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
+    file->mem = x;
+
+    file->eof = new_eof;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_grow() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_read_vector
+ *
+ * Purpose:     Reads COUNT blocks of data from FILE, block I being
+ *              SIZES[I] bytes at address ADDRS[I] copied into BUFS[I].
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffers BUFS.
+ *              Failure:    FAIL, Contents of buffers BUFS are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count, const haddr_t addrs[],
+                       const size_t sizes[], void *bufs[] /*out*/)
+{
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    for (u = 0; u < count; u++)
+        if (H5FD__core_read(_file, type, dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_write_vector
+ *
+ * Purpose:     Writes COUNT blocks of data to FILE, block I being
+ *              SIZES[I] bytes from BUFS[I] copied to address ADDRS[I].
+ *
+ *              The memory buffer is extended (at most) once, to hold the
+ *              block that ends furthest into the file, before any data is
+ *              copied.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_write_vector(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                        size_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    H5FD_core_t *file      = (H5FD_core_t *)_file;
+    haddr_t      max_end   = 0;       /* End of the block furthest into the file */
+    size_t       u;                   /* Local index variable */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for (u = 0; u < count; u++) {
+        if (REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
+        max_end = MAX(max_end, addrs[u] + sizes[u]);
+    } /* end for */
+
+    /* Allocate more memory if necessary */
+    if (max_end > file->eof)
+        if (H5FD__core_grow(file, max_end) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to extend memory buffer")
+
+    for (u = 0; u < count; u++) {
+        if (0 == sizes[u])
+            continue;
+
+        /* Add the buffer region to the dirty list if using that optimization */
+        if (file->dirty_list) {
+            haddr_t start = addrs[u];
+            haddr_t end   = addrs[u] + (haddr_t)sizes[u] - 1;
+
+            if (H5FD__core_add_dirty_region(file, start, end) != SUCCEED)
+                HGOTO_ERROR(
+                    H5E_VFL, H5E_CANTINSERT, FAIL,
+                    "unable to add core VFD dirty region during write call - addresses: start=%llu end=%llu",
+                    (unsigned long long)start, (unsigned long long)end)
+        } /* end if */
+
+        /* Write from the buffer to memory */
+        H5MM_memcpy(file->mem + addrs[u], bufs[u], sizes[u]);
+    } /* end for */
+
+    /* Mark memory buffer as modified */
+    if (count > 0)
+        file->dirty = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_write_vector() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_flush
  *
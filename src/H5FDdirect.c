@@ -170,7 +170,9 @@ static const H5FD_class_t H5FD_direct_g = {
     H5FD__direct_truncate,      /* truncate             */
     H5FD__direct_lock,          /* lock                 */
     H5FD__direct_unlock,        /* unlock               */
-    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,       /* fl_map               */
+    NULL,                       /* read_vector          */
+    NULL                        /* write_vector         */
 };
 
 /* Declare a free list to manage the H5FD_direct_t struct */
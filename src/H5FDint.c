@@ -35,6 +35,7 @@
 #include "H5Fprivate.h"  /* File access                              */
 #include "H5FDpkg.h"     /* File Drivers                             */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 
 /****************/
 /* Local Macros */
@@ -243,6 +244,147 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_read_vector
+ *
+ * Purpose:     Private version of H5FDread_vector().  Drivers without a
+ *              'read_vector' callback have each block read with their
+ *              'read' callback.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_read_vector(H5FD_t *file, H5FD_mem_t type, size_t count, const haddr_t addrs[], const size_t sizes[],
+                 void *bufs[] /*out*/)
+{
+    haddr_t *abs_addrs = NULL;            /* Addresses with the base address added */
+    hid_t    dxpl_id   = H5I_INVALID_HID; /* DXPL for operation */
+    size_t   u;                           /* Local index variable */
+    herr_t   ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+    /* Check the blocks against the 'eoa', except for SWMR readers (see H5FD_read()) */
+    if (!(file->access_flags & H5F_ACC_SWMR_READ)) {
+        haddr_t eoa;
+
+        if (HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, type)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+
+        for (u = 0; u < count; u++)
+            if ((addrs[u] + file->base_addr + sizes[u]) > eoa)
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL,
+                            "addr overflow, addr = %llu, size = %llu, eoa = %llu",
+                            (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u],
+                            (unsigned long long)eoa)
+    } /* end if */
+
+    /* Add the base address */
+    if (file->base_addr > 0) {
+        if (NULL == (abs_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address array")
+        for (u = 0; u < count; u++)
+            abs_addrs[u] = addrs[u] + file->base_addr;
+        addrs = abs_addrs;
+    } /* end if */
+
+    /* Dispatch to driver */
+    if (file->cls->read_vector) {
+        if ((file->cls->read_vector)(file, type, dxpl_id, count, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver vector read request failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if ((file->cls->read)(file, type, dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed")
+
+done:
+    H5MM_xfree(abs_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_write_vector
+ *
+ * Purpose:     Private version of H5FDwrite_vector().  Drivers without a
+ *              'write_vector' callback have each block written with their
+ *              'write' callback.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_write_vector(H5FD_t *file, H5FD_mem_t type, size_t count, const haddr_t addrs[], const size_t sizes[],
+                  const void *bufs[])
+{
+    haddr_t *abs_addrs = NULL;            /* Addresses with the base address added */
+    hid_t    dxpl_id   = H5I_INVALID_HID; /* DXPL for operation */
+    haddr_t  eoa       = HADDR_UNDEF;     /* EOA for file */
+    size_t   u;                           /* Local index variable */
+    herr_t   ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+    /* Check the blocks against the 'eoa' */
+    if (HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, type)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+    for (u = 0; u < count; u++)
+        if ((addrs[u] + file->base_addr + sizes[u]) > eoa)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%llu, eoa=%llu",
+                        (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u],
+                        (unsigned long long)eoa)
+
+    /* Add the base address */
+    if (file->base_addr > 0) {
+        if (NULL == (abs_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate address array")
+        for (u = 0; u < count; u++)
+            abs_addrs[u] = addrs[u] + file->base_addr;
+        addrs = abs_addrs;
+    } /* end if */
+
+    /* Dispatch to driver */
+    if (file->cls->write_vector) {
+        if ((file->cls->write_vector)(file, type, dxpl_id, count, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver vector write request failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if ((file->cls->write)(file, type, dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed")
+
+done:
+    H5MM_xfree(abs_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_write_vector() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD_set_eoa
  *
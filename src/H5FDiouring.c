@@ -0,0 +1,1111 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The Linux io_uring file driver.  Files are ordinary POSIX files
+ *          (and can be opened with the sec2 driver), but reads and writes
+ *          are queued on a per-file io_uring submission ring instead of
+ *          being issued as one system call apiece.  A vector request from
+ *          the library (e.g. all the pieces of a hyperslab selection, or
+ *          the chunks touched by H5Dread_multi) is submitted as a single
+ *          batch of up to 'queue_depth' operations which the kernel
+ *          services concurrently; each call still waits for its whole
+ *          batch to complete before returning to the library.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"   /* Generic Functions        */
+#include "H5Eprivate.h"  /* Error handling           */
+#include "H5Fprivate.h"  /* File access              */
+#include "H5FDprivate.h" /* File drivers             */
+#include "H5FDiouring.h" /* io_uring file driver     */
+#include "H5FLprivate.h" /* Free Lists               */
+#include "H5Iprivate.h"  /* IDs                      */
+#include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+
+#ifdef H5_HAVE_IOURING_VFD
+
+#include <liburing.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_IOURING_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* Driver-specific file access properties */
+typedef struct H5FD_iouring_fapl_t {
+    unsigned queue_depth; /* # of entries in the submission queue */
+} H5FD_iouring_fapl_t;
+
+/* The description of a file belonging to this driver.  The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file (the current size of the underlying filesystem file).  All
+ * I/O is positional, so unlike the sec2 driver no file position is tracked.
+ * If the ring ever fails in a way that leaves operations unaccounted for,
+ * 'ring_failed' is set and all further I/O on the file is refused.
+ */
+typedef struct H5FD_iouring_t {
+    H5FD_t          pub;         /* public stuff, must be first          */
+    int             fd;          /* the filesystem file descriptor       */
+    haddr_t         eoa;         /* end of allocated region              */
+    haddr_t         eof;         /* end of file; current file size       */
+    struct io_uring ring;        /* submission & completion queues       */
+    unsigned        queue_depth; /* max # of operations in flight        */
+    hbool_t         ring_failed; /* whether the ring is no longer usable */
+    hbool_t         ignore_disabled_file_locks;
+    char            filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+    dev_t           device;                          /* file device number   */
+    ino_t           inode;                           /* file i-node number   */
+
+    /* Information from properties set by 'h5repart' tool
+     *
+     * Whether to eliminate the family driver info and convert this file to
+     * a single file.
+     */
+    hbool_t fam_to_single;
+} H5FD_iouring_t;
+
+/* One block of a (possibly vector) request, advanced in place as partial
+ * transfers complete
+ */
+typedef struct H5FD_iouring_req_t {
+    haddr_t              addr; /* File address of the next byte to transfer   */
+    size_t               size; /* # of bytes still to transfer                */
+    unsigned char *      rbuf; /* Where the next byte read goes (reads only)  */
+    const unsigned char *wbuf; /* Where the next byte written is (writes only) */
+} H5FD_iouring_req_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Largest queue depth the kernel accepts (IORING_MAX_ENTRIES) */
+#define H5FD_IOURING_QUEUE_DEPTH_MAX 32768
+
+/* Largest # of bytes moved by a single submission queue entry (the length
+ * field of an entry is 32 bits); larger blocks are split across several
+ * entries
+ */
+#define H5FD_IOURING_MAX_IO_BYTES ((size_t)1 << 30)
+
+/* Prototypes */
+static herr_t  H5FD__iouring_term(void);
+static void *  H5FD__iouring_fapl_get(H5FD_t *_file);
+static H5FD_t *H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__iouring_close(H5FD_t *_file);
+static int     H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__iouring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__iouring_io(H5FD_iouring_t *file, hbool_t do_write, size_t count, const haddr_t addrs[],
+                                const size_t sizes[], void *rbufs[], const void *wbufs[]);
+static herr_t  H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                                  void *buf);
+static herr_t  H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                                   const void *buf);
+static herr_t  H5FD__iouring_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+                                         const haddr_t addrs[], const size_t sizes[], void *bufs[]);
+static herr_t  H5FD__iouring_write_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+                                          const haddr_t addrs[], const size_t sizes[], const void *bufs[]);
+static herr_t  H5FD__iouring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__iouring_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__iouring_unlock(H5FD_t *_file);
+
+static const H5FD_class_t H5FD_iouring_g = {
+    "iouring",                   /* name                 */
+    MAXADDR,                     /* maxaddr              */
+    H5F_CLOSE_WEAK,              /* fc_degree            */
+    H5FD__iouring_term,          /* terminate            */
+    NULL,                        /* sb_size              */
+    NULL,                        /* sb_encode            */
+    NULL,                        /* sb_decode            */
+    sizeof(H5FD_iouring_fapl_t), /* fapl_size            */
+    H5FD__iouring_fapl_get,      /* fapl_get             */
+    NULL,                        /* fapl_copy            */
+    NULL,                        /* fapl_free            */
+    0,                           /* dxpl_size            */
+    NULL,                        /* dxpl_copy            */
+    NULL,                        /* dxpl_free            */
+    H5FD__iouring_open,          /* open                 */
+    H5FD__iouring_close,         /* close                */
+    H5FD__iouring_cmp,           /* cmp                  */
+    H5FD__iouring_query,         /* query                */
+    NULL,                        /* get_type_map         */
+    NULL,                        /* alloc                */
+    NULL,                        /* free                 */
+    H5FD__iouring_get_eoa,       /* get_eoa              */
+    H5FD__iouring_set_eoa,       /* set_eoa              */
+    H5FD__iouring_get_eof,       /* get_eof              */
+    H5FD__iouring_get_handle,    /* get_handle           */
+    H5FD__iouring_read,          /* read                 */
+    H5FD__iouring_write,         /* write                */
+    NULL,                        /* flush                */
+    H5FD__iouring_truncate,      /* truncate             */
+    H5FD__iouring_lock,          /* lock                 */
+    H5FD__iouring_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY,        /* fl_map               */
+    H5FD__iouring_read_vector,   /* read_vector          */
+    H5FD__iouring_write_vector   /* write_vector         */
+};
+
+/* Declare a free list to manage the H5FD_iouring_t struct */
+H5FL_DEFINE_STATIC(H5FD_iouring_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    char * lock_env_var = NULL; /* Environment variable pointer */
+    herr_t ret_value    = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv("HDF5_USE_FILE_LOCKING");
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5FD_iouring_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize io_uring VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_iouring_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_IOURING_g))
+        H5FD_IOURING_g = H5FD_register(&H5FD_iouring_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_IOURING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__iouring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IOURING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_iouring
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_IOURING driver defined in this source file.
+ *              QUEUE_DEPTH is the number of entries in the submission
+ *              ring of each file opened with the list, i.e. the largest
+ *              number of reads or writes the driver keeps in flight at
+ *              once.  Zero selects H5FD_IOURING_QUEUE_DEPTH_DEF.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth)
+{
+    H5P_genplist_t *    plist; /* Property list pointer */
+    H5FD_iouring_fapl_t fa;    /* io_uring VFD info */
+    herr_t              ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", fapl_id, queue_depth);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (queue_depth > H5FD_IOURING_QUEUE_DEPTH_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "queue depth too large")
+
+    fa.queue_depth = queue_depth ? queue_depth : H5FD_IOURING_QUEUE_DEPTH_DEF;
+
+    ret_value = H5P_set_driver(plist, H5FD_IOURING, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_iouring
+ *
+ * Purpose:     Returns information about the io_uring file access
+ *              property list through the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth /*out*/)
+{
+    H5P_genplist_t *           plist;               /* Property list pointer */
+    const H5FD_iouring_fapl_t *fa;                  /* io_uring VFD info */
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, queue_depth);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (H5FD_IOURING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    if (queue_depth)
+        *queue_depth = fa->queue_depth;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_get
+ *
+ * Purpose:     Returns a copy of the file access properties.
+ *
+ * Return:      Success:    Ptr to new file access properties.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_get(H5FD_t *_file)
+{
+    H5FD_iouring_t *     file = (H5FD_iouring_t *)_file;
+    H5FD_iouring_fapl_t *fa;               /* io_uring VFD info */
+    void *               ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (fa = (H5FD_iouring_fapl_t *)H5MM_calloc(sizeof(H5FD_iouring_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    fa->queue_depth = file->queue_depth;
+
+    /* Set return value */
+    ret_value = fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file and sets up
+ *              its io_uring instance.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_iouring_t *           file = NULL;       /* io_uring VFD info        */
+    const H5FD_iouring_fapl_t *fa;                /* io_uring properties      */
+    int                        fd        = -1;    /* File descriptor          */
+    hbool_t                    ring_init = FALSE; /* Whether the ring is set up */
+    int                        o_flags;           /* Flags for open() call    */
+    int                        ret;               /* liburing return value    */
+    h5_stat_t                  sb;
+    H5P_genplist_t *           plist;            /* Property list pointer */
+    H5FD_t *                   ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if (H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if (H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if (H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+
+    /* Open the file */
+    if ((fd = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(
+            H5E_FILE, H5E_CANTOPENFILE, NULL,
+            "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x",
+            name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_iouring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->device = sb.st_dev;
+    file->inode  = sb.st_ino;
+
+    /* Get the FAPL */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_VFL, H5E_BADTYPE, NULL, "not a file access property list")
+
+    /* Get the queue depth, falling back to the default when the driver
+     * was selected without properties (e.g. through H5FD_IOURING alone)
+     */
+    if (NULL != (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        file->queue_depth = fa->queue_depth;
+    else
+        file->queue_depth = H5FD_IOURING_QUEUE_DEPTH_DEF;
+
+    /* Set up the submission and completion queues */
+    if ((ret = io_uring_queue_init(file->queue_depth, &file->ring, 0)) < 0) {
+        errno = -ret;
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to initialize io_uring instance")
+    } /* end if */
+    ring_init = TRUE;
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property")
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Check for non-default FAPL */
+    if (H5P_FILE_ACCESS_DEFAULT != fapl_id) {
+        /* This step is for h5repart tool only. If user wants to change file driver from
+         * family to one that uses single files (sec2, etc.) while using h5repart, this
+         * private property should be set so that in the later step, the library can ignore
+         * the family driver information saved in the superblock.
+         */
+        if (H5P_exist_plist(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME) > 0)
+            if (H5P_get(plist, H5F_ACS_FAMILY_TO_SINGLE_NAME, &file->fam_to_single) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get property of changing family to single")
+    } /* end if */
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value) {
+        if (ring_init)
+            io_uring_queue_exit(&file->ring);
+        if (fd >= 0)
+            HDclose(fd);
+        if (file)
+            file = H5FL_FREE(H5FD_iouring_t, file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_close
+ *
+ * Purpose:     Closes an HDF5 file and tears down its io_uring instance.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_close(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Release the rings.  Every request waits for its own completions, so
+     * nothing can still be in flight here.
+     */
+    io_uring_queue_exit(&file->ring);
+
+    /* Close the underlying file */
+    if (HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_iouring_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_iouring_t *f1        = (const H5FD_iouring_t *)_f1;
+    const H5FD_iouring_t *f2        = (const H5FD_iouring_t *)_f2;
+    int                   ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1)
+    if (f1->device > f2->device)
+        HGOTO_DONE(1)
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1)
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1)
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_query(const H5FD_t *_file, unsigned long *flags /* out */)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file; /* io_uring VFD info */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports.  Every call
+     * waits for its I/O to complete, so the driver is as coherent as sec2.
+     */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_DATA_SIEVE; /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor */
+        *flags |=
+            H5FD_FEAT_SUPPORTS_SWMR_IO; /* VFD supports the single-writer/multiple-readers (SWMR) pattern   */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
+                                                       VFD      */
+
+        /* Check for flags that are set by h5repart */
+        if (file && file->fam_to_single)
+            *flags |= H5FD_FEAT_IGNORE_DRVRINFO; /* Ignore the driver info when file is opened (which
+                                                    eliminates it) */
+    }                                            /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__iouring_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the greater of
+ *              either the filesystem end-of-file or the HDF5 end-of-address
+ *              markers.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__iouring_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD__iouring_get_handle
+ *
+ * Purpose:        Returns the file handle of io_uring file driver.
+ *
+ * Returns:        SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_io
+ *
+ * Purpose:     Transfers COUNT blocks between the file and memory through
+ *              the file's ring.  Block I is SIZES[I] bytes at ADDRS[I],
+ *              read into RBUFS[I] or written from WBUFS[I] depending on
+ *              DO_WRITE.
+ *
+ *              Up to 'queue_depth' transfers are kept in flight.  As each
+ *              completes, a short transfer has its remainder queued again,
+ *              interrupted ones are retried, and reads that hit the end of
+ *              the file fill the rest of their block with zeros.  The
+ *              routine does not return until everything it queued has
+ *              completed, so the caller's buffers are safe to reuse.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_io(H5FD_iouring_t *file, hbool_t do_write, size_t count, const haddr_t addrs[],
+                 const size_t sizes[], void *rbufs[], const void *wbufs[])
+{
+    H5FD_iouring_req_t * reqs     = NULL; /* Progress of each block                   */
+    H5FD_iouring_req_t **todo     = NULL; /* Blocks waiting for a submission entry    */
+    size_t               ntodo    = 0;    /* # of blocks in 'todo'                    */
+    size_t               inflight = 0;    /* # of entries submitted but not completed */
+    haddr_t              end      = 0;    /* End of the highest block written         */
+    int                  io_errno = 0;    /* First error reported by the kernel       */
+    size_t               u;               /* Local index variable                     */
+    herr_t               ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(do_write ? (NULL != wbufs) : (NULL != rbufs));
+
+    if (file->ring_failed)
+        HGOTO_ERROR(H5E_IO, H5E_BADVALUE, FAIL, "io_uring instance is no longer usable")
+
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    if (NULL == (reqs = (H5FD_iouring_req_t *)H5MM_malloc(count * sizeof(H5FD_iouring_req_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate request array")
+    if (NULL == (todo = (H5FD_iouring_req_t **)H5MM_malloc(count * sizeof(H5FD_iouring_req_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate request queue")
+
+    /* Check the blocks and set up their progress records.  'todo' is used
+     * as a stack, so push the blocks in reverse to submit them in order.
+     */
+    for (u = 0; u < count; u++) {
+        if (!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu",
+                        (unsigned long long)addrs[u])
+        if (REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu",
+                        (unsigned long long)addrs[u])
+
+        reqs[u].addr = addrs[u];
+        reqs[u].size = sizes[u];
+        reqs[u].rbuf = do_write ? NULL : (unsigned char *)rbufs[u];
+        reqs[u].wbuf = do_write ? (const unsigned char *)wbufs[u] : NULL;
+
+        if (do_write && (addrs[u] + sizes[u]) > end)
+            end = addrs[u] + sizes[u];
+    } /* end for */
+    for (u = count; u > 0; u--)
+        if (reqs[u - 1].size > 0)
+            todo[ntodo++] = &reqs[u - 1];
+
+    while (ntodo > 0 || inflight > 0) {
+        struct io_uring_cqe *cqe; /* Completion queue entry */
+        int                  ret; /* liburing return value  */
+
+        /* Fill the submission queue, unless an error means we are only
+         * draining what is already in flight
+         */
+        while (0 == io_errno && ntodo > 0 && inflight < file->queue_depth) {
+            struct io_uring_sqe *sqe; /* Submission queue entry */
+            H5FD_iouring_req_t * req; /* Block to queue         */
+            unsigned             nbytes;
+
+            if (NULL == (sqe = io_uring_get_sqe(&file->ring)))
+                break;
+
+            req    = todo[--ntodo];
+            nbytes = (unsigned)MIN(req->size, H5FD_IOURING_MAX_IO_BYTES);
+            if (do_write)
+                io_uring_prep_write(sqe, file->fd, req->wbuf, nbytes, (__u64)req->addr);
+            else
+                io_uring_prep_read(sqe, file->fd, req->rbuf, nbytes, (__u64)req->addr);
+            io_uring_sqe_set_data(sqe, req);
+            inflight++;
+        } /* end while */
+
+        /* Nothing left to wait for (only possible after an error) */
+        if (0 == inflight)
+            break;
+
+        /* Hand the new entries to the kernel and wait for at least one
+         * completion
+         */
+        if ((ret = io_uring_submit_and_wait(&file->ring, 1)) < 0 && -EINTR != ret && -EAGAIN != ret &&
+            -EBUSY != ret) {
+            /* The kernel refused the ring itself, so the state of the
+             * queued entries is unknown and the buffers they point to
+             * can't be released safely.  Retire the ring.
+             */
+            file->ring_failed = TRUE;
+            errno             = -ret;
+            HSYS_GOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                            "io_uring submission failed")
+        } /* end if */
+
+        /* Retire every completion that is ready */
+        while (0 == io_uring_peek_cqe(&file->ring, &cqe)) {
+            H5FD_iouring_req_t *req = (H5FD_iouring_req_t *)io_uring_cqe_get_data(cqe);
+            int                 res = cqe->res;
+
+            io_uring_cqe_seen(&file->ring, cqe);
+            inflight--;
+
+            if (res < 0) {
+                if (-EINTR == res || -EAGAIN == res)
+                    todo[ntodo++] = req;
+                else if (0 == io_errno)
+                    io_errno = -res;
+            } /* end if */
+            else if (0 == res) {
+                if (do_write) {
+                    if (0 == io_errno)
+                        io_errno = EIO;
+                } /* end if */
+                else {
+                    /* End of file: the rest of the block reads as zeros */
+                    HDmemset(req->rbuf, 0, req->size);
+                    req->size = 0;
+                } /* end else */
+            }     /* end else-if */
+            else {
+                req->addr += (haddr_t)res;
+                req->size -= (size_t)res;
+                if (do_write)
+                    req->wbuf += res;
+                else
+                    req->rbuf += res;
+
+                /* Queue the rest of a short transfer */
+                if (req->size > 0)
+                    todo[ntodo++] = req;
+            } /* end else */
+        }     /* end while */
+    }         /* end while */
+
+    if (io_errno) {
+        errno = io_errno;
+        HSYS_GOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "io_uring transfer failed")
+    } /* end if */
+
+    /* Writes may have extended the file */
+    if (do_write && end > file->eof)
+        file->eof = end;
+
+done:
+    H5MM_xfree(todo);
+    H5MM_xfree(reqs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                   size_t size, void *buf /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(_file && _file->cls);
+    HDassert(buf);
+
+    if (H5FD__iouring_io((H5FD_iouring_t *)_file, FALSE, (size_t)1, &addr, &size, &buf, NULL) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                    size_t size, const void *buf)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(_file && _file->cls);
+    HDassert(buf);
+
+    if (H5FD__iouring_io((H5FD_iouring_t *)_file, TRUE, (size_t)1, &addr, &size, NULL, &buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read_vector
+ *
+ * Purpose:     Reads COUNT blocks, block I being SIZES[I] bytes at
+ *              ADDRS[I] into BUFS[I], submitting them to the kernel as one
+ *              batch.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read_vector(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                          size_t count, const haddr_t addrs[], const size_t sizes[], void *bufs[] /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(_file && _file->cls);
+    HDassert(0 == count || (addrs && sizes && bufs));
+
+    if (H5FD__iouring_io((H5FD_iouring_t *)_file, FALSE, count, addrs, sizes, bufs, NULL) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write_vector
+ *
+ * Purpose:     Writes COUNT blocks, block I being SIZES[I] bytes from
+ *              BUFS[I] to ADDRS[I], submitting them to the kernel as one
+ *              batch.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write_vector(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                           size_t count, const haddr_t addrs[], const size_t sizes[], const void *bufs[])
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(_file && _file->cls);
+    HDassert(0 == count || (addrs && sizes && bufs));
+
+    if (H5FD__iouring_io((H5FD_iouring_t *)_file, TRUE, count, addrs, sizes, NULL, bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same as the
+ *              end-of-allocation.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Extend the file to make sure it's large enough */
+    if (!H5F_addr_eq(file->eoa, file->eof)) {
+        if (-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    int             lock_flags;                     /* file locking flags       */
+    herr_t          ret_value = SUCCEED;            /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_unlock(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    herr_t          ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_unlock() */
+
+#endif /* H5_HAVE_IOURING_VFD */
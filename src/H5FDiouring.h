@@ -0,0 +1,44 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the io_uring driver.
+ */
+#ifndef H5FDiouring_H
+#define H5FDiouring_H
+
+#ifdef H5_HAVE_IOURING_VFD
+#define H5FD_IOURING (H5FD_iouring_init())
+#else
+#define H5FD_IOURING (H5I_INVALID_HID)
+#endif /* H5_HAVE_IOURING_VFD */
+
+#ifdef H5_HAVE_IOURING_VFD
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default # of entries in the submission queue of each open file.
+ * Applications can change it through H5Pset_fapl_iouring. */
+#define H5FD_IOURING_QUEUE_DEPTH_DEF 64
+
+H5_DLL hid_t  H5FD_iouring_init(void);
+H5_DLL herr_t H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth);
+H5_DLL herr_t H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_IOURING_VFD */
+
+#endif
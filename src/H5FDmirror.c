@@ -191,7 +191,9 @@ static const H5FD_class_t H5FD_mirror_g = {
     H5FD__mirror_truncate,  /* truncate             */
     H5FD__mirror_lock,      /* lock                 */
     H5FD__mirror_unlock,    /* unlock               */
-    H5FD_FLMAP_DICHOTOMY    /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,   /* fl_map               */
+    NULL,                   /* read_vector          */
+    NULL                    /* write_vector         */
 };
 
 /* Declare a free list to manage the transmission buffers */
@@ -0,0 +1,48 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the read-only memory-mapped driver.
+ */
+#ifndef H5FDmmap_H
+#define H5FDmmap_H
+
+#ifdef H5_HAVE_MMAP_VFD
+#define H5FD_MMAP (H5FD_mmap_init())
+#else
+#define H5FD_MMAP (H5I_INVALID_HID)
+#endif /* H5_HAVE_MMAP_VFD */
+
+/* Access pattern hints passed to the operating system for the mapping */
+typedef enum H5FD_mmap_advice_t {
+    H5FD_MMAP_ADVICE_NORMAL = 0, /* No particular pattern (the default)                  */
+    H5FD_MMAP_ADVICE_SEQUENTIAL, /* Pages will be read in order: read ahead aggressively */
+    H5FD_MMAP_ADVICE_RANDOM,     /* Pages will be read in random order: don't read ahead */
+    H5FD_MMAP_ADVICE_WILLNEED    /* The whole file will be read soon: start paging it in */
+} H5FD_mmap_advice_t;
+
+#ifdef H5_HAVE_MMAP_VFD
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+H5_DLL hid_t  H5FD_mmap_init(void);
+H5_DLL herr_t H5Pset_fapl_mmap(hid_t fapl_id, H5FD_mmap_advice_t advice);
+H5_DLL herr_t H5Pget_fapl_mmap(hid_t fapl_id, H5FD_mmap_advice_t *advice /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_MMAP_VFD */
+
+#endif
@@ -125,7 +125,9 @@ static const H5FD_class_mpi_t H5FD_mpio_g = {
         H5FD__mpio_truncate,   /*truncate		*/
         NULL,                  /*lock                  */
         NULL,                  /*unlock                */
-        H5FD_FLMAP_DICHOTOMY   /*fl_map                */
+        H5FD_FLMAP_DICHOTOMY,  /*fl_map                */
+        NULL,                  /*read_vector           */
+        NULL                   /*write_vector          */
     },                         /* End of superclass information */
     H5FD__mpio_mpi_rank,       /*get_rank              */
     H5FD__mpio_mpi_size,       /*get_size              */
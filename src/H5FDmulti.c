@@ -168,7 +168,9 @@ static const H5FD_class_t H5FD_multi_g = {
     H5FD_multi_truncate,       /*truncate        */
     H5FD_multi_lock,           /*lock                  */
     H5FD_multi_unlock,         /*unlock                */
-    H5FD_FLMAP_DEFAULT         /*fl_map        */
+    H5FD_FLMAP_DEFAULT,        /*fl_map        */
+    NULL,                      /*read_vector   */
+    NULL                       /*write_vector  */
 };
 
 /*-------------------------------------------------------------------------
@@ -262,6 +262,13 @@ typedef enum H5F_mem_t H5FD_mem_t;
  * enabled may be used as the Write-Only (W/O) channel driver.
  */
 #define H5FD_FEAT_DEFAULT_VFD_COMPATIBLE 0x00008000
+/*
+ * Defining H5FD_FEAT_CONCURRENT_READ for a VFL driver means that the
+ * driver's read callback only reads from the file (no seek pointer or
+ * other per-file state is updated), so the thread-safe library may issue
+ * raw data reads on a read-only file from several threads at once.
+ */
+#define H5FD_FEAT_CONCURRENT_READ 0x00010000
 
 /* Forward declaration */
 typedef struct H5FD_t H5FD_t;
@@ -300,6 +307,13 @@ typedef struct H5FD_class_t {
     herr_t (*lock)(H5FD_t *file, hbool_t rw);
     herr_t (*unlock)(H5FD_t *file);
     H5FD_mem_t fl_map[H5FD_MEM_NTYPES];
+
+    /* Optional vector I/O callbacks, reading or writing COUNT blocks at once
+     * (drivers without them have their 'read' or 'write' called per block) */
+    herr_t (*read_vector)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl, size_t count, const haddr_t addrs[],
+                          const size_t sizes[], void *bufs[]);
+    herr_t (*write_vector)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl, size_t count, const haddr_t addrs[],
+                           const size_t sizes[], const void *bufs[]);
 } H5FD_class_t;
 
 /* A free list is a singly-linked list of address/size pairs. */
@@ -373,6 +387,10 @@ H5_DLL herr_t  H5FDread(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, haddr_t ad
                         void *buf /*out*/);
 H5_DLL herr_t  H5FDwrite(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
                          const void *buf);
+H5_DLL herr_t  H5FDread_vector(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+                               const haddr_t addrs[], const size_t sizes[], void *bufs[] /*out*/);
+H5_DLL herr_t  H5FDwrite_vector(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+                                const haddr_t addrs[], const size_t sizes[], const void *bufs[]);
 H5_DLL herr_t  H5FDflush(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t  H5FDtruncate(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t  H5FDlock(H5FD_t *file, hbool_t rw);
@@ -268,7 +268,9 @@ static const H5FD_class_t H5FD_ros3_g = {
     H5FD__ros3_truncate,      /* truncate             */
     H5FD__ros3_lock,          /* lock                 */
     H5FD__ros3_unlock,        /* unlock               */
-    H5FD_FLMAP_DICHOTOMY      /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,     /* fl_map               */
+    NULL,                     /* read_vector          */
+    NULL                      /* write_vector         */
 };
 
 /* Declare a free list to manage the H5FD_ros3_t struct */
@@ -121,6 +121,20 @@ typedef struct H5FD_sec2_t {
 #define REGION_OVERFLOW(A, Z)                                                                                \
     (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
 
+#ifdef H5_HAVE_PREADWRITEV
+/* Maximum # of buffers passed to one preadv() / pwritev() call */
+#ifdef IOV_MAX
+#define H5FD_SEC2_MAX_IOV IOV_MAX
+#else
+#define H5FD_SEC2_MAX_IOV 1024
+#endif
+
+/* Largest hole between two blocks that a vector read will read through
+ * (into a scratch buffer) rather than starting a new system call
+ */
+#define H5FD_SEC2_MAX_GAP 4096
+#endif /* H5_HAVE_PREADWRITEV */
+
 /* Prototypes */
 static herr_t  H5FD__sec2_term(void);
 static H5FD_t *H5FD__sec2_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
@@ -136,42 +150,57 @@ static herr_t  H5FD__sec2_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, ha
 static herr_t  H5FD__sec2_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                 const void *buf);
 static herr_t  H5FD__sec2_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+#ifdef H5_HAVE_PREADWRITEV
+static herr_t H5FD__sec2_readv(H5FD_sec2_t *file, HDoff_t offset, struct iovec *iov, int iovcnt);
+static herr_t H5FD__sec2_writev(H5FD_sec2_t *file, HDoff_t offset, struct iovec *iov, int iovcnt);
+static herr_t H5FD__sec2_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+                                     const haddr_t addrs[], const size_t sizes[], void *bufs[]);
+static herr_t H5FD__sec2_write_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+                                      const haddr_t addrs[], const size_t sizes[], const void *bufs[]);
+#endif /* H5_HAVE_PREADWRITEV */
 static herr_t  H5FD__sec2_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__sec2_unlock(H5FD_t *_file);
 
 static const H5FD_class_t H5FD_sec2_g = {
-    "sec2",                /* name                 */
-    MAXADDR,               /* maxaddr              */
-    H5F_CLOSE_WEAK,        /* fc_degree            */
-    H5FD__sec2_term,       /* terminate            */
-    NULL,                  /* sb_size              */
-    NULL,                  /* sb_encode            */
-    NULL,                  /* sb_decode            */
-    0,                     /* fapl_size            */
-    NULL,                  /* fapl_get             */
-    NULL,                  /* fapl_copy            */
-    NULL,                  /* fapl_free            */
-    0,                     /* dxpl_size            */
-    NULL,                  /* dxpl_copy            */
-    NULL,                  /* dxpl_free            */
-    H5FD__sec2_open,       /* open                 */
-    H5FD__sec2_close,      /* close                */
-    H5FD__sec2_cmp,        /* cmp                  */
-    H5FD__sec2_query,      /* query                */
-    NULL,                  /* get_type_map         */
-    NULL,                  /* alloc                */
-    NULL,                  /* free                 */
-    H5FD__sec2_get_eoa,    /* get_eoa              */
-    H5FD__sec2_set_eoa,    /* set_eoa              */
-    H5FD__sec2_get_eof,    /* get_eof              */
-    H5FD__sec2_get_handle, /* get_handle           */
-    H5FD__sec2_read,       /* read                 */
-    H5FD__sec2_write,      /* write                */
-    NULL,                  /* flush                */
-    H5FD__sec2_truncate,   /* truncate             */
-    H5FD__sec2_lock,       /* lock                 */
-    H5FD__sec2_unlock,     /* unlock               */
-    H5FD_FLMAP_DICHOTOMY   /* fl_map               */
+    "sec2",                 /* name                 */
+    MAXADDR,                /* maxaddr              */
+    H5F_CLOSE_WEAK,         /* fc_degree            */
+    H5FD__sec2_term,        /* terminate            */
+    NULL,                   /* sb_size              */
+    NULL,                   /* sb_encode            */
+    NULL,                   /* sb_decode            */
+    0,                      /* fapl_size            */
+    NULL,                   /* fapl_get             */
+    NULL,                   /* fapl_copy            */
+    NULL,                   /* fapl_free            */
+    0,                      /* dxpl_size            */
+    NULL,                   /* dxpl_copy            */
+    NULL,                   /* dxpl_free            */
+    H5FD__sec2_open,        /* open                 */
+    H5FD__sec2_close,       /* close                */
+    H5FD__sec2_cmp,         /* cmp                  */
+    H5FD__sec2_query,       /* query                */
+    NULL,                   /* get_type_map         */
+    NULL,                   /* alloc                */
+    NULL,                   /* free                 */
+    H5FD__sec2_get_eoa,     /* get_eoa              */
+    H5FD__sec2_set_eoa,     /* set_eoa              */
+    H5FD__sec2_get_eof,     /* get_eof              */
+    H5FD__sec2_get_handle,  /* get_handle           */
+    H5FD__sec2_read,        /* read                 */
+    H5FD__sec2_write,       /* write                */
+    NULL,                   /* flush                */
+    H5FD__sec2_truncate,    /* truncate             */
+    H5FD__sec2_lock,        /* lock                 */
+    H5FD__sec2_unlock,      /* unlock               */
+    H5FD_FLMAP_DICHOTOMY,   /* fl_map               */
+#ifdef H5_HAVE_PREADWRITEV
+    H5FD__sec2_read_vector, /* read_vector          */
+    H5FD__sec2_write_vector /* write_vector         */
+#else
+    NULL,                   /* read_vector          */
+    NULL                    /* write_vector         */
+#endif /* H5_HAVE_PREADWRITEV */
 };
 
 /* Declare a free list to manage the H5FD_sec2_t struct */
@@ -565,6 +594,9 @@ H5FD__sec2_query(const H5FD_t *_file, unsigned long *flags /* out */)
             H5FD_FEAT_SUPPORTS_SWMR_IO; /* VFD supports the single-writer/multiple-readers (SWMR) pattern   */
         *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
                                                        VFD      */
+#ifdef H5_HAVE_PREADWRITE
+        *flags |= H5FD_FEAT_CONCURRENT_READ; /* pread() leaves no per-file state behind, so reads can overlap */
+#endif /* H5_HAVE_PREADWRITE */
 
         /* Check for flags that are set by h5repart */
         if (file && file->fam_to_single)
@@ -775,16 +807,22 @@ H5FD__sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
         buf = (char *)buf + bytes_read;
     } /* end while */
 
-    /* Update current position */
+#ifndef H5_HAVE_PREADWRITE
+    /* Update current position (only needed to avoid seeks, and left alone
+     * with pread() so concurrent reads don't touch the file struct)
+     */
     file->pos = addr;
     file->op  = OP_READ;
+#endif /* H5_HAVE_PREADWRITE */
 
 done:
+#ifndef H5_HAVE_PREADWRITE
     if (ret_value < 0) {
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op  = OP_UNKNOWN;
     } /* end if */
+#endif /* H5_HAVE_PREADWRITE */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__sec2_read() */
@@ -894,6 +932,379 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__sec2_write() */
 
+#ifdef H5_HAVE_PREADWRITEV
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_readv
+ *
+ * Purpose:     Fills the IOVCNT buffers described by IOV with consecutive
+ *              bytes of FILE beginning at OFFSET, being careful of
+ *              interrupted system calls, partial results, and the end of
+ *              the file.  The IOV array is modified.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_readv(H5FD_sec2_t *file, HDoff_t offset, struct iovec *iov, int iovcnt)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(iov);
+
+    while (iovcnt > 0) {
+        ssize_t bytes_read = -1; /* # of bytes actually read */
+
+        do {
+            bytes_read = HDpreadv(file->fd, iov, iovcnt, offset);
+        } while (-1 == bytes_read && EINTR == errno);
+
+        if (-1 == bytes_read) { /* error */
+            int    myerrno = errno;
+            time_t mytime  = HDtime(NULL);
+
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                        "file vector read failed: time = %s, filename = '%s', file descriptor = %d, "
+                        "errno = %d, error message = '%s', buffer count = %d, offset = %llu",
+                        HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), iovcnt,
+                        (unsigned long long)offset);
+        } /* end if */
+
+        if (0 == bytes_read) {
+            /* end of file but not end of format address space */
+            for (; iovcnt > 0; iov++, iovcnt--)
+                HDmemset(iov->iov_base, 0, iov->iov_len);
+            break;
+        } /* end if */
+
+        offset += (HDoff_t)bytes_read;
+
+        /* Skip the buffers that were filled and trim a partially filled one */
+        while (iovcnt > 0 && (size_t)bytes_read >= iov->iov_len) {
+            bytes_read -= (ssize_t)iov->iov_len;
+            iov++;
+            iovcnt--;
+        } /* end while */
+        if (iovcnt > 0) {
+            iov->iov_base = (char *)iov->iov_base + bytes_read;
+            iov->iov_len -= (size_t)bytes_read;
+        } /* end if */
+    }     /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_readv() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_writev
+ *
+ * Purpose:     Writes the IOVCNT buffers described by IOV to consecutive
+ *              bytes of FILE beginning at OFFSET, being careful of
+ *              interrupted system calls and partial results.  The IOV
+ *              array is modified.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_writev(H5FD_sec2_t *file, HDoff_t offset, struct iovec *iov, int iovcnt)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(iov);
+
+    while (iovcnt > 0) {
+        ssize_t bytes_wrote = -1; /* # of bytes written */
+
+        do {
+            bytes_wrote = HDpwritev(file->fd, iov, iovcnt, offset);
+        } while (-1 == bytes_wrote && EINTR == errno);
+
+        if (-1 == bytes_wrote) { /* error */
+            int    myerrno = errno;
+            time_t mytime  = HDtime(NULL);
+
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                        "file vector write failed: time = %s, filename = '%s', file descriptor = %d, "
+                        "errno = %d, error message = '%s', buffer count = %d, offset = %llu",
+                        HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), iovcnt,
+                        (unsigned long long)offset);
+        } /* end if */
+
+        HDassert(bytes_wrote > 0);
+
+        offset += (HDoff_t)bytes_wrote;
+
+        /* Skip the buffers that were written and trim a partially written one */
+        while (iovcnt > 0 && (size_t)bytes_wrote >= iov->iov_len) {
+            bytes_wrote -= (ssize_t)iov->iov_len;
+            iov++;
+            iovcnt--;
+        } /* end while */
+        if (iovcnt > 0) {
+            iov->iov_base = (char *)iov->iov_base + bytes_wrote;
+            iov->iov_len -= (size_t)bytes_wrote;
+        } /* end if */
+    }     /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_writev() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_read_vector
+ *
+ * Purpose:     Reads COUNT blocks of data from FILE, block I being
+ *              SIZES[I] bytes at address ADDRS[I] read into BUFS[I].
+ *
+ *              Runs of blocks which follow each other in the file, or are
+ *              separated by holes of at most H5FD_SEC2_MAX_GAP bytes, are
+ *              read with a single preadv() call.  Holes are read into a
+ *              scratch buffer and discarded.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffers BUFS.
+ *              Failure:    FAIL, Contents of buffers BUFS are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_read_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count, const haddr_t addrs[],
+                       const size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_sec2_t * file    = (H5FD_sec2_t *)_file;
+    struct iovec *iov     = NULL;      /* I/O vector for one system call */
+    void *        scratch = NULL;      /* Buffer for holes between blocks */
+    size_t        max_iov;             /* Size of I/O vector */
+    size_t        u;                   /* Local index variable */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for (u = 0; u < count; u++) {
+        if (!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu",
+                        (unsigned long long)addrs[u])
+        if (REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu",
+                        (unsigned long long)addrs[u])
+    } /* end for */
+
+    /* Allocate the I/O vector (each block may need a hole in front of it) */
+    max_iov = MIN(2 * count, (size_t)H5FD_SEC2_MAX_IOV);
+    if (max_iov > 0 && NULL == (iov = (struct iovec *)H5MM_malloc(max_iov * sizeof(struct iovec))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate I/O vector")
+
+    u = 0;
+    while (u < count) {
+        haddr_t start;      /* File address of this run */
+        haddr_t end;        /* File address just past this run */
+        size_t  nbytes;     /* # of bytes in this run */
+        int     iovcnt = 0; /* # of buffers in this run */
+
+        /* Skip empty blocks */
+        if (0 == sizes[u]) {
+            u++;
+            continue;
+        } /* end if */
+
+        /* Blocks too large for one system call go through the regular read */
+        if (sizes[u] > H5_POSIX_MAX_IO_BYTES) {
+            if (H5FD__sec2_read(_file, type, dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+            u++;
+            continue;
+        } /* end if */
+
+        /* Start a new run with this block */
+        start                 = addrs[u];
+        end                   = addrs[u] + sizes[u];
+        nbytes                = sizes[u];
+        iov[iovcnt].iov_base  = bufs[u];
+        iov[iovcnt++].iov_len = sizes[u];
+        u++;
+
+        /* Extend the run with following blocks that are close enough */
+        while (u < count && (size_t)iovcnt + 2 <= max_iov) {
+            size_t gap; /* Size of hole in front of block */
+
+            if (0 == sizes[u]) {
+                u++;
+                continue;
+            } /* end if */
+            if (H5F_addr_lt(addrs[u], end) || (addrs[u] - end) > H5FD_SEC2_MAX_GAP)
+                break;
+            gap = (size_t)(addrs[u] - end);
+            if ((nbytes + gap + sizes[u]) > H5_POSIX_MAX_IO_BYTES)
+                break;
+
+            /* Read through the hole */
+            if (gap > 0) {
+                if (NULL == scratch && NULL == (scratch = H5MM_malloc(H5FD_SEC2_MAX_GAP)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate scratch buffer")
+                iov[iovcnt].iov_base  = scratch;
+                iov[iovcnt++].iov_len = gap;
+            } /* end if */
+
+            iov[iovcnt].iov_base  = bufs[u];
+            iov[iovcnt++].iov_len = sizes[u];
+            nbytes += gap + sizes[u];
+            end = addrs[u] + sizes[u];
+            u++;
+        } /* end while */
+
+        if (H5FD__sec2_readv(file, (HDoff_t)start, iov, iovcnt) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed")
+
+#ifndef H5_HAVE_PREADWRITE
+        /* Update current position */
+        file->pos = end;
+        file->op  = OP_READ;
+#endif /* H5_HAVE_PREADWRITE */
+    } /* end while */
+
+done:
+    H5MM_xfree(iov);
+    H5MM_xfree(scratch);
+
+#ifndef H5_HAVE_PREADWRITE
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+#endif /* H5_HAVE_PREADWRITE */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_read_vector() */
+
+/* The buffers are only read from, but 'struct iovec' isn't const-qualified */
+H5_GCC_DIAG_OFF("cast-qual")
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_write_vector
+ *
+ * Purpose:     Writes COUNT blocks of data to FILE, block I being
+ *              SIZES[I] bytes from BUFS[I] written at address ADDRS[I].
+ *
+ *              Runs of blocks which directly follow each other in the
+ *              file are written with a single pwritev() call.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_write_vector(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count, const haddr_t addrs[],
+                        const size_t sizes[], const void *bufs[])
+{
+    H5FD_sec2_t * file = (H5FD_sec2_t *)_file;
+    struct iovec *iov  = NULL;         /* I/O vector for one system call */
+    size_t        max_iov;             /* Size of I/O vector */
+    size_t        u;                   /* Local index variable */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for (u = 0; u < count; u++) {
+        if (!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu",
+                        (unsigned long long)addrs[u])
+        if (REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                        (unsigned long long)addrs[u], (unsigned long long)sizes[u])
+    } /* end for */
+
+    /* Allocate the I/O vector */
+    max_iov = MIN(count, (size_t)H5FD_SEC2_MAX_IOV);
+    if (max_iov > 0 && NULL == (iov = (struct iovec *)H5MM_malloc(max_iov * sizeof(struct iovec))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate I/O vector")
+
+    u = 0;
+    while (u < count) {
+        haddr_t start;      /* File address of this run */
+        haddr_t end;        /* File address just past this run */
+        size_t  nbytes;     /* # of bytes in this run */
+        int     iovcnt = 0; /* # of buffers in this run */
+
+        /* Skip empty blocks */
+        if (0 == sizes[u]) {
+            u++;
+            continue;
+        } /* end if */
+
+        /* Blocks too large for one system call go through the regular write */
+        if (sizes[u] > H5_POSIX_MAX_IO_BYTES) {
+            if (H5FD__sec2_write(_file, type, dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+            u++;
+            continue;
+        } /* end if */
+
+        /* Start a new run with this block */
+        start                 = addrs[u];
+        end                   = addrs[u] + sizes[u];
+        nbytes                = sizes[u];
+        iov[iovcnt].iov_base  = (void *)bufs[u];
+        iov[iovcnt++].iov_len = sizes[u];
+        u++;
+
+        /* Extend the run with following blocks that start where it ends */
+        while (u < count && (size_t)iovcnt < max_iov) {
+            if (0 == sizes[u]) {
+                u++;
+                continue;
+            } /* end if */
+            if (!H5F_addr_eq(addrs[u], end) || (nbytes + sizes[u]) > H5_POSIX_MAX_IO_BYTES)
+                break;
+
+            iov[iovcnt].iov_base  = (void *)bufs[u];
+            iov[iovcnt++].iov_len = sizes[u];
+            nbytes += sizes[u];
+            end = addrs[u] + sizes[u];
+            u++;
+        } /* end while */
+
+        if (H5FD__sec2_writev(file, (HDoff_t)start, iov, iovcnt) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed")
+
+        /* Update current position and eof */
+        file->pos = end;
+        file->op  = OP_WRITE;
+        if (file->pos > file->eof)
+            file->eof = file->pos;
+    } /* end while */
+
+done:
+    H5MM_xfree(iov);
+
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_write_vector() */
+H5_GCC_DIAG_ON("cast-qual")
+#endif /* H5_HAVE_PREADWRITEV */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__sec2_truncate
  *
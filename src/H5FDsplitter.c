@@ -162,7 +162,9 @@ static const H5FD_class_t H5FD_splitter_g = {
     H5FD__splitter_truncate,      /* truncate             */
     H5FD__splitter_lock,          /* lock                 */
     H5FD__splitter_unlock,        /* unlock               */
-    H5FD_FLMAP_DICHOTOMY          /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,         /* fl_map               */
+    NULL,                         /* read_vector          */
+    NULL                          /* write_vector         */
 };
 
 /* Declare a free list to manage the H5FD_splitter_t struct */
@@ -120,6 +120,51 @@ hbool_t H5_PKG_INIT_VAR = FALSE;
 /* The head of the list of factory things to garbage collect */
 static H5FL_fac_gc_list_t H5FL_fac_gc_head = {0, NULL};
 
+/* Allocation statistics for all the kinds of free lists (the amounts of
+ * memory held are filled in when they're queried) */
+static H5_free_list_stats_t H5FL_stats_g;
+
+/* In thread-safe builds, each thread keeps a small cache ("magazine") of freed
+ * objects for the "regular" free lists it uses most, in front of the free
+ * lists themselves.  Objects freed and allocated again by the same thread
+ * don't touch the shared free lists, and move between them and the thread's
+ * cache in batches.
+ *
+ * Every free list call is still made with the API lock held, which is also
+ * what lets one thread garbage collect the caches of the others.  A thread's
+ * cache lives as long as the thread does: its objects are returned to the
+ * free lists when the lists are garbage collected or the library is shut
+ * down, and the cache itself is released when the thread exits (see
+ * H5FL_thread_cache_release).
+ */
+#ifdef H5_HAVE_THREADSAFE
+#define H5FL_THREAD_CACHE
+#endif /* H5_HAVE_THREADSAFE */
+
+#ifdef H5FL_THREAD_CACHE
+#define H5FL_REG_CACHE_NSLOTS 64 /* Number of free lists a thread caches objects for (power of 2) */
+#define H5FL_REG_CACHE_MAX    32 /* Most objects a thread caches for one free list */
+#define H5FL_REG_CACHE_BATCH  16 /* Objects moved between a thread's cache and a free list at once */
+
+/* A thread's cache of objects for one "regular" free list */
+typedef struct H5FL_reg_mag_t {
+    H5FL_reg_head_t *head;  /* Free list the objects belong to, NULL for an unused slot */
+    unsigned         count; /* Number of objects in the magazine */
+    H5FL_reg_node_t *list;  /* Objects in the magazine */
+} H5FL_reg_mag_t;
+
+/* A thread's cache of free list objects */
+typedef struct H5FL_thread_cache_t {
+    H5FL_reg_mag_t              reg[H5FL_REG_CACHE_NSLOTS]; /* Magazines, hashed on their free list */
+    size_t                      mem_held;                   /* Memory held in the magazines */
+    struct H5FL_thread_cache_t *prev;                       /* Previous cache of all the threads' caches */
+    struct H5FL_thread_cache_t *next;                       /* Next cache of all the threads' caches */
+} H5FL_thread_cache_t;
+
+/* All the threads' caches */
+static H5FL_thread_cache_t *H5FL_thread_caches_g = NULL;
+#endif /* H5FL_THREAD_CACHE */
+
 #ifdef H5FL_TRACK
 
 /* Extra headers needed */
@@ -148,6 +193,21 @@ static int              H5FL__arr_term(void);
 static herr_t           H5FL__fac_gc_list(H5FL_fac_head_t *head);
 static herr_t           H5FL__fac_gc(void);
 static int              H5FL__fac_term_all(void);
+#ifdef H5FL_THREAD_CACHE
+static H5FL_thread_cache_t *H5FL__thread_cache(void);
+static void                 H5FL__thread_cache_drain(H5FL_thread_cache_t *cache);
+static void                 H5FL__thread_caches_gc(void);
+static void                 H5FL__thread_caches_term(void);
+static H5FL_reg_mag_t *     H5FL__reg_mag(H5FL_reg_head_t *head, H5FL_thread_cache_t **cache);
+static void                 H5FL__reg_mag_return(H5FL_thread_cache_t *cache, H5FL_reg_mag_t *mag, unsigned n);
+static void *               H5FL__reg_cache_get(H5FL_reg_head_t *head);
+static hbool_t              H5FL__reg_cache_put(H5FL_reg_head_t *head, void *obj);
+#else /* H5FL_THREAD_CACHE */
+#define H5FL__thread_caches_gc()        /* void */
+#define H5FL__thread_caches_term()      /* void */
+#define H5FL__reg_cache_get(head)       NULL
+#define H5FL__reg_cache_put(head, obj)  FALSE
+#endif /* H5FL_THREAD_CACHE */
 
 /* Declare a free list to manage the H5FL_blk_node_t struct */
 H5FL_DEFINE(H5FL_blk_node_t);
@@ -188,6 +248,9 @@ H5FL_term_package(void)
         /* Garbage collect any nodes on the free lists */
         (void)H5FL_garbage_coll();
 
+        /* Forget the free lists in the threads' (now empty) caches */
+        H5FL__thread_caches_term();
+
         /* Shut down the various kinds of free lists */
         n += H5FL__reg_term();
         n += H5FL__fac_term_all();
@@ -361,17 +424,20 @@ H5FL_reg_free(H5FL_reg_head_t *head, void *obj)
     /* Make certain that the free list is initialized */
     HDassert(head->init);
 
-    /* Link into the free list */
-    ((H5FL_reg_node_t *)obj)->next = head->list;
+    /* Keep the node in this thread's cache, if there's room for it there */
+    if (!H5FL__reg_cache_put(head, obj)) {
+        /* Link into the free list */
+        ((H5FL_reg_node_t *)obj)->next = head->list;
 
-    /* Point free list at the node freed */
-    head->list = (H5FL_reg_node_t *)obj;
+        /* Point free list at the node freed */
+        head->list = (H5FL_reg_node_t *)obj;
 
-    /* Increment the number of blocks on free list */
-    head->onlist++;
+        /* Increment the number of blocks on free list */
+        head->onlist++;
 
-    /* Increment the amount of "regular" freed memory globally */
-    H5FL_reg_gc_head.mem_freed += head->size;
+        /* Increment the amount of "regular" freed memory globally */
+        H5FL_reg_gc_head.mem_freed += head->size;
+    } /* end if */
 
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
@@ -416,8 +482,13 @@ H5FL_reg_malloc(H5FL_reg_head_t *head H5FL_TRACK_PARAMS)
         if (H5FL__reg_init(head) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'regular' blocks")
 
-    /* Check for nodes available on the free list first */
-    if (head->list != NULL) {
+    H5FL_stats_g.reg_alloc_count++;
+
+    /* Check for nodes available in this thread's cache first */
+    if (NULL != (ret_value = H5FL__reg_cache_get(head)))
+        H5FL_stats_g.reg_reuse_count++;
+    /* Then on the free list */
+    else if (head->list != NULL) {
         /* Get a pointer to the block on the free list */
         ret_value = (void *)(head->list);
 
@@ -429,6 +500,8 @@ H5FL_reg_malloc(H5FL_reg_head_t *head H5FL_TRACK_PARAMS)
 
         /* Decrement the amount of global "regular" free list memory in use */
         H5FL_reg_gc_head.mem_freed -= (head->size);
+
+        H5FL_stats_g.reg_reuse_count++;
     } /* end if */
     /* Otherwise allocate a node */
     else {
@@ -566,6 +639,9 @@ H5FL__reg_gc(void)
 
     FUNC_ENTER_STATIC
 
+    /* Return the objects in the threads' caches to their free lists */
+    H5FL__thread_caches_gc();
+
     /* Walk through all the free lists, free()'ing the nodes */
     gc_node = H5FL_reg_gc_head.first;
     while (gc_node != NULL) {
@@ -584,6 +660,342 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL__reg_gc() */
 
+#ifdef H5FL_THREAD_CACHE
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__thread_cache
+ *
+ * Purpose:	Get the calling thread's cache of free list objects, creating
+ *              it if this is the thread's first use of it.
+ *
+ * Return:	Success:	Pointer to the thread's cache
+ * 		Failure:	NULL (objects aren't cached for the thread)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FL_thread_cache_t *
+H5FL__thread_cache(void)
+{
+    H5FL_thread_cache_t *cache = NULL; /* The thread's cache */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Don't cache objects while the library is shutting down */
+    if (!H5_TERM_GLOBAL &&
+        NULL == (cache = (H5FL_thread_cache_t *)H5TS_get_thread_local_value(H5TS_flcache_key_g))) {
+#ifdef H5_HAVE_WIN_THREADS
+        /* Win32 has to use LocalAlloc to match the LocalFree in DllMain */
+        cache = (H5FL_thread_cache_t *)LocalAlloc(LPTR, sizeof(H5FL_thread_cache_t));
+#else
+        /* Use HDcalloc here, the cache is released when the thread exits */
+        cache = (H5FL_thread_cache_t *)HDcalloc(1, sizeof(H5FL_thread_cache_t));
+#endif /* H5_HAVE_WIN_THREADS */
+
+        if (NULL != cache) {
+            /* Link the cache into the list of all the threads' caches */
+            cache->next = H5FL_thread_caches_g;
+            if (H5FL_thread_caches_g)
+                H5FL_thread_caches_g->prev = cache;
+            H5FL_thread_caches_g = cache;
+
+            H5TS_set_thread_local_value(H5TS_flcache_key_g, (void *)cache);
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(cache)
+} /* end H5FL__thread_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_thread_cache_release
+ *
+ * Purpose:	Return the objects in an exiting thread's cache to their free
+ *              lists and release the cache.
+ *
+ * Note:	Called when the thread exits (from the destructor of the
+ *              thread's key, or from DllMain on Windows), outside of any
+ *              API call, so the API lock is taken here.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5FL_thread_cache_release(void *_cache)
+{
+    H5FL_thread_cache_t *cache = (H5FL_thread_cache_t *)_cache; /* The exiting thread's cache */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if (cache != NULL) {
+        H5TS_mutex_lock(&H5_g.init_lock);
+
+        /* Return the objects to their free lists */
+        H5FL__thread_cache_drain(cache);
+
+        /* Unlink the cache from the list of all the threads' caches */
+        if (cache->prev)
+            cache->prev->next = cache->next;
+        else
+            H5FL_thread_caches_g = cache->next;
+        if (cache->next)
+            cache->next->prev = cache->prev;
+
+        H5TS_mutex_unlock(&H5_g.init_lock);
+
+        /* Release the cache */
+#ifdef H5_HAVE_WIN_THREADS
+        LocalFree((HLOCAL)cache);
+#else
+        HDfree(cache);
+#endif /* H5_HAVE_WIN_THREADS */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FL_thread_cache_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__thread_cache_drain
+ *
+ * Purpose:	Return all the objects in a thread's cache to their free lists.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FL__thread_cache_drain(H5FL_thread_cache_t *cache)
+{
+    unsigned u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < H5FL_REG_CACHE_NSLOTS; u++)
+        if (cache->reg[u].count > 0)
+            H5FL__reg_mag_return(cache, &cache->reg[u], cache->reg[u].count);
+
+    /* Double check that all the memory in the cache is returned */
+    HDassert(cache->mem_held == 0);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FL__thread_cache_drain() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__thread_caches_gc
+ *
+ * Purpose:	Return the objects in all the threads' caches to their free
+ *              lists, so they can be garbage collected.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FL__thread_caches_gc(void)
+{
+    H5FL_thread_cache_t *cache; /* Thread's cache to drain */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (cache = H5FL_thread_caches_g; cache != NULL; cache = cache->next)
+        H5FL__thread_cache_drain(cache);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FL__thread_caches_gc() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__thread_caches_term
+ *
+ * Purpose:	Forget the free lists the threads' caches (which must already
+ *              have been drained) hold objects for, as they're shut down.
+ *              The caches themselves stay with their threads until the
+ *              threads exit.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FL__thread_caches_term(void)
+{
+    H5FL_thread_cache_t *cache; /* Thread's cache to reset */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (cache = H5FL_thread_caches_g; cache != NULL; cache = cache->next) {
+        unsigned u; /* Local index variable */
+
+        HDassert(cache->mem_held == 0);
+        for (u = 0; u < H5FL_REG_CACHE_NSLOTS; u++) {
+            HDassert(cache->reg[u].count == 0);
+            cache->reg[u].head = NULL;
+        } /* end for */
+    }     /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FL__thread_caches_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__reg_mag
+ *
+ * Purpose:	Find the calling thread's magazine of objects for a "regular"
+ *              free list.
+ *
+ * Return:	Success:	Pointer to the magazine
+ * 		Failure:	NULL (objects aren't cached for the free list)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FL_reg_mag_t *
+H5FL__reg_mag(H5FL_reg_head_t *head, H5FL_thread_cache_t **cache)
+{
+    H5FL_reg_mag_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (NULL != (*cache = H5FL__thread_cache())) {
+        uintptr_t key = (uintptr_t)head; /* Key to hash the free list on */
+        unsigned  u;                     /* Local index variable */
+
+        /* Probe from the free list's slot for its magazine or an unused one */
+        key ^= key >> 9;
+        for (u = 0; u < H5FL_REG_CACHE_NSLOTS; u++) {
+            H5FL_reg_mag_t *mag = &(*cache)->reg[((key >> 4) + u) & (H5FL_REG_CACHE_NSLOTS - 1)];
+
+            if (mag->head == head || mag->head == NULL) {
+                mag->head = head;
+                ret_value = mag;
+                break;
+            } /* end if */
+        }     /* end for */
+    }         /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__reg_mag() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__reg_mag_return
+ *
+ * Purpose:	Move objects from a thread's magazine back to their free list.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FL__reg_mag_return(H5FL_thread_cache_t *cache, H5FL_reg_mag_t *mag, unsigned n)
+{
+    H5FL_reg_head_t *head = mag->head; /* Free list the objects belong to */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(n <= mag->count);
+
+    while (n-- > 0) {
+        H5FL_reg_node_t *obj = mag->list; /* Object to return */
+
+        /* Take the object from the magazine */
+        mag->list = obj->next;
+        mag->count--;
+        cache->mem_held -= head->size;
+
+        /* Link it into the free list */
+        obj->next  = head->list;
+        head->list = obj;
+        head->onlist++;
+        H5FL_reg_gc_head.mem_freed += head->size;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FL__reg_mag_return() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__reg_cache_get
+ *
+ * Purpose:	Take an object for a "regular" free list from the calling
+ *              thread's cache, refilling the cache from the free list when
+ *              it's empty.
+ *
+ * Return:	Success:	Pointer to the object
+ * 		Failure:	NULL (no object is available)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FL__reg_cache_get(H5FL_reg_head_t *head)
+{
+    H5FL_thread_cache_t *cache;            /* The thread's cache */
+    H5FL_reg_mag_t *     mag;              /* The thread's magazine for the free list */
+    H5FL_reg_node_t *    ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (NULL != (mag = H5FL__reg_mag(head, &cache))) {
+        if (mag->count > 0)
+            H5FL_stats_g.thread_cache_hit_count++;
+        else
+            /* Refill the magazine with a batch of objects from the free list */
+            while (mag->count < H5FL_REG_CACHE_BATCH && head->list != NULL) {
+                H5FL_reg_node_t *obj = head->list; /* Object to move */
+
+                head->list = obj->next;
+                head->onlist--;
+                H5FL_reg_gc_head.mem_freed -= head->size;
+
+                obj->next = mag->list;
+                mag->list = obj;
+                mag->count++;
+                cache->mem_held += head->size;
+            } /* end while */
+
+        /* Take an object from the magazine */
+        if (mag->count > 0) {
+            ret_value = mag->list;
+            mag->list = ret_value->next;
+            mag->count--;
+            cache->mem_held -= head->size;
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI((void *)ret_value)
+} /* end H5FL__reg_cache_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__reg_cache_put
+ *
+ * Purpose:	Keep a freed object for a "regular" free list in the calling
+ *              thread's cache, returning a batch of objects to the free
+ *              list first if the cache is full.
+ *
+ * Return:	TRUE if the object was cached, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5FL__reg_cache_put(H5FL_reg_head_t *head, void *obj)
+{
+    H5FL_thread_cache_t *cache;             /* The thread's cache */
+    H5FL_reg_mag_t *     mag;               /* The thread's magazine for the free list */
+    hbool_t              ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (NULL != (mag = H5FL__reg_mag(head, &cache))) {
+        /* Make room in a full magazine */
+        if (mag->count >= H5FL_REG_CACHE_MAX)
+            H5FL__reg_mag_return(cache, mag, H5FL_REG_CACHE_BATCH);
+
+        ((H5FL_reg_node_t *)obj)->next = mag->list;
+        mag->list                      = (H5FL_reg_node_t *)obj;
+        mag->count++;
+        cache->mem_held += head->size;
+
+        ret_value = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__reg_cache_put() */
+#endif /* H5FL_THREAD_CACHE */
+
 /*--------------------------------------------------------------------------
  NAME
     H5FL_reg_term
@@ -863,6 +1275,8 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
         if (H5FL__blk_init(head) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'block' list")
 
+    H5FL_stats_g.blk_alloc_count++;
+
     /* check if there is a free list for blocks of this size */
     /* and if there are any blocks available on the list */
     if (NULL != (free_list = H5FL__blk_find_list(&(head->head), size)) && NULL != free_list->list) {
@@ -877,6 +1291,8 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
 
         /* Decrement the amount of global "block" free list memory in use */
         H5FL_blk_gc_head.mem_freed -= size;
+
+        H5FL_stats_g.blk_reuse_count++;
     } /* end if */
     /* No free list available, or there are no nodes on the list, allocate a new node to give to the user */
     else {
@@ -1495,6 +1911,8 @@ H5FL_arr_malloc(H5FL_arr_head_t *head, size_t elem)
     /* Get the set of the memory block */
     mem_size = head->list_arr[elem].size;
 
+    H5FL_stats_g.arr_alloc_count++;
+
     /* Check for nodes available on the free list first */
     if (head->list_arr[elem].list != NULL) {
         /* Get a pointer to the block on the free list */
@@ -1510,6 +1928,7 @@ H5FL_arr_malloc(H5FL_arr_head_t *head, size_t elem)
         /* Decrement the amount of global "array" free list memory in use */
         H5FL_arr_gc_head.mem_freed -= mem_size;
 
+        H5FL_stats_g.arr_reuse_count++;
     } /* end if */
     /* Otherwise allocate a node */
     else {
@@ -2093,6 +2512,8 @@ H5FL_fac_malloc(H5FL_fac_head_t *head H5FL_TRACK_PARAMS)
     HDassert(head);
     HDassert(head->init);
 
+    H5FL_stats_g.fac_alloc_count++;
+
     /* Check for nodes available on the free list first */
     if (head->list != NULL) {
         /* Get a pointer to the block on the free list */
@@ -2106,6 +2527,8 @@ H5FL_fac_malloc(H5FL_fac_head_t *head H5FL_TRACK_PARAMS)
 
         /* Decrement the amount of global "factory" free list memory in use */
         H5FL_fac_gc_head.mem_freed -= (head->size);
+
+        H5FL_stats_g.fac_reuse_count++;
     } /* end if */
     /* Otherwise allocate a node */
     else {
@@ -2584,3 +3007,44 @@ H5FL_get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size, s
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5FL_get_free_list_sizes() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_get_free_list_stats
+ *
+ * Purpose:	Gets statistics about the use of the different kinds of free
+ *              lists: how many allocations were made from them, how many of
+ *              those reused a freed block, and how much freed memory they
+ *              hold now.  These lists are global for the entire library.
+ *
+ * Return:	Success:	non-negative
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FL_get_free_list_stats(H5_free_list_stats_t *stats)
+{
+    FUNC_ENTER_NOAPI_NOERR
+
+    HDassert(stats);
+
+    *stats = H5FL_stats_g;
+
+#ifdef H5FL_THREAD_CACHE
+    {
+        H5FL_thread_cache_t *cache; /* Thread's cache */
+
+        /* Add the memory held in the threads' caches */
+        for (cache = H5FL_thread_caches_g; cache != NULL; cache = cache->next)
+            stats->thread_cache_bytes_held += cache->mem_held;
+    }
+#endif /* H5FL_THREAD_CACHE */
+
+    /* The memory held in the threads' caches is on "regular" free lists too */
+    stats->reg_bytes_held = H5FL_reg_gc_head.mem_freed + stats->thread_cache_bytes_held;
+    stats->arr_bytes_held = H5FL_arr_gc_head.mem_freed;
+    stats->blk_bytes_held = H5FL_blk_gc_head.mem_freed;
+    stats->fac_bytes_held = H5FL_fac_gc_head.mem_freed;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FL_get_free_list_stats() */
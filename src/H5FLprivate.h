@@ -430,6 +430,10 @@ H5_DLL herr_t H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim, in
                                         int fac_global_lim, int fac_list_lim);
 H5_DLL herr_t H5FL_get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size,
                                        size_t *fac_size);
+H5_DLL herr_t H5FL_get_free_list_stats(H5_free_list_stats_t *stats);
 H5_DLL int    H5FL_term_interface(void);
+#ifdef H5_HAVE_THREADSAFE
+H5_DLL void H5FL_thread_cache_release(void *cache);
+#endif /* H5_HAVE_THREADSAFE */
 
 #endif
@@ -238,6 +238,200 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_vector_read
+ *
+ * Purpose:	Reads COUNT contiguous blocks from a file/server/etc into
+ *		buffers.  Block I is SIZES[I] bytes at address ADDRS[I]
+ *		and is read into BUFS[I].  The addresses are relative to
+ *		the base address for the file.
+ *
+ *		Raw data which bypasses the page buffer is handed to the
+ *		file driver as a single vector request; anything else is
+ *		read one block at a time through the page buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_vector_read(H5F_shared_t *f_sh, H5FD_mem_t type, size_t count, const haddr_t addrs[],
+                       const size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_mem_t map_type;            /* Mapped memory type */
+    size_t     u;                   /* Local index variable */
+    herr_t     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for (u = 0; u < count; u++) {
+        HDassert(bufs[u]);
+        HDassert(H5F_addr_defined(addrs[u]));
+
+        if (H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+    } /* end for */
+
+    /* Treat global heap as raw data */
+    map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
+
+    /* Raw data goes straight to the file driver unless it's page buffered */
+    if (H5FD_MEM_DRAW == map_type && NULL == f_sh->page_buf) {
+        if (H5FD_read_vector(f_sh->lf, map_type, count, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read request failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if (H5PB_read(f_sh, map_type, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through page buffer failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_vector_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_raw_read_begin
+ *
+ * Purpose:	Gives up the library's API lock, when that is safe, ahead
+ *		of reading raw data from the file with
+ *		H5F_shared_block_read() or H5F_shared_vector_read() and
+ *		possibly decoding it, so that other threads can use the
+ *		library meanwhile.  *UNLOCKED reports whether the lock was
+ *		given up and must be passed to H5F_shared_raw_read_end()
+ *		once the caller is done.
+ *
+ *		It's only safe when the file is open read-only, isn't
+ *		page buffered and its driver can serve several reads at
+ *		once (H5FD_FEAT_CONCURRENT_READ), as then those reads
+ *		touch no shared library state.  It's only done in API
+ *		calls that hold the API shared (FUNC_ENTER_API_SHARED),
+ *		so no API call that modifies anything runs meanwhile.
+ *		The caller must only be reading into (and decoding)
+ *		buffers that are private to its operation, and must not
+ *		hold on to pointers into caches or other shared
+ *		structures until H5F_shared_raw_read_end() returns.
+ *		Errors aren't recorded meanwhile, so the caller reports
+ *		any failure once it has the lock back.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_raw_read_begin(const H5F_shared_t H5_ATTR_NDEBUG_UNUSED *f_sh, hbool_t *unlocked)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(unlocked);
+
+    *unlocked = FALSE;
+
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_MEMORY_ALLOC_SANITY_CHECK)
+    /* (Only worth it in read-only API calls, the others have the API to themselves) */
+    if (H5TS_rw_lock_shared(&H5_g.api_rw_lock) && !(H5F_SHARED_INTENT(f_sh) & H5F_ACC_RDWR) &&
+        NULL == f_sh->page_buf && H5F_SHARED_HAS_FEATURE(f_sh, H5FD_FEAT_CONCURRENT_READ))
+        if (H5E_pause_stack(TRUE) < 0 || H5TS_mutex_release(&H5_g.init_lock, unlocked) != 0)
+            ret_value = FAIL;
+#endif /* H5_HAVE_THREADSAFE && !H5_MEMORY_ALLOC_SANITY_CHECK */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_raw_read_begin() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_raw_read_end
+ *
+ * Purpose:	Takes back the API lock given up by
+ *		H5F_shared_raw_read_begin(), if it was.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_raw_read_end(hbool_t H5_ATTR_NDEBUG_UNUSED unlocked)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+#ifdef H5_HAVE_THREADSAFE
+    if (H5TS_mutex_reacquire(&H5_g.init_lock, unlocked) != 0)
+        ret_value = FAIL;
+    if (unlocked && H5E_pause_stack(FALSE) < 0)
+        ret_value = FAIL;
+#else  /* H5_HAVE_THREADSAFE */
+    HDassert(!unlocked);
+#endif /* H5_HAVE_THREADSAFE */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_raw_read_end() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_vector_write
+ *
+ * Purpose:	Writes COUNT contiguous blocks from memory to a
+ *		file/server/etc.  Block I is SIZES[I] bytes from BUFS[I]
+ *		and is written at address ADDRS[I].  The addresses are
+ *		relative to the base address for the file.
+ *
+ *		Raw data which bypasses the page buffer is handed to the
+ *		file driver as a single vector request; anything else is
+ *		written one block at a time through the page buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_vector_write(H5F_shared_t *f_sh, H5FD_mem_t type, size_t count, const haddr_t addrs[],
+                        const size_t sizes[], const void *bufs[])
+{
+    H5FD_mem_t map_type;            /* Mapped memory type */
+    size_t     u;                   /* Local index variable */
+    herr_t     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(H5F_SHARED_INTENT(f_sh) & H5F_ACC_RDWR);
+    HDassert(count == 0 || (addrs && sizes && bufs));
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for (u = 0; u < count; u++) {
+        HDassert(bufs[u]);
+        HDassert(H5F_addr_defined(addrs[u]));
+
+        if (H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+    } /* end for */
+
+    /* Treat global heap as raw data */
+    map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
+
+    /* Raw data goes straight to the file driver unless it's page buffered */
+    if (H5FD_MEM_DRAW == map_type && NULL == f_sh->page_buf) {
+        if (H5FD_write_vector(f_sh->lf, map_type, count, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write request failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if (H5PB_write(f_sh, map_type, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through page buffer failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_vector_write() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F_flush_tagged_metadata
  *
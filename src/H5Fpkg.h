@@ -307,6 +307,10 @@ struct H5F_shared_t {
     hbool_t              use_file_locking;  /* Whether or not to use file locking */
     hbool_t              closing;           /* File is in the process of being closed */
 
+    /* Raw data chunk cache shared by all the chunked datasets in the file */
+    size_t                    rdcc_shared_nbytes; /* Size of shared cache (bytes), 0 if not used */
+    struct H5D_rdcc_shared_t *rdcc_shared;        /* Shared cache (created by first dataset using it) */
+
     /* Cached VOL connector ID & info */
     hid_t               vol_id;   /* ID of VOL connector for the container */
     const H5VL_class_t *vol_cls;  /* Pointer to VOL connector class for the container */
@@ -358,12 +358,15 @@ typedef struct H5F_t H5F_t;
 #define H5F_RDCC_NSLOTS(F)               ((F)->shared->rdcc_nslots)
 #define H5F_RDCC_NBYTES(F)               ((F)->shared->rdcc_nbytes)
 #define H5F_RDCC_W0(F)                   ((F)->shared->rdcc_w0)
+#define H5F_RDCC_SHARED_NBYTES(F)        ((F)->shared->rdcc_shared_nbytes)
 #define H5F_SIEVE_BUF_SIZE(F)            ((F)->shared->sieve_buf_size)
 #define H5F_GC_REF(F)                    ((F)->shared->gc_ref)
 #define H5F_STORE_MSG_CRT_IDX(F)         ((F)->shared->store_msg_crt_idx)
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL) ((F)->shared->store_msg_crt_idx = (FL))
 #define H5F_GRP_BTREE_SHARED(F)          ((F)->shared->grp_btree_shared)
 #define H5F_SET_GRP_BTREE_SHARED(F, RC)  (((F)->shared->grp_btree_shared = (RC)) ? SUCCEED : FAIL)
+#define H5F_RDCC_SHARED(F)               ((F)->shared->rdcc_shared)
+#define H5F_SET_RDCC_SHARED(F, S)        ((F)->shared->rdcc_shared = (S))
 #define H5F_USE_TMP_SPACE(F)             ((F)->shared->fs.use_tmp_space)
 #define H5F_IS_TMP_ADDR(F, ADDR)         (H5F_addr_le((F)->shared->fs.tmp_addr, (ADDR)))
 #ifdef H5_HAVE_PARALLEL
@@ -421,12 +424,15 @@ typedef struct H5F_t H5F_t;
 #define H5F_RDCC_NSLOTS(F)               (H5F_rdcc_nslots(F))
 #define H5F_RDCC_NBYTES(F)               (H5F_rdcc_nbytes(F))
 #define H5F_RDCC_W0(F)                   (H5F_rdcc_w0(F))
+#define H5F_RDCC_SHARED_NBYTES(F)        (H5F_rdcc_shared_nbytes(F))
 #define H5F_SIEVE_BUF_SIZE(F)            (H5F_sieve_buf_size(F))
 #define H5F_GC_REF(F)                    (H5F_gc_ref(F))
 #define H5F_STORE_MSG_CRT_IDX(F)         (H5F_store_msg_crt_idx(F))
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL) (H5F_set_store_msg_crt_idx((F), (FL)))
 #define H5F_GRP_BTREE_SHARED(F)          (H5F_grp_btree_shared(F))
 #define H5F_SET_GRP_BTREE_SHARED(F, RC)  (H5F_set_grp_btree_shared((F), (RC)))
+#define H5F_RDCC_SHARED(F)               (H5F_rdcc_shared(F))
+#define H5F_SET_RDCC_SHARED(F, S)        (H5F_set_rdcc_shared((F), (S)))
 #define H5F_USE_TMP_SPACE(F)             (H5F_use_tmp_space(F))
 #define H5F_IS_TMP_ADDR(F, ADDR)         (H5F_is_tmp_addr((F), (ADDR)))
 #ifdef H5_HAVE_PARALLEL
@@ -557,6 +563,8 @@ typedef struct H5F_t H5F_t;
 #define H5F_ACS_DATA_CACHE_NUM_SLOTS_NAME "rdcc_nslots" /* Size of raw data chunk cache(slots) */
 #define H5F_ACS_DATA_CACHE_BYTE_SIZE_NAME "rdcc_nbytes" /* Size of raw data chunk cache(bytes) */
 #define H5F_ACS_PREEMPT_READ_CHUNKS_NAME  "rdcc_w0"     /* Preemption read chunks first */
+#define H5F_ACS_SHARED_DATA_CACHE_BYTE_SIZE_NAME                                                             \
+    "rdcc_shared_nbytes" /* Size of raw data chunk cache shared by all datasets (bytes) */
 #define H5F_ACS_ALIGN_THRHD_NAME          "threshold"   /* Threshold for alignment */
 #define H5F_ACS_ALIGN_NAME                "align"       /* Alignment */
 #define H5F_ACS_META_BLOCK_SIZE_NAME                                                                         \
@@ -755,6 +763,7 @@ typedef struct H5F_t H5F_t;
 /* Forward declarations (for prototypes & type definitions) */
 struct H5B_class_t;
 struct H5UC_t;
+struct H5D_rdcc_shared_t;
 struct H5O_loc_t;
 struct H5HG_heap_t;
 struct H5VL_class_t;
@@ -881,6 +890,7 @@ H5_DLL hbool_t            H5F_get_evict_on_close(const H5F_t *f);
 H5_DLL size_t             H5F_rdcc_nbytes(const H5F_t *f);
 H5_DLL size_t             H5F_rdcc_nslots(const H5F_t *f);
 H5_DLL double             H5F_rdcc_w0(const H5F_t *f);
+H5_DLL size_t             H5F_rdcc_shared_nbytes(const H5F_t *f);
 H5_DLL size_t             H5F_sieve_buf_size(const H5F_t *f);
 H5_DLL unsigned           H5F_gc_ref(const H5F_t *f);
 H5_DLL hbool_t            H5F_store_msg_crt_idx(const H5F_t *f);
@@ -898,6 +908,10 @@ H5_DLL hbool_t H5F_use_mdc_logging(const H5F_t *f);
 H5_DLL hbool_t H5F_start_mdc_log_on_access(const H5F_t *f);
 H5_DLL char *  H5F_mdc_log_location(const H5F_t *f);
 
+/* Functions that get/set the raw data chunk cache shared by the file's datasets */
+H5_DLL struct H5D_rdcc_shared_t *H5F_rdcc_shared(const H5F_t *f);
+H5_DLL void                      H5F_set_rdcc_shared(H5F_t *f, struct H5D_rdcc_shared_t *rdcc_shared);
+
 /* Functions that retrieve values from VFD layer */
 H5_DLL hid_t   H5F_get_driver_id(const H5F_t *f);
 H5_DLL herr_t  H5F_get_fileno(const H5F_t *f, unsigned long *filenum);
@@ -920,6 +934,12 @@ H5_DLL herr_t H5F_block_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t siz
 H5_DLL herr_t H5F_shared_block_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
                                      const void *buf);
 H5_DLL herr_t H5F_block_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t H5F_shared_vector_read(H5F_shared_t *f_sh, H5FD_mem_t type, size_t count,
+                                     const haddr_t addrs[], const size_t sizes[], void *bufs[] /*out*/);
+H5_DLL herr_t H5F_shared_vector_write(H5F_shared_t *f_sh, H5FD_mem_t type, size_t count,
+                                      const haddr_t addrs[], const size_t sizes[], const void *bufs[]);
+H5_DLL herr_t H5F_shared_raw_read_begin(const H5F_shared_t *f_sh, hbool_t *unlocked);
+H5_DLL herr_t H5F_shared_raw_read_end(hbool_t unlocked);
 
 /* Functions that flush or evict */
 H5_DLL herr_t H5F_flush_tagged_metadata(H5F_t *f, haddr_t tag);
@@ -257,6 +257,8 @@ H5_DLL herr_t   H5Fget_mdc_hit_rate(hid_t file_id, double *hit_rate_ptr);
 H5_DLL herr_t   H5Fget_mdc_size(hid_t file_id, size_t *max_size_ptr, size_t *min_clean_size_ptr,
                                 size_t *cur_size_ptr, int *cur_num_entries_ptr);
 H5_DLL herr_t   H5Freset_mdc_hit_rate_stats(hid_t file_id);
+H5_DLL herr_t   H5Fget_shared_chunk_cache_stats(hid_t file_id, size_t *cur_size, hsize_t *nhits,
+                                                hsize_t *nmisses);
 H5_DLL ssize_t  H5Fget_name(hid_t obj_id, char *name, size_t size);
 H5_DLL herr_t   H5Fget_info2(hid_t obj_id, H5F_info2_t *finfo);
 H5_DLL herr_t   H5Fget_metadata_read_retry_info(hid_t file_id, H5F_retry_info_t *info);
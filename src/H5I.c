@@ -39,25 +39,74 @@
 #include "H5Ipkg.h"      /* IDs                                      */
 #include "H5MMprivate.h" /* Memory management                        */
 #include "H5Oprivate.h"  /* Object headers                           */
-#include "H5SLprivate.h" /* Skip Lists                               */
 #include "H5Tpkg.h"      /* Datatypes                                */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
 /* Local Macros */
 
+/* Where the thread-safe library can free memory only once no thread may still
+ * be reading it (see H5TS_epoch_enter), IDs are looked up without the API lock
+ * in the few API routines that only need to know whether an ID exists.  Those
+ * lookups read the type list, the tables of IDs and the IDs' reference counts
+ * and object pointers while other threads change them, so changes to them are
+ * made with atomic operations, and memory they use is retired rather than
+ * freed.
+ */
+#ifdef H5TS_HAVE_EPOCHS
+#define H5I_LOCKFREE
+#define H5I_LOAD(var)       H5TS_atomic_load(&(var))
+#define H5I_STORE(var, val) H5TS_atomic_store(&(var), val)
+#define H5I_INC(var)        ((void)H5TS_atomic_fetch_add(&(var), 1))
+#define H5I_DEC(var)        ((void)H5TS_atomic_fetch_sub(&(var), 1))
+#else /* H5TS_HAVE_EPOCHS */
+#define H5I_LOAD(var)       (var)
+#define H5I_STORE(var, val) ((var) = (val))
+#define H5I_INC(var)        (++(var))
+#define H5I_DEC(var)        (--(var))
+#endif /* H5TS_HAVE_EPOCHS */
+
 /* Combine a Type number and an atom index into an atom */
 #define H5I_MAKE(g, i) ((((hid_t)(g)&TYPE_MASK) << ID_BITS) | ((hid_t)(i)&ID_MASK))
 
+/* Size of a table of IDs with N slots */
+#define H5I_IDS_SIZE(n) (sizeof(H5I_ids_t) + (n) * sizeof(H5I_id_info_t *))
+
+/* Minimum number of slots in the table of IDs for a type (a power of 2) */
+#define H5I_IDS_MIN_SLOTS 64
+
+/* Slot where the search for an atom starts, in a table of IDs with N slots.
+ * IDs are handed out in sequence, so the atom's index spreads them well.
+ */
+#define H5I_IDS_SLOT(a, n) ((size_t)((a)&ID_MASK) & ((n)-1))
+
+/* Marker for the slot of a removed atom, in a table of IDs */
+#define H5I_REMOVED_ID (&H5I_removed_id_g)
+
 /* Local typedefs */
 
 /* Atom information structure used */
 typedef struct H5I_id_info_t {
-    hid_t       id;        /* ID for this info                */
-    unsigned    count;     /* ref. count for this atom            */
-    unsigned    app_count; /* ref. count of application visible atoms  */
-    const void *obj_ptr;   /* pointer associated with the atom        */
+    hid_t                 id;        /* ID for this info                */
+    unsigned              count;     /* ref. count for this atom            */
+    unsigned              app_count; /* ref. count of application visible atoms  */
+    const void *          obj_ptr;   /* pointer associated with the atom        */
+    struct H5I_id_info_t *prev;      /* Previous ID added to the type           */
+    struct H5I_id_info_t *next;      /* Next ID added to the type               */
 } H5I_id_info_t;
 
+/* Hash table (open addressing) of the IDs in a type */
+typedef struct H5I_ids_t {
+    size_t         nslots;  /* # of slots in the table (a power of 2)   */
+    H5I_id_info_t *slots[]; /* IDs, removed IDs or NULL for empty slots */
+} H5I_ids_t;
+
+/* Position of an iteration over the IDs in a type */
+typedef struct H5I_ids_cursor_t {
+    H5I_id_info_t *          next;  /* Next ID to visit (NULL when done)      */
+    H5I_id_info_t *          last;  /* Last ID to visit                       */
+    struct H5I_ids_cursor_t *outer; /* Iteration this one is nested in        */
+} H5I_ids_cursor_t;
+
 /* ID type structure used */
 typedef struct {
     const H5I_class_t *cls;        /* Pointer to ID class                      */
@@ -65,9 +114,16 @@ typedef struct {
     uint64_t           id_count;   /* Current number of IDs held            */
     uint64_t           nextid;     /* ID to use for the next atom            */
     H5I_id_info_t *    last_info;  /* Info for most recent ID looked up        */
-    H5SL_t *           ids;        /* Pointer to skip list that stores IDs     */
+    H5I_ids_t *        ids;        /* Table of IDs                             */
+    size_t             nused;      /* # of slots for IDs or removed IDs        */
+    H5I_id_info_t *    first;      /* First of the IDs, in the order added     */
+    H5I_id_info_t *    last;       /* Last of the IDs, in the order added      */
+    H5I_ids_cursor_t * cursors;    /* Iterations over the IDs in progress      */
 } H5I_id_type_t;
 
+/* Callback for each ID in a type */
+typedef int (*H5I_ids_op_t)(H5I_id_info_t *info, void *udata);
+
 typedef struct {
     H5I_search_func_t app_cb;  /* Application's callback routine */
     void *            app_key; /* Application's "key" (user data) */
@@ -117,6 +173,9 @@ static H5I_id_type_t *H5I_id_type_list_g[H5I_MAX_NUM_TYPES];
 /* and/or increase size of hid_t */
 static int H5I_next_type = (int)H5I_NTYPES;
 
+/* Stand-in for removed IDs in the types' tables of IDs */
+static H5I_id_info_t H5I_removed_id_g;
+
 /* Declare a free list to manage the H5I_id_info_t struct */
 H5FL_DEFINE_STATIC(H5I_id_info_t);
 
@@ -129,8 +188,21 @@ H5FL_DEFINE_STATIC(H5I_class_t);
 H5FL_EXTERN(H5VL_object_t);
 
 /*--------------------- Local function prototypes ---------------------------*/
+static void           H5I__free_info(H5I_id_info_t *info);
+static void           H5I__free_table(H5I_ids_t *ids);
+static void           H5I__free_type(H5I_id_type_t *type_ptr);
+#ifdef H5I_LOCKFREE
+static void           H5I__free_info_cb(void *info);
+static void           H5I__free_table_cb(void *ids);
+static void           H5I__free_type_cb(void *type_ptr);
+#endif /* H5I_LOCKFREE */
+static herr_t         H5I__ids_resize(H5I_id_type_t *type_ptr, size_t nslots);
+static herr_t         H5I__ids_insert(H5I_id_type_t *type_ptr, H5I_id_info_t *info);
+static H5I_id_info_t *H5I__ids_search(const H5I_id_type_t *type_ptr, hid_t id);
+static H5I_id_info_t *H5I__ids_remove(H5I_id_type_t *type_ptr, hid_t id);
+static int            H5I__ids_iterate(H5I_id_type_t *type_ptr, H5I_ids_op_t op, void *udata);
 static void *         H5I__unwrap(void *obj_ptr, H5I_type_t type);
-static htri_t         H5I__clear_type_cb(void *_id, void *key, void *udata);
+static int            H5I__clear_type_cb(H5I_id_info_t *info, void *udata);
 static int            H5I__destroy_type(H5I_type_t type);
 static void *         H5I__remove_verify(hid_t id, H5I_type_t id_type);
 static void *         H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id);
@@ -138,9 +210,11 @@ static int            H5I__inc_type_ref(H5I_type_t type);
 static int            H5I__get_type_ref(H5I_type_t type);
 static int            H5I__search_cb(void *obj, hid_t id, void *_udata);
 static H5I_id_info_t *H5I__find_id(hid_t id);
+static H5I_id_info_t *H5I__find_id_nolock(hid_t id);
 static int            H5I__iterate_pub_cb(void *obj, hid_t id, void *udata);
-static int            H5I__find_id_cb(void *_item, void *_key, void *_udata);
-static int            H5I__id_dump_cb(void *_item, void *_key, void *_udata);
+static int            H5I__iterate_cb(H5I_id_info_t *info, void *_udata);
+static int            H5I__find_id_cb(H5I_id_info_t *info, void *_udata);
+static int            H5I__id_dump_cb(H5I_id_info_t *info, void *_udata);
 
 /*-------------------------------------------------------------------------
  * Function:    H5I_term_package
@@ -178,12 +252,17 @@ H5I_term_package(void)
                 type_ptr = H5I_id_type_list_g[type];
                 if (type_ptr) {
                     HDassert(NULL == type_ptr->ids);
-                    type_ptr                 = H5FL_FREE(H5I_id_type_t, type_ptr);
-                    H5I_id_type_list_g[type] = NULL;
+                    H5I_STORE(H5I_id_type_list_g[type], NULL);
+                    H5I__free_type(type_ptr);
                     n++;
                 } /* end if */
             }     /* end for */
 
+#ifdef H5I_LOCKFREE
+            /* Free what's been retired, as far as lookups allow */
+            H5TS_epoch_reclaim();
+#endif /* H5I_LOCKFREE */
+
             /* Mark interface closed */
             if (0 == n)
                 H5_PKG_INIT_VAR = FALSE;
@@ -193,6 +272,437 @@ H5I_term_package(void)
     FUNC_LEAVE_NOAPI(n)
 } /* end H5I_term_package() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5I__free_info
+ *
+ * Purpose:     Free the info struct of an ID that's been removed from its
+ *              type, once no lookup without the API lock can still see it.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__free_info(H5I_id_info_t *info)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(info);
+
+#ifdef H5I_LOCKFREE
+    /* Lookups that still find the ID see that it's gone */
+    H5I_STORE(info->app_count, 0);
+    H5I_STORE(info->obj_ptr, NULL);
+
+    H5TS_epoch_retire(info, H5I__free_info_cb);
+#else  /* H5I_LOCKFREE */
+    info = H5FL_FREE(H5I_id_info_t, info);
+#endif /* H5I_LOCKFREE */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__free_info() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__free_table
+ *
+ * Purpose:     Free a table of IDs that's been replaced or dropped, once no
+ *              lookup without the API lock can still see it.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__free_table(H5I_ids_t *ids)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(ids);
+
+#ifdef H5I_LOCKFREE
+    H5TS_epoch_retire(ids, H5I__free_table_cb);
+#else  /* H5I_LOCKFREE */
+    H5MM_xfree(ids);
+#endif /* H5I_LOCKFREE */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__free_table() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__free_type
+ *
+ * Purpose:     Free an ID type that's been dropped from the list of types,
+ *              once no lookup without the API lock can still see it.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__free_type(H5I_id_type_t *type_ptr)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+
+#ifdef H5I_LOCKFREE
+    H5TS_epoch_retire(type_ptr, H5I__free_type_cb);
+#else  /* H5I_LOCKFREE */
+    type_ptr = H5FL_FREE(H5I_id_type_t, type_ptr);
+#endif /* H5I_LOCKFREE */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__free_type() */
+
+#ifdef H5I_LOCKFREE
+/*-------------------------------------------------------------------------
+ * Function:    H5I__free_info_cb
+ *
+ * Purpose:     Callback routine for freeing a retired ID info struct
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__free_info_cb(void *info)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    info = H5FL_FREE(H5I_id_info_t, info);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__free_info_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__free_table_cb
+ *
+ * Purpose:     Callback routine for freeing a retired table of IDs
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__free_table_cb(void *ids)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    H5MM_xfree(ids);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__free_table_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__free_type_cb
+ *
+ * Purpose:     Callback routine for freeing a retired ID type
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__free_type_cb(void *type_ptr)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    type_ptr = H5FL_FREE(H5I_id_type_t, type_ptr);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__free_type_cb() */
+#endif /* H5I_LOCKFREE */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__ids_resize
+ *
+ * Purpose:     Rebuild a type's table of IDs with a new number of slots,
+ *              dropping the slots of removed IDs.  Creates the table if
+ *              the type doesn't have one yet.
+ *
+ * Return:      SUCCEED/FAIL (no error is pushed, so callers can decide
+ *              whether a failure matters)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__ids_resize(H5I_id_type_t *type_ptr, size_t nslots)
+{
+    H5I_ids_t *old_ids = type_ptr->ids;  /* Current table of IDs */
+    H5I_ids_t *ids;                      /* New table of IDs */
+    size_t     u;                        /* Local index variable */
+    herr_t     ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(type_ptr);
+    HDassert(nslots >= H5I_IDS_MIN_SLOTS && POWER_OF_TWO(nslots));
+    HDassert(type_ptr->id_count < nslots);
+
+    if (NULL == (ids = (H5I_ids_t *)H5MM_calloc(H5I_IDS_SIZE(nslots))))
+        HGOTO_DONE(FAIL)
+    ids->nslots = nslots;
+
+    /* Copy the IDs to the new table */
+    if (old_ids)
+        for (u = 0; u < old_ids->nslots; u++) {
+            H5I_id_info_t *info = old_ids->slots[u]; /* ID in the slot */
+
+            if (info != NULL && info != H5I_REMOVED_ID) {
+                size_t v = H5I_IDS_SLOT(info->id, nslots); /* Slot for the ID in the new table */
+
+                while (ids->slots[v] != NULL)
+                    v = (v + 1) & (nslots - 1);
+                ids->slots[v] = info;
+            } /* end if */
+        }     /* end for */
+
+    /* Switch to the new table (lookups may still be reading the old one) */
+    H5I_STORE(type_ptr->ids, ids);
+    type_ptr->nused = (size_t)type_ptr->id_count;
+    if (old_ids)
+        H5I__free_table(old_ids);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__ids_resize() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__ids_insert
+ *
+ * Purpose:     Add an ID to its type's table of IDs, growing the table
+ *              when needed.  The ID must not be in the table already.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__ids_insert(H5I_id_type_t *type_ptr, H5I_id_info_t *info)
+{
+    H5I_ids_t *ids;                 /* Table of IDs */
+    size_t     u;                   /* Slot for the ID */
+    herr_t     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(type_ptr);
+    HDassert(info);
+    HDassert(NULL == H5I__ids_search(type_ptr, info->id));
+
+    /* Rebuild the table once IDs and removed IDs fill 3/4 of it, leaving
+     * it no more than half full of IDs.
+     */
+    if ((type_ptr->nused + 1) * 4 > type_ptr->ids->nslots * 3) {
+        size_t nslots = H5I_IDS_MIN_SLOTS; /* # of slots in the new table */
+
+        while (nslots < (size_t)(type_ptr->id_count + 1) * 2)
+            nslots *= 2;
+        if (H5I__ids_resize(type_ptr, nslots) < 0)
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "can't grow table of IDs")
+    } /* end if */
+
+    /* Use the first slot that's empty or has a removed ID */
+    ids = type_ptr->ids;
+    u   = H5I_IDS_SLOT(info->id, ids->nslots);
+    while (ids->slots[u] != NULL && ids->slots[u] != H5I_REMOVED_ID)
+        u = (u + 1) & (ids->nslots - 1);
+    if (ids->slots[u] == NULL)
+        type_ptr->nused++;
+    H5I_STORE(ids->slots[u], info);
+
+    /* Add the ID to the end of the type's list */
+    info->prev = type_ptr->last;
+    info->next = NULL;
+    if (type_ptr->last)
+        type_ptr->last->next = info;
+    else
+        type_ptr->first = info;
+    type_ptr->last = info;
+
+    type_ptr->id_count++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__ids_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__ids_search
+ *
+ * Purpose:     Look up an ID in its type's table of IDs.
+ *
+ * Return:      Success:    A pointer to the ID's info struct
+ *              Failure:    NULL (the ID isn't in the table)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__ids_search(const H5I_id_type_t *type_ptr, hid_t id)
+{
+    const H5I_ids_t *ids;              /* Table of IDs */
+    H5I_id_info_t *  info;             /* ID in the current slot */
+    size_t           u;                /* Current slot */
+    H5I_id_info_t *  ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+
+    /* Probe from the ID's slot up to the next empty one */
+    ids = type_ptr->ids;
+    u   = H5I_IDS_SLOT(id, ids->nslots);
+    while (NULL != (info = ids->slots[u])) {
+        if (info != H5I_REMOVED_ID && info->id == id) {
+            ret_value = info;
+            break;
+        } /* end if */
+        u = (u + 1) & (ids->nslots - 1);
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__ids_search() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__ids_remove
+ *
+ * Purpose:     Remove an ID from its type's table of IDs, shrinking the
+ *              table when few IDs are left in it.
+ *
+ * Return:      Success:    A pointer to the removed ID's info struct
+ *              Failure:    NULL (the ID isn't in the table)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__ids_remove(H5I_id_type_t *type_ptr, hid_t id)
+{
+    H5I_ids_t *       ids;              /* Table of IDs */
+    H5I_id_info_t *   info;             /* ID in the current slot */
+    H5I_ids_cursor_t *cursor;           /* Iteration over the IDs */
+    size_t            mask;             /* Mask for slot numbers */
+    size_t            u;                /* Current slot */
+    H5I_id_info_t *   ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+
+    /* Locate the ID's slot */
+    ids  = type_ptr->ids;
+    mask = ids->nslots - 1;
+    u    = H5I_IDS_SLOT(id, ids->nslots);
+    while (NULL != (info = ids->slots[u])) {
+        if (info != H5I_REMOVED_ID && info->id == id)
+            break;
+        u = (u + 1) & mask;
+    } /* end while */
+
+    if (info != NULL) {
+        /* The slot (and any removed IDs before it) can be emptied when it
+         * ends a run of slots, otherwise searches for IDs past it must
+         * still probe through it.
+         */
+        if (NULL == ids->slots[(u + 1) & mask])
+            do {
+                H5I_STORE(ids->slots[u], NULL);
+                type_ptr->nused--;
+                u = (u - 1) & mask;
+            } while (ids->slots[u] == H5I_REMOVED_ID);
+        else
+            H5I_STORE(ids->slots[u], H5I_REMOVED_ID);
+
+        /* Move iterations that were about to visit the ID past it */
+        for (cursor = type_ptr->cursors; cursor; cursor = cursor->outer) {
+            if (cursor->next == info)
+                cursor->next = (info == cursor->last ? NULL : info->next);
+            if (cursor->last == info)
+                cursor->last = info->prev;
+        } /* end for */
+
+        /* Take the ID out of the type's list */
+        if (info->prev)
+            info->prev->next = info->next;
+        else
+            type_ptr->first = info->next;
+        if (info->next)
+            info->next->prev = info->prev;
+        else
+            type_ptr->last = info->prev;
+
+        type_ptr->id_count--;
+
+        /* Shrink the table once it's less than 1/8 full of IDs (if that
+         * fails, the larger table is still fine)
+         */
+        if (ids->nslots > H5I_IDS_MIN_SLOTS && (size_t)type_ptr->id_count * 8 < ids->nslots) {
+            size_t nslots = H5I_IDS_MIN_SLOTS; /* # of slots in the new table */
+
+            while (nslots < (size_t)type_ptr->id_count * 4)
+                nslots *= 2;
+            (void)H5I__ids_resize(type_ptr, nslots);
+        } /* end if */
+
+        ret_value = info;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__ids_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__ids_iterate
+ *
+ * Purpose:     Make a callback for each ID in a type, in the order the IDs
+ *              were added, stopping when a callback returns non-zero.
+ *
+ *              Callbacks may add or remove IDs in the type (IDs added
+ *              aren't visited, IDs removed before they're reached are
+ *              skipped).
+ *
+ * Return:      Success:    Last callback's return value (H5_ITER_CONT if
+ *                          there are no IDs)
+ *              Failure:    H5_ITER_ERROR
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5I__ids_iterate(H5I_id_type_t *type_ptr, H5I_ids_op_t op, void *udata)
+{
+    H5I_ids_cursor_t cursor;                   /* Position of this iteration */
+    int              ret_value = H5_ITER_CONT; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(type_ptr);
+    HDassert(op);
+
+    if (type_ptr->first) {
+        /* Let H5I__ids_remove() move the iteration past IDs it removes */
+        cursor.next       = type_ptr->first;
+        cursor.last       = type_ptr->last;
+        cursor.outer      = type_ptr->cursors;
+        type_ptr->cursors = &cursor;
+
+        while (cursor.next && H5_ITER_CONT == ret_value) {
+            H5I_id_info_t *info = cursor.next; /* ID to visit */
+
+            cursor.next = (info == cursor.last ? NULL : info->next);
+            ret_value   = (op)(info, udata);
+        } /* end while */
+
+        type_ptr->cursors = cursor.outer;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__ids_iterate() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Iregister_type
  *
@@ -300,7 +810,7 @@ H5I_register_type(const H5I_class_t *cls)
         /* Allocate the type information for new type */
         if (NULL == (type_ptr = (H5I_id_type_t *)H5FL_CALLOC(H5I_id_type_t)))
             HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "ID type allocation failed")
-        H5I_id_type_list_g[cls->type_id] = type_ptr;
+        H5I_STORE(H5I_id_type_list_g[cls->type_id], type_ptr);
     } /* end if */
     else {
         /* Get the pointer to the existing type */
@@ -313,8 +823,8 @@ H5I_register_type(const H5I_class_t *cls)
         type_ptr->id_count  = 0;
         type_ptr->nextid    = cls->reserved;
         type_ptr->last_info = NULL;
-        if (NULL == (type_ptr->ids = H5SL_create(H5SL_TYPE_HID, NULL)))
-            HGOTO_ERROR(H5E_ATOM, H5E_CANTCREATE, FAIL, "skip list creation failed")
+        if (H5I__ids_resize(type_ptr, (size_t)H5I_IDS_MIN_SLOTS) < 0)
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTCREATE, FAIL, "table of IDs creation failed")
     } /* end if */
 
     /* Increment the count of the times this type has been initialized */
@@ -323,9 +833,10 @@ H5I_register_type(const H5I_class_t *cls)
 done:
     if (ret_value < 0) { /* Clean up on error */
         if (type_ptr) {
+            H5I_STORE(H5I_id_type_list_g[cls->type_id], NULL);
             if (type_ptr->ids)
-                H5SL_close(type_ptr->ids);
-            (void)H5FL_FREE(H5I_id_type_t, type_ptr);
+                H5I__free_table(type_ptr->ids);
+            H5I__free_type(type_ptr);
         } /* end if */
     }     /* end if */
 
@@ -557,7 +1068,7 @@ H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
     udata.app_ref = app_ref;
 
     /* Attempt to free all ids in the type */
-    if (H5SL_try_free_safe(udata.type_ptr->ids, H5I__clear_type_cb, &udata) < 0)
+    if (H5I__ids_iterate(udata.type_ptr, H5I__clear_type_cb, &udata) < 0)
         HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, FAIL, "can't free ids in type")
 
 done:
@@ -570,19 +1081,18 @@ done:
  * Purpose:     Attempts to free the specified ID, calling the free
  *              function for the object.
  *
- * Return:      TRUE/FALSE/FAIL
+ * Return:      H5_ITER_CONT (always)
  *
  * Programmer:  Neil Fortner
  *              Friday, July 10, 2015
  *
  *-------------------------------------------------------------------------
  */
-static htri_t
-H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
+static int
+H5I__clear_type_cb(H5I_id_info_t *id, void *_udata)
 {
-    H5I_id_info_t *      id        = (H5I_id_info_t *)_id;          /* Current ID being worked with */
     H5I_clear_type_ud_t *udata     = (H5I_clear_type_ud_t *)_udata; /* udata struct */
-    htri_t               ret_value = FALSE;                         /* Return value */
+    hbool_t              remove_id = FALSE;                         /* Whether to remove the ID */
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -609,25 +1119,27 @@ H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
 #endif            /*H5I_DEBUG*/
 
                 /* Indicate node should be removed from list */
-                ret_value = TRUE;
+                remove_id = TRUE;
             } /* end if */
         }     /* end if */
         else {
             /* Indicate node should be removed from list */
-            ret_value = TRUE;
+            remove_id = TRUE;
         } /* end else */
 
         /* Remove ID if requested */
-        if (ret_value) {
-            /* Free ID info */
-            id = H5FL_FREE(H5I_id_info_t, id);
-
-            /* Decrement the number of IDs in the type */
-            udata->type_ptr->id_count--;
+        if (remove_id) {
+            /* Check if this ID was the last one accessed */
+            if (udata->type_ptr->last_info == id)
+                udata->type_ptr->last_info = NULL;
+
+            /* Remove the ID from the type & free ID info */
+            (void)H5I__ids_remove(udata->type_ptr, id->id);
+            H5I__free_info(id);
         } /* end if */
     }     /* end if */
 
-    FUNC_LEAVE_NOAPI(ret_value)
+    FUNC_LEAVE_NOAPI(H5_ITER_CONT)
 } /* end H5I__clear_type_cb() */
 
 /*-------------------------------------------------------------------------
@@ -702,12 +1214,9 @@ H5I__destroy_type(H5I_type_t type)
         if (type_ptr->cls->flags & H5I_CLASS_IS_APPLICATION)
             type_ptr->cls = H5FL_FREE(H5I_class_t, (void *)type_ptr->cls);
 
-    if (H5SL_close(type_ptr->ids) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTCLOSEOBJ, FAIL, "can't close skip list")
-    type_ptr->ids = NULL;
-
-    type_ptr                 = H5FL_FREE(H5I_id_type_t, type_ptr);
-    H5I_id_type_list_g[type] = NULL;
+    H5I_STORE(H5I_id_type_list_g[type], NULL);
+    H5I__free_table(type_ptr->ids);
+    H5I__free_type(type_ptr);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -783,9 +1292,8 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
     id_ptr->obj_ptr   = object;
 
     /* Insert into the type */
-    if (H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into skip list")
-    type_ptr->id_count++;
+    if (H5I__ids_insert(type_ptr, id_ptr) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID into type")
     type_ptr->nextid++;
 
     /* Sanity check for the 'nextid' getting too large and wrapping around */
@@ -860,9 +1368,8 @@ H5I_register_using_existing_id(H5I_type_t type, void *object, hbool_t app_ref, h
     id_ptr->obj_ptr   = object;
 
     /* Insert into the type */
-    if (H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into skip list")
-    type_ptr->id_count++;
+    if (H5I__ids_insert(type_ptr, id_ptr) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID into type")
 
     /* Set the most recent ID to this object */
     type_ptr->last_info = id_ptr;
@@ -901,7 +1408,7 @@ H5I_subst(hid_t id, const void *new_object)
     ret_value = (void *)id_ptr->obj_ptr; /* (Casting away const OK -QAK) */
 
     /* Set the new object pointer for the ID */
-    id_ptr->obj_ptr = new_object;
+    H5I_STORE(id_ptr->obj_ptr, new_object);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1044,6 +1551,10 @@ H5I_get_type(hid_t id)
  *              object which currently exists because the type number is
  *              encoded as part of the ID.
  *
+ *              Like H5Iis_valid(), this routine only looks the ID up
+ *              (without the API lock, where the library allows it): it
+ *              neither clears the error stack nor pushes an error on it.
+ *
  * Return:      Success:    A positive integer (corresponding to an H5I_type_t
  *                          enum value for library ID types, but not for user
  *                          ID types).
@@ -1054,18 +1565,17 @@ H5I_get_type(hid_t id)
 H5I_type_t
 H5Iget_type(hid_t id)
 {
-    H5I_type_t ret_value = H5I_BADID; /* Return value */
+    H5I_id_info_t *id_ptr;                /* ptr to the ID */
+    H5I_type_t     ret_value = H5I_BADID; /* Return value */
 
-    FUNC_ENTER_API(H5I_BADID)
+    FUNC_ENTER_API_NOLOCK(H5I_BADID)
     H5TRACE1("It", "i", id);
 
-    ret_value = H5I_get_type(id);
-
-    if (ret_value <= H5I_BADID || (int)ret_value >= H5I_next_type || NULL == H5I_object(id))
-        HGOTO_DONE(H5I_BADID);
+    /* Find the ID (which must have an object) */
+    if (NULL != (id_ptr = H5I__find_id_nolock(id)) && NULL != H5I_LOAD(id_ptr->obj_ptr))
+        ret_value = H5I_TYPE(id);
 
-done:
-    FUNC_LEAVE_API(ret_value)
+    FUNC_LEAVE_API_NOLOCK(ret_value)
 } /* end H5Iget_type() */
 
 /*-------------------------------------------------------------------------
@@ -1210,18 +1720,15 @@ H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id)
     HDassert(type_ptr);
 
     /* Get the ID node for the ID */
-    if (NULL == (curr_id = (H5I_id_info_t *)H5SL_remove(type_ptr->ids, &id)))
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node from skip list")
+    if (NULL == (curr_id = H5I__ids_remove(type_ptr, id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID from type")
 
     /* Check if this ID was the last one accessed */
     if (type_ptr->last_info == curr_id)
         type_ptr->last_info = NULL;
 
     ret_value = (void *)curr_id->obj_ptr; /* (Casting away const OK -QAK) */
-    curr_id   = H5FL_FREE(H5I_id_info_t, curr_id);
-
-    /* Decrement the number of IDs in the type */
-    (type_ptr->id_count)--;
+    H5I__free_info(curr_id);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1362,7 +1869,7 @@ H5I_dec_ref(hid_t id)
             ret_value = -1;
     } /* end if */
     else {
-        --(id_ptr->count);
+        H5I_DEC(id_ptr->count);
         ret_value = (int)id_ptr->count;
     } /* end else */
 
@@ -1406,7 +1913,7 @@ H5I_dec_app_ref(hid_t id)
             HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, (-1), "can't locate ID")
 
         /* Adjust app_ref */
-        --(id_ptr->app_count);
+        H5I_DEC(id_ptr->app_count);
         HDassert(id_ptr->count >= id_ptr->app_count);
 
         /* Set return value */
@@ -1514,9 +2021,9 @@ H5I_inc_ref(hid_t id, hbool_t app_ref)
         HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, (-1), "can't locate ID")
 
     /* Adjust reference counts */
-    ++(id_ptr->count);
+    H5I_INC(id_ptr->count);
     if (app_ref)
-        ++(id_ptr->app_count);
+        H5I_INC(id_ptr->app_count);
 
     /* Set return value */
     ret_value = (int)(app_ref ? id_ptr->app_count : id_ptr->count);
@@ -1817,6 +2324,9 @@ done:
  * Purpose:     Check if the given id is valid.  An id is valid if it is in
  *              use and has an application reference count of at least 1.
  *
+ *              The error stack is left as it is: it's neither cleared nor
+ *              pushed on, for invalid IDs either.
+ *
  * Return:      TRUE/FALSE/FAIL
  *
  *-------------------------------------------------------------------------
@@ -1827,17 +2337,16 @@ H5Iis_valid(hid_t id)
     H5I_id_info_t *id_ptr;           /* ptr to the ID */
     htri_t         ret_value = TRUE; /* Return value */
 
-    FUNC_ENTER_API(FAIL)
+    FUNC_ENTER_API_NOLOCK(FAIL)
     H5TRACE1("t", "i", id);
 
     /* Find the ID */
-    if (NULL == (id_ptr = H5I__find_id(id)))
+    if (NULL == (id_ptr = H5I__find_id_nolock(id)))
         ret_value = FALSE;
-    else if (!id_ptr->app_count) /* Check if the found id is an internal id */
+    else if (!H5I_LOAD(id_ptr->app_count)) /* Check if the found id is an internal id */
         ret_value = FALSE;
 
-done:
-    FUNC_LEAVE_API(ret_value)
+    FUNC_LEAVE_API_NOLOCK(ret_value)
 } /* end H5Iis_valid() */
 
 /*-------------------------------------------------------------------------
@@ -2022,9 +2531,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__iterate_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__iterate_cb(H5I_id_info_t *item, void *_udata)
 {
-    H5I_id_info_t *   item      = (H5I_id_info_t *)_item;     /* Pointer to the ID node */
     H5I_iterate_ud_t *udata     = (H5I_iterate_ud_t *)_udata; /* User data for callback */
     int               ret_value = H5_ITER_CONT;               /* Callback return value */
 
@@ -2107,7 +2615,7 @@ H5I_iterate(H5I_type_t type, H5I_search_func_t func, void *udata, hbool_t app_re
         iter_udata.obj_type   = type;
 
         /* Iterate over IDs */
-        if ((iter_status = H5SL_iterate(type_ptr->ids, H5I__iterate_cb, &iter_udata)) < 0)
+        if ((iter_status = H5I__ids_iterate(type_ptr, H5I__iterate_cb, &iter_udata)) < 0)
             HGOTO_ERROR(H5E_ATOM, H5E_BADITER, FAIL, "iteration failed")
     } /* end if */
 
@@ -2149,7 +2657,7 @@ H5I__find_id(hid_t id)
         ret_value = type_ptr->last_info;
     else {
         /* Locate the ID node for the ID */
-        ret_value = (H5I_id_info_t *)H5SL_search(type_ptr->ids, &id);
+        ret_value = H5I__ids_search(type_ptr, id);
 
         /* Remember this ID */
         type_ptr->last_info = ret_value;
@@ -2159,6 +2667,60 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I__find_id() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5I__find_id_nolock
+ *
+ * Purpose:     Given an object ID find the info struct that describes the
+ *              object, without holding the API lock.
+ *
+ *              In thread-safe builds, this must be called between
+ *              H5TS_epoch_enter() and H5TS_epoch_exit() (as done by
+ *              FUNC_ENTER_API_NOLOCK), and the info struct must only be
+ *              used until then.  Its app_count and obj_ptr fields must be
+ *              read with H5I_LOAD; both are reset when the ID is removed.
+ *
+ * Return:      Success:    A pointer to the object's info struct.
+ *
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__find_id_nolock(hid_t id)
+{
+    H5I_type_t       type;             /* ID's type */
+    H5I_id_type_t *  type_ptr;         /* Pointer to the type */
+    const H5I_ids_t *ids;              /* Table of IDs */
+    H5I_id_info_t *  info;             /* ID in the current slot */
+    size_t           u;                /* Current slot */
+    H5I_id_info_t *  ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check arguments (types that were never registered have no entry) */
+    type = H5I_TYPE(id);
+    if (type <= H5I_BADID || (int)type >= H5I_MAX_NUM_TYPES)
+        HGOTO_DONE(NULL)
+    if (NULL == (type_ptr = H5I_LOAD(H5I_id_type_list_g[type])))
+        HGOTO_DONE(NULL)
+    if (NULL == (ids = H5I_LOAD(type_ptr->ids)))
+        HGOTO_DONE(NULL)
+
+    /* Probe from the ID's slot up to the next empty one, as in
+     * H5I__ids_search(), but without remembering the ID for next time */
+    u = H5I_IDS_SLOT(id, ids->nslots);
+    while (NULL != (info = H5I_LOAD(ids->slots[u]))) {
+        if (info != H5I_REMOVED_ID && info->id == id) {
+            ret_value = info;
+            break;
+        } /* end if */
+        u = (u + 1) & (ids->nslots - 1);
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__find_id_nolock() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Iget_name
  *
@@ -2265,9 +2827,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__find_id_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__find_id_cb(H5I_id_info_t *item, void *_udata)
 {
-    H5I_id_info_t *  item      = (H5I_id_info_t *)_item;    /* Pointer to the ID node */
     H5I_get_id_ud_t *udata     = (H5I_get_id_ud_t *)_udata; /* Pointer to user data */
     H5I_type_t       type      = udata->obj_type;
     const void *     obj_ptr   = NULL;
@@ -2329,7 +2890,7 @@ H5I_find_id(const void *object, H5I_type_t type, hid_t *id)
         udata.ret_id   = H5I_INVALID_HID;
 
         /* Iterate over IDs for the ID type */
-        if ((iter_status = H5SL_iterate(type_ptr->ids, H5I__find_id_cb, &udata)) < 0)
+        if ((iter_status = H5I__ids_iterate(type_ptr, H5I__find_id_cb, &udata)) < 0)
             HGOTO_ERROR(H5E_ATOM, H5E_BADITER, FAIL, "iteration failed")
 
         *id = udata.ret_id;
@@ -2349,12 +2910,11 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__id_dump_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__id_dump_cb(H5I_id_info_t *item, void *_udata)
 {
-    H5I_id_info_t *item    = (H5I_id_info_t *)_item; /* Pointer to the ID node */
-    H5I_type_t     type    = *(H5I_type_t *)_udata;  /* User data */
-    H5G_name_t *   path    = NULL;                   /* Path to file object */
-    const void *   obj_ptr = NULL;                   /* Pointer to VOL connector object */
+    H5I_type_t  type    = *(H5I_type_t *)_udata; /* User data */
+    H5G_name_t *path    = NULL;                  /* Path to file object */
+    const void *obj_ptr = NULL;                  /* Pointer to VOL connector object */
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -2453,7 +3013,7 @@ H5I_dump_ids_for_type(H5I_type_t type)
         /* List */
         if (type_ptr->id_count > 0) {
             HDfprintf(stderr, "     List:\n");
-            H5SL_iterate(type_ptr->ids, H5I__id_dump_cb, &type);
+            (void)H5I__ids_iterate(type_ptr, H5I__id_dump_cb, &type);
         }
     }
     else
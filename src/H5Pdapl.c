@@ -98,6 +98,11 @@
 #define H5D_ACS_EFILE_PREFIX_COPY  H5P__dapl_efile_pref_copy
 #define H5D_ACS_EFILE_PREFIX_CMP   H5P__dapl_efile_pref_cmp
 #define H5D_ACS_EFILE_PREFIX_CLOSE H5P__dapl_efile_pref_close
+/* Definitions for chunk read-ahead */
+#define H5D_ACS_CHUNK_PREFETCH_SIZE sizeof(unsigned)
+#define H5D_ACS_CHUNK_PREFETCH_DEF  0
+#define H5D_ACS_CHUNK_PREFETCH_ENC  H5P__encode_unsigned
+#define H5D_ACS_CHUNK_PREFETCH_DEC  H5P__decode_unsigned
 
 /******************/
 /* Local Typedefs */
@@ -195,6 +200,7 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     double rdcc_w0     = H5D_ACS_PREEMPT_READ_CHUNKS_DEF;     /* Default raw data chunk cache dirty ratio */
     H5D_vds_view_t virtual_view = H5D_ACS_VDS_VIEW_DEF;       /* Default VDS view option */
     hsize_t        printf_gap   = H5D_ACS_VDS_PRINTF_GAP_DEF; /* Default VDS printf gap */
+    unsigned       prefetch     = H5D_ACS_CHUNK_PREFETCH_DEF; /* Default # of chunks to read ahead */
     herr_t         ret_value    = SUCCEED;                    /* Return value */
 
     FUNC_ENTER_STATIC
@@ -249,6 +255,12 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
                            H5D_ACS_EFILE_PREFIX_CLOSE) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the number of chunks to read ahead */
+    if (H5P__register_real(pclass, H5D_ACS_CHUNK_PREFETCH_NAME, H5D_ACS_CHUNK_PREFETCH_SIZE, &prefetch, NULL,
+                           NULL, NULL, H5D_ACS_CHUNK_PREFETCH_ENC, H5D_ACS_CHUNK_PREFETCH_DEC, NULL, NULL, NULL,
+                           NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dacc_reg_prop() */
@@ -746,6 +758,12 @@ H5P__dapl_efile_pref_close(const char H5_ATTR_UNUSED *name, size_t H5_ATTR_UNUSE
  *        H5D_CHUNK_CACHE_W0_DEFAULT
  *        as appropriate.
  *
+ *        The RDCC_NSLOTS value is the initial number of slots in the
+ *        cache's hash table.  The table grows as chunks are added, so
+ *        chunks are only preempted to keep within RDCC_NBYTES, never
+ *        because their hash values collide.  A value of zero disables
+ *        the cache.
+ *
  *        The RDCC_W0 value should be between 0 and 1 inclusive and
  *        indicates how much chunks that have been fully read or fully
  *        written are favored for preemption.  A value of zero means
@@ -849,6 +867,76 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_chunk_cache() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_prefetch
+ *
+ * Purpose:     Sets the number of chunks the raw data chunk cache reads
+ *              ahead of a dataset reader.  When the chunks read from the
+ *              dataset follow a regular pattern (consecutive chunks, or
+ *              chunks a fixed distance apart in the dataset's chunk
+ *              order), the next NCHUNKS chunks in that pattern are read
+ *              (and, for filtered datasets, decompressed) into the chunk
+ *              cache together, before they're requested.
+ *
+ *              Read-ahead is limited to half of the chunk cache.  A value
+ *              of 0 (the default) disables read-ahead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_prefetch(hid_t dapl_id, unsigned nchunks)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", dapl_id, nchunks);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if (H5P_set(plist, H5D_ACS_CHUNK_PREFETCH_NAME, &nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk read-ahead")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_prefetch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_prefetch
+ *
+ * Purpose:     Retrieves the number of chunks the raw data chunk cache
+ *              reads ahead of a dataset reader, see
+ *              H5Pset_chunk_prefetch().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_prefetch(hid_t dapl_id, unsigned *nchunks /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", dapl_id, nchunks);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if (nchunks)
+        if (H5P_get(plist, H5D_ACS_CHUNK_PREFETCH_NAME, nchunks) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk read-ahead")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_prefetch() */
+
 /*-------------------------------------------------------------------------
  * Function:       H5P__encode_chunk_cache_nslots
  *
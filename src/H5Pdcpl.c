@@ -3107,6 +3107,66 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_shuffle() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_bitshuffle
+ *
+ * Purpose:     Sets the bitshuffle filter, H5Z_FILTER_BITSHUFFLE, in the
+ *              permanent filter pipeline of a dataset creation property
+ *              list.  The elements of each chunk are bitshuffled in blocks
+ *              of BLOCK_SIZE elements, which must be a multiple of 8, or
+ *              zero to let the library choose.  COMPRESS is one of
+ *              H5Z_BITSHUFFLE_NO_COMPRESS, H5Z_BITSHUFFLE_LZ4 or
+ *              H5Z_BITSHUFFLE_ZSTD, to compress each block after it's
+ *              bitshuffled.  The size of the elements is taken from the
+ *              dataset's datatype when the dataset is created.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_bitshuffle(hid_t plist_id, unsigned block_size, unsigned compress)
+{
+    H5O_pline_t     pline;                                       /* Filter pipeline */
+    H5P_genplist_t *plist;                                       /* Property list pointer */
+    unsigned        cd_values[H5Z_BITSHUFFLE_PARM_COMPRESS + 1]; /* Filter parameters */
+    herr_t          ret_value = SUCCEED;                         /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIuIu", plist_id, block_size, compress);
+
+    /* Check arguments */
+    if (TRUE != H5P_isa_class(plist_id, H5P_DATASET_CREATE))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset creation property list")
+    if (block_size % 8 != 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "block size must be a multiple of 8")
+    if (compress != H5Z_BITSHUFFLE_NO_COMPRESS && compress != H5Z_BITSHUFFLE_LZ4 &&
+        compress != H5Z_BITSHUFFLE_ZSTD)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid bitshuffle compressor")
+
+    /* Get the plist structure */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* The version and the element size are set for each dataset */
+    cd_values[H5Z_BITSHUFFLE_PARM_MAJOR]      = 0;
+    cd_values[H5Z_BITSHUFFLE_PARM_MINOR]      = 0;
+    cd_values[H5Z_BITSHUFFLE_PARM_SIZE]       = 0;
+    cd_values[H5Z_BITSHUFFLE_PARM_BLOCK_SIZE] = block_size;
+    cd_values[H5Z_BITSHUFFLE_PARM_COMPRESS]   = compress;
+
+    /* Add the filter */
+    if (H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+    if (H5Z_append(&pline, H5Z_FILTER_BITSHUFFLE, H5Z_FLAG_OPTIONAL, NELMTS(cd_values), cd_values) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to bitshuffle the data")
+    if (H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_bitshuffle() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_nbit
  *
@@ -159,6 +159,16 @@
 #define H5D_XFER_XFORM_COPY  H5P__dxfr_xform_copy
 #define H5D_XFER_XFORM_CMP   H5P__dxfr_xform_cmp
 #define H5D_XFER_XFORM_CLOSE H5P__dxfr_xform_close
+/* Definitions for filter pipeline thread count property */
+#define H5D_XFER_FILTER_NTHREADS_SIZE sizeof(unsigned)
+#define H5D_XFER_FILTER_NTHREADS_DEF  1
+#define H5D_XFER_FILTER_NTHREADS_ENC  H5P__encode_unsigned
+#define H5D_XFER_FILTER_NTHREADS_DEC  H5P__decode_unsigned
+/* Definitions for filter block size property */
+#define H5D_XFER_FILTER_BLOCK_SIZE_SIZE sizeof(size_t)
+#define H5D_XFER_FILTER_BLOCK_SIZE_DEF  0
+#define H5D_XFER_FILTER_BLOCK_SIZE_ENC  H5P__encode_size_t
+#define H5D_XFER_FILTER_BLOCK_SIZE_DEC  H5P__decode_size_t
 
 /******************/
 /* Local Typedefs */
@@ -263,6 +273,10 @@ static const H5Z_cb_t  H5D_def_filter_cb_g  = H5D_XFER_FILTER_CB_DEF; /* Default
 static const H5T_conv_cb_t H5D_def_conv_cb_g =
     H5D_XFER_CONV_CB_DEF; /* Default value for datatype conversion callback */
 static const void *H5D_def_xfer_xform_g = H5D_XFER_XFORM_DEF; /* Default value for data transform */
+static const unsigned H5D_def_filter_nthreads_g =
+    H5D_XFER_FILTER_NTHREADS_DEF; /* Default value for filter pipeline thread count */
+static const size_t H5D_def_filter_block_size_g =
+    H5D_XFER_FILTER_BLOCK_SIZE_DEF; /* Default value for filter block size */
 
 /*-------------------------------------------------------------------------
  * Function:    H5P__dxfr_reg_prop
@@ -420,6 +434,18 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
                            H5D_XFER_XFORM_CLOSE) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the filter pipeline thread count property */
+    if (H5P__register_real(pclass, H5D_XFER_FILTER_NTHREADS_NAME, H5D_XFER_FILTER_NTHREADS_SIZE,
+                           &H5D_def_filter_nthreads_g, NULL, NULL, NULL, H5D_XFER_FILTER_NTHREADS_ENC,
+                           H5D_XFER_FILTER_NTHREADS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the filter block size property */
+    if (H5P__register_real(pclass, H5D_XFER_FILTER_BLOCK_SIZE_NAME, H5D_XFER_FILTER_BLOCK_SIZE_SIZE,
+                           &H5D_def_filter_block_size_g, NULL, NULL, NULL, H5D_XFER_FILTER_BLOCK_SIZE_ENC,
+                           H5D_XFER_FILTER_BLOCK_SIZE_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dxfr_reg_prop() */
@@ -1714,6 +1740,159 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_hyper_vector_size() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_filter_nthreads
+ *
+ * Purpose:	Given a dataset transfer property list, set the number of
+ *              threads the library may use to run chunks through the
+ *              filter pipeline.  When a read or write touches several
+ *              filtered chunks, batches of chunks are decompressed or
+ *              compressed concurrently.  The data written to the file
+ *              and the chunk cache's behavior are the same as with one
+ *              thread.
+ *
+ *              Dirty chunks that are flushed later (by H5Dflush, H5Fflush
+ *              or when the dataset is closed) are filtered with the
+ *              thread count used by the last write to the dataset.
+ *
+ *              Filters are only run concurrently when the library is
+ *              built thread-safe, otherwise this setting has no effect.
+ *              The default is 1, which disables concurrent filtering.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_filter_nthreads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Check arguments */
+    if (nthreads < 1)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "thread count must be positive")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_XFER_FILTER_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_filter_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_filter_nthreads
+ *
+ * Purpose:	Reads values previously set with H5Pset_filter_nthreads().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_filter_nthreads(hid_t plist_id, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if (nthreads)
+        if (H5P_get(plist, H5D_XFER_FILTER_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_filter_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_filter_block_size
+ *
+ * Purpose:	Given a dataset transfer property list, set the size of the
+ *              blocks that a chunk may be split into when it's compressed.
+ *              When fewer chunks are being compressed at once than the
+ *              filter thread count (H5Pset_filter_nthreads), a filter that
+ *              supports it may compress each block of a chunk larger than
+ *              BLOCK_SIZE with one of the spare threads.
+ *
+ *              The deflate filter does this, and joins the blocks into a
+ *              single stream that any zlib inflate can read, so that the
+ *              file can be read by any version of the library.  The
+ *              stream differs from (and is slightly larger than) the one
+ *              written by a single thread.
+ *
+ *              The default is 0, which disables splitting chunks.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_filter_block_size(hid_t plist_id, size_t block_size)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, block_size);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_XFER_FILTER_BLOCK_SIZE_NAME, &block_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_filter_block_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_filter_block_size
+ *
+ * Purpose:	Reads values previously set with H5Pset_filter_block_size().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_filter_block_size(hid_t plist_id, size_t *block_size /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, block_size);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if (block_size)
+        if (H5P_get(plist, H5D_XFER_FILTER_BLOCK_SIZE_NAME, block_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_filter_block_size() */
+
 /*-------------------------------------------------------------------------
  * Function:       H5P__dxfr_io_xfer_mode_enc
  *
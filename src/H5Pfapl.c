@@ -71,6 +71,11 @@
 #define H5F_ACS_DATA_CACHE_BYTE_SIZE_DEF  (1024 * 1024)
 #define H5F_ACS_DATA_CACHE_BYTE_SIZE_ENC  H5P__encode_size_t
 #define H5F_ACS_DATA_CACHE_BYTE_SIZE_DEC  H5P__decode_size_t
+/* Definition for size of raw data chunk cache shared by all datasets (bytes) */
+#define H5F_ACS_SHARED_DATA_CACHE_BYTE_SIZE_SIZE sizeof(size_t)
+#define H5F_ACS_SHARED_DATA_CACHE_BYTE_SIZE_DEF  0
+#define H5F_ACS_SHARED_DATA_CACHE_BYTE_SIZE_ENC  H5P__encode_size_t
+#define H5F_ACS_SHARED_DATA_CACHE_BYTE_SIZE_DEC  H5P__decode_size_t
 /* Definition for preemption read chunks first */
 #define H5F_ACS_PREEMPT_READ_CHUNKS_SIZE sizeof(double)
 #define H5F_ACS_PREEMPT_READ_CHUNKS_DEF  0.75f
@@ -438,6 +443,8 @@ static const size_t H5F_def_rdcc_nbytes_g =
     H5F_ACS_DATA_CACHE_BYTE_SIZE_DEF; /* Default raw data chunk cache # of bytes */
 static const double H5F_def_rdcc_w0_g =
     H5F_ACS_PREEMPT_READ_CHUNKS_DEF; /* Default raw data chunk cache dirty ratio */
+static const size_t H5F_def_rdcc_shared_nbytes_g =
+    H5F_ACS_SHARED_DATA_CACHE_BYTE_SIZE_DEF; /* Default shared raw data chunk cache # of bytes */
 static const hsize_t H5F_def_threshold_g =
     H5F_ACS_ALIGN_THRHD_DEF;                                  /* Default allocation alignment threshold */
 static const hsize_t H5F_def_alignment_g = H5F_ACS_ALIGN_DEF; /* Default allocation alignment value */
@@ -553,6 +560,13 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            H5F_ACS_PREEMPT_READ_CHUNKS_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the size of the raw data chunk cache shared by all datasets (bytes) */
+    if (H5P__register_real(pclass, H5F_ACS_SHARED_DATA_CACHE_BYTE_SIZE_NAME,
+                           H5F_ACS_SHARED_DATA_CACHE_BYTE_SIZE_SIZE, &H5F_def_rdcc_shared_nbytes_g, NULL,
+                           NULL, NULL, H5F_ACS_SHARED_DATA_CACHE_BYTE_SIZE_ENC,
+                           H5F_ACS_SHARED_DATA_CACHE_BYTE_SIZE_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the threshold for alignment */
     if (H5P__register_real(pclass, H5F_ACS_ALIGN_THRHD_NAME, H5F_ACS_ALIGN_THRHD_SIZE, &H5F_def_threshold_g,
                            NULL, NULL, NULL, H5F_ACS_ALIGN_THRHD_ENC, H5F_ACS_ALIGN_THRHD_DEC, NULL, NULL,
@@ -1755,6 +1769,80 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_cache() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_shared_chunk_cache
+ *
+ * Purpose:     Set the size of a raw data chunk cache shared by all the
+ *              chunked datasets in a file.  When NBYTES is non-zero, the
+ *              chunks cached for all of the file's open datasets are
+ *              limited to NBYTES in total, and the least recently used
+ *              chunks of any dataset are preempted to make room.  Each
+ *              dataset's own chunk cache limits still apply, but the
+ *              byte limit of a dataset's cache defaults to (and can't be
+ *              more than) NBYTES.
+ *
+ *              An NBYTES value of zero (the default) disables the shared
+ *              cache, so that each dataset's chunk cache is sized on its
+ *              own.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_shared_chunk_cache(hid_t fapl_id, size_t nbytes)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", fapl_id, nbytes);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set size */
+    if (H5P_set(plist, H5F_ACS_SHARED_DATA_CACHE_BYTE_SIZE_NAME, &nbytes) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set shared data cache byte size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_shared_chunk_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_shared_chunk_cache
+ *
+ * Purpose:     Retrieves the size of the raw data chunk cache shared by
+ *              all the chunked datasets in a file, set with
+ *              H5Pset_shared_chunk_cache().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_shared_chunk_cache(hid_t fapl_id, size_t *nbytes /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, nbytes);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get size */
+    if (nbytes)
+        if (H5P_get(plist, H5F_ACS_SHARED_DATA_CACHE_BYTE_SIZE_NAME, nbytes) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get shared data cache byte size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_shared_chunk_cache() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_mdc_image_config
  *
@@ -1146,6 +1146,113 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_deflate() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_zstd
+ *
+ * Purpose:     Sets the compression method for a dataset or group link
+ *              filter pipeline (depending on whether PLIST_ID is a dataset
+ *              creation or group creation property list) to H5Z_FILTER_ZSTD
+ *              and the compression level to LEVEL, which should be a value
+ *              between zero and H5Z_ZSTD_MAX_LEVEL, inclusive.  Zero selects
+ *              the zstd library's default level.  Lower compression levels
+ *              are faster but result in less compression; decompression is
+ *              fast at every level.
+ *
+ *              The filter is optional: if the library was built without
+ *              zstd, the data is stored uncompressed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_zstd(hid_t plist_id, unsigned level)
+{
+    H5P_genplist_t *plist;               /* Property list */
+    H5O_pline_t     pline;               /* Filter pipeline */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, level);
+
+    /* Check arguments */
+    if (level > H5Z_ZSTD_MAX_LEVEL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid zstd level")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_OBJECT_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get the pipeline property to append to */
+    if (H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+
+    /* Add the filter */
+    if (H5Z_append(&pline, H5Z_FILTER_ZSTD, H5Z_FLAG_OPTIONAL, (size_t)1, &level) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add zstd filter to pipeline")
+
+    /* Put the I/O pipeline information back into the property list */
+    if (H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_zstd() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_lz4
+ *
+ * Purpose:     Sets the compression method for a dataset or group link
+ *              filter pipeline (depending on whether PLIST_ID is a dataset
+ *              creation or group creation property list) to H5Z_FILTER_LZ4
+ *              and LZ4's acceleration factor to ACCELERATION, which should
+ *              be a value between zero and H5Z_LZ4_MAX_ACCELERATION,
+ *              inclusive.  Zero selects the default of one.  Higher
+ *              factors compress faster but less; decompression speed
+ *              doesn't depend on the factor.
+ *
+ *              The filter is optional: if the library was built without
+ *              lz4, the data is stored uncompressed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_lz4(hid_t plist_id, unsigned acceleration)
+{
+    H5P_genplist_t *plist;                            /* Property list */
+    H5O_pline_t     pline;                            /* Filter pipeline */
+    unsigned        cd_values[2] = {0, acceleration}; /* Default block size and the acceleration */
+    herr_t          ret_value    = SUCCEED;           /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, acceleration);
+
+    /* Check arguments */
+    if (acceleration > H5Z_LZ4_MAX_ACCELERATION)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid lz4 acceleration")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_OBJECT_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get the pipeline property to append to */
+    if (H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+
+    /* Add the filter */
+    if (H5Z_append(&pline, H5Z_FILTER_LZ4, H5Z_FLAG_OPTIONAL, NELMTS(cd_values), cd_values) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add lz4 filter to pipeline")
+
+    /* Put the I/O pipeline information back into the property list */
+    if (H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_lz4() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_fletcher32
  *
@@ -1189,6 +1296,46 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_fletcher32() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_crc32c
+ *
+ * Purpose:     Sets CRC-32C checksum of EDC for a dataset creation
+ *              property list or group creation property list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_crc32c(hid_t plist_id)
+{
+    H5P_genplist_t *plist;               /* Property list */
+    H5O_pline_t     pline;               /* Filter pipeline */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", plist_id);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_OBJECT_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get the pipeline property to append to */
+    if (H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+
+    /* Add the CRC-32C checksum as a filter */
+    if (H5Z_append(&pline, H5Z_FILTER_CRC32C, H5Z_FLAG_MANDATORY, (size_t)0, NULL) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add crc32c filter to pipeline")
+
+    /* Put the I/O pipeline information back into the property list */
+    if (H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_crc32c() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5P__get_filter
  *
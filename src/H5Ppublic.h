@@ -286,7 +286,10 @@ H5_DLL herr_t       H5Pget_filter_by_id2(hid_t plist_id, H5Z_filter_t id, unsign
 H5_DLL htri_t       H5Pall_filters_avail(hid_t plist_id);
 H5_DLL herr_t       H5Premove_filter(hid_t plist_id, H5Z_filter_t filter);
 H5_DLL herr_t       H5Pset_deflate(hid_t plist_id, unsigned aggression);
+H5_DLL herr_t       H5Pset_zstd(hid_t plist_id, unsigned level);
+H5_DLL herr_t       H5Pset_lz4(hid_t plist_id, unsigned acceleration);
 H5_DLL herr_t       H5Pset_fletcher32(hid_t plist_id);
+H5_DLL herr_t       H5Pset_crc32c(hid_t plist_id);
 
 /* File creation property list (FCPL) routines */
 H5_DLL herr_t H5Pset_userblock(hid_t plist_id, hsize_t size);
@@ -329,6 +332,8 @@ H5_DLL herr_t      H5Pset_cache(hid_t plist_id, int mdc_nelmts, size_t rdcc_nslo
                                 double rdcc_w0);
 H5_DLL herr_t      H5Pget_cache(hid_t plist_id, int *mdc_nelmts, /* out */
                                 size_t *rdcc_nslots /*out*/, size_t *rdcc_nbytes /*out*/, double *rdcc_w0);
+H5_DLL herr_t      H5Pset_shared_chunk_cache(hid_t fapl_id, size_t nbytes);
+H5_DLL herr_t      H5Pget_shared_chunk_cache(hid_t fapl_id, size_t *nbytes /*out*/);
 H5_DLL herr_t      H5Pset_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr);
 H5_DLL herr_t      H5Pget_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr); /* out */
 H5_DLL herr_t      H5Pset_gc_references(hid_t fapl_id, unsigned gc_ref);
@@ -398,6 +403,7 @@ H5_DLL herr_t       H5Pget_external(hid_t plist_id, unsigned idx, size_t name_si
                                     off_t *offset /*out*/, hsize_t *size /*out*/);
 H5_DLL herr_t       H5Pset_szip(hid_t plist_id, unsigned options_mask, unsigned pixels_per_block);
 H5_DLL herr_t       H5Pset_shuffle(hid_t plist_id);
+H5_DLL herr_t       H5Pset_bitshuffle(hid_t plist_id, unsigned block_size, unsigned compress);
 H5_DLL herr_t       H5Pset_nbit(hid_t plist_id);
 H5_DLL herr_t       H5Pset_scaleoffset(hid_t plist_id, H5Z_SO_scale_type_t scale_type, int scale_factor);
 H5_DLL herr_t       H5Pset_fill_value(hid_t plist_id, hid_t type_id, const void *value);
@@ -414,6 +420,8 @@ H5_DLL herr_t       H5Pset_dset_no_attrs_hint(hid_t dcpl_id, hbool_t minimize);
 H5_DLL herr_t  H5Pset_chunk_cache(hid_t dapl_id, size_t rdcc_nslots, size_t rdcc_nbytes, double rdcc_w0);
 H5_DLL herr_t  H5Pget_chunk_cache(hid_t dapl_id, size_t *rdcc_nslots /*out*/, size_t *rdcc_nbytes /*out*/,
                                   double *rdcc_w0 /*out*/);
+H5_DLL herr_t  H5Pset_chunk_prefetch(hid_t dapl_id, unsigned nchunks);
+H5_DLL herr_t  H5Pget_chunk_prefetch(hid_t dapl_id, unsigned *nchunks /*out*/);
 H5_DLL herr_t  H5Pset_virtual_view(hid_t plist_id, H5D_vds_view_t view);
 H5_DLL herr_t  H5Pget_virtual_view(hid_t plist_id, H5D_vds_view_t *view);
 H5_DLL herr_t  H5Pset_virtual_printf_gap(hid_t plist_id, hsize_t gap_size);
@@ -448,6 +456,10 @@ H5_DLL herr_t    H5Pset_hyper_vector_size(hid_t fapl_id, size_t size);
 H5_DLL herr_t    H5Pget_hyper_vector_size(hid_t fapl_id, size_t *size /*out*/);
 H5_DLL herr_t    H5Pset_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t op, void *operate_data);
 H5_DLL herr_t    H5Pget_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t *op, void **operate_data);
+H5_DLL herr_t    H5Pset_filter_nthreads(hid_t plist_id, unsigned nthreads);
+H5_DLL herr_t    H5Pget_filter_nthreads(hid_t plist_id, unsigned *nthreads /*out*/);
+H5_DLL herr_t    H5Pset_filter_block_size(hid_t plist_id, size_t block_size);
+H5_DLL herr_t    H5Pget_filter_block_size(hid_t plist_id, size_t *block_size /*out*/);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5Pget_mpio_actual_chunk_opt_mode(hid_t                             plist_id,
                                                 H5D_mpio_actual_chunk_opt_mode_t *actual_chunk_opt_mode);
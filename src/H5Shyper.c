@@ -45,6 +45,10 @@
 #define H5S_HYPER_COMPUTE_A_AND_B 0x02
 #define H5S_HYPER_COMPUTE_A_NOT_B 0x04
 
+/* Limits on the sequence list cached for a hyperslab selection */
+#define H5S_HYPER_SEQ_CACHE_INIT_NSEQ 64    /* # of sequences allocated at first */
+#define H5S_HYPER_SEQ_CACHE_MAX_NSEQ  65536 /* Most sequences cached for one selection */
+
 /* Macro to advance a span, possibly recycling it first */
 #define H5S_HYPER_ADVANCE_SPAN(recover, curr_span, next_span)                                                \
     do {                                                                                                     \
@@ -99,6 +103,12 @@ typedef struct {
     hbool_t  share_selection; /* Whether span trees in dst_space can be shared with proj_space */
 } H5S_hyper_project_intersect_ud_t;
 
+/* Block of a block list, for building a span tree from the list */
+typedef struct {
+    hsize_t        low;    /* Start of the block in the dimension being built (sort key) */
+    const hsize_t *coords; /* Starting coordinates of the block, followed by its ending coordinates */
+} H5S_hyper_blk_t;
+
 /* Assert that H5S_MAX_RANK is <= 32 so our trick with using a 32 bit bitmap
  * (ps_clean_bitmap) works.  If H5S_MAX_RANK increases either increase the size
  * of ps_clean_bitmap or change the algorithm to use an array. */
@@ -137,6 +147,12 @@ static herr_t  H5S__hyper_add_disjoint_spans(H5S_t *space, H5S_hyper_span_info_t
 static H5S_hyper_span_info_t *H5S__hyper_make_spans(unsigned rank, const hsize_t *start,
                                                     const hsize_t *stride, const hsize_t *count,
                                                     const hsize_t *block);
+static int                    H5S__hyper_cmp_blk(const void *_blk1, const void *_blk2);
+static H5S_hyper_span_info_t *H5S__hyper_blocks_to_spans_helper(H5S_hyper_blk_t *blks, size_t nblks,
+                                                                unsigned rank, unsigned dim,
+                                                                H5S_hyper_blk_t *scratch, size_t nscratch);
+static H5S_hyper_span_info_t *H5S__hyper_blocks_to_spans(unsigned rank, size_t nblocks,
+                                                         const hsize_t *blocks);
 static herr_t                 H5S__hyper_update_diminfo(H5S_t *space, H5S_seloper_t op,
                                                         const H5S_hyper_dim_t *new_hyper_diminfo);
 static herr_t                 H5S__hyper_generate_spans(H5S_t *space);
@@ -151,6 +167,8 @@ static herr_t  H5S__set_regular_hyperslab(H5S_t *space, const hsize_t start[], c
                                           const hsize_t app_count[], const hsize_t *app_block,
                                           const hsize_t *opt_stride, const hsize_t opt_count[],
                                           const hsize_t *opt_block);
+static herr_t  H5S__select_hyper_blocklist(H5S_t *space, H5S_seloper_t op, size_t num_blocks,
+                                           const hsize_t *buf);
 static herr_t  H5S__fill_in_select(H5S_t *space1, H5S_seloper_t op, H5S_t *space2, H5S_t **result);
 static H5S_t * H5S__combine_select(H5S_t *space1, H5S_seloper_t op, H5S_t *space2);
 static herr_t  H5S__hyper_iter_get_seq_list_gen(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem,
@@ -159,6 +177,12 @@ static herr_t  H5S__hyper_iter_get_seq_list_opt(H5S_sel_iter_t *iter, size_t max
                                                 size_t *nseq, size_t *nelem, hsize_t *off, size_t *len);
 static herr_t  H5S__hyper_iter_get_seq_list_single(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem,
                                                    size_t *nseq, size_t *nelem, hsize_t *off, size_t *len);
+static herr_t  H5S__hyper_iter_get_seq_list_cached(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem,
+                                                   size_t *nseq, size_t *nelem, hsize_t *off, size_t *len);
+static void    H5S__hyper_iter_uncache(H5S_sel_iter_t *iter);
+static hbool_t H5S__hyper_seq_cache_match(const H5S_hyper_sel_t *hslab, const H5S_sel_iter_t *iter,
+                                          const H5S_hyper_seq_cache_t *cache);
+static herr_t  H5S__hyper_seq_cache_build(H5S_hyper_seq_cache_t *cache, H5S_sel_iter_t *iter);
 static herr_t  H5S__hyper_proj_int_build_proj(H5S_hyper_project_intersect_ud_t *udata);
 static herr_t  H5S__hyper_proj_int_iterate(const H5S_hyper_span_info_t *ss_span_info,
                                            const H5S_hyper_span_info_t *sis_span_info, hsize_t count,
@@ -277,6 +301,9 @@ H5FL_DEFINE_STATIC(H5S_hyper_sel_t);
 /* Declare a free list to manage the H5S_hyper_span_t struct */
 H5FL_DEFINE_STATIC(H5S_hyper_span_t);
 
+/* Declare a free list to manage the H5S_hyper_seq_cache_t struct */
+H5FL_DEFINE_STATIC(H5S_hyper_seq_cache_t);
+
 /* Declare a free list to manage the H5S_hyper_span_info_t + hsize_t array struct */
 H5FL_BARR_DEFINE_STATIC(H5S_hyper_span_info_t, hbounds_t, H5S_MAX_RANK * 2);
 
@@ -579,6 +606,11 @@ H5S__hyper_iter_init(const H5S_t *space, H5S_sel_iter_t *iter)
     /* Initialize the hyperslab iterator's rank */
     iter->u.hyp.iter_rank = 0;
 
+    /* Initialize the cached sequence list information */
+    iter->u.hyp.seq_cache = NULL;
+    iter->u.hyp.seq_idx   = 0;
+    iter->u.hyp.seq_done  = 0;
+
     /* Get the rank of the dataspace */
     rank = iter->rank;
 
@@ -803,6 +835,8 @@ H5S__hyper_iter_coords(const H5S_sel_iter_t *iter, hsize_t *coords)
     /* Check args */
     HDassert(iter);
     HDassert(coords);
+    /* The iterator can't have moved through a cached sequence list */
+    HDassert(!iter->u.hyp.seq_cache || iter->elmt_left == iter->u.hyp.seq_cache->nelmts);
 
     /* Copy the offset of the current point */
 
@@ -894,6 +928,8 @@ H5S__hyper_iter_block(const H5S_sel_iter_t *iter, hsize_t *start, hsize_t *end)
     HDassert(iter);
     HDassert(start);
     HDassert(end);
+    /* The iterator can't have moved through a cached sequence list */
+    HDassert(!iter->u.hyp.seq_cache || iter->elmt_left == iter->u.hyp.seq_cache->nelmts);
 
     /* Copy the offset of the current point */
 
@@ -966,6 +1002,8 @@ H5S__hyper_iter_has_next_block(const H5S_sel_iter_t *iter)
 
     /* Check args */
     HDassert(iter);
+    /* The iterator can't have moved through a cached sequence list */
+    HDassert(!iter->u.hyp.seq_cache || iter->elmt_left == iter->u.hyp.seq_cache->nelmts);
 
     /* Check for a single "regular" hyperslab */
     if (iter->u.hyp.diminfo_valid) {
@@ -1017,6 +1055,10 @@ H5S__hyper_iter_next(H5S_sel_iter_t *iter, size_t nelem)
 
     FUNC_ENTER_STATIC_NOERR
 
+    /* Stop replaying a cached sequence list */
+    if (iter->u.hyp.seq_cache)
+        H5S__hyper_iter_uncache(iter);
+
     /* Check for the special case of just one H5Sselect_hyperslab call made */
     /* (i.e. a regular hyperslab selection */
     if (iter->u.hyp.diminfo_valid) {
@@ -1226,6 +1268,10 @@ H5S__hyper_iter_next_block(H5S_sel_iter_t *iter)
 
     FUNC_ENTER_STATIC_NOERR
 
+    /* Stop replaying a cached sequence list */
+    if (iter->u.hyp.seq_cache)
+        H5S__hyper_iter_uncache(iter);
+
     /* Check for the special case of just one H5Sselect_hyperslab call made */
     /* (i.e. a regular hyperslab selection) */
     if (iter->u.hyp.diminfo_valid) {
@@ -2610,8 +2656,12 @@ H5S__hyper_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem
     HDassert(off);
     HDassert(len);
 
+    /* Check for a sequence list cached for the selection */
+    if (iter->u.hyp.seq_cache)
+        /* Replay the cached sequence list */
+        ret_value = H5S__hyper_iter_get_seq_list_cached(iter, maxseq, maxelem, nseq, nelem, off, len);
     /* Check for the special case of just one H5Sselect_hyperslab call made */
-    if (iter->u.hyp.diminfo_valid) {
+    else if (iter->u.hyp.diminfo_valid) {
         const H5S_hyper_dim_t *tdiminfo;     /* Temporary pointer to diminfo information */
         const hssize_t *       sel_off;      /* Selection offset in dataspace */
         unsigned               ndims;        /* Number of dimensions of dataset */
@@ -2758,9 +2808,445 @@ H5S__hyper_iter_release(H5S_sel_iter_t *iter)
     if (iter->u.hyp.spans != NULL)
         H5S__hyper_free_span_info(iter->u.hyp.spans);
 
+    /* Release the cached sequence list */
+    if (iter->u.hyp.seq_cache != NULL)
+        H5S_hyper_seq_cache_free(iter->u.hyp.seq_cache);
+
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5S__hyper_iter_release() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_iter_get_seq_list_cached
+ *
+ * Purpose:     Retrieves the next sequences of a hyperslab selection from
+ *              the sequence list cached for it, splitting a cached
+ *              sequence when MAXELEM runs out in the middle of it.
+ *
+ * Return:      Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S__hyper_iter_get_seq_list_cached(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem, size_t *nseq,
+                                    size_t *nelem, hsize_t *off, size_t *len)
+{
+    const H5S_hyper_seq_cache_t *cache;        /* Cached sequence list */
+    size_t                       elmt_size;    /* Size of each element iterated over */
+    size_t                       seq_idx;      /* Index of current cached sequence */
+    size_t                       seq_done;     /* # of bytes of current cached sequence returned */
+    size_t                       curr_seq = 0; /* Number of sequences generated */
+    size_t                       tot_elem = 0; /* Number of elements in the sequences generated */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(iter);
+    HDassert(iter->u.hyp.seq_cache);
+    HDassert(iter->u.hyp.seq_cache->state == H5S_HYPER_SEQ_CACHE_BUILT);
+
+    /* Set up some local variables */
+    cache     = iter->u.hyp.seq_cache;
+    elmt_size = iter->elmt_size;
+    seq_idx   = iter->u.hyp.seq_idx;
+    seq_done  = iter->u.hyp.seq_done;
+
+    /* Copy out sequences until we run out of room or of sequences */
+    while (curr_seq < maxseq && maxelem > 0 && seq_idx < cache->nseq) {
+        size_t seq_elem;    /* # of elements left in the cached sequence */
+        size_t actual_elem; /* # of elements to put in the sequence returned */
+
+        /* Compute the number of elements to return from this sequence */
+        seq_elem    = (cache->len[seq_idx] - seq_done) / elmt_size;
+        actual_elem = MIN(seq_elem, maxelem);
+
+        /* Add a new sequence */
+        off[curr_seq] = cache->off[seq_idx] + seq_done;
+        len[curr_seq] = actual_elem * elmt_size;
+        curr_seq++;
+
+        /* Move to the next cached sequence, or further into this one */
+        if (actual_elem == seq_elem) {
+            seq_idx++;
+            seq_done = 0;
+        } /* end if */
+        else
+            seq_done += actual_elem * elmt_size;
+
+        /* Increment/decrement element counts */
+        tot_elem += actual_elem;
+        maxelem -= actual_elem;
+    } /* end while */
+
+    /* Save the position in the cached sequence list */
+    iter->u.hyp.seq_idx  = seq_idx;
+    iter->u.hyp.seq_done = seq_done;
+
+    /* Decrement the number of elements left in selection */
+    iter->elmt_left -= tot_elem;
+
+    /* Set the number of sequences generated and elements used */
+    *nseq  = curr_seq;
+    *nelem = tot_elem;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5S__hyper_iter_get_seq_list_cached() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S_hyper_iter_cache_seq
+ *
+ * Purpose:     Sets up a newly initialized selection iterator to replay the
+ *              sequence list cached in CACHE_PTR, which is owned by the
+ *              caller (a dataset keeps one for each of the selections of
+ *              its I/O).  Only iterators over hyperslab selections use the
+ *              cache; others are left alone.
+ *
+ *              The first time a selection is iterated over, only what it
+ *              is (and what the iterator is for) is remembered, so that
+ *              selections that are used once don't pay for a copy of their
+ *              sequences.  The second time, the iterator generates the
+ *              whole sequence list into the cache before it starts.  From
+ *              then on, the selection's sequences are copied from the
+ *              cache until the selection, its offset, the extent or the
+ *              element size change, when the cache is replaced with one
+ *              for the new selection.
+ *
+ * Return:      Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5S_hyper_iter_cache_seq(H5S_sel_iter_t *iter, const H5S_t *space, H5S_hyper_seq_cache_t **cache_ptr)
+{
+    const H5S_hyper_sel_t *hslab;               /* Hyperslab selection information */
+    H5S_hyper_seq_cache_t *cache;               /* Cached sequence list */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(iter);
+    HDassert(space);
+    HDassert(cache_ptr);
+
+    /* Only library iterators over hyperslab selections replay sequences.
+     * (Iterators created by the application copy the selection instead.)
+     */
+    if (iter->type->type != H5S_SEL_HYPERSLABS || iter->elmt_size == 0 ||
+        (iter->flags & H5S_SEL_ITER_API_CALL))
+        HGOTO_DONE(SUCCEED)
+    HDassert(NULL == iter->u.hyp.seq_cache);
+    HDassert(iter->elmt_left == space->select.num_elem);
+
+    /* Set up some local variables */
+    hslab = space->select.sel_info.hslab;
+    cache = *cache_ptr;
+
+    /* The sequences of single block selections are generated as fast as
+     * they could be copied */
+    if (iter->u.hyp.diminfo_valid) {
+        unsigned u; /* Local index variable */
+
+        for (u = 0; u < iter->rank; u++)
+            if (hslab->diminfo.opt[u].count != 1)
+                break;
+        if (u == iter->rank)
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Forget a cache that was for a different selection */
+    if (cache && !H5S__hyper_seq_cache_match(hslab, iter, cache)) {
+        H5S_hyper_seq_cache_free(cache);
+        *cache_ptr = cache = NULL;
+    } /* end if */
+
+    /* Remember the selection the first time it's iterated over */
+    if (NULL == cache) {
+        if (NULL == (cache = H5FL_MALLOC(H5S_hyper_seq_cache_t)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate sequence list cache")
+        cache->count     = 1;
+        cache->state     = H5S_HYPER_SEQ_CACHE_SEEN;
+        cache->elmt_size = iter->elmt_size;
+        H5MM_memcpy(cache->dims, iter->dims, sizeof(hsize_t) * iter->rank);
+        H5MM_memcpy(cache->sel_off, iter->sel_off, sizeof(hssize_t) * iter->rank);
+        if (hslab->diminfo_valid == H5S_DIMINFO_VALID_YES) {
+            H5MM_memcpy(cache->diminfo, hslab->diminfo.opt, sizeof(H5S_hyper_dim_t) * iter->rank);
+            cache->spans = NULL;
+        } /* end if */
+        else {
+            /* Share the selection's span tree until the sequences are generated */
+            HDassert(hslab->span_lst);
+            cache->spans = hslab->span_lst;
+            cache->spans->count++;
+        } /* end else */
+        cache->nelmts = 0;
+        cache->nseq   = 0;
+        cache->off    = NULL;
+        cache->len    = NULL;
+
+        *cache_ptr = cache;
+    } /* end if */
+    else {
+        /* Generate the sequences the second time the selection is iterated over */
+        if (cache->state == H5S_HYPER_SEQ_CACHE_SEEN)
+            if (H5S__hyper_seq_cache_build(cache, iter) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't cache sequence list")
+
+        /* Replay the cached sequences */
+        if (cache->state == H5S_HYPER_SEQ_CACHE_BUILT) {
+            HDassert(cache->nelmts == iter->elmt_left);
+            iter->u.hyp.seq_cache = cache;
+            cache->count++;
+        } /* end if */
+    }     /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S_hyper_iter_cache_seq() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_iter_uncache
+ *
+ * Purpose:     Stops a hyperslab iterator from replaying a cached sequence
+ *              list, moving it past the elements it has already returned
+ *              from the cache.
+ *
+ * Return:      Nothing
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5S__hyper_iter_uncache(H5S_sel_iter_t *iter)
+{
+    hsize_t nelem_done; /* # of elements returned from the cache */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(iter);
+    HDassert(iter->u.hyp.seq_cache);
+
+    /* Get the number of elements already returned */
+    nelem_done = iter->u.hyp.seq_cache->nelmts - iter->elmt_left;
+
+    /* Release the cached sequence list */
+    H5S_hyper_seq_cache_free(iter->u.hyp.seq_cache);
+    iter->u.hyp.seq_cache = NULL;
+
+    /* Catch the iterator up with the sequences returned */
+    if (nelem_done > 0)
+        H5S__hyper_iter_next(iter, (size_t)nelem_done);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5S__hyper_iter_uncache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_seq_cache_match
+ *
+ * Purpose:     Checks whether a cached sequence list is for a hyperslab
+ *              selection, as it would be iterated over by an iterator.
+ *
+ * Return:      TRUE/FALSE (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5S__hyper_seq_cache_match(const H5S_hyper_sel_t *hslab, const H5S_sel_iter_t *iter,
+                           const H5S_hyper_seq_cache_t *cache)
+{
+    unsigned u;                /* Local index variable */
+    hbool_t  ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(hslab);
+    HDassert(iter);
+    HDassert(cache);
+
+    /* Check the element size, the extent and the selection offset */
+    if (cache->elmt_size != iter->elmt_size)
+        HGOTO_DONE(FALSE)
+    for (u = 0; u < iter->rank; u++)
+        if (cache->dims[u] != iter->dims[u] || cache->sel_off[u] != iter->sel_off[u])
+            HGOTO_DONE(FALSE)
+
+    /* Check the selection itself */
+    if (hslab->diminfo_valid == H5S_DIMINFO_VALID_YES) {
+        if (cache->spans)
+            HGOTO_DONE(FALSE)
+        for (u = 0; u < iter->rank; u++)
+            if (cache->diminfo[u].start != hslab->diminfo.opt[u].start ||
+                cache->diminfo[u].stride != hslab->diminfo.opt[u].stride ||
+                cache->diminfo[u].count != hslab->diminfo.opt[u].count ||
+                cache->diminfo[u].block != hslab->diminfo.opt[u].block)
+                HGOTO_DONE(FALSE)
+    } /* end if */
+    else {
+        if (NULL == cache->spans)
+            HGOTO_DONE(FALSE)
+
+        /* Compare generated sequences' private copy of the span tree with the
+         * selection's, or else check that the span tree is still the one
+         * shared with the selection */
+        if (cache->state == H5S_HYPER_SEQ_CACHE_BUILT) {
+            if (!H5S__hyper_cmp_spans(cache->spans, hslab->span_lst))
+                HGOTO_DONE(FALSE)
+        } /* end if */
+        else if (cache->spans != hslab->span_lst)
+            HGOTO_DONE(FALSE)
+    } /* end else */
+
+    /* Check that the sequences have all of the selection's elements */
+    if (cache->state == H5S_HYPER_SEQ_CACHE_BUILT && cache->nelmts != iter->elmt_left)
+        HGOTO_DONE(FALSE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_seq_cache_match() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_seq_cache_build
+ *
+ * Purpose:     Generates the whole sequence list of a hyperslab selection
+ *              into its cache, with a newly initialized iterator.  The
+ *              iterator is put back at the start of the selection
+ *              afterwards.
+ *
+ *              Selections with more than H5S_HYPER_SEQ_CACHE_MAX_NSEQ
+ *              sequences aren't cached.
+ *
+ * Return:      Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S__hyper_seq_cache_build(H5S_hyper_seq_cache_t *cache, H5S_sel_iter_t *iter)
+{
+    H5S_sel_iter_t *start_iter = NULL;    /* Iterator at the start of the selection */
+    size_t          nalloc     = 0;       /* # of sequences allocated */
+    herr_t          ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(cache);
+    HDassert(cache->state == H5S_HYPER_SEQ_CACHE_SEEN);
+    HDassert(iter);
+    HDassert(NULL == iter->u.hyp.seq_cache);
+
+    /* Remember where the iterator starts */
+    if (NULL == (start_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate selection iterator")
+    H5MM_memcpy(start_iter, iter, sizeof(H5S_sel_iter_t));
+
+    /* Generate all of the sequences */
+    while (iter->elmt_left > 0) {
+        size_t nseq;  /* # of sequences generated */
+        size_t nelem; /* # of elements in the sequences generated */
+
+        /* Make room for more sequences */
+        if (cache->nseq == nalloc) {
+            hsize_t *new_off; /* New array of offsets */
+            size_t * new_len; /* New array of lengths */
+
+            /* Give up on selections with too many sequences */
+            if (nalloc == H5S_HYPER_SEQ_CACHE_MAX_NSEQ) {
+                cache->state = H5S_HYPER_SEQ_CACHE_TOO_BIG;
+                break;
+            } /* end if */
+
+            nalloc = (nalloc == 0) ? H5S_HYPER_SEQ_CACHE_INIT_NSEQ
+                                   : MIN(2 * nalloc, H5S_HYPER_SEQ_CACHE_MAX_NSEQ);
+            if (NULL == (new_off = (hsize_t *)H5MM_realloc(cache->off, nalloc * sizeof(hsize_t))))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate cached sequence offsets")
+            cache->off = new_off;
+            if (NULL == (new_len = (size_t *)H5MM_realloc(cache->len, nalloc * sizeof(size_t))))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate cached sequence lengths")
+            cache->len = new_len;
+        } /* end if */
+
+        /* Generate as many sequences as there's room for */
+        if (H5S__hyper_iter_get_seq_list(iter, nalloc - cache->nseq,
+                                         (size_t)MIN(iter->elmt_left, (hsize_t)SIZE_MAX), &nseq, &nelem,
+                                         cache->off + cache->nseq, cache->len + cache->nseq) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "sequence length generation failed")
+        cache->nseq += nseq;
+        cache->nelmts += nelem;
+    } /* end while */
+
+    if (cache->state == H5S_HYPER_SEQ_CACHE_TOO_BIG) {
+        /* Discard the sequences */
+        cache->off    = (hsize_t *)H5MM_xfree(cache->off);
+        cache->len    = (size_t *)H5MM_xfree(cache->len);
+        cache->nseq   = 0;
+        cache->nelmts = 0;
+    } /* end if */
+    else {
+        /* Replace the span tree shared with the selection with a copy, so
+         * that later changes to the selection are noticed */
+        if (cache->spans) {
+            H5S_hyper_span_info_t *spans_copy; /* Copy of span tree */
+
+            if (NULL == (spans_copy = H5S__hyper_copy_span(cache->spans, iter->rank)))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy span tree")
+            H5S__hyper_free_span_info(cache->spans);
+            cache->spans = spans_copy;
+        } /* end if */
+
+        cache->state = H5S_HYPER_SEQ_CACHE_BUILT;
+    } /* end else */
+
+done:
+    if (start_iter) {
+        /* Put the iterator back at the start of the selection */
+        H5MM_memcpy(iter, start_iter, sizeof(H5S_sel_iter_t));
+        start_iter = H5FL_FREE(H5S_sel_iter_t, start_iter);
+    } /* end if */
+
+    /* Don't leave partly generated sequences behind */
+    if (ret_value < 0) {
+        cache->off    = (hsize_t *)H5MM_xfree(cache->off);
+        cache->len    = (size_t *)H5MM_xfree(cache->len);
+        cache->nseq   = 0;
+        cache->nelmts = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_seq_cache_build() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S_hyper_seq_cache_free
+ *
+ * Purpose:     Decrements the reference count of a cached sequence list,
+ *              freeing it when it drops to zero.
+ *
+ * Return:      Nothing
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5S_hyper_seq_cache_free(H5S_hyper_seq_cache_t *cache)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(cache);
+    HDassert(cache->count > 0);
+
+    /* Decrement the reference count */
+    cache->count--;
+
+    /* Free the cache, if it's not used any more */
+    if (cache->count == 0) {
+        if (cache->spans)
+            H5S__hyper_free_span_info(cache->spans);
+        H5MM_xfree(cache->off);
+        H5MM_xfree(cache->len);
+        cache = H5FL_FREE(H5S_hyper_seq_cache_t, cache);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5S_hyper_seq_cache_free() */
 /*--------------------------------------------------------------------------
  NAME
     H5S__hyper_new_span
@@ -8640,6 +9126,225 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__hyper_make_spans() */
 
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_cmp_blk
+ PURPOSE
+    Compare two blocks by their starting coordinate in the dimension being
+    swept (for sorting)
+ USAGE
+    int H5S__hyper_cmp_blk(_blk1, _blk2)
+        const void *_blk1;      IN: First block to compare
+        const void *_blk2;      IN: Second block to compare
+ RETURNS
+    Negative, zero or positive, as for qsort()
+ DESCRIPTION
+    Comparison callback for HDqsort(), used by H5S__hyper_blocks_to_spans_helper().
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static int
+H5S__hyper_cmp_blk(const void *_blk1, const void *_blk2)
+{
+    const H5S_hyper_blk_t *blk1 = (const H5S_hyper_blk_t *)_blk1;
+    const H5S_hyper_blk_t *blk2 = (const H5S_hyper_blk_t *)_blk2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI((blk1->low > blk2->low) - (blk1->low < blk2->low))
+} /* end H5S__hyper_cmp_blk() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_blocks_to_spans_helper
+ PURPOSE
+    Helper routine to build the span tree for the union of a list of blocks
+ USAGE
+    H5S_hyper_span_info_t *H5S__hyper_blocks_to_spans_helper(blks, nblks, rank, dim, scratch, nscratch)
+        H5S_hyper_blk_t *blks;      IN/OUT: Blocks to build span tree from (sorted on exit)
+        size_t nblks;               IN: Number of blocks in BLKS
+        unsigned rank;              IN: # of dimensions of the space
+        unsigned dim;               IN: Dimension of the span tree to build
+        H5S_hyper_blk_t *scratch;   IN: Scratch space for the lower dimensions
+        size_t nscratch;            IN: Number of blocks in each dimension's scratch space
+ RETURNS
+    Pointer to new span tree on success, NULL on failure
+ DESCRIPTION
+    Sorts the blocks by their start in dimension DIM and sweeps over them.
+    In the fastest changing dimension, overlapping and adjacent blocks are
+    merged into single spans.  In the other dimensions, a span is appended
+    for each interval over which the set of 'active' blocks doesn't change,
+    with the span tree for the lower dimensions built from the active blocks.
+    H5S__hyper_append_span() merges adjacent spans with identical lower
+    dimensions, so the span tree built is the same one that combining the
+    blocks with H5S_SELECT_OR would produce.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Each dimension below DIM has a scratch array of NSCRATCH blocks, starting
+    at SCRATCH, to hold its active blocks.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5S_hyper_span_info_t *
+H5S__hyper_blocks_to_spans_helper(H5S_hyper_blk_t *blks, size_t nblks, unsigned rank, unsigned dim,
+                                  H5S_hyper_blk_t *scratch, size_t nscratch)
+{
+    H5S_hyper_span_info_t *spans     = NULL; /* Span tree being built */
+    H5S_hyper_span_info_t *down      = NULL; /* Span tree for the lower dimensions */
+    H5S_hyper_span_info_t *ret_value = NULL; /* Return value */
+    size_t                 u;                /* Local index variable */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(blks);
+    HDassert(nblks > 0);
+    HDassert(dim < rank);
+
+    /* Sort the blocks by their start in this dimension */
+    for (u = 0; u < nblks; u++)
+        blks[u].low = blks[u].coords[dim];
+    HDqsort(blks, nblks, sizeof(H5S_hyper_blk_t), H5S__hyper_cmp_blk);
+
+    /* Check for the fastest changing dimension */
+    if (dim + 1 == rank) {
+        u = 0;
+        while (u < nblks) {
+            hsize_t low  = blks[u].low;                /* Low bound of span */
+            hsize_t high = blks[u].coords[rank + dim]; /* High bound of span */
+
+            /* Merge following blocks which overlap or adjoin the span */
+            /* (Their low bound is > high when the second test is made, so it can't underflow) */
+            for (u++; u < nblks && (blks[u].low <= high || (blks[u].low - 1) == high); u++)
+                if (blks[u].coords[rank + dim] > high)
+                    high = blks[u].coords[rank + dim];
+
+            /* Append the span */
+            if (H5S__hyper_append_span(&spans, 1, low, high, NULL) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, NULL, "can't allocate hyperslab span")
+        } /* end while */
+    }     /* end if */
+    else {
+        H5S_hyper_blk_t *active  = scratch; /* Blocks which include the current span */
+        size_t           nactive = 0;       /* Number of active blocks */
+        hsize_t          low     = 0;       /* Low bound of current span */
+
+        u = 0;
+        while (u < nblks || nactive > 0) {
+            hsize_t high; /* High bound of current span */
+            size_t  v, w; /* Local index variables */
+
+            /* Skip over any gap between blocks */
+            if (nactive == 0)
+                low = blks[u].low;
+
+            /* Add the blocks which start here to the active blocks */
+            while (u < nblks && blks[u].low == low)
+                active[nactive++] = blks[u++];
+
+            /* The span ends before the next block starts, or where an active block ends */
+            high = (u < nblks) ? blks[u].low - 1 : HSIZE_UNDEF;
+            for (v = 0; v < nactive; v++)
+                if (active[v].coords[rank + dim] < high)
+                    high = active[v].coords[rank + dim];
+
+            /* Build the span tree for the lower dimensions from the active blocks */
+            /* (This re-sorts the active blocks, which doesn't matter here) */
+            if (NULL == (down = H5S__hyper_blocks_to_spans_helper(active, nactive, rank, dim + 1,
+                                                                   scratch + nscratch, nscratch)))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, NULL, "can't create hyperslab information")
+
+            /* Append the span */
+            if (H5S__hyper_append_span(&spans, rank - dim, low, high, down) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, NULL, "can't allocate hyperslab span")
+
+            /* Release the lower dimensions' span tree (the new span holds a reference, if needed) */
+            H5S__hyper_free_span_info(down);
+            down = NULL;
+
+            /* Drop the blocks which end with this span */
+            for (v = w = 0; v < nactive; v++)
+                if (active[v].coords[rank + dim] != high)
+                    active[w++] = active[v];
+            nactive = w;
+
+            /* Advance to the next span */
+            low = high + 1;
+        } /* end while */
+    }     /* end else */
+
+    /* Set return value */
+    ret_value = spans;
+
+done:
+    if (NULL == ret_value) {
+        if (down)
+            H5S__hyper_free_span_info(down);
+        if (spans)
+            H5S__hyper_free_span_info(spans);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_blocks_to_spans_helper() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_blocks_to_spans
+ PURPOSE
+    Create a span tree for the union of a list of blocks
+ USAGE
+    H5S_hyper_span_info_t *H5S__hyper_blocks_to_spans(rank, nblocks, blocks)
+        unsigned rank;          IN: # of dimensions of the space
+        size_t nblocks;         IN: Number of blocks in the list
+        const hsize_t *blocks;  IN: List of blocks
+ RETURNS
+    Pointer to new span tree on success, NULL on failure
+ DESCRIPTION
+    Generates a new span tree for the elements in any of the blocks.  Each
+    block is given by its starting coordinates followed by its ending
+    coordinates, as returned by H5Sget_select_hyper_blocklist().  The blocks
+    may be in any order and may overlap.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Sorting the blocks once per dimension avoids merging each block into the
+    span tree in turn, which is quadratic in the number of blocks.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5S_hyper_span_info_t *
+H5S__hyper_blocks_to_spans(unsigned rank, size_t nblocks, const hsize_t *blocks)
+{
+    H5S_hyper_blk_t *      blks      = NULL; /* Blocks, and scratch space for each dimension */
+    size_t                 u;                /* Local index variable */
+    H5S_hyper_span_info_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(rank > 0);
+    HDassert(nblocks > 0);
+    HDassert(blocks);
+
+    /* Allocate the blocks for the first dimension and scratch space for the others */
+    if (NULL == (blks = (H5S_hyper_blk_t *)H5MM_malloc(sizeof(H5S_hyper_blk_t) * nblocks * rank)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate block list")
+    for (u = 0; u < nblocks; u++)
+        blks[u].coords = blocks + (u * 2 * rank);
+
+    /* Build the span tree */
+    if (NULL ==
+        (ret_value = H5S__hyper_blocks_to_spans_helper(blks, nblocks, rank, 0, blks + nblocks, nblocks)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, NULL, "can't create hyperslab information")
+
+done:
+    if (blks)
+        H5MM_xfree(blks);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_blocks_to_spans() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S__hyper_update_diminfo
@@ -10259,6 +10964,248 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Sselect_hyperslab() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5S__select_hyper_blocklist
+ *
+ * Purpose:     Internal version of H5Sselect_hyper_blocklist().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S__select_hyper_blocklist(H5S_t *space, H5S_seloper_t op, size_t num_blocks, const hsize_t *buf)
+{
+    H5S_hyper_span_info_t *new_spans = NULL;    /* Span tree for the blocks */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(space);
+    HDassert(op > H5S_SELECT_NOOP && op < H5S_SELECT_INVALID);
+    HDassert(num_blocks > 0);
+    HDassert(buf);
+
+    /* Generate span tree for the blocks */
+    if (NULL == (new_spans = H5S__hyper_blocks_to_spans(space->extent.rank, num_blocks, buf)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't create hyperslab information")
+
+    /* Check for operating on unlimited selection */
+    if ((H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS) &&
+        (space->select.sel_info.hslab->unlim_dim >= 0) && (op != H5S_SELECT_SET)) {
+        int unlim_dim = space->select.sel_info.hslab->unlim_dim;
+
+        /* Check for invalid operation */
+        if (!((op == H5S_SELECT_AND) || (op == H5S_SELECT_NOTA)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_UNSUPPORTED, FAIL, "unsupported operation on unlimited selection")
+
+        /* Clip unlimited selection to include the blocks */
+        if (H5S_hyper_clip_unlim(space, new_spans->high_bounds[unlim_dim] + 1) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCLIP, FAIL, "failed to clip unlimited selection")
+    } /* end if */
+
+    /* Fixup operation for non-hyperslab selections */
+    switch (H5S_GET_SELECT_TYPE(space)) {
+        case H5S_SEL_NONE: /* No elements selected in dataspace */
+            switch (op) {
+                case H5S_SELECT_SET: /* Select "set" operation */
+                    /* Change "none" selection to hyperslab selection */
+                    break;
+
+                case H5S_SELECT_OR:      /* Binary "or" operation for hyperslabs */
+                case H5S_SELECT_XOR:     /* Binary "xor" operation for hyperslabs */
+                case H5S_SELECT_NOTA:    /* Binary "B not A" operation for hyperslabs */
+                    op = H5S_SELECT_SET; /* Maps to "set" operation when applied to "none" selection */
+                    break;
+
+                case H5S_SELECT_AND:     /* Binary "and" operation for hyperslabs */
+                case H5S_SELECT_NOTB:    /* Binary "A not B" operation for hyperslabs */
+                    HGOTO_DONE(SUCCEED); /* Selection stays "none" */
+
+                case H5S_SELECT_NOOP:
+                case H5S_SELECT_APPEND:
+                case H5S_SELECT_PREPEND:
+                case H5S_SELECT_INVALID:
+                default:
+                    HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+            } /* end switch */
+            break;
+
+        case H5S_SEL_ALL: /* All elements selected in dataspace */
+            switch (op) {
+                case H5S_SELECT_SET: /* Select "set" operation */
+                    /* Change "all" selection to hyperslab selection */
+                    break;
+
+                case H5S_SELECT_OR:      /* Binary "or" operation for hyperslabs */
+                    HGOTO_DONE(SUCCEED); /* Selection stays "all" */
+
+                case H5S_SELECT_AND:     /* Binary "and" operation for hyperslabs */
+                    op = H5S_SELECT_SET; /* Maps to "set" operation when applied to "all" selection */
+                    break;
+
+                case H5S_SELECT_XOR:  /* Binary "xor" operation for hyperslabs */
+                case H5S_SELECT_NOTB: /* Binary "A not B" operation for hyperslabs */
+                    /* Convert current "all" selection to "real" hyperslab selection */
+                    /* Then allow operation to proceed */
+                    if (H5S_select_hyperslab(space, H5S_SELECT_SET, H5S_hyper_zeros_g, H5S_hyper_ones_g,
+                                             H5S_hyper_ones_g, space->extent.size) < 0)
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't convert selection")
+                    break;
+
+                case H5S_SELECT_NOTA: /* Binary "B not A" operation for hyperslabs */
+                    /* Convert to "none" selection */
+                    if (H5S_select_none(space) < 0)
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't convert selection")
+                    HGOTO_DONE(SUCCEED);
+
+                case H5S_SELECT_NOOP:
+                case H5S_SELECT_APPEND:
+                case H5S_SELECT_PREPEND:
+                case H5S_SELECT_INVALID:
+                default:
+                    HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+            } /* end switch */
+            break;
+
+        case H5S_SEL_HYPERSLABS:
+            /* Hyperslab operation on hyperslab selection, OK */
+            break;
+
+        case H5S_SEL_POINTS:          /* Can't combine hyperslab operations and point selections currently */
+            if (op == H5S_SELECT_SET) /* Allow only "set" operation to proceed */
+                break;
+            /* Else fall through to error */
+            H5_ATTR_FALLTHROUGH
+
+        case H5S_SEL_ERROR:
+        case H5S_SEL_N:
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+    } /* end switch */
+
+    if (op == H5S_SELECT_SET) {
+        /* If we are setting a new selection, remove current selection first */
+        if (H5S_SELECT_RELEASE(space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't release selection")
+
+        /* Allocate space for the hyperslab selection information */
+        if (NULL == (space->select.sel_info.hslab = H5FL_MALLOC(H5S_hyper_sel_t)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab info")
+
+        /* Set the selection to the new span tree */
+        space->select.sel_info.hslab->span_lst  = new_spans;
+        space->select.sel_info.hslab->unlim_dim = -1;
+        space->select.num_elem                  = H5S__hyper_spans_nelem(new_spans);
+
+        /* Indicate that the new_spans are owned */
+        new_spans = NULL;
+
+        /* The selection may still be regular, but that's only worked out when needed */
+        space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
+
+        /* Set selection type */
+        space->select.type = H5S_sel_hyper;
+    } /* end if */
+    else {
+        hbool_t new_spans_owned = FALSE;
+        hbool_t updated_spans   = FALSE;
+
+        /* Sanity check */
+        HDassert(H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS);
+
+        /* Check if there's no hyperslab span information currently */
+        if (NULL == space->select.sel_info.hslab->span_lst)
+            if (H5S__hyper_generate_spans(space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_UNINITIALIZED, FAIL, "dataspace does not have span tree")
+
+        /* Combine the blocks with the current selection */
+        if (H5S__fill_in_new_space(space, op, new_spans, TRUE, &new_spans_owned, &updated_spans, &space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't combine the blocks with the selection")
+
+        /* The regular form of the selection (if any) has to be worked out again */
+        if (updated_spans)
+            space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
+
+        /* Indicate that the new_spans are owned, there's no need to free */
+        if (new_spans_owned)
+            new_spans = NULL;
+    } /* end else */
+
+done:
+    if (new_spans)
+        H5S__hyper_free_span_info(new_spans);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__select_hyper_blocklist() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5Sselect_hyper_blocklist
+ PURPOSE
+    Specify a list of blocks to combine with the current hyperslab selection
+ USAGE
+    herr_t H5Sselect_hyper_blocklist(dsid, op, num_blocks, buf)
+        hid_t dsid;             IN: Dataspace ID of selection to modify
+        H5S_seloper_t op;       IN: Operation to perform on current selection
+        size_t num_blocks;      IN: Number of blocks in BUF
+        const hsize_t *buf;     IN: List of blocks to combine with the selection
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Combines the union of a list of blocks with the current selection for a
+    dataspace, as H5Sselect_hyperslab() does for a single hyperslab.  Each
+    block in BUF is given by its starting coordinates followed by its ending
+    coordinates (inclusive), the same layout that
+    H5Sget_select_hyper_blocklist() returns.  The blocks may be in any order
+    and may overlap.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Selecting many blocks this way is much faster than calling
+    H5Sselect_hyperslab() with H5S_SELECT_OR for each one, since the blocks
+    are sorted and merged into a span tree in one pass, instead of being
+    merged into the selection one at a time.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5Sselect_hyper_blocklist(hid_t spaceid, H5S_seloper_t op, size_t num_blocks, const hsize_t *buf)
+{
+    H5S_t *  space;               /* Dataspace to modify selection of */
+    size_t   u;                   /* Local index variable */
+    unsigned v;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iSsz*h", spaceid, op, num_blocks, buf);
+
+    /* Check args */
+    if (NULL == (space = (H5S_t *)H5I_object_verify(spaceid, H5I_DATASPACE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+    if (H5S_SCALAR == H5S_GET_EXTENT_TYPE(space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "hyperslab doesn't support H5S_SCALAR space")
+    if (H5S_NULL == H5S_GET_EXTENT_TYPE(space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "hyperslab doesn't support H5S_NULL space")
+    if (buf == NULL || num_blocks == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "blocks not specified")
+    if (!(op > H5S_SELECT_NOOP && op < H5S_SELECT_INVALID))
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+    for (u = 0; u < num_blocks; u++) {
+        const hsize_t *block = buf + (u * 2 * space->extent.rank); /* Current block */
+
+        for (v = 0; v < space->extent.rank; v++)
+            if (block[v] > block[space->extent.rank + v])
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "block ends before it starts")
+    } /* end for */
+
+    if (H5S__select_hyper_blocklist(space, op, num_blocks, buf) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to select blocks")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Sselect_hyper_blocklist() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S_combine_hyperslab
@@ -219,6 +219,39 @@ typedef struct {
     hsize_t high_bounds[H5S_MAX_RANK]; /* The largest element selected in each dimension */
 } H5S_hyper_diminfo_t;
 
+/* Enum for state field in H5S_hyper_seq_cache_t */
+typedef enum {
+    H5S_HYPER_SEQ_CACHE_SEEN,   /* Selection iterated over once, sequences not generated */
+    H5S_HYPER_SEQ_CACHE_BUILT,  /* Sequences generated and ready to replay */
+    H5S_HYPER_SEQ_CACHE_TOO_BIG /* Selection has too many sequences to cache */
+} H5S_hyper_seq_cache_state_t;
+
+/* Sequence list of a hyperslab selection, kept so that I/O with the same
+ * selection can replay it instead of generating it again (typedef'd in
+ * H5Sprivate.h).  The key fields describe what the sequences were generated
+ * for and are compared with the selection each time an iterator is set up
+ * to use the cache.
+ */
+struct H5S_hyper_seq_cache_t {
+    unsigned                    count; /* Ref. count of owner and iterators using the cache */
+    H5S_hyper_seq_cache_state_t state; /* State of the cache */
+
+    /* Key */
+    size_t          elmt_size;              /* Size of the elements iterated over */
+    hsize_t         dims[H5S_MAX_RANK];     /* Dataspace extent */
+    hssize_t        sel_off[H5S_MAX_RANK];  /* Selection offset in dataspace */
+    H5S_hyper_dim_t diminfo[H5S_MAX_RANK];  /* Regular selection, when 'spans' is NULL */
+    H5S_hyper_span_info_t *spans;           /* Span tree of an irregular selection */
+                                            /* (Shared with the selection until the sequences are
+                                             *  generated, a private copy afterwards) */
+
+    /* Cached sequences */
+    hsize_t  nelmts; /* # of elements in the sequences */
+    size_t   nseq;   /* # of sequences */
+    hsize_t *off;    /* Array of offsets (in bytes) */
+    size_t * len;    /* Array of lengths (in bytes) */
+};
+
 /* Information about hyperslab selection */
 typedef struct {
     H5S_diminfo_valid_t diminfo_valid; /* Whether the dataset has valid diminfo */
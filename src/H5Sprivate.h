@@ -36,6 +36,7 @@ typedef struct H5S_pnt_node_t        H5S_pnt_node_t;
 typedef struct H5S_pnt_list_t        H5S_pnt_list_t;
 typedef struct H5S_hyper_span_t      H5S_hyper_span_t;
 typedef struct H5S_hyper_span_info_t H5S_hyper_span_info_t;
+typedef struct H5S_hyper_seq_cache_t H5S_hyper_seq_cache_t;
 
 /* Information about one dimension in a hyperslab selection */
 typedef struct H5S_hyper_dim_t {
@@ -74,6 +75,11 @@ typedef struct {
     hsize_t loc_off[H5S_MAX_RANK]; /* Byte offset in buffer, for each dimension's current offset */
     H5S_hyper_span_info_t *spans;  /* Pointer to copy of the span tree */
     H5S_hyper_span_t *     span[H5S_MAX_RANK]; /* Array of pointers to span nodes */
+
+    /* Cached sequence list fields */
+    H5S_hyper_seq_cache_t *seq_cache; /* Cached sequence list to replay, or NULL */
+    size_t                 seq_idx;   /* Index of the next cached sequence */
+    size_t                 seq_done;  /* # of bytes of that sequence already returned */
 } H5S_hyper_iter_t;
 
 /* "All" selection iteration container */
@@ -288,6 +294,9 @@ H5_DLL hsize_t H5S_hyper_get_clip_extent_match(const H5S_t *clip_space, const H5
                                                hsize_t match_clip_size, hbool_t incl_trail);
 H5_DLL H5S_t * H5S_hyper_get_unlim_block(const H5S_t *space, hsize_t block_index);
 H5_DLL hsize_t H5S_hyper_get_first_inc_block(const H5S_t *space, hsize_t clip_size, hbool_t *partial);
+H5_DLL herr_t  H5S_hyper_iter_cache_seq(H5S_sel_iter_t *iter, const H5S_t *space,
+                                        H5S_hyper_seq_cache_t **cache_ptr);
+H5_DLL void    H5S_hyper_seq_cache_free(H5S_hyper_seq_cache_t *cache);
 
 /* Operations on selection iterators */
 H5_DLL herr_t  H5S_select_iter_init(H5S_sel_iter_t *iter, const H5S_t *space, size_t elmt_size,
@@ -155,6 +155,8 @@ H5_DLL herr_t   H5Sget_select_elem_pointlist(hid_t spaceid, hsize_t startpoint,
                                              hsize_t buf[/*numpoints*/]);
 H5_DLL herr_t   H5Sselect_hyperslab(hid_t space_id, H5S_seloper_t op, const hsize_t start[],
                                     const hsize_t _stride[], const hsize_t count[], const hsize_t _block[]);
+H5_DLL herr_t   H5Sselect_hyper_blocklist(hid_t spaceid, H5S_seloper_t op, size_t num_blocks,
+                                          const hsize_t *buf);
 H5_DLL hid_t    H5Scombine_hyperslab(hid_t space_id, H5S_seloper_t op, const hsize_t start[],
                                      const hsize_t _stride[], const hsize_t count[], const hsize_t _block[]);
 H5_DLL herr_t   H5Smodify_select(hid_t space1_id, H5S_seloper_t op, hid_t space2_id);
@@ -5323,6 +5323,33 @@ H5T_path_bkg(const H5T_path_t *p)
     FUNC_LEAVE_NOAPI(p->cdata.need_bkg)
 } /* end H5T_path_bkg() */
 
+/*-------------------------------------------------------------------------
+ * Function:  H5T_path_swap
+ *
+ * Purpose:   Checks if all the conversion path does is reverse the order
+ *            of the bytes in each element, as H5T_swap_copy() does.
+ *
+ * Return:    TRUE/FALSE (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5T_path_swap(const H5T_path_t *p)
+{
+    hbool_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(p);
+
+    /* (Byte order conversions of references are no-ops on little-endian machines) */
+    if (!p->is_noop && !p->conv.is_app && H5T_REFERENCE != p->src->shared->type &&
+        (p->conv.u.lib_func == H5T__conv_order_opt || p->conv.u.lib_func == H5T__conv_order))
+        ret_value = TRUE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_path_swap() */
+
 /*-------------------------------------------------------------------------
  * Function:  H5T__compiler_conv
  *
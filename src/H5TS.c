@@ -14,6 +14,7 @@
 /* private headers */
 #include "H5private.h"   /*library                     */
 #include "H5Eprivate.h"  /*error handling              */
+#include "H5FLprivate.h" /*free lists                  */
 #include "H5MMprivate.h" /*memory management functions    */
 
 #ifdef H5_HAVE_THREADSAFE
@@ -35,6 +36,7 @@ H5TS_once_t H5TS_first_init_g = PTHREAD_ONCE_INIT;
 H5TS_key_t H5TS_errstk_key_g;
 H5TS_key_t H5TS_funcstk_key_g;
 H5TS_key_t H5TS_apictx_key_g;
+H5TS_key_t H5TS_flcache_key_g;
 H5TS_key_t H5TS_cancel_key_g;
 
 #ifndef H5_HAVE_WIN_THREADS
@@ -60,6 +62,54 @@ static pthread_mutex_t H5TS_tid_mtx;
 /* Key for thread-local storage of the thread ID. */
 static H5TS_key_t H5TS_tid_key;
 
+/* Key for thread-local storage of the mutex a thread has given up with
+ * H5TS_mutex_release(), if any. */
+static H5TS_key_t H5TS_released_key;
+
+#ifdef H5TS_HAVE_EPOCHS
+
+/* Number of retired blocks of memory to collect before trying to free them */
+#define H5TS_EPOCH_RECLAIM_MIN 64
+
+/* Most records for retired memory kept for reuse once the memory is freed */
+#define H5TS_EPOCH_POOL_MAX 1024
+
+/* A thread's record of the epoch it's reading in */
+typedef struct H5TS_epoch_rec_t {
+    uint64_t                 active; /* Epoch the thread is reading in, 0 if it isn't reading */
+    unsigned                 depth;  /* # of times the thread has entered the epoch */
+    struct H5TS_epoch_rec_t *prev;   /* Previous thread's record */
+    struct H5TS_epoch_rec_t *next;   /* Next thread's record */
+} H5TS_epoch_rec_t;
+
+/* A retired block of memory, waiting to be freed */
+typedef struct H5TS_epoch_retired_t {
+    void *ptr;                         /* Memory to free */
+    void (*free_func)(void *);         /* Function to free it with */
+    uint64_t epoch;                    /* Epoch it was retired in */
+    struct H5TS_epoch_retired_t *next; /* Next retired block */
+} H5TS_epoch_retired_t;
+
+/* Current epoch, advanced each time memory is retired */
+static uint64_t H5TS_epoch_g = 1;
+
+/* Number of threads reading in an epoch */
+static unsigned H5TS_epoch_nreaders_g = 0;
+
+/* The threads' records, the retired memory & the records kept for reuse, and
+ * the mutex that protects them */
+static H5TS_epoch_rec_t *    H5TS_epoch_recs_g     = NULL;
+static H5TS_epoch_retired_t *H5TS_epoch_retired_g  = NULL;
+static size_t                H5TS_epoch_nretired_g = 0;
+static H5TS_epoch_retired_t *H5TS_epoch_pool_g     = NULL;
+static size_t                H5TS_epoch_npool_g    = 0;
+static pthread_mutex_t       H5TS_epoch_mtx        = PTHREAD_MUTEX_INITIALIZER;
+
+/* Key for thread-local storage of the thread's epoch record */
+static H5TS_key_t H5TS_epoch_key;
+
+#endif /* H5TS_HAVE_EPOCHS */
+
 #endif /* H5_HAVE_WIN_THREADS */
 
 /*--------------------------------------------------------------------------
@@ -120,6 +170,42 @@ H5TS_tid_destructor(void *_v)
     pthread_mutex_unlock(&H5TS_tid_mtx);
 }
 
+#ifdef H5TS_HAVE_EPOCHS
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_epoch_rec_destructor
+ *
+ * USAGE
+ *    H5TS_epoch_rec_destructor()
+ *
+ * RETURNS
+ *
+ * DESCRIPTION
+ *   When a thread shuts down, drop its epoch record.
+ *
+ *--------------------------------------------------------------------------
+ */
+static void
+H5TS_epoch_rec_destructor(void *_rec)
+{
+    H5TS_epoch_rec_t *rec = (H5TS_epoch_rec_t *)_rec;
+
+    if (rec == NULL)
+        return;
+
+    pthread_mutex_lock(&H5TS_epoch_mtx);
+    if (rec->prev)
+        rec->prev->next = rec->next;
+    else
+        H5TS_epoch_recs_g = rec->next;
+    if (rec->next)
+        rec->next->prev = rec->prev;
+    pthread_mutex_unlock(&H5TS_epoch_mtx);
+
+    HDfree(rec);
+}
+#endif /* H5TS_HAVE_EPOCHS */
+
 /*--------------------------------------------------------------------------
  * NAME
  *    H5TS_tid_init
@@ -248,6 +334,9 @@ H5TS_pthread_first_thread_init(void)
     pthread_cond_init(&H5_g.init_lock.cond_var, NULL);
     H5_g.init_lock.lock_count = 0;
 
+    /* initialize global API reader/writer lock */
+    H5TS_rw_lock_init(&H5_g.api_rw_lock);
+
     /* Initialize integer thread identifiers. */
     H5TS_tid_init();
 
@@ -260,8 +349,20 @@ H5TS_pthread_first_thread_init(void)
     /* initialize key for thread-specific API contexts */
     pthread_key_create(&H5TS_apictx_key_g, H5TS_key_destructor);
 
+    /* initialize key for thread-specific free list caches (returned to
+     * the free lists when the thread exits) */
+    pthread_key_create(&H5TS_flcache_key_g, H5FL_thread_cache_release);
+
     /* initialize key for thread cancellability mechanism */
     pthread_key_create(&H5TS_cancel_key_g, H5TS_key_destructor);
+
+    /* initialize key for the lock a thread has given up (not allocated) */
+    pthread_key_create(&H5TS_released_key, NULL);
+
+#ifdef H5TS_HAVE_EPOCHS
+    /* initialize key for thread-specific epoch records */
+    pthread_key_create(&H5TS_epoch_key, H5TS_epoch_rec_destructor);
+#endif /* H5TS_HAVE_EPOCHS */
 }
 #endif /* H5_HAVE_WIN_THREADS */
 
@@ -290,6 +391,8 @@ H5TS_mutex_lock(H5TS_mutex_t *mutex)
 {
 #ifdef H5_HAVE_WIN_THREADS
     EnterCriticalSection(&mutex->CriticalSection);
+    if (0 == mutex->lock_count++)
+        mutex->owner_thread = GetCurrentThreadId();
     return 0;
 #else  /* H5_HAVE_WIN_THREADS */
     herr_t ret_value = pthread_mutex_lock(&mutex->atomic_lock);
@@ -340,6 +443,8 @@ H5TS_mutex_unlock(H5TS_mutex_t *mutex)
 {
 #ifdef H5_HAVE_WIN_THREADS
     /* Releases ownership of the specified critical section object. */
+    if (0 == --mutex->lock_count)
+        mutex->owner_thread = 0;
     LeaveCriticalSection(&mutex->CriticalSection);
     return 0;
 #else  /* H5_HAVE_WIN_THREADS */
@@ -364,6 +469,806 @@ H5TS_mutex_unlock(H5TS_mutex_t *mutex)
 #endif /* H5_HAVE_WIN_THREADS */
 } /* H5TS_mutex_unlock */
 
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_mutex_release
+ *
+ * USAGE
+ *    H5TS_mutex_release(&mutex_var, &released)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Temporarily give up a recursive lock held by the calling thread, so
+ *    that other threads can enter the library while this one is busy
+ *    with work that touches no shared library state (raw data I/O into
+ *    a private buffer, for instance).
+ *
+ *    The lock is only given up when the calling thread holds it exactly
+ *    once: a nested acquisition means an outer library call (e.g. an
+ *    iteration invoking an application callback) is still in progress
+ *    and relies on the state it is holding.  *released reports whether
+ *    the lock was given up and must be passed to H5TS_mutex_reacquire.
+ *
+ *    Critical sections on Windows don't expose their owner, so the lock
+ *    is never given up there.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_mutex_release(H5TS_mutex_t *mutex, hbool_t *released)
+{
+#ifdef H5_HAVE_WIN_THREADS
+    *released = FALSE;
+    return 0;
+#else  /* H5_HAVE_WIN_THREADS */
+    herr_t ret_value;
+
+    *released = FALSE;
+
+    if (0 != (ret_value = pthread_mutex_lock(&mutex->atomic_lock)))
+        return ret_value;
+
+    if (1 == mutex->lock_count && pthread_equal(pthread_self(), mutex->owner_thread)) {
+        mutex->lock_count = 0;
+        *released         = TRUE;
+    } /* end if */
+
+    ret_value = pthread_mutex_unlock(&mutex->atomic_lock);
+
+    if (*released) {
+        int err;
+
+        /* Remember the lock was given up, see H5TS_mutex_released() */
+        pthread_setspecific(H5TS_released_key, (void *)mutex);
+
+        err = pthread_cond_signal(&mutex->cond_var);
+        if (err != 0)
+            ret_value = err;
+    } /* end if */
+
+    return ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_mutex_release */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_mutex_reacquire
+ *
+ * USAGE
+ *    H5TS_mutex_reacquire(&mutex_var, released)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Take back a lock given up with H5TS_mutex_release.  Does nothing
+ *    if the lock wasn't actually given up.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_mutex_reacquire(H5TS_mutex_t *mutex, hbool_t released)
+{
+    if (!released)
+        return 0;
+
+#ifndef H5_HAVE_WIN_THREADS
+    pthread_setspecific(H5TS_released_key, NULL);
+#endif /* H5_HAVE_WIN_THREADS */
+
+    return H5TS_mutex_lock(mutex);
+} /* H5TS_mutex_reacquire */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_mutex_released
+ *
+ * USAGE
+ *    released = H5TS_mutex_released(&mutex_var)
+ *
+ * RETURNS
+ *    TRUE if the calling thread has given up the lock with
+ *    H5TS_mutex_release and not yet taken it back, FALSE otherwise.
+ *
+ * DESCRIPTION
+ *    Lets code that may run either with or without the lock (error
+ *    stack operations, for instance) take it only when it's needed.
+ *    Checking that the lock is simply not held wouldn't do: worker
+ *    threads of a thread that holds the lock must not wait for it.
+ *
+ *--------------------------------------------------------------------------
+ */
+hbool_t
+H5TS_mutex_released(const H5TS_mutex_t *mutex)
+{
+#ifdef H5_HAVE_WIN_THREADS
+    return FALSE;
+#else  /* H5_HAVE_WIN_THREADS */
+    return (pthread_getspecific(H5TS_released_key) == (const void *)mutex);
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_mutex_released */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_rw_lock_init
+ *
+ * USAGE
+ *    H5TS_rw_lock_init(&lock_var)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Initialize a reader/writer lock.  Any number of threads can hold
+ *    the lock shared at once, or a single thread can hold it
+ *    exclusively.  The lock is recursive: a thread that already holds
+ *    it can take it again without waiting, and must release it as many
+ *    times.  Taking the lock exclusively while holding it shared
+ *    upgrades it (see H5TS_rw_wrlock).
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_rw_lock_init(H5TS_rw_lock_t *lock)
+{
+#ifdef H5_HAVE_WIN_THREADS
+    InitializeSRWLock(&lock->lock);
+    lock->upgraded_depth = 0;
+    if (TLS_OUT_OF_INDEXES == (lock->depth_key = TlsAlloc()))
+        return -1;
+    return 0;
+#else  /* H5_HAVE_WIN_THREADS */
+    herr_t ret_value;
+
+    lock->active_readers  = 0;
+    lock->waiting_writers = 0;
+    lock->active_writer   = FALSE;
+    lock->upgrading       = FALSE;
+    lock->upgraded_depth  = 0;
+
+    if (0 != (ret_value = pthread_mutex_init(&lock->mutex, NULL)))
+        return ret_value;
+    if (0 != (ret_value = pthread_cond_init(&lock->readers_cv, NULL)))
+        return ret_value;
+    if (0 != (ret_value = pthread_cond_init(&lock->writers_cv, NULL)))
+        return ret_value;
+    if (0 != (ret_value = pthread_cond_init(&lock->upgrade_cv, NULL)))
+        return ret_value;
+
+    /* Hold counts are stored in the key's value itself, nothing to free */
+    return pthread_key_create(&lock->depth_key, NULL);
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_rw_lock_init */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_rw_lock_destroy
+ *
+ * USAGE
+ *    H5TS_rw_lock_destroy(&lock_var)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Release the resources of a reader/writer lock that no thread holds.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_rw_lock_destroy(H5TS_rw_lock_t *lock)
+{
+#ifdef H5_HAVE_WIN_THREADS
+    /* Slim reader/writer locks need no cleanup */
+    return TlsFree(lock->depth_key) ? 0 : -1;
+#else  /* H5_HAVE_WIN_THREADS */
+    herr_t ret_value = pthread_key_delete(lock->depth_key);
+    int    err;
+
+    if (0 != (err = pthread_cond_destroy(&lock->upgrade_cv)))
+        ret_value = err;
+    if (0 != (err = pthread_cond_destroy(&lock->writers_cv)))
+        ret_value = err;
+    if (0 != (err = pthread_cond_destroy(&lock->readers_cv)))
+        ret_value = err;
+    if (0 != (err = pthread_mutex_destroy(&lock->mutex)))
+        ret_value = err;
+
+    return ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_rw_lock_destroy */
+
+/* Get and set the calling thread's hold count of a reader/writer lock:
+ * positive when it holds the lock shared, negative when exclusively.
+ */
+#define H5TS_RW_DEPTH(lock) ((intptr_t)H5TS_get_thread_local_value((lock)->depth_key))
+#define H5TS_RW_SET_DEPTH(lock, depth)                                                                       \
+    H5TS_set_thread_local_value((lock)->depth_key, (void *)(intptr_t)(depth))
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_rw_rdlock
+ *
+ * USAGE
+ *    H5TS_rw_rdlock(&lock_var)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Take a reader/writer lock shared, waiting while a thread holds it
+ *    exclusively.  Threads waiting to take the lock exclusively are
+ *    preferred over new readers, so a steady stream of readers can't
+ *    starve them.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_rw_rdlock(H5TS_rw_lock_t *lock)
+{
+    intptr_t depth = H5TS_RW_DEPTH(lock);
+#ifndef H5_HAVE_WIN_THREADS
+    herr_t ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+
+    /* Already held by this thread, in either mode */
+    if (depth != 0) {
+        H5TS_RW_SET_DEPTH(lock, depth > 0 ? depth + 1 : depth - 1);
+        return 0;
+    } /* end if */
+
+#ifdef H5_HAVE_WIN_THREADS
+    AcquireSRWLockShared(&lock->lock);
+#else  /* H5_HAVE_WIN_THREADS */
+    if (0 != (ret_value = pthread_mutex_lock(&lock->mutex)))
+        return ret_value;
+
+    while (lock->active_writer || lock->waiting_writers)
+        pthread_cond_wait(&lock->readers_cv, &lock->mutex);
+    lock->active_readers++;
+
+    if (0 != (ret_value = pthread_mutex_unlock(&lock->mutex)))
+        return ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+
+    H5TS_RW_SET_DEPTH(lock, 1);
+
+    return 0;
+} /* H5TS_rw_rdlock */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_rw_wrlock
+ *
+ * USAGE
+ *    H5TS_rw_wrlock(&lock_var)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Take a reader/writer lock exclusively, waiting while other threads
+ *    hold it in either mode.
+ *
+ *    A thread that already holds the lock shared upgrades it, waiting
+ *    until it is the only reader left, and goes back to holding it
+ *    shared when it releases it exclusively.  Two readers waiting to
+ *    upgrade would wait for each other, so when another reader already
+ *    waits to upgrade, the thread gives up its shared hold instead and
+ *    waits like any other writer (other threads may then change what it
+ *    was reading before it gets the lock).  Slim reader/writer locks
+ *    can't be upgraded, so on Windows that is always done.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_rw_wrlock(H5TS_rw_lock_t *lock)
+{
+    intptr_t depth = H5TS_RW_DEPTH(lock);
+#ifndef H5_HAVE_WIN_THREADS
+    herr_t ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+
+    /* Already held exclusively by this thread */
+    if (depth < 0) {
+        H5TS_RW_SET_DEPTH(lock, depth - 1);
+        return 0;
+    } /* end if */
+
+#ifdef H5_HAVE_WIN_THREADS
+    /* Already held shared by this thread: give up the shared hold */
+    if (depth > 0)
+        ReleaseSRWLockShared(&lock->lock);
+
+    AcquireSRWLockExclusive(&lock->lock);
+    if (depth > 0)
+        lock->upgraded_depth = depth;
+#else  /* H5_HAVE_WIN_THREADS */
+    if (0 != (ret_value = pthread_mutex_lock(&lock->mutex)))
+        return ret_value;
+
+    if (depth > 0 && !lock->upgrading) {
+        /* Already held shared by this thread: wait for the other readers to leave */
+        lock->upgrading = TRUE;
+        lock->waiting_writers++;
+        while (lock->active_readers > 1)
+            pthread_cond_wait(&lock->upgrade_cv, &lock->mutex);
+        lock->waiting_writers--;
+        lock->upgrading = FALSE;
+        lock->active_readers--;
+    } /* end if */
+    else {
+        /* Already held shared by this thread, with another reader waiting to
+         * upgrade: give up the shared hold, letting that reader go first */
+        if (depth > 0 && 1 == --lock->active_readers)
+            pthread_cond_signal(&lock->upgrade_cv);
+
+        lock->waiting_writers++;
+        while (lock->active_writer || lock->active_readers)
+            pthread_cond_wait(&lock->writers_cv, &lock->mutex);
+        lock->waiting_writers--;
+    } /* end else */
+    if (depth > 0)
+        lock->upgraded_depth = depth;
+    lock->active_writer = TRUE;
+
+    if (0 != (ret_value = pthread_mutex_unlock(&lock->mutex)))
+        return ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+
+    H5TS_RW_SET_DEPTH(lock, -1);
+
+    return 0;
+} /* H5TS_rw_wrlock */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_rw_upgrade
+ *
+ * USAGE
+ *    H5TS_rw_upgrade(&lock_var, &mutex_var)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Upgrade a reader/writer lock that the calling thread holds shared,
+ *    as H5TS_rw_wrlock does, when the other readers can only leave
+ *    after taking a recursive lock that the calling thread also holds.
+ *    That lock is given up, however many times it is held, while
+ *    waiting for them, and taken back as many times afterwards.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_rw_upgrade(H5TS_rw_lock_t *lock, H5TS_mutex_t *mutex)
+{
+#ifdef H5_HAVE_WIN_THREADS
+    unsigned lock_count = 0; /* # of times the calling thread holds the mutex */
+    unsigned u;              /* Local index variable */
+    herr_t   ret_value;
+
+    /* Give up the mutex */
+    if (mutex->owner_thread == GetCurrentThreadId()) {
+        lock_count          = mutex->lock_count;
+        mutex->lock_count   = 0;
+        mutex->owner_thread = 0;
+        for (u = 0; u < lock_count; u++)
+            LeaveCriticalSection(&mutex->CriticalSection);
+    } /* end if */
+
+    ret_value = H5TS_rw_wrlock(lock);
+
+    /* Take the mutex back */
+    if (lock_count) {
+        for (u = 0; u < lock_count; u++)
+            EnterCriticalSection(&mutex->CriticalSection);
+        mutex->owner_thread = GetCurrentThreadId();
+        mutex->lock_count   = lock_count;
+    } /* end if */
+
+    return ret_value;
+#else  /* H5_HAVE_WIN_THREADS */
+    unsigned lock_count = 0; /* # of times the calling thread holds the mutex */
+    herr_t   ret_value;
+    int      err;
+
+    /* Give up the mutex */
+    if (0 != (ret_value = pthread_mutex_lock(&mutex->atomic_lock)))
+        return ret_value;
+    if (mutex->lock_count && pthread_equal(pthread_self(), mutex->owner_thread)) {
+        lock_count        = mutex->lock_count;
+        mutex->lock_count = 0;
+    } /* end if */
+    if (0 != (ret_value = pthread_mutex_unlock(&mutex->atomic_lock)))
+        return ret_value;
+    if (lock_count && 0 != (ret_value = pthread_cond_signal(&mutex->cond_var)))
+        return ret_value;
+
+    ret_value = H5TS_rw_wrlock(lock);
+
+    /* Take the mutex back */
+    if (lock_count) {
+        if (0 != (err = pthread_mutex_lock(&mutex->atomic_lock)))
+            return err;
+        while (mutex->lock_count)
+            pthread_cond_wait(&mutex->cond_var, &mutex->atomic_lock);
+        mutex->owner_thread = pthread_self();
+        mutex->lock_count   = lock_count;
+        if (0 != (err = pthread_mutex_unlock(&mutex->atomic_lock)))
+            return err;
+    } /* end if */
+
+    return ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_rw_upgrade */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_rw_unlock
+ *
+ * USAGE
+ *    H5TS_rw_unlock(&lock_var)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Release a reader/writer lock taken with H5TS_rw_rdlock or
+ *    H5TS_rw_wrlock, letting other threads take it once the calling
+ *    thread has released it as many times as it took it.  A thread
+ *    that upgraded the lock holds it shared again once it has released
+ *    it as many times as it took it exclusively.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_rw_unlock(H5TS_rw_lock_t *lock)
+{
+    intptr_t depth = H5TS_RW_DEPTH(lock);
+#ifndef H5_HAVE_WIN_THREADS
+    herr_t ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+
+    /* Not held by this thread */
+    if (depth == 0)
+        return -1;
+
+    /* Still held by this thread after this release */
+    if (depth > 1 || depth < -1) {
+        H5TS_RW_SET_DEPTH(lock, depth > 0 ? depth - 1 : depth + 1);
+        return 0;
+    } /* end if */
+
+#ifdef H5_HAVE_WIN_THREADS
+    if (depth > 0) {
+        H5TS_RW_SET_DEPTH(lock, 0);
+        ReleaseSRWLockShared(&lock->lock);
+    } /* end if */
+    else {
+        intptr_t upgraded_depth = lock->upgraded_depth;
+
+        lock->upgraded_depth = 0;
+        ReleaseSRWLockExclusive(&lock->lock);
+
+        /* A writer that upgraded the lock goes back to holding it shared */
+        if (upgraded_depth)
+            AcquireSRWLockShared(&lock->lock);
+        H5TS_RW_SET_DEPTH(lock, upgraded_depth);
+    } /* end else */
+
+    return 0;
+#else  /* H5_HAVE_WIN_THREADS */
+    if (0 != (ret_value = pthread_mutex_lock(&lock->mutex)))
+        return ret_value;
+
+    if (depth > 0) {
+        H5TS_RW_SET_DEPTH(lock, 0);
+
+        /* The last reader to leave lets a waiting writer in, or the one
+         * but last a reader waiting to upgrade */
+        if (0 == --lock->active_readers && lock->waiting_writers)
+            ret_value = pthread_cond_signal(&lock->writers_cv);
+        else if (1 == lock->active_readers && lock->upgrading)
+            ret_value = pthread_cond_signal(&lock->upgrade_cv);
+    } /* end if */
+    else {
+        lock->active_writer = FALSE;
+
+        /* A writer that upgraded the lock goes back to holding it shared */
+        if (lock->upgraded_depth) {
+            H5TS_RW_SET_DEPTH(lock, lock->upgraded_depth);
+            lock->upgraded_depth = 0;
+            lock->active_readers++;
+        } /* end if */
+        else
+            H5TS_RW_SET_DEPTH(lock, 0);
+
+        if (lock->waiting_writers) {
+            if (0 == lock->active_readers)
+                ret_value = pthread_cond_signal(&lock->writers_cv);
+        } /* end if */
+        else
+            ret_value = pthread_cond_broadcast(&lock->readers_cv);
+    } /* end else */
+
+    if (0 == ret_value)
+        ret_value = pthread_mutex_unlock(&lock->mutex);
+    else
+        (void)pthread_mutex_unlock(&lock->mutex);
+
+    return ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_rw_unlock */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_rw_lock_shared
+ *
+ * USAGE
+ *    shared = H5TS_rw_lock_shared(&lock_var)
+ *
+ * RETURNS
+ *    TRUE if the calling thread holds the lock shared, FALSE otherwise.
+ *
+ *--------------------------------------------------------------------------
+ */
+hbool_t
+H5TS_rw_lock_shared(const H5TS_rw_lock_t *lock)
+{
+    return (H5TS_RW_DEPTH(lock) > 0);
+} /* H5TS_rw_lock_shared */
+
+#ifdef H5TS_HAVE_EPOCHS
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_epoch_enter
+ *
+ * USAGE
+ *    H5TS_epoch_enter()
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Start reading library data structures without the API lock.  Until
+ *    the matching H5TS_epoch_exit(), no memory retired with
+ *    H5TS_epoch_retire() after the calling thread could have seen it is
+ *    freed.  Calls can be nested.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_epoch_enter(void)
+{
+    H5TS_epoch_rec_t *rec = (H5TS_epoch_rec_t *)H5TS_get_thread_local_value(H5TS_epoch_key);
+
+    if (!rec) {
+        /*
+         * First time the thread reads without the API lock - create its
+         * record.
+         *
+         * Don't use H5MM calls here since the destructor has to use HDfree in
+         * order to avoid codestack calls.
+         */
+        if (NULL == (rec = (H5TS_epoch_rec_t *)HDcalloc(1, sizeof(H5TS_epoch_rec_t))))
+            return FAIL;
+
+        pthread_mutex_lock(&H5TS_epoch_mtx);
+        rec->next = H5TS_epoch_recs_g;
+        if (H5TS_epoch_recs_g)
+            H5TS_epoch_recs_g->prev = rec;
+        H5TS_epoch_recs_g = rec;
+        pthread_mutex_unlock(&H5TS_epoch_mtx);
+
+        H5TS_set_thread_local_value(H5TS_epoch_key, (void *)rec);
+    } /* end if */
+
+    if (0 == rec->depth++) {
+        /* Announce the epoch, and make certain the announcement is seen
+         * before anything the thread reads next */
+        (void)H5TS_atomic_fetch_add(&H5TS_epoch_nreaders_g, 1U);
+        H5TS_atomic_store(&rec->active, H5TS_atomic_load(&H5TS_epoch_g));
+        H5TS_atomic_fence();
+    } /* end if */
+
+    return SUCCEED;
+} /* H5TS_epoch_enter */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_epoch_exit
+ *
+ * USAGE
+ *    H5TS_epoch_exit()
+ *
+ * RETURNS
+ *
+ * DESCRIPTION
+ *    Stop reading library data structures without the API lock.
+ *
+ *--------------------------------------------------------------------------
+ */
+void
+H5TS_epoch_exit(void)
+{
+    H5TS_epoch_rec_t *rec = (H5TS_epoch_rec_t *)H5TS_get_thread_local_value(H5TS_epoch_key);
+
+    HDassert(rec && rec->depth > 0);
+
+    if (0 == --rec->depth) {
+        H5TS_atomic_store(&rec->active, (uint64_t)0);
+        (void)H5TS_atomic_fetch_sub(&H5TS_epoch_nreaders_g, 1U);
+    } /* end if */
+} /* H5TS_epoch_exit */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_epoch_oldest
+ *
+ * USAGE
+ *    epoch = H5TS_epoch_oldest()
+ *
+ * RETURNS
+ *    Oldest epoch a thread is reading in, UINT64_MAX if none is reading.
+ *
+ *--------------------------------------------------------------------------
+ */
+static uint64_t
+H5TS_epoch_oldest(void)
+{
+    H5TS_epoch_rec_t *rec;
+    uint64_t          ret_value = UINT64_MAX;
+
+    /* Make certain that everything unpublished so far is seen by threads
+     * that announce an epoch after this */
+    H5TS_atomic_fence();
+
+    pthread_mutex_lock(&H5TS_epoch_mtx);
+    for (rec = H5TS_epoch_recs_g; rec != NULL; rec = rec->next) {
+        uint64_t active = H5TS_atomic_load(&rec->active);
+
+        if (active != 0 && active < ret_value)
+            ret_value = active;
+    } /* end for */
+    pthread_mutex_unlock(&H5TS_epoch_mtx);
+
+    return ret_value;
+} /* H5TS_epoch_oldest */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_epoch_retire
+ *
+ * USAGE
+ *    H5TS_epoch_retire(ptr, free_func)
+ *
+ * RETURNS
+ *
+ * DESCRIPTION
+ *    Free memory that threads reading without the API lock may still
+ *    see, once none of them can.  It must already be unreachable for
+ *    threads that start reading from now on.  FREE_FUNC is called with
+ *    the API lock held.
+ *
+ *    When no thread is reading, the memory is freed right away.
+ *    Otherwise it's put on a list, in a record reused from memory freed
+ *    earlier where possible.
+ *
+ *--------------------------------------------------------------------------
+ */
+void
+H5TS_epoch_retire(void *ptr, void (*free_func)(void *))
+{
+    H5TS_epoch_retired_t *retired;
+    hbool_t               reclaim = FALSE;
+
+    /* Readers count themselves before they look at anything, so when none
+     * is counted after the memory was made unreachable, none can see it */
+    H5TS_atomic_fence();
+    if (0 == H5TS_atomic_load(&H5TS_epoch_nreaders_g)) {
+        (free_func)(ptr);
+        return;
+    } /* end if */
+
+    /* Reuse a record, if there's one */
+    pthread_mutex_lock(&H5TS_epoch_mtx);
+    if (NULL != (retired = H5TS_epoch_pool_g)) {
+        H5TS_epoch_pool_g = retired->next;
+        H5TS_epoch_npool_g--;
+    } /* end if */
+    pthread_mutex_unlock(&H5TS_epoch_mtx);
+
+    if (NULL == retired &&
+        NULL == (retired = (H5TS_epoch_retired_t *)HDmalloc(sizeof(H5TS_epoch_retired_t)))) {
+        uint64_t epoch = H5TS_atomic_fetch_add(&H5TS_epoch_g, (uint64_t)1);
+
+        /* Can't keep track of the memory, wait until no thread can see it */
+        while (H5TS_epoch_oldest() <= epoch)
+            H5_nanosleep((uint64_t)1000);
+        (free_func)(ptr);
+        return;
+    } /* end if */
+
+    retired->ptr       = ptr;
+    retired->free_func = free_func;
+
+    pthread_mutex_lock(&H5TS_epoch_mtx);
+    retired->epoch       = H5TS_atomic_fetch_add(&H5TS_epoch_g, (uint64_t)1);
+    retired->next        = H5TS_epoch_retired_g;
+    H5TS_epoch_retired_g = retired;
+    if (++H5TS_epoch_nretired_g >= H5TS_EPOCH_RECLAIM_MIN)
+        reclaim = TRUE;
+    pthread_mutex_unlock(&H5TS_epoch_mtx);
+
+    if (reclaim)
+        H5TS_epoch_reclaim();
+} /* H5TS_epoch_retire */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_epoch_reclaim
+ *
+ * USAGE
+ *    H5TS_epoch_reclaim()
+ *
+ * RETURNS
+ *
+ * DESCRIPTION
+ *    Free the retired memory that no thread can see anymore.  Called with
+ *    the API lock held.
+ *
+ *--------------------------------------------------------------------------
+ */
+void
+H5TS_epoch_reclaim(void)
+{
+    H5TS_epoch_retired_t * to_free = NULL;
+    H5TS_epoch_retired_t **retired;
+    H5TS_epoch_retired_t * tmp;
+    uint64_t               oldest = H5TS_epoch_oldest();
+
+    /* Take the memory retired before the oldest epoch being read in */
+    pthread_mutex_lock(&H5TS_epoch_mtx);
+    retired = &H5TS_epoch_retired_g;
+    while (*retired != NULL)
+        if ((*retired)->epoch < oldest) {
+            tmp       = *retired;
+            *retired  = tmp->next;
+            tmp->next = to_free;
+            to_free   = tmp;
+            H5TS_epoch_nretired_g--;
+        } /* end if */
+        else
+            retired = &(*retired)->next;
+    pthread_mutex_unlock(&H5TS_epoch_mtx);
+    if (NULL == to_free)
+        return;
+
+    /* Free it */
+    for (tmp = to_free; tmp != NULL; tmp = tmp->next)
+        (tmp->free_func)(tmp->ptr);
+
+    /* Keep the records for reuse, up to a limit */
+    pthread_mutex_lock(&H5TS_epoch_mtx);
+    while (to_free != NULL && H5TS_epoch_npool_g < H5TS_EPOCH_POOL_MAX) {
+        tmp               = to_free->next;
+        to_free->next     = H5TS_epoch_pool_g;
+        H5TS_epoch_pool_g = to_free;
+        H5TS_epoch_npool_g++;
+        to_free = tmp;
+    } /* end while */
+    pthread_mutex_unlock(&H5TS_epoch_mtx);
+    while (to_free != NULL) {
+        tmp = to_free->next;
+        HDfree(to_free);
+        to_free = tmp;
+    } /* end while */
+} /* H5TS_epoch_reclaim */
+#endif /* H5TS_HAVE_EPOCHS */
+
 /*--------------------------------------------------------------------------
  * NAME
  *    H5TS_cancel_count_inc
@@ -492,6 +1397,10 @@ H5TS_win32_process_enter(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpContex)
     /* Initialize the critical section (can't fail) */
     InitializeCriticalSection(&H5_g.init_lock.CriticalSection);
 
+    /* Initialize the API reader/writer lock */
+    if (H5TS_rw_lock_init(&H5_g.api_rw_lock) < 0)
+        ret_value = FALSE;
+
     /* Set up thread local storage */
     if (TLS_OUT_OF_INDEXES == (H5TS_errstk_key_g = TlsAlloc()))
         ret_value = FALSE;
@@ -504,6 +1413,9 @@ H5TS_win32_process_enter(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpContex)
     if (TLS_OUT_OF_INDEXES == (H5TS_apictx_key_g = TlsAlloc()))
         ret_value = FALSE;
 
+    if (TLS_OUT_OF_INDEXES == (H5TS_flcache_key_g = TlsAlloc()))
+        ret_value = FALSE;
+
     return ret_value;
 } /* H5TS_win32_process_enter() */
 #endif /* H5_HAVE_WIN_THREADS */
@@ -564,6 +1476,7 @@ H5TS_win32_process_exit(void)
 
     /* Clean up critical section resources (can't fail) */
     DeleteCriticalSection(&H5_g.init_lock.CriticalSection);
+    H5TS_rw_lock_destroy(&H5_g.api_rw_lock);
 
     /* Clean up per-process thread local storage */
     TlsFree(H5TS_errstk_key_g);
@@ -571,6 +1484,7 @@ H5TS_win32_process_exit(void)
     TlsFree(H5TS_funcstk_key_g);
 #endif /* H5_HAVE_CODESTACK */
     TlsFree(H5TS_apictx_key_g);
+    TlsFree(H5TS_flcache_key_g);
 
     return;
 } /* H5TS_win32_process_exit() */
@@ -618,6 +1532,11 @@ H5TS_win32_thread_exit(void)
     if (lpvData)
         LocalFree((HLOCAL)lpvData);
 
+    /* Return the objects in the thread's free list cache to the free lists */
+    lpvData = TlsGetValue(H5TS_flcache_key_g);
+    if (lpvData)
+        H5FL_thread_cache_release(lpvData);
+
     return ret_value;
 } /* H5TS_win32_thread_exit() */
 #endif /* H5_HAVE_WIN_THREADS */
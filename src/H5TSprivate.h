@@ -37,12 +37,22 @@
 /* Mutexes, Threads, and Attributes */
 typedef struct H5TS_mutex_struct {
     CRITICAL_SECTION CriticalSection;
+    DWORD            owner_thread; /* ID of the thread holding the lock, 0 if none */
+    unsigned int     lock_count;   /* # of times the owner holds the lock */
 } H5TS_mutex_t;
-typedef CRITICAL_SECTION H5TS_mutex_simple_t;
-typedef HANDLE           H5TS_thread_t;
-typedef HANDLE           H5TS_attr_t;
-typedef DWORD            H5TS_key_t;
-typedef INIT_ONCE        H5TS_once_t;
+typedef CRITICAL_SECTION   H5TS_mutex_simple_t;
+typedef CONDITION_VARIABLE H5TS_cond_t;
+typedef HANDLE             H5TS_thread_t;
+typedef HANDLE             H5TS_attr_t;
+typedef DWORD              H5TS_key_t;
+typedef INIT_ONCE          H5TS_once_t;
+
+/* Reader/writer lock */
+typedef struct H5TS_rw_lock_struct {
+    SRWLOCK    lock;           /* Slim reader/writer lock */
+    intptr_t   upgraded_depth; /* Shared hold count of the writer that upgraded, 0 if it didn't */
+    H5TS_key_t depth_key;      /* Per-thread hold count, negative when held exclusively */
+} H5TS_rw_lock_t;
 
 /* Defines */
 /* not used on windows side, but need to be defined to something */
@@ -60,6 +70,11 @@ typedef INIT_ONCE        H5TS_once_t;
 #define H5TS_mutex_init(mutex)                  InitializeCriticalSection(mutex)
 #define H5TS_mutex_lock_simple(mutex)           EnterCriticalSection(mutex)
 #define H5TS_mutex_unlock_simple(mutex)         LeaveCriticalSection(mutex)
+#define H5TS_mutex_destroy(mutex)               DeleteCriticalSection(mutex)
+#define H5TS_cond_init(cond)                    InitializeConditionVariable(cond)
+#define H5TS_cond_wait(cond, mutex)             SleepConditionVariableCS(cond, mutex, INFINITE)
+#define H5TS_cond_broadcast(cond)               WakeAllConditionVariable(cond)
+#define H5TS_cond_destroy(cond)                 /* void */
 
 /* Functions called from DllMain */
 H5_DLL BOOL CALLBACK H5TS_win32_process_enter(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpContex);
@@ -83,9 +98,24 @@ typedef struct H5TS_mutex_struct {
 typedef pthread_t       H5TS_thread_t;
 typedef pthread_attr_t  H5TS_attr_t;
 typedef pthread_mutex_t H5TS_mutex_simple_t;
+typedef pthread_cond_t  H5TS_cond_t;
 typedef pthread_key_t   H5TS_key_t;
 typedef pthread_once_t  H5TS_once_t;
 
+/* Reader/writer lock */
+typedef struct H5TS_rw_lock_struct {
+    pthread_mutex_t mutex;           /* Protects the fields below */
+    pthread_cond_t  readers_cv;      /* Signaled when readers may enter */
+    pthread_cond_t  writers_cv;      /* Signaled when a writer may enter */
+    pthread_cond_t  upgrade_cv;      /* Signaled when a reader waiting to upgrade is the only one left */
+    unsigned        active_readers;  /* Number of threads holding the lock shared */
+    unsigned        waiting_writers; /* Number of threads waiting to hold the lock exclusively */
+    hbool_t         active_writer;   /* Whether a thread holds the lock exclusively */
+    hbool_t         upgrading;       /* Whether a reader waits to hold the lock exclusively */
+    intptr_t        upgraded_depth;  /* Shared hold count of the writer that upgraded, 0 if it didn't */
+    H5TS_key_t      depth_key;       /* Per-thread hold count, negative when held exclusively */
+} H5TS_rw_lock_t;
+
 /* Scope Definitions */
 #define H5TS_SCOPE_SYSTEM                       PTHREAD_SCOPE_SYSTEM
 #define H5TS_SCOPE_PROCESS                      PTHREAD_SCOPE_PROCESS
@@ -101,15 +131,35 @@ typedef pthread_once_t  H5TS_once_t;
 #define H5TS_mutex_init(mutex)                  pthread_mutex_init(mutex, NULL)
 #define H5TS_mutex_lock_simple(mutex)           pthread_mutex_lock(mutex)
 #define H5TS_mutex_unlock_simple(mutex)         pthread_mutex_unlock(mutex)
+#define H5TS_mutex_destroy(mutex)               pthread_mutex_destroy(mutex)
+#define H5TS_cond_init(cond)                    pthread_cond_init(cond, NULL)
+#define H5TS_cond_wait(cond, mutex)             pthread_cond_wait(cond, mutex)
+#define H5TS_cond_broadcast(cond)               pthread_cond_broadcast(cond)
+#define H5TS_cond_destroy(cond)                 pthread_cond_destroy(cond)
 H5_DLL uint64_t H5TS_thread_id(void);
 
 #endif /* H5_HAVE_WIN_THREADS */
 
+/* Where atomic operations are available, some library data structures are
+ * read without the API lock.  Memory they stop using is retired, and only
+ * freed once no thread reading them can still see it (see H5TS_epoch_enter).
+ */
+#if defined(__GNUC__) && !defined(H5_HAVE_WIN_THREADS)
+#define H5TS_HAVE_EPOCHS
+
+#define H5TS_atomic_load(ptr)           __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#define H5TS_atomic_store(ptr, val)     __atomic_store_n(ptr, val, __ATOMIC_RELEASE)
+#define H5TS_atomic_fetch_add(ptr, val) __atomic_fetch_add(ptr, val, __ATOMIC_ACQ_REL)
+#define H5TS_atomic_fetch_sub(ptr, val) __atomic_fetch_sub(ptr, val, __ATOMIC_ACQ_REL)
+#define H5TS_atomic_fence()             __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif /* defined(__GNUC__) && !defined(H5_HAVE_WIN_THREADS) */
+
 /* External global variables */
 extern H5TS_once_t H5TS_first_init_g;
 extern H5TS_key_t  H5TS_errstk_key_g;
 extern H5TS_key_t  H5TS_funcstk_key_g;
 extern H5TS_key_t  H5TS_apictx_key_g;
+extern H5TS_key_t  H5TS_flcache_key_g;
 
 #if defined c_plusplus || defined __cplusplus
 extern "C" {
@@ -118,9 +168,25 @@ extern "C" {
 H5_DLL void          H5TS_pthread_first_thread_init(void);
 H5_DLL herr_t        H5TS_mutex_lock(H5TS_mutex_t *mutex);
 H5_DLL herr_t        H5TS_mutex_unlock(H5TS_mutex_t *mutex);
+H5_DLL herr_t        H5TS_mutex_release(H5TS_mutex_t *mutex, hbool_t *released);
+H5_DLL herr_t        H5TS_mutex_reacquire(H5TS_mutex_t *mutex, hbool_t released);
+H5_DLL hbool_t       H5TS_mutex_released(const H5TS_mutex_t *mutex);
+H5_DLL herr_t        H5TS_rw_lock_init(H5TS_rw_lock_t *lock);
+H5_DLL herr_t        H5TS_rw_lock_destroy(H5TS_rw_lock_t *lock);
+H5_DLL herr_t        H5TS_rw_rdlock(H5TS_rw_lock_t *lock);
+H5_DLL herr_t        H5TS_rw_wrlock(H5TS_rw_lock_t *lock);
+H5_DLL herr_t        H5TS_rw_upgrade(H5TS_rw_lock_t *lock, H5TS_mutex_t *mutex);
+H5_DLL herr_t        H5TS_rw_unlock(H5TS_rw_lock_t *lock);
+H5_DLL hbool_t       H5TS_rw_lock_shared(const H5TS_rw_lock_t *lock);
 H5_DLL herr_t        H5TS_cancel_count_inc(void);
 H5_DLL herr_t        H5TS_cancel_count_dec(void);
 H5_DLL H5TS_thread_t H5TS_create_thread(void *(*func)(void *), H5TS_attr_t *attr, void *udata);
+#ifdef H5TS_HAVE_EPOCHS
+H5_DLL herr_t H5TS_epoch_enter(void);
+H5_DLL void   H5TS_epoch_exit(void);
+H5_DLL void   H5TS_epoch_retire(void *ptr, void (*free_func)(void *));
+H5_DLL void   H5TS_epoch_reclaim(void);
+#endif /* H5TS_HAVE_EPOCHS */
 
 #if defined c_plusplus || defined __cplusplus
 }
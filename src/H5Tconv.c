@@ -34,6 +34,13 @@
 #include "H5Pprivate.h"  /* Property lists            */
 #include "H5Tpkg.h"      /* Datatypes                */
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef H5_HAVE_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
 /****************/
 /* Local Macros */
 /****************/
@@ -702,6 +709,59 @@
     }
 #endif /* H5_WANT_DCONV_EXCEPTION */
 
+/*
+ * When there's no exception callback, packed elements of the common native
+ * types are converted with vector instructions where the CPU has them.  The
+ * vector kernels are chosen by the kind (signed or unsigned integer, or
+ * floating-point) and the size of the source and destination types, and
+ * give the same results as the "no exception" cores above: out-of-range
+ * integers saturate, out-of-range floats become infinities and NaNs convert
+ * to integers as the CPU's scalar instructions convert them.
+ */
+#define H5T_CONV_VEC_SINT  0x100 /* Signed integers */
+#define H5T_CONV_VEC_UINT  0x200 /* Unsigned integers */
+#define H5T_CONV_VEC_FLOAT 0x400 /* Floating-point values */
+
+#define H5T_CONV_VEC_KIND_SCHAR   H5T_CONV_VEC_SINT
+#define H5T_CONV_VEC_KIND_UCHAR   H5T_CONV_VEC_UINT
+#define H5T_CONV_VEC_KIND_SHORT   H5T_CONV_VEC_SINT
+#define H5T_CONV_VEC_KIND_USHORT  H5T_CONV_VEC_UINT
+#define H5T_CONV_VEC_KIND_INT     H5T_CONV_VEC_SINT
+#define H5T_CONV_VEC_KIND_UINT    H5T_CONV_VEC_UINT
+#define H5T_CONV_VEC_KIND_LONG    H5T_CONV_VEC_SINT
+#define H5T_CONV_VEC_KIND_ULONG   H5T_CONV_VEC_UINT
+#define H5T_CONV_VEC_KIND_LLONG   H5T_CONV_VEC_SINT
+#define H5T_CONV_VEC_KIND_ULLONG  H5T_CONV_VEC_UINT
+#define H5T_CONV_VEC_KIND_FLOAT   H5T_CONV_VEC_FLOAT
+#define H5T_CONV_VEC_KIND_DOUBLE  H5T_CONV_VEC_FLOAT
+#define H5T_CONV_VEC_KIND_LDOUBLE 0 /* Never converted with vector instructions */
+
+/* The kind and size of a type, and of a pair of source & destination types */
+#define H5T_CONV_VEC_TYPE(TYPE, T)  (H5_GLUE(H5T_CONV_VEC_KIND_, TYPE) | (unsigned)sizeof(T))
+#define H5T_CONV_VEC_PAIR(SRC, DST) (((unsigned)(SRC) << 16) | (unsigned)(DST))
+
+/* Convert as many of the SAFE elements as possible with vector instructions,
+ * leaving the rest for the element-by-element loop */
+#ifdef __SSE2__
+#define H5T_CONV_VEC(STYPE, DTYPE, ST, DT)                                                                   \
+    if (!cb_struct.func && s_stride == (ssize_t)sizeof(ST) && d_stride == (ssize_t)sizeof(DT)) {             \
+        size_t nvec; /* # of elements converted with vector instructions */                                  \
+                                                                                                             \
+        if (!H5T_conv_hw_vec_init_g)                                                                         \
+            H5T__conv_hw_vec_init();                                                                         \
+        nvec = H5T_conv_hw_vec_g(H5T_CONV_VEC_TYPE(STYPE, ST), H5T_CONV_VEC_TYPE(DTYPE, DT), safe,           \
+                                 (const uint8_t *)src, (uint8_t *)dst);                                      \
+        safe -= nvec;                                                                                        \
+        nelmts -= nvec;                                                                                      \
+                                                                                                             \
+        /* Skip the elements converted */                                                                    \
+        src = (ST *)(src_buf = (void *)((uint8_t *)src_buf + (nvec * sizeof(ST))));                          \
+        dst = (DT *)(dst_buf = (void *)((uint8_t *)dst_buf + (nvec * sizeof(DT))));                          \
+    }
+#else
+#define H5T_CONV_VEC(STYPE, DTYPE, ST, DT) /* void */
+#endif
+
 /* The main part of every integer hardware conversion macro */
 #define H5T_CONV(GUTS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, PREC)                                             \
     {                                                                                                        \
@@ -837,6 +897,7 @@
                         }                                                                                    \
                         else {                                                                               \
                             /* Alignment is not required for both source and destination */                  \
+                            H5T_CONV_VEC(STYPE, DTYPE, ST, DT)                                               \
                             H5T_CONV_LOOP_OUTER(PRE_SNOALIGN, PRE_DNOALIGN, POST_SNOALIGN, POST_DNOALIGN,    \
                                                 GUTS, STYPE, DTYPE, src, dst, ST, DT, D_MIN, D_MAX)          \
                         }                                                                                    \
@@ -1032,6 +1093,29 @@ done:
 /* Minimum size of variable-length conversion buffer */
 #define H5T_VLEN_MIN_CONF_BUF_SIZE 4096
 
+#ifdef H5_HAVE_AVX2_DISPATCH
+#define H5T_CONV_SSSE3 __attribute__((target("ssse3")))
+#define H5T_CONV_AVX2  __attribute__((target("avx2")))
+#endif
+
+/* Mark the arguments that only the byte swapping kernels use, for builds without them */
+#ifdef H5_HAVE_AVX2_DISPATCH
+#define H5T_SWAP_VEC_USED /*void*/
+#else
+#define H5T_SWAP_VEC_USED H5_ATTR_UNUSED
+#endif
+
+/* Loop over the vectors of N elements in the hardware conversion kernels */
+#define H5T_CONV_VEC_LOOP(N) for (; n + (N) <= nelmts; n += (N), src += (N)*ssize, dst += (N)*dsize)
+
+/* Unaligned loads and stores of 128-bit integer vectors, and their low halves */
+#define H5T_CONV_VEC_LOAD(P)     _mm_loadu_si128((const __m128i *)(P))
+#define H5T_CONV_VEC_STORE(P, V) _mm_storeu_si128((__m128i *)(P), V)
+#define H5T_CONV_VEC_LOADL(P)    _mm_loadl_epi64((const __m128i *)(P))
+
+/* Replace the lanes of V selected by MASK with those of W */
+#define H5T_CONV_VEC_SELECT(MASK, V, W) _mm_or_si128(_mm_andnot_si128(MASK, V), _mm_and_si128(MASK, W))
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -1059,6 +1143,17 @@ typedef struct H5T_conv_hw_t {
     size_t d_aligned; /*number destination elements aligned*/
 } H5T_conv_hw_t;
 
+/* Vector kernel that converts as many as it can of the NELMTS packed
+ * elements in SRC from SRC_TYPE to DST_TYPE (see H5T_CONV_VEC_TYPE), into
+ * DST, and returns the number of elements converted */
+typedef size_t (*H5T_conv_hw_vec_t)(unsigned src_type, unsigned dst_type, size_t nelmts, const uint8_t *src,
+                                    uint8_t *dst);
+
+/* Vector kernel that reverses the bytes of the elements in the first
+ * NBYTES bytes of SRC, into DST, with the shuffle control vector MASK, and
+ * returns the number of bytes done */
+typedef size_t (*H5T_swap_vec_t)(uint8_t *dst, const uint8_t *src, size_t nbytes, const uint8_t *mask);
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -1068,6 +1163,21 @@ typedef struct H5T_conv_hw_t {
 /********************/
 
 static herr_t H5T__reverse_order(uint8_t *rev, uint8_t *s, size_t size, H5T_order_t order);
+static size_t H5T__swap_vec(uint8_t *dst, const uint8_t *src, size_t nelmts, size_t size);
+#ifdef H5_HAVE_AVX2_DISPATCH
+static void   H5T__swap_init(void);
+static size_t H5T__swap_ssse3(uint8_t *dst, const uint8_t *src, size_t nbytes, const uint8_t *mask);
+static size_t H5T__swap_avx2(uint8_t *dst, const uint8_t *src, size_t nbytes, const uint8_t *mask);
+#endif /* H5_HAVE_AVX2_DISPATCH */
+#ifdef __SSE2__
+static void   H5T__conv_hw_vec_init(void);
+static size_t H5T__conv_hw_vec_sse2(unsigned src_type, unsigned dst_type, size_t nelmts, const uint8_t *src,
+                                    uint8_t *dst);
+#endif /* __SSE2__ */
+#ifdef H5_HAVE_AVX2_DISPATCH
+static size_t H5T__conv_hw_vec_avx2(unsigned src_type, unsigned dst_type, size_t nelmts, const uint8_t *src,
+                                    uint8_t *dst);
+#endif /* H5_HAVE_AVX2_DISPATCH */
 
 /*********************/
 /* Public Variables */
@@ -1094,6 +1204,25 @@ H5FL_BLK_DEFINE_STATIC(array_seq);
 /* Declare a free list to manage pieces of reference data */
 H5FL_BLK_DEFINE_STATIC(ref_seq);
 
+#ifdef __SSE2__
+/* Vector kernel for the hardware conversions on the CPU that's running, chosen on first use */
+static hbool_t           H5T_conv_hw_vec_init_g = FALSE;
+static H5T_conv_hw_vec_t H5T_conv_hw_vec_g      = NULL;
+#endif /* __SSE2__ */
+
+#ifdef H5_HAVE_AVX2_DISPATCH
+/* Shuffle control vectors that reverse the bytes of the 2-, 4-, 8- and
+ * 16-byte elements in a 16-byte vector */
+static const uint8_t H5T_swap_mask_g[4][16] = {{1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+                                               {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+                                               {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8},
+                                               {15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0}};
+
+/* Vector kernel for byte swapping on the CPU that's running, chosen on first use */
+static hbool_t        H5T_swap_init_g = FALSE;
+static H5T_swap_vec_t H5T_swap_g      = NULL;
+#endif /* H5_HAVE_AVX2_DISPATCH */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_noop
  *
@@ -1242,6 +1371,16 @@ H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmt
             } /* end if */
 
             buf_stride = buf_stride ? buf_stride : src->shared->size;
+
+            /* Reverse packed elements with vector instructions first, where
+             * the CPU has them, and the rest below */
+            if (buf_stride == src->shared->size) {
+                size_t nvec = H5T__swap_vec(buf, buf, nelmts, src->shared->size);
+
+                nelmts -= nvec;
+                buf += nvec * buf_stride;
+            } /* end if */
+
             switch (src->shared->size) {
                 case 1:
                     /*no-op*/
@@ -1628,6 +1767,16 @@ H5T__conv_order(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, s
 
             buf_stride = buf_stride ? buf_stride : src->shared->size;
             md         = src->shared->size / 2;
+
+            /* Reverse packed elements with vector instructions first, where
+             * the CPU has them */
+            if (buf_stride == src->shared->size) {
+                size_t nvec = H5T__swap_vec(buf, buf, nelmts, src->shared->size);
+
+                nelmts -= nvec;
+                buf += nvec * buf_stride;
+            } /* end if */
+
             for (i = 0; i < nelmts; i++, buf += buf_stride)
                 for (j = 0; j < md; j++)
                     H5_SWAP_BYTES(buf, j, src->shared->size - (j + 1));
@@ -1645,6 +1794,192 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_order() */
 
+#ifdef H5_HAVE_AVX2_DISPATCH
+/*-------------------------------------------------------------------------
+ * Function:    H5T__swap_init
+ *
+ * Purpose:     Choose the vector kernel for byte swapping that the CPU
+ *              running the library supports, if any.
+ *
+ * Return:      none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__swap_init(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        H5T_swap_g = H5T__swap_avx2;
+    else if (__builtin_cpu_supports("ssse3"))
+        H5T_swap_g = H5T__swap_ssse3;
+
+    H5T_swap_init_g = TRUE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__swap_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__swap_ssse3
+ *
+ * Purpose:     Reverse the bytes of the elements in the first NBYTES bytes
+ *              of SRC, sixteen bytes at a time, into DST with the SSSE3
+ *              byte shuffle.  DST may be SRC.
+ *
+ * Return:      Number of bytes done
+ *
+ *-------------------------------------------------------------------------
+ */
+H5T_CONV_SSSE3 static size_t
+H5T__swap_ssse3(uint8_t *dst, const uint8_t *src, size_t nbytes, const uint8_t *mask)
+{
+    const __m128i ctl = _mm_loadu_si128((const __m128i *)mask);
+    size_t        u   = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (; u + 16 <= nbytes; u += 16)
+        H5T_CONV_VEC_STORE(dst + u, _mm_shuffle_epi8(H5T_CONV_VEC_LOAD(src + u), ctl));
+
+    FUNC_LEAVE_NOAPI(u)
+} /* end H5T__swap_ssse3() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__swap_avx2
+ *
+ * Purpose:     Reverse the bytes of the elements in the first NBYTES bytes
+ *              of SRC, 64 bytes at a time, into DST with the AVX2 byte
+ *              shuffle, and leave the rest to H5T__swap_ssse3().  DST may
+ *              be SRC.
+ *
+ * Return:      Number of bytes done
+ *
+ *-------------------------------------------------------------------------
+ */
+H5T_CONV_AVX2 static size_t
+H5T__swap_avx2(uint8_t *dst, const uint8_t *src, size_t nbytes, const uint8_t *mask)
+{
+    const __m256i ctl       = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)mask));
+    size_t        u         = 0;
+    size_t        ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (; u + 64 <= nbytes; u += 64) {
+        __m256i v0 = _mm256_loadu_si256((const __m256i *)(src + u));
+        __m256i v1 = _mm256_loadu_si256((const __m256i *)(src + u + 32));
+
+        _mm256_storeu_si256((__m256i *)(dst + u), _mm256_shuffle_epi8(v0, ctl));
+        _mm256_storeu_si256((__m256i *)(dst + u + 32), _mm256_shuffle_epi8(v1, ctl));
+    } /* end for */
+
+    ret_value = u + H5T__swap_ssse3(dst + u, src + u, nbytes - u, mask);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__swap_avx2() */
+#endif /* H5_HAVE_AVX2_DISPATCH */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__swap_vec
+ *
+ * Purpose:     Reverse the bytes of as many as possible of the NELMTS
+ *              packed SIZE-byte elements in SRC, into DST, with vector
+ *              instructions.  DST may be SRC, but the two mustn't
+ *              otherwise overlap.
+ *
+ * Return:      Number of elements done, which may be none if the CPU
+ *              hasn't the instructions or the elements are too big
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5T__swap_vec(uint8_t H5T_SWAP_VEC_USED *dst, const uint8_t H5T_SWAP_VEC_USED *src,
+              size_t H5T_SWAP_VEC_USED nelmts, size_t H5T_SWAP_VEC_USED size)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_HAVE_AVX2_DISPATCH
+    if (!H5T_swap_init_g)
+        H5T__swap_init();
+
+    if (H5T_swap_g) {
+        const uint8_t *mask = NULL; /* Shuffle control vector for the element size */
+
+        switch (size) {
+            case 2:
+                mask = H5T_swap_mask_g[0];
+                break;
+            case 4:
+                mask = H5T_swap_mask_g[1];
+                break;
+            case 8:
+                mask = H5T_swap_mask_g[2];
+                break;
+            case 16:
+                mask = H5T_swap_mask_g[3];
+                break;
+            default:
+                break;
+        } /* end switch */
+
+        if (mask)
+            ret_value = H5T_swap_g(dst, src, nelmts * size, mask) / size;
+    } /* end if */
+#endif /* H5_HAVE_AVX2_DISPATCH */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__swap_vec() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T_swap_copy
+ *
+ * Purpose:     Copy NELMTS packed SIZE-byte elements from SRC to DST,
+ *              reversing the order of the bytes in each, as the byte order
+ *              conversions do.  DST may be SRC, but the two mustn't
+ *              otherwise overlap.
+ *
+ * Return:      none
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5T_swap_copy(void *_dst, const void *_src, size_t nelmts, size_t size)
+{
+    uint8_t *      dst = (uint8_t *)_dst;
+    const uint8_t *src = (const uint8_t *)_src;
+    size_t         nvec; /* # of elements done with vector instructions */
+    size_t         i, j;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(dst);
+    HDassert(src);
+    HDassert(dst == src || dst + (nelmts * size) <= src || src + (nelmts * size) <= dst);
+
+    nvec = H5T__swap_vec(dst, src, nelmts, size);
+    dst += nvec * size;
+    src += nvec * size;
+    nelmts -= nvec;
+
+    /* Reverse the rest one element at a time */
+    if (dst == src) {
+        for (i = 0; i < nelmts; i++, dst += size)
+            for (j = 0; j < size / 2; j++)
+                H5_SWAP_BYTES(dst, j, size - (j + 1));
+    } /* end if */
+    else {
+        for (i = 0; i < nelmts; i++, dst += size, src += size)
+            for (j = 0; j < size; j++)
+                dst[j] = src[size - (j + 1)];
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T_swap_copy() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_b_b
  *
@@ -5086,6 +5421,453 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_s_s() */
 
+#ifdef __SSE2__
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_hw_vec_init
+ *
+ * Purpose:     Choose the vector kernel for the hardware conversions that
+ *              the CPU running the library supports.
+ *
+ * Return:      none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_hw_vec_init(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    H5T_conv_hw_vec_g = H5T__conv_hw_vec_sse2;
+
+#ifdef H5_HAVE_AVX2_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        H5T_conv_hw_vec_g = H5T__conv_hw_vec_avx2;
+#endif /* H5_HAVE_AVX2_DISPATCH */
+
+    H5T_conv_hw_vec_init_g = TRUE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_hw_vec_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_hw_vec_sse2
+ *
+ * Purpose:     Convert packed elements between native integer and
+ *              floating-point types with SSE2 instructions.  Converts
+ *              between integers of the same size or of sizes that differ
+ *              by a factor of two, from integers of up to four bytes to
+ *              floats and doubles, and between ints, floats and doubles.
+ *
+ *              Each vector is loaded before the converted vector is stored,
+ *              so the source and destination may overlap as they do when
+ *              elements are converted in place front to back.
+ *
+ * Return:      Number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5T__conv_hw_vec_sse2(unsigned src_type, unsigned dst_type, size_t nelmts, const uint8_t *src, uint8_t *dst)
+{
+    const __m128i zero  = _mm_setzero_si128();
+    size_t        ssize = src_type & 0xff; /* Size of source elements */
+    size_t        dsize = dst_type & 0xff; /* Size of destination elements */
+    size_t        n     = 0;               /* # of elements converted */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (H5T_CONV_VEC_PAIR(src_type, dst_type)) {
+        /* Floating-point conversions */
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 4, H5T_CONV_VEC_FLOAT | 4):
+            H5T_CONV_VEC_LOOP(4)
+            _mm_storeu_ps((float *)dst, _mm_cvtepi32_ps(H5T_CONV_VEC_LOAD(src)));
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 4, H5T_CONV_VEC_FLOAT | 8):
+            H5T_CONV_VEC_LOOP(2)
+            _mm_storeu_pd((double *)dst, _mm_cvtepi32_pd(H5T_CONV_VEC_LOADL(src)));
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 2, H5T_CONV_VEC_FLOAT | 4):
+            H5T_CONV_VEC_LOOP(4)
+            {
+                __m128i v = H5T_CONV_VEC_LOADL(src);
+
+                _mm_storeu_ps((float *)dst, _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16)));
+            }
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 2, H5T_CONV_VEC_FLOAT | 4):
+            H5T_CONV_VEC_LOOP(4)
+            _mm_storeu_ps((float *)dst, _mm_cvtepi32_ps(_mm_unpacklo_epi16(H5T_CONV_VEC_LOADL(src), zero)));
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_FLOAT | 4, H5T_CONV_VEC_SINT | 4): {
+            const __m128  max  = _mm_set1_ps((float)INT32_MAX);
+            const __m128i imax = _mm_set1_epi32(INT32_MAX);
+
+            /* Values above the maximum saturate; values below the minimum and
+             * NaNs convert to the minimum, as they do one by one */
+            H5T_CONV_VEC_LOOP(4)
+            {
+                __m128  v  = _mm_loadu_ps((const float *)src);
+                __m128i hi = _mm_castps_si128(_mm_cmpgt_ps(v, max));
+
+                H5T_CONV_VEC_STORE(dst, H5T_CONV_VEC_SELECT(hi, _mm_cvttps_epi32(v), imax));
+            }
+        } break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_FLOAT | 8, H5T_CONV_VEC_SINT | 4): {
+            const __m128d max  = _mm_set1_pd((double)INT32_MAX);
+            const __m128i imax = _mm_set1_epi32(INT32_MAX);
+
+            H5T_CONV_VEC_LOOP(4)
+            {
+                __m128d v0 = _mm_loadu_pd((const double *)src);
+                __m128d v1 = _mm_loadu_pd((const double *)src + 2);
+                __m128i r  = _mm_unpacklo_epi64(_mm_cvttpd_epi32(v0), _mm_cvttpd_epi32(v1));
+                __m128i hi = _mm_castps_si128(_mm_shuffle_ps(_mm_castpd_ps(_mm_cmpgt_pd(v0, max)),
+                                                             _mm_castpd_ps(_mm_cmpgt_pd(v1, max)),
+                                                             _MM_SHUFFLE(2, 0, 2, 0)));
+
+                H5T_CONV_VEC_STORE(dst, H5T_CONV_VEC_SELECT(hi, r, imax));
+            }
+        } break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_FLOAT | 4, H5T_CONV_VEC_FLOAT | 8):
+            H5T_CONV_VEC_LOOP(2)
+            _mm_storeu_pd((double *)dst, _mm_cvtps_pd(_mm_castsi128_ps(H5T_CONV_VEC_LOADL(src))));
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_FLOAT | 8, H5T_CONV_VEC_FLOAT | 4): {
+            const __m128d max  = _mm_set1_pd((double)FLT_MAX);
+            const __m128d min  = _mm_set1_pd(-(double)FLT_MAX);
+            const __m128i pinf = _mm_castps_si128(_mm_set1_ps(H5T_NATIVE_FLOAT_POS_INF_g));
+            const __m128i ninf = _mm_castps_si128(_mm_set1_ps(H5T_NATIVE_FLOAT_NEG_INF_g));
+
+            /* Values out of the range of floats become infinities */
+            H5T_CONV_VEC_LOOP(4)
+            {
+                __m128d v0 = _mm_loadu_pd((const double *)src);
+                __m128d v1 = _mm_loadu_pd((const double *)src + 2);
+                __m128i f  = _mm_castps_si128(_mm_movelh_ps(_mm_cvtpd_ps(v0), _mm_cvtpd_ps(v1)));
+                __m128i hi = _mm_castps_si128(_mm_shuffle_ps(_mm_castpd_ps(_mm_cmpgt_pd(v0, max)),
+                                                             _mm_castpd_ps(_mm_cmpgt_pd(v1, max)),
+                                                             _MM_SHUFFLE(2, 0, 2, 0)));
+                __m128i lo = _mm_castps_si128(_mm_shuffle_ps(_mm_castpd_ps(_mm_cmplt_pd(v0, min)),
+                                                             _mm_castpd_ps(_mm_cmplt_pd(v1, min)),
+                                                             _MM_SHUFFLE(2, 0, 2, 0)));
+
+                f = H5T_CONV_VEC_SELECT(hi, f, pinf);
+                H5T_CONV_VEC_STORE(dst, H5T_CONV_VEC_SELECT(lo, f, ninf));
+            }
+        } break;
+
+        /* Widening integer conversions, which can't overflow */
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 1, H5T_CONV_VEC_SINT | 2):
+            H5T_CONV_VEC_LOOP(8)
+            {
+                __m128i v = H5T_CONV_VEC_LOADL(src);
+
+                H5T_CONV_VEC_STORE(dst, _mm_unpacklo_epi8(v, _mm_cmpgt_epi8(zero, v)));
+            }
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 2, H5T_CONV_VEC_SINT | 4):
+            H5T_CONV_VEC_LOOP(4)
+            {
+                __m128i v = H5T_CONV_VEC_LOADL(src);
+
+                H5T_CONV_VEC_STORE(dst, _mm_unpacklo_epi16(v, _mm_cmpgt_epi16(zero, v)));
+            }
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 4, H5T_CONV_VEC_SINT | 8):
+            H5T_CONV_VEC_LOOP(2)
+            {
+                __m128i v = H5T_CONV_VEC_LOADL(src);
+
+                H5T_CONV_VEC_STORE(dst, _mm_unpacklo_epi32(v, _mm_cmpgt_epi32(zero, v)));
+            }
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 1, H5T_CONV_VEC_UINT | 2):
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 1, H5T_CONV_VEC_SINT | 2):
+            H5T_CONV_VEC_LOOP(8)
+            H5T_CONV_VEC_STORE(dst, _mm_unpacklo_epi8(H5T_CONV_VEC_LOADL(src), zero));
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 2, H5T_CONV_VEC_UINT | 4):
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 2, H5T_CONV_VEC_SINT | 4):
+            H5T_CONV_VEC_LOOP(4)
+            H5T_CONV_VEC_STORE(dst, _mm_unpacklo_epi16(H5T_CONV_VEC_LOADL(src), zero));
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 4, H5T_CONV_VEC_UINT | 8):
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 4, H5T_CONV_VEC_SINT | 8):
+            H5T_CONV_VEC_LOOP(2)
+            H5T_CONV_VEC_STORE(dst, _mm_unpacklo_epi32(H5T_CONV_VEC_LOADL(src), zero));
+            break;
+
+        /* Narrowing integer conversions, which saturate */
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 2, H5T_CONV_VEC_SINT | 1):
+            H5T_CONV_VEC_LOOP(16)
+            H5T_CONV_VEC_STORE(dst, _mm_packs_epi16(H5T_CONV_VEC_LOAD(src), H5T_CONV_VEC_LOAD(src + 16)));
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 2, H5T_CONV_VEC_UINT | 1):
+            H5T_CONV_VEC_LOOP(16)
+            H5T_CONV_VEC_STORE(dst, _mm_packus_epi16(H5T_CONV_VEC_LOAD(src), H5T_CONV_VEC_LOAD(src + 16)));
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 2, H5T_CONV_VEC_UINT | 1):
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 2, H5T_CONV_VEC_SINT | 1): {
+            const __m128i max = _mm_set1_epi16((dst_type & H5T_CONV_VEC_SINT) ? INT8_MAX : UINT8_MAX);
+
+            /* Subtracting the amount above the maximum leaves the minimum of
+             * the value and the maximum */
+            H5T_CONV_VEC_LOOP(16)
+            {
+                __m128i v0 = H5T_CONV_VEC_LOAD(src);
+                __m128i v1 = H5T_CONV_VEC_LOAD(src + 16);
+
+                v0 = _mm_sub_epi16(v0, _mm_subs_epu16(v0, max));
+                v1 = _mm_sub_epi16(v1, _mm_subs_epu16(v1, max));
+                H5T_CONV_VEC_STORE(dst, _mm_packus_epi16(v0, v1));
+            }
+        } break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 4, H5T_CONV_VEC_SINT | 2):
+            H5T_CONV_VEC_LOOP(8)
+            H5T_CONV_VEC_STORE(dst, _mm_packs_epi32(H5T_CONV_VEC_LOAD(src), H5T_CONV_VEC_LOAD(src + 16)));
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 4, H5T_CONV_VEC_UINT | 2): {
+            const __m128i bias32 = _mm_set1_epi32(0x8000);
+            const __m128i bias16 = _mm_set1_epi16(INT16_MIN);
+
+            /* Zero negative values, then saturate the values biased into the
+             * range of signed shorts, and remove the bias */
+            H5T_CONV_VEC_LOOP(8)
+            {
+                __m128i v0 = H5T_CONV_VEC_LOAD(src);
+                __m128i v1 = H5T_CONV_VEC_LOAD(src + 16);
+
+                v0 = _mm_sub_epi32(_mm_andnot_si128(_mm_srai_epi32(v0, 31), v0), bias32);
+                v1 = _mm_sub_epi32(_mm_andnot_si128(_mm_srai_epi32(v1, 31), v1), bias32);
+                H5T_CONV_VEC_STORE(dst, _mm_xor_si128(_mm_packs_epi32(v0, v1), bias16));
+            }
+        } break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 4, H5T_CONV_VEC_UINT | 2):
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 4, H5T_CONV_VEC_SINT | 2): {
+            const __m128i max  = _mm_set1_epi32((dst_type & H5T_CONV_VEC_SINT) ? INT16_MAX : UINT16_MAX);
+            const __m128i flip = _mm_set1_epi32(INT32_MIN);
+
+            /* Clamp the values with an unsigned comparison, then pack their
+             * low halves (sign-extended, so that they don't saturate) */
+            H5T_CONV_VEC_LOOP(8)
+            {
+                __m128i v0 = H5T_CONV_VEC_LOAD(src);
+                __m128i v1 = H5T_CONV_VEC_LOAD(src + 16);
+
+                v0 = H5T_CONV_VEC_SELECT(
+                    _mm_cmpgt_epi32(_mm_xor_si128(v0, flip), _mm_xor_si128(max, flip)), v0, max);
+                v1 = H5T_CONV_VEC_SELECT(
+                    _mm_cmpgt_epi32(_mm_xor_si128(v1, flip), _mm_xor_si128(max, flip)), v1, max);
+                v0 = _mm_srai_epi32(_mm_slli_epi32(v0, 16), 16);
+                v1 = _mm_srai_epi32(_mm_slli_epi32(v1, 16), 16);
+                H5T_CONV_VEC_STORE(dst, _mm_packs_epi32(v0, v1));
+            }
+        } break;
+
+        /* Conversions between signed and unsigned integers of the same size,
+         * which saturate */
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 1, H5T_CONV_VEC_UINT | 1):
+            H5T_CONV_VEC_LOOP(16)
+            {
+                __m128i v = H5T_CONV_VEC_LOAD(src);
+
+                H5T_CONV_VEC_STORE(dst, _mm_andnot_si128(_mm_cmpgt_epi8(zero, v), v));
+            }
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 1, H5T_CONV_VEC_SINT | 1): {
+            const __m128i max = _mm_set1_epi8(INT8_MAX);
+
+            H5T_CONV_VEC_LOOP(16)
+            H5T_CONV_VEC_STORE(dst, _mm_min_epu8(H5T_CONV_VEC_LOAD(src), max));
+        } break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 2, H5T_CONV_VEC_UINT | 2):
+            H5T_CONV_VEC_LOOP(8)
+            {
+                __m128i v = H5T_CONV_VEC_LOAD(src);
+
+                H5T_CONV_VEC_STORE(dst, _mm_andnot_si128(_mm_srai_epi16(v, 15), v));
+            }
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 2, H5T_CONV_VEC_SINT | 2):
+            H5T_CONV_VEC_LOOP(8)
+            {
+                __m128i v = H5T_CONV_VEC_LOAD(src);
+                __m128i m = _mm_srai_epi16(v, 15);
+
+                H5T_CONV_VEC_STORE(dst, H5T_CONV_VEC_SELECT(m, v, _mm_srli_epi16(m, 1)));
+            }
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 4, H5T_CONV_VEC_UINT | 4):
+            H5T_CONV_VEC_LOOP(4)
+            {
+                __m128i v = H5T_CONV_VEC_LOAD(src);
+
+                H5T_CONV_VEC_STORE(dst, _mm_andnot_si128(_mm_srai_epi32(v, 31), v));
+            }
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 4, H5T_CONV_VEC_SINT | 4):
+            H5T_CONV_VEC_LOOP(4)
+            {
+                __m128i v = H5T_CONV_VEC_LOAD(src);
+                __m128i m = _mm_srai_epi32(v, 31);
+
+                H5T_CONV_VEC_STORE(dst, H5T_CONV_VEC_SELECT(m, v, _mm_srli_epi32(m, 1)));
+            }
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 8, H5T_CONV_VEC_UINT | 8):
+            H5T_CONV_VEC_LOOP(2)
+            {
+                __m128i v = H5T_CONV_VEC_LOAD(src);
+                __m128i m = _mm_srai_epi32(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+
+                H5T_CONV_VEC_STORE(dst, _mm_andnot_si128(m, v));
+            }
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_UINT | 8, H5T_CONV_VEC_SINT | 8):
+            H5T_CONV_VEC_LOOP(2)
+            {
+                __m128i v = H5T_CONV_VEC_LOAD(src);
+                __m128i m = _mm_srai_epi32(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+
+                H5T_CONV_VEC_STORE(dst, H5T_CONV_VEC_SELECT(m, v, _mm_srli_epi64(m, 1)));
+            }
+            break;
+
+        default:
+            /* Leave the other conversions to the element-by-element loop */
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(n)
+} /* end H5T__conv_hw_vec_sse2() */
+#endif /* __SSE2__ */
+
+#ifdef H5_HAVE_AVX2_DISPATCH
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_hw_vec_avx2
+ *
+ * Purpose:     Convert packed elements between ints, floats and doubles
+ *              with AVX2 instructions, eight or four at a time, and leave
+ *              the rest to H5T__conv_hw_vec_sse2().
+ *
+ * Return:      Number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5T_CONV_AVX2 static size_t
+H5T__conv_hw_vec_avx2(unsigned src_type, unsigned dst_type, size_t nelmts, const uint8_t *src, uint8_t *dst)
+{
+    size_t ssize     = src_type & 0xff; /* Size of source elements */
+    size_t dsize     = dst_type & 0xff; /* Size of destination elements */
+    size_t n         = 0;               /* # of elements converted */
+    size_t ret_value = 0;               /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (H5T_CONV_VEC_PAIR(src_type, dst_type)) {
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 4, H5T_CONV_VEC_FLOAT | 4):
+            H5T_CONV_VEC_LOOP(8)
+            _mm256_storeu_ps((float *)dst, _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)src)));
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_SINT | 4, H5T_CONV_VEC_FLOAT | 8):
+            H5T_CONV_VEC_LOOP(4)
+            _mm256_storeu_pd((double *)dst, _mm256_cvtepi32_pd(H5T_CONV_VEC_LOAD(src)));
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_FLOAT | 4, H5T_CONV_VEC_SINT | 4): {
+            const __m256  max  = _mm256_set1_ps((float)INT32_MAX);
+            const __m256i imax = _mm256_set1_epi32(INT32_MAX);
+
+            H5T_CONV_VEC_LOOP(8)
+            {
+                __m256  v  = _mm256_loadu_ps((const float *)src);
+                __m256i hi = _mm256_castps_si256(_mm256_cmp_ps(v, max, _CMP_GT_OQ));
+
+                _mm256_storeu_si256((__m256i *)dst, _mm256_blendv_epi8(_mm256_cvttps_epi32(v), imax, hi));
+            }
+        } break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_FLOAT | 8, H5T_CONV_VEC_SINT | 4): {
+            const __m256d max  = _mm256_set1_pd((double)INT32_MAX);
+            const __m128i imax = _mm_set1_epi32(INT32_MAX);
+
+            H5T_CONV_VEC_LOOP(4)
+            {
+                __m256d v  = _mm256_loadu_pd((const double *)src);
+                __m256d m  = _mm256_cmp_pd(v, max, _CMP_GT_OQ);
+                __m128i hi = _mm_castps_si128(_mm_shuffle_ps(_mm_castpd_ps(_mm256_castpd256_pd128(m)),
+                                                             _mm_castpd_ps(_mm256_extractf128_pd(m, 1)),
+                                                             _MM_SHUFFLE(2, 0, 2, 0)));
+
+                H5T_CONV_VEC_STORE(dst, _mm_blendv_epi8(_mm256_cvttpd_epi32(v), imax, hi));
+            }
+        } break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_FLOAT | 4, H5T_CONV_VEC_FLOAT | 8):
+            H5T_CONV_VEC_LOOP(4)
+            _mm256_storeu_pd((double *)dst, _mm256_cvtps_pd(_mm_loadu_ps((const float *)src)));
+            break;
+
+        case H5T_CONV_VEC_PAIR(H5T_CONV_VEC_FLOAT | 8, H5T_CONV_VEC_FLOAT | 4): {
+            const __m256d max  = _mm256_set1_pd((double)FLT_MAX);
+            const __m256d min  = _mm256_set1_pd(-(double)FLT_MAX);
+            const __m128  pinf = _mm_set1_ps(H5T_NATIVE_FLOAT_POS_INF_g);
+            const __m128  ninf = _mm_set1_ps(H5T_NATIVE_FLOAT_NEG_INF_g);
+
+            H5T_CONV_VEC_LOOP(4)
+            {
+                __m256d v  = _mm256_loadu_pd((const double *)src);
+                __m256d mh = _mm256_cmp_pd(v, max, _CMP_GT_OQ);
+                __m256d ml = _mm256_cmp_pd(v, min, _CMP_LT_OQ);
+                __m128  hi = _mm_shuffle_ps(_mm_castpd_ps(_mm256_castpd256_pd128(mh)),
+                                           _mm_castpd_ps(_mm256_extractf128_pd(mh, 1)),
+                                           _MM_SHUFFLE(2, 0, 2, 0));
+                __m128  lo = _mm_shuffle_ps(_mm_castpd_ps(_mm256_castpd256_pd128(ml)),
+                                           _mm_castpd_ps(_mm256_extractf128_pd(ml, 1)),
+                                           _MM_SHUFFLE(2, 0, 2, 0));
+
+                _mm_storeu_ps((float *)dst,
+                              _mm_blendv_ps(_mm_blendv_ps(_mm256_cvtpd_ps(v), pinf, hi), ninf, lo));
+            }
+        } break;
+
+        default:
+            break;
+    } /* end switch */
+
+    /* Leave the rest, and the other conversions, to the SSE2 kernel */
+    ret_value = n + H5T__conv_hw_vec_sse2(src_type, dst_type, nelmts - n, src, dst);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_hw_vec_avx2() */
+#endif /* H5_HAVE_AVX2_DISPATCH */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_schar_uchar
  *
@@ -127,10 +127,12 @@ H5_DLL htri_t      H5T_is_relocatable(const H5T_t *dt);
 H5_DLL H5T_path_t *H5T_path_find(const H5T_t *src, const H5T_t *dst);
 H5_DLL hbool_t     H5T_path_noop(const H5T_path_t *p);
 H5_DLL H5T_bkg_t   H5T_path_bkg(const H5T_path_t *p);
+H5_DLL hbool_t     H5T_path_swap(const H5T_path_t *p);
 H5_DLL H5T_subset_info_t *H5T_path_compound_subset(const H5T_path_t *p);
 H5_DLL herr_t H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts, size_t buf_stride,
                           size_t bkg_stride, void *buf, void *bkg);
 H5_DLL herr_t H5T_reclaim(hid_t type_id, struct H5S_t *space, void *buf);
+H5_DLL void   H5T_swap_copy(void *dst, const void *src, size_t nelmts, size_t size);
 H5_DLL herr_t H5T_reclaim_cb(void *elem, const H5T_t *dt, unsigned ndim, const hsize_t *point, void *op_data);
 H5_DLL herr_t H5T_vlen_reclaim_elmt(void *elem, H5T_t *dt);
 H5_DLL htri_t H5T_set_loc(H5T_t *dt, H5VL_object_t *file, H5T_loc_t loc);
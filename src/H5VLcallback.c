@@ -76,6 +76,12 @@ static herr_t H5VL__dataset_read(void *dset, const H5VL_class_t *cls, hid_t mem_
                                  hid_t file_space_id, hid_t dxpl_id, void *buf, void **req);
 static herr_t H5VL__dataset_write(void *obj, const H5VL_class_t *cls, hid_t mem_type_id, hid_t mem_space_id,
                                   hid_t file_space_id, hid_t dxpl_id, const void *buf, void **req);
+static herr_t H5VL__dataset_read_multi(size_t count, void *obj[], const H5VL_class_t *cls,
+                                       hid_t mem_type_id[], hid_t mem_space_id[], hid_t file_space_id[],
+                                       hid_t dxpl_id, void *buf[], void **req);
+static herr_t H5VL__dataset_write_multi(size_t count, void *obj[], const H5VL_class_t *cls,
+                                        hid_t mem_type_id[], hid_t mem_space_id[], hid_t file_space_id[],
+                                        hid_t dxpl_id, const void *buf[], void **req);
 static herr_t H5VL__dataset_get(void *obj, const H5VL_class_t *cls, H5VL_dataset_get_t get_type,
                                 hid_t dxpl_id, void **req, va_list arguments);
 static herr_t H5VL__dataset_specific(void *obj, const H5VL_class_t *cls,
@@ -2142,6 +2148,223 @@ done:
     FUNC_LEAVE_API_NOINIT(ret_value)
 } /* end H5VLdataset_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5VL__dataset_read_multi
+ *
+ * Purpose:	Reads data from several datasets of one VOL connector.
+ *              Connectors without a 'dataset multi read' method (which
+ *              includes all connectors whose class is older than version
+ *              1) have their 'dataset read' method called for each
+ *              dataset.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__dataset_read_multi(size_t count, void *obj[], const H5VL_class_t *cls, hid_t mem_type_id[],
+                         hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id, void *buf[], void **req)
+{
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check if the corresponding VOL callback exists */
+    if (cls->dataset_multi_cls.read) {
+        /* Call the corresponding VOL callback */
+        if ((cls->dataset_multi_cls.read)(count, obj, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf,
+                                          req) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "multi-dataset read failed")
+    } /* end if */
+    else
+        /* Read each dataset in turn */
+        for (u = 0; u < count; u++)
+            if (H5VL__dataset_read(obj[u], cls, mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id,
+                                   buf[u], req) < 0)
+                HGOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "dataset read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__dataset_read_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5VL_dataset_read_multi
+ *
+ * Purpose:	Reads data from several datasets through the VOL.  When all
+ *              of the datasets belong to the same VOL connector, they are
+ *              passed to it together, otherwise each dataset is read on
+ *              its own.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL_dataset_read_multi(size_t count, H5VL_object_t *vol_obj[], hid_t mem_type_id[], hid_t mem_space_id[],
+                        hid_t file_space_id[], hid_t dxpl_id, void *buf[], void **req)
+{
+    void ** obj             = NULL;    /* Connector objects for the datasets */
+    hbool_t vol_wrapper_set = FALSE;   /* Whether the VOL object wrapping context was set up */
+    size_t  u;                         /* Local index variable */
+    herr_t  ret_value       = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(count > 0);
+    HDassert(vol_obj);
+
+    /* Check whether all the datasets use the same VOL connector */
+    for (u = 1; u < count; u++)
+        if (vol_obj[u]->connector->cls != vol_obj[0]->connector->cls)
+            break;
+
+    if (u < count) {
+        /* Read each dataset through its own connector */
+        for (u = 0; u < count; u++)
+            if (H5VL_dataset_read(vol_obj[u], mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id,
+                                  buf[u], req) < 0)
+                HGOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "dataset read failed")
+    } /* end if */
+    else {
+        /* Gather the connector objects for the datasets */
+        if (NULL == (obj = (void **)H5MM_malloc(count * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataset object array")
+        for (u = 0; u < count; u++)
+            obj[u] = vol_obj[u]->data;
+
+        /* Set wrapper info in API context */
+        if (H5VL_set_vol_wrapper(vol_obj[0]) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set VOL wrapper info")
+        vol_wrapper_set = TRUE;
+
+        /* Call the corresponding internal VOL routine */
+        if (H5VL__dataset_read_multi(count, obj, vol_obj[0]->connector->cls, mem_type_id, mem_space_id,
+                                     file_space_id, dxpl_id, buf, req) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "multi-dataset read failed")
+    } /* end else */
+
+done:
+    /* Reset object wrapping info in API context */
+    if (vol_wrapper_set && H5VL_reset_vol_wrapper() < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTRESET, FAIL, "can't reset VOL wrapper info")
+
+    H5MM_xfree(obj);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL_dataset_read_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5VL__dataset_write_multi
+ *
+ * Purpose:	Writes data to several datasets of one VOL connector.
+ *              Connectors without a 'dataset multi write' method (which
+ *              includes all connectors whose class is older than version
+ *              1) have their 'dataset write' method called for each
+ *              dataset.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__dataset_write_multi(size_t count, void *obj[], const H5VL_class_t *cls, hid_t mem_type_id[],
+                          hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id, const void *buf[],
+                          void **req)
+{
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check if the corresponding VOL callback exists */
+    if (cls->dataset_multi_cls.write) {
+        /* Call the corresponding VOL callback */
+        if ((cls->dataset_multi_cls.write)(count, obj, mem_type_id, mem_space_id, file_space_id, dxpl_id,
+                                           buf, req) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "multi-dataset write failed")
+    } /* end if */
+    else
+        /* Write each dataset in turn */
+        for (u = 0; u < count; u++)
+            if (H5VL__dataset_write(obj[u], cls, mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id,
+                                    buf[u], req) < 0)
+                HGOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "dataset write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__dataset_write_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5VL_dataset_write_multi
+ *
+ * Purpose:	Writes data to several datasets through the VOL.  When all
+ *              of the datasets belong to the same VOL connector, they are
+ *              passed to it together, otherwise each dataset is written
+ *              on its own.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL_dataset_write_multi(size_t count, H5VL_object_t *vol_obj[], hid_t mem_type_id[], hid_t mem_space_id[],
+                         hid_t file_space_id[], hid_t dxpl_id, const void *buf[], void **req)
+{
+    void ** obj             = NULL;    /* Connector objects for the datasets */
+    hbool_t vol_wrapper_set = FALSE;   /* Whether the VOL object wrapping context was set up */
+    size_t  u;                         /* Local index variable */
+    herr_t  ret_value       = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(count > 0);
+    HDassert(vol_obj);
+
+    /* Check whether all the datasets use the same VOL connector */
+    for (u = 1; u < count; u++)
+        if (vol_obj[u]->connector->cls != vol_obj[0]->connector->cls)
+            break;
+
+    if (u < count) {
+        /* Write each dataset through its own connector */
+        for (u = 0; u < count; u++)
+            if (H5VL_dataset_write(vol_obj[u], mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id,
+                                   buf[u], req) < 0)
+                HGOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "dataset write failed")
+    } /* end if */
+    else {
+        /* Gather the connector objects for the datasets */
+        if (NULL == (obj = (void **)H5MM_malloc(count * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dataset object array")
+        for (u = 0; u < count; u++)
+            obj[u] = vol_obj[u]->data;
+
+        /* Set wrapper info in API context */
+        if (H5VL_set_vol_wrapper(vol_obj[0]) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set VOL wrapper info")
+        vol_wrapper_set = TRUE;
+
+        /* Call the corresponding internal VOL routine */
+        if (H5VL__dataset_write_multi(count, obj, vol_obj[0]->connector->cls, mem_type_id, mem_space_id,
+                                      file_space_id, dxpl_id, buf, req) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "multi-dataset write failed")
+    } /* end else */
+
+done:
+    /* Reset object wrapping info in API context */
+    if (vol_wrapper_set && H5VL_reset_vol_wrapper() < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTRESET, FAIL, "can't reset VOL wrapper info")
+
+    H5MM_xfree(obj);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL_dataset_write_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5VL__dataset_get
  *
@@ -32,6 +32,14 @@
 /* Public Macros */
 /*****************/
 
+/* Version # of connector class struct & callbacks
+ *
+ * Version 0 - Initial version
+ * Version 1 - Adds the multi-dataset callbacks (dataset_multi_cls), at the
+ *             end of the class struct
+ */
+#define H5VL_VERSION 1
+
 /* Capability flags for connector */
 #define H5VL_CAP_FLAG_NONE       0    /* No special connector capabilities */
 #define H5VL_CAP_FLAG_THREADSAFE 0x01 /* Connector is threadsafe */
@@ -319,6 +327,14 @@ typedef struct H5VL_dataset_class_t {
     herr_t (*close)(void *dset, hid_t dxpl_id, void **req);
 } H5VL_dataset_class_t;
 
+/* H5D routines on several datasets at once (H5Dread_multi / H5Dwrite_multi) */
+typedef struct H5VL_dataset_multi_class_t {
+    herr_t (*read)(size_t count, void *dset[], hid_t mem_type_id[], hid_t mem_space_id[],
+                   hid_t file_space_id[], hid_t dxpl_id, void *buf[], void **req);
+    herr_t (*write)(size_t count, void *dset[], hid_t mem_type_id[], hid_t mem_space_id[],
+                    hid_t file_space_id[], hid_t dxpl_id, const void *buf[], void **req);
+} H5VL_dataset_multi_class_t;
+
 /* H5T routines*/
 typedef struct H5VL_datatype_class_t {
     void *(*commit)(void *obj, const H5VL_loc_params_t *loc_params, const char *name, hid_t type_id,
@@ -441,7 +457,7 @@ typedef struct H5VL_token_class_t {
 /* Class information for each VOL connector */
 typedef struct H5VL_class_t {
     /* Overall connector fields & callbacks */
-    unsigned int       version;          /* VOL connector class struct version #     */
+    unsigned int       version;          /* VOL connector class struct version (H5VL_VERSION) */
     H5VL_class_value_t value;            /* Value to identify connector              */
     const char *       name;             /* Connector name (MUST be unique!)         */
     unsigned           cap_flags;        /* Capability flags for connector           */
@@ -470,6 +486,9 @@ typedef struct H5VL_class_t {
     /* Catch-all */
     herr_t (*optional)(void *obj, int op_type, hid_t dxpl_id, void **req,
                        va_list arguments); /* Optional callback */
+
+    /* Added in version 1 (classes of older versions end before these) */
+    H5VL_dataset_multi_class_t dataset_multi_cls; /* Multi-dataset (H5D*_multi) class callbacks */
 } H5VL_class_t;
 
 /********************/
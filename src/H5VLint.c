@@ -50,6 +50,9 @@
 /* Local Macros */
 /****************/
 
+/* Size of a version 0 connector class struct */
+#define H5VL_CLASS_SIZE_V0 offsetof(H5VL_class_t, dataset_multi_cls)
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -1102,11 +1105,14 @@ H5VL_register_connector(const void *_cls, hbool_t app_ref, hid_t vipl_id)
     /* Check arguments */
     HDassert(cls);
 
-    /* Copy the class structure so the caller can reuse or free it */
-    if (NULL == (saved = H5FL_MALLOC(H5VL_class_t)))
+    /* Copy the class structure so the caller can reuse or free it.  Classes
+     * older than version 1 end before the callbacks added since, which are
+     * left NULL for them.
+     */
+    if (NULL == (saved = H5FL_CALLOC(H5VL_class_t)))
         HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, H5I_INVALID_HID,
                     "memory allocation failed for VOL connector class struct")
-    H5MM_memcpy(saved, cls, sizeof(H5VL_class_t));
+    H5MM_memcpy(saved, cls, cls->version < 1 ? H5VL_CLASS_SIZE_V0 : sizeof(H5VL_class_t));
     if (NULL == (saved->name = H5MM_strdup(cls->name)))
         HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, H5I_INVALID_HID,
                     "memory allocation failed for VOL connector name")
@@ -153,7 +153,12 @@ static const H5VL_class_t H5VL_native_cls_g = {
         H5VL__native_token_to_str, /* to_str         */
         H5VL__native_str_to_token  /* from_str       */
     },
-    NULL /* optional     */
+    NULL, /* optional     */
+    {
+        /* dataset_multi_cls */
+        H5VL__native_dataset_read_multi, /* read         */
+        H5VL__native_dataset_write_multi /* write        */
+    }
 };
 
 /*-------------------------------------------------------------------------
@@ -30,7 +30,7 @@
 /* Characteristics of the native VOL connector */
 #define H5VL_NATIVE_NAME    "native"
 #define H5VL_NATIVE_VALUE   H5_VOL_NATIVE /* enum value */
-#define H5VL_NATIVE_VERSION 0
+#define H5VL_NATIVE_VERSION H5VL_VERSION
 
 /* Values for VOL connector attribute optional VOL operations */
 #ifndef H5_NO_DEPRECATED_SYMBOLS
@@ -38,16 +38,18 @@
 #endif                                 /* H5_NO_DEPRECATED_SYMBOLS */
 
 /* Values for native VOL connector dataset optional VOL operations */
-#define H5VL_NATIVE_DATASET_FORMAT_CONVERT          0 /* H5Dformat_convert (internal) */
-#define H5VL_NATIVE_DATASET_GET_CHUNK_INDEX_TYPE    1 /* H5Dget_chunk_index_type      */
-#define H5VL_NATIVE_DATASET_GET_CHUNK_STORAGE_SIZE  2 /* H5Dget_chunk_storage_size    */
-#define H5VL_NATIVE_DATASET_GET_NUM_CHUNKS          3 /* H5Dget_num_chunks            */
-#define H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_IDX   4 /* H5Dget_chunk_info            */
-#define H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_COORD 5 /* H5Dget_chunk_info_by_coord   */
-#define H5VL_NATIVE_DATASET_CHUNK_READ              6 /* H5Dchunk_read                */
-#define H5VL_NATIVE_DATASET_CHUNK_WRITE             7 /* H5Dchunk_write               */
-#define H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE       8 /* H5Dvlen_get_buf_size         */
-#define H5VL_NATIVE_DATASET_GET_OFFSET              9 /* H5Dget_offset                */
+#define H5VL_NATIVE_DATASET_FORMAT_CONVERT          0  /* H5Dformat_convert (internal) */
+#define H5VL_NATIVE_DATASET_GET_CHUNK_INDEX_TYPE    1  /* H5Dget_chunk_index_type      */
+#define H5VL_NATIVE_DATASET_GET_CHUNK_STORAGE_SIZE  2  /* H5Dget_chunk_storage_size    */
+#define H5VL_NATIVE_DATASET_GET_NUM_CHUNKS          3  /* H5Dget_num_chunks            */
+#define H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_IDX   4  /* H5Dget_chunk_info            */
+#define H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_COORD 5  /* H5Dget_chunk_info_by_coord   */
+#define H5VL_NATIVE_DATASET_CHUNK_READ              6  /* H5Dchunk_read                */
+#define H5VL_NATIVE_DATASET_CHUNK_WRITE             7  /* H5Dchunk_write               */
+#define H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE       8  /* H5Dvlen_get_buf_size         */
+#define H5VL_NATIVE_DATASET_GET_OFFSET              9  /* H5Dget_offset                */
+#define H5VL_NATIVE_DATASET_CHUNK_PIN               10 /* H5Dpin_chunk                 */
+#define H5VL_NATIVE_DATASET_CHUNK_UNPIN             11 /* H5Dunpin_chunk               */
 
 /* Values for native VOL connector file optional VOL operations */
 #define H5VL_NATIVE_FILE_CLEAR_ELINK_CACHE            0  /* H5Fclear_elink_file_cache            */
@@ -79,6 +81,7 @@
 #define H5VL_NATIVE_FILE_GET_MPI_ATOMICITY            26 /* H5Fget_mpi_atomicity                 */
 #define H5VL_NATIVE_FILE_SET_MPI_ATOMICITY            27 /* H5Fset_mpi_atomicity                 */
 #define H5VL_NATIVE_FILE_POST_OPEN                    28 /* Adjust file after open, with wrapping context */
+#define H5VL_NATIVE_FILE_GET_SHARED_CHUNK_CACHE_STATS 29 /* H5Fget_shared_chunk_cache_stats      */
 
 /* Values for native VOL connector group optional VOL operations */
 #ifndef H5_NO_DEPRECATED_SYMBOLS
@@ -24,6 +24,7 @@
 #include "H5Fprivate.h"  /* Files                                    */
 #include "H5Gprivate.h"  /* Groups                                   */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 #include "H5Pprivate.h"  /* Property lists                           */
 #include "H5Sprivate.h"  /* Dataspaces                               */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
@@ -210,6 +211,115 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VL__native_dataset_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_dataset_read_multi
+ *
+ * Purpose:     Handles the multi-dataset read callback
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_dataset_read_multi(size_t count, void *obj[], hid_t mem_type_id[], hid_t mem_space_id[],
+                                hid_t file_space_id[], hid_t dxpl_id, void *buf[], void H5_ATTR_UNUSED **req)
+{
+    H5D_t **      dset       = (H5D_t **)obj;
+    const H5S_t **mem_space  = NULL;
+    const H5S_t **file_space = NULL;
+    size_t        u;                   /* Local index variable */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Allocate dataspace pointer arrays */
+    if (NULL == (mem_space = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate memory dataspace array")
+    if (NULL == (file_space = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate file dataspace array")
+
+    for (u = 0; u < count; u++) {
+        /* Check arguments */
+        if (NULL == dset[u]->oloc.file)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+
+        /* Get validated dataspace pointers */
+        if (H5S_get_validated_dataspace(mem_space_id[u], &mem_space[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from mem_space_id")
+        if (H5S_get_validated_dataspace(file_space_id[u], &file_space[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                        "could not get a validated dataspace from file_space_id")
+    } /* end for */
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Read raw data */
+    if (H5D__read_multi(count, dset, mem_type_id, mem_space, file_space, buf /*out*/) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    H5MM_xfree(mem_space);
+    H5MM_xfree(file_space);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_dataset_read_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_dataset_write_multi
+ *
+ * Purpose:     Handles the multi-dataset write callback
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_dataset_write_multi(size_t count, void *obj[], hid_t mem_type_id[], hid_t mem_space_id[],
+                                 hid_t file_space_id[], hid_t dxpl_id, const void *buf[],
+                                 void H5_ATTR_UNUSED **req)
+{
+    H5D_t **      dset       = (H5D_t **)obj;
+    const H5S_t **mem_space  = NULL;
+    const H5S_t **file_space = NULL;
+    size_t        u;                   /* Local index variable */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Allocate dataspace pointer arrays */
+    if (NULL == (mem_space = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate memory dataspace array")
+    if (NULL == (file_space = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate file dataspace array")
+
+    for (u = 0; u < count; u++) {
+        /* check arguments */
+        if (NULL == dset[u]->oloc.file)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+
+        /* Get validated dataspace pointers */
+        if (H5S_get_validated_dataspace(mem_space_id[u], &mem_space[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from mem_space_id")
+        if (H5S_get_validated_dataspace(file_space_id[u], &file_space[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                        "could not get a validated dataspace from file_space_id")
+    } /* end for */
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Write the data */
+    if (H5D__write_multi(count, dset, mem_type_id, mem_space, file_space, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    H5MM_xfree(mem_space);
+    H5MM_xfree(file_space);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_dataset_write_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5VL__native_dataset_get
  *
@@ -576,6 +686,54 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
             break;
         }
 
+        case H5VL_NATIVE_DATASET_CHUNK_PIN: { /* H5Dpin_chunk */
+            hid_t          mem_type_id = HDva_arg(arguments, hid_t);
+            const hsize_t *offset      = HDva_arg(arguments, const hsize_t *);
+            const void **  buf         = HDva_arg(arguments, const void **);
+            size_t *       buf_size    = HDva_arg(arguments, size_t *);
+            const H5T_t *  mem_type;
+            hsize_t        offset_copy[H5O_LAYOUT_NDIMS]; /* Internal copy of chunk offset */
+
+            /* Check arguments */
+            if (NULL == dset->oloc.file)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+            if (H5D_CHUNKED != dset->shared->layout.type)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+            if (NULL == (mem_type = (const H5T_t *)H5I_object_verify(mem_type_id, H5I_DATATYPE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+
+            /* Copy the user's offset array so we can be sure it's terminated properly.
+             * (we don't want to mess with the user's buffer).
+             */
+            if (H5D__get_offset_copy(dset, offset, offset_copy) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "failure to copy offset array")
+
+            /* Pin the chunk */
+            if (H5D__chunk_pin(dset, mem_type, offset_copy, buf, buf_size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTPIN, FAIL, "can't pin chunk")
+
+            break;
+        }
+
+        case H5VL_NATIVE_DATASET_CHUNK_UNPIN: { /* H5Dunpin_chunk */
+            const hsize_t *offset = HDva_arg(arguments, const hsize_t *);
+            hsize_t        offset_copy[H5O_LAYOUT_NDIMS]; /* Internal copy of chunk offset */
+
+            /* Check arguments */
+            if (H5D_CHUNKED != dset->shared->layout.type)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+            /* Copy the user's offset array so we can be sure it's terminated properly */
+            if (H5D__get_offset_copy(dset, offset, offset_copy) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "failure to copy offset array")
+
+            /* Unpin the chunk */
+            if (H5D__chunk_unpin(dset, offset_copy) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTUNPIN, FAIL, "can't unpin chunk")
+
+            break;
+        }
+
         /* H5Dget_offset */
         case H5VL_NATIVE_DATASET_GET_OFFSET: {
             haddr_t *ret = HDva_arg(arguments, haddr_t *);
@@ -20,6 +20,7 @@
 #include "H5private.h"   /* Generic Functions                        */
 #include "H5ACprivate.h" /* Metadata cache                           */
 #include "H5Cprivate.h"  /* Cache                                    */
+#include "H5Dprivate.h"  /* Datasets                                 */
 #include "H5Eprivate.h"  /* Error handling                           */
 #include "H5Fpkg.h"      /* Files                                    */
 #include "H5Gprivate.h"  /* Groups                                   */
@@ -544,6 +545,18 @@ H5VL__native_file_optional(void *obj, H5VL_file_optional_t optional_type, hid_t
             break;
         }
 
+        /* H5Fget_shared_chunk_cache_stats */
+        case H5VL_NATIVE_FILE_GET_SHARED_CHUNK_CACHE_STATS: {
+            size_t * cur_size = HDva_arg(arguments, size_t *);
+            hsize_t *nhits    = HDva_arg(arguments, hsize_t *);
+            hsize_t *nmisses  = HDva_arg(arguments, hsize_t *);
+
+            /* Get the statistics for the file's shared raw data chunk cache */
+            if (H5D_chunk_get_shared_cache_stats(f, cur_size, nhits, nmisses) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get shared chunk cache statistics")
+            break;
+        }
+
         /* H5Fget_vfd_handle */
         case H5VL_NATIVE_FILE_GET_VFD_HANDLE: {
             void **file_handle = HDva_arg(arguments, void **);
@@ -75,6 +75,12 @@ H5_DLL herr_t H5VL__native_dataset_specific(void *dset, H5VL_dataset_specific_t
 H5_DLL herr_t H5VL__native_dataset_optional(void *dset, H5VL_dataset_optional_t opt_type, hid_t dxpl_id,
                                             void **req, va_list arguments);
 H5_DLL herr_t H5VL__native_dataset_close(void *dset, hid_t dxpl_id, void **req);
+H5_DLL herr_t H5VL__native_dataset_read_multi(size_t count, void *dset[], hid_t mem_type_id[],
+                                              hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
+                                              void *buf[], void **req);
+H5_DLL herr_t H5VL__native_dataset_write_multi(size_t count, void *dset[], hid_t mem_type_id[],
+                                               hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
+                                               const void *buf[], void **req);
 
 /* Datatype callbacks */
 H5_DLL void * H5VL__native_datatype_commit(void *obj, const H5VL_loc_params_t *loc_params, const char *name,
@@ -379,7 +379,12 @@ static const H5VL_class_t H5VL_pass_through_g = {
         H5VL_pass_through_token_to_str,  /* to_str */
         H5VL_pass_through_token_from_str /* from_str */
     },
-    H5VL_pass_through_optional /* optional */
+    H5VL_pass_through_optional, /* optional */
+    {
+        /* dataset_multi_cls */
+        NULL, /* read */
+        NULL  /* write */
+    }
 };
 
 /* The connector identification number, initialized at runtime */
@@ -26,7 +26,7 @@
 /* Characteristics of the pass-through VOL connector */
 #define H5VL_PASSTHRU_NAME    "pass_through"
 #define H5VL_PASSTHRU_VALUE   505 /* VOL connector ID */
-#define H5VL_PASSTHRU_VERSION 0
+#define H5VL_PASSTHRU_VERSION H5VL_VERSION
 
 /* Pass-through VOL connector info */
 typedef struct H5VL_pass_through_info_t {
@@ -152,6 +152,12 @@ H5_DLL herr_t H5VL_dataset_read(const H5VL_object_t *vol_obj, hid_t mem_type_id,
                                 hid_t file_space_id, hid_t dxpl_id, void *buf, void **req);
 H5_DLL herr_t H5VL_dataset_write(const H5VL_object_t *vol_obj, hid_t mem_type_id, hid_t mem_space_id,
                                  hid_t file_space_id, hid_t dxpl_id, const void *buf, void **req);
+H5_DLL herr_t H5VL_dataset_read_multi(size_t count, H5VL_object_t *vol_obj[], hid_t mem_type_id[],
+                                      hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id, void *buf[],
+                                      void **req);
+H5_DLL herr_t H5VL_dataset_write_multi(size_t count, H5VL_object_t *vol_obj[], hid_t mem_type_id[],
+                                       hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id,
+                                       const void *buf[], void **req);
 H5_DLL herr_t H5VL_dataset_get(const H5VL_object_t *vol_obj, H5VL_dataset_get_t get_type, hid_t dxpl_id,
                                void **req, ...);
 H5_DLL herr_t H5VL_dataset_specific(const H5VL_object_t *cls, H5VL_dataset_specific_t specific_type,
@@ -50,6 +50,44 @@ typedef struct H5Z_object_t {
 #endif                  /* H5_HAVE_PARALLEL */
 } H5Z_object_t;
 
+#ifdef H5Z_HAVE_THREADS
+/* Tasks submitted to the pool of worker threads by one H5Z__run_tasks() call */
+typedef struct H5Z_task_job_t {
+    H5Z_task_func_t        op;          /* Task callback */
+    void *                 udata;       /* Task callback user data */
+    size_t                 ntasks;      /* Total number of tasks */
+    size_t                 next;        /* Next task to hand out */
+    size_t                 ndone;       /* Number of tasks finished */
+    unsigned               nhelpers;    /* Number of pool threads running a task */
+    unsigned               max_helpers; /* Most pool threads that may run tasks at once */
+    herr_t                 ret_value;   /* Whether all the tasks succeeded */
+    struct H5Z_task_job_t *next_job;    /* Next job with tasks to hand out */
+} H5Z_task_job_t;
+
+/* Worker threads shared by all H5Z__run_tasks() calls, started on first use
+ * and stopped when the package is shut down */
+typedef struct H5Z_task_pool_t {
+    hbool_t             init;     /* Whether the synchronization objects are set up */
+    H5TS_mutex_simple_t mutex;    /* Protects the pool and all the queued jobs */
+    H5TS_cond_t         work_cv;  /* Signaled when a job is queued or the pool shuts down */
+    H5TS_cond_t         done_cv;  /* Signaled when the last task of a job finishes */
+    H5TS_thread_t *     threads;  /* Pool threads */
+    unsigned            nthreads; /* Number of pool threads */
+    unsigned            nalloc;   /* Number of slots allocated in THREADS */
+    H5Z_task_job_t *    jobs;     /* Jobs with tasks left to hand out */
+    hbool_t             shutdown; /* Whether the pool threads should exit */
+} H5Z_task_pool_t;
+#endif /* H5Z_HAVE_THREADS */
+
+/* User data for H5Z__pipeline_task() */
+typedef struct H5Z_pipeline_multi_ud_t {
+    const H5O_pline_t * pline;     /* Filter pipeline */
+    unsigned            flags;     /* Filter invocation flags */
+    H5Z_EDC_t           edc_read;  /* Error detection setting */
+    H5Z_cb_t            cb_struct; /* Filter failure callback */
+    H5Z_pipeline_buf_t *bufs;      /* Buffers to filter */
+} H5Z_pipeline_multi_ud_t;
+
 /* Enumerated type for dataset creation prelude callbacks */
 typedef enum {
     H5Z_PRELUDE_CAN_APPLY, /* Call "can apply" callback */
@@ -59,6 +97,11 @@ typedef enum {
 /* Package initialization variable */
 hbool_t H5_PKG_INIT_VAR = FALSE;
 
+/* Threads that a filter may use to split a buffer into blocks of this size,
+ * while H5Z_pipeline_multi() has threads to spare (see H5Zpkg.h) */
+unsigned H5Z_block_nthreads_g = 1;
+size_t   H5Z_block_size_g     = 0;
+
 /* Local variables */
 static size_t        H5Z_table_alloc_g = 0;
 static size_t        H5Z_table_used_g  = 0;
@@ -66,9 +109,43 @@ static H5Z_class2_t *H5Z_table_g       = NULL;
 #ifdef H5Z_DEBUG
 static H5Z_stats_t *H5Z_stat_table_g = NULL;
 #endif /* H5Z_DEBUG */
+#ifdef H5Z_HAVE_THREADS
+static H5Z_task_pool_t H5Z_task_pool_g;
+#endif /* H5Z_HAVE_THREADS */
+
+/* Filters built into the library.  These don't call back into the library
+ * beyond the filter layer and memory management, so only they are run on
+ * the pool threads.
+ */
+static const H5Z_class2_t *const H5Z_builtin_g[] = {H5Z_SHUFFLE,
+                                                    H5Z_BITSHUFFLE,
+                                                    H5Z_FLETCHER32,
+                                                    H5Z_CRC32C,
+                                                    H5Z_NBIT,
+                                                    H5Z_SCALEOFFSET,
+#ifdef H5_HAVE_FILTER_DEFLATE
+                                                    H5Z_DEFLATE,
+#endif /* H5_HAVE_FILTER_DEFLATE */
+#ifdef H5_HAVE_FILTER_SZIP
+                                                    H5Z_SZIP,
+#endif /* H5_HAVE_FILTER_SZIP */
+#ifdef H5_HAVE_FILTER_ZSTD
+                                                    H5Z_ZSTD,
+#endif /* H5_HAVE_FILTER_ZSTD */
+#ifdef H5_HAVE_FILTER_LZ4
+                                                    H5Z_LZ4,
+#endif /* H5_HAVE_FILTER_LZ4 */
+                                                    NULL};
 
 /* Local functions */
 static int H5Z__find_idx(H5Z_filter_t id);
+static int H5Z__load_idx(H5Z_filter_t id);
+#ifdef H5Z_HAVE_THREADS
+static void  H5Z__task_run_one(H5Z_task_job_t *job, hbool_t helper);
+static void *H5Z__task_worker(void *arg);
+static void  H5Z__task_pool_term(void);
+#endif /* H5Z_HAVE_THREADS */
+static herr_t H5Z__pipeline_task(size_t task, void *_udata);
 static int H5Z__check_unregister_dset_cb(void *obj_ptr, hid_t obj_id, void *key);
 static int H5Z__check_unregister_group_cb(void *obj_ptr, hid_t obj_id, void *key);
 static int H5Z__flush_file_cb(void *obj_ptr, hid_t obj_id, void *key);
@@ -88,11 +165,25 @@ H5Z__init_package(void)
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5Z_HAVE_THREADS
+    /* Set up the pool of worker threads (the threads start on first use) */
+    if (!H5Z_task_pool_g.init) {
+        H5TS_mutex_init(&H5Z_task_pool_g.mutex);
+        H5TS_cond_init(&H5Z_task_pool_g.work_cv);
+        H5TS_cond_init(&H5Z_task_pool_g.done_cv);
+        H5Z_task_pool_g.init = TRUE;
+    } /* end if */
+#endif /* H5Z_HAVE_THREADS */
+
     /* Internal filters */
     if (H5Z_register(H5Z_SHUFFLE) < 0)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register shuffle filter")
+    if (H5Z_register(H5Z_BITSHUFFLE) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register bitshuffle filter")
     if (H5Z_register(H5Z_FLETCHER32) < 0)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register fletcher32 filter")
+    if (H5Z_register(H5Z_CRC32C) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register crc32c filter")
     if (H5Z_register(H5Z_NBIT) < 0)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register nbit filter")
     if (H5Z_register(H5Z_SCALEOFFSET) < 0)
@@ -108,6 +199,14 @@ H5Z__init_package(void)
     if (H5Z_register(H5Z_SZIP) < 0)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register szip filter")
 #endif /* H5_HAVE_FILTER_SZIP */
+#ifdef H5_HAVE_FILTER_ZSTD
+    if (H5Z_register(H5Z_ZSTD) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register zstd filter")
+#endif /* H5_HAVE_FILTER_ZSTD */
+#ifdef H5_HAVE_FILTER_LZ4
+    if (H5Z_register(H5Z_LZ4) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register lz4 filter")
+#endif /* H5_HAVE_FILTER_LZ4 */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -183,6 +282,11 @@ next:
         }         /* end if */
 #endif            /* H5Z_DEBUG */
 
+#ifdef H5Z_HAVE_THREADS
+        /* Stop the worker threads */
+        H5Z__task_pool_term();
+#endif /* H5Z_HAVE_THREADS */
+
         /* Free the table of filters */
         if (H5Z_table_g) {
             H5Z_table_g = (H5Z_class2_t *)H5MM_xfree(H5Z_table_g);
@@ -1270,6 +1374,46 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5Z_find() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5Z__load_idx
+ *
+ * Purpose:  Given a filter ID return the offset in the global array
+ *           that holds all the registered filters, loading and
+ *           registering the filter from a plugin if it isn't registered
+ *           yet (and the application doesn't indicate no plugins through
+ *           HDF5_PRELOAD_PLUG, using the symbol "::").
+ *
+ * Return:   Success:    Non-negative index of entry in global table
+ *           Failure:    Negative
+ *-------------------------------------------------------------------------
+ */
+static int
+H5Z__load_idx(H5Z_filter_t id)
+{
+    H5PL_key_t          key;
+    const H5Z_class2_t *filter_info;
+    int                 ret_value = FAIL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if ((ret_value = H5Z__find_idx(id)) < 0) {
+        /* Try loading the filter */
+        key.id = (int)id;
+        if (NULL != (filter_info = (const H5Z_class2_t *)H5PL_load(H5PL_TYPE_FILTER, &key))) {
+            /* Register the filter we loaded */
+            if (H5Z_register(filter_info) < 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register filter")
+
+            /* Search in the table of registered filters again to find the dynamic filter just loaded
+             * and registered */
+            ret_value = H5Z__find_idx(id);
+        }
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__load_idx() */
+
 /*-------------------------------------------------------------------------
  * Function: H5Z_pipeline
  *
@@ -1300,8 +1444,12 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
 {
     size_t        idx;
     size_t        new_nbytes;
-    int           fclass_idx;    /* Index of filter class in global table */
-    H5Z_class2_t *fclass = NULL; /* Filter class pointer */
+    int           fclass_idx;         /* Index of filter class in global table */
+    H5Z_class2_t *fclass      = NULL; /* Filter class pointer */
+    H5Z_func_t    filter_func = NULL; /* Filter callback, when decoding */
+#ifdef H5_HAVE_THREADSAFE
+    hbool_t relocked = FALSE; /* Whether the API lock was taken back */
+#endif /* H5_HAVE_THREADSAFE */
 #ifdef H5Z_DEBUG
     H5Z_stats_t * fstats = NULL; /* Filter stats pointer */
     H5_timer_t    timer;         /* Timer for filter operations */
@@ -1332,45 +1480,25 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
                 continue; /* filter excluded */
             }
 
-            /* If the filter isn't registered and the application doesn't
-             * indicate no plugin through HDF5_PRELOAD_PLUG (using the symbol "::"),
-             * try to load it dynamically and register it.  Otherwise, return failure
+            /* Find the filter (loading it if necessary).  A thread that has
+             * given up the API lock to decode a chunk takes it back for this,
+             * as another thread may be registering filters at the same time.
              */
-            if ((fclass_idx = H5Z__find_idx(pline->filter[idx].id)) < 0) {
-                H5PL_key_t          key;
-                const H5Z_class2_t *filter_info;
-                hbool_t             issue_error = FALSE;
-
-                /* Try loading the filter */
-                key.id = (int)(pline->filter[idx].id);
-                if (NULL != (filter_info = (const H5Z_class2_t *)H5PL_load(H5PL_TYPE_FILTER, &key))) {
-                    /* Register the filter we loaded */
-                    if (H5Z_register(filter_info) < 0)
-                        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register filter")
-
-                    /* Search in the table of registered filters again to find the dynamic filter just loaded
-                     * and registered */
-                    if ((fclass_idx = H5Z__find_idx(pline->filter[idx].id)) < 0)
-                        issue_error = TRUE;
-                }
+            H5_API_RELOCK(relocked)
+            if ((fclass_idx = H5Z__load_idx(pline->filter[idx].id)) >= 0)
+                filter_func = H5Z_table_g[fclass_idx].filter;
+            H5_API_RELOCK_END(relocked)
+            if (fclass_idx < 0) {
+                /* Print out the filter name to give more info.  But the name is optional for
+                 * the filter */
+                if (pline->filter[idx].name)
+                    HGOTO_ERROR(H5E_PLINE, H5E_READERROR, FAIL, "required filter '%s' is not registered",
+                                pline->filter[idx].name)
                 else
-                    issue_error = TRUE;
-
-                /* Check for error */
-                if (issue_error) {
-                    /* Print out the filter name to give more info.  But the name is optional for
-                     * the filter */
-                    if (pline->filter[idx].name)
-                        HGOTO_ERROR(H5E_PLINE, H5E_READERROR, FAIL, "required filter '%s' is not registered",
-                                    pline->filter[idx].name)
-                    else
-                        HGOTO_ERROR(H5E_PLINE, H5E_READERROR, FAIL,
-                                    "required filter (name unavailable) is not registered")
-                }
+                    HGOTO_ERROR(H5E_PLINE, H5E_READERROR, FAIL,
+                                "required filter (name unavailable) is not registered")
             } /* end if */
 
-            fclass = &H5Z_table_g[fclass_idx];
-
 #ifdef H5Z_DEBUG
             fstats = &H5Z_stat_table_g[fclass_idx];
             H5_timer_start(&timer);
@@ -1378,8 +1506,8 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
 
             tmp_flags = flags | (pline->filter[idx].flags);
             tmp_flags |= (edc_read == H5Z_DISABLE_EDC) ? H5Z_FLAG_SKIP_EDC : 0;
-            new_nbytes = (fclass->filter)(tmp_flags, pline->filter[idx].cd_nelmts,
-                                          pline->filter[idx].cd_values, *nbytes, buf_size, buf);
+            new_nbytes = (filter_func)(tmp_flags, pline->filter[idx].cd_nelmts, pline->filter[idx].cd_values,
+                                       *nbytes, buf_size, buf);
 
 #ifdef H5Z_DEBUG
             H5_timer_stop(&timer);
@@ -1467,6 +1595,334 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+#ifdef H5Z_HAVE_THREADS
+/*-------------------------------------------------------------------------
+ * Function: H5Z__task_run_one
+ *
+ * Purpose:  Hand out the next task of JOB and run it.  Called with the
+ *           pool's mutex held, which is released while the task runs.
+ *           HELPER is TRUE when the calling thread is a pool thread, as
+ *           opposed to the thread that submitted the job.
+ *
+ * Return:   void
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__task_run_one(H5Z_task_job_t *job, hbool_t helper)
+{
+    size_t task; /* Index of the task to run */
+    herr_t status; /* Status of the task */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(job->next < job->ntasks);
+
+    /* Claim the task, and take the job off the queue once all its tasks are claimed */
+    task = job->next++;
+    if (job->next == job->ntasks) {
+        H5Z_task_job_t **prev = &H5Z_task_pool_g.jobs;
+
+        while (*prev != job)
+            prev = &(*prev)->next_job;
+        *prev = job->next_job;
+    } /* end if */
+    if (helper)
+        job->nhelpers++;
+
+    H5TS_mutex_unlock_simple(&H5Z_task_pool_g.mutex);
+    status = (job->op)(task, job->udata);
+    H5TS_mutex_lock_simple(&H5Z_task_pool_g.mutex);
+
+    if (status < 0)
+        job->ret_value = FAIL;
+    if (helper)
+        job->nhelpers--;
+    if (++job->ndone == job->ntasks)
+        H5TS_cond_broadcast(&H5Z_task_pool_g.done_cv);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__task_run_one() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z__task_worker
+ *
+ * Purpose:  Thread body for the pool threads.  Runs tasks from the queued
+ *           jobs until the pool shuts down.
+ *
+ * Return:   NULL
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5Z__task_worker(void H5_ATTR_UNUSED *arg)
+{
+    H5Z_task_job_t *job; /* Job to help with */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Pool threads don't hold the API lock, so they can't record errors.
+     * (Callers re-run failed buffers on their own thread to report them.)
+     */
+    H5E_pause_stack(TRUE);
+
+    H5TS_mutex_lock_simple(&H5Z_task_pool_g.mutex);
+    while (!H5Z_task_pool_g.shutdown) {
+        for (job = H5Z_task_pool_g.jobs; job; job = job->next_job)
+            if (job->nhelpers < job->max_helpers)
+                break;
+
+        if (job)
+            H5Z__task_run_one(job, TRUE);
+        else
+            H5TS_cond_wait(&H5Z_task_pool_g.work_cv, &H5Z_task_pool_g.mutex);
+    } /* end while */
+    H5TS_mutex_unlock_simple(&H5Z_task_pool_g.mutex);
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* end H5Z__task_worker() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z__task_pool_term
+ *
+ * Purpose:  Stop the pool threads and release the pool's resources.
+ *
+ * Return:   void
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__task_pool_term(void)
+{
+    unsigned u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (H5Z_task_pool_g.init) {
+        HDassert(NULL == H5Z_task_pool_g.jobs);
+
+        H5TS_mutex_lock_simple(&H5Z_task_pool_g.mutex);
+        H5Z_task_pool_g.shutdown = TRUE;
+        H5TS_cond_broadcast(&H5Z_task_pool_g.work_cv);
+        H5TS_mutex_unlock_simple(&H5Z_task_pool_g.mutex);
+
+        for (u = 0; u < H5Z_task_pool_g.nthreads; u++)
+            H5TS_wait_for_thread(H5Z_task_pool_g.threads[u]);
+        H5MM_xfree(H5Z_task_pool_g.threads);
+
+        H5TS_cond_destroy(&H5Z_task_pool_g.done_cv);
+        H5TS_cond_destroy(&H5Z_task_pool_g.work_cv);
+        H5TS_mutex_destroy(&H5Z_task_pool_g.mutex);
+        HDmemset(&H5Z_task_pool_g, 0, sizeof(H5Z_task_pool_g));
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__task_pool_term() */
+#endif /* H5Z_HAVE_THREADS */
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z__run_tasks
+ *
+ * Purpose:  Invoke OP on each of NTASKS independent tasks, spreading the
+ *           work over up to NTHREADS threads (the calling thread and
+ *           threads from the filter layer's pool, which is grown as
+ *           needed).  The pool is only used when the library is built
+ *           thread-safe, otherwise (or when NTHREADS is 0 or 1) the tasks
+ *           are run serially in the calling thread.  OP may itself call
+ *           H5Z__run_tasks().
+ *
+ *           OP must not call back into the library beyond the filter
+ *           layer and memory management, since the pool threads do not
+ *           hold the library's API lock, and errors pushed on the pool
+ *           threads are dropped.
+ *
+ * Return:   Non-negative if every task succeeded
+ *           Negative if any task failed
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Z__run_tasks(unsigned nthreads, size_t ntasks, H5Z_task_func_t op, void *udata)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(op);
+
+    /* Don't use more threads than there are tasks */
+    if ((size_t)nthreads > ntasks)
+        nthreads = (unsigned)ntasks;
+#ifdef H5Z_HAVE_THREADS
+    if (!H5Z_task_pool_g.init)
+        nthreads = 1;
+#else  /* H5Z_HAVE_THREADS */
+    nthreads = 1;
+#endif /* H5Z_HAVE_THREADS */
+
+    if (nthreads <= 1) {
+        size_t u;
+
+        for (u = 0; u < ntasks; u++)
+            if ((op)(u, udata) < 0)
+                ret_value = FAIL;
+    } /* end if */
+#ifdef H5Z_HAVE_THREADS
+    else {
+        H5Z_task_job_t job; /* Tasks for the pool */
+
+        job.op          = op;
+        job.udata       = udata;
+        job.ntasks      = ntasks;
+        job.next        = 0;
+        job.ndone       = 0;
+        job.nhelpers    = 0;
+        job.max_helpers = nthreads - 1;
+        job.ret_value   = SUCCEED;
+        job.next_job    = NULL;
+
+        H5TS_mutex_lock_simple(&H5Z_task_pool_g.mutex);
+
+        /* Start more pool threads, if needed.  (If there's no memory for
+         * them, the job just gets less help.) */
+        while (H5Z_task_pool_g.nthreads < job.max_helpers) {
+            if (H5Z_task_pool_g.nthreads == H5Z_task_pool_g.nalloc) {
+                unsigned       nalloc  = MAX(job.max_helpers, 2 * H5Z_task_pool_g.nalloc);
+                H5TS_thread_t *threads = NULL;
+
+                if (NULL == (threads = (H5TS_thread_t *)H5MM_realloc(H5Z_task_pool_g.threads,
+                                                                     nalloc * sizeof(H5TS_thread_t))))
+                    break;
+                H5Z_task_pool_g.threads = threads;
+                H5Z_task_pool_g.nalloc  = nalloc;
+            } /* end if */
+            H5Z_task_pool_g.threads[H5Z_task_pool_g.nthreads++] =
+                H5TS_create_thread(H5Z__task_worker, NULL, NULL);
+        } /* end while */
+
+        /* Queue the job and wake the pool threads */
+        {
+            H5Z_task_job_t **prev = &H5Z_task_pool_g.jobs;
+
+            while (*prev)
+                prev = &(*prev)->next_job;
+            *prev = &job;
+        }
+        H5TS_cond_broadcast(&H5Z_task_pool_g.work_cv);
+
+        /* Work on the job until all of its tasks are handed out, then wait
+         * for the pool threads to finish theirs */
+        while (job.next < job.ntasks)
+            H5Z__task_run_one(&job, FALSE);
+        while (job.ndone < job.ntasks)
+            H5TS_cond_wait(&H5Z_task_pool_g.done_cv, &H5Z_task_pool_g.mutex);
+
+        H5TS_mutex_unlock_simple(&H5Z_task_pool_g.mutex);
+
+        ret_value = job.ret_value;
+    } /* end else */
+#endif /* H5Z_HAVE_THREADS */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__run_tasks() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z__pipeline_task
+ *
+ * Purpose:  H5Z__run_tasks() callback to run one buffer through the
+ *           filter pipeline for H5Z_pipeline_multi().
+ *
+ * Return:   Non-negative on success
+ *           Negative on failure
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__pipeline_task(size_t task, void *_udata)
+{
+    H5Z_pipeline_multi_ud_t *udata = (H5Z_pipeline_multi_ud_t *)_udata;
+    H5Z_pipeline_buf_t *     pbuf  = &udata->bufs[task];
+
+    FUNC_ENTER_STATIC_NOERR
+
+    pbuf->status = H5Z_pipeline(udata->pline, udata->flags, &pbuf->filter_mask, udata->edc_read,
+                                udata->cb_struct, &pbuf->nbytes, &pbuf->buf_size, &pbuf->buf);
+
+    FUNC_LEAVE_NOAPI(pbuf->status)
+} /* end H5Z__pipeline_task() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z_pipeline_multi
+ *
+ * Purpose:  Process several independent buffers through the filter
+ *           pipeline, using up to NTHREADS threads.  Each element of
+ *           BUFS is processed exactly as H5Z_pipeline() would process
+ *           it, and the outcome for each buffer is recorded in its
+ *           STATUS field.  A failure on one buffer does not stop the
+ *           others from being processed; callers may retry failed
+ *           buffers with H5Z_pipeline() to obtain a detailed error
+ *           stack.
+ *
+ *           The buffers are processed serially if the library isn't
+ *           thread-safe, if some filter in the pipeline isn't built into
+ *           the library (filter plugins and application filters may call
+ *           back into the library, which the pool threads can't do), or
+ *           if CB_STRUCT has a callback (it is run on the calling thread).
+ *
+ *           When compressing fewer buffers than NTHREADS and BLOCK_SIZE
+ *           is non-zero, the spare threads are shared out among the
+ *           buffers, and filters that support it (only deflate, for
+ *           now) may use them to compress blocks of BLOCK_SIZE bytes of
+ *           a single buffer concurrently.
+ *
+ * Return:   Non-negative if every buffer was processed successfully
+ *           Negative if any buffer failed
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Z_pipeline_multi(const H5O_pline_t *pline, unsigned flags, H5Z_EDC_t edc_read, H5Z_cb_t cb_struct,
+                   unsigned nthreads, size_t block_size, size_t nbufs, H5Z_pipeline_buf_t bufs[])
+{
+    H5Z_pipeline_multi_ud_t udata;               /* Info for pipeline tasks */
+    htri_t                  builtin;             /* Whether all filters are built in */
+    herr_t                  status;              /* Status of the pipeline tasks */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(pline);
+    HDassert(nbufs == 0 || bufs);
+
+    /* Only built-in filters are run on the pool threads, and the failure
+     * callback is only run on this thread */
+    if (nthreads > 1) {
+        if ((builtin = H5Z_builtin_filters(pline)) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't check filter classes")
+        if (!builtin || cb_struct.func)
+            nthreads = 1;
+    } /* end if */
+
+    udata.pline     = pline;
+    udata.flags     = flags;
+    udata.edc_read  = edc_read;
+    udata.cb_struct = cb_struct;
+    udata.bufs      = bufs;
+
+    /* Let filters split buffers when there are more threads than buffers.
+     * (The caller holds the library's lock, so no other pipeline can be
+     * running, and the worker threads only read these.) */
+    if (!(flags & H5Z_FLAG_REVERSE) && block_size > 0 && nbufs > 0 && (size_t)nthreads > nbufs) {
+        H5Z_block_nthreads_g = (unsigned)((size_t)nthreads / nbufs);
+        H5Z_block_size_g     = block_size;
+    } /* end if */
+
+    status = H5Z__run_tasks(nthreads, nbufs, H5Z__pipeline_task, &udata);
+
+    H5Z_block_nthreads_g = 1;
+    H5Z_block_size_g     = 0;
+
+    if (status < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "filter pipeline failed for one or more buffers")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_pipeline_multi() */
+
 /*-------------------------------------------------------------------------
  * Function: H5Z_filter_info
  *
@@ -1575,6 +2031,48 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z_all_filters_avail() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5Z_builtin_filters
+ *
+ * Purpose:  Verify that all the filters in a pipeline are registered, and
+ *           registered with the library's own implementation (rather than
+ *           a plugin or one registered by the application with
+ *           H5Zregister(), which may not be safe to call without the API
+ *           lock)
+ *
+ * Return:   Non-negative (TRUE/FALSE) on success
+ *           Negative on failure
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5Z_builtin_filters(const H5O_pline_t *pline)
+{
+    size_t i, j;             /* Local index variables */
+    int    idx;              /* Index of filter in the table */
+    htri_t ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(pline);
+
+    for (i = 0; i < pline->nused; i++) {
+        if ((idx = H5Z__find_idx(pline->filter[i].id)) < 0)
+            HGOTO_DONE(FALSE)
+
+        /* Compare the filter functions, in case the ID was registered again */
+        for (j = 0; H5Z_builtin_g[j]; j++)
+            if (H5Z_builtin_g[j]->id == H5Z_table_g[idx].id &&
+                H5Z_builtin_g[j]->filter == H5Z_table_g[idx].filter)
+                break;
+        if (NULL == H5Z_builtin_g[j])
+            HGOTO_DONE(FALSE)
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_builtin_filters() */
+
 /*-------------------------------------------------------------------------
  * Function: H5Z_delete
  *
@@ -0,0 +1,1009 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     An I/O filter that "bitshuffles" the elements of a chunk,
+ *              putting the bits in each bit position of the elements
+ *              together, optionally compressing the result with lz4 or
+ *              zstd.
+ *
+ *              Chunks are stored in the format written by the bitshuffle
+ *              filter plugin registered for H5Z_FILTER_BITSHUFFLE, so files
+ *              written with either can be read with the other.  The
+ *              elements are bitshuffled in blocks of a multiple of 8
+ *              elements: the bytes of the elements in a block are shuffled
+ *              as by the shuffle filter, then each run of bytes is
+ *              transposed into 8 runs of bits, the ones from bit 0 of each
+ *              byte first.  After the full blocks, the elements left over
+ *              are bitshuffled as a block of their own, except for the last
+ *              (# of elements % 8), which are stored as they are.
+ *
+ *              When the blocks are compressed, the chunk is stored as:
+ *
+ *                  8 bytes     size of the chunk, uncompressed
+ *                  4 bytes     size of each block, uncompressed
+ *                  for each block:
+ *                      4 bytes     size of the block, compressed
+ *                      ...         the compressed block
+ *                  ...         the elements left over
+ *
+ *              with all sizes big-endian.
+ *
+ *              The client data values are laid out as the plugin's are: see
+ *              the H5Z_BITSHUFFLE_PARM_* macros.
+ */
+
+#include "H5Zmodule.h" /* This source code file is part of the H5Z module */
+
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5Iprivate.h"  /* IDs			  		*/
+#include "H5MMprivate.h" /* Memory management			*/
+#include "H5Pprivate.h"  /* Property lists                       */
+#include "H5Tprivate.h"  /* Datatypes         			*/
+#include "H5Zpkg.h"      /* Data filters				*/
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef H5_HAVE_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+#ifdef H5_HAVE_FILTER_LZ4
+#include <lz4.h>
+#endif
+#ifdef H5_HAVE_FILTER_ZSTD
+#include <zstd.h>
+#endif
+
+/* Local macros */
+#define H5Z_BITSHUFFLE_BLOCK_MULT     8    /* Block sizes are a multiple of this many elements */
+#define H5Z_BITSHUFFLE_TARGET_NBYTES  8192 /* Size the default block size aims for */
+#define H5Z_BITSHUFFLE_MIN_BLOCK_SIZE 128  /* Smallest default block size */
+#define H5Z_BITSHUFFLE_HDR_SIZE       12   /* Size of a compressed chunk's header */
+
+#ifdef H5_HAVE_AVX2_DISPATCH
+#define H5Z_BITSHUFFLE_AVX2 __attribute__((target("avx2")))
+#endif
+
+/* Mark the arguments that only the compressors use, for builds without any */
+#if defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD)
+#define H5Z_BITSHUFFLE_COMPRESS_USED /*void*/
+#else
+#define H5Z_BITSHUFFLE_COMPRESS_USED H5_ATTR_UNUSED
+#endif
+
+/* Transpose the 8x8 matrix of bits in the 64-bit integer X, whose bytes are
+ * the rows, using T as scratch space */
+#define H5Z_BITSHUFFLE_TRANSPOSE(x, t)                                                                       \
+    {                                                                                                        \
+        (t) = ((x) ^ ((x) >> 7)) & 0x00AA00AA00AA00AAULL;                                                    \
+        (x) = (x) ^ (t) ^ ((t) << 7);                                                                        \
+        (t) = ((x) ^ ((x) >> 14)) & 0x0000CCCC0000CCCCULL;                                                   \
+        (x) = (x) ^ (t) ^ ((t) << 14);                                                                       \
+        (t) = ((x) ^ ((x) >> 28)) & 0x00000000F0F0F0F0ULL;                                                   \
+        (x) = (x) ^ (t) ^ ((t) << 28);                                                                       \
+    }
+
+/* Encode / decode big-endian sizes */
+#define H5Z_BITSHUFFLE_ENCODE(p, n, v)                                                                       \
+    {                                                                                                        \
+        unsigned _u;                                                                                         \
+                                                                                                             \
+        for (_u = 0; _u < (n); _u++)                                                                         \
+            (p)[_u] = (uint8_t)((uint64_t)(v) >> (8 * ((n)-_u - 1)));                                        \
+        (p) += (n);                                                                                          \
+    }
+#define H5Z_BITSHUFFLE_DECODE(p, n, v)                                                                       \
+    {                                                                                                        \
+        unsigned _u;                                                                                         \
+                                                                                                             \
+        for ((v) = 0, _u = 0; _u < (n); _u++)                                                                \
+            (v) = ((v) << 8) | (p)[_u];                                                                      \
+        (p) += (n);                                                                                          \
+    }
+
+/* Local typedefs */
+
+/* Vector kernel that transposes the bits of as many as it can of the NBYTES
+ * bytes in SRC into DEST (or back), and returns the number of bytes done */
+typedef size_t (*H5Z_bitshuffle_kernel_t)(size_t nbytes, const uint8_t *src, uint8_t *dest);
+
+/* Settings for bitshuffling a chunk */
+typedef struct H5Z_bitshuffle_parms_t {
+    unsigned size;       /* Size of each element */
+    size_t   block_size; /* # of elements in each block */
+    unsigned compress;   /* Compressor for the blocks (H5Z_BITSHUFFLE_*) */
+    int      level;      /* Compression level for zstd */
+} H5Z_bitshuffle_parms_t;
+
+/* Local function prototypes */
+static herr_t  H5Z__set_local_bitshuffle(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+static size_t  H5Z__filter_bitshuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                                      size_t nbytes, size_t *buf_size, void **buf);
+static hbool_t H5Z__bitshuffle_compress_avail(unsigned compress);
+static size_t  H5Z__bitshuffle_default_block_size(unsigned size);
+static void    H5Z__bitshuffle_init_kernels(void);
+static void    H5Z__bitshuffle_bits(size_t nbytes, const uint8_t *src, uint8_t *dest);
+static void    H5Z__bitunshuffle_bits(size_t nbytes, const uint8_t *src, uint8_t *dest);
+static void    H5Z__bitshuffle_elmts(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest,
+                                     uint8_t *tmp);
+static void    H5Z__bitunshuffle_elmts(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest,
+                                       uint8_t *tmp);
+static size_t  H5Z__bitshuffle_bound(const H5Z_bitshuffle_parms_t *parms, size_t nbytes);
+static size_t  H5Z__bitshuffle_compress(const H5Z_bitshuffle_parms_t *parms, const uint8_t *src,
+                                        size_t nbytes, uint8_t *dest, size_t dest_size);
+static herr_t  H5Z__bitshuffle_decompress(const H5Z_bitshuffle_parms_t *parms, const uint8_t *src,
+                                          size_t src_nbytes, uint8_t *dest, size_t nbytes);
+#ifdef __SSE2__
+static size_t H5Z__bitshuffle_bits_sse2(size_t nbytes, const uint8_t *src, uint8_t *dest);
+static size_t H5Z__bitunshuffle_bits_sse2(size_t nbytes, const uint8_t *src, uint8_t *dest);
+#endif /* __SSE2__ */
+#ifdef H5_HAVE_AVX2_DISPATCH
+static size_t H5Z__bitshuffle_bits_avx2(size_t nbytes, const uint8_t *src, uint8_t *dest);
+static size_t H5Z__bitunshuffle_bits_avx2(size_t nbytes, const uint8_t *src, uint8_t *dest);
+#endif /* H5_HAVE_AVX2_DISPATCH */
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_BITSHUFFLE[1] = {{
+    H5Z_CLASS_T_VERS,          /* H5Z_class_t version */
+    H5Z_FILTER_BITSHUFFLE,     /* Filter id number		*/
+    1,                         /* encoder_present flag (set to true) */
+    1,                         /* decoder_present flag (set to true) */
+    "bitshuffle",              /* Filter name for debugging	*/
+    NULL,                      /* The "can apply" callback     */
+    H5Z__set_local_bitshuffle, /* The "set local" callback     */
+    H5Z__filter_bitshuffle,    /* The actual filter function	*/
+}};
+
+/* Vector kernels for the CPU that's running, chosen on first use */
+static hbool_t                 H5Z_bitshuffle_kernels_init_g = FALSE;
+static H5Z_bitshuffle_kernel_t H5Z_bitshuffle_kernel_g       = NULL; /* Transposes bytes into bits */
+static H5Z_bitshuffle_kernel_t H5Z_bitunshuffle_kernel_g     = NULL; /* Transposes bits into bytes */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__set_local_bitshuffle
+ *
+ * Purpose:     Set the "local" dataset parameters for bitshuffling: the
+ *              format's version and the size of the datatype.  The
+ *              parameters the user set are checked and kept.
+ *
+ * Return:      Success: Non-negative
+ *              Failure: Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__set_local_bitshuffle(hid_t dcpl_id, hid_t type_id, hid_t H5_ATTR_UNUSED space_id)
+{
+    H5P_genplist_t *dcpl_plist;                              /* Property list pointer */
+    const H5T_t *   type;                                    /* Datatype */
+    unsigned        flags;                                   /* Filter flags */
+    size_t          cd_nelmts = H5Z_BITSHUFFLE_TOTAL_NPARMS; /* Number of filter parameters */
+    unsigned        cd_values[H5Z_BITSHUFFLE_TOTAL_NPARMS];  /* Filter parameters */
+    herr_t          ret_value = SUCCEED;                     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDmemset(cd_values, 0, sizeof(cd_values));
+
+    /* Get the plist structure */
+    if (NULL == (dcpl_plist = H5P_object_verify(dcpl_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get datatype */
+    if (NULL == (type = (const H5T_t *)H5I_object_verify(type_id, H5I_DATATYPE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+
+    /* Get the filter's current parameters */
+    if (H5P_get_filter_by_id(dcpl_plist, H5Z_FILTER_BITSHUFFLE, &flags, &cd_nelmts, cd_values, (size_t)0,
+                             NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get bitshuffle parameters")
+    cd_nelmts = MIN(cd_nelmts, H5Z_BITSHUFFLE_TOTAL_NPARMS);
+
+    /* Check the parameters the user set */
+    if (cd_nelmts > H5Z_BITSHUFFLE_PARM_BLOCK_SIZE &&
+        cd_values[H5Z_BITSHUFFLE_PARM_BLOCK_SIZE] % H5Z_BITSHUFFLE_BLOCK_MULT != 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FAIL, "bitshuffle block size must be a multiple of 8")
+    if (cd_nelmts > H5Z_BITSHUFFLE_PARM_COMPRESS &&
+        !H5Z__bitshuffle_compress_avail(cd_values[H5Z_BITSHUFFLE_PARM_COMPRESS]))
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FAIL, "bitshuffle compressor is not available")
+    if (cd_nelmts > H5Z_BITSHUFFLE_PARM_LEVEL && cd_values[H5Z_BITSHUFFLE_PARM_LEVEL] > H5Z_ZSTD_MAX_LEVEL)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FAIL, "invalid bitshuffle compression level")
+
+    /* Set "local" parameters for this dataset */
+    cd_values[H5Z_BITSHUFFLE_PARM_MAJOR] = 0;
+    cd_values[H5Z_BITSHUFFLE_PARM_MINOR] = 0;
+    if ((cd_values[H5Z_BITSHUFFLE_PARM_SIZE] = (unsigned)H5T_get_size(type)) == 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "bad datatype size")
+    cd_nelmts = MAX(cd_nelmts, H5Z_BITSHUFFLE_PARM_SIZE + 1);
+
+    /* Modify the filter's parameters for this dataset */
+    if (H5P_modify_filter(dcpl_plist, H5Z_FILTER_BITSHUFFLE, flags, cd_nelmts, cd_values) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTSET, FAIL, "can't set local bitshuffle parameters")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__set_local_bitshuffle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitshuffle_compress_avail
+ *
+ * Purpose:     Check whether COMPRESS names a compressor for the blocks
+ *              that the library was built with.
+ *
+ * Return:      TRUE or FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5Z__bitshuffle_compress_avail(unsigned compress)
+{
+    hbool_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (compress) {
+        case H5Z_BITSHUFFLE_NO_COMPRESS:
+#ifdef H5_HAVE_FILTER_LZ4
+        case H5Z_BITSHUFFLE_LZ4:
+#endif /* H5_HAVE_FILTER_LZ4 */
+#ifdef H5_HAVE_FILTER_ZSTD
+        case H5Z_BITSHUFFLE_ZSTD:
+#endif /* H5_HAVE_FILTER_ZSTD */
+            ret_value = TRUE;
+            break;
+
+        default:
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitshuffle_compress_avail() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitshuffle_default_block_size
+ *
+ * Purpose:     Choose the number of elements of SIZE bytes in a block
+ *              when the user didn't: enough for a block of about 8 KiB,
+ *              which fits in the L1 cache, but no fewer than 128.
+ *
+ * Return:      The number of elements in each block
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__bitshuffle_default_block_size(unsigned size)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value = H5Z_BITSHUFFLE_TARGET_NBYTES / size;
+    ret_value -= ret_value % H5Z_BITSHUFFLE_BLOCK_MULT;
+    ret_value = MAX(ret_value, H5Z_BITSHUFFLE_MIN_BLOCK_SIZE);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitshuffle_default_block_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitshuffle_init_kernels
+ *
+ * Purpose:     Choose the vector kernels for transposing bits on the CPU
+ *              that's running: AVX2 where the CPU has it, otherwise SSE2
+ *              if the library was built for it.  Other CPUs transpose
+ *              eight bytes at a time in a 64-bit integer.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__bitshuffle_init_kernels(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef __SSE2__
+    H5Z_bitshuffle_kernel_g   = H5Z__bitshuffle_bits_sse2;
+    H5Z_bitunshuffle_kernel_g = H5Z__bitunshuffle_bits_sse2;
+#endif /* __SSE2__ */
+
+#ifdef H5_HAVE_AVX2_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        H5Z_bitshuffle_kernel_g   = H5Z__bitshuffle_bits_avx2;
+        H5Z_bitunshuffle_kernel_g = H5Z__bitunshuffle_bits_avx2;
+    } /* end if */
+#endif /* H5_HAVE_AVX2_DISPATCH */
+
+    H5Z_bitshuffle_kernels_init_g = TRUE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__bitshuffle_init_kernels() */
+
+/*
+ * The kernels below transpose a run of NBYTES bytes (a multiple of 8) into
+ * 8 runs of NBYTES / 8 bytes: bit K of byte I goes to bit I % 8 of byte
+ * I / 8 of run K.
+ *
+ * Going forward, the vector kernels collect the top bit of each byte in a
+ * vector with a "move mask" instruction and shift the bytes left, once for
+ * each run.  Going back, they interleave 16 (or 32) bytes from each run
+ * into 8-byte groups, and transpose each group as a 64-bit integer.
+ */
+
+#ifdef __SSE2__
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitshuffle_bits_sse2
+ *
+ * Purpose:     Transpose the bytes in SRC into runs of bits in DEST, 16
+ *              bytes at a time with SSE2 instructions.
+ *
+ * Return:      The number of bytes transposed
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__bitshuffle_bits_sse2(size_t nbytes, const uint8_t *src, uint8_t *dest)
+{
+    size_t nrun = nbytes / 8; /* Size of each run of bits */
+    size_t i;
+    int    k;
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (i = 0; i + 16 <= nbytes; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+
+        for (k = 7; k >= 0; k--) {
+            uint16_t mask = (uint16_t)_mm_movemask_epi8(v);
+
+            H5MM_memcpy(dest + ((size_t)k * nrun) + (i / 8), &mask, sizeof(mask));
+            v = _mm_add_epi8(v, v);
+        } /* end for */
+    }     /* end for */
+    ret_value = i;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitshuffle_bits_sse2() */
+
+/* Transpose the bits of each 64-bit lane of X, as H5Z_BITSHUFFLE_TRANSPOSE */
+static H5_INLINE __m128i
+H5Z__bitshuffle_transpose_sse2(__m128i x)
+{
+    __m128i t;
+
+    t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x, 7)), _mm_set1_epi64x(0x00AA00AA00AA00AALL));
+    x = _mm_xor_si128(_mm_xor_si128(x, t), _mm_slli_epi64(t, 7));
+    t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x, 14)), _mm_set1_epi64x(0x0000CCCC0000CCCCLL));
+    x = _mm_xor_si128(_mm_xor_si128(x, t), _mm_slli_epi64(t, 14));
+    t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x, 28)), _mm_set1_epi64x(0x00000000F0F0F0F0LL));
+    x = _mm_xor_si128(_mm_xor_si128(x, t), _mm_slli_epi64(t, 28));
+
+    return x;
+} /* end H5Z__bitshuffle_transpose_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitunshuffle_bits_sse2
+ *
+ * Purpose:     Transpose the runs of bits in SRC back into bytes in DEST,
+ *              16 bytes of each run at a time with SSE2 instructions.
+ *
+ * Return:      The number of bytes transposed
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__bitunshuffle_bits_sse2(size_t nbytes, const uint8_t *src, uint8_t *dest)
+{
+    size_t   nrun = nbytes / 8; /* Size of each run of bits */
+    size_t   g;
+    unsigned k;
+    size_t   ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (g = 0; g + 16 <= nrun; g += 16) {
+        __m128i p[8], a[8], b[8], c[8];
+
+        for (k = 0; k < 8; k++)
+            p[k] = _mm_loadu_si128((const __m128i *)(src + (k * nrun) + g));
+
+        /* Interleave the runs, so that each 64 bits holds byte G of every run */
+        for (k = 0; k < 4; k++) {
+            a[2 * k]     = _mm_unpacklo_epi8(p[2 * k], p[2 * k + 1]);
+            a[2 * k + 1] = _mm_unpackhi_epi8(p[2 * k], p[2 * k + 1]);
+        } /* end for */
+        for (k = 0; k < 2; k++) {
+            b[4 * k]     = _mm_unpacklo_epi16(a[4 * k], a[4 * k + 2]);
+            b[4 * k + 1] = _mm_unpackhi_epi16(a[4 * k], a[4 * k + 2]);
+            b[4 * k + 2] = _mm_unpacklo_epi16(a[4 * k + 1], a[4 * k + 3]);
+            b[4 * k + 3] = _mm_unpackhi_epi16(a[4 * k + 1], a[4 * k + 3]);
+        } /* end for */
+        for (k = 0; k < 4; k++) {
+            c[2 * k]     = _mm_unpacklo_epi32(b[k], b[k + 4]);
+            c[2 * k + 1] = _mm_unpackhi_epi32(b[k], b[k + 4]);
+        } /* end for */
+
+        for (k = 0; k < 8; k++)
+            _mm_storeu_si128((__m128i *)(dest + ((g + (2 * k)) * 8)), H5Z__bitshuffle_transpose_sse2(c[k]));
+    } /* end for */
+    ret_value = g * 8;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitunshuffle_bits_sse2() */
+#endif /* __SSE2__ */
+
+#ifdef H5_HAVE_AVX2_DISPATCH
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitshuffle_bits_avx2
+ *
+ * Purpose:     Transpose the bytes in SRC into runs of bits in DEST, 32
+ *              bytes at a time with AVX2 instructions.
+ *
+ * Return:      The number of bytes transposed
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5Z_BITSHUFFLE_AVX2 size_t
+H5Z__bitshuffle_bits_avx2(size_t nbytes, const uint8_t *src, uint8_t *dest)
+{
+    size_t nrun = nbytes / 8; /* Size of each run of bits */
+    size_t i;
+    int    k;
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (i = 0; i + 32 <= nbytes; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+
+        for (k = 7; k >= 0; k--) {
+            uint32_t mask = (uint32_t)_mm256_movemask_epi8(v);
+
+            H5MM_memcpy(dest + ((size_t)k * nrun) + (i / 8), &mask, sizeof(mask));
+            v = _mm256_add_epi8(v, v);
+        } /* end for */
+    }     /* end for */
+    ret_value = i;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitshuffle_bits_avx2() */
+
+/* Transpose the bits of each 64-bit lane of X, as H5Z_BITSHUFFLE_TRANSPOSE */
+static H5_INLINE H5Z_BITSHUFFLE_AVX2 __m256i
+H5Z__bitshuffle_transpose_avx2(__m256i x)
+{
+    __m256i t;
+
+    t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi64(x, 7)),
+                         _mm256_set1_epi64x(0x00AA00AA00AA00AALL));
+    x = _mm256_xor_si256(_mm256_xor_si256(x, t), _mm256_slli_epi64(t, 7));
+    t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi64(x, 14)),
+                         _mm256_set1_epi64x(0x0000CCCC0000CCCCLL));
+    x = _mm256_xor_si256(_mm256_xor_si256(x, t), _mm256_slli_epi64(t, 14));
+    t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi64(x, 28)),
+                         _mm256_set1_epi64x(0x00000000F0F0F0F0LL));
+    x = _mm256_xor_si256(_mm256_xor_si256(x, t), _mm256_slli_epi64(t, 28));
+
+    return x;
+} /* end H5Z__bitshuffle_transpose_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitunshuffle_bits_avx2
+ *
+ * Purpose:     Transpose the runs of bits in SRC back into bytes in DEST,
+ *              32 bytes of each run at a time with AVX2 instructions.
+ *              AVX2 interleaves within each 128-bit lane, so the lanes
+ *              hold the bytes for the first and second 16 groups.
+ *
+ * Return:      The number of bytes transposed
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5Z_BITSHUFFLE_AVX2 size_t
+H5Z__bitunshuffle_bits_avx2(size_t nbytes, const uint8_t *src, uint8_t *dest)
+{
+    size_t   nrun = nbytes / 8; /* Size of each run of bits */
+    size_t   g;
+    unsigned k;
+    size_t   ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (g = 0; g + 32 <= nrun; g += 32) {
+        __m256i p[8], a[8], b[8], c[8];
+
+        for (k = 0; k < 8; k++)
+            p[k] = _mm256_loadu_si256((const __m256i *)(src + (k * nrun) + g));
+
+        /* Interleave the runs, so that each 64 bits holds byte G of every run */
+        for (k = 0; k < 4; k++) {
+            a[2 * k]     = _mm256_unpacklo_epi8(p[2 * k], p[2 * k + 1]);
+            a[2 * k + 1] = _mm256_unpackhi_epi8(p[2 * k], p[2 * k + 1]);
+        } /* end for */
+        for (k = 0; k < 2; k++) {
+            b[4 * k]     = _mm256_unpacklo_epi16(a[4 * k], a[4 * k + 2]);
+            b[4 * k + 1] = _mm256_unpackhi_epi16(a[4 * k], a[4 * k + 2]);
+            b[4 * k + 2] = _mm256_unpacklo_epi16(a[4 * k + 1], a[4 * k + 3]);
+            b[4 * k + 3] = _mm256_unpackhi_epi16(a[4 * k + 1], a[4 * k + 3]);
+        } /* end for */
+        for (k = 0; k < 4; k++) {
+            c[2 * k]     = _mm256_unpacklo_epi32(b[k], b[k + 4]);
+            c[2 * k + 1] = _mm256_unpackhi_epi32(b[k], b[k + 4]);
+        } /* end for */
+
+        for (k = 0; k < 8; k++) {
+            __m256i x = H5Z__bitshuffle_transpose_avx2(c[k]);
+
+            _mm_storeu_si128((__m128i *)(dest + ((g + (2 * k)) * 8)), _mm256_castsi256_si128(x));
+            _mm_storeu_si128((__m128i *)(dest + ((g + 16 + (2 * k)) * 8)), _mm256_extracti128_si256(x, 1));
+        } /* end for */
+    }     /* end for */
+    ret_value = g * 8;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitunshuffle_bits_avx2() */
+#endif /* H5_HAVE_AVX2_DISPATCH */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitshuffle_bits
+ *
+ * Purpose:     Transpose the NBYTES bytes in SRC into 8 runs of bits in
+ *              DEST, with the vector kernel for as many as it can do and
+ *              eight bytes at a time for the rest.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__bitshuffle_bits(size_t nbytes, const uint8_t *src, uint8_t *dest)
+{
+    size_t   nrun = nbytes / 8; /* Size of each run of bits */
+    size_t   i    = 0;
+    uint64_t x, t;
+    unsigned k;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(nbytes % 8 == 0);
+
+    if (H5Z_bitshuffle_kernel_g)
+        i = (*H5Z_bitshuffle_kernel_g)(nbytes, src, dest);
+
+    for (; i < nbytes; i += 8) {
+        for (x = 0, k = 0; k < 8; k++)
+            x |= (uint64_t)src[i + k] << (8 * k);
+        H5Z_BITSHUFFLE_TRANSPOSE(x, t)
+        for (k = 0; k < 8; k++, x >>= 8)
+            dest[(k * nrun) + (i / 8)] = (uint8_t)x;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__bitshuffle_bits() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitunshuffle_bits
+ *
+ * Purpose:     Undo H5Z__bitshuffle_bits, transposing the 8 runs of bits
+ *              in SRC back into NBYTES bytes in DEST.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__bitunshuffle_bits(size_t nbytes, const uint8_t *src, uint8_t *dest)
+{
+    size_t   nrun = nbytes / 8; /* Size of each run of bits */
+    size_t   i    = 0;
+    uint64_t x, t;
+    unsigned k;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(nbytes % 8 == 0);
+
+    if (H5Z_bitunshuffle_kernel_g)
+        i = (*H5Z_bitunshuffle_kernel_g)(nbytes, src, dest);
+
+    for (; i < nbytes; i += 8) {
+        for (x = 0, k = 0; k < 8; k++)
+            x |= (uint64_t)src[(k * nrun) + (i / 8)] << (8 * k);
+        H5Z_BITSHUFFLE_TRANSPOSE(x, t)
+        for (k = 0; k < 8; k++, x >>= 8)
+            dest[i + k] = (uint8_t)x;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__bitunshuffle_bits() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitshuffle_elmts
+ *
+ * Purpose:     Bitshuffle a block of NELMTS elements (a multiple of 8) of
+ *              SIZE bytes from SRC into DEST, shuffling their bytes into
+ *              TMP first.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__bitshuffle_elmts(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest, uint8_t *tmp)
+{
+    unsigned u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Shuffle the bytes, then transpose each run of bytes into bits */
+    if (size > 1) {
+        H5Z__shuffle_bytes(size, nelmts, src, tmp);
+        src = tmp;
+    } /* end if */
+    for (u = 0; u < size; u++)
+        H5Z__bitshuffle_bits(nelmts, src + (u * nelmts), dest + (u * nelmts));
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__bitshuffle_elmts() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitunshuffle_elmts
+ *
+ * Purpose:     Undo H5Z__bitshuffle_elmts, using TMP for the shuffled
+ *              bytes.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__bitunshuffle_elmts(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest, uint8_t *tmp)
+{
+    unsigned u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Transpose each run of bits back into bytes, then unshuffle the bytes */
+    if (size > 1) {
+        for (u = 0; u < size; u++)
+            H5Z__bitunshuffle_bits(nelmts, src + (u * nelmts), tmp + (u * nelmts));
+        H5Z__unshuffle_bytes(size, nelmts, tmp, dest);
+    } /* end if */
+    else
+        H5Z__bitunshuffle_bits(nelmts, src, dest);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__bitunshuffle_elmts() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitshuffle_bound
+ *
+ * Purpose:     Compute the most bytes a block of NBYTES can take once
+ *              it's compressed.
+ *
+ * Return:      Success: The size of the compressed block
+ *              Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__bitshuffle_bound(const H5Z_bitshuffle_parms_t *parms, size_t H5Z_BITSHUFFLE_COMPRESS_USED nbytes)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    switch (parms->compress) {
+#ifdef H5_HAVE_FILTER_LZ4
+        case H5Z_BITSHUFFLE_LZ4:
+            if (nbytes > LZ4_MAX_INPUT_SIZE)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "bitshuffle block is too big for lz4")
+            ret_value = (size_t)LZ4_compressBound((int)nbytes);
+            break;
+#endif /* H5_HAVE_FILTER_LZ4 */
+
+#ifdef H5_HAVE_FILTER_ZSTD
+        case H5Z_BITSHUFFLE_ZSTD:
+            ret_value = ZSTD_compressBound(nbytes);
+            break;
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+        default:
+            HGOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, 0, "bitshuffle compressor is not available")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitshuffle_bound() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitshuffle_compress
+ *
+ * Purpose:     Compress the NBYTES in SRC into the DEST_SIZE bytes at
+ *              DEST.
+ *
+ * Return:      Success: The size of the compressed block
+ *              Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__bitshuffle_compress(const H5Z_bitshuffle_parms_t *parms,
+                         const uint8_t H5Z_BITSHUFFLE_COMPRESS_USED *src,
+                         size_t H5Z_BITSHUFFLE_COMPRESS_USED nbytes,
+                         uint8_t H5Z_BITSHUFFLE_COMPRESS_USED *dest,
+                         size_t H5Z_BITSHUFFLE_COMPRESS_USED dest_size)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    switch (parms->compress) {
+#ifdef H5_HAVE_FILTER_LZ4
+        case H5Z_BITSHUFFLE_LZ4: {
+            int nout; /* Size of the block, compressed */
+
+            if ((nout = LZ4_compress_default((const char *)src, (char *)dest, (int)nbytes, (int)dest_size)) <=
+                0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "lz4 compression failed")
+            ret_value = (size_t)nout;
+        } break;
+#endif /* H5_HAVE_FILTER_LZ4 */
+
+#ifdef H5_HAVE_FILTER_ZSTD
+        case H5Z_BITSHUFFLE_ZSTD:
+            ret_value = ZSTD_compress(dest, dest_size, src, nbytes, parms->level);
+            if (ZSTD_isError(ret_value))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "zstd compression failed")
+            break;
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+        default:
+            HGOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, 0, "bitshuffle compressor is not available")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitshuffle_compress() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__bitshuffle_decompress
+ *
+ * Purpose:     Uncompress the SRC_NBYTES in SRC into the NBYTES at DEST,
+ *              which must be exactly filled.
+ *
+ * Return:      Success: Non-negative
+ *              Failure: Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__bitshuffle_decompress(const H5Z_bitshuffle_parms_t *parms,
+                           const uint8_t H5Z_BITSHUFFLE_COMPRESS_USED *src,
+                           size_t H5Z_BITSHUFFLE_COMPRESS_USED src_nbytes,
+                           uint8_t H5Z_BITSHUFFLE_COMPRESS_USED *dest,
+                           size_t H5Z_BITSHUFFLE_COMPRESS_USED nbytes)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    switch (parms->compress) {
+#ifdef H5_HAVE_FILTER_LZ4
+        case H5Z_BITSHUFFLE_LZ4:
+            if (LZ4_decompress_safe((const char *)src, (char *)dest, (int)src_nbytes, (int)nbytes) !=
+                (int)nbytes)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "lz4 uncompression failed")
+            break;
+#endif /* H5_HAVE_FILTER_LZ4 */
+
+#ifdef H5_HAVE_FILTER_ZSTD
+        case H5Z_BITSHUFFLE_ZSTD:
+            if (ZSTD_decompress(dest, nbytes, src, src_nbytes) != nbytes)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "zstd uncompression failed")
+            break;
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+        default:
+            HGOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, FAIL, "bitshuffle compressor is not available")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitshuffle_decompress() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__filter_bitshuffle
+ *
+ * Purpose:     Implement an I/O filter which transposes the bits of the
+ *              elements in a block of data, putting the bits in each bit
+ *              position together.  Bits of the same significance in
+ *              related values (integers from a sensor, floating-point
+ *              numbers with similar exponents) tend to be alike, so the
+ *              result compresses better than after a byte shuffle.
+ *
+ * Return:      Success: Size of buffer filtered
+ *              Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_bitshuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                       size_t *buf_size, void **buf)
+{
+    H5Z_bitshuffle_parms_t parms;                             /* Settings for the chunk */
+    uint8_t *              outbuf = NULL;                     /* Pointer to new buffer */
+    uint8_t *              tmp    = NULL;                     /* Scratch space for a block */
+    uint8_t *              blk;                               /* Block, before compression */
+    const uint8_t *        src     = (const uint8_t *)(*buf); /* Next byte to read */
+    const uint8_t *        src_end = src + nbytes;            /* End of the input */
+    uint8_t *              dst;                               /* Next byte to write */
+    size_t                 orig_size;                         /* Size of the chunk, unfiltered */
+    size_t                 nelmts;                            /* # of elements in the chunk */
+    size_t                 nblocked;                          /* # of elements bitshuffled in blocks */
+    size_t                 block_nbytes;                      /* Size of a full block */
+    size_t                 nalloc;                            /* Size of the output buffer */
+    size_t                 done;                              /* # of elements processed */
+    size_t                 ret_value = 0;                     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(*buf_size > 0);
+    HDassert(buf);
+    HDassert(*buf);
+
+    /* Get the element size and the compression settings */
+    if (cd_nelmts <= H5Z_BITSHUFFLE_PARM_SIZE || cd_values[H5Z_BITSHUFFLE_PARM_SIZE] == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid bitshuffle parameters")
+    parms.size       = cd_values[H5Z_BITSHUFFLE_PARM_SIZE];
+    parms.block_size = 0;
+    parms.compress   = H5Z_BITSHUFFLE_NO_COMPRESS;
+    parms.level      = 0;
+    if (cd_nelmts > H5Z_BITSHUFFLE_PARM_BLOCK_SIZE)
+        parms.block_size = cd_values[H5Z_BITSHUFFLE_PARM_BLOCK_SIZE];
+    if (cd_nelmts > H5Z_BITSHUFFLE_PARM_COMPRESS)
+        parms.compress = cd_values[H5Z_BITSHUFFLE_PARM_COMPRESS];
+    if (cd_nelmts > H5Z_BITSHUFFLE_PARM_LEVEL) {
+        if (cd_values[H5Z_BITSHUFFLE_PARM_LEVEL] > H5Z_ZSTD_MAX_LEVEL)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid bitshuffle compression level")
+        parms.level = (int)cd_values[H5Z_BITSHUFFLE_PARM_LEVEL];
+    } /* end if */
+    if (!H5Z__bitshuffle_compress_avail(parms.compress))
+        HGOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, 0, "bitshuffle compressor is not available")
+
+    /* Compressed chunks record their size and block size */
+    if (parms.compress != H5Z_BITSHUFFLE_NO_COMPRESS && (flags & H5Z_FLAG_REVERSE)) {
+        uint64_t hdr_orig_size;    /* Size of the chunk, from the header */
+        uint32_t hdr_block_nbytes; /* Size of a block, from the header */
+
+        if (nbytes < H5Z_BITSHUFFLE_HDR_SIZE)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "bitshuffle chunk is too small")
+        H5Z_BITSHUFFLE_DECODE(src, 8, hdr_orig_size);
+        H5Z_BITSHUFFLE_DECODE(src, 4, hdr_block_nbytes);
+        if (hdr_orig_size > (uint64_t)((size_t)-1) || hdr_block_nbytes % parms.size != 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "invalid bitshuffle chunk header")
+        orig_size        = (size_t)hdr_orig_size;
+        parms.block_size = hdr_block_nbytes / parms.size;
+        if (0 == parms.block_size)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "invalid bitshuffle chunk header")
+    } /* end if */
+    else {
+        orig_size = nbytes;
+        if (0 == parms.block_size)
+            parms.block_size = H5Z__bitshuffle_default_block_size(parms.size);
+    } /* end else */
+    if (parms.block_size % H5Z_BITSHUFFLE_BLOCK_MULT != 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "bitshuffle block size must be a multiple of 8")
+    if (orig_size % parms.size != 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "bitshuffle chunk isn't a whole number of elements")
+    if (parms.block_size > (size_t)UINT32_MAX / parms.size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "bitshuffle block size is too large")
+    nelmts       = orig_size / parms.size;
+    nblocked     = nelmts - (nelmts % H5Z_BITSHUFFLE_BLOCK_MULT);
+    block_nbytes = parms.block_size * parms.size;
+
+    /* Allocate the output buffer */
+    if (parms.compress != H5Z_BITSHUFFLE_NO_COMPRESS && !(flags & H5Z_FLAG_REVERSE)) {
+        size_t nblocks = (nblocked + parms.block_size - 1) / parms.block_size; /* # of blocks */
+        size_t bound;                                                          /* Compressed block size */
+
+        if (0 == (bound = H5Z__bitshuffle_bound(&parms, block_nbytes)))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "can't compute size of compressed blocks")
+        nalloc = H5Z_BITSHUFFLE_HDR_SIZE + (nblocks * (4 + bound)) + (orig_size - (nblocked * parms.size));
+    } /* end if */
+    else
+        nalloc = MAX(orig_size, 1);
+    if (NULL == (outbuf = (uint8_t *)H5MM_malloc(nalloc)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for bitshuffle buffer")
+
+    /* Allocate space for shuffling the bytes of a block, and for a block
+     * before it's compressed or after it's uncompressed */
+    if (NULL == (tmp = (uint8_t *)H5MM_malloc(MAX(2 * MIN(parms.block_size, nblocked) * parms.size, 1))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for bitshuffle block")
+    blk = tmp + (MIN(parms.block_size, nblocked) * parms.size);
+
+    /* Choose the vector kernels for this CPU, the first time through */
+    if (!H5Z_bitshuffle_kernels_init_g)
+        H5Z__bitshuffle_init_kernels();
+
+    dst = outbuf;
+    if (parms.compress != H5Z_BITSHUFFLE_NO_COMPRESS && !(flags & H5Z_FLAG_REVERSE)) {
+        H5Z_BITSHUFFLE_ENCODE(dst, 8, orig_size);
+        H5Z_BITSHUFFLE_ENCODE(dst, 4, block_nbytes);
+    } /* end if */
+
+    /* [Un]bitshuffle each block, the last of which may be smaller */
+    for (done = 0; done < nblocked; done += parms.block_size) {
+        size_t n          = MIN(parms.block_size, nblocked - done); /* # of elements in the block */
+        size_t blk_nbytes = n * parms.size;                         /* Size of the block */
+
+        if (parms.compress == H5Z_BITSHUFFLE_NO_COMPRESS) {
+            if (flags & H5Z_FLAG_REVERSE)
+                H5Z__bitunshuffle_elmts(parms.size, n, src, dst, tmp);
+            else
+                H5Z__bitshuffle_elmts(parms.size, n, src, dst, tmp);
+            src += blk_nbytes;
+            dst += blk_nbytes;
+        } /* end if */
+        else if (flags & H5Z_FLAG_REVERSE) {
+            uint32_t comp_size; /* Size of the block, compressed */
+
+            if (src_end - src < 4)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "bitshuffle chunk is truncated")
+            H5Z_BITSHUFFLE_DECODE(src, 4, comp_size);
+            if ((size_t)(src_end - src) < comp_size)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "bitshuffle chunk is truncated")
+            if (H5Z__bitshuffle_decompress(&parms, src, (size_t)comp_size, blk, blk_nbytes) < 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "can't uncompress bitshuffle block")
+            H5Z__bitunshuffle_elmts(parms.size, n, blk, dst, tmp);
+            src += comp_size;
+            dst += blk_nbytes;
+        } /* end if */
+        else {
+            size_t comp_size; /* Size of the block, compressed */
+
+            H5Z__bitshuffle_elmts(parms.size, n, src, blk, tmp);
+            if (0 == (comp_size = H5Z__bitshuffle_compress(&parms, blk, blk_nbytes, dst + 4,
+                                                           nalloc - (size_t)(dst + 4 - outbuf))))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "can't compress bitshuffle block")
+            H5Z_BITSHUFFLE_ENCODE(dst, 4, comp_size);
+            src += blk_nbytes;
+            dst += comp_size;
+        } /* end else */
+    }     /* end for */
+
+    /* Copy the elements left over as they are */
+    if ((size_t)(src_end - src) < orig_size - (nblocked * parms.size))
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "bitshuffle chunk is truncated")
+    H5MM_memcpy(dst, src, orig_size - (nblocked * parms.size));
+    dst += orig_size - (nblocked * parms.size);
+
+    /* Free the input buffer */
+    H5MM_xfree(*buf);
+
+    /* Set return values */
+    *buf      = outbuf;
+    outbuf    = NULL;
+    *buf_size = nalloc;
+    ret_value = (size_t)(dst - (uint8_t *)(*buf));
+
+done:
+    if (outbuf)
+        H5MM_xfree(outbuf);
+    if (tmp)
+        H5MM_xfree(tmp);
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_bitshuffle() */
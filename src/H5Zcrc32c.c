@@ -0,0 +1,118 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     An I/O filter that detects errors in a chunk with a CRC-32C
+ *              checksum, which is appended to the chunk, little-endian, as
+ *              the Fletcher32 filter does with its checksum.  CRC-32C is
+ *              computed with the CPU's CRC instructions where it has them.
+ */
+
+#include "H5Zmodule.h" /* This source code file is part of the H5Z module */
+
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5Fprivate.h"  /* File access                          */
+#include "H5MMprivate.h" /* Memory management			*/
+#include "H5Zpkg.h"      /* Data filters				*/
+
+/* Local macros */
+#define H5Z_CRC32C_LEN 4 /* Size of the checksum */
+
+/* Local function prototypes */
+static size_t H5Z__filter_crc32c(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                                 size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_CRC32C[1] = {{
+    H5Z_CLASS_T_VERS,   /* H5Z_class_t version */
+    H5Z_FILTER_CRC32C,  /* Filter id number		*/
+    1,                  /* encoder_present flag (set to true) */
+    1,                  /* decoder_present flag (set to true) */
+    "crc32c",           /* Filter name for debugging	*/
+    NULL,               /* The "can apply" callback     */
+    NULL,               /* The "set local" callback     */
+    H5Z__filter_crc32c, /* The actual filter function	*/
+}};
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__filter_crc32c
+ *
+ * Purpose:     Implement an I/O filter of CRC-32C Checksum
+ *
+ * Return:      Success: Size of buffer filtered
+ *              Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_crc32c(unsigned flags, size_t H5_ATTR_UNUSED cd_nelmts, const unsigned H5_ATTR_UNUSED cd_values[],
+                   size_t nbytes, size_t *buf_size, void **buf)
+{
+    uint8_t *src = (uint8_t *)(*buf); /* Data to checksum */
+    uint8_t *p;                       /* Pointer to the checksum */
+    uint32_t crc;                     /* Checksum value */
+    size_t   ret_value = 0;           /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (flags & H5Z_FLAG_REVERSE) { /* Read */
+        if (nbytes < H5Z_CRC32C_LEN)
+            HGOTO_ERROR(H5E_STORAGE, H5E_READERROR, 0, "chunk is too small for CRC-32C checksum")
+
+        /* Do checksum if it's enabled for read; otherwise skip it
+         * to save performance. */
+        if (!(flags & H5Z_FLAG_SKIP_EDC)) {
+            uint32_t stored_crc; /* Stored checksum value */
+
+            /* Get the stored checksum */
+            p = src + (nbytes - H5Z_CRC32C_LEN);
+            UINT32DECODE(p, stored_crc);
+
+            /* Compute checksum (can't fail) */
+            crc = nbytes > H5Z_CRC32C_LEN ? H5_checksum_crc32c(src, nbytes - H5Z_CRC32C_LEN) : 0;
+
+            /* Verify computed checksum matches stored checksum */
+            if (stored_crc != crc)
+                HGOTO_ERROR(H5E_STORAGE, H5E_READERROR, 0, "data error detected by CRC-32C checksum")
+        } /* end if */
+
+        /* Set return values */
+        /* (Re-use the input buffer, just note that the size is smaller by the size of the checksum) */
+        ret_value = nbytes - H5Z_CRC32C_LEN;
+    } /* end if */
+    else { /* Write */
+        /* Compute checksum (can't fail) */
+        crc = nbytes > 0 ? H5_checksum_crc32c(src, nbytes) : 0;
+
+        /* Grow the buffer for the checksum, unless it already has room */
+        if (*buf_size < nbytes + H5Z_CRC32C_LEN) {
+            void *new_buf; /* Pointer to the grown buffer */
+
+            if (NULL == (new_buf = H5MM_realloc(*buf, nbytes + H5Z_CRC32C_LEN)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0,
+                            "unable to allocate CRC-32C checksum destination buffer")
+            *buf      = new_buf;
+            *buf_size = nbytes + H5Z_CRC32C_LEN;
+        } /* end if */
+
+        /* Append checksum to raw data for storage */
+        p = (uint8_t *)(*buf) + nbytes;
+        UINT32ENCODE(p, crc);
+
+        /* Set return value */
+        ret_value = nbytes + H5Z_CRC32C_LEN;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_crc32c() */
@@ -32,9 +32,36 @@
 #include H5_ZLIB_HEADER /* "zlib.h" */
 #endif
 
+#ifdef H5Z_HAVE_THREADS
+/* Local typedefs */
+
+/* A block of a buffer being compressed by H5Z__deflate_blocks() */
+typedef struct H5Z_deflate_block_t {
+    Bytef *      src;         /* Start of the block's data */
+    size_t       src_nbytes;  /* Size of the block's data */
+    size_t       dict_nbytes; /* # of bytes of data before the block to use as its dictionary */
+    Bytef *      dst;         /* Where to put the compressed block */
+    size_t       dst_size;    /* Size of the space at DST */
+    size_t       dst_nbytes;  /* Size of the compressed block */
+    uLong        adler;       /* Adler-32 checksum of the block's data */
+} H5Z_deflate_block_t;
+
+/* User data for H5Z__deflate_block_task() */
+typedef struct H5Z_deflate_blocks_ud_t {
+    int                  aggression; /* Compression level */
+    size_t               nblocks;    /* Number of blocks */
+    H5Z_deflate_block_t *blocks;     /* The blocks */
+} H5Z_deflate_blocks_ud_t;
+#endif /* H5Z_HAVE_THREADS */
+
 /* Local function prototypes */
 static size_t H5Z__filter_deflate(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
                                   size_t *buf_size, void **buf);
+#ifdef H5Z_HAVE_THREADS
+static herr_t H5Z__deflate_block_task(size_t task, void *_udata);
+static size_t H5Z__deflate_blocks(int aggression, unsigned nthreads, size_t block_size, size_t nbytes,
+                                  size_t *buf_size, void **buf);
+#endif /* H5Z_HAVE_THREADS */
 
 /* This message derives from H5Z */
 const H5Z_class2_t H5Z_DEFLATE[1] = {{
@@ -50,6 +77,16 @@ const H5Z_class2_t H5Z_DEFLATE[1] = {{
 
 #define H5Z_DEFLATE_SIZE_ADJUST(s) (HDceil(((double)(s)) * (double)1.001f) + 12)
 
+#ifdef H5Z_HAVE_THREADS
+/* Space for one block compressed by H5Z__deflate_blocks(): compressBound()
+ * includes the zlib header & trailer that raw blocks don't have, so this
+ * leaves room for the empty stored block ending each block but the last. */
+#define H5Z_DEFLATE_BLOCK_BOUND(s) ((size_t)compressBound((uLong)(s)) + 16)
+
+/* Size of the history kept by deflate, which each block is primed with */
+#define H5Z_DEFLATE_WINDOW_SIZE ((size_t)1 << MAX_WBITS)
+#endif /* H5Z_HAVE_THREADS */
+
 /*-------------------------------------------------------------------------
  * Function:	H5Z__filter_deflate
  *
@@ -165,6 +202,17 @@ H5Z__filter_deflate(unsigned flags, size_t cd_nelmts, const unsigned cd_values[]
         /* Set the compression aggression level */
         H5_CHECKED_ASSIGN(aggression, int, cd_values[0], unsigned);
 
+#ifdef H5Z_HAVE_THREADS
+        /* Compress large buffers in blocks when there are threads to spare */
+        if (H5Z_block_nthreads_g > 1 && H5Z_block_size_g > 0 && nbytes > H5Z_block_size_g &&
+            H5Z_block_size_g <= (size_t)UINT_MAX / 2) {
+            if (0 == (ret_value = H5Z__deflate_blocks(aggression, H5Z_block_nthreads_g, H5Z_block_size_g,
+                                                      nbytes, buf_size, buf)))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "unable to deflate blocks")
+            HGOTO_DONE(ret_value)
+        } /* end if */
+#endif /* H5Z_HAVE_THREADS */
+
         /* Allocate output (compressed) buffer */
         if (NULL == (outbuf = H5MM_malloc(z_dst_nbytes)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate deflate destination buffer")
@@ -198,4 +246,169 @@ done:
         H5MM_xfree(outbuf);
     FUNC_LEAVE_NOAPI(ret_value)
 }
+
+#ifdef H5Z_HAVE_THREADS
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__deflate_block_task
+ *
+ * Purpose:     H5Z__run_tasks() callback to compress one block of a buffer
+ *              for H5Z__deflate_blocks() into raw deflate data, and to
+ *              compute the block's Adler-32 checksum.  The last block ends
+ *              the deflate stream, the others are flushed so that they end
+ *              on a byte boundary.
+ *
+ * Return:      Non-negative on success
+ *              Negative on failure
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__deflate_block_task(size_t task, void *_udata)
+{
+    H5Z_deflate_blocks_ud_t *udata = (H5Z_deflate_blocks_ud_t *)_udata;
+    H5Z_deflate_block_t *    block = &udata->blocks[task];
+    hbool_t                  last  = (task == udata->nblocks - 1); /* Whether this is the last block */
+    z_stream                 z_strm;                               /* zlib parameters */
+    hbool_t                  z_init = FALSE;                       /* Whether z_strm is initialized */
+    int                      status;                               /* Status from zlib operation */
+    herr_t                   ret_value = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Write raw deflate data, without the zlib header and trailer */
+    HDmemset(&z_strm, 0, sizeof(z_strm));
+    if (Z_OK != deflateInit2(&z_strm, udata->aggression, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY))
+        HGOTO_DONE(FAIL)
+    z_init = TRUE;
+
+    /* Prime the history with the data before the block, so that the block
+     * compresses about as well as it would in a single stream */
+    if (block->dict_nbytes > 0)
+        if (Z_OK != deflateSetDictionary(&z_strm, block->src - block->dict_nbytes, (uInt)block->dict_nbytes))
+            HGOTO_DONE(FAIL)
+
+    z_strm.next_in   = block->src;
+    z_strm.avail_in  = (uInt)block->src_nbytes;
+    z_strm.next_out  = block->dst;
+    z_strm.avail_out = (uInt)block->dst_size;
+
+    /* Compress the block in one call, there's room for the worst case */
+    status = deflate(&z_strm, last ? Z_FINISH : Z_SYNC_FLUSH);
+    if (last ? (Z_STREAM_END != status) : (Z_OK != status || 0 == z_strm.avail_out))
+        HGOTO_DONE(FAIL)
+    if (z_strm.avail_in > 0)
+        HGOTO_DONE(FAIL)
+    block->dst_nbytes = block->dst_size - z_strm.avail_out;
+
+    block->adler = adler32(adler32(0L, Z_NULL, 0), block->src, (uInt)block->src_nbytes);
+
+done:
+    if (z_init)
+        (void)deflateEnd(&z_strm);
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__deflate_block_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__deflate_blocks
+ *
+ * Purpose:     Compress the NBYTES bytes in *BUF as pigz does: split them
+ *              into blocks of BLOCK_SIZE bytes, compress the blocks with up
+ *              to NTHREADS threads, then join them into one zlib stream
+ *              with the Adler-32 checksum of the whole buffer.  The result
+ *              can be uncompressed by any zlib inflate, including that in
+ *              H5Z__filter_deflate(), in a single pass.
+ *
+ * Return:      Success: Size of the compressed data in *BUF
+ *              Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__deflate_blocks(int aggression, unsigned nthreads, size_t block_size, size_t nbytes, size_t *buf_size,
+                    void **buf)
+{
+    H5Z_deflate_blocks_ud_t udata;         /* Info for the block tasks */
+    H5Z_deflate_block_t *   blocks = NULL; /* The blocks of the buffer */
+    Bytef *                 outbuf = NULL; /* Compressed buffer */
+    Bytef *                 p;             /* Next byte of the compressed stream */
+    size_t                  nblocks;       /* Number of blocks */
+    size_t                  slot_size;     /* Space for each compressed block */
+    size_t                  nalloc;        /* Size of the compressed buffer */
+    unsigned                header;        /* zlib stream header */
+    uLong                   adler;         /* Adler-32 checksum of the whole buffer */
+    size_t                  u;             /* Local index variable */
+    size_t                  ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(block_size > 0 && block_size < nbytes);
+    HDassert(buf && *buf);
+
+    /* Allocate a slot for each block in the compressed buffer, after the header */
+    nblocks   = (nbytes + block_size - 1) / block_size;
+    slot_size = H5Z_DEFLATE_BLOCK_BOUND(block_size);
+    nalloc    = 2 + (nblocks * slot_size) + 4;
+    if (NULL == (blocks = (H5Z_deflate_block_t *)H5MM_malloc(nblocks * sizeof(H5Z_deflate_block_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate deflate block info")
+    if (NULL == (outbuf = (Bytef *)H5MM_malloc(nalloc)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate deflate destination buffer")
+
+    for (u = 0; u < nblocks; u++) {
+        size_t offset = u * block_size; /* Offset of the block in the buffer */
+
+        blocks[u].src         = (Bytef *)*buf + offset;
+        blocks[u].src_nbytes  = MIN(block_size, nbytes - offset);
+        blocks[u].dict_nbytes = MIN(offset, H5Z_DEFLATE_WINDOW_SIZE);
+        blocks[u].dst         = outbuf + 2 + (u * slot_size);
+        blocks[u].dst_size    = slot_size;
+        blocks[u].dst_nbytes  = 0;
+        blocks[u].adler       = 0;
+    } /* end for */
+
+    /* Compress the blocks */
+    udata.aggression = aggression;
+    udata.nblocks    = nblocks;
+    udata.blocks     = blocks;
+    if (H5Z__run_tasks(nthreads, nblocks, H5Z__deflate_block_task, &udata) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "deflate failed for one or more blocks")
+
+    /* Write the zlib header that deflate would, for a 32K window */
+    header = (Z_DEFLATED + ((MAX_WBITS - 8) << 4)) << 8;
+    header |= (unsigned)(aggression < 2 ? 0 : aggression < 6 ? 1 : aggression == 6 ? 2 : 3) << 6;
+    header += 31 - (header % 31);
+    outbuf[0] = (Bytef)(header >> 8);
+    outbuf[1] = (Bytef)(header & 0xff);
+
+    /* Move the compressed blocks together, combining their checksums */
+    p     = outbuf + 2;
+    adler = blocks[0].adler;
+    for (u = 0; u < nblocks; u++) {
+        if (u > 0)
+            adler = adler32_combine(adler, blocks[u].adler, (z_off_t)blocks[u].src_nbytes);
+        HDmemmove(p, blocks[u].dst, blocks[u].dst_nbytes);
+        p += blocks[u].dst_nbytes;
+    } /* end for */
+
+    /* Write the zlib trailer */
+    *p++ = (Bytef)((adler >> 24) & 0xff);
+    *p++ = (Bytef)((adler >> 16) & 0xff);
+    *p++ = (Bytef)((adler >> 8) & 0xff);
+    *p++ = (Bytef)(adler & 0xff);
+
+    /* Free the input buffer */
+    H5MM_xfree(*buf);
+
+    /* Set return values */
+    ret_value = (size_t)(p - outbuf);
+    *buf      = outbuf;
+    outbuf    = NULL;
+    *buf_size = nalloc;
+
+done:
+    if (outbuf)
+        H5MM_xfree(outbuf);
+    H5MM_xfree(blocks);
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__deflate_blocks() */
+#endif /* H5Z_HAVE_THREADS */
 #endif /* H5_HAVE_FILTER_DEFLATE */
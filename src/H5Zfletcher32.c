@@ -59,8 +59,7 @@ static size_t
 H5Z__filter_fletcher32(unsigned flags, size_t H5_ATTR_UNUSED cd_nelmts,
                        const unsigned H5_ATTR_UNUSED cd_values[], size_t nbytes, size_t *buf_size, void **buf)
 {
-    void *         outbuf = NULL; /* Pointer to new buffer */
-    unsigned char *src    = (unsigned char *)(*buf);
+    unsigned char *src = (unsigned char *)(*buf);
     uint32_t       fletcher;          /* Checksum value */
     uint32_t       reversed_fletcher; /* Possible wrong checksum value */
     uint8_t        c[4];
@@ -122,31 +121,25 @@ H5Z__filter_fletcher32(unsigned flags, size_t H5_ATTR_UNUSED cd_nelmts,
         /* Compute checksum (can't fail) */
         fletcher = H5_checksum_fletcher32(src, nbytes);
 
-        if (NULL == (outbuf = H5MM_malloc(nbytes + FLETCHER_LEN)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0,
-                        "unable to allocate Fletcher32 checksum destination buffer")
+        /* Grow the buffer for the checksum, unless it already has room */
+        if (*buf_size < nbytes + FLETCHER_LEN) {
+            void *new_buf; /* Pointer to the grown buffer */
 
-        dst = (unsigned char *)outbuf;
-
-        /* Copy raw data */
-        H5MM_memcpy((void *)dst, (void *)(*buf), nbytes);
+            if (NULL == (new_buf = H5MM_realloc(*buf, nbytes + FLETCHER_LEN)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0,
+                            "unable to allocate Fletcher32 checksum destination buffer")
+            *buf      = new_buf;
+            *buf_size = nbytes + FLETCHER_LEN;
+        } /* end if */
 
         /* Append checksum to raw data for storage */
-        dst += nbytes;
+        dst = (unsigned char *)(*buf) + nbytes;
         UINT32ENCODE(dst, fletcher);
 
-        /* Free input buffer */
-        H5MM_xfree(*buf);
-
-        /* Set return values */
-        *buf_size = nbytes + FLETCHER_LEN;
-        *buf      = outbuf;
-        outbuf    = NULL;
-        ret_value = *buf_size;
+        /* Set return value */
+        ret_value = nbytes + FLETCHER_LEN;
     }
 
 done:
-    if (outbuf)
-        H5MM_xfree(outbuf);
     FUNC_LEAVE_NOAPI(ret_value)
 }
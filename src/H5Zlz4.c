@@ -0,0 +1,234 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     An I/O filter around the LZ4 compressor.
+ *
+ *              Chunks are stored in the format written by the LZ4 filter
+ *              plugin registered for H5Z_FILTER_LZ4, so files written with
+ *              either can be read with the other.  The chunk is split into
+ *              blocks that are compressed independently, and stored as:
+ *
+ *                  8 bytes     size of the chunk, uncompressed
+ *                  4 bytes     size of each block, uncompressed
+ *                  for each block:
+ *                      4 bytes     size of the block, compressed
+ *                      ...         the compressed block
+ *
+ *              with all sizes big-endian.  A block that doesn't get smaller
+ *              is stored as is, with its compressed size equal to its
+ *              uncompressed size.
+ *
+ *              The first client data value is the block size (0 for the
+ *              default) and the second is LZ4's acceleration factor (0 or
+ *              missing for the default).  The plugin only uses the first.
+ */
+
+#include "H5Zmodule.h" /* This source code file is part of the H5Z module */
+
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5MMprivate.h" /* Memory management			*/
+#include "H5Zpkg.h"      /* Data filters				*/
+
+#ifdef H5_HAVE_FILTER_LZ4
+
+#include <lz4.h>
+
+/* Local macros */
+#define H5Z_LZ4_PARM_BLOCK_SIZE   0         /* Client data value for the block size */
+#define H5Z_LZ4_PARM_ACCELERATION 1         /* Client data value for the acceleration */
+#define H5Z_LZ4_DEF_BLOCK_SIZE    (1 << 30) /* Default block size, as in the plugin */
+#define H5Z_LZ4_HDR_SIZE          12        /* Size of the chunk's header */
+
+/* Encode / decode big-endian sizes */
+#define H5Z_LZ4_ENCODE(p, n, v)                                                                              \
+    {                                                                                                        \
+        unsigned _u;                                                                                         \
+                                                                                                             \
+        for (_u = 0; _u < (n); _u++)                                                                         \
+            (p)[_u] = (uint8_t)((uint64_t)(v) >> (8 * ((n)-_u - 1)));                                        \
+        (p) += (n);                                                                                          \
+    }
+#define H5Z_LZ4_DECODE(p, n, v)                                                                              \
+    {                                                                                                        \
+        unsigned _u;                                                                                         \
+                                                                                                             \
+        for ((v) = 0, _u = 0; _u < (n); _u++)                                                                \
+            (v) = ((v) << 8) | (p)[_u];                                                                      \
+        (p) += (n);                                                                                          \
+    }
+
+/* Local function prototypes */
+static size_t H5Z__filter_lz4(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                              size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_LZ4[1] = {{
+    H5Z_CLASS_T_VERS, /* H5Z_class_t version */
+    H5Z_FILTER_LZ4,   /* Filter id number		*/
+    1,                /* encoder_present flag (set to true) */
+    1,                /* decoder_present flag (set to true) */
+    "lz4",            /* Filter name for debugging	*/
+    NULL,             /* The "can apply" callback     */
+    NULL,             /* The "set local" callback     */
+    H5Z__filter_lz4,  /* The actual filter function	*/
+}};
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__filter_lz4
+ *
+ * Purpose:     Implement an I/O filter around the LZ4 compressor in liblz4
+ *
+ * Return:      Success: Size of buffer filtered
+ *              Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_lz4(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                size_t *buf_size, void **buf)
+{
+    uint8_t *outbuf = NULL;              /* Pointer to new buffer */
+    uint8_t *src    = (uint8_t *)(*buf); /* Next byte to read */
+    uint8_t *src_end;                    /* End of the input */
+    uint8_t *dst;                        /* Next byte to write */
+    uint64_t orig_size;                  /* Size of the chunk, uncompressed */
+    uint32_t block_size;                 /* Size of each block, uncompressed */
+    uint32_t comp_size;                  /* Size of a block, compressed */
+    size_t   done;                       /* # of uncompressed bytes processed */
+    size_t   ret_value = 0;              /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(*buf_size > 0);
+    HDassert(buf);
+    HDassert(*buf);
+
+    src_end = src + nbytes;
+
+    if (flags & H5Z_FLAG_REVERSE) {
+        /* Input; uncompress */
+        if (nbytes < H5Z_LZ4_HDR_SIZE)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "lz4 chunk is too small")
+        H5Z_LZ4_DECODE(src, 8, orig_size);
+        H5Z_LZ4_DECODE(src, 4, block_size);
+        if (orig_size > (uint64_t)((size_t)-1) || (0 == block_size && orig_size > 0))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "invalid lz4 chunk header")
+
+        /* Allocate space for the uncompressed buffer */
+        if (NULL == (outbuf = (uint8_t *)H5MM_malloc(MAX((size_t)orig_size, 1))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for lz4 uncompression")
+
+        /* Uncompress each block */
+        for (done = 0, dst = outbuf; done < (size_t)orig_size; done += block_size, dst += block_size) {
+            /* The last block may be smaller than the rest */
+            if ((size_t)orig_size - done < block_size)
+                block_size = (uint32_t)((size_t)orig_size - done);
+
+            if (src_end - src < 4)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "lz4 chunk is truncated")
+            H5Z_LZ4_DECODE(src, 4, comp_size);
+            if ((size_t)(src_end - src) < comp_size)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "lz4 chunk is truncated")
+
+            /* Blocks that didn't get smaller are stored as is */
+            if (comp_size == block_size)
+                H5MM_memcpy(dst, src, block_size);
+            else if (LZ4_decompress_safe((const char *)src, (char *)dst, (int)comp_size, (int)block_size) !=
+                     (int)block_size)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "lz4 uncompression failed")
+            src += comp_size;
+        } /* end for */
+
+        /* Free the input buffer */
+        H5MM_xfree(*buf);
+
+        /* Set return values */
+        *buf      = outbuf;
+        outbuf    = NULL;
+        *buf_size = MAX((size_t)orig_size, 1);
+        ret_value = (size_t)orig_size;
+    } /* end if */
+    else {
+        /* Output; compress */
+        size_t nblocks;          /* # of blocks in the chunk */
+        size_t nalloc;           /* Size of the compressed buffer */
+        int    acceleration = 1; /* LZ4's acceleration factor */
+
+        /* Get the block size and the acceleration */
+        block_size = H5Z_LZ4_DEF_BLOCK_SIZE;
+        if (cd_nelmts > H5Z_LZ4_PARM_BLOCK_SIZE && cd_values[H5Z_LZ4_PARM_BLOCK_SIZE] > 0)
+            block_size = cd_values[H5Z_LZ4_PARM_BLOCK_SIZE];
+        if (block_size > LZ4_MAX_INPUT_SIZE)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid lz4 block size")
+        if (cd_nelmts > H5Z_LZ4_PARM_ACCELERATION && cd_values[H5Z_LZ4_PARM_ACCELERATION] > 0) {
+            if (cd_values[H5Z_LZ4_PARM_ACCELERATION] > H5Z_LZ4_MAX_ACCELERATION)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid lz4 acceleration")
+            acceleration = (int)cd_values[H5Z_LZ4_PARM_ACCELERATION];
+        } /* end if */
+        if (block_size > nbytes)
+            block_size = (uint32_t)nbytes;
+
+        /* Allocate a buffer big enough for the worst case */
+        nblocks = block_size > 0 ? ((nbytes + block_size - 1) / block_size) : 0;
+        nalloc  = H5Z_LZ4_HDR_SIZE + (nblocks * (4 + (size_t)LZ4_compressBound((int)block_size)));
+        if (NULL == (outbuf = (uint8_t *)H5MM_malloc(nalloc)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate lz4 destination buffer")
+
+        dst = outbuf;
+        H5Z_LZ4_ENCODE(dst, 8, nbytes);
+        H5Z_LZ4_ENCODE(dst, 4, block_size);
+
+        /* Compress each block, after the space for its compressed size */
+        for (done = 0; done < nbytes; done += block_size, src += block_size) {
+            int nout; /* Size of the block, compressed */
+
+            /* The last block may be smaller than the rest */
+            if (nbytes - done < block_size)
+                block_size = (uint32_t)(nbytes - done);
+
+            nout = LZ4_compress_fast((const char *)src, (char *)dst + 4, (int)block_size,
+                                     LZ4_compressBound((int)block_size), acceleration);
+            if (nout <= 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "lz4 compression failed")
+
+            /* Store blocks that don't get smaller as they are */
+            if ((uint32_t)nout >= block_size) {
+                H5MM_memcpy(dst + 4, src, block_size);
+                comp_size = block_size;
+            } /* end if */
+            else
+                comp_size = (uint32_t)nout;
+
+            H5Z_LZ4_ENCODE(dst, 4, comp_size);
+            dst += comp_size;
+        } /* end for */
+
+        /* Free the input buffer */
+        H5MM_xfree(*buf);
+
+        /* Set return values */
+        *buf      = outbuf;
+        *buf_size = nalloc;
+        ret_value = (size_t)(dst - outbuf);
+        outbuf    = NULL;
+    } /* end else */
+
+done:
+    if (outbuf)
+        H5MM_xfree(outbuf);
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_lz4() */
+
+#endif /* H5_HAVE_FILTER_LZ4 */
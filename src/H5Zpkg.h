@@ -21,6 +21,25 @@
 /* Include private header file */
 #include "H5Zprivate.h" /* Filter functions                */
 
+/**************************/
+/* Package Private Macros */
+/**************************/
+
+/* Whether the filter layer can use threads to run filters on several
+ * buffers at once.  (The memory allocation sanity checks keep global,
+ * unlocked state, so they rule out calling filters concurrently.)
+ */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_MEMORY_ALLOC_SANITY_CHECK)
+#define H5Z_HAVE_THREADS
+#endif
+
+/****************************/
+/* Package Private Typedefs */
+/****************************/
+
+/* Callback for each task run by H5Z__run_tasks() */
+typedef herr_t (*H5Z_task_func_t)(size_t task, void *udata);
+
 /********************/
 /* Internal filters */
 /********************/
@@ -28,9 +47,15 @@
 /* Shuffle filter */
 H5_DLLVAR const H5Z_class2_t H5Z_SHUFFLE[1];
 
+/* Bitshuffle filter */
+H5_DLLVAR const H5Z_class2_t H5Z_BITSHUFFLE[1];
+
 /* Fletcher32 filter */
 H5_DLLVAR const H5Z_class2_t H5Z_FLETCHER32[1];
 
+/* CRC-32C filter */
+H5_DLLVAR const H5Z_class2_t H5Z_CRC32C[1];
+
 /* n-bit filter */
 H5_DLLVAR H5Z_class2_t H5Z_NBIT[1];
 
@@ -51,7 +76,31 @@ H5_DLLVAR const H5Z_class2_t H5Z_DEFLATE[1];
 H5_DLLVAR H5Z_class2_t H5Z_SZIP[1];
 #endif /* H5_HAVE_FILTER_SZIP */
 
+/* zstd filter */
+#ifdef H5_HAVE_FILTER_ZSTD
+H5_DLLVAR const H5Z_class2_t H5Z_ZSTD[1];
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+/* lz4 filter */
+#ifdef H5_HAVE_FILTER_LZ4
+H5_DLLVAR const H5Z_class2_t H5Z_LZ4[1];
+#endif /* H5_HAVE_FILTER_LZ4 */
+
+/*****************************/
+/* Package Private Variables */
+/*****************************/
+
+/* While H5Z_pipeline_multi() is compressing fewer buffers than it has threads,
+ * the number of threads a filter may use for each buffer, and the size of the
+ * blocks it may split the buffer into to use them.  Otherwise 1 and 0.
+ */
+H5_DLLVAR unsigned H5Z_block_nthreads_g;
+H5_DLLVAR size_t   H5Z_block_size_g;
+
 /* Package internal routines */
 H5_DLL herr_t H5Z__unregister(H5Z_filter_t filter_id);
+H5_DLL herr_t H5Z__run_tasks(unsigned nthreads, size_t ntasks, H5Z_task_func_t op, void *udata);
+H5_DLL void   H5Z__shuffle_bytes(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest);
+H5_DLL void   H5Z__unshuffle_bytes(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest);
 
 #endif /* _H5Zpkg_H */
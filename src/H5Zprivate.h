@@ -63,6 +63,15 @@ struct H5Z_filter_info_t {
     unsigned *   cd_values;                        /*client data values		     */
 };
 
+/* A buffer to run through the filter pipeline with H5Z_pipeline_multi() */
+typedef struct H5Z_pipeline_buf_t {
+    unsigned filter_mask; /* Filters to skip (in), filters which failed (out) */
+    size_t   nbytes;      /* Number of bytes of data in buffer (in,out) */
+    size_t   buf_size;    /* Allocated size of buffer (in,out) */
+    void *   buf;         /* Buffer to filter (in,out) */
+    herr_t   status;      /* Outcome of filtering this buffer (out) */
+} H5Z_pipeline_buf_t;
+
 /*****************************/
 /* Library-private Variables */
 /*****************************/
@@ -82,6 +91,9 @@ H5_DLL herr_t H5Z_modify(const struct H5O_pline_t *pline, H5Z_filter_t filter, u
 H5_DLL herr_t H5Z_pipeline(const struct H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*in,out*/,
                            H5Z_EDC_t edc_read, H5Z_cb_t cb_struct, size_t *nbytes /*in,out*/,
                            size_t *buf_size /*in,out*/, void **buf /*in,out*/);
+H5_DLL herr_t H5Z_pipeline_multi(const struct H5O_pline_t *pline, unsigned flags, H5Z_EDC_t edc_read,
+                                 H5Z_cb_t cb_struct, unsigned nthreads, size_t block_size, size_t nbufs,
+                                 H5Z_pipeline_buf_t bufs[] /*in,out*/);
 H5_DLL H5Z_class2_t *H5Z_find(H5Z_filter_t id);
 H5_DLL herr_t        H5Z_can_apply(hid_t dcpl_id, hid_t type_id);
 H5_DLL herr_t        H5Z_set_local(hid_t dcpl_id, hid_t type_id);
@@ -91,6 +103,7 @@ H5_DLL htri_t        H5Z_ignore_filters(hid_t dcpl_id, const H5T_t *type, const
 H5_DLL H5Z_filter_info_t *H5Z_filter_info(const struct H5O_pline_t *pline, H5Z_filter_t filter);
 H5_DLL htri_t             H5Z_filter_in_pline(const struct H5O_pline_t *pline, H5Z_filter_t filter);
 H5_DLL htri_t             H5Z_all_filters_avail(const struct H5O_pline_t *pline);
+H5_DLL htri_t             H5Z_builtin_filters(const struct H5O_pline_t *pline);
 H5_DLL htri_t             H5Z_filter_avail(H5Z_filter_t id);
 H5_DLL herr_t             H5Z_delete(struct H5O_pline_t *pline, H5Z_filter_t filter);
 H5_DLL herr_t             H5Z_get_filter_info(H5Z_filter_t filter, unsigned int *filter_config_flags);
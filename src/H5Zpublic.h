@@ -43,6 +43,18 @@ typedef int H5Z_filter_t;
 
 #define H5Z_FILTER_MAX 65535 /*maximum filter id		*/
 
+/* Filters built into the library when the compression library they need is
+ * available, which keep the IDs already registered for them as plugins so
+ * that files written with either can be read with the other */
+#define H5Z_FILTER_LZ4        32004 /*LZ4 compression		*/
+#define H5Z_FILTER_BITSHUFFLE 32008 /*bitshuffle the data		*/
+#define H5Z_FILTER_ZSTD       32015 /*Zstandard compression		*/
+
+/* Filters built into the library that have no registered ID.  IDs below
+ * 32768 are assigned by The HDF Group, so these take IDs from the range left
+ * for unregistered filters */
+#define H5Z_FILTER_CRC32C 32768 /*CRC-32C checksum of EDC	*/
+
 /* General macros */
 #define H5Z_FILTER_ALL   0  /* Symbol to remove all filters in H5Premove_filter */
 #define H5Z_MAX_NFILTERS 32 /* Maximum number of filters allowed in a pipeline */
@@ -77,6 +89,19 @@ typedef int H5Z_filter_t;
 #define H5Z_SHUFFLE_USER_NPARMS  0 /* Number of parameters that users can set */
 #define H5Z_SHUFFLE_TOTAL_NPARMS 1 /* Total number of parameters for filter */
 
+/* Macros for the bitshuffle filter */
+#define H5Z_BITSHUFFLE_USER_NPARMS     3 /* Number of parameters that users can set */
+#define H5Z_BITSHUFFLE_TOTAL_NPARMS    6 /* Total number of parameters for filter */
+#define H5Z_BITSHUFFLE_PARM_MAJOR      0 /* "Local" parameter for the format's major version */
+#define H5Z_BITSHUFFLE_PARM_MINOR      1 /* "Local" parameter for the format's minor version */
+#define H5Z_BITSHUFFLE_PARM_SIZE       2 /* "Local" parameter for the element size */
+#define H5Z_BITSHUFFLE_PARM_BLOCK_SIZE 3 /* "User" parameter for the elements in a block (0 for default) */
+#define H5Z_BITSHUFFLE_PARM_COMPRESS   4 /* "User" parameter for the compressor (H5Z_BITSHUFFLE_*) */
+#define H5Z_BITSHUFFLE_PARM_LEVEL      5 /* "User" parameter for the zstd compression level */
+#define H5Z_BITSHUFFLE_NO_COMPRESS     0 /* Bitshuffle only */
+#define H5Z_BITSHUFFLE_LZ4             2 /* Compress the bitshuffled blocks with lz4 */
+#define H5Z_BITSHUFFLE_ZSTD            3 /* Compress the bitshuffled blocks with zstd */
+
 /* Macros for the szip filter */
 #define H5Z_SZIP_USER_NPARMS  2 /* Number of parameters that users can set */
 #define H5Z_SZIP_TOTAL_NPARMS 4 /* Total number of parameters for filter */
@@ -85,6 +110,12 @@ typedef int H5Z_filter_t;
 #define H5Z_SZIP_PARM_BPP     2 /* "Local" parameter for bits-per-pixel */
 #define H5Z_SZIP_PARM_PPS     3 /* "Local" parameter for pixels-per-scanline */
 
+/* Macros for the zstd filter */
+#define H5Z_ZSTD_MAX_LEVEL 22 /* Highest compression level */
+
+/* Macros for the lz4 filter */
+#define H5Z_LZ4_MAX_ACCELERATION 65537 /* Highest acceleration factor */
+
 /* Macros for the nbit filter */
 #define H5Z_NBIT_USER_NPARMS 0 /* Number of parameters that users can set */
 
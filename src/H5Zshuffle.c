@@ -21,10 +21,62 @@
 #include "H5Tprivate.h"  /* Datatypes         			*/
 #include "H5Zpkg.h"      /* Data filters				*/
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef H5_HAVE_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+/* Local macros */
+#define H5Z_SHUFFLE_PARM_SIZE 0 /* "Local" parameter for shuffling size */
+
+/* Largest element size that's [un]shuffled with vector instructions */
+#define H5Z_SHUFFLE_VEC_MAX_SIZE 16
+
+/* Whether elements of SIZE bytes can be [un]shuffled with vector
+ * instructions (sizes that are powers of two) */
+#define H5Z_SHUFFLE_VEC_SIZE(size) ((size) <= H5Z_SHUFFLE_VEC_MAX_SIZE && 0 == ((size) & ((size)-1)))
+
+#ifdef H5_HAVE_AVX2_DISPATCH
+#define H5Z_SHUFFLE_AVX2 __attribute__((target("avx2")))
+#endif
+
+/* Fully unroll the loops over the vectors of a block, so that the block
+ * stays in registers (GCC only does this at -O3 otherwise) */
+#if defined(__GNUC__) && __GNUC__ >= 8
+#define H5Z_SHUFFLE_UNROLL _Pragma("GCC unroll 16")
+#else
+#define H5Z_SHUFFLE_UNROLL
+#endif
+
+/* Local typedefs */
+
+/* Vector kernel that [un]shuffles as many as it can of the NELMTS elements
+ * of SIZE bytes in SRC into DEST, in blocks of a fixed number of elements,
+ * and returns the number of elements done */
+typedef size_t (*H5Z_shuffle_kernel_t)(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest);
+
 /* Local function prototypes */
 static herr_t H5Z__set_local_shuffle(hid_t dcpl_id, hid_t type_id, hid_t space_id);
 static size_t H5Z__filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
                                   size_t *buf_size, void **buf);
+static void   H5Z__shuffle_init_kernels(void);
+#ifdef __SSE2__
+static size_t H5Z__shuffle_sse2(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest);
+static size_t H5Z__unshuffle_sse2(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest);
+#endif /* __SSE2__ */
+#ifdef H5_HAVE_AVX2_DISPATCH
+static size_t H5Z__shuffle_avx2(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest);
+static size_t H5Z__unshuffle_avx2(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest);
+#endif /* H5_HAVE_AVX2_DISPATCH */
+#ifdef __ARM_NEON
+static size_t H5Z__shuffle_neon(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest);
+static size_t H5Z__unshuffle_neon(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest);
+#endif /* __ARM_NEON */
 
 /* This message derives from H5Z */
 const H5Z_class2_t H5Z_SHUFFLE[1] = {{
@@ -38,8 +90,10 @@ const H5Z_class2_t H5Z_SHUFFLE[1] = {{
     H5Z__filter_shuffle,    /* The actual filter function	*/
 }};
 
-/* Local macros */
-#define H5Z_SHUFFLE_PARM_SIZE 0 /* "Local" parameter for shuffling size */
+/* Vector kernels for the CPU that's running, chosen on first use */
+static hbool_t              H5Z_shuffle_kernels_init_g = FALSE;
+static H5Z_shuffle_kernel_t H5Z_shuffle_kernel_g       = NULL; /* Shuffles blocks of elements */
+static H5Z_shuffle_kernel_t H5Z_unshuffle_kernel_g     = NULL; /* Unshuffles blocks of elements */
 
 /*-------------------------------------------------------------------------
  * Function:	H5Z__set_local_shuffle
@@ -93,6 +147,672 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z__set_local_shuffle() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__shuffle_init_kernels
+ *
+ * Purpose:     Choose the vector kernels for [un]shuffling on the CPU
+ *              that's running: AVX2 where the CPU has it, otherwise the
+ *              SSE2 or NEON instructions the library was built for.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__shuffle_init_kernels(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+#if defined(__SSE2__)
+    H5Z_shuffle_kernel_g   = H5Z__shuffle_sse2;
+    H5Z_unshuffle_kernel_g = H5Z__unshuffle_sse2;
+#elif defined(__ARM_NEON)
+    H5Z_shuffle_kernel_g   = H5Z__shuffle_neon;
+    H5Z_unshuffle_kernel_g = H5Z__unshuffle_neon;
+#endif
+
+#ifdef H5_HAVE_AVX2_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        H5Z_shuffle_kernel_g   = H5Z__shuffle_avx2;
+        H5Z_unshuffle_kernel_g = H5Z__unshuffle_avx2;
+    } /* end if */
+#endif /* H5_HAVE_AVX2_DISPATCH */
+
+    H5Z_shuffle_kernels_init_g = TRUE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__shuffle_init_kernels() */
+
+/*
+ * The vector kernels transpose a block of elements in registers.  The SIZE
+ * vectors holding a block are interleaved byte by byte in "rounds", pairing
+ * vector U with vector U + SIZE / 2 to produce vectors 2U and 2U + 1.  Four
+ * rounds take a block of 16 elements apart into its SIZE byte positions, and
+ * log2(SIZE) rounds put the byte positions back together into elements.
+ * AVX2 interleaves within each 128-bit lane, so it transposes two blocks of
+ * 16 elements at once, one per lane.
+ *
+ * The kernels are written for a constant SIZE and instantiated for each
+ * size, so that the compiler can keep a whole block in registers.
+ */
+
+#ifdef __SSE2__
+/* One round of interleaving IN into OUT */
+static H5_INLINE void
+H5Z__shuffle_round_sse2(unsigned size, const __m128i *in, __m128i *out)
+{
+    unsigned u;
+
+    H5Z_SHUFFLE_UNROLL
+
+    for (u = 0; u < size / 2; u++) {
+        out[2 * u]     = _mm_unpacklo_epi8(in[u], in[u + (size / 2)]);
+        out[2 * u + 1] = _mm_unpackhi_epi8(in[u], in[u + (size / 2)]);
+    } /* end for */
+} /* end H5Z__shuffle_round_sse2() */
+
+static H5_INLINE size_t
+H5Z__shuffle_block_sse2(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    __m128i  a[H5Z_SHUFFLE_VEC_MAX_SIZE], b[H5Z_SHUFFLE_VEC_MAX_SIZE];
+    size_t   nblocks = nelmts / 16;
+    size_t   n;
+    unsigned u;
+
+    for (n = 0; n < nblocks; n++) {
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < size; u++)
+            a[u] = _mm_loadu_si128((const __m128i *)(src + (n * 16 * size) + (u * 16)));
+        H5Z__shuffle_round_sse2(size, a, b);
+        H5Z__shuffle_round_sse2(size, b, a);
+        H5Z__shuffle_round_sse2(size, a, b);
+        H5Z__shuffle_round_sse2(size, b, a);
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < size; u++)
+            _mm_storeu_si128((__m128i *)(dest + (u * nelmts) + (n * 16)), a[u]);
+    } /* end for */
+
+    return nblocks * 16;
+} /* end H5Z__shuffle_block_sse2() */
+
+static H5_INLINE size_t
+H5Z__unshuffle_block_sse2(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    __m128i  a[H5Z_SHUFFLE_VEC_MAX_SIZE], b[H5Z_SHUFFLE_VEC_MAX_SIZE];
+    __m128i *in, *out, *tmp;
+    size_t   nblocks = nelmts / 16;
+    size_t   n;
+    unsigned u;
+
+    for (n = 0; n < nblocks; n++) {
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < size; u++)
+            a[u] = _mm_loadu_si128((const __m128i *)(src + (u * nelmts) + (n * 16)));
+        H5Z_SHUFFLE_UNROLL
+        for (in = a, out = b, u = 1; u < size; u *= 2) {
+            H5Z__shuffle_round_sse2(size, in, out);
+            tmp = in;
+            in  = out;
+            out = tmp;
+        } /* end for */
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < size; u++)
+            _mm_storeu_si128((__m128i *)(dest + (n * 16 * size) + (u * 16)), in[u]);
+    } /* end for */
+
+    return nblocks * 16;
+} /* end H5Z__unshuffle_block_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__shuffle_sse2
+ *
+ * Purpose:     Shuffle blocks of 16 elements with SSE2 instructions.
+ *
+ * Return:      Number of elements shuffled
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__shuffle_sse2(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (size) {
+        case 2:
+            ret_value = H5Z__shuffle_block_sse2(2, nelmts, src, dest);
+            break;
+        case 4:
+            ret_value = H5Z__shuffle_block_sse2(4, nelmts, src, dest);
+            break;
+        case 8:
+            ret_value = H5Z__shuffle_block_sse2(8, nelmts, src, dest);
+            break;
+        case 16:
+            ret_value = H5Z__shuffle_block_sse2(16, nelmts, src, dest);
+            break;
+        default:
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__shuffle_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__unshuffle_sse2
+ *
+ * Purpose:     Unshuffle blocks of 16 elements with SSE2 instructions.
+ *
+ * Return:      Number of elements unshuffled
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__unshuffle_sse2(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (size) {
+        case 2:
+            ret_value = H5Z__unshuffle_block_sse2(2, nelmts, src, dest);
+            break;
+        case 4:
+            ret_value = H5Z__unshuffle_block_sse2(4, nelmts, src, dest);
+            break;
+        case 8:
+            ret_value = H5Z__unshuffle_block_sse2(8, nelmts, src, dest);
+            break;
+        case 16:
+            ret_value = H5Z__unshuffle_block_sse2(16, nelmts, src, dest);
+            break;
+        default:
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__unshuffle_sse2() */
+#endif /* __SSE2__ */
+
+#ifdef H5_HAVE_AVX2_DISPATCH
+/* One round of interleaving IN into OUT, within each 128-bit lane */
+static H5_INLINE H5Z_SHUFFLE_AVX2 void
+H5Z__shuffle_round_avx2(unsigned size, const __m256i *in, __m256i *out)
+{
+    unsigned u;
+
+    H5Z_SHUFFLE_UNROLL
+
+    for (u = 0; u < size / 2; u++) {
+        out[2 * u]     = _mm256_unpacklo_epi8(in[u], in[u + (size / 2)]);
+        out[2 * u + 1] = _mm256_unpackhi_epi8(in[u], in[u + (size / 2)]);
+    } /* end for */
+} /* end H5Z__shuffle_round_avx2() */
+
+static H5_INLINE H5Z_SHUFFLE_AVX2 size_t
+H5Z__shuffle_block_avx2(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    __m256i  a[H5Z_SHUFFLE_VEC_MAX_SIZE], b[H5Z_SHUFFLE_VEC_MAX_SIZE];
+    size_t   nblocks = nelmts / 32;
+    size_t   n;
+    unsigned u;
+
+    for (n = 0; n < nblocks; n++) {
+        const uint8_t *s = src + (n * 32 * size);
+
+        /* The low lanes hold the first 16 elements and the high lanes the rest */
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < size; u++) {
+            __m128i lo = _mm_loadu_si128((const __m128i *)(s + (u * 16)));
+            __m128i hi = _mm_loadu_si128((const __m128i *)(s + ((size + u) * 16)));
+
+            a[u] = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        } /* end for */
+        H5Z__shuffle_round_avx2(size, a, b);
+        H5Z__shuffle_round_avx2(size, b, a);
+        H5Z__shuffle_round_avx2(size, a, b);
+        H5Z__shuffle_round_avx2(size, b, a);
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < size; u++)
+            _mm256_storeu_si256((__m256i *)(dest + (u * nelmts) + (n * 32)), a[u]);
+    } /* end for */
+
+    return nblocks * 32;
+} /* end H5Z__shuffle_block_avx2() */
+
+static H5_INLINE H5Z_SHUFFLE_AVX2 size_t
+H5Z__unshuffle_block_avx2(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    __m256i  a[H5Z_SHUFFLE_VEC_MAX_SIZE], b[H5Z_SHUFFLE_VEC_MAX_SIZE];
+    __m256i *in, *out, *tmp;
+    size_t   nblocks = nelmts / 32;
+    size_t   n;
+    unsigned u;
+
+    for (n = 0; n < nblocks; n++) {
+        uint8_t *d = dest + (n * 32 * size);
+
+        H5Z_SHUFFLE_UNROLL
+
+        for (u = 0; u < size; u++)
+            a[u] = _mm256_loadu_si256((const __m256i *)(src + (u * nelmts) + (n * 32)));
+        H5Z_SHUFFLE_UNROLL
+        for (in = a, out = b, u = 1; u < size; u *= 2) {
+            H5Z__shuffle_round_avx2(size, in, out);
+            tmp = in;
+            in  = out;
+            out = tmp;
+        } /* end for */
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < size; u++) {
+            _mm_storeu_si128((__m128i *)(d + (u * 16)), _mm256_castsi256_si128(in[u]));
+            _mm_storeu_si128((__m128i *)(d + ((size + u) * 16)), _mm256_extracti128_si256(in[u], 1));
+        } /* end for */
+    } /* end for */
+
+    return nblocks * 32;
+} /* end H5Z__unshuffle_block_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__shuffle_avx2
+ *
+ * Purpose:     Shuffle blocks of 32 elements with AVX2 instructions.
+ *
+ * Return:      Number of elements shuffled
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5Z_SHUFFLE_AVX2 size_t
+H5Z__shuffle_avx2(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (size) {
+        case 2:
+            ret_value = H5Z__shuffle_block_avx2(2, nelmts, src, dest);
+            break;
+        case 4:
+            ret_value = H5Z__shuffle_block_avx2(4, nelmts, src, dest);
+            break;
+        case 8:
+            ret_value = H5Z__shuffle_block_avx2(8, nelmts, src, dest);
+            break;
+        case 16:
+            ret_value = H5Z__shuffle_block_avx2(16, nelmts, src, dest);
+            break;
+        default:
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__shuffle_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__unshuffle_avx2
+ *
+ * Purpose:     Unshuffle blocks of 32 elements with AVX2 instructions.
+ *
+ * Return:      Number of elements unshuffled
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5Z_SHUFFLE_AVX2 size_t
+H5Z__unshuffle_avx2(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (size) {
+        case 2:
+            ret_value = H5Z__unshuffle_block_avx2(2, nelmts, src, dest);
+            break;
+        case 4:
+            ret_value = H5Z__unshuffle_block_avx2(4, nelmts, src, dest);
+            break;
+        case 8:
+            ret_value = H5Z__unshuffle_block_avx2(8, nelmts, src, dest);
+            break;
+        case 16:
+            ret_value = H5Z__unshuffle_block_avx2(16, nelmts, src, dest);
+            break;
+        default:
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__unshuffle_avx2() */
+#endif /* H5_HAVE_AVX2_DISPATCH */
+
+#ifdef __ARM_NEON
+/* One round of interleaving IN into OUT */
+static H5_INLINE void
+H5Z__shuffle_round_neon(unsigned size, const uint8x16_t *in, uint8x16_t *out)
+{
+    unsigned u;
+
+    H5Z_SHUFFLE_UNROLL
+
+    for (u = 0; u < size / 2; u++) {
+        uint8x16x2_t z = vzipq_u8(in[u], in[u + (size / 2)]);
+
+        out[2 * u]     = z.val[0];
+        out[2 * u + 1] = z.val[1];
+    } /* end for */
+} /* end H5Z__shuffle_round_neon() */
+
+static H5_INLINE size_t
+H5Z__shuffle_block_neon(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    uint8x16_t a[H5Z_SHUFFLE_VEC_MAX_SIZE], b[H5Z_SHUFFLE_VEC_MAX_SIZE];
+    size_t     nblocks = nelmts / 16;
+    size_t     n;
+    unsigned   u;
+
+    for (n = 0; n < nblocks; n++) {
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < size; u++)
+            a[u] = vld1q_u8(src + (n * 16 * size) + (u * 16));
+        H5Z__shuffle_round_neon(size, a, b);
+        H5Z__shuffle_round_neon(size, b, a);
+        H5Z__shuffle_round_neon(size, a, b);
+        H5Z__shuffle_round_neon(size, b, a);
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < size; u++)
+            vst1q_u8(dest + (u * nelmts) + (n * 16), a[u]);
+    } /* end for */
+
+    return nblocks * 16;
+} /* end H5Z__shuffle_block_neon() */
+
+static H5_INLINE size_t
+H5Z__unshuffle_block_neon(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    uint8x16_t  a[H5Z_SHUFFLE_VEC_MAX_SIZE], b[H5Z_SHUFFLE_VEC_MAX_SIZE];
+    uint8x16_t *in, *out, *tmp;
+    size_t      nblocks = nelmts / 16;
+    size_t      n;
+    unsigned    u;
+
+    for (n = 0; n < nblocks; n++) {
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < size; u++)
+            a[u] = vld1q_u8(src + (u * nelmts) + (n * 16));
+        H5Z_SHUFFLE_UNROLL
+        for (in = a, out = b, u = 1; u < size; u *= 2) {
+            H5Z__shuffle_round_neon(size, in, out);
+            tmp = in;
+            in  = out;
+            out = tmp;
+        } /* end for */
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < size; u++)
+            vst1q_u8(dest + (n * 16 * size) + (u * 16), in[u]);
+    } /* end for */
+
+    return nblocks * 16;
+} /* end H5Z__unshuffle_block_neon() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__shuffle_neon
+ *
+ * Purpose:     Shuffle blocks of 16 elements with NEON instructions.
+ *
+ * Return:      Number of elements shuffled
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__shuffle_neon(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (size) {
+        case 2:
+            ret_value = H5Z__shuffle_block_neon(2, nelmts, src, dest);
+            break;
+        case 4:
+            ret_value = H5Z__shuffle_block_neon(4, nelmts, src, dest);
+            break;
+        case 8:
+            ret_value = H5Z__shuffle_block_neon(8, nelmts, src, dest);
+            break;
+        case 16:
+            ret_value = H5Z__shuffle_block_neon(16, nelmts, src, dest);
+            break;
+        default:
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__shuffle_neon() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__unshuffle_neon
+ *
+ * Purpose:     Unshuffle blocks of 16 elements with NEON instructions.
+ *
+ * Return:      Number of elements unshuffled
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__unshuffle_neon(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (size) {
+        case 2:
+            ret_value = H5Z__unshuffle_block_neon(2, nelmts, src, dest);
+            break;
+        case 4:
+            ret_value = H5Z__unshuffle_block_neon(4, nelmts, src, dest);
+            break;
+        case 8:
+            ret_value = H5Z__unshuffle_block_neon(8, nelmts, src, dest);
+            break;
+        case 16:
+            ret_value = H5Z__unshuffle_block_neon(16, nelmts, src, dest);
+            break;
+        default:
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__unshuffle_neon() */
+#endif /* __ARM_NEON */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__shuffle_bytes
+ *
+ * Purpose:     Shuffle the NELMTS elements of SIZE bytes in SRC into DEST,
+ *              putting byte I of every element in the Ith run of NELMTS
+ *              bytes.  As many elements as possible are shuffled with
+ *              vector instructions.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5Z__shuffle_bytes(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    const uint8_t *_src;     /* Next byte to read */
+    uint8_t *      _dest;    /* Next byte to write */
+    size_t         nvec = 0; /* Number of elements shuffled with vector instructions */
+    size_t         nleft;    /* Number of elements left to shuffle a byte at a time */
+    unsigned       i;        /* Local index variable */
+#ifdef NO_DUFFS_DEVICE
+    size_t j; /* Local index variable */
+#endif        /* NO_DUFFS_DEVICE */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Choose the vector kernels for this CPU, the first time through */
+    if (!H5Z_shuffle_kernels_init_g)
+        H5Z__shuffle_init_kernels();
+
+    /* Shuffle as many elements as possible with vector instructions */
+    if (H5Z_shuffle_kernel_g && H5Z_SHUFFLE_VEC_SIZE(size))
+        nvec = (*H5Z_shuffle_kernel_g)(size, nelmts, src, dest);
+
+    /* Shuffle the rest a byte at a time */
+    nleft = nelmts - nvec;
+    for (i = 0; i < size && nleft > 0; i++) {
+        _src  = src + (nvec * size) + i;
+        _dest = dest + (i * nelmts) + nvec;
+#define DUFF_GUTS                                                                                            \
+    *_dest++ = *_src;                                                                                        \
+    _src += size;
+#ifdef NO_DUFFS_DEVICE
+        j = nleft;
+        while (j > 0) {
+            DUFF_GUTS;
+
+            j--;
+        } /* end for */
+#else  /* NO_DUFFS_DEVICE */
+        {
+            size_t duffs_index; /* Counting index for Duff's device */
+
+            duffs_index = (nleft + 7) / 8;
+            switch (nleft % 8) {
+                default:
+                    HDassert(0 && "This Should never be executed!");
+                    break;
+                case 0:
+                    do {
+                        DUFF_GUTS
+                        H5_ATTR_FALLTHROUGH
+                        case 7:
+                            DUFF_GUTS
+                            H5_ATTR_FALLTHROUGH
+                        case 6:
+                            DUFF_GUTS
+                            H5_ATTR_FALLTHROUGH
+                        case 5:
+                            DUFF_GUTS
+                            H5_ATTR_FALLTHROUGH
+                        case 4:
+                            DUFF_GUTS
+                            H5_ATTR_FALLTHROUGH
+                        case 3:
+                            DUFF_GUTS
+                            H5_ATTR_FALLTHROUGH
+                        case 2:
+                            DUFF_GUTS
+                            H5_ATTR_FALLTHROUGH
+                        case 1:
+                            DUFF_GUTS
+                    } while (--duffs_index > 0);
+            } /* end switch */
+        }
+#endif /* NO_DUFFS_DEVICE */
+#undef DUFF_GUTS
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__shuffle_bytes() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__unshuffle_bytes
+ *
+ * Purpose:     Undo H5Z__shuffle_bytes, putting the NELMTS elements of
+ *              SIZE bytes shuffled in SRC back together in DEST.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5Z__unshuffle_bytes(unsigned size, size_t nelmts, const uint8_t *src, uint8_t *dest)
+{
+    const uint8_t *_src;     /* Next byte to read */
+    uint8_t *      _dest;    /* Next byte to write */
+    size_t         nvec = 0; /* Number of elements unshuffled with vector instructions */
+    size_t         nleft;    /* Number of elements left to unshuffle a byte at a time */
+    unsigned       i;        /* Local index variable */
+#ifdef NO_DUFFS_DEVICE
+    size_t j; /* Local index variable */
+#endif        /* NO_DUFFS_DEVICE */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Choose the vector kernels for this CPU, the first time through */
+    if (!H5Z_shuffle_kernels_init_g)
+        H5Z__shuffle_init_kernels();
+
+    /* Unshuffle as many elements as possible with vector instructions */
+    if (H5Z_unshuffle_kernel_g && H5Z_SHUFFLE_VEC_SIZE(size))
+        nvec = (*H5Z_unshuffle_kernel_g)(size, nelmts, src, dest);
+
+    /* Unshuffle the rest a byte at a time */
+    nleft = nelmts - nvec;
+    for (i = 0; i < size && nleft > 0; i++) {
+        _src  = src + (i * nelmts) + nvec;
+        _dest = dest + (nvec * size) + i;
+#define DUFF_GUTS                                                                                            \
+    *_dest = *_src++;                                                                                        \
+    _dest += size;
+#ifdef NO_DUFFS_DEVICE
+        j = nleft;
+        while (j > 0) {
+            DUFF_GUTS;
+
+            j--;
+        } /* end for */
+#else  /* NO_DUFFS_DEVICE */
+        {
+            size_t duffs_index; /* Counting index for Duff's device */
+
+            duffs_index = (nleft + 7) / 8;
+            switch (nleft % 8) {
+                default:
+                    HDassert(0 && "This Should never be executed!");
+                    break;
+                case 0:
+                    do {
+                        DUFF_GUTS
+                        H5_ATTR_FALLTHROUGH
+                        case 7:
+                            DUFF_GUTS
+                            H5_ATTR_FALLTHROUGH
+                        case 6:
+                            DUFF_GUTS
+                            H5_ATTR_FALLTHROUGH
+                        case 5:
+                            DUFF_GUTS
+                            H5_ATTR_FALLTHROUGH
+                        case 4:
+                            DUFF_GUTS
+                            H5_ATTR_FALLTHROUGH
+                        case 3:
+                            DUFF_GUTS
+                            H5_ATTR_FALLTHROUGH
+                        case 2:
+                            DUFF_GUTS
+                            H5_ATTR_FALLTHROUGH
+                        case 1:
+                            DUFF_GUTS
+                    } while (--duffs_index > 0);
+            } /* end switch */
+        }
+#endif /* NO_DUFFS_DEVICE */
+#undef DUFF_GUTS
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__unshuffle_bytes() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5Z__filter_shuffle
  *
@@ -116,16 +836,10 @@ H5Z__filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[]
                     size_t *buf_size, void **buf)
 {
     void *         dest  = NULL;  /* Buffer to deposit [un]shuffled bytes into */
-    unsigned char *_src  = NULL;  /* Alias for source buffer */
-    unsigned char *_dest = NULL;  /* Alias for destination buffer */
     unsigned       bytesoftype;   /* Number of bytes per element */
     size_t         numofelements; /* Number of elements in buffer */
-    size_t         i;             /* Local index variables */
-#ifdef NO_DUFFS_DEVICE
-    size_t j;             /* Local index variable */
-#endif                    /* NO_DUFFS_DEVICE */
-    size_t leftover;      /* Extra bytes at end of buffer */
-    size_t ret_value = 0; /* Return value */
+    size_t         leftover;      /* Extra bytes at end of buffer */
+    size_t         ret_value = 0; /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -148,134 +862,16 @@ H5Z__filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[]
         if (NULL == (dest = H5MM_malloc(nbytes)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for shuffle buffer")
 
-        if (flags & H5Z_FLAG_REVERSE) {
-            /* Get the pointer to the source buffer */
-            _src = (unsigned char *)(*buf);
+        /* [Un]shuffle the elements */
+        if (flags & H5Z_FLAG_REVERSE)
+            H5Z__unshuffle_bytes(bytesoftype, numofelements, (const uint8_t *)(*buf), (uint8_t *)dest);
+        else
+            H5Z__shuffle_bytes(bytesoftype, numofelements, (const uint8_t *)(*buf), (uint8_t *)dest);
 
-            /* Input; unshuffle */
-            for (i = 0; i < bytesoftype; i++) {
-                _dest = ((unsigned char *)dest) + i;
-#define DUFF_GUTS                                                                                            \
-    *_dest = *_src++;                                                                                        \
-    _dest += bytesoftype;
-#ifdef NO_DUFFS_DEVICE
-                j = numofelements;
-                while (j > 0) {
-                    DUFF_GUTS;
-
-                    j--;
-                } /* end for */
-#else             /* NO_DUFFS_DEVICE */
-                {
-                    size_t duffs_index; /* Counting index for Duff's device */
-
-                    duffs_index = (numofelements + 7) / 8;
-                    switch (numofelements % 8) {
-                        default:
-                            HDassert(0 && "This Should never be executed!");
-                            break;
-                        case 0:
-                            do {
-                                DUFF_GUTS
-                                H5_ATTR_FALLTHROUGH
-                                case 7:
-                                    DUFF_GUTS
-                                    H5_ATTR_FALLTHROUGH
-                                case 6:
-                                    DUFF_GUTS
-                                    H5_ATTR_FALLTHROUGH
-                                case 5:
-                                    DUFF_GUTS
-                                    H5_ATTR_FALLTHROUGH
-                                case 4:
-                                    DUFF_GUTS
-                                    H5_ATTR_FALLTHROUGH
-                                case 3:
-                                    DUFF_GUTS
-                                    H5_ATTR_FALLTHROUGH
-                                case 2:
-                                    DUFF_GUTS
-                                    H5_ATTR_FALLTHROUGH
-                                case 1:
-                                    DUFF_GUTS
-                            } while (--duffs_index > 0);
-                    } /* end switch */
-                }
-#endif            /* NO_DUFFS_DEVICE */
-#undef DUFF_GUTS
-            } /* end for */
-
-            /* Add leftover to the end of data */
-            if (leftover > 0) {
-                /* Adjust back to end of shuffled bytes */
-                _dest -= (bytesoftype - 1); /*lint !e794 _dest is initialized */
-                H5MM_memcpy((void *)_dest, (void *)_src, leftover);
-            }
-        } /* end if */
-        else {
-            /* Get the pointer to the destination buffer */
-            _dest = (unsigned char *)dest;
-
-            /* Output; shuffle */
-            for (i = 0; i < bytesoftype; i++) {
-                _src = ((unsigned char *)(*buf)) + i;
-#define DUFF_GUTS                                                                                            \
-    *_dest++ = *_src;                                                                                        \
-    _src += bytesoftype;
-#ifdef NO_DUFFS_DEVICE
-                j = numofelements;
-                while (j > 0) {
-                    DUFF_GUTS;
-
-                    j--;
-                } /* end for */
-#else             /* NO_DUFFS_DEVICE */
-                {
-                    size_t duffs_index; /* Counting index for Duff's device */
-
-                    duffs_index = (numofelements + 7) / 8;
-                    switch (numofelements % 8) {
-                        default:
-                            HDassert(0 && "This Should never be executed!");
-                            break;
-                        case 0:
-                            do {
-                                DUFF_GUTS
-                                H5_ATTR_FALLTHROUGH
-                                case 7:
-                                    DUFF_GUTS
-                                    H5_ATTR_FALLTHROUGH
-                                case 6:
-                                    DUFF_GUTS
-                                    H5_ATTR_FALLTHROUGH
-                                case 5:
-                                    DUFF_GUTS
-                                    H5_ATTR_FALLTHROUGH
-                                case 4:
-                                    DUFF_GUTS
-                                    H5_ATTR_FALLTHROUGH
-                                case 3:
-                                    DUFF_GUTS
-                                    H5_ATTR_FALLTHROUGH
-                                case 2:
-                                    DUFF_GUTS
-                                    H5_ATTR_FALLTHROUGH
-                                case 1:
-                                    DUFF_GUTS
-                            } while (--duffs_index > 0);
-                    } /* end switch */
-                }
-#endif            /* NO_DUFFS_DEVICE */
-#undef DUFF_GUTS
-            } /* end for */
-
-            /* Add leftover to the end of data */
-            if (leftover > 0) {
-                /* Adjust back to end of shuffled bytes */
-                _src -= (bytesoftype - 1); /*lint !e794 _src is initialized */
-                H5MM_memcpy((void *)_dest, (void *)_src, leftover);
-            }
-        } /* end else */
+        /* Add leftover to the end of data */
+        if (leftover > 0)
+            H5MM_memcpy(((unsigned char *)dest) + (numofelements * bytesoftype),
+                        ((unsigned char *)(*buf)) + (numofelements * bytesoftype), leftover);
 
         /* Free the input buffer */
         H5MM_xfree(*buf);
@@ -54,17 +54,42 @@ typedef struct H5Z_node {
     H5Z_num_val      value;
 } H5Z_node;
 
+/* Instructions of a compiled transform.  The program works on a stack of
+ * blocks of elements: LOAD pushes a block of the array, the *_C and C_*
+ * instructions combine the block on top with a constant, and the *_ARR
+ * instructions combine the two blocks on top into one.  The operations of
+ * each group are in the same order as the tokens for them.
+ */
+typedef enum {
+    H5Z_XFORM_INSTR_LOAD,    /* Push a block of the array */
+    H5Z_XFORM_INSTR_ADD_C,   /* top = top + c */
+    H5Z_XFORM_INSTR_SUB_C,   /* top = top - c */
+    H5Z_XFORM_INSTR_MUL_C,   /* top = top * c */
+    H5Z_XFORM_INSTR_DIV_C,   /* top = top / c */
+    H5Z_XFORM_INSTR_C_ADD,   /* top = c + top */
+    H5Z_XFORM_INSTR_C_SUB,   /* top = c - top */
+    H5Z_XFORM_INSTR_C_MUL,   /* top = c * top */
+    H5Z_XFORM_INSTR_C_DIV,   /* top = c / top */
+    H5Z_XFORM_INSTR_ADD_ARR, /* Pop top, then top = top + popped */
+    H5Z_XFORM_INSTR_SUB_ARR, /* Pop top, then top = top - popped */
+    H5Z_XFORM_INSTR_MUL_ARR, /* Pop top, then top = top * popped */
+    H5Z_XFORM_INSTR_DIV_ARR  /* Pop top, then top = top / popped */
+} H5Z_xform_opcode_t;
+
+typedef struct {
+    H5Z_xform_opcode_t opcode; /* What the instruction does */
+    double             value;  /* The constant operand, if any */
+} H5Z_xform_instr_t;
+
 struct H5Z_data_xform_t {
-    char *           xform_exp;
-    H5Z_node *       parse_root;
-    H5Z_datval_ptrs *dat_val_pointers;
+    char *             xform_exp;
+    H5Z_node *         parse_root;
+    H5Z_datval_ptrs *  dat_val_pointers;
+    H5Z_xform_instr_t *prog;       /* The parse tree, compiled (NULL for a constant) */
+    size_t             prog_len;   /* # of instructions in the program */
+    unsigned           prog_depth; /* Most blocks on the program's stack at once */
 };
 
-typedef struct result {
-    H5Z_token_type type;
-    H5Z_num_val    value;
-} H5Z_result;
-
 /* The token */
 typedef struct {
     const char *tok_expr; /* Holds the original expression        */
@@ -90,188 +115,123 @@ static void       H5Z__do_op(H5Z_node *tree);
 static hbool_t    H5Z__op_is_numbs(H5Z_node *_tree);
 static hbool_t    H5Z__op_is_numbs2(H5Z_node *_tree);
 static hid_t      H5Z__xform_find_type(const H5T_t *type);
-static herr_t     H5Z__xform_eval_full(H5Z_node *tree, const size_t array_size, const hid_t array_type,
-                                       H5Z_result *res);
+static herr_t     H5Z__xform_compile(H5Z_data_xform_t *data_xform_prop);
+static herr_t     H5Z__xform_compile_node(const H5Z_node *tree, H5Z_data_xform_t *data_xform_prop,
+                                          unsigned *depth);
 static void       H5Z__xform_destroy_parse_tree(H5Z_node *tree);
 static void *     H5Z__xform_parse(const char *expression, H5Z_datval_ptrs *dat_val_pointers);
 static void *     H5Z__xform_copy_tree(H5Z_node *tree, H5Z_datval_ptrs *dat_val_pointers,
                                        H5Z_datval_ptrs *new_dat_val_pointers);
 static void       H5Z__xform_reduce_tree(H5Z_node *tree);
 
-/* PGCC (11.8-0) has trouble with the command *p++ = *p OP tree_val. It increments P first before
- * doing the operation.  So I break down the command into two lines:
- *     *p = *p OP tree_val; p++;
- * Actually, the behavior of *p++ = *p OP tree_val is undefined. (SLU - 2012/3/19)
+/* Number of elements the transform program works on at a time.  Full blocks
+ * have this many elements, which lets compilers vectorize the loops over them.
  */
-#define H5Z_XFORM_DO_OP1(RESL, RESR, TYPE, OP, SIZE)                                                         \
+#define H5Z_XFORM_BLOCK_NELMTS 256
+
+/* Value of a number in the parse tree */
+#define H5Z_XFORM_NUM_VAL(NODE)                                                                              \
+    ((NODE)->type == H5Z_XFORM_INTEGER ? (double)(NODE)->value.int_val : (NODE)->value.float_val)
+
+/* Combine the N elements of a block with a constant, or with the elements of
+ * another block.  Operations with a constant are done in double precision and
+ * each result is stored in the array's type.
+ */
+#define H5Z_XFORM_OP_C(TYPE, P, N, OP, C)                                                                    \
+    for (u = 0; u < (N); u++)                                                                                \
+        (P)[u] = (TYPE)((double)(P)[u] OP(C));
+#define H5Z_XFORM_C_OP(TYPE, P, N, OP, C)                                                                    \
+    for (u = 0; u < (N); u++)                                                                                \
+        (P)[u] = (TYPE)((C)OP(double)(P)[u]);
+#define H5Z_XFORM_OP_ARR(TYPE, PL, PR, N, OP)                                                                \
+    for (u = 0; u < (N); u++)                                                                                \
+        (PL)[u] = (TYPE)((PL)[u] OP(PR)[u]);
+
+/* Run the compiled program on the N elements of a block, BLK.  When more
+ * than one block is on the stack at once, the stack is in STACK and the
+ * result is copied back to the block.
+ */
+#define H5Z_XFORM_RUN(TYPE, BLK, N, STACK)                                                                   \
     {                                                                                                        \
-        size_t u;                                                                                            \
+        TYPE * top    = (BLK);                                                                               \
+        size_t nslots = 0;                                                                                   \
+        size_t pc, u;                                                                                        \
                                                                                                              \
-        if (((RESL).type == H5Z_XFORM_SYMBOL) && ((RESR).type != H5Z_XFORM_SYMBOL)) {                        \
-            TYPE * p;                                                                                        \
-            double tree_val;                                                                                 \
+        for (pc = 0; pc < data_xform_prop->prog_len; pc++) {                                                 \
+            double c = data_xform_prop->prog[pc].value;                                                      \
                                                                                                              \
-            tree_val =                                                                                       \
-                ((RESR).type == H5Z_XFORM_INTEGER ? (double)(RESR).value.int_val : (RESR).value.float_val);  \
-            p = (TYPE *)(RESL).value.dat_val;                                                                \
-                                                                                                             \
-            for (u = 0; u < (SIZE); u++) {                                                                   \
-                *p = (TYPE)((double)*p OP tree_val);                                                         \
-                p++;                                                                                         \
+            switch (data_xform_prop->prog[pc].opcode) {                                                      \
+                case H5Z_XFORM_INSTR_LOAD:                                                                   \
+                    if (STACK) {                                                                             \
+                        top = (TYPE *)(STACK) + nslots++ * H5Z_XFORM_BLOCK_NELMTS;                           \
+                        H5MM_memcpy(top, (BLK), (N) * sizeof(TYPE));                                         \
+                    }                                                                                        \
+                    break;                                                                                   \
+                case H5Z_XFORM_INSTR_ADD_C:                                                                  \
+                    H5Z_XFORM_OP_C(TYPE, top, N, +, c)                                                       \
+                    break;                                                                                   \
+                case H5Z_XFORM_INSTR_SUB_C:                                                                  \
+                    H5Z_XFORM_OP_C(TYPE, top, N, -, c)                                                       \
+                    break;                                                                                   \
+                case H5Z_XFORM_INSTR_MUL_C:                                                                  \
+                    H5Z_XFORM_OP_C(TYPE, top, N, *, c)                                                       \
+                    break;                                                                                   \
+                case H5Z_XFORM_INSTR_DIV_C:                                                                  \
+                    H5Z_XFORM_OP_C(TYPE, top, N, /, c)                                                       \
+                    break;                                                                                   \
+                case H5Z_XFORM_INSTR_C_ADD:                                                                  \
+                    H5Z_XFORM_C_OP(TYPE, top, N, +, c)                                                       \
+                    break;                                                                                   \
+                case H5Z_XFORM_INSTR_C_SUB:                                                                  \
+                    H5Z_XFORM_C_OP(TYPE, top, N, -, c)                                                       \
+                    break;                                                                                   \
+                case H5Z_XFORM_INSTR_C_MUL:                                                                  \
+                    H5Z_XFORM_C_OP(TYPE, top, N, *, c)                                                       \
+                    break;                                                                                   \
+                case H5Z_XFORM_INSTR_C_DIV:                                                                  \
+                    H5Z_XFORM_C_OP(TYPE, top, N, /, c)                                                       \
+                    break;                                                                                   \
+                case H5Z_XFORM_INSTR_ADD_ARR:                                                                \
+                    top -= H5Z_XFORM_BLOCK_NELMTS;                                                           \
+                    nslots--;                                                                                \
+                    H5Z_XFORM_OP_ARR(TYPE, top, top + H5Z_XFORM_BLOCK_NELMTS, N, +)                          \
+                    break;                                                                                   \
+                case H5Z_XFORM_INSTR_SUB_ARR:                                                                \
+                    top -= H5Z_XFORM_BLOCK_NELMTS;                                                           \
+                    nslots--;                                                                                \
+                    H5Z_XFORM_OP_ARR(TYPE, top, top + H5Z_XFORM_BLOCK_NELMTS, N, -)                          \
+                    break;                                                                                   \
+                case H5Z_XFORM_INSTR_MUL_ARR:                                                                \
+                    top -= H5Z_XFORM_BLOCK_NELMTS;                                                           \
+                    nslots--;                                                                                \
+                    H5Z_XFORM_OP_ARR(TYPE, top, top + H5Z_XFORM_BLOCK_NELMTS, N, *)                          \
+                    break;                                                                                   \
+                case H5Z_XFORM_INSTR_DIV_ARR:                                                                \
+                    top -= H5Z_XFORM_BLOCK_NELMTS;                                                           \
+                    nslots--;                                                                                \
+                    H5Z_XFORM_OP_ARR(TYPE, top, top + H5Z_XFORM_BLOCK_NELMTS, N, /)                          \
+                    break;                                                                                   \
+                default:                                                                                     \
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid transform program")                   \
             }                                                                                                \
         }                                                                                                    \
-        else if (((RESR).type == H5Z_XFORM_SYMBOL) && ((RESL).type != H5Z_XFORM_SYMBOL)) {                   \
-            TYPE * p;                                                                                        \
-            double tree_val;                                                                                 \
-                                                                                                             \
-            /* The case that the left operand is nothing, like -x or +x */                                   \
-            if ((RESL).type == H5Z_XFORM_ERROR)                                                              \
-                tree_val = 0;                                                                                \
-            else                                                                                             \
-                tree_val = ((RESL).type == H5Z_XFORM_INTEGER ? (double)(RESL).value.int_val                  \
-                                                             : (RESL).value.float_val);                      \
-                                                                                                             \
-            p = (TYPE *)(RESR).value.dat_val;                                                                \
-            for (u = 0; u < (SIZE); u++) {                                                                   \
-                *p = (TYPE)(tree_val OP(double) * p);                                                        \
-                p++;                                                                                         \
-            }                                                                                                \
-        }                                                                                                    \
-        else if (((RESL).type == H5Z_XFORM_SYMBOL) && ((RESR).type == H5Z_XFORM_SYMBOL)) {                   \
-            TYPE *pl = (TYPE *)(RESL).value.dat_val;                                                         \
-            TYPE *pr = (TYPE *)(RESR).value.dat_val;                                                         \
-                                                                                                             \
-            for (u = 0; u < (SIZE); u++) {                                                                   \
-                *pl = (TYPE)(*pl OP * pr);                                                                   \
-                pl++;                                                                                        \
-                pr++;                                                                                        \
-            }                                                                                                \
-        }                                                                                                    \
-        else                                                                                                 \
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unexpected type conversion operation")                \
+        if (STACK)                                                                                           \
+            H5MM_memcpy((BLK), (STACK), (N) * sizeof(TYPE));                                                 \
     }
 
-#if H5_SIZEOF_LONG_DOUBLE != 0
-#if CHAR_MIN >= 0
-#define H5Z_XFORM_TYPE_OP(RESL, RESR, TYPE, OP, SIZE)                                                        \
-    {                                                                                                        \
-        if ((TYPE) == H5T_NATIVE_CHAR)                                                                       \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_SCHAR)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), signed char, OP, (SIZE))                                        \
-        else if ((TYPE) == H5T_NATIVE_SHORT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_USHORT)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))                                     \
-        else if ((TYPE) == H5T_NATIVE_INT)                                                                   \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))                                                \
-        else if ((TYPE) == H5T_NATIVE_UINT)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))                                       \
-        else if ((TYPE) == H5T_NATIVE_LONG)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_ULONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_LLONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))                                          \
-        else if ((TYPE) == H5T_NATIVE_ULLONG)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE))                                 \
-        else if ((TYPE) == H5T_NATIVE_FLOAT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_DOUBLE)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))                                             \
-        else if ((TYPE) == H5T_NATIVE_LDOUBLE)                                                               \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long double, OP, (SIZE))                                        \
-    }
-#else /* CHAR_MIN >= 0 */
-#define H5Z_XFORM_TYPE_OP(RESL, RESR, TYPE, OP, SIZE)                                                        \
-    {                                                                                                        \
-        if ((TYPE) == H5T_NATIVE_CHAR)                                                                       \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_UCHAR)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned char, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_SHORT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_USHORT)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))                                     \
-        else if ((TYPE) == H5T_NATIVE_INT)                                                                   \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))                                                \
-        else if ((TYPE) == H5T_NATIVE_UINT)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))                                       \
-        else if ((TYPE) == H5T_NATIVE_LONG)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_ULONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_LLONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))                                          \
-        else if ((TYPE) == H5T_NATIVE_ULLONG)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE))                                 \
-        else if ((TYPE) == H5T_NATIVE_FLOAT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_DOUBLE)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))                                             \
-        else if ((TYPE) == H5T_NATIVE_LDOUBLE)                                                               \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long double, OP, (SIZE))                                        \
-    }
-#endif /* CHAR_MIN >= 0 */
-#else
-#if CHAR_MIN >= 0
-#define H5Z_XFORM_TYPE_OP(RESL, RESR, TYPE, OP, SIZE)                                                        \
-    {                                                                                                        \
-        if ((TYPE) == H5T_NATIVE_CHAR)                                                                       \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_SCHAR)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), signed char, OP, (SIZE))                                        \
-        else if ((TYPE) == H5T_NATIVE_SHORT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_USHORT)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))                                     \
-        else if ((TYPE) == H5T_NATIVE_INT)                                                                   \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))                                                \
-        else if ((TYPE) == H5T_NATIVE_UINT)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))                                       \
-        else if ((TYPE) == H5T_NATIVE_LONG)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_ULONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_LLONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))                                          \
-        else if ((TYPE) == H5T_NATIVE_ULLONG)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE))                                 \
-        else if ((TYPE) == H5T_NATIVE_FLOAT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_DOUBLE)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))                                             \
-    }
-#else /* CHAR_MIN >= 0 */
-#define H5Z_XFORM_TYPE_OP(RESL, RESR, TYPE, OP, SIZE)                                                        \
+/* Run the compiled program on the array, one block at a time */
+#define H5Z_XFORM_EVAL(TYPE)                                                                                 \
     {                                                                                                        \
-        if ((TYPE) == H5T_NATIVE_CHAR)                                                                       \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_UCHAR)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned char, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_SHORT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_USHORT)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))                                     \
-        else if ((TYPE) == H5T_NATIVE_INT)                                                                   \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))                                                \
-        else if ((TYPE) == H5T_NATIVE_UINT)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))                                       \
-        else if ((TYPE) == H5T_NATIVE_LONG)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_ULONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_LLONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))                                          \
-        else if ((TYPE) == H5T_NATIVE_ULLONG)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE))                                 \
-        else if ((TYPE) == H5T_NATIVE_FLOAT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_DOUBLE)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))                                             \
+        TYPE * blk = (TYPE *)array;                                                                          \
+        size_t nleft;                                                                                        \
+                                                                                                             \
+        for (nleft = array_size; nleft >= H5Z_XFORM_BLOCK_NELMTS; nleft -= H5Z_XFORM_BLOCK_NELMTS) {         \
+            H5Z_XFORM_RUN(TYPE, blk, H5Z_XFORM_BLOCK_NELMTS, stack)                                          \
+            blk += H5Z_XFORM_BLOCK_NELMTS;                                                                   \
+        }                                                                                                    \
+        if (nleft > 0)                                                                                       \
+            H5Z_XFORM_RUN(TYPE, blk, nleft, stack)                                                           \
     }
-#endif /* CHAR_MIN >= 0 */
-#endif /*H5_SIZEOF_LONG_DOUBLE */
 
 #define H5Z_XFORM_DO_OP3(OP)                                                                                 \
     {                                                                                                        \
@@ -995,8 +955,8 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5Z_xform_eval
  * Purpose: 	If the transform is trivial, this function applies it.
- * 		Otherwise, it calls H5Z__xform_eval_full to do the full
- * 		transform.
+ * 		Otherwise, it runs the transform's compiled program on the
+ * 		array, a block of elements at a time.
  * Return:      SUCCEED if transform applied successfully, FAIL otherwise
  * Programmer:  Leon Arber
  * 		5/1/04
@@ -1006,11 +966,10 @@ done:
 herr_t
 H5Z_xform_eval(H5Z_data_xform_t *data_xform_prop, void *array, size_t array_size, const H5T_t *buf_type)
 {
-    H5Z_node * tree;
-    hid_t      array_type;
-    H5Z_result res;
-    size_t     i;
-    herr_t     ret_value = SUCCEED; /* Return value */
+    H5Z_node *tree;
+    hid_t     array_type;
+    void *    stack     = NULL;    /* Blocks on the program's stack */
+    herr_t    ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
@@ -1063,152 +1022,187 @@ H5Z_xform_eval(H5Z_data_xform_t *data_xform_prop, void *array, size_t array_size
 #endif
 
     } /* end if */
-    /* Otherwise, do the full data transform */
+    /* Otherwise, run the compiled transform */
     else {
-        /* Optimization for linear transform: */
-        if (data_xform_prop->dat_val_pointers->num_ptrs == 1)
-            data_xform_prop->dat_val_pointers->ptr_dat_val[0] = array;
+        HDassert(data_xform_prop->prog);
 
-        /* If it's a quadratic transform, we have no choice but to store multiple copies of the data */
-        else {
-            for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++) {
-                if (NULL == (data_xform_prop->dat_val_pointers->ptr_dat_val[i] = (void *)H5MM_malloc(
-                                 array_size * H5T_get_size((H5T_t *)H5I_object(array_type)))))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL,
-                                "Ran out of memory trying to allocate space for data in data transform")
-
-                H5MM_memcpy(data_xform_prop->dat_val_pointers->ptr_dat_val[i], array,
-                            array_size * H5T_get_size((H5T_t *)H5I_object(array_type)));
-            } /* end for */
-        }     /* end else */
-
-        if (H5Z__xform_eval_full(tree, array_size, array_type, &res) < 0)
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
-
-        if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
-            H5MM_memcpy(array, res.value.dat_val, array_size * H5T_get_size((H5T_t *)H5I_object(array_type)));
-
-        /* Free the temporary arrays we used */
-        if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
-            for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++)
-                H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val[i]);
+        /* A transform that uses "x" more than once needs room for more than
+         * one block; one that uses it once works in the array itself */
+        if (data_xform_prop->prog_depth > 1)
+            if (NULL == (stack = H5MM_malloc((size_t)data_xform_prop->prog_depth * H5Z_XFORM_BLOCK_NELMTS *
+                                             H5T_get_size(buf_type))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL,
+                            "Ran out of memory trying to allocate space for data in data transform")
+
+        if (array_type == H5T_NATIVE_CHAR)
+            H5Z_XFORM_EVAL(char)
+#if CHAR_MIN >= 0
+        else if (array_type == H5T_NATIVE_SCHAR)
+            H5Z_XFORM_EVAL(signed char)
+#else  /* CHAR_MIN >= 0 */
+        else if (array_type == H5T_NATIVE_UCHAR)
+            H5Z_XFORM_EVAL(unsigned char)
+#endif /* CHAR_MIN >= 0 */
+        else if (array_type == H5T_NATIVE_SHORT)
+            H5Z_XFORM_EVAL(short)
+        else if (array_type == H5T_NATIVE_USHORT)
+            H5Z_XFORM_EVAL(unsigned short)
+        else if (array_type == H5T_NATIVE_INT)
+            H5Z_XFORM_EVAL(int)
+        else if (array_type == H5T_NATIVE_UINT)
+            H5Z_XFORM_EVAL(unsigned int)
+        else if (array_type == H5T_NATIVE_LONG)
+            H5Z_XFORM_EVAL(long)
+        else if (array_type == H5T_NATIVE_ULONG)
+            H5Z_XFORM_EVAL(unsigned long)
+        else if (array_type == H5T_NATIVE_LLONG)
+            H5Z_XFORM_EVAL(long long)
+        else if (array_type == H5T_NATIVE_ULLONG)
+            H5Z_XFORM_EVAL(unsigned long long)
+        else if (array_type == H5T_NATIVE_FLOAT)
+            H5Z_XFORM_EVAL(float)
+        else if (array_type == H5T_NATIVE_DOUBLE)
+            H5Z_XFORM_EVAL(double)
+#if H5_SIZEOF_LONG_DOUBLE != 0
+        else if (array_type == H5T_NATIVE_LDOUBLE)
+            H5Z_XFORM_EVAL(long double)
+#endif
     } /* end else */
 
 done:
-    if (ret_value < 0) {
-        /* If we ran out of memory above copying the array for temp storage (which we easily can for
-         * polynomial transforms of high order) we free those arrays which we already allocated */
-        if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
-            for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++)
-                if (data_xform_prop->dat_val_pointers->ptr_dat_val[i])
-                    H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val[i]);
-    } /* end if */
+    if (stack)
+        H5MM_xfree(stack);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z_xform_eval() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5Z__xform_eval_full
+ * Function:    H5Z__xform_compile
  *
- * Purpose: 	Does a full evaluation of the parse tree contained in tree
- * 		and applies this transform to array.
+ * Purpose:     Compiles the transform's parse tree into a program for
+ *              H5Z_xform_eval, which applies the whole transform to each
+ *              block of elements in turn, rather than each operation to
+ *              the whole array in turn.
  *
- * Notes:       In the case of a polynomial data transform (ie, the left and right
- *              subtree are both of type H5Z_XFORM_SYMBOL), the convention is
- *              that the left hand side will accumulate changes and, at the end,
- *              the new data will be copied from the lhs.
- *
- * Return:      Nothing
- *
- * Programmer:  Leon Arber
- * 		5/1/04
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5Z__xform_eval_full(H5Z_node *tree, const size_t array_size, const hid_t array_type, H5Z_result *res)
+H5Z__xform_compile(H5Z_data_xform_t *data_xform_prop)
 {
-    H5Z_result resl, resr;
-    herr_t     ret_value = SUCCEED; /* Return value */
+    unsigned depth     = 0;       /* Blocks on the program's stack */
+    herr_t   ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* check args */
-    HDassert(tree);
-
-    HDmemset(&resl, 0, sizeof(H5Z_result));
-    HDmemset(&resr, 0, sizeof(H5Z_result));
-
-    if (tree->type == H5Z_XFORM_INTEGER) {
-        res->type          = H5Z_XFORM_INTEGER;
-        res->value.int_val = tree->value.int_val;
-    } /* end if */
-    else if (tree->type == H5Z_XFORM_FLOAT) {
-        res->type            = H5Z_XFORM_FLOAT;
-        res->value.float_val = tree->value.float_val;
-    } /* end if */
-    else if (tree->type == H5Z_XFORM_SYMBOL) {
-        res->type = H5Z_XFORM_SYMBOL;
-
-        /*since dat_val stores the address of the array which is really stored in the dat_val_pointers,
-         * here we make dat_val store a pointer to the array itself instead of the address of it so that the
-         * rest of the code below works normally. */
-        res->value.dat_val = *((void **)(tree->value.dat_val));
-    } /* end if */
-    else {
-        if (tree->lchild && H5Z__xform_eval_full(tree->lchild, array_size, array_type, &resl) < 0)
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
-        if (H5Z__xform_eval_full(tree->rchild, array_size, array_type, &resr) < 0)
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
-
-        res->type = H5Z_XFORM_SYMBOL;
-
-        /* For each type of operation:
-         * 1.  See if "x" is on left hand side, right hand side, or if both sides are "x"
-         * 2.  Figure out what type of data we're going to be manipulating
-         * 3.  Do the operation on the data. */
-        switch (tree->type) {
-            case H5Z_XFORM_PLUS:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, +, array_size)
-                break;
+    HDassert(data_xform_prop);
+    HDassert(data_xform_prop->parse_root);
+    HDassert(NULL == data_xform_prop->prog);
+
+    /* Transforms that reduce to a constant don't need a program */
+    if (data_xform_prop->parse_root->type == H5Z_XFORM_INTEGER ||
+        data_xform_prop->parse_root->type == H5Z_XFORM_FLOAT)
+        HGOTO_DONE(SUCCEED)
+
+    /* Each instruction comes from a different symbol or operator in the
+     * expression, so there are no more of them than characters in it */
+    if (NULL == (data_xform_prop->prog = (H5Z_xform_instr_t *)H5MM_malloc(
+                     MAX(HDstrlen(data_xform_prop->xform_exp), 1) * sizeof(H5Z_xform_instr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate memory for data transform program")
+    data_xform_prop->prog_len   = 0;
+    data_xform_prop->prog_depth = 0;
+
+    if (H5Z__xform_compile_node(data_xform_prop->parse_root, data_xform_prop, &depth) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to compile data transform")
+    HDassert(1 == depth);
+    HDassert(data_xform_prop->prog_len <= MAX(HDstrlen(data_xform_prop->xform_exp), 1));
 
-            case H5Z_XFORM_MINUS:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, -, array_size)
-                break;
+done:
+    if (ret_value < 0)
+        data_xform_prop->prog = (H5Z_xform_instr_t *)H5MM_xfree(data_xform_prop->prog);
 
-            case H5Z_XFORM_MULT:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, *, array_size)
-                break;
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__xform_compile() */
 
-            case H5Z_XFORM_DIVIDE:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, /, array_size)
-                break;
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_compile_node
+ *
+ * Purpose:     Appends the instructions for a node of the parse tree to
+ *              the transform's program.  They leave one more block on the
+ *              stack, which is DEPTH blocks deep.
+ *
+ * Notes:       Operations with a constant operand are applied to the
+ *              block for the other operand.  Constants on both sides have
+ *              been folded by H5Z__xform_reduce_tree.  A missing left
+ *              operand, as in -x, is zero.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__xform_compile_node(const H5Z_node *tree, H5Z_data_xform_t *data_xform_prop, unsigned *depth)
+{
+    H5Z_xform_instr_t *instr;               /* Instruction for the node */
+    herr_t             ret_value = SUCCEED; /* Return value */
 
-            case H5Z_XFORM_ERROR:
-            case H5Z_XFORM_INTEGER:
-            case H5Z_XFORM_FLOAT:
-            case H5Z_XFORM_SYMBOL:
-            case H5Z_XFORM_LPAREN:
-            case H5Z_XFORM_RPAREN:
-            case H5Z_XFORM_END:
-            default:
-                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid expression tree")
-        } /* end switch */
+    FUNC_ENTER_STATIC
 
-        /* The result stores a pointer to the new data */
-        /* So, if the left hand side got its data modified, the result stores a pointers
-         * to the left hand side's data, ditto for rhs */
-        if (resl.type == H5Z_XFORM_SYMBOL)
-            res->value.dat_val = resl.value.dat_val;
-        else if (resr.type == H5Z_XFORM_SYMBOL)
-            res->value.dat_val = resr.value.dat_val;
-        else
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error during transform evaluation")
-    } /* end else */
+    HDassert(tree);
+    HDassert(depth);
+
+    if (tree->type == H5Z_XFORM_SYMBOL) {
+        instr         = &data_xform_prop->prog[data_xform_prop->prog_len++];
+        instr->opcode = H5Z_XFORM_INSTR_LOAD;
+        instr->value  = 0.0;
+        if (++(*depth) > data_xform_prop->prog_depth)
+            data_xform_prop->prog_depth = *depth;
+    } /* end if */
+    else if (tree->type == H5Z_XFORM_PLUS || tree->type == H5Z_XFORM_MINUS || tree->type == H5Z_XFORM_MULT ||
+             tree->type == H5Z_XFORM_DIVIDE) {
+        unsigned op;         /* Operation, in token order */
+        hbool_t  lnum, rnum; /* Whether the operands are constants */
+
+        HDassert(tree->rchild);
+        op   = (unsigned)(tree->type - H5Z_XFORM_PLUS);
+        lnum = !tree->lchild || tree->lchild->type == H5Z_XFORM_INTEGER ||
+               tree->lchild->type == H5Z_XFORM_FLOAT;
+        rnum = tree->rchild->type == H5Z_XFORM_INTEGER || tree->rchild->type == H5Z_XFORM_FLOAT;
+
+        if (lnum && rnum)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unexpected operation on two constants")
+        else if (rnum) {
+            if (H5Z__xform_compile_node(tree->lchild, data_xform_prop, depth) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to compile data transform")
+            instr         = &data_xform_prop->prog[data_xform_prop->prog_len++];
+            instr->opcode = (H5Z_xform_opcode_t)(H5Z_XFORM_INSTR_ADD_C + op);
+            instr->value  = H5Z_XFORM_NUM_VAL(tree->rchild);
+        } /* end if */
+        else if (lnum) {
+            if (H5Z__xform_compile_node(tree->rchild, data_xform_prop, depth) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to compile data transform")
+            instr         = &data_xform_prop->prog[data_xform_prop->prog_len++];
+            instr->opcode = (H5Z_xform_opcode_t)(H5Z_XFORM_INSTR_C_ADD + op);
+            instr->value  = tree->lchild ? H5Z_XFORM_NUM_VAL(tree->lchild) : 0.0;
+        } /* end if */
+        else {
+            if (H5Z__xform_compile_node(tree->lchild, data_xform_prop, depth) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to compile data transform")
+            if (H5Z__xform_compile_node(tree->rchild, data_xform_prop, depth) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to compile data transform")
+            instr         = &data_xform_prop->prog[data_xform_prop->prog_len++];
+            instr->opcode = (H5Z_xform_opcode_t)(H5Z_XFORM_INSTR_ADD_ARR + op);
+            instr->value  = 0.0;
+            (*depth)--;
+        } /* end else */
+    }     /* end if */
+    else
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid expression tree")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5Z__xform_eval_full() */
+} /* end H5Z__xform_compile_node() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5Z_find_type
@@ -1568,6 +1562,10 @@ H5Z_xform_create(const char *expr)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL,
                     "error copying the parse tree, did not find correct number of \"variables\"")
 
+    /* Compile the parse tree */
+    if (H5Z__xform_compile(data_xform_prop) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "unable to compile data transform")
+
     /* Assign return value */
     ret_value = data_xform_prop;
 
@@ -1614,8 +1612,9 @@ H5Z_xform_destroy(H5Z_data_xform_t *data_xform_prop)
         /* Destroy the parse tree */
         H5Z__xform_destroy_parse_tree(data_xform_prop->parse_root);
 
-        /* Free the expression */
+        /* Free the expression and its program */
         H5MM_xfree(data_xform_prop->xform_exp);
+        H5MM_xfree(data_xform_prop->prog);
 
         /* Free the pointers to the temp. arrays, if there are any */
         if (data_xform_prop->dat_val_pointers->num_ptrs > 0)
@@ -1703,6 +1702,10 @@ H5Z_xform_copy(H5Z_data_xform_t **data_xform_prop)
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL,
                         "error copying the parse tree, did not find correct number of \"variables\"")
 
+        /* Compile the copy of the parse tree */
+        if (H5Z__xform_compile(new_data_xform_prop) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to compile data transform")
+
         /* Copy new information on top of old information */
         *data_xform_prop = new_data_xform_prop;
     } /* end if */
@@ -0,0 +1,140 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     An I/O filter around the Zstandard (zstd) compressor.
+ *
+ *              Each chunk is stored as a single zstd frame, with the
+ *              compression level in the first client data value.  This is
+ *              the format written by the zstd filter plugin registered for
+ *              H5Z_FILTER_ZSTD, so files written with either can be read
+ *              with the other.
+ */
+
+#include "H5Zmodule.h" /* This source code file is part of the H5Z module */
+
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5MMprivate.h" /* Memory management			*/
+#include "H5Zpkg.h"      /* Data filters				*/
+
+#ifdef H5_HAVE_FILTER_ZSTD
+
+#include <zstd.h>
+
+/* Local function prototypes */
+static size_t H5Z__filter_zstd(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                               size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_ZSTD[1] = {{
+    H5Z_CLASS_T_VERS, /* H5Z_class_t version */
+    H5Z_FILTER_ZSTD,  /* Filter id number		*/
+    1,                /* encoder_present flag (set to true) */
+    1,                /* decoder_present flag (set to true) */
+    "zstd",           /* Filter name for debugging	*/
+    NULL,             /* The "can apply" callback     */
+    NULL,             /* The "set local" callback     */
+    H5Z__filter_zstd, /* The actual filter function	*/
+}};
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__filter_zstd
+ *
+ * Purpose:     Implement an I/O filter around the Zstandard compressor
+ *              in libzstd
+ *
+ * Return:      Success: Size of buffer filtered
+ *              Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_zstd(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                 size_t *buf_size, void **buf)
+{
+    void * outbuf = NULL; /* Pointer to new buffer */
+    size_t status;        /* Status from zstd operation */
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(*buf_size > 0);
+    HDassert(buf);
+    HDassert(*buf);
+
+    if (flags & H5Z_FLAG_REVERSE) {
+        /* Input; uncompress */
+        unsigned long long nalloc; /* Number of bytes in the frame, uncompressed */
+
+        /* The frame header records the size of the uncompressed data */
+        nalloc = ZSTD_getFrameContentSize(*buf, nbytes);
+        if (ZSTD_CONTENTSIZE_ERROR == nalloc || ZSTD_CONTENTSIZE_UNKNOWN == nalloc)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "can't get size of zstd frame")
+
+        /* Allocate space for the uncompressed buffer */
+        if (NULL == (outbuf = H5MM_malloc(MAX((size_t)nalloc, 1))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for zstd uncompression")
+
+        /* Uncompress the frame */
+        status = ZSTD_decompress(outbuf, (size_t)nalloc, *buf, nbytes);
+        if (ZSTD_isError(status))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "zstd uncompression failed")
+
+        /* Free the input buffer */
+        H5MM_xfree(*buf);
+
+        /* Set return values */
+        *buf      = outbuf;
+        outbuf    = NULL;
+        *buf_size = MAX((size_t)nalloc, 1);
+        ret_value = status;
+    } /* end if */
+    else {
+        /* Output; compress into a separate buffer big enough for the worst case */
+        size_t nalloc = ZSTD_compressBound(nbytes); /* Number of bytes in the compressed buffer */
+        int    level  = 0;                          /* Compression level (0 is zstd's default) */
+
+        /* Set the compression level */
+        if (cd_nelmts > 0) {
+            if (cd_values[0] > H5Z_ZSTD_MAX_LEVEL)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid zstd compression level")
+            level = (int)cd_values[0];
+        } /* end if */
+
+        /* Allocate output (compressed) buffer */
+        if (NULL == (outbuf = H5MM_malloc(nalloc)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate zstd destination buffer")
+
+        /* Compress the buffer into a single frame */
+        status = ZSTD_compress(outbuf, nalloc, *buf, nbytes, level);
+        if (ZSTD_isError(status))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "zstd compression failed")
+
+        /* Free the input buffer */
+        H5MM_xfree(*buf);
+
+        /* Set return values */
+        *buf      = outbuf;
+        outbuf    = NULL;
+        *buf_size = nalloc;
+        ret_value = status;
+    } /* end else */
+
+done:
+    if (outbuf)
+        H5MM_xfree(outbuf);
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_zstd() */
+
+#endif /* H5_HAVE_FILTER_ZSTD */
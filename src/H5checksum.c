@@ -31,6 +31,16 @@
 /***********/
 #include "H5private.h" /* Generic Functions			*/
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef H5_HAVE_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+#ifdef H5_HAVE_SSE42_DISPATCH
+#include <nmmintrin.h>
+#endif
+
 /****************/
 /* Local Macros */
 /****************/
@@ -39,10 +49,42 @@
 /* (same as the IEEE 802.3 (Ethernet) quotient) */
 #define H5_CRC_QUOTIENT 0x04C11DB7
 
+/* Reversed polynomial for the CRC-32C (Castagnoli) checksum */
+#define H5_CRC32C_QUOTIENT 0x82F63B78
+
+/* Number of vectors of data summed by the fletcher32 kernels before their
+ * 32-bit lane sums are folded into the running sums (small enough that
+ * the lanes can't overflow) */
+#define H5_FLETCHER32_VEC_NBLOCKS 64
+
+#ifdef H5_HAVE_AVX2_DISPATCH
+#define H5_CHECKSUM_AVX2 __attribute__((target("avx2")))
+#endif
+#ifdef H5_HAVE_SSE42_DISPATCH
+#define H5_CHECKSUM_SSE42 __attribute__((target("sse4.2")))
+#endif
+
+/* Fold a 64-bit fletcher32 sum into 16 bits, as the scalar code's
+ * reductions do: a non-zero sum never folds to zero, so partial sums
+ * computed in any order give the same checksum */
+#define H5_FLETCHER32_FOLD(s)                                                                                \
+    {                                                                                                        \
+        while ((s) > 0xffff)                                                                                 \
+            (s) = ((s)&0xffff) + ((s) >> 16);                                                                \
+    }
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Vector kernel that adds as many as it can of the NBYTES bytes in DATA
+ * into the fletcher32 sums SUM1 and SUM2, and returns the number of bytes
+ * summed (a multiple of 2) */
+typedef size_t (*H5_fletcher32_kernel_t)(const uint8_t *data, size_t nbytes, uint32_t *sum1, uint32_t *sum2);
+
+/* Routine that updates a running CRC-32C with the bytes buf[0..len-1] */
+typedef uint32_t (*H5_crc32c_update_t)(uint32_t crc, const uint8_t *buf, size_t len);
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -51,6 +93,20 @@
 /* Local Prototypes */
 /********************/
 
+static void     H5__checksum_init_kernels(void);
+static uint32_t H5__checksum_crc32c_update(uint32_t crc, const uint8_t *buf, size_t len);
+#ifdef __SSE2__
+static size_t H5__checksum_fletcher32_sse2(const uint8_t *data, size_t nbytes, uint32_t *sum1,
+                                           uint32_t *sum2);
+#endif /* __SSE2__ */
+#ifdef H5_HAVE_AVX2_DISPATCH
+static size_t H5__checksum_fletcher32_avx2(const uint8_t *data, size_t nbytes, uint32_t *sum1,
+                                           uint32_t *sum2);
+#endif /* H5_HAVE_AVX2_DISPATCH */
+#ifdef H5_HAVE_SSE42_DISPATCH
+static uint32_t H5__checksum_crc32c_update_sse42(uint32_t crc, const uint8_t *buf, size_t len);
+#endif /* H5_HAVE_SSE42_DISPATCH */
+
 /*********************/
 /* Package Variables */
 /*********************/
@@ -69,6 +125,193 @@ static uint32_t H5_crc_table[256];
 /* Flag: has the table been computed? */
 static hbool_t H5_crc_table_computed = FALSE;
 
+/* Tables of CRC-32Cs of all 8-bit messages, followed by 1-7 zero bytes */
+static uint32_t H5_crc32c_table[8][256];
+
+/* Flag: have the CRC-32C tables been computed? */
+static hbool_t H5_crc32c_table_computed = FALSE;
+
+/* Fletcher32 vector kernel and CRC-32C routine for the CPU that's running,
+ * chosen on first use */
+static hbool_t                H5_checksum_kernels_init_g = FALSE;
+static H5_fletcher32_kernel_t H5_fletcher32_kernel_g     = NULL;
+static H5_crc32c_update_t     H5_crc32c_update_g         = H5__checksum_crc32c_update;
+
+/*-------------------------------------------------------------------------
+ * Function:    H5__checksum_init_kernels
+ *
+ * Purpose:     Choose the fastest fletcher32 and CRC-32C routines that the
+ *              CPU running the library supports.
+ *
+ * Return:      none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5__checksum_init_kernels(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef __SSE2__
+    H5_fletcher32_kernel_g = H5__checksum_fletcher32_sse2;
+#endif
+
+#if defined(H5_HAVE_AVX2_DISPATCH) || defined(H5_HAVE_SSE42_DISPATCH)
+    __builtin_cpu_init();
+#endif
+#ifdef H5_HAVE_AVX2_DISPATCH
+    if (__builtin_cpu_supports("avx2"))
+        H5_fletcher32_kernel_g = H5__checksum_fletcher32_avx2;
+#endif /* H5_HAVE_AVX2_DISPATCH */
+#ifdef H5_HAVE_SSE42_DISPATCH
+    if (__builtin_cpu_supports("sse4.2"))
+        H5_crc32c_update_g = H5__checksum_crc32c_update_sse42;
+#endif /* H5_HAVE_SSE42_DISPATCH */
+
+    H5_checksum_kernels_init_g = TRUE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5__checksum_init_kernels() */
+
+/*
+ * The fletcher32 kernels sum the big-endian 16-bit words of the data a
+ * vector at a time.  Each vector's high and low bytes are summed separately
+ * into 32-bit lanes, plainly for SUM1 and weighted by each word's distance
+ * from the end of the vector for SUM2; SUM2 also needs the SUM1 lanes of
+ * every vector before the current one, which are kept in a third set of
+ * lanes.  After H5_FLETCHER32_VEC_NBLOCKS vectors, the lanes are added into
+ * the running sums, which are folded back to 16 bits.
+ */
+
+#ifdef __SSE2__
+/*-------------------------------------------------------------------------
+ * Function:    H5__checksum_fletcher32_sse2
+ *
+ * Purpose:     Add blocks of 16 bytes into the fletcher32 sums with SSE2
+ *              instructions.
+ *
+ * Return:      Number of bytes summed
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5__checksum_fletcher32_sse2(const uint8_t *data, size_t nbytes, uint32_t *sum1, uint32_t *sum2)
+{
+    const __m128i hi_mask   = _mm_set1_epi16(0x00ff);
+    const __m128i ones      = _mm_set1_epi16(1);
+    const __m128i weights   = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+    size_t        nblocks   = nbytes / 16;  /* # of vectors left to sum */
+    uint64_t      s1        = *sum1;        /* Running sums */
+    uint64_t      s2        = *sum2;        /* Running sums */
+    size_t        ret_value = nblocks * 16; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    while (nblocks) {
+        __m128i  v_s1 = _mm_setzero_si128(); /* SUM1 lanes */
+        __m128i  v_s2 = _mm_setzero_si128(); /* Weighted SUM2 lanes */
+        __m128i  v_ps = _mm_setzero_si128(); /* SUM1 lanes of the previous vectors */
+        uint32_t lanes[3][4];
+        size_t   n = MIN(nblocks, H5_FLETCHER32_VEC_NBLOCKS);
+        size_t   u;
+
+        nblocks -= n;
+        for (u = 0; u < n; u++, data += 16) {
+            __m128i v  = _mm_loadu_si128((const __m128i *)data);
+            __m128i hi = _mm_and_si128(v, hi_mask); /* High bytes of the words */
+            __m128i lo = _mm_srli_epi16(v, 8);      /* Low bytes of the words */
+
+            v_ps = _mm_add_epi32(v_ps, v_s1);
+            v_s1 = _mm_add_epi32(v_s1, _mm_add_epi32(_mm_slli_epi32(_mm_madd_epi16(hi, ones), 8),
+                                                     _mm_madd_epi16(lo, ones)));
+            v_s2 = _mm_add_epi32(v_s2, _mm_add_epi32(_mm_slli_epi32(_mm_madd_epi16(hi, weights), 8),
+                                                     _mm_madd_epi16(lo, weights)));
+        } /* end for */
+
+        _mm_storeu_si128((__m128i *)lanes[0], v_s1);
+        _mm_storeu_si128((__m128i *)lanes[1], v_s2);
+        _mm_storeu_si128((__m128i *)lanes[2], v_ps);
+        s2 += 8 * n * s1;
+        for (u = 0; u < 4; u++) {
+            s1 += lanes[0][u];
+            s2 += lanes[1][u] + (8 * (uint64_t)lanes[2][u]);
+        } /* end for */
+        H5_FLETCHER32_FOLD(s1)
+        H5_FLETCHER32_FOLD(s2)
+    } /* end while */
+
+    *sum1 = (uint32_t)s1;
+    *sum2 = (uint32_t)s2;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5__checksum_fletcher32_sse2() */
+#endif /* __SSE2__ */
+
+#ifdef H5_HAVE_AVX2_DISPATCH
+/*-------------------------------------------------------------------------
+ * Function:    H5__checksum_fletcher32_avx2
+ *
+ * Purpose:     Add blocks of 32 bytes into the fletcher32 sums with AVX2
+ *              instructions.
+ *
+ * Return:      Number of bytes summed
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_CHECKSUM_AVX2 static size_t
+H5__checksum_fletcher32_avx2(const uint8_t *data, size_t nbytes, uint32_t *sum1, uint32_t *sum2)
+{
+    const __m256i hi_mask   = _mm256_set1_epi16(0x00ff);
+    const __m256i ones      = _mm256_set1_epi16(1);
+    const __m256i weights   = _mm256_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    size_t        nblocks   = nbytes / 32;  /* # of vectors left to sum */
+    uint64_t      s1        = *sum1;        /* Running sums */
+    uint64_t      s2        = *sum2;        /* Running sums */
+    size_t        ret_value = nblocks * 32; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    while (nblocks) {
+        __m256i  v_s1 = _mm256_setzero_si256(); /* SUM1 lanes */
+        __m256i  v_s2 = _mm256_setzero_si256(); /* Weighted SUM2 lanes */
+        __m256i  v_ps = _mm256_setzero_si256(); /* SUM1 lanes of the previous vectors */
+        uint32_t lanes[3][8];
+        size_t   n = MIN(nblocks, H5_FLETCHER32_VEC_NBLOCKS);
+        size_t   u;
+
+        nblocks -= n;
+        for (u = 0; u < n; u++, data += 32) {
+            __m256i v  = _mm256_loadu_si256((const __m256i *)data);
+            __m256i hi = _mm256_and_si256(v, hi_mask); /* High bytes of the words */
+            __m256i lo = _mm256_srli_epi16(v, 8);      /* Low bytes of the words */
+
+            v_ps = _mm256_add_epi32(v_ps, v_s1);
+            v_s1 = _mm256_add_epi32(v_s1, _mm256_add_epi32(_mm256_slli_epi32(_mm256_madd_epi16(hi, ones), 8),
+                                                           _mm256_madd_epi16(lo, ones)));
+            v_s2 =
+                _mm256_add_epi32(v_s2, _mm256_add_epi32(_mm256_slli_epi32(_mm256_madd_epi16(hi, weights), 8),
+                                                        _mm256_madd_epi16(lo, weights)));
+        } /* end for */
+
+        _mm256_storeu_si256((__m256i *)lanes[0], v_s1);
+        _mm256_storeu_si256((__m256i *)lanes[1], v_s2);
+        _mm256_storeu_si256((__m256i *)lanes[2], v_ps);
+        s2 += 16 * n * s1;
+        for (u = 0; u < 8; u++) {
+            s1 += lanes[0][u];
+            s2 += lanes[1][u] + (16 * (uint64_t)lanes[2][u]);
+        } /* end for */
+        H5_FLETCHER32_FOLD(s1)
+        H5_FLETCHER32_FOLD(s2)
+    } /* end while */
+
+    *sum1 = (uint32_t)s1;
+    *sum2 = (uint32_t)s2;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5__checksum_fletcher32_avx2() */
+#endif /* H5_HAVE_AVX2_DISPATCH */
+
 /*-------------------------------------------------------------------------
  * Function:	H5_checksum_fletcher32
  *
@@ -89,6 +332,9 @@ static hbool_t H5_crc_table_computed = FALSE;
  *              0xffff (for backward compatibility reasons with earlier
  *              HDF5 fletcher32 I/O filter routine, mostly).
  *
+ * Note #4:     Where the CPU has vector instructions, most of the buffer is
+ *              summed by a vector kernel, which gives the same checksum.
+ *
  * Return:	32-bit fletcher checksum of input buffer (can't fail)
  *
  * Programmer:	Quincey Koziol
@@ -109,6 +355,16 @@ H5_checksum_fletcher32(const void *_data, size_t _len)
     HDassert(_data);
     HDassert(_len > 0);
 
+    /* Sum as much as possible a vector at a time */
+    if (!H5_checksum_kernels_init_g)
+        H5__checksum_init_kernels();
+    if (H5_fletcher32_kernel_g) {
+        size_t nbytes = H5_fletcher32_kernel_g(data, len * 2, &sum1, &sum2); /* # of bytes summed */
+
+        data += nbytes;
+        len -= nbytes / 2;
+    } /* end if */
+
     /* Compute checksum for pairs of bytes */
     /* (the magic "360" value is is the largest number of sums that can be
      *  performed without numeric overflow)
@@ -238,6 +494,161 @@ H5_checksum_crc(const void *_data, size_t len)
                      0xffffffffL)
 } /* end H5_checksum_crc() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5__checksum_crc32c_make_table
+ *
+ * Purpose:     Compute the tables for the CRC-32C checksum algorithm.
+ *              Table K holds the CRC of each byte value followed by K
+ *              zero bytes, so that eight bytes can be added at a time
+ *              ("slicing-by-8").
+ *
+ * Return:      none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5__checksum_crc32c_make_table(void)
+{
+    uint32_t c;    /* Checksum for each byte value */
+    unsigned n, k; /* Local index variables */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Compute the checksum for each possible byte value */
+    for (n = 0; n < 256; n++) {
+        c = (uint32_t)n;
+        for (k = 0; k < 8; k++)
+            if (c & 1)
+                c = H5_CRC32C_QUOTIENT ^ (c >> 1);
+            else
+                c = c >> 1;
+        H5_crc32c_table[0][n] = c;
+    }
+
+    /* Extend each checksum by a zero byte for the next table */
+    for (k = 1; k < 8; k++)
+        for (n = 0; n < 256; n++) {
+            c                     = H5_crc32c_table[k - 1][n];
+            H5_crc32c_table[k][n] = H5_crc32c_table[0][c & 0xff] ^ (c >> 8);
+        }
+    H5_crc32c_table_computed = TRUE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5__checksum_crc32c_make_table() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5__checksum_crc32c_update
+ *
+ * Purpose:     Update a running CRC-32C with the bytes buf[0..len-1],
+ *              eight at a time with table lookups.
+ *
+ * Return:      Updated CRC (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5__checksum_crc32c_update(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Initialize the CRC tables if necessary */
+    if (!H5_crc32c_table_computed)
+        H5__checksum_crc32c_make_table();
+
+    /* Update the CRC eight bytes at a time */
+    while (len >= 8) {
+        uint32_t lo = crc ^ ((uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) |
+                             ((uint32_t)buf[3] << 24));
+
+        crc = H5_crc32c_table[7][lo & 0xff] ^ H5_crc32c_table[6][(lo >> 8) & 0xff] ^
+              H5_crc32c_table[5][(lo >> 16) & 0xff] ^ H5_crc32c_table[4][lo >> 24] ^
+              H5_crc32c_table[3][buf[4]] ^ H5_crc32c_table[2][buf[5]] ^ H5_crc32c_table[1][buf[6]] ^
+              H5_crc32c_table[0][buf[7]];
+        buf += 8;
+        len -= 8;
+    } /* end while */
+
+    /* Update the CRC with the remaining bytes */
+    while (len--)
+        crc = H5_crc32c_table[0][(crc ^ *buf++) & 0xff] ^ (crc >> 8);
+
+    FUNC_LEAVE_NOAPI(crc)
+} /* end H5__checksum_crc32c_update() */
+
+#ifdef H5_HAVE_SSE42_DISPATCH
+/*-------------------------------------------------------------------------
+ * Function:    H5__checksum_crc32c_update_sse42
+ *
+ * Purpose:     Update a running CRC-32C with the bytes buf[0..len-1],
+ *              with the SSE4.2 CRC32 instruction.
+ *
+ * Return:      Updated CRC (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_CHECKSUM_SSE42 static uint32_t
+H5__checksum_crc32c_update_sse42(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    uint32_t ret_value = crc; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef __x86_64__
+    {
+        uint64_t crc64 = ret_value; /* CRC, as the 64-bit instruction takes it */
+
+        while (len >= 8) {
+            uint64_t word;
+
+            HDmemcpy(&word, buf, sizeof(word));
+            crc64 = _mm_crc32_u64(crc64, word);
+            buf += 8;
+            len -= 8;
+        } /* end while */
+        ret_value = (uint32_t)crc64;
+    }
+#endif /* __x86_64__ */
+    while (len >= 4) {
+        uint32_t word;
+
+        HDmemcpy(&word, buf, sizeof(word));
+        ret_value = _mm_crc32_u32(ret_value, word);
+        buf += 4;
+        len -= 4;
+    } /* end while */
+    while (len--)
+        ret_value = _mm_crc32_u8(ret_value, *buf++);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5__checksum_crc32c_update_sse42() */
+#endif /* H5_HAVE_SSE42_DISPATCH */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_checksum_crc32c
+ *
+ * Purpose:     Compute the CRC-32C (Castagnoli) checksum of a buffer, as
+ *              used by iSCSI, ext4 and others, with the CPU's CRC
+ *              instructions if it has them.
+ *
+ * Return:      32-bit CRC-32C checksum of input buffer (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+uint32_t
+H5_checksum_crc32c(const void *_data, size_t len)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(_data);
+    HDassert(len > 0);
+
+    if (!H5_checksum_kernels_init_g)
+        H5__checksum_init_kernels();
+
+    FUNC_LEAVE_NOAPI(H5_crc32c_update_g((uint32_t)0xffffffffL, (const uint8_t *)_data, len) ^ 0xffffffffL)
+} /* end H5_checksum_crc32c() */
+
 /*
 -------------------------------------------------------------------------------
 H5_lookup3_mix -- mix 3 32-bit values reversibly.
@@ -392,6 +803,15 @@ H5_checksum_lookup3(const void *key, size_t length, uint32_t initval)
 
     /*--------------- all but the last block: affect some 32 bits of (a,b,c) */
     while (length > 12) {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        /* The words are little-endian, as the host's are */
+        uint32_t w[3];
+
+        HDmemcpy(w, k, sizeof(w));
+        a += w[0];
+        b += w[1];
+        c += w[2];
+#else
         a += k[0];
         a += ((uint32_t)k[1]) << 8;
         a += ((uint32_t)k[2]) << 16;
@@ -404,6 +824,7 @@ H5_checksum_lookup3(const void *key, size_t length, uint32_t initval)
         c += ((uint32_t)k[9]) << 8;
         c += ((uint32_t)k[10]) << 16;
         c += ((uint32_t)k[11]) << 24;
+#endif
         H5_lookup3_mix(a, b, c);
         length -= 12;
         k += 12;
@@ -122,6 +122,20 @@
 #include <sys/file.h>
 #endif
 
+/*
+ * preadv() & pwritev() in sys/uio.h are used for vector I/O in some VFDs.
+ */
+#if defined(H5_HAVE_PREADWRITEV) && defined(H5_HAVE_SYS_UIO_H)
+#include <sys/uio.h>
+#endif
+
+/*
+ * mmap() & madvise() in sys/mman.h are used by the read-only mmap VFD.
+ */
+#ifdef H5_HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
 /*
  * Resource usage is not Posix.1 but HDF5 uses it anyway for some performance
  * and debugging code if available.
@@ -1174,6 +1188,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDlseek
 #define HDlseek(F, O, W) lseek(F, O, W)
 #endif /* HDlseek */
+#ifndef HDmadvise
+#define HDmadvise(A, L, F) madvise(A, L, F)
+#endif /* HDmadvise */
 #ifndef HDmalloc
 #define HDmalloc(Z) malloc(Z)
 #endif /* HDmalloc */
@@ -1213,9 +1230,15 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDmktime
 #define HDmktime(T) mktime(T)
 #endif /* HDmktime */
+#ifndef HDmmap
+#define HDmmap(A, L, P, F, D, O) mmap(A, L, P, F, D, O)
+#endif /* HDmmap */
 #ifndef HDmodf
 #define HDmodf(X, Y) modf(X, Y)
 #endif /* HDmodf */
+#ifndef HDmunmap
+#define HDmunmap(A, L) munmap(A, L)
+#endif /* HDmunmap */
 #ifndef HDnanosleep
 #define HDnanosleep(N, O) nanosleep(N, O)
 #endif /* HDnanosleep */
@@ -1252,6 +1275,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpread
 #define HDpread(F, B, C, O) pread(F, B, C, O)
 #endif /* HDpread */
+#ifndef HDpreadv
+#define HDpreadv(F, V, C, O) preadv(F, V, C, O)
+#endif /* HDpreadv */
 #ifndef HDprintf
 #define HDprintf printf
 #endif /* HDprintf */
@@ -1267,6 +1293,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpwrite
 #define HDpwrite(F, B, C, O) pwrite(F, B, C, O)
 #endif /* HDpwrite */
+#ifndef HDpwritev
+#define HDpwritev(F, V, C, O) pwritev(F, V, C, O)
+#endif /* HDpwritev */
 #ifndef HDqsort
 #define HDqsort(M, N, Z, F) qsort(M, N, Z, F)
 #endif /* HDqsort*/
@@ -2010,9 +2039,10 @@ extern char H5_lib_vers_info_g[];
 
 /* replacement structure for original global variable */
 typedef struct H5_api_struct {
-    H5TS_mutex_t init_lock;    /* API entrance mutex */
-    hbool_t      H5_libinit_g; /* Has the library been initialized? */
-    hbool_t      H5_libterm_g; /* Is the library being shutdown? */
+    H5TS_mutex_t   init_lock;    /* API entrance mutex */
+    H5TS_rw_lock_t api_rw_lock;  /* API shared/exclusive lock, taken before init_lock */
+    hbool_t        H5_libinit_g; /* Has the library been initialized? */
+    hbool_t        H5_libterm_g; /* Is the library being shutdown? */
 } H5_api_t;
 
 /* Macros for accessing the global variables */
@@ -2026,9 +2056,66 @@ typedef struct H5_api_struct {
 #define H5_FIRST_THREAD_INIT pthread_once(&H5TS_first_init_g, H5TS_pthread_first_thread_init);
 #endif
 
-/* Macros for threadsafe HDF-5 Phase I locks */
-#define H5_API_LOCK   H5TS_mutex_lock(&H5_g.init_lock);
-#define H5_API_UNLOCK H5TS_mutex_unlock(&H5_g.init_lock);
+/* Macros for threadsafe HDF-5 Phase I locks.  API routines that only read
+ * take the API reader/writer lock shared, the others exclusively; either way
+ * library internals are still serialized by the API mutex.  A thread that
+ * holds the API shared (in a callback from a routine that only reads) upgrades
+ * it for routines that don't, waiting for the other threads to leave the API
+ * or to give up their shared holds (see H5TS_rw_wrlock).  Should that fail,
+ * the thread goes on holding it shared and H5_API_CHECK_EXCLUSIVE fails the
+ * routine.  Routines that only serve an outer call or work on the thread's
+ * error stacks (see FUNC_ENTER_API_NOINIT and FUNC_ENTER_API_NOCLEAR) keep
+ * holding it the way the thread does.
+ */
+#define H5_API_LOCK                                                                                          \
+    if (!H5TS_rw_lock_shared(&H5_g.api_rw_lock))                                                             \
+        H5TS_rw_wrlock(&H5_g.api_rw_lock);                                                                   \
+    else if (H5TS_rw_upgrade(&H5_g.api_rw_lock, &H5_g.init_lock) != 0)                                      \
+        H5TS_rw_rdlock(&H5_g.api_rw_lock);                                                                   \
+    H5TS_mutex_lock(&H5_g.init_lock);
+#define H5_API_LOCK_SHARED                                                                                   \
+    H5TS_rw_rdlock(&H5_g.api_rw_lock);                                                                       \
+    H5TS_mutex_lock(&H5_g.init_lock);
+#define H5_API_LOCK_NESTED                                                                                   \
+    if (!H5TS_rw_lock_shared(&H5_g.api_rw_lock))                                                             \
+        H5TS_rw_wrlock(&H5_g.api_rw_lock);                                                                   \
+    else                                                                                                     \
+        H5TS_rw_rdlock(&H5_g.api_rw_lock);                                                                   \
+    H5TS_mutex_lock(&H5_g.init_lock);
+#define H5_API_UNLOCK                                                                                        \
+    H5TS_mutex_unlock(&H5_g.init_lock);                                                                      \
+    H5TS_rw_unlock(&H5_g.api_rw_lock);
+#define H5_API_CHECK_EXCLUSIVE(err)                                                                          \
+    if (H5TS_rw_lock_shared(&H5_g.api_rw_lock))                                                              \
+        HGOTO_ERROR(H5E_FUNC, H5E_CANTLOCK, err, "can't take the API lock exclusively")
+
+/* Macros for giving up the API lock around work that touches no shared state,
+ * and for briefly taking it back (only) in a thread that has given it up */
+#define H5_API_LOCK_RELEASE(released)   H5TS_mutex_release(&H5_g.init_lock, &(released));
+#define H5_API_LOCK_REACQUIRE(released) H5TS_mutex_reacquire(&H5_g.init_lock, (released));
+#define H5_API_RELOCK(relocked)                                                                              \
+    if (((relocked) = H5TS_mutex_released(&H5_g.init_lock)))                                                 \
+        H5TS_mutex_lock(&H5_g.init_lock);
+#define H5_API_RELOCK_END(relocked)                                                                          \
+    if (relocked)                                                                                            \
+        H5TS_mutex_unlock(&H5_g.init_lock);
+
+/* Macros for API routines that only read what the library keeps readable
+ * without the API lock, falling back to the lock where atomic operations
+ * aren't available */
+#ifdef H5TS_HAVE_EPOCHS
+#define H5_API_READ_BEGIN(err)                                                                               \
+    if (H5TS_epoch_enter() < 0)                                                                              \
+        return (err);
+#define H5_API_READ_END H5TS_epoch_exit();
+#else /* H5TS_HAVE_EPOCHS */
+#define H5_API_READ_BEGIN(err)                                                                               \
+    H5_API_UNSET_CANCEL                                                                                      \
+    H5_API_LOCK_SHARED
+#define H5_API_READ_END                                                                                      \
+    H5_API_UNLOCK                                                                                            \
+    H5_API_SET_CANCEL
+#endif /* H5TS_HAVE_EPOCHS */
 
 /* Macros for thread cancellation-safe mechanism */
 #define H5_API_UNSET_CANCEL H5TS_cancel_count_inc();
@@ -2044,7 +2131,16 @@ extern H5_api_t H5_g;
 
 /* disable locks (sequential version) */
 #define H5_API_LOCK
+#define H5_API_LOCK_SHARED
+#define H5_API_LOCK_NESTED
 #define H5_API_UNLOCK
+#define H5_API_CHECK_EXCLUSIVE(err)
+#define H5_API_LOCK_RELEASE(released)
+#define H5_API_LOCK_REACQUIRE(released)
+#define H5_API_RELOCK(relocked)
+#define H5_API_RELOCK_END(relocked)
+#define H5_API_READ_BEGIN(err)
+#define H5_API_READ_END
 
 /* disable cancelability (sequential version) */
 #define H5_API_UNSET_CANCEL
@@ -2143,6 +2239,32 @@ H5_DLL herr_t H5CX_pop(void);
     H5_API_UNSET_CANCEL                                                                                      \
     H5_API_LOCK
 
+/* Threadsafety initialization code for read-only API routines */
+#define FUNC_ENTER_API_THREADSAFE_SHARED                                                                     \
+    /* Initialize the thread-safe code */                                                                    \
+    H5_FIRST_THREAD_INIT                                                                                     \
+                                                                                                             \
+    /* Grab the mutex for the library, sharing the API with other readers */                                 \
+    H5_API_UNSET_CANCEL                                                                                      \
+    H5_API_LOCK_SHARED
+
+/* Threadsafety initialization code for API routines that serve an outer call */
+#define FUNC_ENTER_API_THREADSAFE_NESTED                                                                     \
+    /* Initialize the thread-safe code */                                                                    \
+    H5_FIRST_THREAD_INIT                                                                                     \
+                                                                                                             \
+    /* Grab the mutex for the library, holding the API the way the outer call does */                        \
+    H5_API_UNSET_CANCEL                                                                                      \
+    H5_API_LOCK_NESTED
+
+/* Threadsafety initialization code for API routines that don't take the API lock */
+#define FUNC_ENTER_API_THREADSAFE_NOLOCK(err)                                                                \
+    /* Initialize the thread-safe code */                                                                    \
+    H5_FIRST_THREAD_INIT                                                                                     \
+                                                                                                             \
+    /* Start reading without the mutex for the library, where possible */                                    \
+    H5_API_READ_BEGIN(err)
+
 /* Local variables for API routines */
 #define FUNC_ENTER_API_VARS                                                                                  \
     MPE_LOG_VARS                                                                                             \
@@ -2183,16 +2305,43 @@ H5_DLL herr_t H5CX_pop(void);
             FUNC_ENTER_API_PUSH(err);                                                                        \
             /* Clear thread error stack entering public functions */                                         \
             H5E_clear_stack(NULL);                                                                           \
+            H5_API_CHECK_EXCLUSIVE(err)                                                                      \
+            {
+
+/*
+ * Use this macro for "normal" API functions that only read from files and
+ *      objects, like H5Dread and H5Literate2.  They share the API with each
+ *      other, and are kept apart from all other API functions.
+ *
+ *      (Callbacks made from them run with the API shared, too.  Other API
+ *      functions called from those callbacks wait for the other threads to
+ *      leave the API, see H5_API_LOCK.)
+ */
+#define FUNC_ENTER_API_SHARED(err)                                                                           \
+    {                                                                                                        \
+        {                                                                                                    \
+            FUNC_ENTER_API_VARS                                                                              \
+            FUNC_ENTER_COMMON(H5_IS_API(FUNC));                                                              \
+            FUNC_ENTER_API_THREADSAFE_SHARED;                                                                \
+            FUNC_ENTER_API_INIT(err);                                                                        \
+            FUNC_ENTER_API_PUSH(err);                                                                        \
+            /* Clear thread error stack entering public functions */                                         \
+            H5E_clear_stack(NULL);                                                                           \
             {
 
 /*
  * Use this macro for API functions that shouldn't clear the error stack
  *      like H5Eprint and H5Ewalk.
+ *
+ *      (They work on the calling thread's error stacks, so called from a
+ *      routine that shares the API, they share it, too.)
  */
 #define FUNC_ENTER_API_NOCLEAR(err)                                                                          \
     {                                                                                                        \
         {                                                                                                    \
-            FUNC_ENTER_API_COMMON                                                                            \
+            FUNC_ENTER_API_VARS                                                                              \
+            FUNC_ENTER_COMMON(H5_IS_API(FUNC));                                                              \
+            FUNC_ENTER_API_THREADSAFE_NESTED;                                                                \
             FUNC_ENTER_API_INIT(err);                                                                        \
             FUNC_ENTER_API_PUSH(err);                                                                        \
             {
@@ -2203,12 +2352,15 @@ H5_DLL herr_t H5CX_pop(void);
  *      are: H5allocate_memory, H5is_library_threadsafe, public VOL callback
  *      wrappers (e.g. H5VLfile_create, H5VLdataset_read, etc.), etc.
  *
+ *      (Called from a routine that shares the API, they share it, too.)
  */
 #define FUNC_ENTER_API_NOINIT                                                                                \
     {                                                                                                        \
         {                                                                                                    \
             {                                                                                                \
-                FUNC_ENTER_API_COMMON                                                                        \
+                FUNC_ENTER_API_VARS                                                                          \
+                FUNC_ENTER_COMMON(H5_IS_API(FUNC));                                                          \
+                FUNC_ENTER_API_THREADSAFE_NESTED;                                                            \
                 H5_PUSH_FUNC                                                                                 \
                 BEGIN_MPE_LOG                                                                                \
                 {
@@ -2227,7 +2379,25 @@ H5_DLL herr_t H5CX_pop(void);
                 {                                                                                            \
                     FUNC_ENTER_API_VARS                                                                      \
                     FUNC_ENTER_COMMON_NOERR(H5_IS_API(FUNC));                                                \
-                    FUNC_ENTER_API_THREADSAFE;                                                               \
+                    FUNC_ENTER_API_THREADSAFE_NESTED;                                                        \
+                    BEGIN_MPE_LOG                                                                            \
+                    {
+
+/*
+ * Use this macro for API functions that shouldn't perform _any_ initialization
+ *      of the library or an interface or push themselves on the function
+ *      stack, and that only look up IDs without the API lock, where the
+ *      library allows it.  Examples are: H5Iis_valid, H5Iget_type.
+ *
+ */
+#define FUNC_ENTER_API_NOLOCK(err)                                                                           \
+    {                                                                                                        \
+        {                                                                                                    \
+            {                                                                                                \
+                {                                                                                            \
+                    FUNC_ENTER_API_VARS                                                                      \
+                    FUNC_ENTER_COMMON_NOERR(H5_IS_API(FUNC));                                                \
+                    FUNC_ENTER_API_THREADSAFE_NOLOCK(err);                                                   \
                     BEGIN_MPE_LOG                                                                            \
                     {
 
@@ -2457,6 +2627,16 @@ H5_DLL herr_t H5CX_pop(void);
     }                                                                                                        \
     } /*end scope from beginning of FUNC_ENTER*/
 
+/* Use this macro to match the FUNC_ENTER_API_NOLOCK macro */
+#define FUNC_LEAVE_API_NOLOCK(ret_value)                                                                     \
+    FUNC_LEAVE_API_COMMON(ret_value);                                                                        \
+    H5_API_READ_END                                                                                          \
+    return (ret_value);                                                                                      \
+    }                                                                                                        \
+    }                                                                                                        \
+    }                                                                                                        \
+    } /*end scope from beginning of FUNC_ENTER*/
+
 /* Use this macro to match the FUNC_ENTER_API_NOPUSH macro */
 #define FUNC_LEAVE_API_NOPUSH(ret_value)                                                                     \
     ;                                                                                                        \
@@ -2812,6 +2992,7 @@ H5_DLL int H5Z_term_package(void);
 /* Checksum functions */
 H5_DLL uint32_t H5_checksum_fletcher32(const void *data, size_t len);
 H5_DLL uint32_t H5_checksum_crc(const void *data, size_t len);
+H5_DLL uint32_t H5_checksum_crc32c(const void *data, size_t len);
 H5_DLL uint32_t H5_checksum_lookup3(const void *data, size_t len, uint32_t initval);
 H5_DLL uint32_t H5_checksum_metadata(const void *data, size_t len, uint32_t initval);
 H5_DLL uint32_t H5_hash_string(const char *str);
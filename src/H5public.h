@@ -366,6 +366,26 @@ typedef struct H5_alloc_stats_t {
     size_t             peak_alloc_blocks_count;  /* Peak # of blocks allocated */
 } H5_alloc_stats_t;
 
+/*
+ * Free list statistics info struct
+ */
+typedef struct H5_free_list_stats_t {
+    unsigned long long reg_alloc_count;         /* Running count of allocations from "regular" free lists */
+    unsigned long long reg_reuse_count;         /* Running count of those reusing freed blocks */
+    size_t             reg_bytes_held;          /* Current # of freed bytes held on "regular" free lists */
+    unsigned long long arr_alloc_count;         /* Running count of allocations from "array" free lists */
+    unsigned long long arr_reuse_count;         /* Running count of those reusing freed blocks */
+    size_t             arr_bytes_held;          /* Current # of freed bytes held on "array" free lists */
+    unsigned long long blk_alloc_count;         /* Running count of allocations from "block" free lists */
+    unsigned long long blk_reuse_count;         /* Running count of those reusing freed blocks */
+    size_t             blk_bytes_held;          /* Current # of freed bytes held on "block" free lists */
+    unsigned long long fac_alloc_count;         /* Running count of allocations from "factory" free lists */
+    unsigned long long fac_reuse_count;         /* Running count of those reusing freed blocks */
+    size_t             fac_bytes_held;          /* Current # of freed bytes held on "factory" free lists */
+    unsigned long long thread_cache_hit_count;  /* Running count of reuses served by a per-thread cache */
+    size_t             thread_cache_bytes_held; /* Current # of those bytes held in per-thread caches */
+} H5_free_list_stats_t;
+
 /* Functions in H5.c */
 H5_DLL herr_t H5open(void);
 H5_DLL herr_t H5close(void);
@@ -375,6 +395,7 @@ H5_DLL herr_t H5set_free_list_limits(int reg_global_lim, int reg_list_lim, int a
                                      int arr_list_lim, int blk_global_lim, int blk_list_lim);
 H5_DLL herr_t H5get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size, size_t *fac_size);
 H5_DLL herr_t H5get_alloc_stats(H5_alloc_stats_t *stats);
+H5_DLL herr_t H5get_free_list_stats(H5_free_list_stats_t *stats);
 H5_DLL herr_t H5get_libversion(unsigned *majnum, unsigned *minnum, unsigned *relnum);
 H5_DLL herr_t H5check_version(unsigned majnum, unsigned minnum, unsigned relnum);
 H5_DLL herr_t H5is_library_threadsafe(hbool_t *is_ts);
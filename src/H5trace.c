@@ -39,8 +39,9 @@
 #include "H5MMprivate.h" /* Memory management                        */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
-#ifdef H5_HAVE_PARALLEL
 /* datatypes of predefined drivers needed by H5_trace() */
+#include "H5FDmmap.h"
+#ifdef H5_HAVE_PARALLEL
 #include "H5FDmpio.h"
 #endif /* H5_HAVE_PARALLEL */
 
@@ -589,6 +590,40 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                         }     /* end else */
                         break;
 
+                    case 'm':
+                        if (ptr) {
+                            if (vp)
+                                HDfprintf(out, "0x%p", vp);
+                            else
+                                HDfprintf(out, "NULL");
+                        } /* end if */
+                        else {
+                            H5FD_mmap_advice_t advice = (H5FD_mmap_advice_t)HDva_arg(ap, int);
+
+                            switch (advice) {
+                                case H5FD_MMAP_ADVICE_NORMAL:
+                                    HDfprintf(out, "H5FD_MMAP_ADVICE_NORMAL");
+                                    break;
+
+                                case H5FD_MMAP_ADVICE_SEQUENTIAL:
+                                    HDfprintf(out, "H5FD_MMAP_ADVICE_SEQUENTIAL");
+                                    break;
+
+                                case H5FD_MMAP_ADVICE_RANDOM:
+                                    HDfprintf(out, "H5FD_MMAP_ADVICE_RANDOM");
+                                    break;
+
+                                case H5FD_MMAP_ADVICE_WILLNEED:
+                                    HDfprintf(out, "H5FD_MMAP_ADVICE_WILLNEED");
+                                    break;
+
+                                default:
+                                    HDfprintf(out, "%ld", (long)advice);
+                                    break;
+                            } /* end switch */
+                        }     /* end else */
+                        break;
+
                     case 'n':
                         if (ptr) {
                             if (vp)
@@ -3414,6 +3449,9 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                                 case H5VL_NATIVE_FILE_POST_OPEN:
                                     HDfprintf(out, "H5VL_NATIVE_FILE_POST_OPEN");
                                     break;
+                                case H5VL_NATIVE_FILE_GET_SHARED_CHUNK_CACHE_STATS:
+                                    HDfprintf(out, "H5VL_NATIVE_FILE_GET_SHARED_CHUNK_CACHE_STATS");
+                                    break;
                                 default:
                                     HDfprintf(out, "%ld", (long)optional);
                                     break;
@@ -83,6 +83,13 @@ const char *FILENAME[] = {"dataset",             /* 0 */
                           "power2up",            /* 24 */
                           "version_bounds",      /* 25 */
                           "alloc_0sized",        /* 26 */
+                          "filter_nthreads",     /* 27 */
+                          "chunk_prefetch",      /* 28 */
+                          "chunk_cache_slots",   /* 29 */
+                          "chunk_cache_shared",  /* 30 */
+                          "multi_dset_io",       /* 31 */
+                          "chunk_pin",           /* 32 */
+                          "filter_block_size",   /* 33 */
                           NULL};
 
 #define OHMIN_FILENAME_A "ohdr_min_a"
@@ -103,15 +110,26 @@ const char *FILENAME[] = {"dataset",             /* 0 */
 #define DSET_COMPACT_MAX2_NAME    "max_compact_2"
 #define DSET_CONV_BUF_NAME        "conv_buf"
 #define DSET_TCONV_NAME           "tconv"
+#define DSET_TCONV_IN_PLACE_NAME  "tconv_in_place"
 #define DSET_DEFLATE_NAME         "deflate"
 #define DSET_SHUFFLE_NAME         "shuffle"
 #define DSET_FLETCHER32_NAME      "fletcher32"
 #define DSET_FLETCHER32_NAME_2    "fletcher32_2"
 #define DSET_FLETCHER32_NAME_3    "fletcher32_3"
+#define DSET_CRC32C_NAME          "crc32c"
+#define DSET_CRC32C_NAME_2        "crc32c_2"
+#define DSET_CRC32C_NAME_3        "crc32c_3"
 #define DSET_SHUF_DEF_FLET_NAME   "shuffle+deflate+fletcher32"
 #define DSET_SHUF_DEF_FLET_NAME_2 "shuffle+deflate+fletcher32_2"
 #define DSET_OPTIONAL_SCALAR      "dataset_with_scalar_space"
 #define DSET_OPTIONAL_VLEN        "dataset_with_vlen_type"
+#ifdef H5_HAVE_FILTER_ZSTD
+#define DSET_ZSTD_NAME "zstd"
+#endif /* H5_HAVE_FILTER_ZSTD */
+#ifdef H5_HAVE_FILTER_LZ4
+#define DSET_LZ4_NAME        "lz4"
+#define DSET_LZ4_BLOCKS_NAME "lz4_blocks"
+#endif /* H5_HAVE_FILTER_LZ4 */
 #ifdef H5_HAVE_FILTER_SZIP
 #define DSET_SZIP_NAME             "szip"
 #define DSET_SHUF_SZIP_FLET_NAME   "shuffle+szip+fletcher32"
@@ -185,6 +203,7 @@ const char *FILENAME[] = {"dataset",             /* 0 */
 #define H5Z_FILTER_EXPAND          310
 #define H5Z_FILTER_CAN_APPLY_TEST2 311
 #define H5Z_FILTER_COUNT           312
+#define H5Z_FILTER_API_CALL        313
 
 /* Flags for testing filters */
 #define DISABLE_FLETCHER32 0
@@ -259,6 +278,48 @@ const char *FILENAME[] = {"dataset",             /* 0 */
 #define BYPASS_CHUNK_DIM  500
 #define BYPASS_FILL_VALUE 7
 
+/* Parameters for testing the filter pipeline thread count */
+#define FILTER_NTHREADS_DSET1     "small_cache"
+#define FILTER_NTHREADS_DSET2     "default_cache"
+#define FILTER_NTHREADS_DSET3     "api_call_filter"
+#define FILTER_NTHREADS_DIM       (64 * 1024)
+#define FILTER_NTHREADS_CHUNK_DIM 1024
+#define FILTER_NTHREADS_NTHREADS  4
+
+/* Parameters for testing chunk read-ahead */
+#define CHUNK_PREFETCH_DSET      "dset"
+#define CHUNK_PREFETCH_DIM       64
+#define CHUNK_PREFETCH_CHUNK_DIM 8
+#define CHUNK_PREFETCH_NCHUNKS   4
+
+/* Parameters for testing the chunk cache's hash table */
+#define CACHE_SLOTS_DIM       64
+#define CACHE_SLOTS_CHUNK_DIM 4
+#define CACHE_SLOTS_NCHUNKS   ((CACHE_SLOTS_DIM * CACHE_SLOTS_DIM) / (CACHE_SLOTS_CHUNK_DIM * CACHE_SLOTS_CHUNK_DIM))
+
+/* Parameters for testing the chunk cache shared by a file's datasets */
+#define CACHE_SHARED_NDSETS    4
+#define CACHE_SHARED_DIM       64
+#define CACHE_SHARED_CHUNK_DIM 16
+#define CACHE_SHARED_NBYTES    (4 * CACHE_SHARED_CHUNK_DIM * sizeof(int))
+
+/* Parameters for testing multi-dataset I/O */
+#define MULTI_NDSETS 6
+#define MULTI_DIM    64
+
+/* Parameters for testing pinning chunks */
+#define CHUNK_PIN_DIM0      30
+#define CHUNK_PIN_DIM1      32
+#define CHUNK_PIN_CHUNK_DIM 8
+#define CHUNK_PIN_NBYTES    (4 * CHUNK_PIN_CHUNK_DIM * CHUNK_PIN_CHUNK_DIM * sizeof(int))
+
+/* Parameters for testing compressing blocks of a chunk with the filter threads */
+#define FILTER_BLOCK_DSET1      "uncached"
+#define FILTER_BLOCK_DSET2      "cached"
+#define FILTER_BLOCK_DIM        (512 * 1024)
+#define FILTER_BLOCK_NTHREADS   4
+#define FILTER_BLOCK_BLOCK_SIZE (64 * 1024)
+
 /* Parameters for testing extensible array chunk indices */
 #define EARRAY_MAX_RANK    3
 #define EARRAY_DSET_DIM    15
@@ -316,6 +377,8 @@ static size_t filter_expand(unsigned int flags, size_t cd_nelmts, const unsigned
                             size_t nbytes, size_t *buf_size, void **buf);
 static size_t filter_count(unsigned int flags, size_t cd_nelmts, const unsigned int *cd_values, size_t nbytes,
                            size_t *buf_size, void **buf);
+static size_t filter_api_call(unsigned int flags, size_t cd_nelmts, const unsigned int *cd_values,
+                              size_t nbytes, size_t *buf_size, void **buf);
 
 /* This message derives from H5Z */
 const H5Z_class2_t H5Z_COUNT[1] = {{
@@ -352,6 +415,38 @@ filter_count(unsigned int flags, size_t H5_ATTR_UNUSED cd_nelmts,
     return nbytes;
 } /* end filter_count() */
 
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_API_CALL[1] = {{
+    H5Z_CLASS_T_VERS,    /* H5Z_class_t version */
+    H5Z_FILTER_API_CALL, /* Filter id number */
+    1, 1,                /* Encoding and decoding enabled */
+    "api_call",          /* Filter name for debugging */
+    NULL,                /* The "can apply" callback */
+    NULL,                /* The "set local" callback */
+    filter_api_call,     /* The actual filter function */
+}};
+
+/*-------------------------------------------------------------------------
+ * Function:    filter_api_call
+ *
+ * Purpose:     This filter leaves the data alone, but calls into the
+ *              library, as application filters are allowed to.
+ *
+ * Return:      Success:        Data chunk size
+ *              Failure:        0
+ *-------------------------------------------------------------------------
+ */
+static size_t
+filter_api_call(unsigned int H5_ATTR_UNUSED flags, size_t H5_ATTR_UNUSED cd_nelmts,
+                const unsigned int H5_ATTR_UNUSED *cd_values, size_t nbytes, size_t H5_ATTR_UNUSED *buf_size,
+                void H5_ATTR_UNUSED **buf)
+{
+    if (H5Tget_size(H5T_NATIVE_INT) != sizeof(int))
+        return 0;
+
+    return nbytes;
+} /* end filter_api_call() */
+
 /*-------------------------------------------------------------------------
  * Function:  test_create
  *
@@ -1595,6 +1690,159 @@ error:
     return FAIL;
 } /* end test_tconv() */
 
+/*-------------------------------------------------------------------------
+ * Function:  test_tconv_in_place
+ *
+ * Purpose:   Test reading numbers that are converted to larger types,
+ *            which happens in the application's buffer when the memory
+ *            selection is contiguous, and in the type conversion buffer
+ *            when it isn't.
+ *
+ * Return:    Success:    0
+ *            Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+#define TCONV_IN_PLACE_NELMTS 100000
+#define TCONV_IN_PLACE_SKIP   10
+static herr_t
+test_tconv_in_place(hid_t file)
+{
+    short * out = NULL;
+    double *in_d = NULL;
+    int *   in_i = NULL;
+    hsize_t dims[1], start[1], stride[1], count[1];
+    hid_t   space = -1, mem_space = -1, dxpl = -1, dataset = -1;
+    int     i;
+
+    TESTING("data type conversion in the application's buffer");
+
+    if (NULL == (out = (short *)HDmalloc(TCONV_IN_PLACE_NELMTS * sizeof(short))))
+        TEST_ERROR
+    if (NULL == (in_d = (double *)HDmalloc(2 * TCONV_IN_PLACE_NELMTS * sizeof(double))))
+        TEST_ERROR
+    if (NULL == (in_i = (int *)HDmalloc(TCONV_IN_PLACE_NELMTS * sizeof(int))))
+        TEST_ERROR
+    for (i = 0; i < TCONV_IN_PLACE_NELMTS; i++)
+        out[i] = (short)((i % 30000) - 15000);
+
+    /* Store the numbers big-endian, so that reading them swaps them too */
+    dims[0] = TCONV_IN_PLACE_NELMTS;
+    if ((space = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((dataset = H5Dcreate2(file, DSET_TCONV_IN_PLACE_NAME, H5T_STD_I16BE, space, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dataset, H5T_NATIVE_SHORT, H5S_ALL, H5S_ALL, H5P_DEFAULT, out) < 0)
+        TEST_ERROR
+
+    /* Use a small type conversion buffer, so that the reads that need it
+     * go through it in many strips */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pset_buffer(dxpl, (size_t)4096, NULL, NULL) < 0)
+        TEST_ERROR
+
+    /* Read all of the elements, into a contiguous buffer */
+    if (H5Dread(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl, in_d) < 0)
+        TEST_ERROR
+    for (i = 0; i < TCONV_IN_PLACE_NELMTS; i++)
+        if (!H5_DBL_ABS_EQUAL(in_d[i], (double)out[i])) {
+            H5_FAILED();
+            HDprintf("    element %d read as double is %g, not %d\n", i, in_d[i], (int)out[i]);
+            goto error;
+        } /* end if */
+
+    /* Read all but the first and last few elements into the middle of a
+     * buffer, with a data transform */
+    start[0] = TCONV_IN_PLACE_SKIP;
+    count[0] = TCONV_IN_PLACE_NELMTS - 2 * TCONV_IN_PLACE_SKIP;
+    if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    if ((mem_space = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    start[0] = TCONV_IN_PLACE_SKIP / 2;
+    if (H5Sselect_hyperslab(mem_space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    if (H5Pset_data_transform(dxpl, "2*x+1") < 0)
+        TEST_ERROR
+    for (i = 0; i < TCONV_IN_PLACE_NELMTS; i++)
+        in_i[i] = -1;
+    if (H5Dread(dataset, H5T_NATIVE_INT, mem_space, space, dxpl, in_i) < 0)
+        TEST_ERROR
+    for (i = 0; i < TCONV_IN_PLACE_NELMTS; i++) {
+        int expect = -1; /* Expected value of the element */
+
+        if (i >= TCONV_IN_PLACE_SKIP / 2 && i < TCONV_IN_PLACE_NELMTS - 3 * TCONV_IN_PLACE_SKIP / 2)
+            expect = 2 * out[i + TCONV_IN_PLACE_SKIP / 2] + 1;
+        if (in_i[i] != expect) {
+            H5_FAILED();
+            HDprintf("    element %d read as transformed int is %d, not %d\n", i, in_i[i], expect);
+            goto error;
+        } /* end if */
+    }     /* end for */
+    if (H5Sclose(mem_space) < 0)
+        TEST_ERROR
+
+    /* Read all of the elements into every other element of a buffer, which
+     * goes through the type conversion buffer */
+    dims[0] = 2 * TCONV_IN_PLACE_NELMTS;
+    if ((mem_space = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    start[0]  = 1;
+    stride[0] = 2;
+    count[0]  = TCONV_IN_PLACE_NELMTS;
+    if (H5Sselect_hyperslab(mem_space, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        TEST_ERROR
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pset_buffer(dxpl, (size_t)4096, NULL, NULL) < 0)
+        TEST_ERROR
+    for (i = 0; i < 2 * TCONV_IN_PLACE_NELMTS; i++)
+        in_d[i] = -1.0;
+    if (H5Dread(dataset, H5T_NATIVE_DOUBLE, mem_space, H5S_ALL, dxpl, in_d) < 0)
+        TEST_ERROR
+    for (i = 0; i < TCONV_IN_PLACE_NELMTS; i++)
+        if (!H5_DBL_ABS_EQUAL(in_d[2 * i], -1.0) || !H5_DBL_ABS_EQUAL(in_d[2 * i + 1], (double)out[i])) {
+            H5_FAILED();
+            HDprintf("    element %d read into every other double is %g, not %d\n", i, in_d[2 * i + 1],
+                     (int)out[i]);
+            goto error;
+        } /* end if */
+
+    if (H5Sclose(mem_space) < 0)
+        TEST_ERROR
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+    if (H5Dclose(dataset) < 0)
+        TEST_ERROR
+    if (H5Sclose(space) < 0)
+        TEST_ERROR
+    HDfree(out);
+    HDfree(in_d);
+    HDfree(in_i);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    HDfree(out);
+    HDfree(in_d);
+    HDfree(in_i);
+
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Pclose(dxpl);
+        H5Sclose(mem_space);
+        H5Sclose(space);
+    }
+    H5E_END_TRY;
+
+    return FAIL;
+} /* end test_tconv_in_place() */
+
 /* This message derives from H5Z */
 const H5Z_class2_t H5Z_BOGUS[1] = {{
     H5Z_CLASS_T_VERS, /* H5Z_class_t version */
@@ -1838,7 +2086,7 @@ static H5Z_cb_return_t
 filter_cb_cont(H5Z_filter_t filter, void H5_ATTR_UNUSED *buf, size_t H5_ATTR_UNUSED buf_size,
                void H5_ATTR_UNUSED *op_data)
 {
-    if (H5Z_FILTER_FLETCHER32 == filter)
+    if (H5Z_FILTER_FLETCHER32 == filter || H5Z_FILTER_CRC32C == filter)
         return H5Z_CB_CONT;
     else
         return H5Z_CB_FAIL;
@@ -1856,7 +2104,7 @@ static H5Z_cb_return_t
 filter_cb_fail(H5Z_filter_t filter, void H5_ATTR_UNUSED *buf, size_t H5_ATTR_UNUSED buf_size,
                void H5_ATTR_UNUSED *op_data)
 {
-    if (H5Z_FILTER_FLETCHER32 == filter)
+    if (H5Z_FILTER_FLETCHER32 == filter || H5Z_FILTER_CRC32C == filter)
         return H5Z_CB_FAIL;
     else
         return H5Z_CB_CONT;
@@ -2450,12 +2698,22 @@ test_filters(hid_t file, hid_t
     hsize_t       null_size; /* Size of dataset with null filter */
 
     hsize_t  fletcher32_size; /* Size of dataset with Fletcher32 checksum */
+    hsize_t  crc32c_size;     /* Size of dataset with CRC-32C checksum */
     unsigned data_corrupt[3]; /* position and length of data to be corrupted */
 
 #ifdef H5_HAVE_FILTER_DEFLATE
     hsize_t deflate_size; /* Size of dataset with deflate filter */
 #endif                    /* H5_HAVE_FILTER_DEFLATE */
 
+#ifdef H5_HAVE_FILTER_ZSTD
+    hsize_t zstd_size; /* Size of dataset with zstd filter */
+#endif                 /* H5_HAVE_FILTER_ZSTD */
+
+#ifdef H5_HAVE_FILTER_LZ4
+    hsize_t  lz4_size;                  /* Size of dataset with lz4 filter */
+    unsigned lz4_cd_values[2] = {64, 0}; /* lz4 parameters, with small blocks */
+#endif                                  /* H5_HAVE_FILTER_LZ4 */
+
 #ifdef H5_HAVE_FILTER_SZIP
     hsize_t  szip_size; /* Size of dataset with szip filter */
     unsigned szip_options_mask     = H5_SZIP_NN_OPTION_MASK;
@@ -2546,6 +2804,46 @@ test_filters(hid_t file, hid_t
         goto error;
     } /* end if */
 
+    /* Clean up objects used for this test */
+    if (H5Pclose(dc) < 0)
+        goto error;
+
+    /*----------------------------------------------------------
+     * STEP 1a: Test CRC-32C Checksum by itself.
+     *----------------------------------------------------------
+     */
+    HDputs("Testing CRC-32C checksum(enabled for read)");
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+        goto error;
+    if (H5Pset_crc32c(dc) < 0)
+        goto error;
+
+    /* Enable checksum during read */
+    if (test_filter_internal(file, DSET_CRC32C_NAME, dc, ENABLE_FLETCHER32, DATA_NOT_CORRUPTED,
+                             &crc32c_size) < 0)
+        goto error;
+    if (crc32c_size != fletcher32_size) {
+        H5_FAILED();
+        HDputs("    Size after checksumming is incorrect.");
+        goto error;
+    } /* end if */
+
+    /* Disable checksum during read */
+    HDputs("Testing CRC-32C checksum(disabled for read)");
+    if (test_filter_internal(file, DSET_CRC32C_NAME_2, dc, DISABLE_FLETCHER32, DATA_NOT_CORRUPTED,
+                             &crc32c_size) < 0)
+        goto error;
+
+    /* Try to corrupt data and see if checksum fails */
+    HDputs("Testing CRC-32C checksum(when data is corrupted)");
+    if (H5Pset_filter(dc, H5Z_FILTER_CORRUPT, 0, (size_t)3, data_corrupt) < 0)
+        goto error;
+    if (test_filter_internal(file, DSET_CRC32C_NAME_3, dc, DISABLE_FLETCHER32, DATA_CORRUPTED,
+                             &crc32c_size) < 0)
+        goto error;
+
     /* Clean up objects used for this test */
     if (H5Pclose(dc) < 0)
         goto error;
@@ -2575,6 +2873,71 @@ test_filters(hid_t file, hid_t
     HDputs("    Deflate filter not enabled");
 #endif /* H5_HAVE_FILTER_DEFLATE */
 
+        /*----------------------------------------------------------
+         * STEP 2a: Test zstd compression by itself.
+         *----------------------------------------------------------
+         */
+#ifdef H5_HAVE_FILTER_ZSTD
+    HDputs("Testing zstd filter");
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+        goto error;
+    if (H5Pset_zstd(dc, 3) < 0)
+        goto error;
+
+    if (test_filter_internal(file, DSET_ZSTD_NAME, dc, DISABLE_FLETCHER32, DATA_NOT_CORRUPTED, &zstd_size) <
+        0)
+        goto error;
+    /* Clean up objects used for this test */
+    if (H5Pclose(dc) < 0)
+        goto error;
+#else  /* H5_HAVE_FILTER_ZSTD */
+    TESTING("zstd filter");
+    SKIPPED();
+    HDputs("    zstd filter not enabled");
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+        /*----------------------------------------------------------
+         * STEP 2b: Test lz4 compression by itself, with the default
+         * block size and with chunks split into several blocks.
+         *----------------------------------------------------------
+         */
+#ifdef H5_HAVE_FILTER_LZ4
+    HDputs("Testing lz4 filter");
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+        goto error;
+    if (H5Pset_lz4(dc, 0) < 0)
+        goto error;
+
+    if (test_filter_internal(file, DSET_LZ4_NAME, dc, DISABLE_FLETCHER32, DATA_NOT_CORRUPTED, &lz4_size) < 0)
+        goto error;
+    /* Clean up objects used for this test */
+    if (H5Pclose(dc) < 0)
+        goto error;
+
+    HDputs("Testing lz4 filter (small blocks)");
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+        goto error;
+    if (H5Pset_filter(dc, H5Z_FILTER_LZ4, H5Z_FLAG_OPTIONAL, NELMTS(lz4_cd_values), lz4_cd_values) < 0)
+        goto error;
+
+    if (test_filter_internal(file, DSET_LZ4_BLOCKS_NAME, dc, DISABLE_FLETCHER32, DATA_NOT_CORRUPTED,
+                             &lz4_size) < 0)
+        goto error;
+    /* Clean up objects used for this test */
+    if (H5Pclose(dc) < 0)
+        goto error;
+#else  /* H5_HAVE_FILTER_LZ4 */
+    TESTING("lz4 filter");
+    SKIPPED();
+    HDputs("    lz4 filter not enabled");
+#endif /* H5_HAVE_FILTER_LZ4 */
+
         /*----------------------------------------------------------
          * STEP 3: Test szip compression by itself.
          *----------------------------------------------------------
@@ -3122,420 +3485,695 @@ error:
 } /* end test_onebyte_shuffle() */
 
 /*-------------------------------------------------------------------------
- * Function:    test_nbit_int
+ * Function:  test_shuffle_sizes
  *
- * Purpose:     Tests the integer datatype for nbit filter
+ * Purpose:   Tests that the shuffle filter lays out the bytes of chunks
+ *            exactly as a byte at a time shuffle would, for element sizes
+ *            that are [un]shuffled with vector instructions and for ones
+ *            that aren't, and for chunks with and without a tail of
+ *            elements that don't fill a vector.
  *
- * Return:      Success:        0
- *              Failure:        -1
+ * Return:    Success:    0
+ *            Failure:    -1
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_nbit_int(hid_t file)
+test_shuffle_sizes(hid_t file)
 {
-    hid_t        dataset, datatype, mem_datatype, space, dc;
-    hsize_t      size[2]       = {2, 5};
-    hsize_t      chunk_size[2] = {2, 5};
-    int          orig_data[2][5];
-    int          new_data[2][5];
-    unsigned int mask;
-    size_t       precision, offset;
-    double       power;
-    size_t       i, j;
+    hid_t          dataset = -1, space = -1, dc = -1, type = -1;
+    const size_t   elmt_sizes[] = {1, 2, 3, 4, 8, 16};
+    const hsize_t  nelmts[]     = {5, 1003};
+    hsize_t        offset[1]    = {0};
+    hsize_t        chunk_nbytes;
+    uint32_t       filters;
+    unsigned char *orig_data = NULL, *new_data = NULL, *shuf_data = NULL, *raw_data = NULL;
+    char           name[32];
+    size_t         nbytes;
+    size_t         i, j, k, u;
 
-    HDputs("Testing nbit filter");
-    TESTING("    nbit int (setup)");
+    TESTING("shuffling with different element sizes");
 
-    /* Define dataset datatype (integer), and set precision, offset */
-    datatype  = H5Tcopy(H5T_NATIVE_INT);
-    precision = 17; /* precision includes sign bit */
-    if (H5Tset_precision(datatype, precision) < 0)
-        goto error;
-    offset = 4;
-    if (H5Tset_offset(datatype, offset) < 0)
-        goto error;
+    if (NULL == (orig_data = (unsigned char *)HDmalloc(1003 * 16)))
+        TEST_ERROR
+    if (NULL == (new_data = (unsigned char *)HDmalloc(1003 * 16)))
+        TEST_ERROR
+    if (NULL == (shuf_data = (unsigned char *)HDmalloc(1003 * 16)))
+        TEST_ERROR
+    if (NULL == (raw_data = (unsigned char *)HDmalloc(1003 * 16)))
+        TEST_ERROR
 
-    /* Copy to memory datatype before setting order */
-    mem_datatype = H5Tcopy(datatype);
+    for (i = 0; i < NELMTS(elmt_sizes); i++)
+        for (j = 0; j < NELMTS(nelmts); j++) {
+            nbytes = (size_t)nelmts[j] * elmt_sizes[i];
 
-    /* Set order of dataset datatype */
-    if (H5Tset_order(datatype, H5T_ORDER_BE) < 0)
-        goto error;
+            for (u = 0; u < nbytes; u++)
+                orig_data[u] = (unsigned char)HDrandom();
 
-    /* Create the data space */
-    if ((space = H5Screate_simple(2, size, NULL)) < 0)
-        goto error;
+            /* Shuffle the data a byte at a time, the way it should be stored */
+            if (elmt_sizes[i] > 1)
+                for (k = 0; k < (size_t)nelmts[j]; k++)
+                    for (u = 0; u < elmt_sizes[i]; u++)
+                        shuf_data[(u * (size_t)nelmts[j]) + k] = orig_data[(k * elmt_sizes[i]) + u];
+            else
+                HDmemcpy(shuf_data, orig_data, nbytes);
 
-    /* Use nbit filter  */
-    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-        goto error;
-    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
-        goto error;
-    if (H5Pset_nbit(dc) < 0)
-        goto error;
+            /* Create a dataset of a single chunk, with an opaque type of this size */
+            if ((space = H5Screate_simple(1, &nelmts[j], NULL)) < 0)
+                FAIL_STACK_ERROR
+            if ((type = H5Tcreate(H5T_OPAQUE, elmt_sizes[i])) < 0)
+                FAIL_STACK_ERROR
+            if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+                FAIL_STACK_ERROR
+            if (H5Pset_chunk(dc, 1, &nelmts[j]) < 0)
+                FAIL_STACK_ERROR
+            if (H5Pset_shuffle(dc) < 0)
+                FAIL_STACK_ERROR
+            HDsnprintf(name, sizeof(name), "shuffle_size_%u_%u", (unsigned)elmt_sizes[i],
+                       (unsigned)nelmts[j]);
+            if ((dataset = H5Dcreate2(file, name, type, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dwrite(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dflush(dataset) < 0)
+                FAIL_STACK_ERROR
 
-    /* Create the dataset */
-    if ((dataset = H5Dcreate2(file, DSET_NBIT_INT_NAME, datatype, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
-        goto error;
+            /* Check the bytes stored */
+            if (H5Dget_chunk_storage_size(dataset, offset, &chunk_nbytes) < 0)
+                FAIL_STACK_ERROR
+            if (chunk_nbytes != nbytes)
+                TEST_ERROR
+            if (H5Dread_chunk(dataset, H5P_DEFAULT, offset, &filters, raw_data) < 0)
+                FAIL_STACK_ERROR
+            if (HDmemcmp(raw_data, shuf_data, nbytes) != 0) {
+                H5_FAILED();
+                HDprintf("    Shuffled bytes differ for %u-byte elements\n", (unsigned)elmt_sizes[i]);
+                goto error;
+            }
 
-    /* Initialize data, assuming size of long long >= size of int */
-    for (i = 0; i < (size_t)size[0]; i++)
-        for (j = 0; j < (size_t)size[1]; j++) {
-            power           = HDpow(2.0f, (double)(precision - 1));
-            orig_data[i][j] = (int)(((long long)HDrandom() % (long long)power) << offset);
+            /* Check that the data unshuffles to what was written */
+            if (H5Dread(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+                FAIL_STACK_ERROR
+            if (HDmemcmp(new_data, orig_data, nbytes) != 0) {
+                H5_FAILED();
+                HDprintf("    Unshuffled bytes differ for %u-byte elements\n", (unsigned)elmt_sizes[i]);
+                goto error;
+            }
 
-            /* even-numbered values are negtive */
-            if ((i * size[1] + j + 1) % 2 == 0)
-                orig_data[i][j] = -orig_data[i][j];
-        }
+            if (H5Dclose(dataset) < 0)
+                FAIL_STACK_ERROR
+            if (H5Pclose(dc) < 0)
+                FAIL_STACK_ERROR
+            if (H5Tclose(type) < 0)
+                FAIL_STACK_ERROR
+            if (H5Sclose(space) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+
+    HDfree(orig_data);
+    HDfree(new_data);
+    HDfree(shuf_data);
+    HDfree(raw_data);
 
     PASSED();
 
-    /*----------------------------------------------------------------------
-     * STEP 1: Test nbit by setting up a chunked dataset and writing
-     * to it.
-     *----------------------------------------------------------------------
-     */
-    TESTING("    nbit int (write)");
+    return SUCCEED;
 
-    if (H5Dwrite(dataset, mem_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
-        goto error;
-    PASSED();
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Pclose(dc);
+        H5Tclose(type);
+        H5Sclose(space);
+    }
+    H5E_END_TRY;
+    HDfree(orig_data);
+    HDfree(new_data);
+    HDfree(shuf_data);
+    HDfree(raw_data);
 
-    /*----------------------------------------------------------------------
-     * STEP 2: Try to read the data we just wrote.
-     *----------------------------------------------------------------------
-     */
-    TESTING("    nbit int (read)");
+    return FAIL;
+} /* end test_shuffle_sizes() */
 
-    /* Read the dataset back */
-    if (H5Dread(dataset, mem_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
-        goto error;
+/*-------------------------------------------------------------------------
+ * Function:  test_bitshuffle
+ *
+ * Purpose:   Tests that the bitshuffle filter picks up the element size
+ *            from the datatype and lays out the bits of chunks as the
+ *            bitshuffle plugin does, for element sizes that are
+ *            transposed with vector instructions and for ones that
+ *            aren't, with full and partial blocks and elements left
+ *            over.  Blocks compressed with lz4 or zstd are checked when
+ *            the library was built with them.
+ *
+ * Return:    Success:    0
+ *            Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_bitshuffle(hid_t file)
+{
+    hid_t          dataset = -1, space = -1, dc = -1, type = -1;
+    const size_t   elmt_sizes[]  = {1, 2, 3, 4, 8, 16};
+    const hsize_t  nelmts[]      = {5, 1003};
+    const unsigned block_sizes[] = {0, 64};
+    const unsigned compressors[] = {H5Z_BITSHUFFLE_NO_COMPRESS, H5Z_BITSHUFFLE_LZ4, H5Z_BITSHUFFLE_ZSTD};
+    const int      comp_filters[] = {H5Z_FILTER_NONE, H5Z_FILTER_LZ4, H5Z_FILTER_ZSTD};
+    hsize_t        offset[1]      = {0};
+    hsize_t        chunk_nbytes;
+    uint32_t       filters;
+    unsigned       cd_values[H5Z_BITSHUFFLE_TOTAL_NPARMS];
+    size_t         cd_nelmts;
+    unsigned char *orig_data = NULL, *new_data = NULL, *shuf_data = NULL, *raw_data = NULL;
+    char           name[48];
+    size_t         nbytes, nblocked, block_size, n, start;
+    uint64_t       hdr_nbytes;
+    uint32_t       hdr_block_nbytes;
+    size_t         i, j, k, u, b, c;
+    herr_t         ret;
 
-    /* Check that the values read are the same as the values written
-     * Use mask for checking the significant bits, ignoring the padding bits
-     */
-    mask = ~((unsigned)~0 << (precision + offset)) & ((unsigned)~0 << offset);
-    for (i = 0; i < (size_t)size[0]; i++) {
-        for (j = 0; j < (size_t)size[1]; j++) {
-            if (((unsigned)new_data[i][j] & mask) != ((unsigned)orig_data[i][j] & mask)) {
-                H5_FAILED();
-                HDprintf("    Read different values than written.\n");
-                HDprintf("    At index %lu,%lu\n", (unsigned long)i, (unsigned long)j);
-                goto error;
-            }
-        }
-    }
+    TESTING("bitshuffle filter");
 
-    /*----------------------------------------------------------------------
-     * Cleanup
-     *----------------------------------------------------------------------
-     */
-    if (H5Tclose(datatype) < 0)
-        goto error;
-    if (H5Tclose(mem_datatype) < 0)
-        goto error;
+    if (NULL == (orig_data = (unsigned char *)HDmalloc(1003 * 16)))
+        TEST_ERROR
+    if (NULL == (new_data = (unsigned char *)HDmalloc(1003 * 16)))
+        TEST_ERROR
+    if (NULL == (shuf_data = (unsigned char *)HDmalloc(1003 * 16)))
+        TEST_ERROR
+    if (NULL == (raw_data = (unsigned char *)HDmalloc(1003 * 16 * 2)))
+        TEST_ERROR
+
+    /* Check the arguments are checked */
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_bitshuffle(dc, 12, H5Z_BITSHUFFLE_NO_COMPRESS);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_bitshuffle(dc, 0, 1);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
     if (H5Pclose(dc) < 0)
-        goto error;
-    if (H5Sclose(space) < 0)
-        goto error;
-    if (H5Dclose(dataset) < 0)
-        goto error;
+        FAIL_STACK_ERROR
+
+    for (i = 0; i < NELMTS(elmt_sizes); i++)
+        for (j = 0; j < NELMTS(nelmts); j++)
+            for (b = 0; b < NELMTS(block_sizes); b++) {
+                nbytes = (size_t)nelmts[j] * elmt_sizes[i];
+
+                for (u = 0; u < nbytes; u++)
+                    orig_data[u] = (unsigned char)HDrandom();
+
+                /* Bitshuffle the data a bit at a time, the way it should be stored:
+                 * bit K of byte U of element E in a block of N goes to bit E % 8 of
+                 * byte E / 8 of the Kth run of N / 8 bytes for byte position U */
+                block_size = block_sizes[b];
+                if (0 == block_size)
+                    block_size = MAX((8192 / elmt_sizes[i]) / 8 * 8, 128);
+                nblocked = (size_t)nelmts[j] / 8 * 8;
+                HDmemset(shuf_data, 0, nbytes);
+                for (start = 0; start < nblocked; start += block_size) {
+                    unsigned char *block = shuf_data + (start * elmt_sizes[i]);
+
+                    n = MIN(block_size, nblocked - start);
+                    for (k = 0; k < n; k++)
+                        for (u = 0; u < elmt_sizes[i]; u++) {
+                            unsigned char byte = orig_data[((start + k) * elmt_sizes[i]) + u];
+                            unsigned      bit;
+
+                            for (bit = 0; bit < 8; bit++)
+                                if (byte & (1 << bit))
+                                    block[(u * n) + (bit * (n / 8)) + (k / 8)] |=
+                                        (unsigned char)(1 << (k % 8));
+                        } /* end for */
+                }         /* end for */
+                HDmemcpy(shuf_data + (nblocked * elmt_sizes[i]), orig_data + (nblocked * elmt_sizes[i]),
+                         nbytes - (nblocked * elmt_sizes[i]));
+
+                for (c = 0; c < NELMTS(compressors); c++) {
+                    if (compressors[c] != H5Z_BITSHUFFLE_NO_COMPRESS &&
+                        H5Zfilter_avail(comp_filters[c]) != TRUE)
+                        continue;
+
+                    /* Create a dataset of a single chunk, with an opaque type of this size */
+                    if ((space = H5Screate_simple(1, &nelmts[j], NULL)) < 0)
+                        FAIL_STACK_ERROR
+                    if ((type = H5Tcreate(H5T_OPAQUE, elmt_sizes[i])) < 0)
+                        FAIL_STACK_ERROR
+                    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+                        FAIL_STACK_ERROR
+                    if (H5Pset_chunk(dc, 1, &nelmts[j]) < 0)
+                        FAIL_STACK_ERROR
+                    if (H5Pset_bitshuffle(dc, block_sizes[b], compressors[c]) < 0)
+                        FAIL_STACK_ERROR
+                    HDsnprintf(name, sizeof(name), "bitshuffle_%u_%u_%u_%u", (unsigned)elmt_sizes[i],
+                               (unsigned)nelmts[j], block_sizes[b], compressors[c]);
+                    if ((dataset = H5Dcreate2(file, name, type, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
+                        FAIL_STACK_ERROR
+                    if (H5Pclose(dc) < 0)
+                        FAIL_STACK_ERROR
+
+                    /* Check the element size was set from the datatype */
+                    if ((dc = H5Dget_create_plist(dataset)) < 0)
+                        FAIL_STACK_ERROR
+                    cd_nelmts = NELMTS(cd_values);
+                    if (H5Pget_filter_by_id2(dc, H5Z_FILTER_BITSHUFFLE, NULL, &cd_nelmts, cd_values, 0, NULL,
+                                             NULL) < 0)
+                        FAIL_STACK_ERROR
+                    if (cd_nelmts != H5Z_BITSHUFFLE_PARM_COMPRESS + 1 ||
+                        cd_values[H5Z_BITSHUFFLE_PARM_SIZE] != elmt_sizes[i] ||
+                        cd_values[H5Z_BITSHUFFLE_PARM_BLOCK_SIZE] != block_sizes[b] ||
+                        cd_values[H5Z_BITSHUFFLE_PARM_COMPRESS] != compressors[c])
+                        TEST_ERROR
+
+                    if (H5Dwrite(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+                        FAIL_STACK_ERROR
+                    if (H5Dflush(dataset) < 0)
+                        FAIL_STACK_ERROR
+
+                    /* Check the bytes stored */
+                    if (H5Dget_chunk_storage_size(dataset, offset, &chunk_nbytes) < 0)
+                        FAIL_STACK_ERROR
+                    if (H5Dread_chunk(dataset, H5P_DEFAULT, offset, &filters, raw_data) < 0)
+                        FAIL_STACK_ERROR
+                    if (compressors[c] == H5Z_BITSHUFFLE_NO_COMPRESS) {
+                        if (chunk_nbytes != nbytes)
+                            TEST_ERROR
+                        if (HDmemcmp(raw_data, shuf_data, nbytes) != 0) {
+                            H5_FAILED();
+                            HDprintf("    Bitshuffled bytes differ for %u-byte elements\n",
+                                     (unsigned)elmt_sizes[i]);
+                            goto error;
+                        }
+                    }
+                    else {
+                        /* The header records the sizes, and the elements left over follow the blocks */
+                        for (hdr_nbytes = 0, u = 0; u < 8; u++)
+                            hdr_nbytes = (hdr_nbytes << 8) | raw_data[u];
+                        for (hdr_block_nbytes = 0, u = 8; u < 12; u++)
+                            hdr_block_nbytes = (hdr_block_nbytes << 8) | raw_data[u];
+                        if (hdr_nbytes != nbytes || hdr_block_nbytes != block_size * elmt_sizes[i])
+                            TEST_ERROR
+                        if (chunk_nbytes < 12 + (nbytes - (nblocked * elmt_sizes[i])))
+                            TEST_ERROR
+                        if (HDmemcmp(raw_data + chunk_nbytes - (nbytes - (nblocked * elmt_sizes[i])),
+                                     orig_data + (nblocked * elmt_sizes[i]),
+                                     nbytes - (nblocked * elmt_sizes[i])) != 0)
+                            TEST_ERROR
+                    }
+
+                    /* Check that the data unbitshuffles to what was written */
+                    if (H5Dread(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+                        FAIL_STACK_ERROR
+                    if (HDmemcmp(new_data, orig_data, nbytes) != 0) {
+                        H5_FAILED();
+                        HDprintf("    Unbitshuffled bytes differ for %u-byte elements\n",
+                                 (unsigned)elmt_sizes[i]);
+                        goto error;
+                    }
+
+                    if (H5Dclose(dataset) < 0)
+                        FAIL_STACK_ERROR
+                    if (H5Pclose(dc) < 0)
+                        FAIL_STACK_ERROR
+                    if (H5Tclose(type) < 0)
+                        FAIL_STACK_ERROR
+                    if (H5Sclose(space) < 0)
+                        FAIL_STACK_ERROR
+                } /* end for */
+            }     /* end for */
+
+    HDfree(orig_data);
+    HDfree(new_data);
+    HDfree(shuf_data);
+    HDfree(raw_data);
 
     PASSED();
 
     return SUCCEED;
 
 error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Pclose(dc);
+        H5Tclose(type);
+        H5Sclose(space);
+    }
+    H5E_END_TRY;
+    HDfree(orig_data);
+    HDfree(new_data);
+    HDfree(shuf_data);
+    HDfree(raw_data);
+
     return FAIL;
-} /* end test_nbit_int() */
+} /* end test_bitshuffle() */
 
 /*-------------------------------------------------------------------------
- * Function:    test_nbit_float
+ * Function:    test_zstd_format
  *
- * Purpose:     Tests the float datatype of nbit filter
+ * Purpose:     Tests that the zstd filter stores each chunk as a single
+ *              zstd frame that records its uncompressed size, as the zstd
+ *              plugin does, and that it reads a frame it didn't write
  *
- * Return:      Success:        0
- *              Failure:        -1
+ * Return:      Success:    0
+ *              Failure:    -1
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_nbit_float(hid_t file)
+test_zstd_format(hid_t file)
 {
-    hid_t         dataset, datatype, space, dc;
-    const hsize_t size[2]       = {2, 5};
-    const hsize_t chunk_size[2] = {2, 5};
-    /* orig_data[] are initialized to be within the range that can be represented by
-     * dataset datatype (no precision loss during datatype conversion)
-     */
-    float  orig_data[2][5] = {{188384.0f, 19.103516f, -1.0831790e9f, -84.242188f, 5.2045898f},
-                             {-49140.0f, 2350.25f, -3.2110596e-1f, 6.4998865e-5f, -0.0f}};
-    float  new_data[2][5];
-    size_t precision, offset;
-    size_t i, j;
-
-    TESTING("    nbit float (setup)");
-
-    /* Define user-defined single-precision floating-point type for dataset */
-    datatype = H5Tcopy(H5T_IEEE_F32BE);
-    if (H5Tset_fields(datatype, (size_t)26, (size_t)20, (size_t)6, (size_t)7, (size_t)13) < 0)
-        FAIL_STACK_ERROR
-    offset = 7;
-    if (H5Tset_offset(datatype, offset) < 0)
+#ifdef H5_HAVE_FILTER_ZSTD
+    hid_t         dataset = -1, space = -1, dc = -1;
+    const hsize_t nelmts[1]    = {400};
+    const size_t  did_sizes[4] = {0, 1, 2, 4}; /* Size of the dictionary ID, by its flag */
+    const size_t  fcs_sizes[4] = {0, 2, 4, 8}; /* Size of the content size, by its flag */
+    hsize_t       offset[1]    = {0};
+    hsize_t       chunk_nbytes;
+    uint32_t      filters;
+    unsigned char orig_data[400], new_data[400], raw_data[512];
+    unsigned char fhd;
+    size_t        pos, fcs_nbytes;
+    uint64_t      fcs;
+    size_t        u;
+
+    TESTING("zstd filter format");
+
+    for (u = 0; u < sizeof(orig_data); u++)
+        orig_data[u] = (unsigned char)(u % 7);
+
+    if ((space = H5Screate_simple(1, nelmts, NULL)) < 0)
         FAIL_STACK_ERROR
-    precision = 20;
-    if (H5Tset_precision(datatype, precision) < 0)
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
         FAIL_STACK_ERROR
-    if (H5Tset_size(datatype, (size_t)4) < 0)
+    if (H5Pset_chunk(dc, 1, nelmts) < 0)
         FAIL_STACK_ERROR
-    if (H5Tset_ebias(datatype, (size_t)31) < 0)
+    if (H5Pset_zstd(dc, 3) < 0)
         FAIL_STACK_ERROR
 
-    /* Create the data space */
-    if ((space = H5Screate_simple(2, size, NULL)) < 0)
+    /* Write a chunk and check it's a frame with the size of the chunk */
+    if ((dataset = H5Dcreate2(file, "zstd_format", H5T_NATIVE_UCHAR, space, H5P_DEFAULT, dc, H5P_DEFAULT)) <
+        0)
         FAIL_STACK_ERROR
-
-    /* Use nbit filter  */
-    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+    if (H5Dwrite(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
         FAIL_STACK_ERROR
-    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+    if (H5Dflush(dataset) < 0)
         FAIL_STACK_ERROR
-    if (H5Pset_nbit(dc) < 0)
+    if (H5Dget_chunk_storage_size(dataset, offset, &chunk_nbytes) < 0)
         FAIL_STACK_ERROR
-
-    /* Create the dataset */
-    if ((dataset = H5Dcreate2(file, DSET_NBIT_FLOAT_NAME, datatype, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
+    if (chunk_nbytes < 6 || chunk_nbytes >= sizeof(orig_data))
+        TEST_ERROR
+    if (H5Dread_chunk(dataset, H5P_DEFAULT, offset, &filters, raw_data) < 0)
         FAIL_STACK_ERROR
-    PASSED();
+    if (filters != 0)
+        TEST_ERROR
+    if (raw_data[0] != 0x28 || raw_data[1] != 0xB5 || raw_data[2] != 0x2F || raw_data[3] != 0xFD)
+        TEST_ERROR
 
-    /*----------------------------------------------------------------------
-     * STEP 1: Test nbit by setting up a chunked dataset and writing
-     * to it.
-     *----------------------------------------------------------------------
-     */
-    TESTING("    nbit float (write)");
+    /* The frame header descriptor gives where the content size is, and how big it is */
+    fhd = raw_data[4];
+    pos = 5;
+    if (0 == (fhd & 0x20))
+        pos++; /* Window descriptor */
+    pos += did_sizes[fhd & 0x3];
+    fcs_nbytes = fcs_sizes[fhd >> 6];
+    if (0 == fcs_nbytes && (fhd & 0x20))
+        fcs_nbytes = 1; /* Single segment frames always have the content size */
+    if (0 == fcs_nbytes || pos + fcs_nbytes > chunk_nbytes)
+        TEST_ERROR
+    for (fcs = 0, u = fcs_nbytes; u > 0; u--)
+        fcs = (fcs << 8) | raw_data[pos + u - 1];
+    if (2 == fcs_nbytes)
+        fcs += 256;
+    if (fcs != sizeof(orig_data))
+        TEST_ERROR
 
-    if (H5Dwrite(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+    if (H5Dread(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
         FAIL_STACK_ERROR
-
-    PASSED();
-
-    /*----------------------------------------------------------------------
-     * STEP 2: Try to read the data we just wrote.
-     *----------------------------------------------------------------------
-     */
-    TESTING("    nbit float (read)");
-
-    /* Read the dataset back */
-    if (H5Dread(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+    if (HDmemcmp(new_data, orig_data, sizeof(orig_data)) != 0)
+        TEST_ERROR
+    if (H5Dclose(dataset) < 0)
         FAIL_STACK_ERROR
 
-    /* Check that the values read are the same as the values written
-     * Assume size of int = size of float
-     */
-    for (i = 0; i < (size_t)size[0]; i++) {
-        for (j = 0; j < (size_t)size[1]; j++) {
-            if (HDisnan(orig_data[i][j]))
-                continue; /* skip if value is NaN */
-            if (!H5_FLT_ABS_EQUAL(new_data[i][j], orig_data[i][j])) {
-                H5_FAILED();
-                HDprintf("    Read different values than written.\n");
-                HDprintf("    At index %lu,%lu\n", (unsigned long)i, (unsigned long)j);
-                goto error;
-            }
-        }
-    }
+    /* Build a frame of one raw block by hand, with a two-byte content size,
+     * and check the filter reads it */
+    pos             = 0;
+    raw_data[pos++] = 0x28;
+    raw_data[pos++] = 0xB5;
+    raw_data[pos++] = 0x2F;
+    raw_data[pos++] = 0xFD;
+    raw_data[pos++] = 0x60; /* Single segment, two-byte content size */
+    raw_data[pos++] = (unsigned char)((sizeof(orig_data) - 256) & 0xff);
+    raw_data[pos++] = (unsigned char)((sizeof(orig_data) - 256) >> 8);
+    raw_data[pos++] = (unsigned char)(((sizeof(orig_data) << 3) | 1) & 0xff); /* Last, raw block */
+    raw_data[pos++] = (unsigned char)(((sizeof(orig_data) << 3) | 1) >> 8);
+    raw_data[pos++] = (unsigned char)(((sizeof(orig_data) << 3) | 1) >> 16);
+    HDmemcpy(raw_data + pos, orig_data, sizeof(orig_data));
+    pos += sizeof(orig_data);
+
+    if ((dataset = H5Dcreate2(file, "zstd_format_2", H5T_NATIVE_UCHAR, space, H5P_DEFAULT, dc,
+                              H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite_chunk(dataset, H5P_DEFAULT, 0, offset, pos, raw_data) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(new_data, 0, sizeof(new_data));
+    if (H5Dread(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        FAIL_STACK_ERROR
+    if (HDmemcmp(new_data, orig_data, sizeof(orig_data)) != 0)
+        TEST_ERROR
 
-    /*----------------------------------------------------------------------
-     * Cleanup
-     *----------------------------------------------------------------------
-     */
-    if (H5Tclose(datatype) < 0)
+    if (H5Dclose(dataset) < 0)
         FAIL_STACK_ERROR
     if (H5Pclose(dc) < 0)
         FAIL_STACK_ERROR
     if (H5Sclose(space) < 0)
         FAIL_STACK_ERROR
-    if (H5Dclose(dataset) < 0)
-        FAIL_STACK_ERROR
 
     PASSED();
 
     return SUCCEED;
 
 error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Pclose(dc);
+        H5Sclose(space);
+    }
+    H5E_END_TRY;
+
     return FAIL;
-} /* end test_nbit_float() */
+#else  /* H5_HAVE_FILTER_ZSTD */
+    (void)file;
+
+    TESTING("zstd filter format");
+    SKIPPED();
+    HDputs("    zstd filter not enabled");
+
+    return SUCCEED;
+#endif /* H5_HAVE_FILTER_ZSTD */
+} /* end test_zstd_format() */
 
 /*-------------------------------------------------------------------------
- * Function:    test_nbit_double
+ * Function:    test_lz4_format
  *
- * Purpose:     Tests the double datatype of nbit filter
+ * Purpose:     Tests that the lz4 filter stores chunks in the blocks the
+ *              lz4 plugin does, and that it reads a chunk it didn't write,
+ *              with both compressed blocks and blocks stored as is
  *
- * Return:      Success:        0
- *              Failure:        -1
+ * Return:      Success:    0
+ *              Failure:    -1
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_nbit_double(hid_t file)
+test_lz4_format(hid_t file)
 {
-    /* assume unsigned int and float has the same number of bytes */
-    hid_t         dataset, datatype, space, dc;
-    const hsize_t size[2]       = {2, 5};
-    const hsize_t chunk_size[2] = {2, 5};
-    /* orig_data[] are initialized to be within the range that can be represented by
-     * dataset datatype (no precision loss during datatype conversion)
-     */
-    double orig_data[2][5] = {{(double)1.6081706885101836e+60L, -255.32099170994480f,
-                               (double)1.2677579992621376e-61L, 64568.289448797700f,
-                               (double)-1.0619721778839084e-75L},
-                              {(double)2.1499497833454840e+56L, 6.6562295504670740e-3f, -1.5747263393432150f,
-                               1.0711093225222612f, -9.8971679387636870e-1f}};
-    double new_data[2][5];
-    size_t precision, offset;
-    size_t i, j;
-
-    TESTING("    nbit double (setup)");
-
-    /* Define user-defined doule-precision floating-point type for dataset */
-    datatype = H5Tcopy(H5T_IEEE_F64BE);
-    if (H5Tset_fields(datatype, (size_t)55, (size_t)46, (size_t)9, (size_t)5, (size_t)41) < 0)
-        FAIL_STACK_ERROR
-    offset = 5;
-    if (H5Tset_offset(datatype, offset) < 0)
+#ifdef H5_HAVE_FILTER_LZ4
+    hid_t          dataset = -1, space = -1, dc = -1;
+    const hsize_t  nelmts[1]    = {400};
+    const unsigned cd_values[1] = {64};
+    hsize_t        offset[1]    = {0};
+    hsize_t        chunk_nbytes;
+    uint32_t       filters;
+    unsigned char  orig_data[400], new_data[400], raw_data[512];
+    uint64_t       hdr_nbytes;
+    uint32_t       hdr_block_nbytes, comp_nbytes;
+    size_t         pos, done, n;
+    size_t         u;
+
+    TESTING("lz4 filter format");
+
+    for (u = 0; u < sizeof(orig_data); u++)
+        orig_data[u] = (unsigned char)(u % 7);
+
+    if ((space = H5Screate_simple(1, nelmts, NULL)) < 0)
         FAIL_STACK_ERROR
-    precision = 51;
-    if (H5Tset_precision(datatype, precision) < 0)
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
         FAIL_STACK_ERROR
-    if (H5Tset_size(datatype, (size_t)8) < 0)
+    if (H5Pset_chunk(dc, 1, nelmts) < 0)
         FAIL_STACK_ERROR
-    if (H5Tset_ebias(datatype, (size_t)255) < 0)
+    if (H5Pset_filter(dc, H5Z_FILTER_LZ4, H5Z_FLAG_OPTIONAL, NELMTS(cd_values), cd_values) < 0)
         FAIL_STACK_ERROR
 
-    /* Create the data space */
-    if ((space = H5Screate_simple(2, size, NULL)) < 0)
+    /* Write a chunk and check its header and the blocks that follow */
+    if ((dataset = H5Dcreate2(file, "lz4_format", H5T_NATIVE_UCHAR, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
-
-    /* Use nbit filter  */
-    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+    if (H5Dwrite(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
         FAIL_STACK_ERROR
-    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+    if (H5Dflush(dataset) < 0)
         FAIL_STACK_ERROR
-    if (H5Pset_nbit(dc) < 0)
+    if (H5Dget_chunk_storage_size(dataset, offset, &chunk_nbytes) < 0)
         FAIL_STACK_ERROR
-
-    /* Create the dataset */
-    if ((dataset = H5Dcreate2(file, DSET_NBIT_DOUBLE_NAME, datatype, space, H5P_DEFAULT, dc, H5P_DEFAULT)) <
-        0)
+    if (chunk_nbytes < 12 || chunk_nbytes > sizeof(raw_data))
+        TEST_ERROR
+    if (H5Dread_chunk(dataset, H5P_DEFAULT, offset, &filters, raw_data) < 0)
         FAIL_STACK_ERROR
+    if (filters != 0)
+        TEST_ERROR
+    for (hdr_nbytes = 0, u = 0; u < 8; u++)
+        hdr_nbytes = (hdr_nbytes << 8) | raw_data[u];
+    for (hdr_block_nbytes = 0, u = 8; u < 12; u++)
+        hdr_block_nbytes = (hdr_block_nbytes << 8) | raw_data[u];
+    if (hdr_nbytes != sizeof(orig_data) || hdr_block_nbytes != cd_values[0])
+        TEST_ERROR
+    for (pos = 12, done = 0; done < sizeof(orig_data); done += n) {
+        n = MIN(cd_values[0], sizeof(orig_data) - done);
+        if (pos + 4 > chunk_nbytes)
+            TEST_ERROR
+        for (comp_nbytes = 0, u = 0; u < 4; u++)
+            comp_nbytes = (comp_nbytes << 8) | raw_data[pos++];
+        if (0 == comp_nbytes || comp_nbytes > n || pos + comp_nbytes > chunk_nbytes)
+            TEST_ERROR
+        if (comp_nbytes == n && HDmemcmp(raw_data + pos, orig_data + done, n) != 0)
+            TEST_ERROR
+        pos += comp_nbytes;
+    } /* end for */
+    if (pos != chunk_nbytes)
+        TEST_ERROR
 
-    PASSED();
-
-    /*----------------------------------------------------------------------
-     * STEP 1: Test nbit by setting up a chunked dataset and writing
-     * to it.
-     *----------------------------------------------------------------------
-     */
-    TESTING("    nbit double (write)");
-
-    if (H5Dwrite(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+    if (H5Dread(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
         FAIL_STACK_ERROR
-    PASSED();
-
-    /*----------------------------------------------------------------------
-     * STEP 2: Try to read the data we just wrote.
-     *----------------------------------------------------------------------
-     */
-    TESTING("    nbit double (read)");
-
-    /* Read the dataset back */
-    if (H5Dread(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+    if (HDmemcmp(new_data, orig_data, sizeof(orig_data)) != 0)
+        TEST_ERROR
+    if (H5Dclose(dataset) < 0)
         FAIL_STACK_ERROR
 
-    /* Check that the values read are the same as the values written
-     * Assume size of long long = size of double
-     */
-    for (i = 0; i < (size_t)size[0]; i++) {
-        for (j = 0; j < (size_t)size[1]; j++) {
-            if (HDisnan(orig_data[i][j]))
-                continue; /* skip if value is NaN */
-            if (!H5_DBL_ABS_EQUAL(new_data[i][j], orig_data[i][j])) {
-                H5_FAILED();
-                HDprintf("    Read different values than written.\n");
-                HDprintf("    At index %lu,%lu\n", (unsigned long)i, (unsigned long)j);
-                goto error;
-            }
-        }
-    }
+    /* Build a chunk by hand, in blocks of 128 bytes.  The first three are
+     * stored as is and the last is an lz4 block of only literals, which is
+     * bigger than the 16 bytes it holds, and check the filter reads it */
+    pos = 0;
+    for (u = 0; u < 8; u++)
+        raw_data[pos++] = (unsigned char)(u < 6 ? 0 : (sizeof(orig_data) >> (8 * (7 - u))) & 0xff);
+    for (u = 0; u < 4; u++)
+        raw_data[pos++] = (unsigned char)(u < 3 ? 0 : 128);
+    for (done = 0; done < 384; done += 128) {
+        raw_data[pos++] = 0;
+        raw_data[pos++] = 0;
+        raw_data[pos++] = 0;
+        raw_data[pos++] = 128;
+        HDmemcpy(raw_data + pos, orig_data + done, 128);
+        pos += 128;
+    } /* end for */
+    raw_data[pos++] = 0;
+    raw_data[pos++] = 0;
+    raw_data[pos++] = 0;
+    raw_data[pos++] = 18;
+    raw_data[pos++] = 0xF0; /* 15 or more literals and no match */
+    raw_data[pos++] = 1;    /* 15 + 1 literals */
+    HDmemcpy(raw_data + pos, orig_data + 384, 16);
+    pos += 16;
+
+    if ((dataset = H5Dcreate2(file, "lz4_format_2", H5T_NATIVE_UCHAR, space, H5P_DEFAULT, dc, H5P_DEFAULT)) <
+        0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite_chunk(dataset, H5P_DEFAULT, 0, offset, pos, raw_data) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(new_data, 0, sizeof(new_data));
+    if (H5Dread(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        FAIL_STACK_ERROR
+    if (HDmemcmp(new_data, orig_data, sizeof(orig_data)) != 0)
+        TEST_ERROR
 
-    /*----------------------------------------------------------------------
-     * Cleanup
-     *----------------------------------------------------------------------
-     */
-    if (H5Tclose(datatype) < 0)
+    if (H5Dclose(dataset) < 0)
         FAIL_STACK_ERROR
     if (H5Pclose(dc) < 0)
         FAIL_STACK_ERROR
     if (H5Sclose(space) < 0)
         FAIL_STACK_ERROR
-    if (H5Dclose(dataset) < 0)
-        FAIL_STACK_ERROR
 
     PASSED();
 
     return SUCCEED;
 
 error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Pclose(dc);
+        H5Sclose(space);
+    }
+    H5E_END_TRY;
+
     return FAIL;
-} /* end test_nbit_double() */
+#else  /* H5_HAVE_FILTER_LZ4 */
+    (void)file;
+
+    TESTING("lz4 filter format");
+    SKIPPED();
+    HDputs("    lz4 filter not enabled");
+
+    return SUCCEED;
+#endif /* H5_HAVE_FILTER_LZ4 */
+} /* end test_lz4_format() */
 
 /*-------------------------------------------------------------------------
- * Function:    test_nbit_array
+ * Function:    test_nbit_int
  *
- * Purpose:     Tests the simple version array datatype for nbit filter
+ * Purpose:     Tests the integer datatype for nbit filter
  *
  * Return:      Success:        0
  *              Failure:        -1
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_nbit_array(hid_t file)
+test_nbit_int(hid_t file)
 {
-    hid_t         dataset, base_datatype, array_datatype, space, dc;
-    hid_t         mem_base_datatype, mem_array_datatype;
-    const hsize_t size[2]       = {2, 5};
-    const hsize_t adims[2]      = {3, 2};
-    const hsize_t chunk_size[2] = {2, 5};
-    unsigned int  orig_data[2][5][3][2];
-    unsigned int  new_data[2][5][3][2];
-    size_t        precision, offset;
-    double        power;
-    size_t        i, j, m, n;
+    hid_t        dataset, datatype, mem_datatype, space, dc;
+    hsize_t      size[2]       = {2, 5};
+    hsize_t      chunk_size[2] = {2, 5};
+    int          orig_data[2][5];
+    int          new_data[2][5];
+    unsigned int mask;
+    size_t       precision, offset;
+    double       power;
+    size_t       i, j;
 
-    TESTING("    nbit array (setup)");
+    HDputs("Testing nbit filter");
+    TESTING("    nbit int (setup)");
 
-    /* Define dataset array datatype's base datatype and set precision, offset */
-    base_datatype = H5Tcopy(H5T_NATIVE_UINT);
-    precision     = 22;
-    if (H5Tset_precision(base_datatype, precision) < 0)
+    /* Define dataset datatype (integer), and set precision, offset */
+    datatype  = H5Tcopy(H5T_NATIVE_INT);
+    precision = 17; /* precision includes sign bit */
+    if (H5Tset_precision(datatype, precision) < 0)
         goto error;
-    offset = 7;
-    if (H5Tset_offset(base_datatype, offset) < 0)
+    offset = 4;
+    if (H5Tset_offset(datatype, offset) < 0)
         goto error;
 
-    /* Copy to memory array datatype's base datatype before setting order */
-    mem_base_datatype = H5Tcopy(base_datatype);
+    /* Copy to memory datatype before setting order */
+    mem_datatype = H5Tcopy(datatype);
 
-    /* Set order of dataset array datatype's base datatype */
-    if (H5Tset_order(base_datatype, H5T_ORDER_BE) < 0)
+    /* Set order of dataset datatype */
+    if (H5Tset_order(datatype, H5T_ORDER_BE) < 0)
         goto error;
 
-    /* Create dataset array datatype */
-    array_datatype = H5Tarray_create2(base_datatype, 2, adims);
-
-    /* Create memory array datatype */
-    mem_array_datatype = H5Tarray_create2(mem_base_datatype, 2, adims);
-
     /* Create the data space */
     if ((space = H5Screate_simple(2, size, NULL)) < 0)
         goto error;
@@ -3549,19 +4187,20 @@ test_nbit_array(hid_t file)
         goto error;
 
     /* Create the dataset */
-    if ((dataset =
-             H5Dcreate2(file, DSET_NBIT_ARRAY_NAME, array_datatype, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
+    if ((dataset = H5Dcreate2(file, DSET_NBIT_INT_NAME, datatype, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
         goto error;
 
-    /* Initialize data, assuming size of long long >= size of unsigned int */
+    /* Initialize data, assuming size of long long >= size of int */
     for (i = 0; i < (size_t)size[0]; i++)
-        for (j = 0; j < (size_t)size[1]; j++)
-            for (m = 0; m < (size_t)adims[0]; m++)
-                for (n = 0; n < (size_t)adims[1]; n++) {
-                    power = HDpow(2.0F, (double)precision);
-                    orig_data[i][j][m][n] =
-                        (unsigned int)(((long long)HDrandom() % (long long)power) << offset);
-                } /* end for */
+        for (j = 0; j < (size_t)size[1]; j++) {
+            power           = HDpow(2.0f, (double)(precision - 1));
+            orig_data[i][j] = (int)(((long long)HDrandom() % (long long)power) << offset);
+
+            /* even-numbered values are negtive */
+            if ((i * size[1] + j + 1) % 2 == 0)
+                orig_data[i][j] = -orig_data[i][j];
+        }
+
     PASSED();
 
     /*----------------------------------------------------------------------
@@ -3569,49 +4208,44 @@ test_nbit_array(hid_t file)
      * to it.
      *----------------------------------------------------------------------
      */
-    TESTING("    nbit array (write)");
+    TESTING("    nbit int (write)");
 
-    if (H5Dwrite(dataset, mem_array_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+    if (H5Dwrite(dataset, mem_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
         goto error;
-
     PASSED();
 
     /*----------------------------------------------------------------------
      * STEP 2: Try to read the data we just wrote.
      *----------------------------------------------------------------------
      */
-    TESTING("    nbit array (read)");
+    TESTING("    nbit int (read)");
 
     /* Read the dataset back */
-    if (H5Dread(dataset, mem_array_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+    if (H5Dread(dataset, mem_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
         goto error;
 
     /* Check that the values read are the same as the values written
+     * Use mask for checking the significant bits, ignoring the padding bits
      */
-    for (i = 0; i < (size_t)size[0]; i++)
-        for (j = 0; j < (size_t)size[1]; j++)
-            for (m = 0; m < (size_t)adims[0]; m++)
-                for (n = 0; n < (size_t)adims[1]; n++) {
-                    if (new_data[i][j][m][n] != orig_data[i][j][m][n]) {
-                        H5_FAILED();
-                        HDprintf("    Read different values than written.\n");
-                        HDprintf("    At index %lu,%lu,%lu,%lu\n", (unsigned long)i, (unsigned long)j,
-                                 (unsigned long)m, (unsigned long)n);
-                        goto error;
-                    }
-                }
+    mask = ~((unsigned)~0 << (precision + offset)) & ((unsigned)~0 << offset);
+    for (i = 0; i < (size_t)size[0]; i++) {
+        for (j = 0; j < (size_t)size[1]; j++) {
+            if (((unsigned)new_data[i][j] & mask) != ((unsigned)orig_data[i][j] & mask)) {
+                H5_FAILED();
+                HDprintf("    Read different values than written.\n");
+                HDprintf("    At index %lu,%lu\n", (unsigned long)i, (unsigned long)j);
+                goto error;
+            }
+        }
+    }
 
     /*----------------------------------------------------------------------
      * Cleanup
      *----------------------------------------------------------------------
      */
-    if (H5Tclose(array_datatype) < 0)
-        goto error;
-    if (H5Tclose(base_datatype) < 0)
-        goto error;
-    if (H5Tclose(mem_array_datatype) < 0)
+    if (H5Tclose(datatype) < 0)
         goto error;
-    if (H5Tclose(mem_base_datatype) < 0)
+    if (H5Tclose(mem_datatype) < 0)
         goto error;
     if (H5Pclose(dc) < 0)
         goto error;
@@ -3626,112 +4260,168 @@ test_nbit_array(hid_t file)
 
 error:
     return FAIL;
-} /* end test_nbit_array() */
+} /* end test_nbit_int() */
 
 /*-------------------------------------------------------------------------
- * Function:    test_nbit_compound
+ * Function:    test_nbit_float
  *
- * Purpose:     Tests a simple version of compound datatype of nbit filter
+ * Purpose:     Tests the float datatype of nbit filter
  *
  * Return:      Success:        0
- *
  *              Failure:        -1
- *
- * Programmer:  Xiaowen Wu
- *              Tuesday, Jan. 18th, 2005
- *
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_nbit_compound(hid_t file)
+test_nbit_float(hid_t file)
 {
-    typedef struct { /* Struct with atomic fields */
-        int   i;
-        char  c;
-        short s;
-        float f;
-    } atomic;
-    hid_t         i_tid, c_tid, s_tid, f_tid;
-    hid_t         cmpd_tid;     /* atomic compound datatype */
-    hid_t         mem_cmpd_tid; /* memory atomic compound datatype */
-    size_t        precision[3] = {15, 7, 10};
-    size_t        offset[3]    = {9, 0, 3};
-    hid_t         dataset, space, dc;
-    const hsize_t size[2]         = {2, 5};
-    const hsize_t chunk_size[2]   = {2, 5};
-    const float   float_val[2][5] = {{188384.0F, 19.103516F, -1.0831790e9F, -84.242188F, 5.2045898F},
-                                   {-49140.0F, 2350.25F, -3.2110596e-1F, 6.4998865e-5F, -0.0F}};
-    atomic        orig_data[2][5];
-    atomic        new_data[2][5];
-    unsigned int  i_mask, s_mask, c_mask;
-    double        power;
-    size_t        i, j;
-
-    TESTING("    nbit compound (setup)");
+    hid_t         dataset, datatype, space, dc;
+    const hsize_t size[2]       = {2, 5};
+    const hsize_t chunk_size[2] = {2, 5};
+    /* orig_data[] are initialized to be within the range that can be represented by
+     * dataset datatype (no precision loss during datatype conversion)
+     */
+    float  orig_data[2][5] = {{188384.0f, 19.103516f, -1.0831790e9f, -84.242188f, 5.2045898f},
+                             {-49140.0f, 2350.25f, -3.2110596e-1f, 6.4998865e-5f, -0.0f}};
+    float  new_data[2][5];
+    size_t precision, offset;
+    size_t i, j;
 
-    /* Define datatypes of members of compound datatype */
-    if ((i_tid = H5Tcopy(H5T_NATIVE_INT)) < 0)
-        FAIL_STACK_ERROR
-    if ((c_tid = H5Tcopy(H5T_NATIVE_CHAR)) < 0)
-        FAIL_STACK_ERROR
-    if ((s_tid = H5Tcopy(H5T_NATIVE_SHORT)) < 0)
-        FAIL_STACK_ERROR
-    if ((f_tid = H5Tcopy(H5T_IEEE_F32BE)) < 0)
-        FAIL_STACK_ERROR
+    TESTING("    nbit float (setup)");
 
-    /* Set precision and offset etc. */
-    if (H5Tset_precision(i_tid, precision[0]) < 0)
+    /* Define user-defined single-precision floating-point type for dataset */
+    datatype = H5Tcopy(H5T_IEEE_F32BE);
+    if (H5Tset_fields(datatype, (size_t)26, (size_t)20, (size_t)6, (size_t)7, (size_t)13) < 0)
         FAIL_STACK_ERROR
-    if (H5Tset_offset(i_tid, offset[0]) < 0)
+    offset = 7;
+    if (H5Tset_offset(datatype, offset) < 0)
         FAIL_STACK_ERROR
-
-    if (H5Tset_precision(c_tid, precision[1]) < 0)
+    precision = 20;
+    if (H5Tset_precision(datatype, precision) < 0)
         FAIL_STACK_ERROR
-    if (H5Tset_offset(c_tid, offset[1]) < 0)
+    if (H5Tset_size(datatype, (size_t)4) < 0)
         FAIL_STACK_ERROR
-
-    if (H5Tset_precision(s_tid, precision[2]) < 0)
+    if (H5Tset_ebias(datatype, (size_t)31) < 0)
         FAIL_STACK_ERROR
-    if (H5Tset_offset(s_tid, offset[2]) < 0)
+
+    /* Create the data space */
+    if ((space = H5Screate_simple(2, size, NULL)) < 0)
         FAIL_STACK_ERROR
 
-    if (H5Tset_fields(f_tid, (size_t)26, (size_t)20, (size_t)6, (size_t)7, (size_t)13) < 0)
+    /* Use nbit filter  */
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
         FAIL_STACK_ERROR
-    if (H5Tset_offset(f_tid, (size_t)7) < 0)
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
         FAIL_STACK_ERROR
-    if (H5Tset_precision(f_tid, (size_t)20) < 0)
+    if (H5Pset_nbit(dc) < 0)
         FAIL_STACK_ERROR
-    if (H5Tset_size(f_tid, (size_t)4) < 0)
+
+    /* Create the dataset */
+    if ((dataset = H5Dcreate2(file, DSET_NBIT_FLOAT_NAME, datatype, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
-    if (H5Tset_ebias(f_tid, (size_t)31) < 0)
+    PASSED();
+
+    /*----------------------------------------------------------------------
+     * STEP 1: Test nbit by setting up a chunked dataset and writing
+     * to it.
+     *----------------------------------------------------------------------
+     */
+    TESTING("    nbit float (write)");
+
+    if (H5Dwrite(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
         FAIL_STACK_ERROR
 
-    /* Create a memory compound datatype before setting the order */
-    if ((mem_cmpd_tid = H5Tcreate(H5T_COMPOUND, sizeof(atomic))) < 0)
+    PASSED();
+
+    /*----------------------------------------------------------------------
+     * STEP 2: Try to read the data we just wrote.
+     *----------------------------------------------------------------------
+     */
+    TESTING("    nbit float (read)");
+
+    /* Read the dataset back */
+    if (H5Dread(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(mem_cmpd_tid, "i", HOFFSET(atomic, i), i_tid) < 0)
+
+    /* Check that the values read are the same as the values written
+     * Assume size of int = size of float
+     */
+    for (i = 0; i < (size_t)size[0]; i++) {
+        for (j = 0; j < (size_t)size[1]; j++) {
+            if (HDisnan(orig_data[i][j]))
+                continue; /* skip if value is NaN */
+            if (!H5_FLT_ABS_EQUAL(new_data[i][j], orig_data[i][j])) {
+                H5_FAILED();
+                HDprintf("    Read different values than written.\n");
+                HDprintf("    At index %lu,%lu\n", (unsigned long)i, (unsigned long)j);
+                goto error;
+            }
+        }
+    }
+
+    /*----------------------------------------------------------------------
+     * Cleanup
+     *----------------------------------------------------------------------
+     */
+    if (H5Tclose(datatype) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(mem_cmpd_tid, "c", HOFFSET(atomic, c), c_tid) < 0)
+    if (H5Pclose(dc) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(mem_cmpd_tid, "s", HOFFSET(atomic, s), s_tid) < 0)
+    if (H5Sclose(space) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(mem_cmpd_tid, "f", HOFFSET(atomic, f), H5T_NATIVE_FLOAT) < 0)
+    if (H5Dclose(dataset) < 0)
         FAIL_STACK_ERROR
 
-    /* Create a dataset compound datatype and insert some atomic types */
-    if ((cmpd_tid = H5Tcreate(H5T_COMPOUND, sizeof(atomic))) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tinsert(cmpd_tid, "i", HOFFSET(atomic, i), i_tid) < 0)
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    return FAIL;
+} /* end test_nbit_float() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_nbit_double
+ *
+ * Purpose:     Tests the double datatype of nbit filter
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_nbit_double(hid_t file)
+{
+    /* assume unsigned int and float has the same number of bytes */
+    hid_t         dataset, datatype, space, dc;
+    const hsize_t size[2]       = {2, 5};
+    const hsize_t chunk_size[2] = {2, 5};
+    /* orig_data[] are initialized to be within the range that can be represented by
+     * dataset datatype (no precision loss during datatype conversion)
+     */
+    double orig_data[2][5] = {{(double)1.6081706885101836e+60L, -255.32099170994480f,
+                               (double)1.2677579992621376e-61L, 64568.289448797700f,
+                               (double)-1.0619721778839084e-75L},
+                              {(double)2.1499497833454840e+56L, 6.6562295504670740e-3f, -1.5747263393432150f,
+                               1.0711093225222612f, -9.8971679387636870e-1f}};
+    double new_data[2][5];
+    size_t precision, offset;
+    size_t i, j;
+
+    TESTING("    nbit double (setup)");
+
+    /* Define user-defined doule-precision floating-point type for dataset */
+    datatype = H5Tcopy(H5T_IEEE_F64BE);
+    if (H5Tset_fields(datatype, (size_t)55, (size_t)46, (size_t)9, (size_t)5, (size_t)41) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(cmpd_tid, "c", HOFFSET(atomic, c), c_tid) < 0)
+    offset = 5;
+    if (H5Tset_offset(datatype, offset) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(cmpd_tid, "s", HOFFSET(atomic, s), s_tid) < 0)
+    precision = 51;
+    if (H5Tset_precision(datatype, precision) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(cmpd_tid, "f", HOFFSET(atomic, f), f_tid) < 0)
+    if (H5Tset_size(datatype, (size_t)8) < 0)
         FAIL_STACK_ERROR
-
-    /* Set order of dataset compound datatype */
-    if (H5Tset_order(cmpd_tid, H5T_ORDER_BE) < 0)
+    if (H5Tset_ebias(datatype, (size_t)255) < 0)
         FAIL_STACK_ERROR
 
     /* Create the data space */
@@ -3747,28 +4437,10 @@ test_nbit_compound(hid_t file)
         FAIL_STACK_ERROR
 
     /* Create the dataset */
-    if ((dataset = H5Dcreate2(file, DSET_NBIT_COMPOUND_NAME, cmpd_tid, space, H5P_DEFAULT, dc, H5P_DEFAULT)) <
+    if ((dataset = H5Dcreate2(file, DSET_NBIT_DOUBLE_NAME, datatype, space, H5P_DEFAULT, dc, H5P_DEFAULT)) <
         0)
         FAIL_STACK_ERROR
 
-    /* Initialize data, assuming size of long long >= size of member datatypes */
-    for (i = 0; i < (size_t)size[0]; i++)
-        for (j = 0; j < (size_t)size[1]; j++) {
-            power             = HDpow(2.0F, (double)(precision[0] - 1));
-            orig_data[i][j].i = (int)(((long long)HDrandom() % (long long)power) << offset[0]);
-            power             = HDpow(2.0F, (double)(precision[1] - 1));
-            orig_data[i][j].c = (char)(((long long)HDrandom() % (long long)power) << offset[1]);
-            power             = HDpow(2.0F, (double)(precision[2] - 1));
-            orig_data[i][j].s = (short)(((long long)HDrandom() % (long long)power) << offset[2]);
-            orig_data[i][j].f = float_val[i][j];
-
-            /* some even-numbered integer values are negtive */
-            if ((i * size[1] + j + 1) % 2 == 0) {
-                orig_data[i][j].i = -orig_data[i][j].i;
-                orig_data[i][j].s = (short)-orig_data[i][j].s;
-            }
-        }
-
     PASSED();
 
     /*----------------------------------------------------------------------
@@ -3776,9 +4448,9 @@ test_nbit_compound(hid_t file)
      * to it.
      *----------------------------------------------------------------------
      */
-    TESTING("    nbit compound (write)");
+    TESTING("    nbit double (write)");
 
-    if (H5Dwrite(dataset, mem_cmpd_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+    if (H5Dwrite(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
         FAIL_STACK_ERROR
     PASSED();
 
@@ -3786,24 +4458,20 @@ test_nbit_compound(hid_t file)
      * STEP 2: Try to read the data we just wrote.
      *----------------------------------------------------------------------
      */
-    TESTING("    nbit compound (read)");
+    TESTING("    nbit double (read)");
 
     /* Read the dataset back */
-    if (H5Dread(dataset, mem_cmpd_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+    if (H5Dread(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
         FAIL_STACK_ERROR
 
     /* Check that the values read are the same as the values written
-     * Use mask for checking the significant bits, ignoring the padding bits
+     * Assume size of long long = size of double
      */
-    i_mask = ~((unsigned)~0 << (precision[0] + offset[0])) & ((unsigned)~0 << offset[0]);
-    c_mask = ~((unsigned)~0 << (precision[1] + offset[1])) & ((unsigned)~0 << offset[1]);
-    s_mask = ~((unsigned)~0 << (precision[2] + offset[2])) & ((unsigned)~0 << offset[2]);
-    for (i = 0; i < size[0]; i++) {
-        for (j = 0; j < size[1]; j++) {
-            if (((unsigned)new_data[i][j].i & i_mask) != ((unsigned)orig_data[i][j].i & i_mask) ||
-                ((unsigned)new_data[i][j].c & c_mask) != ((unsigned)orig_data[i][j].c & c_mask) ||
-                ((unsigned)new_data[i][j].s & s_mask) != ((unsigned)orig_data[i][j].s & s_mask) ||
-                (!HDisnan(orig_data[i][j].f) && !H5_FLT_ABS_EQUAL(new_data[i][j].f, orig_data[i][j].f))) {
+    for (i = 0; i < (size_t)size[0]; i++) {
+        for (j = 0; j < (size_t)size[1]; j++) {
+            if (HDisnan(orig_data[i][j]))
+                continue; /* skip if value is NaN */
+            if (!H5_DBL_ABS_EQUAL(new_data[i][j], orig_data[i][j])) {
                 H5_FAILED();
                 HDprintf("    Read different values than written.\n");
                 HDprintf("    At index %lu,%lu\n", (unsigned long)i, (unsigned long)j);
@@ -3816,17 +4484,7 @@ test_nbit_compound(hid_t file)
      * Cleanup
      *----------------------------------------------------------------------
      */
-    if (H5Tclose(i_tid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tclose(c_tid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tclose(s_tid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tclose(f_tid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tclose(cmpd_tid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tclose(mem_cmpd_tid) < 0)
+    if (H5Tclose(datatype) < 0)
         FAIL_STACK_ERROR
     if (H5Pclose(dc) < 0)
         FAIL_STACK_ERROR
@@ -3841,63 +4499,187 @@ test_nbit_compound(hid_t file)
 
 error:
     return FAIL;
-} /* end test_nbit_compound() */
+} /* end test_nbit_double() */
 
 /*-------------------------------------------------------------------------
- * Function:    test_nbit_compound_2
+ * Function:    test_nbit_array
  *
- * Purpose:     Tests a complex version of compound datatype of nbit filter
+ * Purpose:     Tests the simple version array datatype for nbit filter
  *
  * Return:      Success:        0
- *
  *              Failure:        -1
- *
- * Programmer:  Xiaowen Wu
- *              Tuesday, Jan. 18th, 2005
- *
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_nbit_compound_2(hid_t file)
+test_nbit_array(hid_t file)
 {
-    typedef struct { /* Struct with atomic fields */
-        int   i;
-        char  c;
-        short s;
-        float f;
-    } atomic;
+    hid_t         dataset, base_datatype, array_datatype, space, dc;
+    hid_t         mem_base_datatype, mem_array_datatype;
+    const hsize_t size[2]       = {2, 5};
+    const hsize_t adims[2]      = {3, 2};
+    const hsize_t chunk_size[2] = {2, 5};
+    unsigned int  orig_data[2][5][3][2];
+    unsigned int  new_data[2][5][3][2];
+    size_t        precision, offset;
+    double        power;
+    size_t        i, j, m, n;
 
-    typedef struct { /* Struct with complex fields */
-        atomic       a;
-        unsigned int v;
-        char         b[2][2];
-        atomic       d[2][2];
-    } complex;
+    TESTING("    nbit array (setup)");
 
-    hid_t         i_tid, c_tid, s_tid, f_tid, v_tid;
-    hid_t         cmpd_tid1;           /* atomic compound datatype */
-    hid_t         cmpd_tid2;           /* complex compound datatype */
-    hid_t         mem_cmpd_tid1;       /* memory atomic compound datatype */
-    hid_t         mem_cmpd_tid2;       /* memory complex compound datatype */
-    hid_t         base_tid;            /* simple array datatype's base datatype */
-    hid_t         array_tid;           /* simple array datatype */
-    hid_t         array_cmplx_tid;     /* complex array datatype */
-    hid_t         mem_array_cmplx_tid; /* memory complex array datatype */
-    const hsize_t array_dims[2] = {2, 2};
-    size_t        precision[5]  = {31, 8, 10, 23, 8};
-    size_t        offset[5]     = {1, 0, 3, 5, 0};
+    /* Define dataset array datatype's base datatype and set precision, offset */
+    base_datatype = H5Tcopy(H5T_NATIVE_UINT);
+    precision     = 22;
+    if (H5Tset_precision(base_datatype, precision) < 0)
+        goto error;
+    offset = 7;
+    if (H5Tset_offset(base_datatype, offset) < 0)
+        goto error;
+
+    /* Copy to memory array datatype's base datatype before setting order */
+    mem_base_datatype = H5Tcopy(base_datatype);
+
+    /* Set order of dataset array datatype's base datatype */
+    if (H5Tset_order(base_datatype, H5T_ORDER_BE) < 0)
+        goto error;
+
+    /* Create dataset array datatype */
+    array_datatype = H5Tarray_create2(base_datatype, 2, adims);
+
+    /* Create memory array datatype */
+    mem_array_datatype = H5Tarray_create2(mem_base_datatype, 2, adims);
+
+    /* Create the data space */
+    if ((space = H5Screate_simple(2, size, NULL)) < 0)
+        goto error;
+
+    /* Use nbit filter  */
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+        goto error;
+    if (H5Pset_nbit(dc) < 0)
+        goto error;
+
+    /* Create the dataset */
+    if ((dataset =
+             H5Dcreate2(file, DSET_NBIT_ARRAY_NAME, array_datatype, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* Initialize data, assuming size of long long >= size of unsigned int */
+    for (i = 0; i < (size_t)size[0]; i++)
+        for (j = 0; j < (size_t)size[1]; j++)
+            for (m = 0; m < (size_t)adims[0]; m++)
+                for (n = 0; n < (size_t)adims[1]; n++) {
+                    power = HDpow(2.0F, (double)precision);
+                    orig_data[i][j][m][n] =
+                        (unsigned int)(((long long)HDrandom() % (long long)power) << offset);
+                } /* end for */
+    PASSED();
+
+    /*----------------------------------------------------------------------
+     * STEP 1: Test nbit by setting up a chunked dataset and writing
+     * to it.
+     *----------------------------------------------------------------------
+     */
+    TESTING("    nbit array (write)");
+
+    if (H5Dwrite(dataset, mem_array_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+        goto error;
+
+    PASSED();
+
+    /*----------------------------------------------------------------------
+     * STEP 2: Try to read the data we just wrote.
+     *----------------------------------------------------------------------
+     */
+    TESTING("    nbit array (read)");
+
+    /* Read the dataset back */
+    if (H5Dread(dataset, mem_array_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        goto error;
+
+    /* Check that the values read are the same as the values written
+     */
+    for (i = 0; i < (size_t)size[0]; i++)
+        for (j = 0; j < (size_t)size[1]; j++)
+            for (m = 0; m < (size_t)adims[0]; m++)
+                for (n = 0; n < (size_t)adims[1]; n++) {
+                    if (new_data[i][j][m][n] != orig_data[i][j][m][n]) {
+                        H5_FAILED();
+                        HDprintf("    Read different values than written.\n");
+                        HDprintf("    At index %lu,%lu,%lu,%lu\n", (unsigned long)i, (unsigned long)j,
+                                 (unsigned long)m, (unsigned long)n);
+                        goto error;
+                    }
+                }
+
+    /*----------------------------------------------------------------------
+     * Cleanup
+     *----------------------------------------------------------------------
+     */
+    if (H5Tclose(array_datatype) < 0)
+        goto error;
+    if (H5Tclose(base_datatype) < 0)
+        goto error;
+    if (H5Tclose(mem_array_datatype) < 0)
+        goto error;
+    if (H5Tclose(mem_base_datatype) < 0)
+        goto error;
+    if (H5Pclose(dc) < 0)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+    if (H5Dclose(dataset) < 0)
+        goto error;
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    return FAIL;
+} /* end test_nbit_array() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_nbit_compound
+ *
+ * Purpose:     Tests a simple version of compound datatype of nbit filter
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1
+ *
+ * Programmer:  Xiaowen Wu
+ *              Tuesday, Jan. 18th, 2005
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_nbit_compound(hid_t file)
+{
+    typedef struct { /* Struct with atomic fields */
+        int   i;
+        char  c;
+        short s;
+        float f;
+    } atomic;
+    hid_t         i_tid, c_tid, s_tid, f_tid;
+    hid_t         cmpd_tid;     /* atomic compound datatype */
+    hid_t         mem_cmpd_tid; /* memory atomic compound datatype */
+    size_t        precision[3] = {15, 7, 10};
+    size_t        offset[3]    = {9, 0, 3};
     hid_t         dataset, space, dc;
     const hsize_t size[2]         = {2, 5};
     const hsize_t chunk_size[2]   = {2, 5};
     const float   float_val[2][5] = {{188384.0F, 19.103516F, -1.0831790e9F, -84.242188F, 5.2045898F},
                                    {-49140.0F, 2350.25F, -3.2110596e-1F, 6.4998865e-5F, -0.0F}};
-    complex       orig_data[2][5];
-    complex       new_data[2][5];
-    unsigned int  i_mask, s_mask, c_mask, b_mask;
+    atomic        orig_data[2][5];
+    atomic        new_data[2][5];
+    unsigned int  i_mask, s_mask, c_mask;
     double        power;
-    size_t        i, j, m, n, b_failed, d_failed;
+    size_t        i, j;
 
-    TESTING("    nbit compound complex (setup)");
+    TESTING("    nbit compound (setup)");
 
     /* Define datatypes of members of compound datatype */
     if ((i_tid = H5Tcopy(H5T_NATIVE_INT)) < 0)
@@ -3906,12 +4688,10 @@ test_nbit_compound_2(hid_t file)
         FAIL_STACK_ERROR
     if ((s_tid = H5Tcopy(H5T_NATIVE_SHORT)) < 0)
         FAIL_STACK_ERROR
-    if ((v_tid = H5Tcopy(H5T_NATIVE_UINT)) < 0)
-        FAIL_STACK_ERROR
     if ((f_tid = H5Tcopy(H5T_IEEE_F32BE)) < 0)
         FAIL_STACK_ERROR
 
-    /* Set precision and offset etc. of atomic compound datatype members */
+    /* Set precision and offset etc. */
     if (H5Tset_precision(i_tid, precision[0]) < 0)
         FAIL_STACK_ERROR
     if (H5Tset_offset(i_tid, offset[0]) < 0)
@@ -3938,82 +4718,32 @@ test_nbit_compound_2(hid_t file)
     if (H5Tset_ebias(f_tid, (size_t)31) < 0)
         FAIL_STACK_ERROR
 
-    /* Create a memory atomic compound datatype before setting the order */
-    if ((mem_cmpd_tid1 = H5Tcreate(H5T_COMPOUND, sizeof(atomic))) < 0)
+    /* Create a memory compound datatype before setting the order */
+    if ((mem_cmpd_tid = H5Tcreate(H5T_COMPOUND, sizeof(atomic))) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(mem_cmpd_tid1, "i", HOFFSET(atomic, i), i_tid) < 0)
+    if (H5Tinsert(mem_cmpd_tid, "i", HOFFSET(atomic, i), i_tid) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(mem_cmpd_tid1, "c", HOFFSET(atomic, c), c_tid) < 0)
+    if (H5Tinsert(mem_cmpd_tid, "c", HOFFSET(atomic, c), c_tid) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(mem_cmpd_tid1, "s", HOFFSET(atomic, s), s_tid) < 0)
+    if (H5Tinsert(mem_cmpd_tid, "s", HOFFSET(atomic, s), s_tid) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(mem_cmpd_tid1, "f", HOFFSET(atomic, f), H5T_NATIVE_FLOAT) < 0)
+    if (H5Tinsert(mem_cmpd_tid, "f", HOFFSET(atomic, f), H5T_NATIVE_FLOAT) < 0)
         FAIL_STACK_ERROR
 
-    /* Create a dataset atomic compound datatype and insert some atomic types */
-    if ((cmpd_tid1 = H5Tcreate(H5T_COMPOUND, sizeof(atomic))) < 0)
+    /* Create a dataset compound datatype and insert some atomic types */
+    if ((cmpd_tid = H5Tcreate(H5T_COMPOUND, sizeof(atomic))) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(cmpd_tid1, "i", HOFFSET(atomic, i), i_tid) < 0)
+    if (H5Tinsert(cmpd_tid, "i", HOFFSET(atomic, i), i_tid) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(cmpd_tid1, "c", HOFFSET(atomic, c), c_tid) < 0)
+    if (H5Tinsert(cmpd_tid, "c", HOFFSET(atomic, c), c_tid) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(cmpd_tid1, "s", HOFFSET(atomic, s), s_tid) < 0)
+    if (H5Tinsert(cmpd_tid, "s", HOFFSET(atomic, s), s_tid) < 0)
         FAIL_STACK_ERROR
-    if (H5Tinsert(cmpd_tid1, "f", HOFFSET(atomic, f), f_tid) < 0)
+    if (H5Tinsert(cmpd_tid, "f", HOFFSET(atomic, f), f_tid) < 0)
         FAIL_STACK_ERROR
 
     /* Set order of dataset compound datatype */
-    if (H5Tset_order(cmpd_tid1, H5T_ORDER_BE) < 0)
-        FAIL_STACK_ERROR
-
-    /* Set precision and offset of the other data member */
-    if (H5Tset_precision(v_tid, precision[3]) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tset_offset(v_tid, offset[3]) < 0)
-        FAIL_STACK_ERROR
-
-    /* Create the simple array datatype */
-    if ((base_tid = H5Tcopy(H5T_NATIVE_CHAR)) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tset_precision(base_tid, precision[4]) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tset_offset(base_tid, offset[4]) < 0)
-        FAIL_STACK_ERROR
-    if ((array_tid = H5Tarray_create2(base_tid, 2, array_dims)) < 0)
-        FAIL_STACK_ERROR
-
-    /* Create the complex memory and dataset array datatype */
-    if ((array_cmplx_tid = H5Tarray_create2(cmpd_tid1, 2, array_dims)) < 0)
-        FAIL_STACK_ERROR
-    if ((mem_array_cmplx_tid = H5Tarray_create2(mem_cmpd_tid1, 2, array_dims)) < 0)
-        FAIL_STACK_ERROR
-
-    /* Create a memory complex compound datatype before setting the order */
-    if ((mem_cmpd_tid2 = H5Tcreate(H5T_COMPOUND, sizeof(complex))) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tinsert(mem_cmpd_tid2, "a", HOFFSET(complex, a), mem_cmpd_tid1) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tinsert(mem_cmpd_tid2, "v", HOFFSET(complex, v), v_tid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tinsert(mem_cmpd_tid2, "b", HOFFSET(complex, b), array_tid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tinsert(mem_cmpd_tid2, "d", HOFFSET(complex, d), mem_array_cmplx_tid) < 0)
-        FAIL_STACK_ERROR
-
-    /* Set order of dataset other complex compound member datatype */
-    if (H5Tset_order(v_tid, H5T_ORDER_BE) < 0)
-        FAIL_STACK_ERROR
-
-    /* Create a dataset complex compound datatype and insert members */
-    if ((cmpd_tid2 = H5Tcreate(H5T_COMPOUND, sizeof(complex))) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tinsert(cmpd_tid2, "a", HOFFSET(complex, a), cmpd_tid1) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tinsert(cmpd_tid2, "v", HOFFSET(complex, v), v_tid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tinsert(cmpd_tid2, "b", HOFFSET(complex, b), array_tid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tinsert(cmpd_tid2, "d", HOFFSET(complex, d), array_cmplx_tid) < 0)
+    if (H5Tset_order(cmpd_tid, H5T_ORDER_BE) < 0)
         FAIL_STACK_ERROR
 
     /* Create the data space */
@@ -4029,44 +4759,27 @@ test_nbit_compound_2(hid_t file)
         FAIL_STACK_ERROR
 
     /* Create the dataset */
-    if ((dataset =
-             H5Dcreate2(file, DSET_NBIT_COMPOUND_NAME_2, cmpd_tid2, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
+    if ((dataset = H5Dcreate2(file, DSET_NBIT_COMPOUND_NAME, cmpd_tid, space, H5P_DEFAULT, dc, H5P_DEFAULT)) <
+        0)
         FAIL_STACK_ERROR
 
     /* Initialize data, assuming size of long long >= size of member datatypes */
     for (i = 0; i < (size_t)size[0]; i++)
         for (j = 0; j < (size_t)size[1]; j++) {
-            power               = HDpow(2.0F, (double)(precision[0] - 1));
-            orig_data[i][j].a.i = (int)(((long long)HDrandom() % (long long)power) << offset[0]);
-            power               = HDpow(2.0F, (double)(precision[1] - 1));
-            orig_data[i][j].a.c = (char)(((long long)HDrandom() % (long long)power) << offset[1]);
-            power               = HDpow(2.0F, (double)(precision[2] - 1));
-            orig_data[i][j].a.s = (short)(-((long long)HDrandom() % (long long)power) << offset[2]);
-            orig_data[i][j].a.f = float_val[i][j];
-
-            power             = HDpow(2.0F, (double)precision[3]);
-            orig_data[i][j].v = (unsigned int)(((long long)HDrandom() % (long long)power) << offset[3]);
-
-            for (m = 0; m < (size_t)array_dims[0]; m++)
-                for (n = 0; n < (size_t)array_dims[1]; n++) {
-                    power                   = HDpow(2.0F, (double)(precision[4] - 1));
-                    orig_data[i][j].b[m][n] = (char)(((long long)HDrandom() % (long long)power) << offset[4]);
-                } /* end for */
+            power             = HDpow(2.0F, (double)(precision[0] - 1));
+            orig_data[i][j].i = (int)(((long long)HDrandom() % (long long)power) << offset[0]);
+            power             = HDpow(2.0F, (double)(precision[1] - 1));
+            orig_data[i][j].c = (char)(((long long)HDrandom() % (long long)power) << offset[1]);
+            power             = HDpow(2.0F, (double)(precision[2] - 1));
+            orig_data[i][j].s = (short)(((long long)HDrandom() % (long long)power) << offset[2]);
+            orig_data[i][j].f = float_val[i][j];
 
-            for (m = 0; m < (size_t)array_dims[0]; m++)
-                for (n = 0; n < (size_t)array_dims[1]; n++) {
-                    power = HDpow(2.0F, (double)(precision[0] - 1));
-                    orig_data[i][j].d[m][n].i =
-                        (int)(-((long long)HDrandom() % (long long)power) << offset[0]);
-                    power = HDpow(2.0F, (double)(precision[1] - 1));
-                    orig_data[i][j].d[m][n].c =
-                        (char)(((long long)HDrandom() % (long long)power) << offset[1]);
-                    power = HDpow(2.0F, (double)(precision[2] - 1));
-                    orig_data[i][j].d[m][n].s =
-                        (short)(((long long)HDrandom() % (long long)power) << offset[2]);
-                    orig_data[i][j].d[m][n].f = float_val[i][j];
-                } /* end for */
-        }         /* end for */
+            /* some even-numbered integer values are negtive */
+            if ((i * size[1] + j + 1) % 2 == 0) {
+                orig_data[i][j].i = -orig_data[i][j].i;
+                orig_data[i][j].s = (short)-orig_data[i][j].s;
+            }
+        }
 
     PASSED();
 
@@ -4075,9 +4788,9 @@ test_nbit_compound_2(hid_t file)
      * to it.
      *----------------------------------------------------------------------
      */
-    TESTING("    nbit compound complex (write)");
+    TESTING("    nbit compound (write)");
 
-    if (H5Dwrite(dataset, mem_cmpd_tid2, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+    if (H5Dwrite(dataset, mem_cmpd_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
         FAIL_STACK_ERROR
     PASSED();
 
@@ -4085,63 +4798,24 @@ test_nbit_compound_2(hid_t file)
      * STEP 2: Try to read the data we just wrote.
      *----------------------------------------------------------------------
      */
-    TESTING("    nbit compound complex (read)");
+    TESTING("    nbit compound (read)");
 
     /* Read the dataset back */
-    if (H5Dread(dataset, mem_cmpd_tid2, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+    if (H5Dread(dataset, mem_cmpd_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
         FAIL_STACK_ERROR
 
     /* Check that the values read are the same as the values written
      * Use mask for checking the significant bits, ignoring the padding bits
      */
-    /* The original code
-     *   i_mask = ~((unsigned)~0 << (precision[0] + offset[0])) & ((unsigned)~0 << offset[0]);
-     * left shift a 32-bit integer for 32-bit.  The result is undefined by C language.  A user
-     * discovered it using clang compiler with -fcatch-undefined-behavior option (see Issue 7674
-     * in Jira).  So I changed it in a funny way as below to avoid it. SLU - 2011/8/11
-     */
-    if (sizeof(unsigned) > 4)
-        i_mask = ~((unsigned)~0 << (precision[0] + offset[0])) & ((unsigned)~0 << offset[0]);
-    else {
-        i_mask = 0xffffffff;
-        i_mask = i_mask & ((unsigned)~0 << offset[0]);
-    }
+    i_mask = ~((unsigned)~0 << (precision[0] + offset[0])) & ((unsigned)~0 << offset[0]);
     c_mask = ~((unsigned)~0 << (precision[1] + offset[1])) & ((unsigned)~0 << offset[1]);
     s_mask = ~((unsigned)~0 << (precision[2] + offset[2])) & ((unsigned)~0 << offset[2]);
-    b_mask = ~((unsigned)~0 << (precision[4] + offset[4])) & ((unsigned)~0 << offset[4]);
-    for (i = 0; i < (size_t)size[0]; i++) {
-        for (j = 0; j < (size_t)size[1]; j++) {
-            b_failed = 0;
-            d_failed = 0;
-
-            for (m = 0; m < (size_t)array_dims[0]; m++)
-                for (n = 0; n < (size_t)array_dims[1]; n++)
-                    if (((unsigned)new_data[i][j].b[m][n] & b_mask) !=
-                        ((unsigned)orig_data[i][j].b[m][n] & b_mask)) {
-                        b_failed = 1;
-                        goto out;
-                    }
-
-            for (m = 0; m < (size_t)array_dims[0]; m++)
-                for (n = 0; n < (size_t)array_dims[1]; n++)
-                    if (((unsigned)new_data[i][j].d[m][n].i & i_mask) !=
-                            ((unsigned)orig_data[i][j].d[m][n].i & i_mask) ||
-                        ((unsigned)new_data[i][j].d[m][n].c & c_mask) !=
-                            ((unsigned)orig_data[i][j].d[m][n].c & c_mask) ||
-                        ((unsigned)new_data[i][j].d[m][n].s & s_mask) !=
-                            ((unsigned)orig_data[i][j].d[m][n].s & s_mask) ||
-                        (!HDisnan(new_data[i][j].d[m][n].f) &&
-                         !H5_FLT_ABS_EQUAL(new_data[i][j].d[m][n].f, new_data[i][j].d[m][n].f))) {
-                        d_failed = 1;
-                        goto out;
-                    }
-
-out:
-            if (((unsigned)new_data[i][j].a.i & i_mask) != ((unsigned)orig_data[i][j].a.i & i_mask) ||
-                ((unsigned)new_data[i][j].a.c & c_mask) != ((unsigned)orig_data[i][j].a.c & c_mask) ||
-                ((unsigned)new_data[i][j].a.s & s_mask) != ((unsigned)orig_data[i][j].a.s & s_mask) ||
-                (!HDisnan(new_data[i][j].a.f) && !H5_FLT_ABS_EQUAL(new_data[i][j].a.f, new_data[i][j].a.f)) ||
-                new_data[i][j].v != orig_data[i][j].v || b_failed || d_failed) {
+    for (i = 0; i < size[0]; i++) {
+        for (j = 0; j < size[1]; j++) {
+            if (((unsigned)new_data[i][j].i & i_mask) != ((unsigned)orig_data[i][j].i & i_mask) ||
+                ((unsigned)new_data[i][j].c & c_mask) != ((unsigned)orig_data[i][j].c & c_mask) ||
+                ((unsigned)new_data[i][j].s & s_mask) != ((unsigned)orig_data[i][j].s & s_mask) ||
+                (!HDisnan(orig_data[i][j].f) && !H5_FLT_ABS_EQUAL(new_data[i][j].f, orig_data[i][j].f))) {
                 H5_FAILED();
                 HDprintf("    Read different values than written.\n");
                 HDprintf("    At index %lu,%lu\n", (unsigned long)i, (unsigned long)j);
@@ -4162,23 +4836,9 @@ out:
         FAIL_STACK_ERROR
     if (H5Tclose(f_tid) < 0)
         FAIL_STACK_ERROR
-    if (H5Tclose(v_tid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tclose(cmpd_tid2) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tclose(cmpd_tid1) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tclose(mem_cmpd_tid2) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tclose(mem_cmpd_tid1) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tclose(array_tid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tclose(base_tid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tclose(array_cmplx_tid) < 0)
+    if (H5Tclose(cmpd_tid) < 0)
         FAIL_STACK_ERROR
-    if (H5Tclose(mem_array_cmplx_tid) < 0)
+    if (H5Tclose(mem_cmpd_tid) < 0)
         FAIL_STACK_ERROR
     if (H5Pclose(dc) < 0)
         FAIL_STACK_ERROR
@@ -4193,123 +4853,232 @@ out:
 
 error:
     return FAIL;
-} /* end test_nbit_compound_2() */
+} /* end test_nbit_compound() */
 
 /*-------------------------------------------------------------------------
- * Function:    test_nbit_compound_3
+ * Function:    test_nbit_compound_2
  *
- * Purpose:     Tests no-op datatypes in compound datatype for nbit filter
+ * Purpose:     Tests a complex version of compound datatype of nbit filter
  *
  * Return:      Success:        0
  *
  *              Failure:        -1
  *
  * Programmer:  Xiaowen Wu
- *              Thursday, Mar. 31th, 2005
+ *              Tuesday, Jan. 18th, 2005
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_nbit_compound_3(hid_t file)
+test_nbit_compound_2(hid_t file)
 {
-    typedef struct {           /* Struct with some no-op type fields */
-        int           i;       /* integer field, NOT a no-op type */
-        char          str[30]; /* fixed-length string, no-op type */
-        char *        vl_str;  /* varible-length string, no-op type */
-        hvl_t         v;       /* VL datatype field, no-op type */
-        hobj_ref_t    r;       /* Object reference field, no-op type */
-        unsigned char o[5];    /* Opaque field, no-op type */
+    typedef struct { /* Struct with atomic fields */
+        int   i;
+        char  c;
+        short s;
+        float f;
     } atomic;
-    hid_t         i_tid, str_tid, vl_str_tid, v_tid, o_tid;
-    hid_t         cmpd_tid; /* atomic compound datatype */
-    hid_t         dataset, space, dc, obj_ref_dataset = -1;
-    const hsize_t size[1]       = {5};
-    const hsize_t chunk_size[1] = {5};
-    atomic        orig_data[5];
-    atomic        new_data[5];
+
+    typedef struct { /* Struct with complex fields */
+        atomic       a;
+        unsigned int v;
+        char         b[2][2];
+        atomic       d[2][2];
+    } complex;
+
+    hid_t         i_tid, c_tid, s_tid, f_tid, v_tid;
+    hid_t         cmpd_tid1;           /* atomic compound datatype */
+    hid_t         cmpd_tid2;           /* complex compound datatype */
+    hid_t         mem_cmpd_tid1;       /* memory atomic compound datatype */
+    hid_t         mem_cmpd_tid2;       /* memory complex compound datatype */
+    hid_t         base_tid;            /* simple array datatype's base datatype */
+    hid_t         array_tid;           /* simple array datatype */
+    hid_t         array_cmplx_tid;     /* complex array datatype */
+    hid_t         mem_array_cmplx_tid; /* memory complex array datatype */
+    const hsize_t array_dims[2] = {2, 2};
+    size_t        precision[5]  = {31, 8, 10, 23, 8};
+    size_t        offset[5]     = {1, 0, 3, 5, 0};
+    hid_t         dataset, space, dc;
+    const hsize_t size[2]         = {2, 5};
+    const hsize_t chunk_size[2]   = {2, 5};
+    const float   float_val[2][5] = {{188384.0F, 19.103516F, -1.0831790e9F, -84.242188F, 5.2045898F},
+                                   {-49140.0F, 2350.25F, -3.2110596e-1F, 6.4998865e-5F, -0.0F}};
+    complex       orig_data[2][5];
+    complex       new_data[2][5];
+    unsigned int  i_mask, s_mask, c_mask, b_mask;
     double        power;
-    size_t        i, k, j;
+    size_t        i, j, m, n, b_failed, d_failed;
 
-    TESTING("    nbit compound with no-op type (setup)");
+    TESTING("    nbit compound complex (setup)");
 
     /* Define datatypes of members of compound datatype */
-    i_tid = H5Tcopy(H5T_NATIVE_INT);
-    if (H5Tset_precision(i_tid, (size_t)17) < 0)
-        goto error;
-
-    str_tid = H5Tcopy(H5T_C_S1);
-    if (H5Tset_size(str_tid, (size_t)30) < 0)
-        goto error;
+    if ((i_tid = H5Tcopy(H5T_NATIVE_INT)) < 0)
+        FAIL_STACK_ERROR
+    if ((c_tid = H5Tcopy(H5T_NATIVE_CHAR)) < 0)
+        FAIL_STACK_ERROR
+    if ((s_tid = H5Tcopy(H5T_NATIVE_SHORT)) < 0)
+        FAIL_STACK_ERROR
+    if ((v_tid = H5Tcopy(H5T_NATIVE_UINT)) < 0)
+        FAIL_STACK_ERROR
+    if ((f_tid = H5Tcopy(H5T_IEEE_F32BE)) < 0)
+        FAIL_STACK_ERROR
 
-    vl_str_tid = H5Tcopy(H5T_C_S1);
-    if (H5Tset_size(vl_str_tid, H5T_VARIABLE) < 0)
-        goto error;
+    /* Set precision and offset etc. of atomic compound datatype members */
+    if (H5Tset_precision(i_tid, precision[0]) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_offset(i_tid, offset[0]) < 0)
+        FAIL_STACK_ERROR
 
-    if ((v_tid = H5Tvlen_create(H5T_NATIVE_UINT)) < 0)
-        goto error;
+    if (H5Tset_precision(c_tid, precision[1]) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_offset(c_tid, offset[1]) < 0)
+        FAIL_STACK_ERROR
 
-    if ((o_tid = H5Tcreate(H5T_OPAQUE, (size_t)5)) < 0)
-        goto error;
-    if (H5Tset_tag(o_tid, "testing opaque field") < 0)
-        goto error;
+    if (H5Tset_precision(s_tid, precision[2]) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_offset(s_tid, offset[2]) < 0)
+        FAIL_STACK_ERROR
 
-    /* Create a dataset compound datatype and insert some atomic types */
-    cmpd_tid = H5Tcreate(H5T_COMPOUND, sizeof(atomic));
-    if (H5Tinsert(cmpd_tid, "i", HOFFSET(atomic, i), i_tid) < 0)
-        goto error;
-    if (H5Tinsert(cmpd_tid, "str", HOFFSET(atomic, str), str_tid) < 0)
-        goto error;
-    if (H5Tinsert(cmpd_tid, "vl_str", HOFFSET(atomic, vl_str), vl_str_tid) < 0)
-        goto error;
-    if (H5Tinsert(cmpd_tid, "v", HOFFSET(atomic, v), v_tid) < 0)
-        goto error;
-    if (H5Tinsert(cmpd_tid, "r", HOFFSET(atomic, r), H5T_STD_REF_OBJ) < 0)
-        goto error;
-    if (H5Tinsert(cmpd_tid, "o", HOFFSET(atomic, o), o_tid) < 0)
-        goto error;
+    if (H5Tset_fields(f_tid, (size_t)26, (size_t)20, (size_t)6, (size_t)7, (size_t)13) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_offset(f_tid, (size_t)7) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_precision(f_tid, (size_t)20) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_size(f_tid, (size_t)4) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_ebias(f_tid, (size_t)31) < 0)
+        FAIL_STACK_ERROR
 
-    /* Create the data space */
-    if ((space = H5Screate_simple(1, size, NULL)) < 0)
-        goto error;
+    /* Create a memory atomic compound datatype before setting the order */
+    if ((mem_cmpd_tid1 = H5Tcreate(H5T_COMPOUND, sizeof(atomic))) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(mem_cmpd_tid1, "i", HOFFSET(atomic, i), i_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(mem_cmpd_tid1, "c", HOFFSET(atomic, c), c_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(mem_cmpd_tid1, "s", HOFFSET(atomic, s), s_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(mem_cmpd_tid1, "f", HOFFSET(atomic, f), H5T_NATIVE_FLOAT) < 0)
+        FAIL_STACK_ERROR
 
-    /* Use nbit filter  */
-    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-        goto error;
-    if (H5Pset_chunk(dc, 1, chunk_size) < 0)
-        goto error;
-    if (H5Pset_nbit(dc) < 0)
-        goto error;
+    /* Create a dataset atomic compound datatype and insert some atomic types */
+    if ((cmpd_tid1 = H5Tcreate(H5T_COMPOUND, sizeof(atomic))) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(cmpd_tid1, "i", HOFFSET(atomic, i), i_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(cmpd_tid1, "c", HOFFSET(atomic, c), c_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(cmpd_tid1, "s", HOFFSET(atomic, s), s_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(cmpd_tid1, "f", HOFFSET(atomic, f), f_tid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Set order of dataset compound datatype */
+    if (H5Tset_order(cmpd_tid1, H5T_ORDER_BE) < 0)
+        FAIL_STACK_ERROR
+
+    /* Set precision and offset of the other data member */
+    if (H5Tset_precision(v_tid, precision[3]) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_offset(v_tid, offset[3]) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create the simple array datatype */
+    if ((base_tid = H5Tcopy(H5T_NATIVE_CHAR)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_precision(base_tid, precision[4]) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_offset(base_tid, offset[4]) < 0)
+        FAIL_STACK_ERROR
+    if ((array_tid = H5Tarray_create2(base_tid, 2, array_dims)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create the complex memory and dataset array datatype */
+    if ((array_cmplx_tid = H5Tarray_create2(cmpd_tid1, 2, array_dims)) < 0)
+        FAIL_STACK_ERROR
+    if ((mem_array_cmplx_tid = H5Tarray_create2(mem_cmpd_tid1, 2, array_dims)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create a memory complex compound datatype before setting the order */
+    if ((mem_cmpd_tid2 = H5Tcreate(H5T_COMPOUND, sizeof(complex))) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(mem_cmpd_tid2, "a", HOFFSET(complex, a), mem_cmpd_tid1) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(mem_cmpd_tid2, "v", HOFFSET(complex, v), v_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(mem_cmpd_tid2, "b", HOFFSET(complex, b), array_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(mem_cmpd_tid2, "d", HOFFSET(complex, d), mem_array_cmplx_tid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Set order of dataset other complex compound member datatype */
+    if (H5Tset_order(v_tid, H5T_ORDER_BE) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create a dataset complex compound datatype and insert members */
+    if ((cmpd_tid2 = H5Tcreate(H5T_COMPOUND, sizeof(complex))) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(cmpd_tid2, "a", HOFFSET(complex, a), cmpd_tid1) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(cmpd_tid2, "v", HOFFSET(complex, v), v_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(cmpd_tid2, "b", HOFFSET(complex, b), array_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(cmpd_tid2, "d", HOFFSET(complex, d), array_cmplx_tid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create the data space */
+    if ((space = H5Screate_simple(2, size, NULL)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Use nbit filter  */
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_nbit(dc) < 0)
+        FAIL_STACK_ERROR
 
     /* Create the dataset */
     if ((dataset =
-             H5Dcreate2(file, DSET_NBIT_COMPOUND_NAME_3, cmpd_tid, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
-        goto error;
-
-    /* Create the dataset object reference points to */
-    if ((obj_ref_dataset = H5Dcreate2(file, "nbit_obj_ref", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT,
-                                      H5P_DEFAULT)) < 0)
-        goto error;
+             H5Dcreate2(file, DSET_NBIT_COMPOUND_NAME_2, cmpd_tid2, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
 
-    /* Initialize data */
-    for (i = 0; i < (size_t)size[0]; i++) {
-        power = HDpow(2.0F, 17.0F - 1.0F);
-        HDmemset(&orig_data[i], 0, sizeof(orig_data[i]));
-        orig_data[i].i = (int)(HDrandom() % (long)power);
-        HDstrcpy(orig_data[i].str, "fixed-length C string");
-        orig_data[i].vl_str = HDstrdup("variable-length C string");
+    /* Initialize data, assuming size of long long >= size of member datatypes */
+    for (i = 0; i < (size_t)size[0]; i++)
+        for (j = 0; j < (size_t)size[1]; j++) {
+            power               = HDpow(2.0F, (double)(precision[0] - 1));
+            orig_data[i][j].a.i = (int)(((long long)HDrandom() % (long long)power) << offset[0]);
+            power               = HDpow(2.0F, (double)(precision[1] - 1));
+            orig_data[i][j].a.c = (char)(((long long)HDrandom() % (long long)power) << offset[1]);
+            power               = HDpow(2.0F, (double)(precision[2] - 1));
+            orig_data[i][j].a.s = (short)(-((long long)HDrandom() % (long long)power) << offset[2]);
+            orig_data[i][j].a.f = float_val[i][j];
 
-        orig_data[i].v.p   = HDmalloc((size_t)(i + 1) * sizeof(unsigned int));
-        orig_data[i].v.len = (size_t)i + 1;
-        for (k = 0; k < (i + 1); k++)
-            ((unsigned int *)orig_data[i].v.p)[k] = (unsigned int)(i * 100 + k);
+            power             = HDpow(2.0F, (double)precision[3]);
+            orig_data[i][j].v = (unsigned int)(((long long)HDrandom() % (long long)power) << offset[3]);
 
-        /* Create reference to the dataset "nbit_obj_ref" */
-        if (H5Rcreate(&orig_data[i].r, file, "nbit_obj_ref", H5R_OBJECT, (hid_t)-1) < 0)
-            goto error;
+            for (m = 0; m < (size_t)array_dims[0]; m++)
+                for (n = 0; n < (size_t)array_dims[1]; n++) {
+                    power                   = HDpow(2.0F, (double)(precision[4] - 1));
+                    orig_data[i][j].b[m][n] = (char)(((long long)HDrandom() % (long long)power) << offset[4]);
+                } /* end for */
 
-        for (j = 0; j < 5; j++)
-            orig_data[i].o[j] = (unsigned char)(i + j);
-    }
+            for (m = 0; m < (size_t)array_dims[0]; m++)
+                for (n = 0; n < (size_t)array_dims[1]; n++) {
+                    power = HDpow(2.0F, (double)(precision[0] - 1));
+                    orig_data[i][j].d[m][n].i =
+                        (int)(-((long long)HDrandom() % (long long)power) << offset[0]);
+                    power = HDpow(2.0F, (double)(precision[1] - 1));
+                    orig_data[i][j].d[m][n].c =
+                        (char)(((long long)HDrandom() % (long long)power) << offset[1]);
+                    power = HDpow(2.0F, (double)(precision[2] - 1));
+                    orig_data[i][j].d[m][n].s =
+                        (short)(((long long)HDrandom() % (long long)power) << offset[2]);
+                    orig_data[i][j].d[m][n].f = float_val[i][j];
+                } /* end for */
+        }         /* end for */
 
     PASSED();
 
@@ -4318,72 +5087,315 @@ test_nbit_compound_3(hid_t file)
      * to it.
      *----------------------------------------------------------------------
      */
-    TESTING("    nbit compound with no-op type (write)");
+    TESTING("    nbit compound complex (write)");
 
-    if (H5Dwrite(dataset, cmpd_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
-        goto error;
+    if (H5Dwrite(dataset, mem_cmpd_tid2, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+        FAIL_STACK_ERROR
     PASSED();
 
     /*----------------------------------------------------------------------
      * STEP 2: Try to read the data we just wrote.
      *----------------------------------------------------------------------
      */
-    TESTING("    nbit compound with no-op type (read)");
+    TESTING("    nbit compound complex (read)");
 
     /* Read the dataset back */
-    if (H5Dread(dataset, cmpd_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
-        goto error;
+    if (H5Dread(dataset, mem_cmpd_tid2, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        FAIL_STACK_ERROR
 
-    /* Check that the values read are the same as the values written */
+    /* Check that the values read are the same as the values written
+     * Use mask for checking the significant bits, ignoring the padding bits
+     */
+    /* The original code
+     *   i_mask = ~((unsigned)~0 << (precision[0] + offset[0])) & ((unsigned)~0 << offset[0]);
+     * left shift a 32-bit integer for 32-bit.  The result is undefined by C language.  A user
+     * discovered it using clang compiler with -fcatch-undefined-behavior option (see Issue 7674
+     * in Jira).  So I changed it in a funny way as below to avoid it. SLU - 2011/8/11
+     */
+    if (sizeof(unsigned) > 4)
+        i_mask = ~((unsigned)~0 << (precision[0] + offset[0])) & ((unsigned)~0 << offset[0]);
+    else {
+        i_mask = 0xffffffff;
+        i_mask = i_mask & ((unsigned)~0 << offset[0]);
+    }
+    c_mask = ~((unsigned)~0 << (precision[1] + offset[1])) & ((unsigned)~0 << offset[1]);
+    s_mask = ~((unsigned)~0 << (precision[2] + offset[2])) & ((unsigned)~0 << offset[2]);
+    b_mask = ~((unsigned)~0 << (precision[4] + offset[4])) & ((unsigned)~0 << offset[4]);
     for (i = 0; i < (size_t)size[0]; i++) {
-        if (new_data[i].i != orig_data[i].i || strcmp(new_data[i].str, orig_data[i].str) != 0 ||
-            strcmp(new_data[i].vl_str, orig_data[i].vl_str) != 0 || new_data[i].v.len != orig_data[i].v.len ||
-            new_data[i].r != orig_data[i].r) {
-            H5_FAILED();
-            HDprintf("    Read different values than written.\n");
-            HDprintf("    At index %lu\n", (unsigned long)i);
-            goto error;
-        }
+        for (j = 0; j < (size_t)size[1]; j++) {
+            b_failed = 0;
+            d_failed = 0;
 
-        for (k = 0; k < i + 1; k++)
-            if (((unsigned int *)orig_data[i].v.p)[k] != ((unsigned int *)new_data[i].v.p)[k]) {
-                H5_FAILED();
-                HDprintf("    Read different values than written.\n");
-                HDprintf("    At index %lu\n", (unsigned long)i);
-                goto error;
-            }
+            for (m = 0; m < (size_t)array_dims[0]; m++)
+                for (n = 0; n < (size_t)array_dims[1]; n++)
+                    if (((unsigned)new_data[i][j].b[m][n] & b_mask) !=
+                        ((unsigned)orig_data[i][j].b[m][n] & b_mask)) {
+                        b_failed = 1;
+                        goto out;
+                    }
 
-        for (j = 0; j < 5; j++)
-            if (orig_data[i].o[j] != new_data[i].o[j]) {
+            for (m = 0; m < (size_t)array_dims[0]; m++)
+                for (n = 0; n < (size_t)array_dims[1]; n++)
+                    if (((unsigned)new_data[i][j].d[m][n].i & i_mask) !=
+                            ((unsigned)orig_data[i][j].d[m][n].i & i_mask) ||
+                        ((unsigned)new_data[i][j].d[m][n].c & c_mask) !=
+                            ((unsigned)orig_data[i][j].d[m][n].c & c_mask) ||
+                        ((unsigned)new_data[i][j].d[m][n].s & s_mask) !=
+                            ((unsigned)orig_data[i][j].d[m][n].s & s_mask) ||
+                        (!HDisnan(new_data[i][j].d[m][n].f) &&
+                         !H5_FLT_ABS_EQUAL(new_data[i][j].d[m][n].f, new_data[i][j].d[m][n].f))) {
+                        d_failed = 1;
+                        goto out;
+                    }
+
+out:
+            if (((unsigned)new_data[i][j].a.i & i_mask) != ((unsigned)orig_data[i][j].a.i & i_mask) ||
+                ((unsigned)new_data[i][j].a.c & c_mask) != ((unsigned)orig_data[i][j].a.c & c_mask) ||
+                ((unsigned)new_data[i][j].a.s & s_mask) != ((unsigned)orig_data[i][j].a.s & s_mask) ||
+                (!HDisnan(new_data[i][j].a.f) && !H5_FLT_ABS_EQUAL(new_data[i][j].a.f, new_data[i][j].a.f)) ||
+                new_data[i][j].v != orig_data[i][j].v || b_failed || d_failed) {
                 H5_FAILED();
                 HDprintf("    Read different values than written.\n");
-                HDprintf("    At index %lu\n", (unsigned long)i);
+                HDprintf("    At index %lu,%lu\n", (unsigned long)i, (unsigned long)j);
                 goto error;
             }
+        }
     }
 
     /*----------------------------------------------------------------------
      * Cleanup
      *----------------------------------------------------------------------
      */
-    if (H5Treclaim(cmpd_tid, space, H5P_DEFAULT, new_data) < 0)
-        goto error;
-    if (H5Treclaim(cmpd_tid, space, H5P_DEFAULT, orig_data) < 0)
-        goto error;
     if (H5Tclose(i_tid) < 0)
-        goto error;
-    if (H5Tclose(str_tid) < 0)
-        goto error;
-    if (H5Tclose(vl_str_tid) < 0)
-        goto error;
+        FAIL_STACK_ERROR
+    if (H5Tclose(c_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tclose(s_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tclose(f_tid) < 0)
+        FAIL_STACK_ERROR
     if (H5Tclose(v_tid) < 0)
-        goto error;
-    if (H5Tclose(o_tid) < 0)
-        goto error;
-    if (H5Tclose(cmpd_tid) < 0)
-        goto error;
+        FAIL_STACK_ERROR
+    if (H5Tclose(cmpd_tid2) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tclose(cmpd_tid1) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tclose(mem_cmpd_tid2) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tclose(mem_cmpd_tid1) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tclose(array_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tclose(base_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tclose(array_cmplx_tid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tclose(mem_array_cmplx_tid) < 0)
+        FAIL_STACK_ERROR
     if (H5Pclose(dc) < 0)
-        goto error;
+        FAIL_STACK_ERROR
+    if (H5Sclose(space) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(dataset) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    return FAIL;
+} /* end test_nbit_compound_2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_nbit_compound_3
+ *
+ * Purpose:     Tests no-op datatypes in compound datatype for nbit filter
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1
+ *
+ * Programmer:  Xiaowen Wu
+ *              Thursday, Mar. 31th, 2005
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_nbit_compound_3(hid_t file)
+{
+    typedef struct {           /* Struct with some no-op type fields */
+        int           i;       /* integer field, NOT a no-op type */
+        char          str[30]; /* fixed-length string, no-op type */
+        char *        vl_str;  /* varible-length string, no-op type */
+        hvl_t         v;       /* VL datatype field, no-op type */
+        hobj_ref_t    r;       /* Object reference field, no-op type */
+        unsigned char o[5];    /* Opaque field, no-op type */
+    } atomic;
+    hid_t         i_tid, str_tid, vl_str_tid, v_tid, o_tid;
+    hid_t         cmpd_tid; /* atomic compound datatype */
+    hid_t         dataset, space, dc, obj_ref_dataset = -1;
+    const hsize_t size[1]       = {5};
+    const hsize_t chunk_size[1] = {5};
+    atomic        orig_data[5];
+    atomic        new_data[5];
+    double        power;
+    size_t        i, k, j;
+
+    TESTING("    nbit compound with no-op type (setup)");
+
+    /* Define datatypes of members of compound datatype */
+    i_tid = H5Tcopy(H5T_NATIVE_INT);
+    if (H5Tset_precision(i_tid, (size_t)17) < 0)
+        goto error;
+
+    str_tid = H5Tcopy(H5T_C_S1);
+    if (H5Tset_size(str_tid, (size_t)30) < 0)
+        goto error;
+
+    vl_str_tid = H5Tcopy(H5T_C_S1);
+    if (H5Tset_size(vl_str_tid, H5T_VARIABLE) < 0)
+        goto error;
+
+    if ((v_tid = H5Tvlen_create(H5T_NATIVE_UINT)) < 0)
+        goto error;
+
+    if ((o_tid = H5Tcreate(H5T_OPAQUE, (size_t)5)) < 0)
+        goto error;
+    if (H5Tset_tag(o_tid, "testing opaque field") < 0)
+        goto error;
+
+    /* Create a dataset compound datatype and insert some atomic types */
+    cmpd_tid = H5Tcreate(H5T_COMPOUND, sizeof(atomic));
+    if (H5Tinsert(cmpd_tid, "i", HOFFSET(atomic, i), i_tid) < 0)
+        goto error;
+    if (H5Tinsert(cmpd_tid, "str", HOFFSET(atomic, str), str_tid) < 0)
+        goto error;
+    if (H5Tinsert(cmpd_tid, "vl_str", HOFFSET(atomic, vl_str), vl_str_tid) < 0)
+        goto error;
+    if (H5Tinsert(cmpd_tid, "v", HOFFSET(atomic, v), v_tid) < 0)
+        goto error;
+    if (H5Tinsert(cmpd_tid, "r", HOFFSET(atomic, r), H5T_STD_REF_OBJ) < 0)
+        goto error;
+    if (H5Tinsert(cmpd_tid, "o", HOFFSET(atomic, o), o_tid) < 0)
+        goto error;
+
+    /* Create the data space */
+    if ((space = H5Screate_simple(1, size, NULL)) < 0)
+        goto error;
+
+    /* Use nbit filter  */
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dc, 1, chunk_size) < 0)
+        goto error;
+    if (H5Pset_nbit(dc) < 0)
+        goto error;
+
+    /* Create the dataset */
+    if ((dataset =
+             H5Dcreate2(file, DSET_NBIT_COMPOUND_NAME_3, cmpd_tid, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* Create the dataset object reference points to */
+    if ((obj_ref_dataset = H5Dcreate2(file, "nbit_obj_ref", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT,
+                                      H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* Initialize data */
+    for (i = 0; i < (size_t)size[0]; i++) {
+        power = HDpow(2.0F, 17.0F - 1.0F);
+        HDmemset(&orig_data[i], 0, sizeof(orig_data[i]));
+        orig_data[i].i = (int)(HDrandom() % (long)power);
+        HDstrcpy(orig_data[i].str, "fixed-length C string");
+        orig_data[i].vl_str = HDstrdup("variable-length C string");
+
+        orig_data[i].v.p   = HDmalloc((size_t)(i + 1) * sizeof(unsigned int));
+        orig_data[i].v.len = (size_t)i + 1;
+        for (k = 0; k < (i + 1); k++)
+            ((unsigned int *)orig_data[i].v.p)[k] = (unsigned int)(i * 100 + k);
+
+        /* Create reference to the dataset "nbit_obj_ref" */
+        if (H5Rcreate(&orig_data[i].r, file, "nbit_obj_ref", H5R_OBJECT, (hid_t)-1) < 0)
+            goto error;
+
+        for (j = 0; j < 5; j++)
+            orig_data[i].o[j] = (unsigned char)(i + j);
+    }
+
+    PASSED();
+
+    /*----------------------------------------------------------------------
+     * STEP 1: Test nbit by setting up a chunked dataset and writing
+     * to it.
+     *----------------------------------------------------------------------
+     */
+    TESTING("    nbit compound with no-op type (write)");
+
+    if (H5Dwrite(dataset, cmpd_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+        goto error;
+    PASSED();
+
+    /*----------------------------------------------------------------------
+     * STEP 2: Try to read the data we just wrote.
+     *----------------------------------------------------------------------
+     */
+    TESTING("    nbit compound with no-op type (read)");
+
+    /* Read the dataset back */
+    if (H5Dread(dataset, cmpd_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        goto error;
+
+    /* Check that the values read are the same as the values written */
+    for (i = 0; i < (size_t)size[0]; i++) {
+        if (new_data[i].i != orig_data[i].i || strcmp(new_data[i].str, orig_data[i].str) != 0 ||
+            strcmp(new_data[i].vl_str, orig_data[i].vl_str) != 0 || new_data[i].v.len != orig_data[i].v.len ||
+            new_data[i].r != orig_data[i].r) {
+            H5_FAILED();
+            HDprintf("    Read different values than written.\n");
+            HDprintf("    At index %lu\n", (unsigned long)i);
+            goto error;
+        }
+
+        for (k = 0; k < i + 1; k++)
+            if (((unsigned int *)orig_data[i].v.p)[k] != ((unsigned int *)new_data[i].v.p)[k]) {
+                H5_FAILED();
+                HDprintf("    Read different values than written.\n");
+                HDprintf("    At index %lu\n", (unsigned long)i);
+                goto error;
+            }
+
+        for (j = 0; j < 5; j++)
+            if (orig_data[i].o[j] != new_data[i].o[j]) {
+                H5_FAILED();
+                HDprintf("    Read different values than written.\n");
+                HDprintf("    At index %lu\n", (unsigned long)i);
+                goto error;
+            }
+    }
+
+    /*----------------------------------------------------------------------
+     * Cleanup
+     *----------------------------------------------------------------------
+     */
+    if (H5Treclaim(cmpd_tid, space, H5P_DEFAULT, new_data) < 0)
+        goto error;
+    if (H5Treclaim(cmpd_tid, space, H5P_DEFAULT, orig_data) < 0)
+        goto error;
+    if (H5Tclose(i_tid) < 0)
+        goto error;
+    if (H5Tclose(str_tid) < 0)
+        goto error;
+    if (H5Tclose(vl_str_tid) < 0)
+        goto error;
+    if (H5Tclose(v_tid) < 0)
+        goto error;
+    if (H5Tclose(o_tid) < 0)
+        goto error;
+    if (H5Tclose(cmpd_tid) < 0)
+        goto error;
+    if (H5Pclose(dc) < 0)
+        goto error;
     if (H5Sclose(space) < 0)
         goto error;
     if (H5Dclose(obj_ref_dataset) < 0)
@@ -11621,62 +12633,938 @@ test_unfiltered_edge_chunks(hid_t fapl)
     if (count_nbytes_written != (size_t)(2 * cdim[0] * cdim[1]))
         TEST_ERROR
 
-    /* Close IDs */
-    if (H5Dclose(did) < 0)
-        TEST_ERROR
-    if (H5Pclose(dcpl) < 0)
-        TEST_ERROR
-    if (H5Sclose(sid) < 0)
-        TEST_ERROR
+    /* Close IDs */
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_unfiltered_edge_chunks() */
+
+/*-------------------------------------------------------------------------
+ * Function: test_large_chunk_shrink
+ *
+ * Purpose: Tests support for shrinking a chunk larger than 1 MB by a
+ *              size greater than 1 MB.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ * Programmer:  Neil Fortner
+ *              Monday, November 31, 2011
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_large_chunk_shrink(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    hid_t    fid        = -1;         /* File ID */
+    hid_t    dcpl       = -1;         /* Dataset creation property list ID */
+    hid_t    sid        = -1;         /* Dataspace ID */
+    hid_t    scalar_sid = -1;         /* Scalar dataspace ID */
+    hid_t    dsid       = -1;         /* Dataset ID */
+    hsize_t  dim, max_dim, chunk_dim; /* Dataset and chunk dimensions */
+    hsize_t  hs_offset;               /* Hyperslab offset */
+    hsize_t  hs_size;                 /* Hyperslab size */
+    unsigned write_elem, read_elem;   /* Element written/read */
+
+    TESTING("shrinking large chunk");
+
+    h5_fixname(FILENAME[10], fapl, filename, sizeof filename);
+
+    /* Create file */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create dataset creation property list */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Set 2 MB chunk size */
+    chunk_dim = 2 * 1024 * 1024 / sizeof(unsigned);
+    if (H5Pset_chunk(dcpl, 1, &chunk_dim) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create scalar dataspace */
+    if ((scalar_sid = H5Screate(H5S_SCALAR)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create 1-D dataspace */
+    dim     = 2 * 1024 * 1024 / sizeof(unsigned);
+    max_dim = H5S_UNLIMITED;
+    if ((sid = H5Screate_simple(1, &dim, &max_dim)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create 2 MB chunked dataset */
+    if ((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_UINT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Select last element in the dataset */
+    hs_offset = dim - 1;
+    hs_size   = 1;
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, &hs_offset, NULL, &hs_size, NULL) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read (unwritten) element from dataset */
+    read_elem = 1;
+    if (H5Dread(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &read_elem) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify unwritten element is fill value (0) */
+    if (read_elem != 0)
+        FAIL_PUTS_ERROR("invalid unwritten element read");
+
+    /* Write element to dataset */
+    write_elem = 2;
+    if (H5Dwrite(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &write_elem) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read element from dataset */
+    read_elem = write_elem + 1;
+    if (H5Dread(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &read_elem) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify written element is read in */
+    if (read_elem != write_elem)
+        FAIL_PUTS_ERROR("invalid written element read");
+
+    /* Shrink dataset to 512 KB */
+    dim = 512 * 1024 / sizeof(unsigned);
+    if (H5Dset_extent(dsid, &dim) < 0)
+        FAIL_STACK_ERROR
+
+    /* Expand dataset back to 2MB */
+    dim = 2 * 1024 * 1024 / sizeof(unsigned);
+    if (H5Dset_extent(dsid, &dim) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read element from dataset */
+    read_elem = 1;
+    if (H5Dread(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &read_elem) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify element is now 0 */
+    if (read_elem != 0)
+        FAIL_PUTS_ERROR("invalid element read");
+
+    /* Close everything */
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(scalar_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Sclose(scalar_sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_large_chunk_shrink() */
+
+/*-------------------------------------------------------------------------
+ * Function: test_zero_dim_dset
+ *
+ * Purpose:     Tests support for reading a 1D chunked dataset with
+ *              dimension size = 0.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ * Programmer:  Mohamad Chaarawi
+ *              Wednesdat, July 9, 2014
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_zero_dim_dset(hid_t fapl)
+{
+    char         filename[FILENAME_BUF_SIZE];
+    hid_t        fid  = -1;      /* File ID */
+    hid_t        dcpl = -1;      /* Dataset creation property list ID */
+    hid_t        sid  = -1;      /* Dataspace ID */
+    hid_t        dsid = -1;      /* Dataset ID */
+    hsize_t      dim, chunk_dim; /* Dataset and chunk dimensions */
+    int          data[1];
+    H5F_libver_t low, high; /* File format bounds */
+    herr_t       ret;       /* Generic return value */
+
+    TESTING("chunked dataset with zero dimension");
+
+    /* Loop through all the combinations of low/high library format bounds,
+       skipping invalid combination, and verify support for reading a 1D
+       chunked dataset with dimension size = 0 */
+    for (low = H5F_LIBVER_EARLIEST; low < H5F_LIBVER_NBOUNDS; low++) {
+        for (high = H5F_LIBVER_EARLIEST; high < H5F_LIBVER_NBOUNDS; high++) {
+
+            /* Set version bounds before opening the file */
+            H5E_BEGIN_TRY { ret = H5Pset_libver_bounds(fapl, low, high); }
+            H5E_END_TRY;
+
+            if (ret < 0) /* Invalid low/high combinations */
+                continue;
+
+            h5_fixname(FILENAME[16], fapl, filename, sizeof filename);
+
+            /* Create file */
+            if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+                FAIL_STACK_ERROR
+
+            /* Create dataset creation property list */
+            if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+                FAIL_STACK_ERROR
+
+            /* Set 1 chunk size */
+            chunk_dim = 1;
+            if (H5Pset_chunk(dcpl, 1, &chunk_dim) < 0)
+                FAIL_STACK_ERROR
+
+            /* Create 1D dataspace with 0 dim size */
+            dim = 0;
+            if ((sid = H5Screate_simple(1, &dim, NULL)) < 0)
+                FAIL_STACK_ERROR
+
+            /* Create chunked dataset */
+            if ((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+
+            /* write 0 elements from dataset */
+            if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, data) < 0)
+                FAIL_STACK_ERROR
+
+            /* Read 0 elements from dataset */
+            if (H5Dread(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, data) < 0)
+                FAIL_STACK_ERROR
+
+            /* Close everything */
+            if (H5Sclose(sid) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dclose(dsid) < 0)
+                FAIL_STACK_ERROR
+            if (H5Pclose(dcpl) < 0)
+                FAIL_STACK_ERROR
+            if (H5Fclose(fid) < 0)
+                FAIL_STACK_ERROR
+
+        } /* end for high */
+    }     /* end for low */
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_zero_dim_dset() */
+
+/*-------------------------------------------------------------------------
+ * Function: test_swmr_non_latest
+ *
+ * Purpose: Checks that a file created with either:
+ *        (a) SWMR-write + non-latest-format
+ *        (b) write + latest format
+ *        will generate datset with latest chunk indexing type.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_swmr_non_latest(const char *env_h5_driver, hid_t fapl)
+{
+    char              filename[FILENAME_BUF_SIZE];
+    hid_t             fid  = -1;                    /* File ID */
+    hid_t             gid  = -1;                    /* Group ID */
+    hid_t             dcpl = -1;                    /* Dataset creation property list ID */
+    hid_t             sid  = -1;                    /* Dataspace ID */
+    hid_t             did  = -1;                    /* Dataset ID */
+    hsize_t           dim[1], dims2[2];             /* Size of dataset */
+    hsize_t           max_dim[1], max_dims2[2];     /* Maximum size of dataset */
+    hsize_t           chunk_dim[1], chunk_dims2[2]; /* Chunk dimensions */
+    H5D_chunk_index_t idx_type;                     /* Chunk index type */
+    int               data;                         /* Data to be written to the dataset */
+    H5F_libver_t      low;                          /* File format low bound */
+
+    TESTING("File created with write+latest-format/SWMR-write+non-latest-format: dataset with latest chunk "
+            "index");
+
+    /* Skip this test if SWMR I/O is not supported for the VFD specified
+     * by the environment variable.
+     */
+    if (!H5FD__supports_swmr_test(env_h5_driver)) {
+        SKIPPED();
+        HDputs("    Test skipped due to VFD not supporting SWMR I/O.");
+        return SUCCEED;
+    }
+
+    /* Check if we are using the latest version of the format */
+    if (H5Pget_libver_bounds(fapl, &low, NULL) < 0)
+        FAIL_STACK_ERROR
+
+    h5_fixname(FILENAME[18], fapl, filename, sizeof filename);
+
+    if (low == H5F_LIBVER_LATEST) {
+        /* Create file with write+latest-format */
+        if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+            FAIL_STACK_ERROR
+    }
+    else {
+        /* Create file with SWMR-write+non-latest-format */
+        if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC | H5F_ACC_SWMR_WRITE, H5P_DEFAULT, fapl)) < 0)
+            FAIL_STACK_ERROR
+    } /* end else */
+
+    /* Create a chunked dataset: this will use extensible array chunk indexing */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+
+    chunk_dim[0] = 6;
+    if (H5Pset_chunk(dcpl, 1, chunk_dim) < 0)
+        FAIL_STACK_ERROR
+
+    dim[0]     = 1;
+    max_dim[0] = H5S_UNLIMITED;
+    if ((sid = H5Screate_simple(1, dim, max_dim)) < 0)
+        FAIL_STACK_ERROR
+
+    if ((did = H5Dcreate2(fid, DSET_CHUNKED_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Write to the dataset */
+    data = 100;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify the dataset's indexing type */
+    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+        FAIL_STACK_ERROR
+    if (idx_type != H5D_CHUNK_IDX_EARRAY)
+        FAIL_PUTS_ERROR("created dataset not indexed by extensible array")
+
+    /* Closing */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the file again */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the dataset in the file */
+    if ((did = H5Dopen2(fid, DSET_CHUNKED_NAME, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify the dataset's indexing type */
+    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+        FAIL_STACK_ERROR
+    if (idx_type != H5D_CHUNK_IDX_EARRAY)
+        FAIL_PUTS_ERROR("created dataset not indexed by extensible array")
+
+    /* Read from the dataset and verify data read is correct */
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data) < 0)
+        FAIL_STACK_ERROR
+    if (data != 100)
+        TEST_ERROR
+
+    /* Close the dataset */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create a group in the file */
+    if ((gid = H5Gcreate2(fid, "group", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create a chunked dataset in the group: this will use v2 B-tree chunk indexing */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+
+    chunk_dims2[0] = chunk_dims2[1] = 10;
+    if (H5Pset_chunk(dcpl, 2, chunk_dims2) < 0)
+        FAIL_STACK_ERROR
+
+    dims2[0] = dims2[1] = 1;
+    max_dims2[0] = max_dims2[1] = H5S_UNLIMITED;
+    if ((sid = H5Screate_simple(2, dims2, max_dims2)) < 0)
+        FAIL_STACK_ERROR
+
+    if ((did = H5Dcreate2(gid, DSET_CHUNKED_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify the dataset's indexing type */
+    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+        FAIL_STACK_ERROR
+    if (idx_type != H5D_CHUNK_IDX_BT2)
+        FAIL_PUTS_ERROR("created dataset not indexed by v2 B-tree")
+
+    /* Closing */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the file again */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the group */
+    if ((gid = H5Gopen2(fid, "group", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the dataset in the group */
+    if ((did = H5Dopen2(gid, DSET_CHUNKED_NAME, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify the dataset's indexing type */
+    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+        FAIL_STACK_ERROR
+    if (idx_type != H5D_CHUNK_IDX_BT2)
+        FAIL_PUTS_ERROR("created dataset not indexed by v2 B-tree")
+
+    /* Closing */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Reopen the file with SWMR-write */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDWR | H5F_ACC_SWMR_WRITE, fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the dataset in the file */
+    if ((did = H5Dopen2(fid, DSET_CHUNKED_NAME, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify the dataset's indexing type */
+    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+        FAIL_STACK_ERROR
+    if (idx_type != H5D_CHUNK_IDX_EARRAY)
+        FAIL_PUTS_ERROR("created dataset not indexed by extensible array")
+
+    /* Close the dataset */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the group */
+    if ((gid = H5Gopen2(fid, "group", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the dataset in the group */
+    if ((did = H5Dopen2(gid, DSET_CHUNKED_NAME, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify the dataset's indexing type */
+    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+        FAIL_STACK_ERROR
+    if (idx_type != H5D_CHUNK_IDX_BT2)
+        FAIL_PUTS_ERROR("created dataset not indexed by v2 B-tree")
+
+    /* Write to the dataset in the group */
+    data = 99;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data) < 0)
+        FAIL_STACK_ERROR
+
+    /* Closing */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the file again with SWMR read access */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY | H5F_ACC_SWMR_READ, fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    if ((gid = H5Gopen2(fid, "group", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the dataset */
+    if ((did = H5Dopen2(gid, DSET_CHUNKED_NAME, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read from the dataset and verify data read is correct */
+    data = 0;
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data) < 0)
+        FAIL_STACK_ERROR
+    if (data != 99)
+        TEST_ERROR
+
+    /* Closing */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dcpl);
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Gclose(gid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* test_swmr_non_latest() */
+
+/*-------------------------------------------------------------------------
+ * Function: test_earray_hdr_fd
+ *
+ * Purpose: Tests that extensible array header flush dependencies
+ *          are created and torn down correctly when used as a
+ *          chunk index.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_earray_hdr_fd(const char *env_h5_driver, hid_t fapl)
+{
+    char              filename[FILENAME_BUF_SIZE];
+    hid_t             fid  = -1;
+    hid_t             sid  = -1;
+    hid_t             did  = -1;
+    hid_t             tid  = -1;
+    hid_t             dcpl = -1;
+    hid_t             msid = -1;
+    H5D_chunk_index_t idx_type;
+    const hsize_t     shape[1]    = {8};
+    const hsize_t     maxshape[1] = {H5S_UNLIMITED};
+    const hsize_t     chunk[1]    = {8};
+    const int         buffer[8]   = {0, 1, 2, 3, 4, 5, 6, 7};
+    H5O_info2_t       info;
+
+    TESTING("Extensible array chunk index header flush dependencies handled correctly");
+
+    /* Skip this test if SWMR I/O is not supported for the VFD specified
+     * by the environment variable.
+     */
+    if (!H5FD__supports_swmr_test(env_h5_driver)) {
+        SKIPPED();
+        HDputs("    Test skipped due to VFD not supporting SWMR I/O.");
+        return SUCCEED;
+    }
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+        FAIL_STACK_ERROR;
+
+    h5_fixname(FILENAME[19], fapl, filename, sizeof(filename));
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Create a dataset with one unlimited dimension */
+    if ((sid = H5Screate_simple(1, shape, maxshape)) < 0)
+        FAIL_STACK_ERROR;
+    if ((tid = H5Tcopy(H5T_NATIVE_INT32)) < 0)
+        FAIL_STACK_ERROR;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_chunk(dcpl, 1, chunk) < 0)
+        FAIL_STACK_ERROR;
+    if ((did = H5Dcreate2(fid, DSET_EARRAY_HDR_FD, tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Verify the chunk index type */
+    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+        FAIL_STACK_ERROR;
+    if (idx_type != H5D_CHUNK_IDX_EARRAY)
+        FAIL_PUTS_ERROR("should be using extensible array as index");
+
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Tclose(tid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR;
+
+    if (H5Fstart_swmr_write(fid) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Write data to the dataset */
+    if ((did = H5Dopen2(fid, DSET_EARRAY_HDR_FD, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+    if ((tid = H5Dget_type(did)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Dwrite(did, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Tclose(tid) < 0)
+        FAIL_STACK_ERROR;
+
+    /* The second call triggered a bug in the library (JIRA issue: SWMR-95) */
+    if (H5Oget_info_by_name3(fid, DSET_EARRAY_HDR_FD, &info, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Oget_info_by_name3(fid, DSET_EARRAY_HDR_FD, &info, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR;
+
+    if (H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl);
+        H5Fclose(fid);
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Tclose(tid);
+        H5Sclose(sid);
+        H5Sclose(msid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* test_earray_hdr_fd() */
+
+/*-------------------------------------------------------------------------
+ * Function: test_farray_hdr_fd
+ *
+ * Purpose: Tests that fixed array header flush dependencies
+ *          are created and torn down correctly when used as a
+ *          chunk index.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_farray_hdr_fd(const char *env_h5_driver, hid_t fapl)
+{
+    char              filename[FILENAME_BUF_SIZE];
+    hid_t             fid  = -1;
+    hid_t             sid  = -1;
+    hid_t             did  = -1;
+    hid_t             tid  = -1;
+    hid_t             dcpl = -1;
+    hid_t             msid = -1;
+    H5D_chunk_index_t idx_type;
+    const hsize_t     shape[1]    = {8};
+    const hsize_t     maxshape[1] = {64};
+    const hsize_t     chunk[1]    = {8};
+    const int         buffer[8]   = {0, 1, 2, 3, 4, 5, 6, 7};
+    H5O_info2_t       info;
+
+    TESTING("Fixed array chunk index header flush dependencies handled correctly");
+
+    /* Skip this test if SWMR I/O is not supported for the VFD specified
+     * by the environment variable.
+     */
+    if (!H5FD__supports_swmr_test(env_h5_driver)) {
+        SKIPPED();
+        HDputs("    Test skipped due to VFD not supporting SWMR I/O.");
+        return SUCCEED;
+    }
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+        FAIL_STACK_ERROR;
+
+    h5_fixname(FILENAME[20], fapl, filename, sizeof(filename));
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Create a chunked dataset with fixed dimensions */
+    if ((sid = H5Screate_simple(1, shape, maxshape)) < 0)
+        FAIL_STACK_ERROR;
+    if ((tid = H5Tcopy(H5T_NATIVE_INT32)) < 0)
+        FAIL_STACK_ERROR;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_chunk(dcpl, 1, chunk) < 0)
+        FAIL_STACK_ERROR;
+    if ((did = H5Dcreate2(fid, DSET_FARRAY_HDR_FD, tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Verify the chunk index type */
+    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+        FAIL_STACK_ERROR;
+    if (idx_type != H5D_CHUNK_IDX_FARRAY)
+        FAIL_PUTS_ERROR("should be using fixed array as index");
+
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Tclose(tid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR;
+
+    if (H5Fstart_swmr_write(fid) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Write data to the dataset */
+    if ((did = H5Dopen2(fid, DSET_FARRAY_HDR_FD, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+    if ((tid = H5Dget_type(did)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Dwrite(did, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Tclose(tid) < 0)
+        FAIL_STACK_ERROR;
+
+    /* The second call triggered a bug in the library (JIRA issue: SWMR-95) */
+    if (H5Oget_info_by_name3(fid, DSET_FARRAY_HDR_FD, &info, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Oget_info_by_name3(fid, DSET_FARRAY_HDR_FD, &info, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR;
+
+    if (H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl);
+        H5Fclose(fid);
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Tclose(tid);
+        H5Sclose(sid);
+        H5Sclose(msid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_farray_hdr_fd() */
+
+/*-------------------------------------------------------------------------
+ * Function: test_bt2_hdr_fd
+ *
+ * Purpose: Tests that version 2 B-tree header flush dependencies
+ *          are created and torn down correctly when used as a
+ *          chunk index.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_bt2_hdr_fd(const char *env_h5_driver, hid_t fapl)
+{
+    char              filename[FILENAME_BUF_SIZE];
+    hid_t             fid  = -1;
+    hid_t             sid  = -1;
+    hid_t             did  = -1;
+    hid_t             tid  = -1;
+    hid_t             dcpl = -1;
+    hid_t             msid = -1;
+    H5D_chunk_index_t idx_type;
+    const hsize_t     shape[2]    = {8, 8};
+    const hsize_t     maxshape[2] = {H5S_UNLIMITED, H5S_UNLIMITED};
+    const hsize_t     chunk[2]    = {8, 8};
+    const int         buffer[8]   = {0, 1, 2, 3, 4, 5, 6, 7};
+    H5O_info2_t       info;
+
+    TESTING("Version 2 B-tree chunk index header flush dependencies handled correctly");
+
+    /* Initialize struct */
+    HDmemset(&info, 0, sizeof(info));
+
+    /* Skip this test if SWMR I/O is not supported for the VFD specified
+     * by the environment variable.
+     */
+    if (!H5FD__supports_swmr_test(env_h5_driver)) {
+        SKIPPED();
+        HDputs("    Test skipped due to VFD not supporting SWMR I/O.");
+        return SUCCEED;
+    }
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+        FAIL_STACK_ERROR;
+
+    h5_fixname(FILENAME[21], fapl, filename, sizeof(filename));
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Create a chunked dataset with fixed dimensions */
+    if ((sid = H5Screate_simple(2, shape, maxshape)) < 0)
+        FAIL_STACK_ERROR;
+    if ((tid = H5Tcopy(H5T_NATIVE_INT32)) < 0)
+        FAIL_STACK_ERROR;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+        FAIL_STACK_ERROR;
+    if ((did = H5Dcreate2(fid, DSET_BT2_HDR_FD, tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Verify the chunk index type */
+    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+        FAIL_STACK_ERROR;
+    if (idx_type != H5D_CHUNK_IDX_BT2)
+        FAIL_PUTS_ERROR("should be using fixed array as index");
+
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Tclose(tid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR;
+
+    if (H5Fstart_swmr_write(fid) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Write data to the dataset */
+    if ((did = H5Dopen2(fid, DSET_BT2_HDR_FD, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+    if ((tid = H5Dget_type(did)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Dwrite(did, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Tclose(tid) < 0)
+        FAIL_STACK_ERROR;
+
+    /* The second call triggered a bug in the library (JIRA issue: SWMR-95) */
+    if (H5Oget_info_by_name3(fid, DSET_BT2_HDR_FD, &info, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Oget_info_by_name3(fid, DSET_BT2_HDR_FD, &info, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR;
+
+    if (H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
     if (H5Fclose(fid) < 0)
-        TEST_ERROR
+        TEST_ERROR;
 
     PASSED();
+
     return SUCCEED;
 
 error:
     H5E_BEGIN_TRY
     {
+        H5Pclose(fapl);
+        H5Fclose(fid);
         H5Dclose(did);
         H5Pclose(dcpl);
+        H5Tclose(tid);
         H5Sclose(sid);
-        H5Fclose(fid);
+        H5Sclose(msid);
     }
     H5E_END_TRY;
     return FAIL;
-} /* end test_unfiltered_edge_chunks() */
+} /* end test_bt2_hdr_fd() */
 
 /*-------------------------------------------------------------------------
- * Function: test_large_chunk_shrink
+ * Function: test_storage_size
  *
- * Purpose: Tests support for shrinking a chunk larger than 1 MB by a
- *              size greater than 1 MB.
+ * Purpose:     Tests results from querying the storage size of a dataset,
+ *              before/after extending the dimensions.
  *
  * Return:      Success: 0
  *              Failure: -1
  *
- * Programmer:  Neil Fortner
- *              Monday, November 31, 2011
+ * Programmer:  Quincey Koziol
+ *              Monday, April 11, 2016
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_large_chunk_shrink(hid_t fapl)
+test_storage_size(hid_t fapl)
 {
-    char     filename[FILENAME_BUF_SIZE];
-    hid_t    fid        = -1;         /* File ID */
-    hid_t    dcpl       = -1;         /* Dataset creation property list ID */
-    hid_t    sid        = -1;         /* Dataspace ID */
-    hid_t    scalar_sid = -1;         /* Scalar dataspace ID */
-    hid_t    dsid       = -1;         /* Dataset ID */
-    hsize_t  dim, max_dim, chunk_dim; /* Dataset and chunk dimensions */
-    hsize_t  hs_offset;               /* Hyperslab offset */
-    hsize_t  hs_size;                 /* Hyperslab size */
-    unsigned write_elem, read_elem;   /* Element written/read */
+    char    filename[FILENAME_BUF_SIZE];
+    hid_t   fid  = -1;             /* File ID */
+    hid_t   dcpl = -1, dcpl2 = -1; /* Dataset creation property list IDs */
+    hid_t   sid  = -1;             /* Dataspace ID */
+    hid_t   dsid = -1;             /* Dataset ID */
+    hsize_t dims[2], max_dims[2];  /* Dataset dimensions */
+    hsize_t new_dims[2];           /* New dataset dimensions */
+    hsize_t chunk_dims[2];         /* Chunk dimensions */
+    int     wdata[STORAGE_SIZE_DIM1][STORAGE_SIZE_DIM2];
+    hsize_t ssize; /* Dataset storage size */
 
-    TESTING("shrinking large chunk");
+    TESTING("querying storage size");
 
-    h5_fixname(FILENAME[10], fapl, filename, sizeof filename);
+    h5_fixname(FILENAME[22], fapl, filename, sizeof filename);
 
     /* Create file */
     if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
@@ -11686,455 +13574,435 @@ test_large_chunk_shrink(hid_t fapl)
     if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
         FAIL_STACK_ERROR
 
-    /* Set 2 MB chunk size */
-    chunk_dim = 2 * 1024 * 1024 / sizeof(unsigned);
-    if (H5Pset_chunk(dcpl, 1, &chunk_dim) < 0)
-        FAIL_STACK_ERROR
-
-    /* Create scalar dataspace */
-    if ((scalar_sid = H5Screate(H5S_SCALAR)) < 0)
+    /* Set chunk size */
+    chunk_dims[0] = STORAGE_SIZE_CHUNK_DIM1;
+    chunk_dims[1] = STORAGE_SIZE_CHUNK_DIM2;
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
         FAIL_STACK_ERROR
 
-    /* Create 1-D dataspace */
-    dim     = 2 * 1024 * 1024 / sizeof(unsigned);
-    max_dim = H5S_UNLIMITED;
-    if ((sid = H5Screate_simple(1, &dim, &max_dim)) < 0)
+    /* Copy the DCPL, and set it to early allocation */
+    if ((dcpl2 = H5Pcopy(dcpl)) < 0)
         FAIL_STACK_ERROR
-
-    /* Create 2 MB chunked dataset */
-    if ((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_UINT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+    if (H5Pset_alloc_time(dcpl2, H5D_ALLOC_TIME_EARLY) < 0)
         FAIL_STACK_ERROR
 
-    /* Select last element in the dataset */
-    hs_offset = dim - 1;
-    hs_size   = 1;
-    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, &hs_offset, NULL, &hs_size, NULL) < 0)
+    /* Create 2D dataspace, with max dims same as current dimensions */
+    dims[0]     = STORAGE_SIZE_DIM1;
+    dims[1]     = STORAGE_SIZE_DIM2;
+    max_dims[0] = STORAGE_SIZE_DIM1;
+    max_dims[1] = STORAGE_SIZE_DIM2;
+    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
         FAIL_STACK_ERROR
 
-    /* Read (unwritten) element from dataset */
-    read_elem = 1;
-    if (H5Dread(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &read_elem) < 0)
+    /* Create chunked dataset */
+    if ((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
 
-    /* Verify unwritten element is fill value (0) */
-    if (read_elem != 0)
-        FAIL_PUTS_ERROR("invalid unwritten element read");
+    /* Initialize buffer to zeroes */
+    HDmemset(wdata, 0, sizeof(wdata));
 
-    /* Write element to dataset */
-    write_elem = 2;
-    if (H5Dwrite(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &write_elem) < 0)
+    /* write elements to dataset */
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
         FAIL_STACK_ERROR
 
-    /* Read element from dataset */
-    read_elem = write_elem + 1;
-    if (H5Dread(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &read_elem) < 0)
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-    /* Verify written element is read in */
-    if (read_elem != write_elem)
-        FAIL_PUTS_ERROR("invalid written element read");
-
-    /* Shrink dataset to 512 KB */
-    dim = 512 * 1024 / sizeof(unsigned);
-    if (H5Dset_extent(dsid, &dim) < 0)
+    /* Close dataset & dataspace */
+    if (H5Sclose(sid) < 0)
         FAIL_STACK_ERROR
-
-    /* Expand dataset back to 2MB */
-    dim = 2 * 1024 * 1024 / sizeof(unsigned);
-    if (H5Dset_extent(dsid, &dim) < 0)
+    if (H5Dclose(dsid) < 0)
         FAIL_STACK_ERROR
 
-    /* Read element from dataset */
-    read_elem = 1;
-    if (H5Dread(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &read_elem) < 0)
+    /* Copy the dataset */
+    if (H5Ocopy(fid, "dset", fid, "dset_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
         FAIL_STACK_ERROR
 
-    /* Verify element is now 0 */
-    if (read_elem != 0)
-        FAIL_PUTS_ERROR("invalid element read");
-
-    /* Close everything */
-    if (H5Sclose(sid) < 0)
+    /* Open the copied dataset */
+    if ((dsid = H5Dopen2(fid, "dset_copy", H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
-    if (H5Sclose(scalar_sid) < 0)
+
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
+
+    /* Close copied dataset */
     if (H5Dclose(dsid) < 0)
         FAIL_STACK_ERROR
-    if (H5Pclose(dcpl) < 0)
-        FAIL_STACK_ERROR
-    if (H5Fclose(fid) < 0)
-        FAIL_STACK_ERROR
-
-    PASSED();
-
-    return SUCCEED;
-
-error:
-    H5E_BEGIN_TRY
-    {
-        H5Pclose(dcpl);
-        H5Dclose(dsid);
-        H5Sclose(sid);
-        H5Sclose(scalar_sid);
-        H5Fclose(fid);
-    }
-    H5E_END_TRY;
-    return FAIL;
-} /* end test_large_chunk_shrink() */
-
-/*-------------------------------------------------------------------------
- * Function: test_zero_dim_dset
- *
- * Purpose:     Tests support for reading a 1D chunked dataset with
- *              dimension size = 0.
- *
- * Return:      Success: 0
- *              Failure: -1
- *
- * Programmer:  Mohamad Chaarawi
- *              Wednesdat, July 9, 2014
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-test_zero_dim_dset(hid_t fapl)
-{
-    char         filename[FILENAME_BUF_SIZE];
-    hid_t        fid  = -1;      /* File ID */
-    hid_t        dcpl = -1;      /* Dataset creation property list ID */
-    hid_t        sid  = -1;      /* Dataspace ID */
-    hid_t        dsid = -1;      /* Dataset ID */
-    hsize_t      dim, chunk_dim; /* Dataset and chunk dimensions */
-    int          data[1];
-    H5F_libver_t low, high; /* File format bounds */
-    herr_t       ret;       /* Generic return value */
-
-    TESTING("chunked dataset with zero dimension");
 
-    /* Loop through all the combinations of low/high library format bounds,
-       skipping invalid combination, and verify support for reading a 1D
-       chunked dataset with dimension size = 0 */
-    for (low = H5F_LIBVER_EARLIEST; low < H5F_LIBVER_NBOUNDS; low++) {
-        for (high = H5F_LIBVER_EARLIEST; high < H5F_LIBVER_NBOUNDS; high++) {
+    /* Create 2D dataspace with max dims > current dims (but not unlimited) */
+    dims[0]     = STORAGE_SIZE_DIM1;
+    dims[1]     = STORAGE_SIZE_DIM2;
+    max_dims[0] = STORAGE_SIZE_MAX_DIM1;
+    max_dims[1] = STORAGE_SIZE_MAX_DIM2;
+    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
+        FAIL_STACK_ERROR
 
-            /* Set version bounds before opening the file */
-            H5E_BEGIN_TRY { ret = H5Pset_libver_bounds(fapl, low, high); }
-            H5E_END_TRY;
+    /* Create chunked dataset */
+    if ((dsid = H5Dcreate2(fid, "dset2", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
 
-            if (ret < 0) /* Invalid low/high combinations */
-                continue;
+    /* Initialize buffer to zeroes */
+    HDmemset(wdata, 0, sizeof(wdata));
 
-            h5_fixname(FILENAME[16], fapl, filename, sizeof filename);
+    /* write elements to dataset */
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
+        FAIL_STACK_ERROR
 
-            /* Create file */
-            if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
-                FAIL_STACK_ERROR
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
+        FAIL_STACK_ERROR
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-            /* Create dataset creation property list */
-            if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-                FAIL_STACK_ERROR
+    /* Extend dataset's dimensions */
+    new_dims[0] = STORAGE_SIZE_DIM1 * 2;
+    new_dims[1] = STORAGE_SIZE_DIM2 * 2;
+    if (H5Dset_extent(dsid, new_dims) < 0)
+        FAIL_STACK_ERROR
 
-            /* Set 1 chunk size */
-            chunk_dim = 1;
-            if (H5Pset_chunk(dcpl, 1, &chunk_dim) < 0)
-                FAIL_STACK_ERROR
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
+        FAIL_STACK_ERROR
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-            /* Create 1D dataspace with 0 dim size */
-            dim = 0;
-            if ((sid = H5Screate_simple(1, &dim, NULL)) < 0)
-                FAIL_STACK_ERROR
+    /* Close dataset & dataspace */
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR
 
-            /* Create chunked dataset */
-            if ((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
-                FAIL_STACK_ERROR
+    /* Copy the dataset */
+    if (H5Ocopy(fid, "dset2", fid, "dset2_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
 
-            /* write 0 elements from dataset */
-            if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, data) < 0)
-                FAIL_STACK_ERROR
+    /* Open the copied dataset */
+    if ((dsid = H5Dopen2(fid, "dset2_copy", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
 
-            /* Read 0 elements from dataset */
-            if (H5Dread(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, data) < 0)
-                FAIL_STACK_ERROR
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
+        FAIL_STACK_ERROR
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-            /* Close everything */
-            if (H5Sclose(sid) < 0)
-                FAIL_STACK_ERROR
-            if (H5Dclose(dsid) < 0)
-                FAIL_STACK_ERROR
-            if (H5Pclose(dcpl) < 0)
-                FAIL_STACK_ERROR
-            if (H5Fclose(fid) < 0)
-                FAIL_STACK_ERROR
+    /* Close copied dataset */
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR
 
-        } /* end for high */
-    }     /* end for low */
+    /* Create 2D dataspace with max dims > current dims (but not unlimited) */
+    dims[0]     = STORAGE_SIZE_DIM1;
+    dims[1]     = STORAGE_SIZE_DIM2;
+    max_dims[0] = STORAGE_SIZE_MAX_DIM1;
+    max_dims[1] = STORAGE_SIZE_MAX_DIM2;
+    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
+        FAIL_STACK_ERROR
 
-    PASSED();
+    /* Create chunked dataset, w/early allocation */
+    if ((dsid = H5Dcreate2(fid, "dset2a", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl2, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
 
-    return SUCCEED;
+    /* Initialize buffer to zeroes */
+    HDmemset(wdata, 0, sizeof(wdata));
 
-error:
-    H5E_BEGIN_TRY
-    {
-        H5Pclose(dcpl);
-        H5Dclose(dsid);
-        H5Sclose(sid);
-        H5Fclose(fid);
-    }
-    H5E_END_TRY;
-    return FAIL;
-} /* end test_zero_dim_dset() */
+    /* write elements to dataset */
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
+        FAIL_STACK_ERROR
 
-/*-------------------------------------------------------------------------
- * Function: test_swmr_non_latest
- *
- * Purpose: Checks that a file created with either:
- *        (a) SWMR-write + non-latest-format
- *        (b) write + latest format
- *        will generate datset with latest chunk indexing type.
- *
- * Return:      Success: 0
- *              Failure: -1
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-test_swmr_non_latest(const char *env_h5_driver, hid_t fapl)
-{
-    char              filename[FILENAME_BUF_SIZE];
-    hid_t             fid  = -1;                    /* File ID */
-    hid_t             gid  = -1;                    /* Group ID */
-    hid_t             dcpl = -1;                    /* Dataset creation property list ID */
-    hid_t             sid  = -1;                    /* Dataspace ID */
-    hid_t             did  = -1;                    /* Dataset ID */
-    hsize_t           dim[1], dims2[2];             /* Size of dataset */
-    hsize_t           max_dim[1], max_dims2[2];     /* Maximum size of dataset */
-    hsize_t           chunk_dim[1], chunk_dims2[2]; /* Chunk dimensions */
-    H5D_chunk_index_t idx_type;                     /* Chunk index type */
-    int               data;                         /* Data to be written to the dataset */
-    H5F_libver_t      low;                          /* File format low bound */
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
+        FAIL_STACK_ERROR
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-    TESTING("File created with write+latest-format/SWMR-write+non-latest-format: dataset with latest chunk "
-            "index");
+    /* Extend dataset's dimensions */
+    new_dims[0] = STORAGE_SIZE_DIM1 * 2;
+    new_dims[1] = STORAGE_SIZE_DIM2 * 2;
+    if (H5Dset_extent(dsid, new_dims) < 0)
+        FAIL_STACK_ERROR
 
-    /* Skip this test if SWMR I/O is not supported for the VFD specified
-     * by the environment variable.
-     */
-    if (!H5FD__supports_swmr_test(env_h5_driver)) {
-        SKIPPED();
-        HDputs("    Test skipped due to VFD not supporting SWMR I/O.");
-        return SUCCEED;
-    }
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
+        FAIL_STACK_ERROR
+    if ((sizeof(int) * 15 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-    /* Check if we are using the latest version of the format */
-    if (H5Pget_libver_bounds(fapl, &low, NULL) < 0)
+    /* Close dataset & dataspace */
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(dsid) < 0)
         FAIL_STACK_ERROR
 
-    h5_fixname(FILENAME[18], fapl, filename, sizeof filename);
+    /* Copy the dataset */
+    if (H5Ocopy(fid, "dset2a", fid, "dset2a_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
 
-    if (low == H5F_LIBVER_LATEST) {
-        /* Create file with write+latest-format */
-        if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
-            FAIL_STACK_ERROR
-    }
-    else {
-        /* Create file with SWMR-write+non-latest-format */
-        if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC | H5F_ACC_SWMR_WRITE, H5P_DEFAULT, fapl)) < 0)
-            FAIL_STACK_ERROR
-    } /* end else */
+    /* Open the copied dataset */
+    if ((dsid = H5Dopen2(fid, "dset2a_copy", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
 
-    /* Create a chunked dataset: this will use extensible array chunk indexing */
-    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
+    if ((sizeof(int) * 15 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-    chunk_dim[0] = 6;
-    if (H5Pset_chunk(dcpl, 1, chunk_dim) < 0)
+    /* Close copied dataset */
+    if (H5Dclose(dsid) < 0)
         FAIL_STACK_ERROR
 
-    dim[0]     = 1;
-    max_dim[0] = H5S_UNLIMITED;
-    if ((sid = H5Screate_simple(1, dim, max_dim)) < 0)
+    /* Create 2D dataspace with max dims > current dims (and 1 unlimited dim) */
+    dims[0]     = STORAGE_SIZE_DIM1;
+    dims[1]     = STORAGE_SIZE_DIM2;
+    max_dims[0] = H5S_UNLIMITED;
+    max_dims[1] = STORAGE_SIZE_MAX_DIM2;
+    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
         FAIL_STACK_ERROR
 
-    if ((did = H5Dcreate2(fid, DSET_CHUNKED_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+    /* Create chunked dataset */
+    if ((dsid = H5Dcreate2(fid, "dset3", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
 
-    /* Write to the dataset */
-    data = 100;
-    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data) < 0)
+    /* Initialize buffer to zeroes */
+    HDmemset(wdata, 0, sizeof(wdata));
+
+    /* write elements to dataset */
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
         FAIL_STACK_ERROR
 
-    /* Verify the dataset's indexing type */
-    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
-    if (idx_type != H5D_CHUNK_IDX_EARRAY)
-        FAIL_PUTS_ERROR("created dataset not indexed by extensible array")
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-    /* Closing */
-    if (H5Dclose(did) < 0)
+    /* Extend dataset's dimensions */
+    new_dims[0] = STORAGE_SIZE_DIM1 * 2;
+    new_dims[1] = STORAGE_SIZE_DIM2 * 2;
+    if (H5Dset_extent(dsid, new_dims) < 0)
+        FAIL_STACK_ERROR
+
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
+
+    /* Close dataset & dataspace */
     if (H5Sclose(sid) < 0)
         FAIL_STACK_ERROR
-    if (H5Pclose(dcpl) < 0)
+    if (H5Dclose(dsid) < 0)
         FAIL_STACK_ERROR
-    if (H5Fclose(fid) < 0)
+
+    /* Copy the dataset */
+    if (H5Ocopy(fid, "dset3", fid, "dset3_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
         FAIL_STACK_ERROR
 
-    /* Open the file again */
-    if ((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+    /* Open the copied dataset */
+    if ((dsid = H5Dopen2(fid, "dset3_copy", H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
 
-    /* Open the dataset in the file */
-    if ((did = H5Dopen2(fid, DSET_CHUNKED_NAME, H5P_DEFAULT)) < 0)
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-    /* Verify the dataset's indexing type */
-    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+    /* Close copied dataset */
+    if (H5Dclose(dsid) < 0)
         FAIL_STACK_ERROR
-    if (idx_type != H5D_CHUNK_IDX_EARRAY)
-        FAIL_PUTS_ERROR("created dataset not indexed by extensible array")
 
-    /* Read from the dataset and verify data read is correct */
-    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data) < 0)
+    /* Create 2D dataspace with max dims > current dims (and 1 unlimited dim) */
+    dims[0]     = STORAGE_SIZE_DIM1;
+    dims[1]     = STORAGE_SIZE_DIM2;
+    max_dims[0] = H5S_UNLIMITED;
+    max_dims[1] = STORAGE_SIZE_MAX_DIM2;
+    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
         FAIL_STACK_ERROR
-    if (data != 100)
-        TEST_ERROR
 
-    /* Close the dataset */
-    if (H5Dclose(did) < 0)
+    /* Create chunked dataset, w/early allocation */
+    if ((dsid = H5Dcreate2(fid, "dset3a", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl2, H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
 
-    /* Create a group in the file */
-    if ((gid = H5Gcreate2(fid, "group", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+    /* Initialize buffer to zeroes */
+    HDmemset(wdata, 0, sizeof(wdata));
+
+    /* write elements to dataset */
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
         FAIL_STACK_ERROR
 
-    /* Create a chunked dataset in the group: this will use v2 B-tree chunk indexing */
-    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-    chunk_dims2[0] = chunk_dims2[1] = 10;
-    if (H5Pset_chunk(dcpl, 2, chunk_dims2) < 0)
+    /* Extend dataset's dimensions */
+    new_dims[0] = STORAGE_SIZE_DIM1 * 2;
+    new_dims[1] = STORAGE_SIZE_DIM2 * 2;
+    if (H5Dset_extent(dsid, new_dims) < 0)
         FAIL_STACK_ERROR
 
-    dims2[0] = dims2[1] = 1;
-    max_dims2[0] = max_dims2[1] = H5S_UNLIMITED;
-    if ((sid = H5Screate_simple(2, dims2, max_dims2)) < 0)
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
+        FAIL_STACK_ERROR
+    if ((sizeof(int) * 15 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
+
+    /* Close dataset & dataspace */
+    if (H5Sclose(sid) < 0)
         FAIL_STACK_ERROR
-
-    if ((did = H5Dcreate2(gid, DSET_CHUNKED_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+    if (H5Dclose(dsid) < 0)
         FAIL_STACK_ERROR
 
-    /* Verify the dataset's indexing type */
-    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+    /* Copy the dataset */
+    if (H5Ocopy(fid, "dset3a", fid, "dset3a_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
         FAIL_STACK_ERROR
-    if (idx_type != H5D_CHUNK_IDX_BT2)
-        FAIL_PUTS_ERROR("created dataset not indexed by v2 B-tree")
 
-    /* Closing */
-    if (H5Dclose(did) < 0)
-        FAIL_STACK_ERROR
-    if (H5Sclose(sid) < 0)
+    /* Open the copied dataset */
+    if ((dsid = H5Dopen2(fid, "dset3a_copy", H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
-    if (H5Gclose(gid) < 0)
+
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
-    if (H5Pclose(dcpl) < 0)
+    if ((sizeof(int) * 15 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
+
+    /* Close copied dataset */
+    if (H5Dclose(dsid) < 0)
         FAIL_STACK_ERROR
-    if (H5Fclose(fid) < 0)
+
+    /* Create 2D dataspace with max dims > current dims (and 2 unlimited dims) */
+    dims[0]     = STORAGE_SIZE_DIM1;
+    dims[1]     = STORAGE_SIZE_DIM2;
+    max_dims[0] = H5S_UNLIMITED;
+    max_dims[1] = H5S_UNLIMITED;
+    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
         FAIL_STACK_ERROR
 
-    /* Open the file again */
-    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+    /* Create chunked dataset */
+    if ((dsid = H5Dcreate2(fid, "dset4", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
 
-    /* Open the group */
-    if ((gid = H5Gopen2(fid, "group", H5P_DEFAULT)) < 0)
+    /* Initialize buffer to zeroes */
+    HDmemset(wdata, 0, sizeof(wdata));
+
+    /* write elements to dataset */
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
         FAIL_STACK_ERROR
 
-    /* Open the dataset in the group */
-    if ((did = H5Dopen2(gid, DSET_CHUNKED_NAME, H5P_DEFAULT)) < 0)
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-    /* Verify the dataset's indexing type */
-    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+    /* Extend dataset's dimensions */
+    new_dims[0] = STORAGE_SIZE_DIM1 * 2;
+    new_dims[1] = STORAGE_SIZE_DIM2 * 2;
+    if (H5Dset_extent(dsid, new_dims) < 0)
         FAIL_STACK_ERROR
-    if (idx_type != H5D_CHUNK_IDX_BT2)
-        FAIL_PUTS_ERROR("created dataset not indexed by v2 B-tree")
 
-    /* Closing */
-    if (H5Dclose(did) < 0)
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
-    if (H5Gclose(gid) < 0)
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
+
+    /* Close dataset & dataspace */
+    if (H5Sclose(sid) < 0)
         FAIL_STACK_ERROR
-    if (H5Fclose(fid) < 0)
+    if (H5Dclose(dsid) < 0)
         FAIL_STACK_ERROR
 
-    /* Reopen the file with SWMR-write */
-    if ((fid = H5Fopen(filename, H5F_ACC_RDWR | H5F_ACC_SWMR_WRITE, fapl)) < 0)
+    /* Copy the dataset */
+    if (H5Ocopy(fid, "dset4", fid, "dset4_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
         FAIL_STACK_ERROR
 
-    /* Open the dataset in the file */
-    if ((did = H5Dopen2(fid, DSET_CHUNKED_NAME, H5P_DEFAULT)) < 0)
+    /* Open the copied dataset */
+    if ((dsid = H5Dopen2(fid, "dset4_copy", H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
 
-    /* Verify the dataset's indexing type */
-    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
-    if (idx_type != H5D_CHUNK_IDX_EARRAY)
-        FAIL_PUTS_ERROR("created dataset not indexed by extensible array")
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-    /* Close the dataset */
-    if (H5Dclose(did) < 0)
+    /* Close copied dataset */
+    if (H5Dclose(dsid) < 0)
         FAIL_STACK_ERROR
 
-    /* Open the group */
-    if ((gid = H5Gopen2(fid, "group", H5P_DEFAULT)) < 0)
+    /* Create 2D dataspace with max dims > current dims (and 2 unlimited dims) */
+    dims[0]     = STORAGE_SIZE_DIM1;
+    dims[1]     = STORAGE_SIZE_DIM2;
+    max_dims[0] = H5S_UNLIMITED;
+    max_dims[1] = H5S_UNLIMITED;
+    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
         FAIL_STACK_ERROR
 
-    /* Open the dataset in the group */
-    if ((did = H5Dopen2(gid, DSET_CHUNKED_NAME, H5P_DEFAULT)) < 0)
+    /* Create chunked dataset, w/early allocation */
+    if ((dsid = H5Dcreate2(fid, "dset4a", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl2, H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
 
-    /* Verify the dataset's indexing type */
-    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
-        FAIL_STACK_ERROR
-    if (idx_type != H5D_CHUNK_IDX_BT2)
-        FAIL_PUTS_ERROR("created dataset not indexed by v2 B-tree")
+    /* Initialize buffer to zeroes */
+    HDmemset(wdata, 0, sizeof(wdata));
 
-    /* Write to the dataset in the group */
-    data = 99;
-    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data) < 0)
+    /* write elements to dataset */
+    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
         FAIL_STACK_ERROR
 
-    /* Closing */
-    if (H5Dclose(did) < 0)
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
-    if (H5Gclose(gid) < 0)
+    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
+
+    /* Extend dataset's dimensions */
+    new_dims[0] = STORAGE_SIZE_DIM1 * 2;
+    new_dims[1] = STORAGE_SIZE_DIM2 * 2;
+    if (H5Dset_extent(dsid, new_dims) < 0)
         FAIL_STACK_ERROR
-    if (H5Fclose(fid) < 0)
+
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
+    if ((sizeof(int) * 15 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
+        TEST_ERROR
 
-    /* Open the file again with SWMR read access */
-    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY | H5F_ACC_SWMR_READ, fapl)) < 0)
+    /* Close dataset & dataspace */
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(dsid) < 0)
         FAIL_STACK_ERROR
 
-    if ((gid = H5Gopen2(fid, "group", H5P_DEFAULT)) < 0)
+    /* Copy the dataset */
+    if (H5Ocopy(fid, "dset4a", fid, "dset4a_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
         FAIL_STACK_ERROR
 
-    /* Open the dataset */
-    if ((did = H5Dopen2(gid, DSET_CHUNKED_NAME, H5P_DEFAULT)) < 0)
+    /* Open the copied dataset */
+    if ((dsid = H5Dopen2(fid, "dset4a_copy", H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
 
-    /* Read from the dataset and verify data read is correct */
-    data = 0;
-    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data) < 0)
+    /* Get the storage size */
+    if (0 == (ssize = H5Dget_storage_size(dsid)))
         FAIL_STACK_ERROR
-    if (data != 99)
+    if ((sizeof(int) * 15 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
         TEST_ERROR
 
-    /* Closing */
-    if (H5Dclose(did) < 0)
+    /* Close copied dataset */
+    if (H5Dclose(dsid) < 0)
         FAIL_STACK_ERROR
-    if (H5Gclose(gid) < 0)
+
+    /* Close rest */
+    if (H5Pclose(dcpl) < 0)
         FAIL_STACK_ERROR
     if (H5Fclose(fid) < 0)
         FAIL_STACK_ERROR
@@ -12147,116 +14015,89 @@ error:
     H5E_BEGIN_TRY
     {
         H5Pclose(dcpl);
-        H5Dclose(did);
+        H5Pclose(dcpl2);
+        H5Dclose(dsid);
         H5Sclose(sid);
-        H5Gclose(gid);
         H5Fclose(fid);
     }
     H5E_END_TRY;
     return FAIL;
-} /* test_swmr_non_latest() */
+} /* end test_storage_size() */
 
 /*-------------------------------------------------------------------------
- * Function: test_earray_hdr_fd
+ * Function:    test_power2up
  *
- * Purpose: Tests that extensible array header flush dependencies
- *          are created and torn down correctly when used as a
- *          chunk index.
+ * Purpose:     Tests that the H5VM_power2up(n) function does not result in an
+ *              infinite loop when input n exceeds 2^63. (HDFFV-10217)
+ *              H5VM_power2up() is used to calculate the next power of 2 for
+ *              a dataset's scaled dimension sizes.
  *
  * Return:      Success: 0
  *              Failure: -1
  *
+ * Programmer:  Vailin Choi; June 2017
+ *
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_earray_hdr_fd(const char *env_h5_driver, hid_t fapl)
+test_power2up(hid_t fapl)
 {
-    char              filename[FILENAME_BUF_SIZE];
-    hid_t             fid  = -1;
-    hid_t             sid  = -1;
-    hid_t             did  = -1;
-    hid_t             tid  = -1;
-    hid_t             dcpl = -1;
-    hid_t             msid = -1;
-    H5D_chunk_index_t idx_type;
-    const hsize_t     shape[1]    = {8};
-    const hsize_t     maxshape[1] = {H5S_UNLIMITED};
-    const hsize_t     chunk[1]    = {8};
-    const int         buffer[8]   = {0, 1, 2, 3, 4, 5, 6, 7};
-    H5O_info2_t       info;
-
-    TESTING("Extensible array chunk index header flush dependencies handled correctly");
+    char    filename[FILENAME_BUF_SIZE];
+    hid_t   fid  = -1;     /* File ID */
+    hid_t   dcpl = -1;     /* Dataset creation property list */
+    hid_t   sid  = -1;     /* Dataspace ID */
+    hid_t   did  = -1;     /* Dataset ID */
+    hsize_t dims[2];       /* Dataset dimension sizes */
+    hsize_t max_dims[2];   /* Maximum dimension sizes */
+    hsize_t chunk_dims[2]; /* Chunk dimensions */
+    hsize_t ext_dims[2];   /* Extended dimension sizes */
+    herr_t  status;        /* Error status */
 
-    /* Skip this test if SWMR I/O is not supported for the VFD specified
-     * by the environment variable.
-     */
-    if (!H5FD__supports_swmr_test(env_h5_driver)) {
-        SKIPPED();
-        HDputs("    Test skipped due to VFD not supporting SWMR I/O.");
-        return SUCCEED;
-    }
+    TESTING("the next power of 2");
 
-    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
-        FAIL_STACK_ERROR;
+    h5_fixname(FILENAME[24], fapl, filename, sizeof filename);
 
-    h5_fixname(FILENAME[19], fapl, filename, sizeof(filename));
+    /* Create file */
     if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
-        FAIL_STACK_ERROR;
+        FAIL_STACK_ERROR
 
-    /* Create a dataset with one unlimited dimension */
-    if ((sid = H5Screate_simple(1, shape, maxshape)) < 0)
-        FAIL_STACK_ERROR;
-    if ((tid = H5Tcopy(H5T_NATIVE_INT32)) < 0)
-        FAIL_STACK_ERROR;
-    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Pset_chunk(dcpl, 1, chunk) < 0)
-        FAIL_STACK_ERROR;
-    if ((did = H5Dcreate2(fid, DSET_EARRAY_HDR_FD, tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
-        FAIL_STACK_ERROR;
+    /* Set dims[1] to ((2^63) -1) */
+    dims[0]     = 0;
+    dims[1]     = ((hsize_t)1 << ((sizeof(hsize_t) * CHAR_BIT) - 1)) - 1;
+    max_dims[0] = max_dims[1] = H5S_UNLIMITED;
+    sid                       = H5Screate_simple(2, dims, max_dims);
 
-    /* Verify the chunk index type */
-    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
-        FAIL_STACK_ERROR;
-    if (idx_type != H5D_CHUNK_IDX_EARRAY)
-        FAIL_PUTS_ERROR("should be using extensible array as index");
+    /* Create dataset creation property list */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
 
-    if (H5Dclose(did) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Pclose(dcpl) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Tclose(tid) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Sclose(sid) < 0)
-        FAIL_STACK_ERROR;
+    /* Set chunk size */
+    chunk_dims[0] = chunk_dims[1] = 1;
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        TEST_ERROR
 
-    if (H5Fstart_swmr_write(fid) < 0)
-        FAIL_STACK_ERROR;
+    /* Create chunked dataset */
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT64, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR
 
-    /* Write data to the dataset */
-    if ((did = H5Dopen2(fid, DSET_EARRAY_HDR_FD, H5P_DEFAULT)) < 0)
-        FAIL_STACK_ERROR;
-    if ((tid = H5Dget_type(did)) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Dwrite(did, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Dclose(did) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Tclose(tid) < 0)
-        FAIL_STACK_ERROR;
+    ext_dims[0] = 1;
+    ext_dims[1] = dims[1] + 5;
 
-    /* The second call triggered a bug in the library (JIRA issue: SWMR-95) */
-    if (H5Oget_info_by_name3(fid, DSET_EARRAY_HDR_FD, &info, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Oget_info_by_name3(fid, DSET_EARRAY_HDR_FD, &info, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
-        FAIL_STACK_ERROR;
+    /* Extend to (2^63)+ */
+    H5E_BEGIN_TRY { status = H5Dset_extent(did, ext_dims); }
+    H5E_END_TRY;
+    if (status >= 0)
+        TEST_ERROR
 
-    if (H5Pclose(fapl) < 0)
-        FAIL_STACK_ERROR;
+    /* Closing */
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR
     if (H5Fclose(fid) < 0)
-        TEST_ERROR;
+        TEST_ERROR
 
     PASSED();
 
@@ -12265,24 +14106,26 @@ test_earray_hdr_fd(const char *env_h5_driver, hid_t fapl)
 error:
     H5E_BEGIN_TRY
     {
-        H5Pclose(fapl);
-        H5Fclose(fid);
-        H5Dclose(did);
         H5Pclose(dcpl);
-        H5Tclose(tid);
+        H5Dclose(did);
         H5Sclose(sid);
-        H5Sclose(msid);
+        H5Pclose(dcpl);
+        H5Fclose(fid);
     }
     H5E_END_TRY;
     return FAIL;
-} /* test_earray_hdr_fd() */
+} /* end test_power2up() */
 
 /*-------------------------------------------------------------------------
- * Function: test_farray_hdr_fd
+ * Function:    test_filter_nthreads
  *
- * Purpose: Tests that fixed array header flush dependencies
- *          are created and torn down correctly when used as a
- *          chunk index.
+ * Purpose:     Tests that chunks written and read with a filter pipeline
+ *              thread count (H5Pset_filter_nthreads) greater than one are
+ *              stored and returned exactly as with a single thread, both
+ *              when chunks are preempted from a small chunk cache while
+ *              writing, and when they're flushed when the dataset is
+ *              closed.  Also checks that an application filter that
+ *              calls into the library can be used with several threads.
  *
  * Return:      Success: 0
  *              Failure: -1
@@ -12290,94 +14133,317 @@ error:
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_farray_hdr_fd(const char *env_h5_driver, hid_t fapl)
+test_filter_nthreads(hid_t fapl)
 {
-    char              filename[FILENAME_BUF_SIZE];
-    hid_t             fid  = -1;
-    hid_t             sid  = -1;
-    hid_t             did  = -1;
-    hid_t             tid  = -1;
-    hid_t             dcpl = -1;
-    hid_t             msid = -1;
-    H5D_chunk_index_t idx_type;
-    const hsize_t     shape[1]    = {8};
-    const hsize_t     maxshape[1] = {64};
-    const hsize_t     chunk[1]    = {8};
-    const int         buffer[8]   = {0, 1, 2, 3, 4, 5, 6, 7};
-    H5O_info2_t       info;
+    char        filename[FILENAME_BUF_SIZE];
+    const char *dset_names[2] = {FILTER_NTHREADS_DSET1, FILTER_NTHREADS_DSET2};
+    hid_t       fid           = -1;                         /* File ID */
+    hid_t       dcpl          = -1;                         /* Dataset creation property list */
+    hid_t       dapl          = -1;                         /* Dataset access property list */
+    hid_t       dxpl          = -1;                         /* Dataset transfer property list */
+    hid_t       sid           = -1;                         /* Dataspace ID */
+    hid_t       did           = -1;                         /* Dataset ID */
+    hsize_t     dim           = FILTER_NTHREADS_DIM;        /* Dataset dimension */
+    hsize_t     chunk_dim     = FILTER_NTHREADS_CHUNK_DIM;  /* Chunk dimension */
+    hsize_t     start, count;                               /* Hyperslab selection */
+    unsigned    nthreads;                                   /* Filter thread count */
+    int *       wbuf = NULL, *rbuf = NULL;                  /* Data buffers */
+    herr_t      ret;                                        /* Generic return value */
+    int         i, d;                                       /* Local index variables */
 
-    TESTING("Fixed array chunk index header flush dependencies handled correctly");
+    TESTING("filter pipeline thread count");
 
-    /* Skip this test if SWMR I/O is not supported for the VFD specified
-     * by the environment variable.
-     */
-    if (!H5FD__supports_swmr_test(env_h5_driver)) {
-        SKIPPED();
-        HDputs("    Test skipped due to VFD not supporting SWMR I/O.");
-        return SUCCEED;
-    }
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
 
-    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
-        FAIL_STACK_ERROR;
+    if (NULL == (wbuf = (int *)HDmalloc(sizeof(int) * FILTER_NTHREADS_DIM)))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(sizeof(int) * FILTER_NTHREADS_DIM)))
+        TEST_ERROR
+    for (i = 0; i < FILTER_NTHREADS_DIM; i++)
+        wbuf[i] = i * 7;
 
-    h5_fixname(FILENAME[20], fapl, filename, sizeof(filename));
-    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
-        FAIL_STACK_ERROR;
+    /* Check the property's default, setting & error behavior */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_filter_nthreads(dxpl, &nthreads) < 0)
+        FAIL_STACK_ERROR
+    if (nthreads != 1)
+        FAIL_PUTS_ERROR("wrong default filter thread count")
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_filter_nthreads(dxpl, 0);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("zero filter thread count should be rejected")
+    if (H5Pset_filter_nthreads(dxpl, FILTER_NTHREADS_NTHREADS) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_filter_nthreads(dxpl, &nthreads) < 0)
+        FAIL_STACK_ERROR
+    if (nthreads != FILTER_NTHREADS_NTHREADS)
+        FAIL_PUTS_ERROR("wrong filter thread count")
 
-    /* Create a chunked dataset with fixed dimensions */
-    if ((sid = H5Screate_simple(1, shape, maxshape)) < 0)
-        FAIL_STACK_ERROR;
-    if ((tid = H5Tcopy(H5T_NATIVE_INT32)) < 0)
-        FAIL_STACK_ERROR;
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(1, &dim, NULL)) < 0)
+        FAIL_STACK_ERROR
     if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Pset_chunk(dcpl, 1, chunk) < 0)
-        FAIL_STACK_ERROR;
-    if ((did = H5Dcreate2(fid, DSET_FARRAY_HDR_FD, tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
-        FAIL_STACK_ERROR;
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 1, &chunk_dim) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_shuffle(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_fletcher32(dcpl) < 0)
+        FAIL_STACK_ERROR
 
-    /* Verify the chunk index type */
-    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
-        FAIL_STACK_ERROR;
-    if (idx_type != H5D_CHUNK_IDX_FARRAY)
-        FAIL_PUTS_ERROR("should be using fixed array as index");
+    /* The first dataset's cache holds only a few chunks, the second's holds them all */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk_cache(dapl, (size_t)521, 8 * FILTER_NTHREADS_CHUNK_DIM * sizeof(int),
+                           H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+
+    for (d = 0; d < 2; d++) {
+        if ((did = H5Dcreate2(fid, dset_names[d], H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl,
+                              d == 0 ? dapl : H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
 
+        /* Write all the chunks, then overwrite part of them, so that some
+         * cached chunks are modified again after being filtered */
+        if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, wbuf) < 0)
+            FAIL_STACK_ERROR
+        start = FILTER_NTHREADS_DIM / 2 + FILTER_NTHREADS_CHUNK_DIM / 2;
+        count = FILTER_NTHREADS_DIM / 4;
+        for (i = 0; i < (int)count; i++)
+            wbuf[start + (hsize_t)i] = -i;
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dwrite(did, H5T_NATIVE_INT, sid, sid, dxpl, wbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sselect_all(sid) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dflush(did) < 0)
+            FAIL_STACK_ERROR
+
+        /* Read the data back while chunks are still cached */
+        HDmemset(rbuf, 0, sizeof(int) * FILTER_NTHREADS_DIM);
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf, rbuf, sizeof(int) * FILTER_NTHREADS_DIM) != 0)
+            FAIL_PUTS_ERROR("wrong data read before closing dataset")
+
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+
+        /* Read the data back from the file, with and without threads */
+        if ((did = H5Dopen2(fid, dset_names[d], d == 0 ? dapl : H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, sizeof(int) * FILTER_NTHREADS_DIM);
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf, rbuf, sizeof(int) * FILTER_NTHREADS_DIM) != 0)
+            FAIL_PUTS_ERROR("wrong data read with filter threads")
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+        if ((did = H5Dopen2(fid, dset_names[d], H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, sizeof(int) * FILTER_NTHREADS_DIM);
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf, rbuf, sizeof(int) * FILTER_NTHREADS_DIM) != 0)
+            FAIL_PUTS_ERROR("wrong data read without filter threads")
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Write & read with an application filter that calls the library */
+    if (H5Zregister(H5Z_API_CALL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_filter(dcpl, H5Z_FILTER_API_CALL, 0, (size_t)0, NULL) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dcreate2(fid, FILTER_NTHREADS_DSET3, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, wbuf) < 0)
+        FAIL_STACK_ERROR
     if (H5Dclose(did) < 0)
-        FAIL_STACK_ERROR;
+        FAIL_STACK_ERROR
+    if ((did = H5Dopen2(fid, FILTER_NTHREADS_DSET3, dapl)) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(int) * FILTER_NTHREADS_DIM);
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+        FAIL_STACK_ERROR
+    if (HDmemcmp(wbuf, rbuf, sizeof(int) * FILTER_NTHREADS_DIM) != 0)
+        FAIL_PUTS_ERROR("wrong data read with application filter")
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Zunregister(H5Z_FILTER_API_CALL) < 0)
+        FAIL_STACK_ERROR
+
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
     if (H5Pclose(dcpl) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Tclose(tid) < 0)
-        FAIL_STACK_ERROR;
+        FAIL_STACK_ERROR
+    if (H5Pclose(dxpl) < 0)
+        FAIL_STACK_ERROR
     if (H5Sclose(sid) < 0)
-        FAIL_STACK_ERROR;
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
 
-    if (H5Fstart_swmr_write(fid) < 0)
-        FAIL_STACK_ERROR;
+    HDfree(wbuf);
+    HDfree(rbuf);
 
-    /* Write data to the dataset */
-    if ((did = H5Dopen2(fid, DSET_FARRAY_HDR_FD, H5P_DEFAULT)) < 0)
-        FAIL_STACK_ERROR;
-    if ((tid = H5Dget_type(did)) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Dwrite(did, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer) < 0)
-        FAIL_STACK_ERROR;
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Pclose(dxpl);
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    if (wbuf)
+        HDfree(wbuf);
+    if (rbuf)
+        HDfree(rbuf);
+    return FAIL;
+} /* end test_filter_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_prefetch
+ *
+ * Purpose:     Tests reading chunks ahead of a sequential reader
+ *              (H5Pset_chunk_prefetch), forwards and backwards through a
+ *              two-dimensional dataset's chunks, and that read-ahead is
+ *              off by default.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_prefetch(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    hid_t    fid  = -1; /* File ID */
+    hid_t    dcpl = -1; /* Dataset creation property list */
+    hid_t    dapl = -1; /* Dataset access property list */
+    hid_t    sid  = -1; /* File dataspace ID */
+    hid_t    msid = -1; /* Memory dataspace ID */
+    hid_t    did  = -1; /* Dataset ID */
+    hsize_t  dims[2]       = {CHUNK_PREFETCH_DIM, CHUNK_PREFETCH_DIM};             /* Dataset dimensions */
+    hsize_t  chunk_dims[2] = {CHUNK_PREFETCH_CHUNK_DIM, CHUNK_PREFETCH_CHUNK_DIM}; /* Chunk dimensions */
+    hsize_t  start[2];                                                 /* Hyperslab start */
+    int      wbuf[CHUNK_PREFETCH_DIM][CHUNK_PREFETCH_DIM];             /* Data written */
+    int      rbuf[CHUNK_PREFETCH_CHUNK_DIM][CHUNK_PREFETCH_CHUNK_DIM]; /* Data read */
+    int      nper    = CHUNK_PREFETCH_DIM / CHUNK_PREFETCH_CHUNK_DIM;  /* # of chunks in each dimension */
+    int      nchunks = nper * nper;                                    /* # of chunks in dataset */
+    unsigned prefetch;                                                 /* # of chunks to read ahead */
+    unsigned nprefetches, nhits, nmisses;                              /* Read-ahead statistics */
+    int      pass, n, c, i, j;                                         /* Local index variables */
+
+    TESTING("reading chunks ahead");
+
+    h5_fixname(FILENAME[28], fapl, filename, sizeof filename);
+
+    for (i = 0; i < CHUNK_PREFETCH_DIM; i++)
+        for (j = 0; j < CHUNK_PREFETCH_DIM; j++)
+            wbuf[i][j] = i * CHUNK_PREFETCH_DIM + j;
+
+    /* Check the property's default & setting */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_prefetch(dapl, &prefetch) < 0)
+        FAIL_STACK_ERROR
+    if (prefetch != 0)
+        FAIL_PUTS_ERROR("read-ahead should be disabled by default")
+    if (H5Pset_chunk_prefetch(dapl, CHUNK_PREFETCH_NCHUNKS) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_prefetch(dapl, &prefetch) < 0)
+        FAIL_STACK_ERROR
+    if (prefetch != CHUNK_PREFETCH_NCHUNKS)
+        FAIL_PUTS_ERROR("wrong number of chunks to read ahead")
+
+    /* Make the cache big enough for 16 chunks */
+    if (H5Pset_chunk_cache(dapl, (size_t)521,
+                           16 * CHUNK_PREFETCH_CHUNK_DIM * CHUNK_PREFETCH_CHUNK_DIM * sizeof(int),
+                           H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create the dataset */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((msid = H5Screate_simple(2, chunk_dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_shuffle(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dcreate2(fid, CHUNK_PREFETCH_DSET, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) <
+        0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
     if (H5Dclose(did) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Tclose(tid) < 0)
-        FAIL_STACK_ERROR;
+        FAIL_STACK_ERROR
 
-    /* The second call triggered a bug in the library (JIRA issue: SWMR-95) */
-    if (H5Oget_info_by_name3(fid, DSET_FARRAY_HDR_FD, &info, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Oget_info_by_name3(fid, DSET_FARRAY_HDR_FD, &info, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
-        FAIL_STACK_ERROR;
+    /* Read the chunks one at a time, forwards and then backwards, with and
+     * without read-ahead */
+    for (pass = 0; pass < 2; pass++) {
+        if ((did = H5Dopen2(fid, CHUNK_PREFETCH_DSET, pass == 0 ? dapl : H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        for (n = 0; n < 2 * nchunks; n++) {
+            c        = n < nchunks ? n : (2 * nchunks - 1) - n;
+            start[0] = (hsize_t)(c / nper) * CHUNK_PREFETCH_CHUNK_DIM;
+            start[1] = (hsize_t)(c % nper) * CHUNK_PREFETCH_CHUNK_DIM;
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, chunk_dims, NULL) < 0)
+                FAIL_STACK_ERROR
+            HDmemset(rbuf, 0, sizeof(rbuf));
+            if (H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0)
+                FAIL_STACK_ERROR
+            for (i = 0; i < CHUNK_PREFETCH_CHUNK_DIM; i++)
+                for (j = 0; j < CHUNK_PREFETCH_CHUNK_DIM; j++)
+                    if (rbuf[i][j] != wbuf[start[0] + (hsize_t)i][start[1] + (hsize_t)j])
+                        FAIL_PUTS_ERROR("wrong data read")
+        } /* end for */
+
+        /* Check that chunks were read ahead, and used, only when asked for */
+        if (H5D__chunk_prefetch_stats_test(did, &nprefetches, &nhits, &nmisses) < 0)
+            FAIL_STACK_ERROR
+        if (pass == 0) {
+            if (nhits < (unsigned)nchunks)
+                FAIL_PUTS_ERROR("too few chunks read ahead were used")
+            if (nhits + nmisses > nprefetches)
+                FAIL_PUTS_ERROR("inconsistent read-ahead statistics")
+        } /* end if */
+        else if (nprefetches != 0 || nhits != 0 || nmisses != 0)
+            FAIL_PUTS_ERROR("chunks read ahead without read-ahead enabled")
 
-    if (H5Pclose(fapl) < 0)
-        FAIL_STACK_ERROR;
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
     if (H5Fclose(fid) < 0)
-        TEST_ERROR;
+        FAIL_STACK_ERROR
 
     PASSED();
 
@@ -12386,122 +14452,145 @@ test_farray_hdr_fd(const char *env_h5_driver, hid_t fapl)
 error:
     H5E_BEGIN_TRY
     {
-        H5Pclose(fapl);
-        H5Fclose(fid);
-        H5Dclose(did);
+        H5Pclose(dapl);
         H5Pclose(dcpl);
-        H5Tclose(tid);
-        H5Sclose(sid);
+        H5Dclose(did);
         H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
     }
     H5E_END_TRY;
     return FAIL;
-} /* end test_farray_hdr_fd() */
+} /* end test_chunk_prefetch() */
 
 /*-------------------------------------------------------------------------
- * Function: test_bt2_hdr_fd
+ * Function:    test_chunk_cache_slots
  *
- * Purpose: Tests that version 2 B-tree header flush dependencies
- *          are created and torn down correctly when used as a
- *          chunk index.
- *
- * Return:      Success: 0
- *              Failure: -1
+ * Purpose:     Tests that the chunk cache holds as many chunks as fit in
+ *              its byte limit, however few hash table slots it's given,
+ *              including after the hash values of the cached chunks
+ *              change when the dataset is extended.
  *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_bt2_hdr_fd(const char *env_h5_driver, hid_t fapl)
+test_chunk_cache_slots(hid_t fapl)
 {
-    char              filename[FILENAME_BUF_SIZE];
-    hid_t             fid  = -1;
-    hid_t             sid  = -1;
-    hid_t             did  = -1;
-    hid_t             tid  = -1;
-    hid_t             dcpl = -1;
-    hid_t             msid = -1;
-    H5D_chunk_index_t idx_type;
-    const hsize_t     shape[2]    = {8, 8};
-    const hsize_t     maxshape[2] = {H5S_UNLIMITED, H5S_UNLIMITED};
-    const hsize_t     chunk[2]    = {8, 8};
-    const int         buffer[8]   = {0, 1, 2, 3, 4, 5, 6, 7};
-    H5O_info2_t       info;
-
-    TESTING("Version 2 B-tree chunk index header flush dependencies handled correctly");
-
-    /* Initialize struct */
-    HDmemset(&info, 0, sizeof(info));
-
-    /* Skip this test if SWMR I/O is not supported for the VFD specified
-     * by the environment variable.
-     */
-    if (!H5FD__supports_swmr_test(env_h5_driver)) {
-        SKIPPED();
-        HDputs("    Test skipped due to VFD not supporting SWMR I/O.");
-        return SUCCEED;
-    }
+    char    filename[FILENAME_BUF_SIZE];
+    hid_t   fid  = -1; /* File ID */
+    hid_t   dcpl = -1; /* Dataset creation property list */
+    hid_t   dapl = -1; /* Dataset access property list */
+    hid_t   sid  = -1; /* File dataspace ID */
+    hid_t   msid = -1; /* Memory dataspace ID */
+    hid_t   did  = -1; /* Dataset ID */
+    hsize_t start[2]      = {0, 0};                                         /* Hyperslab start */
+    hsize_t dims[2]       = {CACHE_SLOTS_DIM, CACHE_SLOTS_DIM};             /* Dataset dimensions */
+    hsize_t new_dims[2]   = {CACHE_SLOTS_DIM, 4 * CACHE_SLOTS_DIM};         /* Extended dimensions */
+    hsize_t max_dims[2]   = {CACHE_SLOTS_DIM, H5S_UNLIMITED};               /* Maximum dimensions */
+    hsize_t chunk_dims[2] = {CACHE_SLOTS_CHUNK_DIM, CACHE_SLOTS_CHUNK_DIM}; /* Chunk dimensions */
+    size_t  nslots;                                                         /* # of cache slots */
+    size_t  nbytes_used;                                                    /* Bytes cached */
+    int     nused;                                                          /* # of chunks cached */
+    int *   wbuf = NULL, *rbuf = NULL;                                      /* Data buffers */
+    int     i;                                                              /* Local index variable */
+
+    TESTING("chunk cache with few hash table slots");
+
+    h5_fixname(FILENAME[29], fapl, filename, sizeof filename);
+
+    if (NULL == (wbuf = (int *)HDmalloc(sizeof(int) * CACHE_SLOTS_DIM * CACHE_SLOTS_DIM)))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(sizeof(int) * CACHE_SLOTS_DIM * CACHE_SLOTS_DIM)))
+        TEST_ERROR
+    for (i = 0; i < CACHE_SLOTS_DIM * CACHE_SLOTS_DIM; i++)
+        wbuf[i] = i;
 
-    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
-        FAIL_STACK_ERROR;
+    /* Give the cache a single slot, but room for all the chunks */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk_cache(dapl, (size_t)1, CACHE_SLOTS_DIM * CACHE_SLOTS_DIM * sizeof(int),
+                           H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
 
-    h5_fixname(FILENAME[21], fapl, filename, sizeof(filename));
     if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
-        FAIL_STACK_ERROR;
-
-    /* Create a chunked dataset with fixed dimensions */
-    if ((sid = H5Screate_simple(2, shape, maxshape)) < 0)
-        FAIL_STACK_ERROR;
-    if ((tid = H5Tcopy(H5T_NATIVE_INT32)) < 0)
-        FAIL_STACK_ERROR;
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
+        FAIL_STACK_ERROR
+    if ((msid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
     if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
-        FAIL_STACK_ERROR;
-    if ((did = H5Dcreate2(fid, DSET_BT2_HDR_FD, tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
-        FAIL_STACK_ERROR;
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
 
-    /* Verify the chunk index type */
-    if (H5D__layout_idx_type_test(did, &idx_type) < 0)
-        FAIL_STACK_ERROR;
-    if (idx_type != H5D_CHUNK_IDX_BT2)
-        FAIL_PUTS_ERROR("should be using fixed array as index");
+    /* Write the data and check that every chunk stayed in the cache */
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+    if (H5D__current_cache_size_test(did, &nbytes_used, &nused) < 0)
+        FAIL_STACK_ERROR
+    if (nused != CACHE_SLOTS_NCHUNKS)
+        FAIL_PUTS_ERROR("chunks were preempted from the cache")
 
-    if (H5Dclose(did) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Pclose(dcpl) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Tclose(tid) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Sclose(sid) < 0)
-        FAIL_STACK_ERROR;
+    /* The number of slots requested is still reported */
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if ((dapl = H5Dget_access_plist(did)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_cache(dapl, &nslots, NULL, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (nslots != 1)
+        FAIL_PUTS_ERROR("wrong number of chunk cache slots")
 
-    if (H5Fstart_swmr_write(fid) < 0)
-        FAIL_STACK_ERROR;
+    /* Extend the dataset, which changes the cached chunks' hash values, and
+     * check that they're all still cached & hold the right data */
+    if (H5Dset_extent(did, new_dims) < 0)
+        FAIL_STACK_ERROR
+    if (H5D__current_cache_size_test(did, &nbytes_used, &nused) < 0)
+        FAIL_STACK_ERROR
+    if (nused != CACHE_SLOTS_NCHUNKS)
+        FAIL_PUTS_ERROR("chunks were preempted from the cache when the dataset was extended")
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Dget_space(did)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, dims, NULL) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(int) * CACHE_SLOTS_DIM * CACHE_SLOTS_DIM);
+    if (H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    if (HDmemcmp(wbuf, rbuf, sizeof(int) * CACHE_SLOTS_DIM * CACHE_SLOTS_DIM) != 0)
+        FAIL_PUTS_ERROR("wrong data read from cache")
 
-    /* Write data to the dataset */
-    if ((did = H5Dopen2(fid, DSET_BT2_HDR_FD, H5P_DEFAULT)) < 0)
-        FAIL_STACK_ERROR;
-    if ((tid = H5Dget_type(did)) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Dwrite(did, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer) < 0)
-        FAIL_STACK_ERROR;
+    /* Read the data back from the file */
     if (H5Dclose(did) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Tclose(tid) < 0)
-        FAIL_STACK_ERROR;
-
-    /* The second call triggered a bug in the library (JIRA issue: SWMR-95) */
-    if (H5Oget_info_by_name3(fid, DSET_BT2_HDR_FD, &info, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
-        FAIL_STACK_ERROR;
-    if (H5Oget_info_by_name3(fid, DSET_BT2_HDR_FD, &info, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
-        FAIL_STACK_ERROR;
+        FAIL_STACK_ERROR
+    if ((did = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(int) * CACHE_SLOTS_DIM * CACHE_SLOTS_DIM);
+    if (H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    if (HDmemcmp(wbuf, rbuf, sizeof(int) * CACHE_SLOTS_DIM * CACHE_SLOTS_DIM) != 0)
+        FAIL_PUTS_ERROR("wrong data read from file")
 
-    if (H5Pclose(fapl) < 0)
-        FAIL_STACK_ERROR;
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
     if (H5Fclose(fid) < 0)
-        TEST_ERROR;
+        FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
 
     PASSED();
 
@@ -12510,488 +14599,659 @@ test_bt2_hdr_fd(const char *env_h5_driver, hid_t fapl)
 error:
     H5E_BEGIN_TRY
     {
-        H5Pclose(fapl);
-        H5Fclose(fid);
-        H5Dclose(did);
+        H5Pclose(dapl);
         H5Pclose(dcpl);
-        H5Tclose(tid);
-        H5Sclose(sid);
+        H5Dclose(did);
         H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
     }
     H5E_END_TRY;
+    if (wbuf)
+        HDfree(wbuf);
+    if (rbuf)
+        HDfree(rbuf);
     return FAIL;
-} /* end test_bt2_hdr_fd() */
+} /* end test_chunk_cache_slots() */
 
 /*-------------------------------------------------------------------------
- * Function: test_storage_size
- *
- * Purpose:     Tests results from querying the storage size of a dataset,
- *              before/after extending the dimensions.
+ * Function:    test_chunk_cache_shared
  *
- * Return:      Success: 0
- *              Failure: -1
- *
- * Programmer:  Quincey Koziol
- *              Monday, April 11, 2016
+ * Purpose:     Tests that the chunks cached for all of a file's datasets
+ *              stay within the budget of the file's shared chunk cache,
+ *              that dirty chunks of one dataset preempted to make room
+ *              for another's are written correctly, and that the file's
+ *              hit statistics are counted.
  *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_storage_size(hid_t fapl)
+test_chunk_cache_shared(hid_t fapl)
 {
     char    filename[FILENAME_BUF_SIZE];
-    hid_t   fid  = -1;             /* File ID */
-    hid_t   dcpl = -1, dcpl2 = -1; /* Dataset creation property list IDs */
-    hid_t   sid  = -1;             /* Dataspace ID */
-    hid_t   dsid = -1;             /* Dataset ID */
-    hsize_t dims[2], max_dims[2];  /* Dataset dimensions */
-    hsize_t new_dims[2];           /* New dataset dimensions */
-    hsize_t chunk_dims[2];         /* Chunk dimensions */
-    int     wdata[STORAGE_SIZE_DIM1][STORAGE_SIZE_DIM2];
-    hsize_t ssize; /* Dataset storage size */
-
-    TESTING("querying storage size");
-
-    h5_fixname(FILENAME[22], fapl, filename, sizeof filename);
-
-    /* Create file */
-    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
-        FAIL_STACK_ERROR
-
-    /* Create dataset creation property list */
-    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-        FAIL_STACK_ERROR
-
-    /* Set chunk size */
-    chunk_dims[0] = STORAGE_SIZE_CHUNK_DIM1;
-    chunk_dims[1] = STORAGE_SIZE_CHUNK_DIM2;
-    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
-        FAIL_STACK_ERROR
-
-    /* Copy the DCPL, and set it to early allocation */
-    if ((dcpl2 = H5Pcopy(dcpl)) < 0)
-        FAIL_STACK_ERROR
-    if (H5Pset_alloc_time(dcpl2, H5D_ALLOC_TIME_EARLY) < 0)
-        FAIL_STACK_ERROR
-
-    /* Create 2D dataspace, with max dims same as current dimensions */
-    dims[0]     = STORAGE_SIZE_DIM1;
-    dims[1]     = STORAGE_SIZE_DIM2;
-    max_dims[0] = STORAGE_SIZE_DIM1;
-    max_dims[1] = STORAGE_SIZE_DIM2;
-    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
-        FAIL_STACK_ERROR
-
-    /* Create chunked dataset */
-    if ((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
-        FAIL_STACK_ERROR
-
-    /* Initialize buffer to zeroes */
-    HDmemset(wdata, 0, sizeof(wdata));
+    char    dset_name[16];                               /* Dataset name */
+    hid_t   fid           = -1;                          /* File ID */
+    hid_t   sfapl         = -1;                          /* File access property list with shared cache */
+    hid_t   dcpl          = -1;                          /* Dataset creation property list */
+    hid_t   sid           = -1;                          /* Dataspace ID */
+    hid_t   did[CACHE_SHARED_NDSETS];                    /* Dataset IDs */
+    hsize_t dims[1];                                     /* Dataset dimensions */
+    hsize_t chunk_dims[1] = {CACHE_SHARED_CHUNK_DIM};    /* Chunk dimensions */
+    hsize_t nhits, nmisses;                              /* File's shared cache statistics */
+    size_t  nbytes;                                      /* Size of shared cache */
+    size_t  cur_size;                                    /* Bytes cached in shared cache */
+    size_t  nbytes_used;                                 /* Bytes cached for a dataset */
+    size_t  total_used;                                  /* Bytes cached for all datasets */
+    int     nused;                                       /* # of chunks cached for a dataset */
+    int     wbuf[CACHE_SHARED_NDSETS][CACHE_SHARED_DIM]; /* Data written */
+    int     rbuf[CACHE_SHARED_DIM];                      /* Data read */
+    int     i, j;                                        /* Local index variables */
 
-    /* write elements to dataset */
-    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
-        FAIL_STACK_ERROR
+    TESTING("chunk cache shared by a file's datasets");
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
-        FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
+    for (i = 0; i < CACHE_SHARED_NDSETS; i++)
+        did[i] = -1;
 
-    /* Close dataset & dataspace */
-    if (H5Sclose(sid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Dclose(dsid) < 0)
-        FAIL_STACK_ERROR
+    h5_fixname(FILENAME[30], fapl, filename, sizeof filename);
 
-    /* Copy the dataset */
-    if (H5Ocopy(fid, "dset", fid, "dset_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
+    if ((sfapl = H5Pcopy(fapl)) < 0)
         FAIL_STACK_ERROR
-
-    /* Open the copied dataset */
-    if ((dsid = H5Dopen2(fid, "dset_copy", H5P_DEFAULT)) < 0)
+    if (H5Pset_shared_chunk_cache(sfapl, CACHE_SHARED_NBYTES) < 0)
         FAIL_STACK_ERROR
-
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    if (H5Pget_shared_chunk_cache(sfapl, &nbytes) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
+    if (nbytes != CACHE_SHARED_NBYTES)
+        FAIL_PUTS_ERROR("wrong shared chunk cache size")
 
-    /* Close copied dataset */
-    if (H5Dclose(dsid) < 0)
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, sfapl)) < 0)
         FAIL_STACK_ERROR
-
-    /* Create 2D dataspace with max dims > current dims (but not unlimited) */
-    dims[0]     = STORAGE_SIZE_DIM1;
-    dims[1]     = STORAGE_SIZE_DIM2;
-    max_dims[0] = STORAGE_SIZE_MAX_DIM1;
-    max_dims[1] = STORAGE_SIZE_MAX_DIM2;
-    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
         FAIL_STACK_ERROR
-
-    /* Create chunked dataset */
-    if ((dsid = H5Dcreate2(fid, "dset2", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+    if (H5Pset_chunk(dcpl, 1, chunk_dims) < 0)
         FAIL_STACK_ERROR
 
-    /* Initialize buffer to zeroes */
-    HDmemset(wdata, 0, sizeof(wdata));
+    /* Create the datasets.  The first has a single chunk (so with the latest
+     * format its index is updated in the object header when it's flushed) */
+    for (i = 0; i < CACHE_SHARED_NDSETS; i++) {
+        dims[0] = (i == 0) ? CACHE_SHARED_CHUNK_DIM : CACHE_SHARED_DIM;
+        if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+            FAIL_STACK_ERROR
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%d", i);
+        if ((did[i] = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sclose(sid) < 0)
+            FAIL_STACK_ERROR
+        sid = -1;
 
-    /* write elements to dataset */
-    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
-        FAIL_STACK_ERROR
+        for (j = 0; j < CACHE_SHARED_DIM; j++)
+            wbuf[i][j] = (i * CACHE_SHARED_DIM) + j;
+    } /* end for */
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
-        FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
+    /* Write each dataset in turn, checking that the chunks cached for all of
+     * them stay within the shared budget */
+    for (i = 0; i < CACHE_SHARED_NDSETS; i++) {
+        if (H5Dwrite(did[i], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf[i]) < 0)
+            FAIL_STACK_ERROR
 
-    /* Extend dataset's dimensions */
-    new_dims[0] = STORAGE_SIZE_DIM1 * 2;
-    new_dims[1] = STORAGE_SIZE_DIM2 * 2;
-    if (H5Dset_extent(dsid, new_dims) < 0)
+        total_used = 0;
+        for (j = 0; j < CACHE_SHARED_NDSETS; j++) {
+            if (H5D__current_cache_size_test(did[j], &nbytes_used, &nused) < 0)
+                FAIL_STACK_ERROR
+            total_used += nbytes_used;
+        } /* end for */
+        if (total_used > CACHE_SHARED_NBYTES)
+            FAIL_PUTS_ERROR("datasets' chunks exceed the shared cache size")
+        if (H5Fget_shared_chunk_cache_stats(fid, &cur_size, NULL, NULL) < 0)
+            FAIL_STACK_ERROR
+        if (cur_size != total_used)
+            FAIL_PUTS_ERROR("wrong shared cache size reported")
+    } /* end for */
+
+    /* The last dataset's chunks have taken the whole cache */
+    if (H5D__current_cache_size_test(did[CACHE_SHARED_NDSETS - 1], &nbytes_used, &nused) < 0)
         FAIL_STACK_ERROR
+    if (nbytes_used != CACHE_SHARED_NBYTES)
+        FAIL_PUTS_ERROR("wrong number of bytes cached for last dataset")
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    for (i = 0; i < CACHE_SHARED_NDSETS; i++) {
+        if (H5Dclose(did[i]) < 0)
+            FAIL_STACK_ERROR
+        did[i] = -1;
+    } /* end for */
+    if (H5Fclose(fid) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
 
-    /* Close dataset & dataspace */
-    if (H5Sclose(sid) < 0)
+    /* Reopen the file and check the statistics of reading a dataset twice */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, sfapl)) < 0)
         FAIL_STACK_ERROR
-    if (H5Dclose(dsid) < 0)
+    if ((did[1] = H5Dopen2(fid, "dset1", H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
-
-    /* Copy the dataset */
-    if (H5Ocopy(fid, "dset2", fid, "dset2_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
+    for (i = 0; i < 2; i++) {
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if (H5Dread(did[1], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf[1], rbuf, sizeof(rbuf)) != 0)
+            FAIL_PUTS_ERROR("wrong data read")
+    } /* end for */
+    if (H5Fget_shared_chunk_cache_stats(fid, &cur_size, &nhits, &nmisses) < 0)
         FAIL_STACK_ERROR
-
-    /* Open the copied dataset */
-    if ((dsid = H5Dopen2(fid, "dset2_copy", H5P_DEFAULT)) < 0)
+    if (cur_size != CACHE_SHARED_NBYTES)
+        FAIL_PUTS_ERROR("wrong shared cache size reported")
+    if (nmisses != CACHE_SHARED_DIM / CACHE_SHARED_CHUNK_DIM ||
+        nhits != CACHE_SHARED_DIM / CACHE_SHARED_CHUNK_DIM)
+        FAIL_PUTS_ERROR("wrong shared cache statistics")
+    if (H5Dclose(did[1]) < 0)
         FAIL_STACK_ERROR
-
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    did[1] = -1;
+    if (H5Fclose(fid) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
 
-    /* Close copied dataset */
-    if (H5Dclose(dsid) < 0)
+    /* Check all the data written, without the shared cache */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
         FAIL_STACK_ERROR
-
-    /* Create 2D dataspace with max dims > current dims (but not unlimited) */
-    dims[0]     = STORAGE_SIZE_DIM1;
-    dims[1]     = STORAGE_SIZE_DIM2;
-    max_dims[0] = STORAGE_SIZE_MAX_DIM1;
-    max_dims[1] = STORAGE_SIZE_MAX_DIM2;
-    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
+    if (H5Fget_shared_chunk_cache_stats(fid, &cur_size, &nhits, &nmisses) < 0)
         FAIL_STACK_ERROR
+    if (cur_size != 0 || nhits != 0 || nmisses != 0)
+        FAIL_PUTS_ERROR("statistics reported for unused shared cache")
+    for (i = 0; i < CACHE_SHARED_NDSETS; i++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%d", i);
+        if ((did[i] = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if (H5Dread(did[i], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf[i], rbuf, (i == 0 ? CACHE_SHARED_CHUNK_DIM : CACHE_SHARED_DIM) * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("wrong data read from file")
+        if (H5Dclose(did[i]) < 0)
+            FAIL_STACK_ERROR
+        did[i] = -1;
+    } /* end for */
 
-    /* Create chunked dataset, w/early allocation */
-    if ((dsid = H5Dcreate2(fid, "dset2a", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl2, H5P_DEFAULT)) < 0)
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(sfapl) < 0)
         FAIL_STACK_ERROR
 
-    /* Initialize buffer to zeroes */
-    HDmemset(wdata, 0, sizeof(wdata));
+    PASSED();
 
-    /* write elements to dataset */
-    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
-        FAIL_STACK_ERROR
+    return SUCCEED;
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
-        FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
+error:
+    H5E_BEGIN_TRY
+    {
+        for (i = 0; i < CACHE_SHARED_NDSETS; i++)
+            H5Dclose(did[i]);
+        H5Pclose(dcpl);
+        H5Pclose(sfapl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_chunk_cache_shared() */
 
-    /* Extend dataset's dimensions */
-    new_dims[0] = STORAGE_SIZE_DIM1 * 2;
-    new_dims[1] = STORAGE_SIZE_DIM2 * 2;
-    if (H5Dset_extent(dsid, new_dims) < 0)
-        FAIL_STACK_ERROR
+/*-------------------------------------------------------------------------
+ * Function:    test_multi_dset_io
+ *
+ * Purpose:     Tests reading and writing several datasets with one call,
+ *              mixing datasets that are transferred as blocks (whole
+ *              contiguous datasets without conversion, adjacent in the
+ *              file) with chunked datasets, partial selections and
+ *              datatype conversion, and a dataset given twice.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_multi_dset_io(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    char        dset_name[16];                   /* Dataset name */
+    hid_t       fid           = -1;              /* File ID */
+    hid_t       dcpl          = -1;              /* Contiguous dataset creation property list */
+    hid_t       chunk_dcpl    = -1;              /* Chunked dataset creation property list */
+    hid_t       dxpl          = -1;              /* Dataset transfer property list */
+    hid_t       sid           = -1;              /* File dataspace ID */
+    hid_t       hs_sid        = -1;              /* File dataspace ID with hyperslab selected */
+    hid_t       mem_sid       = -1;              /* Memory dataspace ID for hyperslab */
+    hid_t       did[MULTI_NDSETS];               /* Dataset IDs */
+    hid_t       mem_tid[MULTI_NDSETS];           /* Memory datatype IDs */
+    hid_t       mem_space[MULTI_NDSETS];         /* Memory dataspace IDs */
+    hid_t       file_space[MULTI_NDSETS];        /* File dataspace IDs */
+    hid_t       bad_did[2];                      /* Dataset IDs, one invalid */
+    hid_t       dup_did[2];                      /* Dataset IDs, the same dataset twice */
+    hid_t       dup_mem_space[2];                /* Memory dataspace IDs for the same dataset */
+    hid_t       dup_file_space[2];               /* File dataspace IDs for the same dataset */
+    const void *dup_wbufs[2];                    /* Buffers written to the same dataset */
+    hsize_t     dims[1]       = {MULTI_DIM};     /* Dataset dimensions */
+    hsize_t     chunk_dims[1] = {MULTI_DIM / 4}; /* Chunk dimensions */
+    hsize_t     start[1]      = {MULTI_DIM / 4}; /* Hyperslab start */
+    hsize_t     count[1]      = {MULTI_DIM / 2}; /* Hyperslab size */
+    int         wbuf[MULTI_NDSETS][MULTI_DIM];   /* Data written */
+    int         rbuf[MULTI_NDSETS][MULTI_DIM];   /* Data read */
+    double      dbuf[MULTI_DIM];                 /* Data read with conversion */
+    int         expect[MULTI_NDSETS][MULTI_DIM]; /* Data expected in the file */
+    const void *wbufs[MULTI_NDSETS];             /* Buffers written */
+    void *      rbufs[MULTI_NDSETS];             /* Buffers read */
+    int         pass;                            /* Pass through writing test */
+    int         i, j;                            /* Local index variables */
+
+    TESTING("multi-dataset I/O");
+
+    for (i = 0; i < MULTI_NDSETS; i++)
+        did[i] = -1;
+
+    h5_fixname(FILENAME[31], fapl, filename, sizeof filename);
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 15 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
-
-    /* Close dataset & dataspace */
-    if (H5Sclose(sid) < 0)
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
         FAIL_STACK_ERROR
-    if (H5Dclose(dsid) < 0)
+    if ((hs_sid = H5Scopy(sid)) < 0)
         FAIL_STACK_ERROR
-
-    /* Copy the dataset */
-    if (H5Ocopy(fid, "dset2a", fid, "dset2a_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
+    if (H5Sselect_hyperslab(hs_sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
         FAIL_STACK_ERROR
-
-    /* Open the copied dataset */
-    if ((dsid = H5Dopen2(fid, "dset2a_copy", H5P_DEFAULT)) < 0)
+    if ((mem_sid = H5Screate_simple(1, count, NULL)) < 0)
         FAIL_STACK_ERROR
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    /* Allocate the contiguous datasets' storage early, so that it is adjacent in the file */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 15 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
-
-    /* Close copied dataset */
-    if (H5Dclose(dsid) < 0)
+    if (H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0)
         FAIL_STACK_ERROR
-
-    /* Create 2D dataspace with max dims > current dims (and 1 unlimited dim) */
-    dims[0]     = STORAGE_SIZE_DIM1;
-    dims[1]     = STORAGE_SIZE_DIM2;
-    max_dims[0] = H5S_UNLIMITED;
-    max_dims[1] = STORAGE_SIZE_MAX_DIM2;
-    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
+    if ((chunk_dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
         FAIL_STACK_ERROR
-
-    /* Create chunked dataset */
-    if ((dsid = H5Dcreate2(fid, "dset3", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+    if (H5Pset_chunk(chunk_dcpl, 1, chunk_dims) < 0)
         FAIL_STACK_ERROR
 
-    /* Initialize buffer to zeroes */
-    HDmemset(wdata, 0, sizeof(wdata));
+    /* Datasets 0-3 are contiguous, 4 is chunked, 5 is contiguous and written
+     * through a hyperslab selection */
+    for (i = 0; i < MULTI_NDSETS; i++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%d", i);
+        if ((did[i] = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT,
+                                 (i == 4 ? chunk_dcpl : dcpl), H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        mem_tid[i]    = H5T_NATIVE_INT;
+        mem_space[i]  = (i == 5) ? mem_sid : H5S_ALL;
+        file_space[i] = (i == 5) ? hs_sid : H5S_ALL;
+        HDmemset(expect[i], 0, sizeof(expect[i]));
+    } /* end for */
 
-    /* write elements to dataset */
-    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
+    /* Dirty the sieve buffer of a dataset written as a block */
+    for (j = 0; j < MULTI_DIM / 2; j++)
+        wbuf[1][j] = -j;
+    if (H5Dwrite(did[1], H5T_NATIVE_INT, mem_sid, hs_sid, H5P_DEFAULT, wbuf[1]) < 0)
         FAIL_STACK_ERROR
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
-        FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
+    /* Write the datasets twice, the second time with a temporary buffer too
+     * small to merge all the blocks */
+    for (pass = 0; pass < 2; pass++) {
+        if (pass == 1) {
+            if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+                FAIL_STACK_ERROR
+            if (H5Pset_buffer(dxpl, 2 * MULTI_DIM * sizeof(int), NULL, NULL) < 0)
+                FAIL_STACK_ERROR
+        } /* end if */
 
-    /* Extend dataset's dimensions */
-    new_dims[0] = STORAGE_SIZE_DIM1 * 2;
-    new_dims[1] = STORAGE_SIZE_DIM2 * 2;
-    if (H5Dset_extent(dsid, new_dims) < 0)
-        FAIL_STACK_ERROR
+        for (i = 0; i < MULTI_NDSETS; i++) {
+            for (j = 0; j < MULTI_DIM; j++)
+                wbuf[i][j] = (pass * 1000) + (i * MULTI_DIM) + j;
+            wbufs[i] = wbuf[i];
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
-        FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
+            if (i == 5)
+                for (j = 0; j < MULTI_DIM / 2; j++)
+                    expect[i][j + MULTI_DIM / 4] = wbuf[i][j];
+            else
+                HDmemcpy(expect[i], wbuf[i], sizeof(expect[i]));
+        } /* end for */
 
-    /* Close dataset & dataspace */
-    if (H5Sclose(sid) < 0)
-        FAIL_STACK_ERROR
-    if (H5Dclose(dsid) < 0)
-        FAIL_STACK_ERROR
+        if (H5Dwrite_multi(MULTI_NDSETS, did, mem_tid, mem_space, file_space,
+                           (pass == 1 ? dxpl : H5P_DEFAULT), wbufs) < 0)
+            FAIL_STACK_ERROR
 
-    /* Copy the dataset */
-    if (H5Ocopy(fid, "dset3", fid, "dset3_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
-        FAIL_STACK_ERROR
+        /* Read the datasets back with one call */
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        for (i = 0; i < MULTI_NDSETS; i++)
+            rbufs[i] = rbuf[i];
+        if (H5Dread_multi(MULTI_NDSETS, did, mem_tid, mem_space, file_space,
+                          (pass == 1 ? dxpl : H5P_DEFAULT), rbufs) < 0)
+            FAIL_STACK_ERROR
+        for (i = 0; i < MULTI_NDSETS; i++)
+            if (HDmemcmp(wbuf[i], rbuf[i], (i == 5 ? MULTI_DIM / 2 : MULTI_DIM) * sizeof(int)) != 0)
+                FAIL_PUTS_ERROR("wrong data read with H5Dread_multi")
 
-    /* Open the copied dataset */
-    if ((dsid = H5Dopen2(fid, "dset3_copy", H5P_DEFAULT)) < 0)
-        FAIL_STACK_ERROR
+        /* The sieve buffer must not hide the data written as a block */
+        HDmemset(rbuf[1], 0, sizeof(rbuf[1]));
+        if (H5Dread(did[1], H5T_NATIVE_INT, mem_sid, hs_sid, H5P_DEFAULT, rbuf[1]) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(&expect[1][MULTI_DIM / 4], rbuf[1], (MULTI_DIM / 2) * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("wrong data read through sieve buffer")
+    } /* end for */
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
-        FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
+    /* Read with datatype conversion */
+    mem_tid[2] = H5T_NATIVE_DOUBLE;
+    rbufs[2]   = dbuf;
+    if (H5Dread_multi(MULTI_NDSETS, did, mem_tid, mem_space, file_space, H5P_DEFAULT, rbufs) < 0)
+        FAIL_STACK_ERROR
+    for (j = 0; j < MULTI_DIM; j++)
+        if (!H5_DBL_ABS_EQUAL(dbuf[j], (double)expect[2][j]))
+            FAIL_PUTS_ERROR("wrong data read with conversion")
+
+    /* A dataset given twice is written in the order given: all of it (which
+     * alone would be written as a block), then a hyperslab of it */
+    dup_did[0]        = did[0];
+    dup_did[1]        = did[0];
+    dup_mem_space[0]  = H5S_ALL;
+    dup_mem_space[1]  = mem_sid;
+    dup_file_space[0] = H5S_ALL;
+    dup_file_space[1] = hs_sid;
+    for (j = 0; j < MULTI_DIM; j++)
+        wbuf[0][j] = 5000 + j;
+    for (j = 0; j < MULTI_DIM / 2; j++)
+        wbuf[1][j] = -5000 - j;
+    dup_wbufs[0] = wbuf[0];
+    dup_wbufs[1] = wbuf[1];
+    HDmemcpy(expect[0], wbuf[0], sizeof(expect[0]));
+    for (j = 0; j < MULTI_DIM / 2; j++)
+        expect[0][j + MULTI_DIM / 4] = wbuf[1][j];
+    if (H5Dwrite_multi(2, dup_did, mem_tid, dup_mem_space, dup_file_space, H5P_DEFAULT, dup_wbufs) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf[0], 0, sizeof(rbuf[0]));
+    if (H5Dread(did[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf[0]) < 0)
+        FAIL_STACK_ERROR
+    if (HDmemcmp(expect[0], rbuf[0], sizeof(rbuf[0])) != 0)
+        FAIL_PUTS_ERROR("wrong data written to a dataset given twice")
+
+    /* An invalid dataset ID fails the call */
+    bad_did[0] = did[0];
+    bad_did[1] = sid;
+    H5E_BEGIN_TRY
+    {
+        if (H5Dwrite_multi(2, bad_did, mem_tid, mem_space, file_space, H5P_DEFAULT, wbufs) >= 0)
+            FAIL_PUTS_ERROR("H5Dwrite_multi succeeded with invalid dataset ID")
+    }
+    H5E_END_TRY;
 
-    /* Close copied dataset */
-    if (H5Dclose(dsid) < 0)
+    for (i = 0; i < MULTI_NDSETS; i++) {
+        if (H5Dclose(did[i]) < 0)
+            FAIL_STACK_ERROR
+        did[i] = -1;
+    } /* end for */
+    if (H5Fclose(fid) < 0)
         FAIL_STACK_ERROR
 
-    /* Create 2D dataspace with max dims > current dims (and 1 unlimited dim) */
-    dims[0]     = STORAGE_SIZE_DIM1;
-    dims[1]     = STORAGE_SIZE_DIM2;
-    max_dims[0] = H5S_UNLIMITED;
-    max_dims[1] = STORAGE_SIZE_MAX_DIM2;
-    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
+    /* Check the data in the file */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
         FAIL_STACK_ERROR
+    for (i = 0; i < MULTI_NDSETS; i++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%d", i);
+        if ((did[i] = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf[i], 0, sizeof(rbuf[i]));
+        if (H5Dread(did[i], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf[i]) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(expect[i], rbuf[i], sizeof(rbuf[i])) != 0)
+            FAIL_PUTS_ERROR("wrong data read from file")
+        if (H5Dclose(did[i]) < 0)
+            FAIL_STACK_ERROR
+        did[i] = -1;
+    } /* end for */
 
-    /* Create chunked dataset, w/early allocation */
-    if ((dsid = H5Dcreate2(fid, "dset3a", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl2, H5P_DEFAULT)) < 0)
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dxpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(chunk_dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(mem_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(hs_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
         FAIL_STACK_ERROR
 
-    /* Initialize buffer to zeroes */
-    HDmemset(wdata, 0, sizeof(wdata));
+    PASSED();
 
-    /* write elements to dataset */
-    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
-        FAIL_STACK_ERROR
+    return SUCCEED;
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
-        FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
+error:
+    H5E_BEGIN_TRY
+    {
+        for (i = 0; i < MULTI_NDSETS; i++)
+            H5Dclose(did[i]);
+        H5Pclose(dxpl);
+        H5Pclose(chunk_dcpl);
+        H5Pclose(dcpl);
+        H5Sclose(mem_sid);
+        H5Sclose(hs_sid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_multi_dset_io() */
 
-    /* Extend dataset's dimensions */
-    new_dims[0] = STORAGE_SIZE_DIM1 * 2;
-    new_dims[1] = STORAGE_SIZE_DIM2 * 2;
-    if (H5Dset_extent(dsid, new_dims) < 0)
-        FAIL_STACK_ERROR
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_pin
+ *
+ * Purpose:     Tests pinning chunks of a filtered dataset in the chunk
+ *              cache and reading them in place: that pinned chunks stay
+ *              cached while other chunks cycle through the cache, that
+ *              writes to them are visible through the pointer, and that
+ *              the operations that would move or replace them fail.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_pin(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid  = -1;                                                  /* File ID */
+    hid_t       dcpl = -1;                                                  /* DCPL */
+    hid_t       dapl = -1;                                                  /* DAPL */
+    hid_t       sid  = -1;                                                  /* Dataspace ID */
+    hid_t       fsid = -1;                                                  /* File dataspace ID */
+    hid_t       did  = -1;                                                  /* Dataset ID */
+    hsize_t     dims[2]       = {CHUNK_PIN_DIM0, CHUNK_PIN_DIM1};           /* Dataset dimensions */
+    hsize_t     max_dims[2]   = {H5S_UNLIMITED, H5S_UNLIMITED};             /* Maximum dimensions */
+    hsize_t     new_dims[2]   = {CHUNK_PIN_DIM0 + 2, CHUNK_PIN_DIM1};       /* Extended dimensions */
+    hsize_t     chunk_dims[2] = {CHUNK_PIN_CHUNK_DIM, CHUNK_PIN_CHUNK_DIM}; /* Chunk dimensions */
+    hsize_t     offset0[2]    = {0, 0};                                     /* First chunk */
+    hsize_t     offset1[2]    = {CHUNK_PIN_CHUNK_DIM, CHUNK_PIN_CHUNK_DIM}; /* Another full chunk */
+    hsize_t     edge[2]       = {24, 0};                                    /* Partial edge chunk */
+    hsize_t     unaligned[2]  = {1, 0};                                     /* Not a chunk's offset */
+    const void *buf0 = NULL, *buf1 = NULL, *buf;                            /* Pinned chunks */
+    size_t      buf_size;                                                   /* Size of pinned chunk */
+    hsize_t     chunk_nbytes;                                               /* Size of raw chunk */
+    uint32_t    filters;                                                    /* Filter mask of raw chunk */
+    int         wbuf[CHUNK_PIN_DIM0][CHUNK_PIN_DIM1];                       /* Data written */
+    int         rbuf[CHUNK_PIN_DIM0][CHUNK_PIN_DIM1];                       /* Data read */
+    int         cbuf[CHUNK_PIN_CHUNK_DIM * CHUNK_PIN_CHUNK_DIM];            /* Chunk written */
+    int         i, j;                                                       /* Local index variables */
+    herr_t      ret;                                                        /* Generic return value */
+
+    TESTING("pinning chunks in the chunk cache");
+
+    h5_fixname(FILENAME[32], fapl, filename, sizeof filename);
+
+    for (i = 0; i < CHUNK_PIN_DIM0; i++)
+        for (j = 0; j < CHUNK_PIN_DIM1; j++)
+            wbuf[i][j] = (i * CHUNK_PIN_DIM1) + j;
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 15 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
-
-    /* Close dataset & dataspace */
-    if (H5Sclose(sid) < 0)
+    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
         FAIL_STACK_ERROR
-    if (H5Dclose(dsid) < 0)
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
         FAIL_STACK_ERROR
-
-    /* Copy the dataset */
-    if (H5Ocopy(fid, "dset3a", fid, "dset3a_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
         FAIL_STACK_ERROR
-
-    /* Open the copied dataset */
-    if ((dsid = H5Dopen2(fid, "dset3a_copy", H5P_DEFAULT)) < 0)
+    if (H5Pset_shuffle(dcpl) < 0)
         FAIL_STACK_ERROR
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    /* Use a cache with room for only four chunks */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 15 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
-
-    /* Close copied dataset */
-    if (H5Dclose(dsid) < 0)
+    if (H5Pset_chunk_cache(dapl, (size_t)521, CHUNK_PIN_NBYTES, 1.0) < 0)
         FAIL_STACK_ERROR
 
-    /* Create 2D dataspace with max dims > current dims (and 2 unlimited dims) */
-    dims[0]     = STORAGE_SIZE_DIM1;
-    dims[1]     = STORAGE_SIZE_DIM2;
-    max_dims[0] = H5S_UNLIMITED;
-    max_dims[1] = H5S_UNLIMITED;
-    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
         FAIL_STACK_ERROR
-
-    /* Create chunked dataset */
-    if ((dsid = H5Dcreate2(fid, "dset4", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
         FAIL_STACK_ERROR
-
-    /* Initialize buffer to zeroes */
-    HDmemset(wdata, 0, sizeof(wdata));
-
-    /* write elements to dataset */
-    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
+    if (H5Dclose(did) < 0)
         FAIL_STACK_ERROR
-
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    if ((did = H5Dopen2(fid, "dset", dapl)) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
 
-    /* Extend dataset's dimensions */
-    new_dims[0] = STORAGE_SIZE_DIM1 * 2;
-    new_dims[1] = STORAGE_SIZE_DIM2 * 2;
-    if (H5Dset_extent(dsid, new_dims) < 0)
+    /* Pin two chunks, which are read from the file and unfiltered */
+    if (H5Dpin_chunk(did, H5P_DEFAULT, H5T_NATIVE_INT, offset0, &buf0, &buf_size) < 0)
+        FAIL_STACK_ERROR
+    if (buf_size != CHUNK_PIN_CHUNK_DIM * CHUNK_PIN_CHUNK_DIM * sizeof(int))
+        FAIL_PUTS_ERROR("wrong size of pinned chunk")
+    if (H5Dpin_chunk(did, H5P_DEFAULT, H5T_NATIVE_INT, offset1, &buf1, &buf_size) < 0)
         FAIL_STACK_ERROR
 
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    /* Read the whole dataset, cycling all the other chunks through the cache */
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
+    if (HDmemcmp(wbuf, rbuf, sizeof(rbuf)) != 0)
+        FAIL_PUTS_ERROR("wrong data read")
 
-    /* Close dataset & dataspace */
-    if (H5Sclose(sid) < 0)
+    /* The pinned chunks were kept in the cache */
+    for (i = 0; i < CHUNK_PIN_CHUNK_DIM; i++)
+        for (j = 0; j < CHUNK_PIN_CHUNK_DIM; j++)
+            if (((const int *)buf0)[(i * CHUNK_PIN_CHUNK_DIM) + j] != wbuf[i][j] ||
+                ((const int *)buf1)[(i * CHUNK_PIN_CHUNK_DIM) + j] !=
+                    wbuf[i + CHUNK_PIN_CHUNK_DIM][j + CHUNK_PIN_CHUNK_DIM])
+                FAIL_PUTS_ERROR("wrong data in pinned chunk")
+    if (H5Dpin_chunk(did, H5P_DEFAULT, H5T_NATIVE_INT, offset0, &buf, &buf_size) < 0)
         FAIL_STACK_ERROR
-    if (H5Dclose(dsid) < 0)
+    if (buf != buf0)
+        FAIL_PUTS_ERROR("pinned chunk moved")
+    if (H5Dunpin_chunk(did, offset0) < 0)
         FAIL_STACK_ERROR
 
-    /* Copy the dataset */
-    if (H5Ocopy(fid, "dset4", fid, "dset4_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
+    /* Writes to a pinned chunk are seen in place */
+    wbuf[0][0] = -1;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
         FAIL_STACK_ERROR
+    if (((const int *)buf0)[0] != -1)
+        FAIL_PUTS_ERROR("write not seen in pinned chunk")
 
-    /* Open the copied dataset */
-    if ((dsid = H5Dopen2(fid, "dset4_copy", H5P_DEFAULT)) < 0)
+    /* Reading the raw chunk flushes it, but leaves it pinned */
+    if (H5Dread_chunk(did, H5P_DEFAULT, offset0, &filters, cbuf) < 0)
         FAIL_STACK_ERROR
-
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    if (H5Dget_chunk_storage_size(did, offset0, &chunk_nbytes) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
-
-    /* Close copied dataset */
-    if (H5Dclose(dsid) < 0)
+    if (chunk_nbytes != sizeof(cbuf))
+        FAIL_PUTS_ERROR("wrong size of raw chunk")
+    if (H5Dpin_chunk(did, H5P_DEFAULT, H5T_NATIVE_INT, offset0, &buf, &buf_size) < 0)
         FAIL_STACK_ERROR
-
-    /* Create 2D dataspace with max dims > current dims (and 2 unlimited dims) */
-    dims[0]     = STORAGE_SIZE_DIM1;
-    dims[1]     = STORAGE_SIZE_DIM2;
-    max_dims[0] = H5S_UNLIMITED;
-    max_dims[1] = H5S_UNLIMITED;
-    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
+    if (buf != buf0)
+        FAIL_PUTS_ERROR("pinned chunk moved")
+    if (H5Dunpin_chunk(did, offset0) < 0)
         FAIL_STACK_ERROR
 
-    /* Create chunked dataset, w/early allocation */
-    if ((dsid = H5Dcreate2(fid, "dset4a", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl2, H5P_DEFAULT)) < 0)
-        FAIL_STACK_ERROR
+    /* Chunks that need converting, offsets that aren't on a chunk's boundary
+     * and chunks outside the dataset can't be pinned */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dpin_chunk(did, H5P_DEFAULT, H5T_NATIVE_SHORT, offset0, &buf, &buf_size);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("pinned chunk that needs datatype conversion")
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dpin_chunk(did, H5P_DEFAULT, H5T_NATIVE_INT, unaligned, &buf, &buf_size);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("pinned chunk at unaligned offset")
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dunpin_chunk(did, edge);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("unpinned chunk that wasn't pinned")
 
-    /* Initialize buffer to zeroes */
-    HDmemset(wdata, 0, sizeof(wdata));
+    /* A pinned chunk can't be overwritten and the dataset can't be resized */
+    HDmemset(cbuf, 0, sizeof(cbuf));
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dwrite_chunk(did, H5P_DEFAULT, 0, offset1, sizeof(cbuf), cbuf);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("overwrote pinned chunk")
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dset_extent(did, new_dims);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("changed extent of dataset with pinned chunks")
 
-    /* write elements to dataset */
-    if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0)
+    /* Partial edge chunks are returned whole */
+    if (H5Dpin_chunk(did, H5P_DEFAULT, H5T_NATIVE_INT, edge, &buf, &buf_size) < 0)
         FAIL_STACK_ERROR
-
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    if (buf_size != CHUNK_PIN_CHUNK_DIM * CHUNK_PIN_CHUNK_DIM * sizeof(int))
+        FAIL_PUTS_ERROR("wrong size of pinned edge chunk")
+    for (i = 0; i < CHUNK_PIN_DIM0 - 24; i++)
+        for (j = 0; j < CHUNK_PIN_CHUNK_DIM; j++)
+            if (((const int *)buf)[(i * CHUNK_PIN_CHUNK_DIM) + j] != wbuf[i + 24][j])
+                FAIL_PUTS_ERROR("wrong data in pinned edge chunk")
+    if (H5Dunpin_chunk(did, edge) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 6 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
 
-    /* Extend dataset's dimensions */
-    new_dims[0] = STORAGE_SIZE_DIM1 * 2;
-    new_dims[1] = STORAGE_SIZE_DIM2 * 2;
-    if (H5Dset_extent(dsid, new_dims) < 0)
+    /* Once unpinned, the dataset can be resized again */
+    if (H5Dunpin_chunk(did, offset0) < 0)
         FAIL_STACK_ERROR
-
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    if (H5Dunpin_chunk(did, offset1) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dset_extent(did, new_dims) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 15 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
 
-    /* Close dataset & dataspace */
-    if (H5Sclose(sid) < 0)
+    /* Closing the dataset releases any pins left */
+    if (H5Dpin_chunk(did, H5P_DEFAULT, H5T_NATIVE_INT, offset1, &buf, &buf_size) < 0)
         FAIL_STACK_ERROR
-    if (H5Dclose(dsid) < 0)
+    if (H5Dclose(did) < 0)
         FAIL_STACK_ERROR
 
-    /* Copy the dataset */
-    if (H5Ocopy(fid, "dset4a", fid, "dset4a_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
+    /* Check the data in the file */
+    if ((did = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
-
-    /* Open the copied dataset */
-    if ((dsid = H5Dopen2(fid, "dset4a_copy", H5P_DEFAULT)) < 0)
+    if ((fsid = H5Dget_space(did)) < 0)
         FAIL_STACK_ERROR
-
-    /* Get the storage size */
-    if (0 == (ssize = H5Dget_storage_size(dsid)))
+    if (H5Sselect_hyperslab(fsid, H5S_SELECT_SET, offset0, NULL, dims, NULL) < 0)
         FAIL_STACK_ERROR
-    if ((sizeof(int) * 15 * STORAGE_SIZE_CHUNK_DIM1 * STORAGE_SIZE_CHUNK_DIM2) != ssize)
-        TEST_ERROR
-
-    /* Close copied dataset */
-    if (H5Dclose(dsid) < 0)
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(did, H5T_NATIVE_INT, sid, fsid, H5P_DEFAULT, rbuf) < 0)
         FAIL_STACK_ERROR
+    if (HDmemcmp(wbuf, rbuf, sizeof(rbuf)) != 0)
+        FAIL_PUTS_ERROR("wrong data read from file")
 
-    /* Close rest */
+    if (H5Sclose(fsid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
     if (H5Pclose(dcpl) < 0)
         FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
     if (H5Fclose(fid) < 0)
         FAIL_STACK_ERROR
 
@@ -13002,90 +15262,139 @@ test_storage_size(hid_t fapl)
 error:
     H5E_BEGIN_TRY
     {
+        H5Dclose(did);
+        H5Pclose(dapl);
         H5Pclose(dcpl);
-        H5Pclose(dcpl2);
-        H5Dclose(dsid);
+        H5Sclose(fsid);
         H5Sclose(sid);
         H5Fclose(fid);
     }
     H5E_END_TRY;
     return FAIL;
-} /* end test_storage_size() */
+} /* end test_chunk_pin() */
 
 /*-------------------------------------------------------------------------
- * Function:    test_power2up
+ * Function:    test_filter_block_size
  *
- * Purpose:     Tests that the H5VM_power2up(n) function does not result in an
- *              infinite loop when input n exceeds 2^63. (HDFFV-10217)
- *              H5VM_power2up() is used to calculate the next power of 2 for
- *              a dataset's scaled dimension sizes.
+ * Purpose:     Tests the filter block size (H5Pset_filter_block_size),
+ *              and that chunks the deflate filter compressed in blocks with
+ *              the filter threads are read back correctly without them,
+ *              both for a chunk too large for the chunk cache and for one
+ *              that's flushed from the cache when the dataset is closed.
  *
  * Return:      Success: 0
  *              Failure: -1
  *
- * Programmer:  Vailin Choi; June 2017
- *
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_power2up(hid_t fapl)
+test_filter_block_size(hid_t fapl)
 {
-    char    filename[FILENAME_BUF_SIZE];
-    hid_t   fid  = -1;     /* File ID */
-    hid_t   dcpl = -1;     /* Dataset creation property list */
-    hid_t   sid  = -1;     /* Dataspace ID */
-    hid_t   did  = -1;     /* Dataset ID */
-    hsize_t dims[2];       /* Dataset dimension sizes */
-    hsize_t max_dims[2];   /* Maximum dimension sizes */
-    hsize_t chunk_dims[2]; /* Chunk dimensions */
-    hsize_t ext_dims[2];   /* Extended dimension sizes */
-    herr_t  status;        /* Error status */
+    char        filename[FILENAME_BUF_SIZE];
+    const char *dset_names[2] = {FILTER_BLOCK_DSET1, FILTER_BLOCK_DSET2};
+    hid_t       fid           = -1;                /* File ID */
+    hid_t       dcpl          = -1;                /* Dataset creation property list */
+    hid_t       dapl          = -1;                /* Dataset access property list */
+    hid_t       dxpl          = -1;                /* Dataset transfer property list */
+    hid_t       sid           = -1;                /* Dataspace ID */
+    hid_t       did           = -1;                /* Dataset ID */
+    hsize_t     dim           = FILTER_BLOCK_DIM;  /* Dataset & chunk dimension */
+    size_t      block_size;                        /* Filter block size */
+    int *       wbuf = NULL, *rbuf = NULL;         /* Data buffers */
+    int         i, d;                              /* Local index variables */
+
+    TESTING("filter block size");
+
+    h5_fixname(FILENAME[33], fapl, filename, sizeof filename);
+
+    /* Check the property's default & setting */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_filter_block_size(dxpl, &block_size) < 0)
+        FAIL_STACK_ERROR
+    if (block_size != 0)
+        FAIL_PUTS_ERROR("wrong default filter block size")
+    if (H5Pset_filter_block_size(dxpl, (size_t)FILTER_BLOCK_BLOCK_SIZE) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_filter_block_size(dxpl, &block_size) < 0)
+        FAIL_STACK_ERROR
+    if (block_size != FILTER_BLOCK_BLOCK_SIZE)
+        FAIL_PUTS_ERROR("wrong filter block size")
+    if (H5Pset_filter_nthreads(dxpl, FILTER_BLOCK_NTHREADS) < 0)
+        FAIL_STACK_ERROR
 
-    TESTING("the next power of 2");
+    /* The rest needs the deflate filter */
+    if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) != TRUE) {
+        if (H5Pclose(dxpl) < 0)
+            FAIL_STACK_ERROR
+        SKIPPED();
+        HDputs("    Deflate filter not enabled");
+        return SUCCEED;
+    } /* end if */
 
-    h5_fixname(FILENAME[24], fapl, filename, sizeof filename);
+    if (NULL == (wbuf = (int *)HDmalloc(sizeof(int) * FILTER_BLOCK_DIM)))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(sizeof(int) * FILTER_BLOCK_DIM)))
+        TEST_ERROR
+    for (i = 0; i < FILTER_BLOCK_DIM; i++)
+        wbuf[i] = ((i / 16) % 1000) + (i % 3);
 
-    /* Create file */
     if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
         FAIL_STACK_ERROR
-
-    /* Set dims[1] to ((2^63) -1) */
-    dims[0]     = 0;
-    dims[1]     = ((hsize_t)1 << ((sizeof(hsize_t) * CHAR_BIT) - 1)) - 1;
-    max_dims[0] = max_dims[1] = H5S_UNLIMITED;
-    sid                       = H5Screate_simple(2, dims, max_dims);
-
-    /* Create dataset creation property list */
+    if ((sid = H5Screate_simple(1, &dim, NULL)) < 0)
+        FAIL_STACK_ERROR
     if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-        TEST_ERROR
-
-    /* Set chunk size */
-    chunk_dims[0] = chunk_dims[1] = 1;
-    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
-        TEST_ERROR
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 1, &dim) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_deflate(dcpl, 6) < 0)
+        FAIL_STACK_ERROR
 
-    /* Create chunked dataset */
-    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT64, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
-        TEST_ERROR
+    /* The first dataset's chunk is larger than the default chunk cache, the
+     * second dataset's cache holds it */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk_cache(dapl, (size_t)521, 2 * sizeof(int) * FILTER_BLOCK_DIM,
+                           H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
 
-    ext_dims[0] = 1;
-    ext_dims[1] = dims[1] + 5;
+    for (d = 0; d < 2; d++) {
+        if ((did = H5Dcreate2(fid, dset_names[d], H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl,
+                              d == 0 ? H5P_DEFAULT : dapl)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, wbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
 
-    /* Extend to (2^63)+ */
-    H5E_BEGIN_TRY { status = H5Dset_extent(did, ext_dims); }
-    H5E_END_TRY;
-    if (status >= 0)
-        TEST_ERROR
+        /* Read the data back without threads */
+        if ((did = H5Dopen2(fid, dset_names[d], H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dget_storage_size(did) >= sizeof(int) * FILTER_BLOCK_DIM)
+            FAIL_PUTS_ERROR("chunk wasn't compressed")
+        HDmemset(rbuf, 0, sizeof(int) * FILTER_BLOCK_DIM);
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf, rbuf, sizeof(int) * FILTER_BLOCK_DIM) != 0)
+            FAIL_PUTS_ERROR("wrong data read")
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
 
-    /* Closing */
-    if (H5Dclose(did) < 0)
-        TEST_ERROR
-    if (H5Sclose(sid) < 0)
-        TEST_ERROR
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
     if (H5Pclose(dcpl) < 0)
-        TEST_ERROR
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
     if (H5Fclose(fid) < 0)
-        TEST_ERROR
+        FAIL_STACK_ERROR
+
+    if (H5Pclose(dxpl) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
 
     PASSED();
 
@@ -13094,15 +15403,20 @@ test_power2up(hid_t fapl)
 error:
     H5E_BEGIN_TRY
     {
+        H5Pclose(dapl);
         H5Pclose(dcpl);
+        H5Pclose(dxpl);
         H5Dclose(did);
         H5Sclose(sid);
-        H5Pclose(dcpl);
         H5Fclose(fid);
     }
     H5E_END_TRY;
+    if (wbuf)
+        HDfree(wbuf);
+    if (rbuf)
+        HDfree(rbuf);
     return FAIL;
-} /* end test_power2up() */
+} /* end test_filter_block_size() */
 
 /*-------------------------------------------------------------------------
  * Function:    test_scatter
@@ -15209,8 +17523,13 @@ main(void)
                 nerrors += (test_compact_open_close_dirty(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_conv_buffer(file) < 0 ? 1 : 0);
                 nerrors += (test_tconv(file) < 0 ? 1 : 0);
+                nerrors += (test_tconv_in_place(file) < 0 ? 1 : 0);
                 nerrors += (test_filters(file, my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_onebyte_shuffle(file) < 0 ? 1 : 0);
+                nerrors += (test_shuffle_sizes(file) < 0 ? 1 : 0);
+                nerrors += (test_bitshuffle(file) < 0 ? 1 : 0);
+                nerrors += (test_zstd_format(file) < 0 ? 1 : 0);
+                nerrors += (test_lz4_format(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_int(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_float(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_double(file) < 0 ? 1 : 0);
@@ -15263,6 +17582,13 @@ main(void)
                 nerrors += (test_zero_dim_dset(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_storage_size(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_power2up(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_filter_nthreads(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_prefetch(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_cache_slots(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_cache_shared(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_multi_dset_io(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_pin(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_filter_block_size(my_fapl) < 0 ? 1 : 0);
 
                 nerrors += (test_swmr_non_latest(envval, my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_earray_hdr_fd(envval, my_fapl) < 0 ? 1 : 0);
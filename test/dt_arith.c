@@ -883,6 +883,118 @@ error:
     return MAX((int)fails_this_test, 1);
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    unhandled_except
+ *
+ * Purpose:     Gets called from test_hard_packed() for data type conversion
+ *              exceptions, and leaves them to the library.
+ *
+ * Return:      H5T_CONV_UNHANDLED
+ *-------------------------------------------------------------------------
+ */
+static H5T_conv_ret_t
+unhandled_except(H5T_conv_except_t H5_ATTR_UNUSED except_type, hid_t H5_ATTR_UNUSED src_id,
+                 hid_t H5_ATTR_UNUSED dst_id, void H5_ATTR_UNUSED *src_buf, void H5_ATTR_UNUSED *dst_buf,
+                 void H5_ATTR_UNUSED *user_data)
+{
+    return H5T_CONV_UNHANDLED;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    test_hard_packed
+ *
+ * Purpose:     Tests hard conversions of packed buffers between the native
+ *              types that the library may convert with vector instructions.
+ *              Each buffer of random bits is converted twice: as is, and
+ *              with an exception callback that leaves every exception to
+ *              the library, which makes it convert the elements one at a
+ *              time.  The results must be the same.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *-------------------------------------------------------------------------
+ */
+static int
+test_hard_packed(void)
+{
+    hid_t          dxpl_id = H5I_INVALID_HID;
+    unsigned char *buf1 = NULL, *buf2 = NULL;
+    size_t         nelmts = 1021; /* Not a multiple of any vector length */
+    size_t         src_size, dst_size;
+    size_t         i, j;
+
+    /* Pairs of source and destination types */
+    hid_t pairs[][2] = {
+        {H5T_NATIVE_SCHAR, H5T_NATIVE_SHORT},   {H5T_NATIVE_SHORT, H5T_NATIVE_SCHAR},
+        {H5T_NATIVE_UCHAR, H5T_NATIVE_USHORT},  {H5T_NATIVE_UCHAR, H5T_NATIVE_SHORT},
+        {H5T_NATIVE_USHORT, H5T_NATIVE_UCHAR},  {H5T_NATIVE_USHORT, H5T_NATIVE_SCHAR},
+        {H5T_NATIVE_SHORT, H5T_NATIVE_UCHAR},   {H5T_NATIVE_SCHAR, H5T_NATIVE_UCHAR},
+        {H5T_NATIVE_UCHAR, H5T_NATIVE_SCHAR},   {H5T_NATIVE_SHORT, H5T_NATIVE_INT},
+        {H5T_NATIVE_INT, H5T_NATIVE_SHORT},     {H5T_NATIVE_USHORT, H5T_NATIVE_UINT},
+        {H5T_NATIVE_USHORT, H5T_NATIVE_INT},    {H5T_NATIVE_UINT, H5T_NATIVE_USHORT},
+        {H5T_NATIVE_UINT, H5T_NATIVE_SHORT},    {H5T_NATIVE_INT, H5T_NATIVE_USHORT},
+        {H5T_NATIVE_SHORT, H5T_NATIVE_USHORT},  {H5T_NATIVE_USHORT, H5T_NATIVE_SHORT},
+        {H5T_NATIVE_INT, H5T_NATIVE_UINT},      {H5T_NATIVE_UINT, H5T_NATIVE_INT},
+        {H5T_NATIVE_INT, H5T_NATIVE_LLONG},     {H5T_NATIVE_UINT, H5T_NATIVE_ULLONG},
+        {H5T_NATIVE_UINT, H5T_NATIVE_LLONG},    {H5T_NATIVE_LLONG, H5T_NATIVE_ULLONG},
+        {H5T_NATIVE_ULLONG, H5T_NATIVE_LLONG},  {H5T_NATIVE_SHORT, H5T_NATIVE_FLOAT},
+        {H5T_NATIVE_USHORT, H5T_NATIVE_FLOAT},  {H5T_NATIVE_INT, H5T_NATIVE_FLOAT},
+        {H5T_NATIVE_FLOAT, H5T_NATIVE_INT},     {H5T_NATIVE_INT, H5T_NATIVE_DOUBLE},
+        {H5T_NATIVE_DOUBLE, H5T_NATIVE_INT},    {H5T_NATIVE_FLOAT, H5T_NATIVE_DOUBLE},
+        {H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT}};
+
+    TESTING("hard conversions of packed native types");
+
+    if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pset_type_conv_cb(dxpl_id, unhandled_except, NULL) < 0)
+        TEST_ERROR
+
+    for (i = 0; i < NELMTS(pairs); i++) {
+        src_size = H5Tget_size(pairs[i][0]);
+        dst_size = H5Tget_size(pairs[i][1]);
+
+        if (NULL == (buf1 = (unsigned char *)HDcalloc(nelmts, MAX(src_size, dst_size))))
+            TEST_ERROR
+        if (NULL == (buf2 = (unsigned char *)HDcalloc(nelmts, MAX(src_size, dst_size))))
+            TEST_ERROR
+        for (j = 0; j < nelmts * src_size; j++)
+            buf1[j] = buf2[j] = (unsigned char)HDrandom();
+
+        if (H5Tconvert(pairs[i][0], pairs[i][1], nelmts, buf1, NULL, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        if (H5Tconvert(pairs[i][0], pairs[i][1], nelmts, buf2, NULL, dxpl_id) < 0)
+            TEST_ERROR
+
+        for (j = 0; j < nelmts; j++)
+            if (HDmemcmp(buf1 + j * dst_size, buf2 + j * dst_size, dst_size) != 0) {
+                H5_FAILED();
+                HDprintf("    pair %u, element %u differs from element-by-element conversion\n", (unsigned)i,
+                         (unsigned)j);
+                goto error;
+            }
+
+        HDfree(buf1);
+        HDfree(buf2);
+        buf1 = buf2 = NULL;
+    }
+
+    if (H5Pclose(dxpl_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY { H5Pclose(dxpl_id); }
+    H5E_END_TRY;
+    HDfree(buf1);
+    HDfree(buf2);
+
+    return 1;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    test_derived_flt
  *
@@ -5423,6 +5535,9 @@ main(void)
     /* Test a few special values for hardware float-integer conversions */
     nerrors += (unsigned long)test_particular_fp_integer();
 
+    /* Test hardware conversions of packed native types */
+    nerrors += (unsigned long)test_hard_packed();
+
     /*----------------------------------------------------------------------
      * Software tests
      *----------------------------------------------------------------------
@@ -17,11 +17,16 @@
 #define COLS      18
 #define FLOAT_TOL 0.0001F
 
+/* Enough elements for several of the blocks transforms are evaluated in,
+ * and a partial block */
+#define BLOCKS_NELMTS 1000
+
 static int init_test(hid_t file_id);
 static int test_copy(const hid_t dxpl_id_c_to_f_copy, const hid_t dxpl_id_polynomial_copy);
 static int test_trivial(const hid_t dxpl_id_simple);
 static int test_poly(const hid_t dxpl_id_polynomial);
 static int test_specials(hid_t file);
+static int test_blocks(hid_t file);
 static int test_set(void);
 static int test_getset(const hid_t dxpl_id_simple);
 
@@ -388,6 +393,8 @@ main(void)
         TEST_ERROR;
     if (test_specials(file_id) < 0)
         TEST_ERROR;
+    if (test_blocks(file_id) < 0)
+        TEST_ERROR;
 
     /* Close the objects we opened/created */
     if (H5Dclose(dset_id_int) < 0)
@@ -717,6 +724,117 @@ error:
     return -1;
 }
 
+static int
+test_blocks(hid_t file)
+{
+    hid_t       dxpl_id = -1, dset_id = -1, dataspace = -1;
+    hsize_t     dim[1] = {BLOCKS_NELMTS};
+    int *       data = NULL, *int_read = NULL, *int_res = NULL;
+    double *    dbl_read = NULL, *dbl_res = NULL;
+    int         i;
+    const char *f_to_c     = "(x-32)*5/9";
+    const char *polynomial = "x*x - (x+1)*(x-3)/2";
+
+    TESTING("data transform of many elements")
+
+    if (NULL == (data = (int *)HDmalloc(BLOCKS_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (int_read = (int *)HDmalloc(BLOCKS_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (int_res = (int *)HDmalloc(BLOCKS_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (dbl_read = (double *)HDmalloc(BLOCKS_NELMTS * sizeof(double))))
+        TEST_ERROR
+    if (NULL == (dbl_res = (double *)HDmalloc(BLOCKS_NELMTS * sizeof(double))))
+        TEST_ERROR
+    for (i = 0; i < BLOCKS_NELMTS; i++)
+        data[i] = i - (BLOCKS_NELMTS / 2);
+
+    if ((dataspace = H5Screate_simple(1, dim, NULL)) < 0)
+        TEST_ERROR
+    if ((dset_id = H5Dcreate2(file, "/blocks", H5T_NATIVE_INT, dataspace, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        TEST_ERROR
+    if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+
+    /* Each operation with a constant is done in double precision, and its
+     * result is stored in the type of the buffer before the next one */
+    if (H5Pset_data_transform(dxpl_id, f_to_c) < 0)
+        TEST_ERROR
+    for (i = 0; i < BLOCKS_NELMTS; i++) {
+        int_res[i] = (int)((double)(int)((double)(int)((double)data[i] - 32) * 5) / 9);
+        dbl_res[i] = (((double)data[i] - 32) * 5) / 9;
+    }
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl_id, int_read) < 0)
+        TEST_ERROR
+    if (H5Dread(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl_id, dbl_read) < 0)
+        TEST_ERROR
+    for (i = 0; i < BLOCKS_NELMTS; i++)
+        if (int_read[i] != int_res[i] || !H5_DBL_ABS_EQUAL(dbl_read[i], dbl_res[i])) {
+            H5_FAILED();
+            HDprintf("    %s of %d read as %d and %f, not %d and %f\n", f_to_c, data[i], int_read[i],
+                     dbl_read[i], int_res[i], dbl_res[i]);
+            goto error;
+        }
+
+    /* Operations between two values of "x" are done in the type of the buffer */
+    if (H5Pset_data_transform(dxpl_id, polynomial) < 0)
+        TEST_ERROR
+    for (i = 0; i < BLOCKS_NELMTS; i++) {
+        int sum  = (int)((double)data[i] + 1);
+        int diff = (int)((double)data[i] - 3);
+
+        int_res[i] = data[i] * data[i] - (int)((double)(sum * diff) / 2);
+        dbl_res[i] = (double)data[i] * (double)data[i] -
+                     (((double)data[i] + 1) * ((double)data[i] - 3)) / 2;
+    }
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl_id, int_read) < 0)
+        TEST_ERROR
+    if (H5Dread(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl_id, dbl_read) < 0)
+        TEST_ERROR
+    for (i = 0; i < BLOCKS_NELMTS; i++)
+        if (int_read[i] != int_res[i] || !H5_DBL_ABS_EQUAL(dbl_read[i], dbl_res[i])) {
+            H5_FAILED();
+            HDprintf("    %s of %d read as %d and %f, not %d and %f\n", polynomial, data[i], int_read[i],
+                     dbl_read[i], int_res[i], dbl_res[i]);
+            goto error;
+        }
+
+    if (H5Pclose(dxpl_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(dataspace) < 0)
+        TEST_ERROR
+    HDfree(data);
+    HDfree(int_read);
+    HDfree(int_res);
+    HDfree(dbl_read);
+    HDfree(dbl_res);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl_id);
+        H5Dclose(dset_id);
+        H5Sclose(dataspace);
+    }
+    H5E_END_TRY
+    HDfree(data);
+    HDfree(int_read);
+    HDfree(int_res);
+    HDfree(dbl_read);
+    HDfree(dbl_res);
+
+    return -1;
+}
+
 static int
 test_copy(const hid_t dxpl_id_c_to_f_copy, const hid_t dxpl_id_polynomial_copy)
 {
@@ -80,6 +80,9 @@ const char *FILENAME[] = {"dtypes0", "dtypes1", "dtypes2", "dtypes3", "dtypes4",
 
 #define TESTFILE "bad_compound.h5"
 
+/* Number of elements in test_conv_order(), not a multiple of any vector length */
+#define CONV_ORDER_NELMTS 1027
+
 typedef struct complex_t {
     double re;
     double im;
@@ -7017,6 +7020,130 @@ error:
     return 1;
 } /* end test_set_order_compound() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_order
+ *
+ * Purpose:     Tests byte order conversions of 2-, 4-, 8- and 16-byte
+ *              integers with H5Tconvert, and when reading a dataset into
+ *              every other element of a buffer.
+ *
+ * Return:      Success:    0
+ *              Failure:    number of errors
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_order(hid_t fapl)
+{
+    hid_t          file = H5I_INVALID_HID, space = H5I_INVALID_HID, mspace = H5I_INVALID_HID;
+    hid_t          dset = H5I_INVALID_HID, le = H5I_INVALID_HID, be = H5I_INVALID_HID;
+    hsize_t        dims[1]  = {CONV_ORDER_NELMTS};
+    hsize_t        mdims[1] = {2 * CONV_ORDER_NELMTS};
+    hsize_t        start[1] = {1}, stride[1] = {2}, count[1] = {CONV_ORDER_NELMTS};
+    unsigned char *orig = NULL, *buf = NULL, *rbuf = NULL;
+    char           filename[1024];
+    char           name[16];
+    size_t         size, u, v;
+
+    TESTING("byte order conversions");
+
+    h5_fixname(FILENAME[6], fapl, filename, sizeof filename);
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((space = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((mspace = H5Screate_simple(1, mdims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(mspace, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        FAIL_STACK_ERROR
+
+    for (size = 2; size <= 16; size *= 2) {
+        /* Create little- and big-endian integer types of this size */
+        if ((le = H5Tcopy(H5T_STD_U8LE)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Tset_size(le, size) < 0)
+            FAIL_STACK_ERROR
+        if (H5Tset_precision(le, 8 * size) < 0)
+            FAIL_STACK_ERROR
+        if ((be = H5Tcopy(le)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Tset_order(be, H5T_ORDER_BE) < 0)
+            FAIL_STACK_ERROR
+
+        if (NULL == (orig = (unsigned char *)HDmalloc(CONV_ORDER_NELMTS * size)))
+            TEST_ERROR
+        if (NULL == (buf = (unsigned char *)HDmalloc(CONV_ORDER_NELMTS * size)))
+            TEST_ERROR
+        if (NULL == (rbuf = (unsigned char *)HDcalloc(2 * CONV_ORDER_NELMTS, size)))
+            TEST_ERROR
+        for (u = 0; u < CONV_ORDER_NELMTS * size; u++)
+            orig[u] = buf[u] = (unsigned char)HDrandom();
+
+        /* Convert the elements to big-endian in place */
+        if (H5Tconvert(le, be, (size_t)CONV_ORDER_NELMTS, buf, NULL, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        for (u = 0; u < CONV_ORDER_NELMTS; u++)
+            for (v = 0; v < size; v++)
+                if (buf[(u * size) + v] != orig[(u * size) + size - (v + 1)]) {
+                    H5_FAILED();
+                    HDprintf("    %u-byte element %u converted incorrectly\n", (unsigned)size, (unsigned)u);
+                    goto error;
+                }
+
+        /* Write the big-endian elements to a dataset as they are, and read
+         * them back into every other element of a little-endian buffer */
+        HDsnprintf(name, sizeof(name), "order_%u", (unsigned)size);
+        if ((dset = H5Dcreate2(file, name, be, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dwrite(dset, be, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dread(dset, le, mspace, space, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        for (u = 0; u < CONV_ORDER_NELMTS; u++)
+            for (v = 0; v < size; v++)
+                if (rbuf[(2 * u * size) + v] != 0 ||
+                    rbuf[((2 * u + 1) * size) + v] != orig[(u * size) + v]) {
+                    H5_FAILED();
+                    HDprintf("    %u-byte element %u read incorrectly\n", (unsigned)size, (unsigned)u);
+                    goto error;
+                }
+
+        if (H5Dclose(dset) < 0)
+            FAIL_STACK_ERROR
+        if (H5Tclose(le) < 0)
+            FAIL_STACK_ERROR
+        if (H5Tclose(be) < 0)
+            FAIL_STACK_ERROR
+        HDfree(orig);
+        HDfree(buf);
+        HDfree(rbuf);
+        orig = buf = rbuf = NULL;
+    } /* end for */
+
+    if (H5Sclose(mspace) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(space) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    H5Dclose(dset);
+    H5Tclose(le);
+    H5Tclose(be);
+    H5Sclose(mspace);
+    H5Sclose(space);
+    H5Fclose(file);
+    H5E_END_TRY;
+    HDfree(orig);
+    HDfree(buf);
+    HDfree(rbuf);
+    return 1;
+} /* end test_conv_order() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_named_indirect_reopen
  *
@@ -8556,6 +8683,7 @@ main(void)
     nerrors += test_delete_obj_named(fapl);
     nerrors += test_delete_obj_named_fileid(fapl);
     nerrors += test_set_order_compound(fapl);
+    nerrors += test_conv_order(fapl);
     nerrors += test_str_create();
 #ifndef H5_NO_DEPRECATED_SYMBOLS
     nerrors += test_deprec(fapl);
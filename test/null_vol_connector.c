@@ -26,7 +26,7 @@
 
 /* The VOL class struct */
 static const H5VL_class_t null_vol_g = {
-    0,                        /* version          */
+    H5VL_VERSION,             /* version          */
     NULL_VOL_CONNECTOR_VALUE, /* value            */
     NULL_VOL_CONNECTOR_NAME,  /* name             */
     0,                        /* capability flags */
@@ -142,7 +142,12 @@ static const H5VL_class_t null_vol_g = {
         NULL, /* to_str           */
         NULL  /* from_str         */
     },
-    NULL /* optional         */
+    NULL, /* optional         */
+    {
+        /* dataset_multi_cls */
+        NULL, /* read             */
+        NULL  /* write            */
+    }
 };
 
 /* These two functions are necessary to load this plugin using
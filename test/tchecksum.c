@@ -32,6 +32,8 @@
 /**********/
 #define BUF_LEN 3093 /* No particular value */
 
+#define VEC_BUF_LEN 20000 /* Enough for several passes of the vector kernels */
+
 /*******************/
 /* Local variables */
 /*******************/
@@ -213,6 +215,137 @@ test_chksum_large(void)
     HDfree(large_buf);
 } /* test_chksum_large() */
 
+/****************************************************************
+**
+**  ref_fletcher32(): Fletcher32 checksum of a buffer, computed a
+**      word at a time as the library's checksum was before it was
+**      vectorized.
+**
+****************************************************************/
+static uint32_t
+ref_fletcher32(const uint8_t *data, size_t nbytes)
+{
+    size_t   len  = nbytes / 2;
+    uint32_t sum1 = 0, sum2 = 0;
+
+    while (len) {
+        size_t tlen = len > 360 ? 360 : len;
+
+        len -= tlen;
+        do {
+            sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+            data += 2;
+            sum2 += sum1;
+        } while (--tlen);
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+    if (nbytes % 2) {
+        sum1 += (uint32_t)(((uint16_t)*data) << 8);
+        sum2 += sum1;
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+
+    return (sum2 << 16) | sum1;
+} /* ref_fletcher32() */
+
+/****************************************************************
+**
+**  ref_crc32c(): CRC-32C checksum of a buffer, computed a bit at a
+**      time.
+**
+****************************************************************/
+static uint32_t
+ref_crc32c(const uint8_t *data, size_t nbytes)
+{
+    uint32_t crc = 0xffffffff;
+    size_t   u;
+    int      k;
+
+    for (u = 0; u < nbytes; u++) {
+        crc ^= data[u];
+        for (k = 0; k < 8; k++)
+            crc = (crc & 1) ? (0x82F63B78 ^ (crc >> 1)) : (crc >> 1);
+    }
+
+    return crc ^ 0xffffffff;
+} /* ref_crc32c() */
+
+/****************************************************************
+**
+**  test_chksum_vector(): Checksum buffers of many sizes and
+**      alignments, which are summed partly by the vector kernels
+**
+****************************************************************/
+static void
+test_chksum_vector(void)
+{
+    uint8_t *vec_buf;        /* Buffer for checksum calculations */
+    uint8_t *copy_buf;       /* Buffer for unaligned copies */
+    uint32_t chksum;         /* Checksum value */
+    uint32_t aligned_chksum; /* Checksum of the aligned data */
+    size_t   off, u, v;      /* Local index variables */
+
+    /* Buffer sizes, around the sizes of the kernels' vectors and passes */
+    static const size_t lens[] = {1, 2, 15, 16, 17, 31, 32, 33, 63, 64, 65, 720, 1023, 2048, 2049, 4095, 4096,
+                                  8191, 8192, 8193, 16383, 16384, 16385, VEC_BUF_LEN - 3};
+
+    /* Allocate the buffers */
+    vec_buf = (uint8_t *)HDmalloc((size_t)VEC_BUF_LEN);
+    CHECK_PTR(vec_buf, "HDmalloc");
+    copy_buf = (uint8_t *)HDmalloc((size_t)VEC_BUF_LEN);
+    CHECK_PTR(copy_buf, "HDmalloc");
+
+    /* Random data, then all bits set (the largest sums) */
+    for (v = 0; v < 2; v++) {
+        for (u = 0; u < VEC_BUF_LEN; u++)
+            vec_buf[u] = v == 0 ? (uint8_t)HDrandom() : (uint8_t)0xff;
+
+        for (off = 0; off < 3; off++)
+            for (u = 0; u < NELMTS(lens); u++) {
+                chksum = H5_checksum_fletcher32(vec_buf + off, lens[u]);
+                VERIFY(chksum, ref_fletcher32(vec_buf + off, lens[u]), "H5_checksum_fletcher32");
+
+                chksum = H5_checksum_crc32c(vec_buf + off, lens[u]);
+                VERIFY(chksum, ref_crc32c(vec_buf + off, lens[u]), "H5_checksum_crc32c");
+
+                /* The same data, at another alignment, hashes the same */
+                aligned_chksum = H5_checksum_lookup3(vec_buf, lens[u], (uint32_t)off);
+                HDmemcpy(copy_buf + off + 1, vec_buf, lens[u]);
+                chksum = H5_checksum_lookup3(copy_buf + off + 1, lens[u], (uint32_t)off);
+                VERIFY(chksum, aligned_chksum, "H5_checksum_lookup3");
+            } /* end for */
+    }         /* end for */
+
+    /* Release memory for buffers */
+    HDfree(vec_buf);
+    HDfree(copy_buf);
+} /* test_chksum_vector() */
+
+/****************************************************************
+**
+**  test_chksum_crc32c(): Checksum a known CRC-32C test vector
+**
+****************************************************************/
+static void
+test_chksum_crc32c(void)
+{
+    const char *check = "123456789"; /* Standard "check" input */
+    uint8_t     zeros[32];           /* Buffer of zeros */
+    uint32_t    chksum;              /* Checksum value */
+
+    chksum = H5_checksum_crc32c(check, HDstrlen(check));
+    VERIFY(chksum, 0xe3069283, "H5_checksum_crc32c");
+
+    /* From RFC 3720, Appendix B.4 */
+    HDmemset(zeros, 0, sizeof(zeros));
+    chksum = H5_checksum_crc32c(zeros, sizeof(zeros));
+    VERIFY(chksum, 0x8a9136aa, "H5_checksum_crc32c");
+} /* test_chksum_crc32c() */
+
 /****************************************************************
 **
 **  test_checksum(): Main checksum testing routine.
@@ -230,6 +363,8 @@ test_checksum(void)
     test_chksum_size_three(); /* Test buffer w/only 3 bytes */
     test_chksum_size_four();  /* Test buffer w/only 4 bytes */
     test_chksum_large();      /* Test buffer w/larger # of bytes */
+    test_chksum_vector();     /* Test buffers summed by the vector kernels */
+    test_chksum_crc32c();     /* Test known CRC-32C values */
 
 } /* test_checksum() */
 
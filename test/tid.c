@@ -446,6 +446,8 @@ test_get_type(void)
 {
     hid_t      dtype;    /* datatype id */
     H5I_type_t type_ret; /* return value */
+    htri_t     tri_ret;  /* htri_t return value */
+    ssize_t    nerrors;  /* number of errors on the error stack */
 
     /* Create a datatype id */
     dtype = H5Tcopy(H5T_NATIVE_INT);
@@ -471,6 +473,28 @@ test_get_type(void)
     if (type_ret != H5I_BADID)
         goto out;
 
+    /* Check that looking up IDs neither clears the error stack nor pushes
+     * errors on it, even for invalid IDs */
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(H5I_INVALID_HID);
+    }
+    H5E_END_TRY;
+    nerrors = H5Eget_num(H5E_DEFAULT);
+    CHECK(nerrors, FAIL, "H5Eget_num");
+    if (nerrors <= 0)
+        goto out;
+    type_ret = H5Iget_type(H5I_INVALID_HID);
+    VERIFY(type_ret, H5I_BADID, "H5Iget_type");
+    type_ret = H5Iget_type(dtype);
+    VERIFY(type_ret, H5I_DATATYPE, "H5Iget_type");
+    tri_ret = H5Iis_valid(H5I_INVALID_HID);
+    VERIFY(tri_ret, FALSE, "H5Iis_valid");
+    VERIFY(H5Eget_num(H5E_DEFAULT), nerrors, "H5Eget_num");
+    if (H5Eget_num(H5E_DEFAULT) != nerrors)
+        goto out;
+    H5Eclear2(H5E_DEFAULT);
+
     H5Tclose(dtype);
 
     return 0;
@@ -763,6 +787,136 @@ out:
     return -1;
 } /* end test_remove_clear_type() */
 
+/* Test many IDs in one type, as they're registered and removed */
+
+/* Macro definitions */
+#define TEST_MANY_NIDS  10000
+#define TEST_MANY_NITER 4
+
+/* Udata for the iteration callback */
+typedef struct {
+    hid_t  last_id; /* Last ID visited */
+    size_t nvisits; /* Number of IDs visited */
+} test_many_iter_t;
+
+/* Iteration callback: checks the IDs are visited in increasing order */
+static herr_t
+test_many_iter_cb(hid_t id, void *_udata)
+{
+    test_many_iter_t *udata = (test_many_iter_t *)_udata;
+
+    if (id <= udata->last_id)
+        return -1;
+    udata->last_id = id;
+    udata->nvisits++;
+
+    return 0;
+} /* end test_many_iter_cb() */
+
+/* Test function */
+static int
+test_many_ids(void)
+{
+    H5I_type_t       obj_type = H5I_BADID;
+    int *            objs     = NULL;
+    hid_t *          ids      = NULL;
+    test_many_iter_t udata;
+    hsize_t          nmembers;
+    void *           obj;
+    void *           expected;
+    size_t           i, j;
+    herr_t           ret; /* return value */
+
+    objs = (int *)HDmalloc(TEST_MANY_NIDS * sizeof(int));
+    CHECK_PTR(objs, "HDmalloc");
+    ids = (hid_t *)HDmalloc(TEST_MANY_NIDS * sizeof(hid_t));
+    CHECK_PTR(ids, "HDmalloc");
+    if (objs == NULL || ids == NULL)
+        goto out;
+
+    /* Register type */
+    obj_type = H5Iregister_type((size_t)8, 0, NULL);
+    CHECK(obj_type, H5I_BADID, "H5Iregister_type");
+    if (obj_type == H5I_BADID)
+        goto out;
+
+    for (i = 0; i < TEST_MANY_NITER; i++) {
+        /* Register the IDs */
+        for (j = 0; j < TEST_MANY_NIDS; j++) {
+            ids[j] = H5Iregister(obj_type, &objs[j]);
+            CHECK(ids[j], H5I_INVALID_HID, "H5Iregister");
+            if (ids[j] == H5I_INVALID_HID)
+                goto out;
+        } /* end for */
+
+        /* Remove every other ID */
+        for (j = 0; j < TEST_MANY_NIDS; j += 2) {
+            obj = H5Iremove_verify(ids[j], obj_type);
+            CHECK_PTR_EQ(obj, &objs[j], "H5Iremove_verify");
+            if (obj != &objs[j])
+                goto out;
+        } /* end for */
+
+        /* Check the IDs removed are gone and the others are still there */
+        for (j = 0; j < TEST_MANY_NIDS; j++) {
+            H5E_BEGIN_TRY
+            obj = H5Iobject_verify(ids[j], obj_type);
+            H5E_END_TRY
+            expected = (j % 2) ? (void *)&objs[j] : NULL;
+            CHECK_PTR_EQ(obj, expected, "H5Iobject_verify");
+            if (obj != expected)
+                goto out;
+        } /* end for */
+
+        /* Check all the IDs left are visited, in order */
+        udata.last_id = H5I_INVALID_HID;
+        udata.nvisits = 0;
+        ret           = H5Iiterate(obj_type, test_many_iter_cb, &udata);
+        CHECK(ret, FAIL, "H5Iiterate");
+        if (ret == FAIL)
+            goto out;
+        VERIFY(udata.nvisits, (size_t)(TEST_MANY_NIDS / 2), "H5Iiterate");
+        if (udata.nvisits != (size_t)(TEST_MANY_NIDS / 2))
+            goto out;
+
+        /* Remove the rest of the IDs */
+        for (j = 1; j < TEST_MANY_NIDS; j += 2) {
+            obj = H5Iremove_verify(ids[j], obj_type);
+            CHECK_PTR_EQ(obj, &objs[j], "H5Iremove_verify");
+            if (obj != &objs[j])
+                goto out;
+        } /* end for */
+
+        ret = H5Inmembers(obj_type, &nmembers);
+        CHECK(ret, FAIL, "H5Inmembers");
+        if (ret == FAIL)
+            goto out;
+        VERIFY(nmembers, (hsize_t)0, "H5Inmembers");
+        if (nmembers != (hsize_t)0)
+            goto out;
+    } /* end for */
+
+    /* Destroy type */
+    ret = H5Idestroy_type(obj_type);
+    CHECK(ret, FAIL, "H5Idestroy_type");
+    if (ret == FAIL)
+        goto out;
+
+    HDfree(objs);
+    HDfree(ids);
+
+    return 0;
+
+out:
+    /* Cleanup.  For simplicity, just destroy the type and ignore errors. */
+    H5E_BEGIN_TRY
+    H5Idestroy_type(obj_type);
+    H5E_END_TRY
+    HDfree(objs);
+    HDfree(ids);
+    return -1;
+} /* end test_many_ids() */
+
 void
 test_ids(void)
 {
@@ -781,4 +935,6 @@ test_ids(void)
         TestErrPrintf("ID type list test failed\n");
     if (test_remove_clear_type() < 0)
         TestErrPrintf("ID remove during H5Iclear_type test failed\n");
+    if (test_many_ids() < 0)
+        TestErrPrintf("Many IDs test failed\n");
 }
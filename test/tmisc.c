@@ -5663,16 +5663,17 @@ test_misc35(void)
     hsize_t coord[MISC35_NPOINTS][MISC35_SPACE_RANK] = /* Coordinates for point selection */
         {{0, 10, 5}, {1, 2, 7},  {2, 4, 9}, {0, 6, 11}, {1, 8, 13},
          {2, 12, 0}, {0, 14, 2}, {1, 0, 4}, {2, 1, 6},  {0, 3, 8}};
-    size_t           reg_size_start; /* Initial amount of regular memory allocated */
-    size_t           arr_size_start; /* Initial amount of array memory allocated */
-    size_t           blk_size_start; /* Initial amount of block memory allocated */
-    size_t           fac_size_start; /* Initial amount of factory memory allocated */
-    size_t           reg_size_final; /* Final amount of regular memory allocated */
-    size_t           arr_size_final; /* Final amount of array memory allocated */
-    size_t           blk_size_final; /* Final amount of block memory allocated */
-    size_t           fac_size_final; /* Final amount of factory memory allocated */
-    H5_alloc_stats_t alloc_stats;    /* Memory stats */
-    herr_t           ret;            /* Return value */
+    size_t               reg_size_start; /* Initial amount of regular memory allocated */
+    size_t               arr_size_start; /* Initial amount of array memory allocated */
+    size_t               blk_size_start; /* Initial amount of block memory allocated */
+    size_t               fac_size_start; /* Initial amount of factory memory allocated */
+    size_t               reg_size_final; /* Final amount of regular memory allocated */
+    size_t               arr_size_final; /* Final amount of array memory allocated */
+    size_t               blk_size_final; /* Final amount of block memory allocated */
+    size_t               fac_size_final; /* Final amount of factory memory allocated */
+    H5_alloc_stats_t     alloc_stats;    /* Memory stats */
+    H5_free_list_stats_t fl_stats;       /* Free list stats */
+    herr_t               ret;            /* Return value */
 
     /* Output message about test being performed */
     MESSAGE(5, ("Free-list API calls"));
@@ -5726,6 +5727,43 @@ test_misc35(void)
     if (fac_size_final > fac_size_start)
         ERROR("fac_size_final > fac_size_start");
 
+    /* Retrieve free list statistics */
+    ret = H5get_free_list_stats(&fl_stats);
+    CHECK(ret, FAIL, "H5get_free_list_stats");
+
+#if !defined H5_USING_MEMCHECKER
+    /* All the kinds of free lists should have been allocated from */
+    CHECK(fl_stats.reg_alloc_count, 0, "H5get_free_list_stats");
+    CHECK(fl_stats.arr_alloc_count, 0, "H5get_free_list_stats");
+    CHECK(fl_stats.blk_alloc_count, 0, "H5get_free_list_stats");
+    CHECK(fl_stats.fac_alloc_count, 0, "H5get_free_list_stats");
+#else  /* H5_USING_MEMCHECKER */
+    /* All the values should be == 0 */
+    VERIFY(fl_stats.reg_alloc_count, 0, "H5get_free_list_stats");
+    VERIFY(fl_stats.arr_alloc_count, 0, "H5get_free_list_stats");
+    VERIFY(fl_stats.blk_alloc_count, 0, "H5get_free_list_stats");
+    VERIFY(fl_stats.fac_alloc_count, 0, "H5get_free_list_stats");
+#endif /* H5_USING_MEMCHECKER */
+
+    /* Only some of the allocations can have reused freed blocks */
+    if (fl_stats.reg_reuse_count > fl_stats.reg_alloc_count)
+        ERROR("reg_reuse_count > reg_alloc_count");
+    if (fl_stats.arr_reuse_count > fl_stats.arr_alloc_count)
+        ERROR("arr_reuse_count > arr_alloc_count");
+    if (fl_stats.blk_reuse_count > fl_stats.blk_alloc_count)
+        ERROR("blk_reuse_count > blk_alloc_count");
+    if (fl_stats.fac_reuse_count > fl_stats.fac_alloc_count)
+        ERROR("fac_reuse_count > fac_alloc_count");
+    if (fl_stats.thread_cache_hit_count > fl_stats.reg_reuse_count)
+        ERROR("thread_cache_hit_count > reg_reuse_count");
+
+    /* The free lists were just garbage collected, so they shouldn't hold any memory */
+    VERIFY(fl_stats.reg_bytes_held, 0, "H5get_free_list_stats");
+    VERIFY(fl_stats.arr_bytes_held, 0, "H5get_free_list_stats");
+    VERIFY(fl_stats.blk_bytes_held, 0, "H5get_free_list_stats");
+    VERIFY(fl_stats.fac_bytes_held, 0, "H5get_free_list_stats");
+    VERIFY(fl_stats.thread_cache_bytes_held, 0, "H5get_free_list_stats");
+
     /* Retrieve memory allocation statistics */
     ret = H5get_alloc_stats(&alloc_stats);
     CHECK(ret, FAIL, "H5get_alloc_stats");
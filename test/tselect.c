@@ -182,6 +182,21 @@
 #define CHUNKSZ      20
 #define NUM_ELEMENTS NUMCHUNKS *CHUNKSZ
 
+/* Defines for test_hyper_io_repeat() */
+#define SPACE_REP_RANK   2
+#define SPACE_REP_DIM1   300
+#define SPACE_REP_DIM2   500
+#define SPACE_REP_NREADS 3
+
+/* Defines for test_hyper_blocklist() */
+#define SPACE_BLK_RANK          2
+#define SPACE_BLK_DIM1          60
+#define SPACE_BLK_DIM2          80
+#define SPACE_BLK_MAX_SIZE      8
+#define SPACE_BLK_NBLOCKS       200
+#define SPACE_BLK_NBLOCKS_LARGE 100000
+#define SPACE_BLK_LARGE_DIM     1000
+
 /* Location comparison function */
 static int compare_size_t(const void *s1, const void *s2);
 
@@ -15850,6 +15865,482 @@ test_hyper_io_1d(void)
 
 } /* test_hyper_io_1d() */
 
+/****************************************************************
+**
+**  test_hyper_io_repeat_check(): Reads a dataset several times
+**  with the same file & memory dataspaces, and checks that the
+**  data is the same as with fresh copies of the dataspaces.
+**
+****************************************************************/
+static void
+test_hyper_io_repeat_check(hid_t did, hid_t sid)
+{
+    hid_t      mid;       /* Memory dataspace ID */
+    hid_t      fsid_copy; /* Copy of file dataspace */
+    hid_t      mid_copy;  /* Copy of memory dataspace */
+    int *      rbuf;      /* Data read with the same dataspaces */
+    int *      ebuf;      /* Data read with copies of the dataspaces */
+    long long *lbuf;      /* Data read as a larger type */
+    hssize_t   npoints;   /* # of elements selected */
+    hssize_t   nread;     /* # of elements read */
+    unsigned   i, u;      /* Local index variables */
+    herr_t     ret;       /* Generic return value */
+
+    rbuf = (int *)HDmalloc(sizeof(int) * SPACE_REP_DIM1 * SPACE_REP_DIM2);
+    CHECK_PTR(rbuf, "HDmalloc");
+    ebuf = (int *)HDmalloc(sizeof(int) * SPACE_REP_DIM1 * SPACE_REP_DIM2);
+    CHECK_PTR(ebuf, "HDmalloc");
+    lbuf = (long long *)HDmalloc(sizeof(long long) * SPACE_REP_DIM1 * SPACE_REP_DIM2);
+    CHECK_PTR(lbuf, "HDmalloc");
+
+    npoints = H5Sget_select_npoints(sid);
+    CHECK(npoints, FAIL, "H5Sget_select_npoints");
+
+    /* Use the same selection in memory, in a dataspace of its own */
+    mid = H5Scopy(sid);
+    CHECK(mid, H5I_INVALID_HID, "H5Scopy");
+
+    for (i = 0; i < SPACE_REP_NREADS; i++) {
+        /* Read with the same dataspaces each time */
+        for (u = 0; u < SPACE_REP_DIM1 * SPACE_REP_DIM2; u++) {
+            rbuf[u] = -1;
+            lbuf[u] = -1;
+        }
+        ret = H5Dread(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rbuf);
+        CHECK(ret, FAIL, "H5Dread");
+        ret = H5Dread(did, H5T_NATIVE_LLONG, mid, sid, H5P_DEFAULT, lbuf);
+        CHECK(ret, FAIL, "H5Dread");
+
+        /* Read with copies of the dataspaces */
+        fsid_copy = H5Scopy(sid);
+        CHECK(fsid_copy, H5I_INVALID_HID, "H5Scopy");
+        mid_copy = H5Scopy(mid);
+        CHECK(mid_copy, H5I_INVALID_HID, "H5Scopy");
+        for (u = 0; u < SPACE_REP_DIM1 * SPACE_REP_DIM2; u++)
+            ebuf[u] = -1;
+        ret = H5Dread(did, H5T_NATIVE_INT, mid_copy, fsid_copy, H5P_DEFAULT, ebuf);
+        CHECK(ret, FAIL, "H5Dread");
+        ret = H5Sclose(mid_copy);
+        CHECK(ret, FAIL, "H5Sclose");
+        ret = H5Sclose(fsid_copy);
+        CHECK(ret, FAIL, "H5Sclose");
+
+        /* Compare the data */
+        for (u = 0, nread = 0; u < SPACE_REP_DIM1 * SPACE_REP_DIM2; u++) {
+            if (rbuf[u] != ebuf[u] || lbuf[u] != (long long)ebuf[u])
+                TestErrPrintf("%d: element %u read as %d and %lld, should be %d\n", __LINE__, u, rbuf[u],
+                              lbuf[u], ebuf[u]);
+            if (ebuf[u] != -1)
+                nread++;
+        } /* end for */
+        VERIFY(nread, npoints, "H5Dread");
+    } /* end for */
+
+    ret = H5Sclose(mid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    HDfree(rbuf);
+    HDfree(ebuf);
+    HDfree(lbuf);
+} /* test_hyper_io_repeat_check() */
+
+/****************************************************************
+**
+**  test_hyper_io_repeat(): Test reading with the same hyperslab
+**  selections repeatedly, which replays their sequence lists
+**  from a cache, while the selections are changed between reads.
+**
+****************************************************************/
+static void
+test_hyper_io_repeat(void)
+{
+    hid_t    fid;                                                     /* File ID */
+    hid_t    did;                                                     /* Dataset ID */
+    hid_t    sid;                                                     /* Dataspace ID */
+    hsize_t  dims[SPACE_REP_RANK] = {SPACE_REP_DIM1, SPACE_REP_DIM2}; /* Dataspace dimensions */
+    hsize_t  start[SPACE_REP_RANK];                                   /* Starting location of hyperslab */
+    hsize_t  stride[SPACE_REP_RANK];                                  /* Stride of hyperslab */
+    hsize_t  count[SPACE_REP_RANK];                                   /* Element count of hyperslab */
+    hsize_t  block[SPACE_REP_RANK];                                   /* Block size of hyperslab */
+    hssize_t offset[SPACE_REP_RANK];                                  /* Selection offset */
+    int *    wbuf;                                                    /* Data written */
+    unsigned u;                                                       /* Local index variable */
+    herr_t   ret;                                                     /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing Hyperslab I/O with Repeated Selections\n"));
+
+    /* Create a dataset */
+    wbuf = (int *)HDmalloc(sizeof(int) * SPACE_REP_DIM1 * SPACE_REP_DIM2);
+    CHECK_PTR(wbuf, "HDmalloc");
+    for (u = 0; u < SPACE_REP_DIM1 * SPACE_REP_DIM2; u++)
+        wbuf[u] = (int)u;
+
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, H5I_INVALID_HID, "H5Fcreate");
+    sid = H5Screate_simple(SPACE_REP_RANK, dims, NULL);
+    CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+    did = H5Dcreate2(fid, "Dataset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(did, H5I_INVALID_HID, "H5Dcreate2");
+    ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    /* Regular selection */
+    start[0]  = 1;
+    start[1]  = 2;
+    stride[0] = 3;
+    stride[1] = 4;
+    count[0]  = 5;
+    count[1]  = 6;
+    block[0]  = 2;
+    block[1]  = 3;
+    ret       = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    test_hyper_io_repeat_check(did, sid);
+
+    /* Same selection, moved by an offset */
+    offset[0] = 2;
+    offset[1] = 1;
+    ret       = H5Soffset_simple(sid, offset);
+    CHECK(ret, FAIL, "H5Soffset_simple");
+    test_hyper_io_repeat_check(did, sid);
+    offset[0] = 0;
+    offset[1] = 0;
+    ret       = H5Soffset_simple(sid, offset);
+    CHECK(ret, FAIL, "H5Soffset_simple");
+
+    /* Different regular selection */
+    count[0] = 4;
+    ret      = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    test_hyper_io_repeat_check(did, sid);
+
+    /* Irregular selection */
+    start[0] = 15;
+    start[1] = 0;
+    count[0] = 1;
+    count[1] = 1;
+    block[0] = 3;
+    block[1] = 7;
+    ret      = H5Sselect_hyperslab(sid, H5S_SELECT_OR, start, NULL, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    test_hyper_io_repeat_check(did, sid);
+
+    /* Irregular selection, changed in place */
+    offset[0] = -1;
+    offset[1] = -2;
+    ret       = H5Sselect_adjust(sid, offset);
+    CHECK(ret, FAIL, "H5Sselect_adjust");
+    test_hyper_io_repeat_check(did, sid);
+
+    /* Irregular selection, with another block */
+    start[0] = 0;
+    start[1] = 25;
+    block[0] = 20;
+    block[1] = 1;
+    ret      = H5Sselect_hyperslab(sid, H5S_SELECT_XOR, start, NULL, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    test_hyper_io_repeat_check(did, sid);
+
+    /* Selection with more sequences than are cached */
+    start[0]  = 0;
+    start[1]  = 0;
+    stride[0] = 1;
+    stride[1] = 2;
+    count[0]  = SPACE_REP_DIM1;
+    count[1]  = SPACE_REP_DIM2 / 2;
+    block[0]  = 1;
+    block[1]  = 1;
+    ret       = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    test_hyper_io_repeat_check(did, sid);
+
+    /* Close everything */
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    HDfree(wbuf);
+} /* test_hyper_io_repeat() */
+
+/****************************************************************
+**
+**  test_hyper_blocklist_check(): Checks that two dataspaces
+**  have the same hyperslab selection.
+**
+****************************************************************/
+static void
+test_hyper_blocklist_check(hid_t sid1, hid_t sid2)
+{
+    hssize_t npoints1, npoints2; /* Number of elements selected */
+    hssize_t nblocks1, nblocks2; /* Number of blocks selected */
+    hsize_t *blocks1, *blocks2;  /* Lists of blocks selected */
+    int      rank;               /* Rank of the dataspaces */
+    herr_t   ret;                /* Generic return value */
+
+    npoints1 = H5Sget_select_npoints(sid1);
+    CHECK(npoints1, FAIL, "H5Sget_select_npoints");
+    npoints2 = H5Sget_select_npoints(sid2);
+    VERIFY(npoints1, npoints2, "H5Sget_select_npoints");
+    if (npoints1 == 0 || npoints1 != npoints2)
+        return;
+
+    nblocks1 = H5Sget_select_hyper_nblocks(sid1);
+    CHECK(nblocks1, FAIL, "H5Sget_select_hyper_nblocks");
+    nblocks2 = H5Sget_select_hyper_nblocks(sid2);
+    VERIFY(nblocks1, nblocks2, "H5Sget_select_hyper_nblocks");
+    if (nblocks1 != nblocks2)
+        return;
+
+    rank = H5Sget_simple_extent_ndims(sid1);
+    CHECK(rank, FAIL, "H5Sget_simple_extent_ndims");
+    blocks1 = (hsize_t *)HDmalloc(sizeof(hsize_t) * 2 * (size_t)rank * (size_t)nblocks1);
+    CHECK_PTR(blocks1, "HDmalloc");
+    blocks2 = (hsize_t *)HDmalloc(sizeof(hsize_t) * 2 * (size_t)rank * (size_t)nblocks2);
+    CHECK_PTR(blocks2, "HDmalloc");
+    ret = H5Sget_select_hyper_blocklist(sid1, (hsize_t)0, (hsize_t)nblocks1, blocks1);
+    CHECK(ret, FAIL, "H5Sget_select_hyper_blocklist");
+    ret = H5Sget_select_hyper_blocklist(sid2, (hsize_t)0, (hsize_t)nblocks2, blocks2);
+    CHECK(ret, FAIL, "H5Sget_select_hyper_blocklist");
+    if (HDmemcmp(blocks1, blocks2, sizeof(hsize_t) * 2 * (size_t)rank * (size_t)nblocks1) != 0)
+        TestErrPrintf("%d: Block lists differ\n", __LINE__);
+
+    HDfree(blocks1);
+    HDfree(blocks2);
+} /* test_hyper_blocklist_check() */
+
+/****************************************************************
+**
+**  test_hyper_blocklist(): Test selecting a list of blocks with
+**  H5Sselect_hyper_blocklist(), comparing the selections with
+**  ones built a block at a time.
+**
+****************************************************************/
+static void
+test_hyper_blocklist(void)
+{
+    hid_t         sid1, sid2;                     /* Dataspace IDs */
+    hid_t         tmp_sid;                        /* Blocks selected one at a time */
+    hid_t         large_sid;                      /* Dataspace for large list of blocks */
+    hsize_t       dims[SPACE_BLK_RANK];           /* Dataspace dimensions */
+    hsize_t       large_dims[SPACE_BLK_RANK];     /* Dimensions of large dataspace */
+    hsize_t       start[SPACE_BLK_RANK];          /* Starting location of hyperslab */
+    hsize_t       stride[SPACE_BLK_RANK];         /* Stride of hyperslab */
+    hsize_t       count[SPACE_BLK_RANK];          /* Element count of hyperslab */
+    hsize_t       block[SPACE_BLK_RANK];          /* Block size of hyperslab */
+    hsize_t *     blocks;                         /* List of blocks */
+    hsize_t       bad_block[2 * SPACE_BLK_RANK];  /* Invalid block */
+    hsize_t       coord[SPACE_BLK_RANK];          /* Point to select */
+    uint8_t *     marks;                          /* Elements in the blocks */
+    hssize_t      npoints, tmp_npoints;           /* Number of elements selected */
+    hssize_t      nblocks;                        /* Number of blocks selected */
+    hsize_t       nmarked;                        /* Number of elements marked */
+    hsize_t       nseen;                          /* Number of elements in blocks seen */
+    H5S_seloper_t ops[] = {H5S_SELECT_OR, H5S_SELECT_AND, H5S_SELECT_XOR, H5S_SELECT_NOTB,
+                           H5S_SELECT_NOTA};      /* Operations to check */
+    H5S_sel_type  sel_type;                       /* Selection type */
+    htri_t        is_regular;                     /* Whether the selection is regular */
+    unsigned      seed = (unsigned)HDtime(NULL);  /* Random number seed */
+    size_t        u, v;                           /* Local index variables */
+    hsize_t       i, j;                           /* Local index variables */
+    herr_t        ret;                            /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing Selecting Lists of Hyperslab Blocks\n"));
+
+    dims[0]       = SPACE_BLK_DIM1;
+    dims[1]       = SPACE_BLK_DIM2;
+    large_dims[0] = SPACE_BLK_LARGE_DIM;
+    large_dims[1] = SPACE_BLK_LARGE_DIM;
+
+    /* Random blocks, some of which overlap */
+    blocks = (hsize_t *)HDmalloc(sizeof(hsize_t) * 2 * SPACE_BLK_RANK * SPACE_BLK_NBLOCKS_LARGE);
+    CHECK_PTR(blocks, "HDmalloc");
+    HDsrandom(seed);
+    for (u = 0; u < SPACE_BLK_NBLOCKS; u++)
+        for (v = 0; v < SPACE_BLK_RANK; v++) {
+            blocks[(u * 2 * SPACE_BLK_RANK) + v] = (hsize_t)HDrandom() % (dims[v] - SPACE_BLK_MAX_SIZE);
+            blocks[(u * 2 * SPACE_BLK_RANK) + SPACE_BLK_RANK + v] =
+                blocks[(u * 2 * SPACE_BLK_RANK) + v] + ((hsize_t)HDrandom() % SPACE_BLK_MAX_SIZE);
+        } /* end for */
+
+    sid1 = H5Screate_simple(SPACE_BLK_RANK, dims, NULL);
+    CHECK(sid1, H5I_INVALID_HID, "H5Screate_simple");
+    sid2 = H5Screate_simple(SPACE_BLK_RANK, dims, NULL);
+    CHECK(sid2, H5I_INVALID_HID, "H5Screate_simple");
+    tmp_sid = H5Screate_simple(SPACE_BLK_RANK, dims, NULL);
+    CHECK(tmp_sid, H5I_INVALID_HID, "H5Screate_simple");
+
+    /* Select the blocks one at a time */
+    for (u = 0; u < SPACE_BLK_NBLOCKS; u++) {
+        for (v = 0; v < SPACE_BLK_RANK; v++) {
+            start[v] = blocks[(u * 2 * SPACE_BLK_RANK) + v];
+            block[v] = blocks[(u * 2 * SPACE_BLK_RANK) + SPACE_BLK_RANK + v] - start[v] + 1;
+        } /* end for */
+        ret = H5Sselect_hyperslab(tmp_sid, (u == 0 ? H5S_SELECT_SET : H5S_SELECT_OR), start, NULL, block,
+                                  NULL);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    } /* end for */
+
+    /* Select the list of blocks */
+    ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_SET, (size_t)SPACE_BLK_NBLOCKS, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    sel_type = H5Sget_select_type(sid1);
+    VERIFY(sel_type, H5S_SEL_HYPERSLABS, "H5Sget_select_type");
+    test_hyper_blocklist_check(sid1, tmp_sid);
+
+    /* Combine the blocks with a regular selection, with each operation */
+    start[0]  = 1;
+    start[1]  = 3;
+    stride[0] = 7;
+    stride[1] = 5;
+    count[0]  = 8;
+    count[1]  = 15;
+    block[0]  = 4;
+    block[1]  = 2;
+    for (u = 0; u < sizeof(ops) / sizeof(ops[0]); u++) {
+        ret = H5Sselect_hyperslab(sid1, H5S_SELECT_SET, start, stride, count, block);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        ret = H5Sselect_hyper_blocklist(sid1, ops[u], (size_t)SPACE_BLK_NBLOCKS, blocks);
+        CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+
+        ret = H5Sselect_hyperslab(sid2, H5S_SELECT_SET, start, stride, count, block);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        ret = H5Smodify_select(sid2, ops[u], tmp_sid);
+        CHECK(ret, FAIL, "H5Smodify_select");
+
+        test_hyper_blocklist_check(sid1, sid2);
+    } /* end for */
+
+    /* Operations on "all" & "none" selections */
+    ret = H5Sselect_all(sid1);
+    CHECK(ret, FAIL, "H5Sselect_all");
+    ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_OR, (size_t)SPACE_BLK_NBLOCKS, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    sel_type = H5Sget_select_type(sid1);
+    VERIFY(sel_type, H5S_SEL_ALL, "H5Sget_select_type");
+    ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_NOTB, (size_t)SPACE_BLK_NBLOCKS, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    npoints = H5Sget_select_npoints(sid1);
+    CHECK(npoints, FAIL, "H5Sget_select_npoints");
+    tmp_npoints = H5Sget_select_npoints(tmp_sid);
+    CHECK(tmp_npoints, FAIL, "H5Sget_select_npoints");
+    VERIFY(npoints + tmp_npoints, (hssize_t)(SPACE_BLK_DIM1 * SPACE_BLK_DIM2), "H5Sget_select_npoints");
+    ret = H5Sselect_none(sid1);
+    CHECK(ret, FAIL, "H5Sselect_none");
+    ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_AND, (size_t)SPACE_BLK_NBLOCKS, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    sel_type = H5Sget_select_type(sid1);
+    VERIFY(sel_type, H5S_SEL_NONE, "H5Sget_select_type");
+    ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_XOR, (size_t)SPACE_BLK_NBLOCKS, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    test_hyper_blocklist_check(sid1, tmp_sid);
+
+    /* Blocks which make up a regular selection */
+    for (i = 0, u = 0; i < count[0]; i++)
+        for (j = 0; j < count[1]; j++, u++) {
+            /* (Listed in reverse, to check that the order doesn't matter) */
+            hsize_t *blk = blocks + ((((count[0] * count[1]) - 1) - u) * 2 * SPACE_BLK_RANK);
+
+            blk[0] = start[0] + (i * stride[0]);
+            blk[1] = start[1] + (j * stride[1]);
+            blk[2] = blk[0] + block[0] - 1;
+            blk[3] = blk[1] + block[1] - 1;
+        } /* end for */
+    ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_SET, (size_t)(count[0] * count[1]), blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    is_regular = H5Sis_regular_hyperslab(sid1);
+    VERIFY(is_regular, TRUE, "H5Sis_regular_hyperslab");
+    ret = H5Sselect_hyperslab(sid2, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    test_hyper_blocklist_check(sid1, sid2);
+
+    /* A large list of blocks, checked against the elements they cover */
+    large_sid = H5Screate_simple(SPACE_BLK_RANK, large_dims, NULL);
+    CHECK(large_sid, H5I_INVALID_HID, "H5Screate_simple");
+    marks = (uint8_t *)HDcalloc((size_t)(SPACE_BLK_LARGE_DIM * SPACE_BLK_LARGE_DIM), sizeof(uint8_t));
+    CHECK_PTR(marks, "HDcalloc");
+    nmarked = 0;
+    for (u = 0; u < SPACE_BLK_NBLOCKS_LARGE; u++) {
+        hsize_t *blk = blocks + (u * 2 * SPACE_BLK_RANK);
+
+        for (v = 0; v < SPACE_BLK_RANK; v++) {
+            blk[v]                  = (hsize_t)HDrandom() % (large_dims[v] - SPACE_BLK_MAX_SIZE);
+            blk[SPACE_BLK_RANK + v] = blk[v] + ((hsize_t)HDrandom() % SPACE_BLK_MAX_SIZE);
+        } /* end for */
+        for (i = blk[0]; i <= blk[2]; i++)
+            for (j = blk[1]; j <= blk[3]; j++)
+                if (!marks[(i * SPACE_BLK_LARGE_DIM) + j]) {
+                    marks[(i * SPACE_BLK_LARGE_DIM) + j] = 1;
+                    nmarked++;
+                } /* end if */
+    }             /* end for */
+    ret = H5Sselect_hyper_blocklist(large_sid, H5S_SELECT_SET, (size_t)SPACE_BLK_NBLOCKS_LARGE, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    npoints = H5Sget_select_npoints(large_sid);
+    VERIFY(npoints, (hssize_t)nmarked, "H5Sget_select_npoints");
+
+    /* Check that the selected blocks cover the marked elements */
+    nblocks = H5Sget_select_hyper_nblocks(large_sid);
+    CHECK(nblocks, FAIL, "H5Sget_select_hyper_nblocks");
+    if ((size_t)nblocks > SPACE_BLK_NBLOCKS_LARGE)
+        TestErrPrintf("%d: Too many blocks selected: %ld\n", __LINE__, (long)nblocks);
+    else {
+        ret = H5Sget_select_hyper_blocklist(large_sid, (hsize_t)0, (hsize_t)nblocks, blocks);
+        CHECK(ret, FAIL, "H5Sget_select_hyper_blocklist");
+        nseen = 0;
+        for (u = 0; u < (size_t)nblocks; u++) {
+            hsize_t *blk = blocks + (u * 2 * SPACE_BLK_RANK);
+
+            for (i = blk[0]; i <= blk[2]; i++)
+                for (j = blk[1]; j <= blk[3]; j++) {
+                    if (!marks[(i * SPACE_BLK_LARGE_DIM) + j])
+                        TestErrPrintf("%d: Element (%lu, %lu) selected, but not in a block\n", __LINE__,
+                                      (unsigned long)i, (unsigned long)j);
+                    nseen++;
+                } /* end for */
+        }         /* end for */
+        VERIFY(nseen, nmarked, "H5Sget_select_hyper_blocklist");
+    } /* end else */
+    HDfree(marks);
+
+    /* Invalid lists of blocks */
+    bad_block[0] = 4;
+    bad_block[1] = 6;
+    bad_block[2] = 5;
+    bad_block[3] = 5;
+    H5E_BEGIN_TRY { ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_SET, (size_t)1, bad_block); }
+    H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Sselect_hyper_blocklist");
+    H5E_BEGIN_TRY { ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_SET, (size_t)0, blocks); }
+    H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Sselect_hyper_blocklist");
+
+    /* Only "set" can be used on a point selection */
+    coord[0] = 3;
+    coord[1] = 3;
+    ret      = H5Sselect_elements(sid1, H5S_SELECT_SET, (size_t)1, coord);
+    CHECK(ret, FAIL, "H5Sselect_elements");
+    H5E_BEGIN_TRY { ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_OR, (size_t)1, blocks); }
+    H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Sselect_hyper_blocklist");
+
+    /* Close */
+    ret = H5Sclose(sid1);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid2);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(tmp_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(large_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    HDfree(blocks);
+} /* test_hyper_blocklist() */
+
 /****************************************************************
 **
 **  test_h5s_set_extent_none:
@@ -16114,6 +16605,10 @@ test_select(void)
     /* Test reading of 1-d disjoint file space to 1-d single block memory space */
     test_hyper_io_1d();
 
+    /* Test hyperslab I/O with the same selections repeatedly */
+    test_hyper_io_repeat();
+    test_hyper_blocklist();
+
     /* Test H5Sset_extent_none() functionality after we updated it to set
      * the class to H5S_NULL instead of H5S_NO_CLASS.
      */
@@ -113,6 +113,10 @@ main(int argc, char *argv[])
 #endif /* H5_HAVE_PTHREAD_H */
     AddTest("acreate", tts_acreate, cleanup_acreate, "multi-attribute creation", NULL);
     AddTest("attr_vlen", tts_attr_vlen, cleanup_attr_vlen, "multi-file-attribute-vlen read", NULL);
+    AddTest("rdconcur", tts_rdconcur, cleanup_rdconcur, "concurrent read-only dataset reads", NULL);
+    AddTest("rwlock", tts_rwlock, cleanup_rwlock, "reader/writer lock and shared API calls", NULL);
+    AddTest("idlookup", tts_idlookup, cleanup_idlookup, "ID lookups without the API lock", NULL);
+    AddTest("flcache", tts_flcache, cleanup_flcache, "per-thread free list caches", NULL);
 
 #else /* H5_HAVE_THREADSAFE */
 
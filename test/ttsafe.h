@@ -35,6 +35,10 @@ void tts_error(void);
 void tts_cancel(void);
 void tts_acreate(void);
 void tts_attr_vlen(void);
+void tts_rdconcur(void);
+void tts_rwlock(void);
+void tts_idlookup(void);
+void tts_flcache(void);
 
 /* Prototypes for the cleanup routines */
 void cleanup_dcreate(void);
@@ -42,6 +46,10 @@ void cleanup_error(void);
 void cleanup_cancel(void);
 void cleanup_acreate(void);
 void cleanup_attr_vlen(void);
+void cleanup_rdconcur(void);
+void cleanup_rwlock(void);
+void cleanup_idlookup(void);
+void cleanup_flcache(void);
 
 #endif /* H5_HAVE_THREADSAFE */
 #endif /* TTSAFE_H */
@@ -0,0 +1,112 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing the per-thread free list caches.
+ * ------------------------------------------------------------------
+ *
+ * Purpose: Verify that threads creating and closing dataspaces reuse
+ *          objects from their own free list caches, and that the
+ *          objects in a thread's cache are returned to the free lists
+ *          when the thread exits
+ *
+ ********************************************************************/
+
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define NUM_THREADS 8
+#define NUM_ROUNDS  100
+#define NUM_SPACES  8
+
+void *tts_flcache_thread(void *);
+
+/* Create and close dataspaces, leaving the objects for them in the thread's cache */
+void *
+tts_flcache_thread(void *client_data)
+{
+    size_t *             held = (size_t *)client_data; /* Memory held in the caches before exiting */
+    H5_free_list_stats_t stats;                        /* Free list statistics */
+    hsize_t              dims[2] = {16, 16};           /* Dataspace dimensions */
+    hid_t                sid[NUM_SPACES];              /* Dataspace IDs */
+    int                  round, i;                     /* Local index variables */
+    herr_t               ret;                          /* Generic return value */
+
+    for (round = 0; round < NUM_ROUNDS; round++) {
+        for (i = 0; i < NUM_SPACES; i++) {
+            sid[i] = H5Screate_simple(2, dims, NULL);
+            CHECK(sid[i], H5I_INVALID_HID, "H5Screate_simple");
+        }
+        for (i = 0; i < NUM_SPACES; i++) {
+            ret = H5Sclose(sid[i]);
+            CHECK(ret, FAIL, "H5Sclose");
+        }
+    }
+
+    ret = H5get_free_list_stats(&stats);
+    CHECK(ret, FAIL, "H5get_free_list_stats");
+    *held = stats.thread_cache_bytes_held;
+
+    return NULL;
+} /* end tts_flcache_thread() */
+
+void
+tts_flcache(void)
+{
+    H5TS_thread_t        threads[NUM_THREADS] = {0}; /* Thread declaration */
+    size_t               held[NUM_THREADS];          /* Memory held in the caches by each thread */
+    H5_free_list_stats_t before, after;              /* Free list statistics */
+    int                  i;                          /* Local index variable */
+    herr_t               ret;                        /* Generic return value */
+
+    /* Start with empty free lists and caches */
+    ret = H5garbage_collect();
+    CHECK(ret, FAIL, "H5garbage_collect");
+    ret = H5get_free_list_stats(&before);
+    CHECK(ret, FAIL, "H5get_free_list_stats");
+
+    for (i = 0; i < NUM_THREADS; i++)
+        threads[i] = H5TS_create_thread(tts_flcache_thread, NULL, &held[i]);
+    for (i = 0; i < NUM_THREADS; i++)
+        H5TS_wait_for_thread(threads[i]);
+
+    ret = H5get_free_list_stats(&after);
+    CHECK(ret, FAIL, "H5get_free_list_stats");
+
+    /* The threads reused their own objects, and kept some when they were done */
+    if (after.thread_cache_hit_count <= before.thread_cache_hit_count)
+        TestErrPrintf("%d: no reuses were served by the threads' caches\n", __LINE__);
+    for (i = 0; i < NUM_THREADS; i++)
+        if (held[i] == 0)
+            TestErrPrintf("%d: thread %d's cache was empty\n", __LINE__, i);
+
+    /* The threads' caches were returned to the free lists as the threads exited
+     * (this thread made no calls since the caches were garbage collected,
+     * apart from querying the statistics) */
+    VERIFY(after.thread_cache_bytes_held, before.thread_cache_bytes_held, "H5get_free_list_stats");
+    if (after.reg_bytes_held <= before.reg_bytes_held)
+        TestErrPrintf("%d: the threads' objects weren't returned to the free lists\n", __LINE__);
+
+    /* And can be garbage collected */
+    ret = H5garbage_collect();
+    CHECK(ret, FAIL, "H5garbage_collect");
+} /* end tts_flcache() */
+
+void
+cleanup_flcache(void)
+{
+}
+
+#endif /*H5_HAVE_THREADSAFE*/
@@ -0,0 +1,179 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing ID lookups without the API lock.
+ * ------------------------------------------------------------------
+ *
+ * Purpose: Verify that H5Iis_valid and H5Iget_type, called from many
+ *          threads, give the right answers for IDs that stay
+ *          registered and IDs that were removed, while another thread
+ *          registers and removes enough IDs to grow and shrink the
+ *          table they're stored in, and creates and destroys ID types
+ *
+ ********************************************************************/
+
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define NUM_READERS 6
+#define NUM_ROUNDS  20
+#define NUM_KEPT    16
+#define NUM_CHURN   2000
+
+void *tts_idlookup_reader(void *);
+
+static H5TS_mutex_simple_t done_mutex_g;     /* Protects done_g */
+static hbool_t             done_g;           /* Whether the readers should stop */
+static H5I_type_t          type_g;           /* Type of the IDs looked up */
+static hid_t               kept_g[NUM_KEPT]; /* IDs that stay registered */
+static hid_t               gone_g;           /* ID removed before the readers start */
+static int                 obj_g;            /* Object for all the IDs */
+
+static hbool_t
+idlookup_done(void)
+{
+    hbool_t ret; /* Whether the readers should stop */
+
+    H5TS_mutex_lock_simple(&done_mutex_g);
+    ret = done_g;
+    H5TS_mutex_unlock_simple(&done_mutex_g);
+
+    return ret;
+}
+
+/* Look up the IDs until told to stop */
+void *
+tts_idlookup_reader(void H5_ATTR_UNUSED *client_data)
+{
+    int nerrors;      /* Number of wrong answers */
+    int nlookups = 0; /* Number of rounds of lookups */
+    int i;            /* Local index variable */
+
+    do {
+        nerrors = 0;
+        for (i = 0; i < NUM_KEPT; i++) {
+            if (H5Iis_valid(kept_g[i]) != TRUE)
+                nerrors++;
+            if (H5Iget_type(kept_g[i]) != type_g)
+                nerrors++;
+        }
+        if (H5Iis_valid(gone_g) != FALSE)
+            nerrors++;
+        if (H5Iget_type(gone_g) != H5I_BADID)
+            nerrors++;
+        VERIFY(nerrors, 0, "H5Iis_valid");
+
+        /* IDs are handed out in sequence, so these are among the IDs being
+         * registered and removed.  The answers depend on timing, but the
+         * lookups mustn't crash.
+         */
+        for (i = 0; i < NUM_ROUNDS * NUM_CHURN; i += NUM_CHURN / 16) {
+            (void)H5Iis_valid(gone_g + 1 + i);
+            (void)H5Iget_type(gone_g + 1 + i);
+        }
+
+        nlookups++;
+    } while (!idlookup_done());
+
+    CHECK(nlookups, 0, "lookup rounds");
+
+    return NULL;
+} /* end tts_idlookup_reader() */
+
+void
+tts_idlookup(void)
+{
+    H5TS_thread_t threads[NUM_READERS] = {0}; /* Thread declaration */
+    hid_t *       churn;                      /* IDs registered and removed */
+    H5I_type_t    tmp_type;                   /* Type created and destroyed */
+    hid_t         tmp_id;                     /* ID in that type */
+    int           round, i;                   /* Local index variables */
+    herr_t        ret;                        /* Return value */
+
+    churn = (hid_t *)HDcalloc(NUM_CHURN, sizeof(hid_t));
+    CHECK_PTR(churn, "HDcalloc");
+
+    H5TS_mutex_init(&done_mutex_g);
+    done_g = FALSE;
+
+    type_g = H5Iregister_type((size_t)0, 0, NULL);
+    CHECK(type_g, H5I_BADID, "H5Iregister_type");
+    for (i = 0; i < NUM_KEPT; i++) {
+        kept_g[i] = H5Iregister(type_g, &obj_g);
+        CHECK(kept_g[i], H5I_INVALID_HID, "H5Iregister");
+    }
+    gone_g = H5Iregister(type_g, &obj_g);
+    CHECK(gone_g, H5I_INVALID_HID, "H5Iregister");
+    CHECK_PTR(H5Iremove_verify(gone_g, type_g), "H5Iremove_verify");
+    for (i = 0; i < NUM_CHURN; i++)
+        churn[i] = H5I_INVALID_HID;
+
+    for (i = 0; i < NUM_READERS; i++)
+        threads[i] = H5TS_create_thread(tts_idlookup_reader, NULL, NULL);
+
+    for (round = 0; round < NUM_ROUNDS; round++) {
+        /* Grow the table of IDs, then shrink it again */
+        for (i = 0; i < NUM_CHURN; i++) {
+            churn[i] = H5Iregister(type_g, &obj_g);
+            CHECK(churn[i], H5I_INVALID_HID, "H5Iregister");
+        }
+        for (i = 0; i < NUM_CHURN; i++)
+            CHECK_PTR(H5Iremove_verify(churn[i], type_g), "H5Iremove_verify");
+
+        /* Change the reference counts of the IDs that stay */
+        for (i = 0; i < NUM_KEPT; i++) {
+            ret = H5Iinc_ref(kept_g[i]);
+            VERIFY(ret, 2, "H5Iinc_ref");
+            ret = H5Idec_ref(kept_g[i]);
+            VERIFY(ret, 1, "H5Idec_ref");
+        }
+
+        /* Create and destroy a type */
+        tmp_type = H5Iregister_type((size_t)0, 0, NULL);
+        CHECK(tmp_type, H5I_BADID, "H5Iregister_type");
+        tmp_id = H5Iregister(tmp_type, &obj_g);
+        CHECK(tmp_id, H5I_INVALID_HID, "H5Iregister");
+        VERIFY(H5Iget_type(tmp_id), tmp_type, "H5Iget_type");
+        ret = H5Idestroy_type(tmp_type);
+        CHECK(ret, FAIL, "H5Idestroy_type");
+        VERIFY(H5Iis_valid(tmp_id), FALSE, "H5Iis_valid");
+        VERIFY(H5Iget_type(tmp_id), H5I_BADID, "H5Iget_type");
+    }
+
+    H5TS_mutex_lock_simple(&done_mutex_g);
+    done_g = TRUE;
+    H5TS_mutex_unlock_simple(&done_mutex_g);
+    for (i = 0; i < NUM_READERS; i++)
+        H5TS_wait_for_thread(threads[i]);
+
+    /* Removed IDs are invalid */
+    for (i = 0; i < NUM_CHURN; i++)
+        VERIFY(H5Iis_valid(churn[i]), FALSE, "H5Iis_valid");
+
+    ret = H5Idestroy_type(type_g);
+    CHECK(ret, FAIL, "H5Idestroy_type");
+    VERIFY(H5Iis_valid(kept_g[0]), FALSE, "H5Iis_valid");
+    VERIFY(H5Iget_type(kept_g[0]), H5I_BADID, "H5Iget_type");
+
+    HDfree(churn);
+} /* end tts_idlookup() */
+
+void
+cleanup_idlookup(void)
+{
+}
+
+#endif /*H5_HAVE_THREADSAFE*/
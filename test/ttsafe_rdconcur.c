@@ -0,0 +1,260 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing for thread safety of concurrent raw data reads.
+ * ------------------------------------------------------------------
+ *
+ * Purpose: Verify that H5Dread calls issued from many threads against
+ *          a file opened read-only return correct data while the raw
+ *          data reads run without the global API lock.
+ *
+ *          --Create an HDF5 file holding a contiguous dataset and a
+ *            chunked, deflate-compressed dataset for each thread, plus
+ *            one chunked dataset shared by all threads
+ *          --Reopen the file read-only
+ *          --Create NUM_THREADS threads
+ *          --For each thread, repeatedly:
+ *              --Read its own contiguous and compressed datasets
+ *              --Read its own rows (a disjoint set of chunks) of the
+ *                shared dataset
+ *              --Verify the data read
+ *
+ ********************************************************************/
+
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define FILENAME    "ttsafe_rdconcur.h5"
+#define SHARED_NAME "shared"
+#define NUM_THREADS 8
+#define NUM_ROUNDS  20
+#define DIM0        64
+#define DIM1        256
+#define CHUNK0      8
+#define CHUNK1      64
+
+void *tts_rdconcur_thread(void *);
+
+typedef struct rdconcur_arg_t {
+    hid_t fid; /* File shared by all threads */
+    int   idx; /* Index of this thread */
+} rdconcur_arg_t;
+
+/* Value stored at (i, j) of dataset number n */
+static int
+rdconcur_value(int n, int i, int j)
+{
+    return (n * DIM0 * DIM1) + (i * DIM1) + j;
+}
+
+static void
+rdconcur_fill(int *buf, int n)
+{
+    int i, j;
+
+    for (i = 0; i < DIM0; i++)
+        for (j = 0; j < DIM1; j++)
+            buf[(i * DIM1) + j] = rdconcur_value(n, i, j);
+}
+
+void
+tts_rdconcur(void)
+{
+    H5TS_thread_t  threads[NUM_THREADS] = {0};              /* Thread declaration */
+    rdconcur_arg_t args[NUM_THREADS];                       /* Per-thread arguments */
+    hid_t          fid           = H5I_INVALID_HID;         /* File ID */
+    hid_t          sid           = H5I_INVALID_HID;         /* Dataspace ID */
+    hid_t          dcpl          = H5I_INVALID_HID;         /* Dataset creation property list ID */
+    hid_t          did           = H5I_INVALID_HID;         /* Dataset ID */
+    hsize_t        dims[2]       = {DIM0, DIM1};            /* Dataset dimensions */
+    hsize_t        chunk_dims[2] = {CHUNK0, CHUNK1};        /* Chunk dimensions */
+    char           name[32];                                /* Dataset name */
+    int *          buf;                                     /* Data to write */
+    herr_t         ret;                                     /* Return value */
+    int            i;                                       /* Local index variable */
+
+    buf = (int *)HDmalloc(sizeof(int) * DIM0 * DIM1);
+    CHECK_PTR(buf, "HDmalloc");
+
+    /* Create the HDF5 test file */
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, H5I_INVALID_HID, "H5Fcreate");
+
+    sid = H5Screate_simple(2, dims, NULL);
+    CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, H5I_INVALID_HID, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, 2, chunk_dims);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+    ret = H5Pset_deflate(dcpl, 6);
+    CHECK(ret, FAIL, "H5Pset_deflate");
+
+    /* One contiguous and one compressed dataset per thread, numbered 2i and 2i+1 */
+    for (i = 0; i < NUM_THREADS; i++) {
+        HDsnprintf(name, sizeof(name), "contig_%d", i);
+        did = H5Dcreate2(fid, name, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(did, H5I_INVALID_HID, "H5Dcreate2");
+        rdconcur_fill(buf, 2 * i);
+        ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Dclose(did);
+        CHECK(ret, FAIL, "H5Dclose");
+
+        HDsnprintf(name, sizeof(name), "chunked_%d", i);
+        did = H5Dcreate2(fid, name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+        CHECK(did, H5I_INVALID_HID, "H5Dcreate2");
+        rdconcur_fill(buf, (2 * i) + 1);
+        ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Dclose(did);
+        CHECK(ret, FAIL, "H5Dclose");
+    }
+
+    /* The dataset every thread reads its own rows of */
+    did = H5Dcreate2(fid, SHARED_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(did, H5I_INVALID_HID, "H5Dcreate2");
+    rdconcur_fill(buf, 2 * NUM_THREADS);
+    ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    HDfree(buf);
+
+    /* Reopen read-only and share the file ID between all threads */
+    fid = H5Fopen(FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(fid, H5I_INVALID_HID, "H5Fopen");
+
+    for (i = 0; i < NUM_THREADS; i++) {
+        args[i].fid = fid;
+        args[i].idx = i;
+        threads[i]  = H5TS_create_thread(tts_rdconcur_thread, NULL, &args[i]);
+    }
+
+    /* Wait for the threads to end */
+    for (i = 0; i < NUM_THREADS; i++)
+        H5TS_wait_for_thread(threads[i]);
+
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+} /* end tts_rdconcur() */
+
+/* Read the whole of dataset NAME and verify it holds the values of dataset number N */
+static void
+rdconcur_check_dset(hid_t fid, const char *name, int n, int *buf)
+{
+    hid_t  did;         /* Dataset ID */
+    int    nerrors = 0; /* Number of mismatched values */
+    int    i, j;        /* Local index variables */
+    herr_t ret;         /* Return value */
+
+    did = H5Dopen2(fid, name, H5P_DEFAULT);
+    CHECK(did, H5I_INVALID_HID, "H5Dopen2");
+
+    HDmemset(buf, 0, sizeof(int) * DIM0 * DIM1);
+    ret = H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+    CHECK(ret, FAIL, "H5Dread");
+
+    for (i = 0; i < DIM0; i++)
+        for (j = 0; j < DIM1; j++)
+            if (buf[(i * DIM1) + j] != rdconcur_value(n, i, j))
+                nerrors++;
+    VERIFY(nerrors, 0, name);
+
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+}
+
+/* Start execution for each thread */
+void *
+tts_rdconcur_thread(void *client_data)
+{
+    rdconcur_arg_t *arg  = (rdconcur_arg_t *)client_data; /* This thread's arguments */
+    hid_t           did  = H5I_INVALID_HID;               /* Shared dataset ID */
+    hid_t           fsid = H5I_INVALID_HID;               /* File dataspace ID */
+    hid_t           msid = H5I_INVALID_HID;               /* Memory dataspace ID */
+    hsize_t         start[2];                             /* Start of this thread's rows */
+    hsize_t         count[2];                             /* Size of this thread's rows */
+    char            name[32];                             /* Dataset name */
+    int *           buf;                                  /* Data read */
+    int             rows = DIM0 / NUM_THREADS;            /* Rows of the shared dataset per thread */
+    int             nerrors;                              /* Number of mismatched values */
+    int             round;                                /* Read iteration */
+    int             i, j;                                 /* Local index variables */
+    herr_t          ret;                                  /* Return value */
+
+    buf = (int *)HDmalloc(sizeof(int) * DIM0 * DIM1);
+    CHECK_PTR(buf, "HDmalloc");
+
+    /* This thread's rows of the shared dataset cover whole chunks */
+    start[0] = (hsize_t)(arg->idx * rows);
+    start[1] = 0;
+    count[0] = (hsize_t)rows;
+    count[1] = DIM1;
+
+    did = H5Dopen2(arg->fid, SHARED_NAME, H5P_DEFAULT);
+    CHECK(did, H5I_INVALID_HID, "H5Dopen2");
+    fsid = H5Dget_space(did);
+    CHECK(fsid, H5I_INVALID_HID, "H5Dget_space");
+    ret = H5Sselect_hyperslab(fsid, H5S_SELECT_SET, start, NULL, count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    msid = H5Screate_simple(2, count, NULL);
+    CHECK(msid, H5I_INVALID_HID, "H5Screate_simple");
+
+    for (round = 0; round < NUM_ROUNDS; round++) {
+        HDsnprintf(name, sizeof(name), "contig_%d", arg->idx);
+        rdconcur_check_dset(arg->fid, name, 2 * arg->idx, buf);
+
+        HDsnprintf(name, sizeof(name), "chunked_%d", arg->idx);
+        rdconcur_check_dset(arg->fid, name, (2 * arg->idx) + 1, buf);
+
+        HDmemset(buf, 0, sizeof(int) * DIM0 * DIM1);
+        ret = H5Dread(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, buf);
+        CHECK(ret, FAIL, "H5Dread");
+
+        nerrors = 0;
+        for (i = 0; i < rows; i++)
+            for (j = 0; j < DIM1; j++)
+                if (buf[(i * DIM1) + j] != rdconcur_value(2 * NUM_THREADS, (int)start[0] + i, j))
+                    nerrors++;
+        VERIFY(nerrors, 0, SHARED_NAME);
+    }
+
+    ret = H5Sclose(msid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(fsid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    HDfree(buf);
+
+    return NULL;
+} /* end tts_rdconcur_thread() */
+
+void
+cleanup_rdconcur(void)
+{
+    HDunlink(FILENAME);
+}
+
+#endif /*H5_HAVE_THREADSAFE*/
@@ -0,0 +1,529 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing the reader/writer lock and the shared API mode.
+ * ------------------------------------------------------------------
+ *
+ * Purpose: Verify that
+ *          --Any number of threads can hold an H5TS_rw_lock_t shared
+ *            at once, while a thread holding it exclusively has it to
+ *            itself, that the lock is recursive, and that a thread
+ *            holding it shared can upgrade it
+ *          --Read-only API calls (H5Dread, H5Aread, H5Literate2,
+ *            H5Oget_info3) issued from many threads return correct
+ *            results while other threads create and write objects
+ *          --An H5Literate2 callback can close and open a dataset while
+ *            other threads read, and so can callbacks in many threads
+ *            at once
+ *
+ ********************************************************************/
+
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define FILENAME_READ  "ttsafe_rwlock_r.h5"
+#define FILENAME_WRITE "ttsafe_rwlock_w.h5"
+#define NUM_READERS    6
+#define NUM_WRITERS    2
+#define NUM_ROUNDS     50
+#define NUM_LINKS      16
+#define DIM            1024
+
+/* Wait for up to 10 seconds for the other threads */
+#define MAX_WAIT_NSEC  ((uint64_t)10 * 1000 * 1000 * 1000)
+#define WAIT_STEP_NSEC ((uint64_t)1000 * 1000)
+
+void *tts_rwlock_shared_thread(void *);
+void *tts_rwlock_exclusive_thread(void *);
+void *tts_rwlock_api_reader(void *);
+void *tts_rwlock_api_writer(void *);
+void *tts_rwlock_api_closer(void *);
+
+/* A writer's file and index */
+typedef struct rwlock_writer_t {
+    hid_t fid;   /* Writable file ID */
+    int   index; /* Index of the writer, for naming its datasets */
+} rwlock_writer_t;
+
+/* State of a thread iterating with a callback that closes and opens a dataset */
+typedef struct rwlock_closer_t {
+    hid_t   fid;     /* Read-only file ID */
+    hid_t   did;     /* Open dataset ID */
+    int     nclosed; /* Number of times the callback closed the dataset */
+    int     nfailed; /* Number of API calls that failed in the callback */
+    hbool_t gather;  /* Whether the callback waits for the other threads' callbacks first */
+} rwlock_closer_t;
+
+static H5TS_rw_lock_t      rw_lock_g;     /* Lock under test */
+static H5TS_mutex_simple_t count_mutex_g; /* Protects the counts below */
+static int                 nreaders_g;    /* Threads holding the lock shared */
+static int                 nwriters_g;    /* Threads holding the lock exclusively */
+static int                 max_readers_g; /* Most threads seen holding the lock shared at once */
+static int                 nviolations_g; /* Times a thread saw the lock held in the wrong mode */
+static int                 nupgrades_g;   /* Times a thread upgraded the lock */
+static int                 ninside_g;     /* Threads in a callback closing a dataset */
+
+/* Update a count and check the lock's invariants */
+static void
+rwlock_count(int *count, int delta)
+{
+    H5TS_mutex_lock_simple(&count_mutex_g);
+    *count += delta;
+    if (nwriters_g > 1 || (nwriters_g && nreaders_g))
+        nviolations_g++;
+    if (nreaders_g > max_readers_g)
+        max_readers_g = nreaders_g;
+    H5TS_mutex_unlock_simple(&count_mutex_g);
+}
+
+static int
+rwlock_get_count(int *count)
+{
+    int ret; /* Count read */
+
+    H5TS_mutex_lock_simple(&count_mutex_g);
+    ret = *count;
+    H5TS_mutex_unlock_simple(&count_mutex_g);
+
+    return ret;
+}
+
+/* Hold the lock shared until all readers are in */
+void *
+tts_rwlock_shared_thread(void H5_ATTR_UNUSED *client_data)
+{
+    uint64_t waited = 0; /* Time waited for the other readers */
+    herr_t   ret;        /* Return value */
+
+    ret = H5TS_rw_rdlock(&rw_lock_g);
+    VERIFY(ret, 0, "H5TS_rw_rdlock");
+    rwlock_count(&nreaders_g, 1);
+
+    while (rwlock_get_count(&max_readers_g) < NUM_READERS && waited < MAX_WAIT_NSEC) {
+        H5_nanosleep(WAIT_STEP_NSEC);
+        waited += WAIT_STEP_NSEC;
+    }
+
+    rwlock_count(&nreaders_g, -1);
+    ret = H5TS_rw_unlock(&rw_lock_g);
+    VERIFY(ret, 0, "H5TS_rw_unlock");
+
+    return NULL;
+} /* end tts_rwlock_shared_thread() */
+
+/* Take the lock in both modes, recursively */
+void *
+tts_rwlock_exclusive_thread(void H5_ATTR_UNUSED *client_data)
+{
+    int    i;   /* Local index variable */
+    herr_t ret; /* Return value */
+
+    for (i = 0; i < NUM_ROUNDS; i++) {
+        ret = H5TS_rw_wrlock(&rw_lock_g);
+        VERIFY(ret, 0, "H5TS_rw_wrlock");
+        rwlock_count(&nwriters_g, 1);
+
+        /* Taking the lock again (in either mode) keeps it exclusive */
+        ret = H5TS_rw_rdlock(&rw_lock_g);
+        VERIFY(ret, 0, "H5TS_rw_rdlock");
+        VERIFY(H5TS_rw_lock_shared(&rw_lock_g), FALSE, "H5TS_rw_lock_shared");
+        H5_nanosleep(WAIT_STEP_NSEC / 10);
+        ret = H5TS_rw_unlock(&rw_lock_g);
+        VERIFY(ret, 0, "H5TS_rw_unlock");
+
+        rwlock_count(&nwriters_g, -1);
+        ret = H5TS_rw_unlock(&rw_lock_g);
+        VERIFY(ret, 0, "H5TS_rw_unlock");
+
+        ret = H5TS_rw_rdlock(&rw_lock_g);
+        VERIFY(ret, 0, "H5TS_rw_rdlock");
+        rwlock_count(&nreaders_g, 1);
+
+        /* Taking the lock exclusively while holding it shared upgrades it
+         * (giving up the shared hold first when another reader is already
+         * waiting to upgrade it) */
+        rwlock_count(&nreaders_g, -1);
+        ret = H5TS_rw_wrlock(&rw_lock_g);
+        VERIFY(ret, 0, "H5TS_rw_wrlock");
+        rwlock_count(&nwriters_g, 1);
+        rwlock_count(&nupgrades_g, 1);
+        VERIFY(H5TS_rw_lock_shared(&rw_lock_g), FALSE, "H5TS_rw_lock_shared");
+        H5_nanosleep(WAIT_STEP_NSEC / 10);
+        rwlock_count(&nwriters_g, -1);
+
+        /* Releasing the upgraded lock leaves it shared */
+        ret = H5TS_rw_unlock(&rw_lock_g);
+        VERIFY(ret, 0, "H5TS_rw_unlock");
+        rwlock_count(&nreaders_g, 1);
+        VERIFY(H5TS_rw_lock_shared(&rw_lock_g), TRUE, "H5TS_rw_lock_shared");
+
+        rwlock_count(&nreaders_g, -1);
+        ret = H5TS_rw_unlock(&rw_lock_g);
+        VERIFY(ret, 0, "H5TS_rw_unlock");
+    }
+
+    VERIFY(H5TS_rw_lock_shared(&rw_lock_g), FALSE, "H5TS_rw_lock_shared");
+
+    return NULL;
+} /* end tts_rwlock_exclusive_thread() */
+
+/* Expected value of element i of the dataset */
+static int
+rwlock_value(int i)
+{
+    return (i * 7) + 3;
+}
+
+/* Count the links in a group */
+static herr_t
+rwlock_count_links(hid_t H5_ATTR_UNUSED group_id, const char H5_ATTR_UNUSED *name,
+                   const H5L_info2_t H5_ATTR_UNUSED *info, void *op_data)
+{
+    (*(int *)op_data)++;
+
+    return 0;
+}
+
+/* Read from the read-only file with read-only API calls */
+void *
+tts_rwlock_api_reader(void *client_data)
+{
+    hid_t       fid      = *(hid_t *)client_data; /* Read-only file ID */
+    hid_t       did      = H5I_INVALID_HID;       /* Dataset ID */
+    hid_t       aid      = H5I_INVALID_HID;       /* Attribute ID */
+    H5O_info2_t oinfo;                            /* Dataset's object info */
+    int *       buf;                              /* Data read */
+    int         attr_val = 0;                     /* Attribute value read */
+    int         nlinks;                           /* Number of links iterated over */
+    int         nerrors;                          /* Number of mismatched values */
+    int         round, i;                         /* Local index variables */
+    herr_t      ret;                              /* Return value */
+
+    buf = (int *)HDmalloc(sizeof(int) * DIM);
+    CHECK_PTR(buf, "HDmalloc");
+
+    did = H5Dopen2(fid, "dset", H5P_DEFAULT);
+    CHECK(did, H5I_INVALID_HID, "H5Dopen2");
+    aid = H5Aopen(did, "attr", H5P_DEFAULT);
+    CHECK(aid, H5I_INVALID_HID, "H5Aopen");
+
+    for (round = 0; round < NUM_ROUNDS; round++) {
+        HDmemset(buf, 0, sizeof(int) * DIM);
+        ret = H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+        CHECK(ret, FAIL, "H5Dread");
+        nerrors = 0;
+        for (i = 0; i < DIM; i++)
+            if (buf[i] != rwlock_value(i))
+                nerrors++;
+        VERIFY(nerrors, 0, "H5Dread");
+
+        ret = H5Aread(aid, H5T_NATIVE_INT, &attr_val);
+        CHECK(ret, FAIL, "H5Aread");
+        VERIFY(attr_val, DIM, "H5Aread");
+
+        nlinks = 0;
+        ret    = H5Literate2(fid, H5_INDEX_NAME, H5_ITER_INC, NULL, rwlock_count_links, &nlinks);
+        CHECK(ret, FAIL, "H5Literate2");
+        VERIFY(nlinks, NUM_LINKS + 1, "H5Literate2");
+
+        ret = H5Oget_info3(did, &oinfo, H5O_INFO_BASIC | H5O_INFO_NUM_ATTRS);
+        CHECK(ret, FAIL, "H5Oget_info3");
+        VERIFY(oinfo.type, H5O_TYPE_DATASET, "H5Oget_info3");
+        VERIFY(oinfo.num_attrs, 1, "H5Oget_info3");
+    }
+
+    ret = H5Aclose(aid);
+    CHECK(ret, FAIL, "H5Aclose");
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    HDfree(buf);
+
+    return NULL;
+} /* end tts_rwlock_api_reader() */
+
+/* Create and write groups and datasets in the other file */
+void *
+tts_rwlock_api_writer(void *client_data)
+{
+    rwlock_writer_t *writer = (rwlock_writer_t *)client_data; /* The writer's file and index */
+    hsize_t          dim    = DIM;                            /* Dataset dimensions */
+    hid_t            sid    = H5I_INVALID_HID;                /* Dataspace ID */
+    hid_t            did    = H5I_INVALID_HID;                /* Dataset ID */
+    int *            buf;                                     /* Data to write */
+    char             name[64];                                /* Dataset name */
+    int              round, i;                                /* Local index variables */
+    herr_t           ret;                                     /* Return value */
+
+    buf = (int *)HDmalloc(sizeof(int) * DIM);
+    CHECK_PTR(buf, "HDmalloc");
+    for (i = 0; i < DIM; i++)
+        buf[i] = rwlock_value(i);
+
+    sid = H5Screate_simple(1, &dim, NULL);
+    CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+
+    for (round = 0; round < NUM_ROUNDS; round++) {
+        HDsnprintf(name, sizeof(name), "dset_%d_%d", writer->index, round);
+        did = H5Dcreate2(writer->fid, name, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(did, H5I_INVALID_HID, "H5Dcreate2");
+        ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Dclose(did);
+        CHECK(ret, FAIL, "H5Dclose");
+    }
+
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    HDfree(buf);
+
+    return NULL;
+} /* end tts_rwlock_api_writer() */
+
+/* Close the dataset and open it again when iterating over its link */
+static herr_t
+rwlock_close_dset(hid_t group_id, const char *name, const H5L_info2_t H5_ATTR_UNUSED *info, void *op_data)
+{
+    rwlock_closer_t *closer = (rwlock_closer_t *)op_data; /* The iterating thread's state */
+    uint64_t         waited = 0;                          /* Time waited for the other threads */
+    hid_t            did;                                 /* Dataset ID */
+    herr_t           ret;                                 /* Return value */
+
+    if (HDstrcmp(name, "dset") != 0)
+        return 0;
+
+    /* Have all the threads' callbacks try to modify the library at once */
+    if (closer->gather) {
+        rwlock_count(&ninside_g, 1);
+        while (rwlock_get_count(&ninside_g) < NUM_READERS && waited < MAX_WAIT_NSEC) {
+            H5_nanosleep(WAIT_STEP_NSEC);
+            waited += WAIT_STEP_NSEC;
+        }
+        closer->gather = FALSE;
+    } /* end if */
+
+    /* These wait while other threads' callbacks modify the library */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dclose(closer->did);
+    }
+    H5E_END_TRY;
+    if (ret < 0) {
+        closer->nfailed++;
+        return 0;
+    } /* end if */
+    closer->did = H5I_INVALID_HID;
+    closer->nclosed++;
+
+    H5E_BEGIN_TRY
+    {
+        did = H5Dopen2(group_id, name, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (did < 0)
+        closer->nfailed++;
+    else
+        closer->did = did;
+
+    return 0;
+} /* end rwlock_close_dset() */
+
+/* Iterate over the read-only file, closing and opening the dataset */
+void *
+tts_rwlock_api_closer(void *client_data)
+{
+    rwlock_closer_t *closer = (rwlock_closer_t *)client_data; /* The thread's state */
+    int              round;                                   /* Local index variable */
+    herr_t           ret;                                     /* Return value */
+
+    for (round = 0; round < NUM_ROUNDS; round++) {
+        if (closer->did < 0) {
+            closer->did = H5Dopen2(closer->fid, "dset", H5P_DEFAULT);
+            CHECK(closer->did, H5I_INVALID_HID, "H5Dopen2");
+        } /* end if */
+
+        closer->gather = (round == 0);
+        ret            = H5Literate2(closer->fid, H5_INDEX_NAME, H5_ITER_INC, NULL, rwlock_close_dset, closer);
+        CHECK(ret, FAIL, "H5Literate2");
+    }
+
+    if (closer->did >= 0) {
+        ret = H5Dclose(closer->did);
+        CHECK(ret, FAIL, "H5Dclose");
+    } /* end if */
+
+    return NULL;
+} /* end tts_rwlock_api_closer() */
+
+void
+tts_rwlock(void)
+{
+    H5TS_thread_t   threads[NUM_READERS + NUM_WRITERS] = {0}; /* Thread declaration */
+    rwlock_writer_t writers[NUM_WRITERS];                     /* Writers' files and indices */
+    rwlock_closer_t closers[NUM_READERS];                     /* Closing threads' state */
+    hid_t           rfid     = H5I_INVALID_HID;               /* Read-only file ID */
+    hid_t           wfid     = H5I_INVALID_HID;               /* Writable file ID */
+    hid_t           sid      = H5I_INVALID_HID;               /* Dataspace ID */
+    hid_t           did      = H5I_INVALID_HID;               /* Dataset ID */
+    hid_t           aid      = H5I_INVALID_HID;               /* Attribute ID */
+    hid_t           gid      = H5I_INVALID_HID;               /* Group ID */
+    hsize_t         dim      = DIM;                           /* Dataset dimensions */
+    int             attr_val = DIM;                           /* Attribute value */
+    int             nclosed  = 0;                             /* Times the callbacks closed the dataset */
+    int             nfailed  = 0;                             /* Times API calls failed in the callbacks */
+    char            name[32];                                 /* Group name */
+    int *           buf;                                      /* Dataset data */
+    herr_t          ret;                                      /* Return value */
+    int             i;                                        /* Local index variable */
+
+    /*
+     * The lock itself
+     */
+    ret = H5TS_rw_lock_init(&rw_lock_g);
+    VERIFY(ret, 0, "H5TS_rw_lock_init");
+    H5TS_mutex_init(&count_mutex_g);
+    nreaders_g = nwriters_g = max_readers_g = nviolations_g = nupgrades_g = 0;
+
+    /* All readers hold the lock at once, or they'd give up waiting for each other */
+    for (i = 0; i < NUM_READERS; i++)
+        threads[i] = H5TS_create_thread(tts_rwlock_shared_thread, NULL, NULL);
+    for (i = 0; i < NUM_READERS; i++)
+        H5TS_wait_for_thread(threads[i]);
+    VERIFY(max_readers_g, NUM_READERS, "shared holders");
+
+    /* Mix shared and exclusive holders */
+    for (i = 0; i < NUM_READERS + NUM_WRITERS; i++)
+        threads[i] = H5TS_create_thread(tts_rwlock_exclusive_thread, NULL, NULL);
+    for (i = 0; i < NUM_READERS + NUM_WRITERS; i++)
+        H5TS_wait_for_thread(threads[i]);
+    VERIFY(nviolations_g, 0, "exclusive holders");
+
+    /* Every reader taking the lock exclusively gets it */
+    VERIFY(nupgrades_g, (NUM_READERS + NUM_WRITERS) * NUM_ROUNDS, "upgrades");
+
+    /* Releasing a lock the thread doesn't hold fails */
+    ret = H5TS_rw_unlock(&rw_lock_g);
+    CHECK(ret, 0, "H5TS_rw_unlock");
+
+    ret = H5TS_rw_lock_destroy(&rw_lock_g);
+    VERIFY(ret, 0, "H5TS_rw_lock_destroy");
+
+    /*
+     * The API
+     */
+    buf = (int *)HDmalloc(sizeof(int) * DIM);
+    CHECK_PTR(buf, "HDmalloc");
+    for (i = 0; i < DIM; i++)
+        buf[i] = rwlock_value(i);
+
+    rfid = H5Fcreate(FILENAME_READ, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(rfid, H5I_INVALID_HID, "H5Fcreate");
+    sid = H5Screate_simple(1, &dim, NULL);
+    CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+    did = H5Dcreate2(rfid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(did, H5I_INVALID_HID, "H5Dcreate2");
+    ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, H5I_INVALID_HID, "H5Screate");
+    aid = H5Acreate2(did, "attr", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(aid, H5I_INVALID_HID, "H5Acreate2");
+    ret = H5Awrite(aid, H5T_NATIVE_INT, &attr_val);
+    CHECK(ret, FAIL, "H5Awrite");
+    ret = H5Aclose(aid);
+    CHECK(ret, FAIL, "H5Aclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    for (i = 0; i < NUM_LINKS; i++) {
+        HDsnprintf(name, sizeof(name), "group_%d", i);
+        gid = H5Gcreate2(rfid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(gid, H5I_INVALID_HID, "H5Gcreate2");
+        ret = H5Gclose(gid);
+        CHECK(ret, FAIL, "H5Gclose");
+    }
+    ret = H5Fclose(rfid);
+    CHECK(ret, FAIL, "H5Fclose");
+    HDfree(buf);
+
+    rfid = H5Fopen(FILENAME_READ, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(rfid, H5I_INVALID_HID, "H5Fopen");
+    wfid = H5Fcreate(FILENAME_WRITE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(wfid, H5I_INVALID_HID, "H5Fcreate");
+
+    for (i = 0; i < NUM_READERS; i++)
+        threads[i] = H5TS_create_thread(tts_rwlock_api_reader, NULL, &rfid);
+    for (i = 0; i < NUM_WRITERS; i++) {
+        writers[i].fid           = wfid;
+        writers[i].index         = i;
+        threads[NUM_READERS + i] = H5TS_create_thread(tts_rwlock_api_writer, NULL, &writers[i]);
+    } /* end for */
+    for (i = 0; i < NUM_READERS + NUM_WRITERS; i++)
+        H5TS_wait_for_thread(threads[i]);
+
+    /* A callback closing and opening a dataset waits for the readers to leave the API */
+    for (i = 0; i < NUM_READERS; i++)
+        threads[i] = H5TS_create_thread(tts_rwlock_api_reader, NULL, &rfid);
+    closers[0].fid     = rfid;
+    closers[0].nclosed = closers[0].nfailed = 0;
+    closers[0].gather                       = FALSE;
+    closers[0].did = did = H5Dopen2(rfid, "dset", H5P_DEFAULT);
+    CHECK(did, H5I_INVALID_HID, "H5Dopen2");
+    ret = H5Literate2(rfid, H5_INDEX_NAME, H5_ITER_INC, NULL, rwlock_close_dset, &closers[0]);
+    CHECK(ret, FAIL, "H5Literate2");
+    VERIFY(closers[0].nclosed, 1, "H5Dclose");
+    VERIFY(closers[0].nfailed, 0, "H5Dopen2");
+    VERIFY(H5Iis_valid(did), FALSE, "H5Iis_valid");
+    ret = H5Dclose(closers[0].did);
+    CHECK(ret, FAIL, "H5Dclose");
+    for (i = 0; i < NUM_READERS; i++)
+        H5TS_wait_for_thread(threads[i]);
+
+    /* Callbacks in many threads closing and opening datasets at once: one
+     * waits for the others to leave the API, which they do by giving up
+     * their shared holds to wait for it */
+    ninside_g = 0;
+    for (i = 0; i < NUM_READERS; i++) {
+        closers[i].fid     = rfid;
+        closers[i].did     = H5I_INVALID_HID;
+        closers[i].nclosed = closers[i].nfailed = 0;
+        threads[i] = H5TS_create_thread(tts_rwlock_api_closer, NULL, &closers[i]);
+    } /* end for */
+    for (i = 0; i < NUM_READERS; i++) {
+        H5TS_wait_for_thread(threads[i]);
+        nclosed += closers[i].nclosed;
+        nfailed += closers[i].nfailed;
+    } /* end for */
+    VERIFY(nclosed, NUM_READERS * NUM_ROUNDS, "H5Dclose");
+    VERIFY(nfailed, 0, "H5Dclose");
+    VERIFY(H5Fget_obj_count(rfid, H5F_OBJ_DATASET | H5F_OBJ_LOCAL), 0, "H5Fget_obj_count");
+
+    ret = H5Fclose(wfid);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = H5Fclose(rfid);
+    CHECK(ret, FAIL, "H5Fclose");
+} /* end tts_rwlock() */
+
+void
+cleanup_rwlock(void)
+{
+    HDunlink(FILENAME_READ);
+    HDunlink(FILENAME_WRITE);
+}
+
+#endif /*H5_HAVE_THREADSAFE*/
@@ -38,6 +38,13 @@
 #define DSET1_DIM2 32
 #define DSET3_NAME "dset3"
 
+#define VECTOR_FILE_SIZE (64 * KB)
+#define VECTOR_NBLOCKS   8
+#define VECTOR_DSET_NAME "vector dset"
+#define VECTOR_DSET_DIM  9000
+
+#define IOURING_QUEUE_DEPTH 4
+
 /* Macros for Direct VFD */
 #ifdef H5_HAVE_DIRECT
 #define MBOUNDARY  512
@@ -62,6 +69,9 @@ const char *FILENAME[] = {"sec2_file",          /*0*/
                           "splitter_rw_file",   /*11*/
                           "splitter_wo_file",   /*12*/
                           "splitter.log",       /*13*/
+                          "vector_io_file",     /*14*/
+                          "iouring_file",       /*15*/
+                          "mmap_file",          /*16*/
                           NULL};
 
 #define LOG_FILENAME "log_vfd_out.log"
@@ -157,6 +167,11 @@ test_sec2(void)
         TEST_ERROR
     if (!(driver_flags & H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
         TEST_ERROR
+#ifdef H5_HAVE_PREADWRITE
+    if (!(driver_flags & H5FD_FEAT_CONCURRENT_READ))
+        TEST_ERROR
+    driver_flags &= ~(unsigned long)H5FD_FEAT_CONCURRENT_READ;
+#endif /* H5_HAVE_PREADWRITE */
     /* Check for extra flags not accounted for above */
     if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
                          H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_POSIX_COMPAT_HANDLE |
@@ -3306,6 +3321,614 @@ error:
 
 #undef SPLITTER_TEST_FAULT
 
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io_driver
+ *
+ * Purpose:     Writes and reads a set of blocks (adjacent, separated by
+ *              small and large holes, empty, and past the end of file)
+ *              with H5FDwrite_vector() / H5FDread_vector() on the driver
+ *              set in FAPL_ID, checking them against plain H5FDread().
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io_driver(hid_t fapl_id)
+{
+    H5FD_t *       file = NULL;
+    char           filename[1024];
+    const haddr_t  addrs[VECTOR_NBLOCKS] = {0, 100, 300, 10000, 11000, 11000, 11500, 60000};
+    const size_t   sizes[VECTOR_NBLOCKS] = {100, 50, 200, 1000, 0, 500, 1000, 4000};
+    const void *   wbufs[VECTOR_NBLOCKS];
+    void *         rbufs[VECTOR_NBLOCKS];
+    unsigned char *wdata    = NULL;
+    unsigned char *rdata    = NULL;
+    unsigned char *whole    = NULL;
+    haddr_t        bad_addr = (haddr_t)VECTOR_FILE_SIZE;
+    herr_t         ret;
+    size_t         u, v;
+
+    h5_fixname(FILENAME[14], fapl_id, filename, sizeof(filename));
+
+    if (NULL == (wdata = (unsigned char *)HDmalloc(VECTOR_FILE_SIZE)))
+        TEST_ERROR
+    if (NULL == (rdata = (unsigned char *)HDmalloc(VECTOR_FILE_SIZE)))
+        TEST_ERROR
+    if (NULL == (whole = (unsigned char *)HDmalloc(VECTOR_FILE_SIZE)))
+        TEST_ERROR
+    for (u = 0; u < VECTOR_FILE_SIZE; u++)
+        wdata[u] = (unsigned char)((u % 251) + 1);
+    HDmemset(rdata, 0xff, VECTOR_FILE_SIZE);
+
+    /* Each block lives at the same offset in memory as in the file */
+    for (u = 0; u < VECTOR_NBLOCKS; u++) {
+        wbufs[u] = wdata + addrs[u];
+        rbufs[u] = rdata + addrs[u];
+    } /* end for */
+
+    if (NULL == (file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id,
+                                 (haddr_t)VECTOR_FILE_SIZE)))
+        TEST_ERROR
+    if (H5FDset_eoa(file, H5FD_MEM_DRAW, (haddr_t)VECTOR_FILE_SIZE) < 0)
+        TEST_ERROR
+
+    /* Write all the blocks but the last one */
+    if (H5FDwrite_vector(file, H5FD_MEM_DRAW, H5P_DEFAULT, VECTOR_NBLOCKS - 1, addrs, sizes, wbufs) < 0)
+        TEST_ERROR
+
+    /* Read all of them back, the last one being past the end of the file */
+    if (H5FDread_vector(file, H5FD_MEM_DRAW, H5P_DEFAULT, VECTOR_NBLOCKS, addrs, sizes, rbufs) < 0)
+        TEST_ERROR
+    for (u = 0; u < VECTOR_NBLOCKS - 1; u++)
+        if (HDmemcmp(rdata + addrs[u], wdata + addrs[u], sizes[u]) != 0)
+            TEST_ERROR
+    for (v = 0; v < sizes[VECTOR_NBLOCKS - 1]; v++)
+        if (rdata[addrs[VECTOR_NBLOCKS - 1] + v] != 0)
+            TEST_ERROR
+
+    /* The holes between the blocks must not have been written */
+    if (H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)VECTOR_FILE_SIZE, whole) < 0)
+        TEST_ERROR
+    for (u = 0; u < VECTOR_FILE_SIZE; u++) {
+        hbool_t written = FALSE;
+
+        for (v = 0; v < VECTOR_NBLOCKS - 1; v++)
+            if (u >= addrs[v] && u < addrs[v] + sizes[v])
+                written = TRUE;
+        if (whole[u] != (written ? wdata[u] : 0))
+            TEST_ERROR
+    } /* end for */
+
+    /* Empty requests are allowed */
+    if (H5FDread_vector(file, H5FD_MEM_DRAW, H5P_DEFAULT, 0, NULL, NULL, NULL) < 0)
+        TEST_ERROR
+
+    /* Blocks past the end of the address space are not */
+    H5E_BEGIN_TRY
+    {
+        ret = H5FDread_vector(file, H5FD_MEM_DRAW, H5P_DEFAULT, 1, &bad_addr, sizes, rbufs);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+
+    if (H5FDclose(file) < 0)
+        TEST_ERROR
+    file = NULL;
+    h5_delete_test_file(FILENAME[14], fapl_id);
+
+    HDfree(wdata);
+    HDfree(rdata);
+    HDfree(whole);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (file)
+            H5FDclose(file);
+    }
+    H5E_END_TRY;
+    HDfree(wdata);
+    HDfree(rdata);
+    HDfree(whole);
+    return -1;
+} /* end test_vector_io_driver() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io
+ *
+ * Purpose:     Tests vector I/O through the file drivers with their own
+ *              vector callbacks (SEC2 and CORE) and one without (STDIO),
+ *              then through a strided selection on a contiguous dataset
+ *              with the sieve buffer disabled, which reaches the file
+ *              driver as a vector request.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io(void)
+{
+    hid_t   fapl_id  = H5I_INVALID_HID; /* file access property list ID */
+    hid_t   fid      = H5I_INVALID_HID; /* file ID                      */
+    hid_t   sid      = H5I_INVALID_HID; /* dataspace ID                 */
+    hid_t   mem_sid  = H5I_INVALID_HID; /* memory dataspace ID          */
+    hid_t   did      = H5I_INVALID_HID; /* dataset ID                   */
+    hsize_t dims[1]  = {VECTOR_DSET_DIM};
+    hsize_t start[1] = {1}, stride[1] = {3}, count[1] = {VECTOR_DSET_DIM / 3 - 1};
+    int *   data     = NULL;
+    int *   sel_data = NULL;
+    char    filename[1024];
+    size_t  u;
+
+    TESTING("vector I/O");
+
+    /* Drivers with vector callbacks */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_sec2(fapl_id) < 0)
+        TEST_ERROR
+    if (test_vector_io_driver(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_core(fapl_id, (size_t)CORE_INCREMENT, FALSE) < 0)
+        TEST_ERROR
+    if (test_vector_io_driver(fapl_id) < 0)
+        TEST_ERROR
+
+    /* Driver using the per-block fallback */
+    if (H5Pset_fapl_stdio(fapl_id) < 0)
+        TEST_ERROR
+    if (test_vector_io_driver(fapl_id) < 0)
+        TEST_ERROR
+
+    /* Dataset I/O without the sieve buffer */
+    if (H5Pset_fapl_sec2(fapl_id) < 0)
+        TEST_ERROR
+    if (H5Pset_sieve_buf_size(fapl_id, (size_t)0) < 0)
+        TEST_ERROR
+    h5_fixname(FILENAME[14], fapl_id, filename, sizeof(filename));
+
+    if (NULL == (data = (int *)HDmalloc(VECTOR_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (sel_data = (int *)HDmalloc(VECTOR_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    for (u = 0; u < VECTOR_DSET_DIM; u++)
+        data[u] = (int)u;
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, VECTOR_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT,
+                          H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        TEST_ERROR
+
+    /* Read every third element */
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        TEST_ERROR
+    if ((mem_sid = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR
+    if (H5Dread(did, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, sel_data) < 0)
+        TEST_ERROR
+    for (u = 0; u < count[0]; u++)
+        if (sel_data[u] != (int)(start[0] + u * stride[0]))
+            TEST_ERROR
+
+    /* Overwrite them and check the whole dataset */
+    for (u = 0; u < count[0]; u++)
+        sel_data[u] = -(int)u;
+    if (H5Dwrite(did, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, sel_data) < 0)
+        TEST_ERROR
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        TEST_ERROR
+    for (u = 0; u < VECTOR_DSET_DIM; u++) {
+        int expected = (int)u;
+
+        if (u >= start[0] && (u - start[0]) % stride[0] == 0 && (u - start[0]) / stride[0] < count[0])
+            expected = -(int)((u - start[0]) / stride[0]);
+        if (data[u] != expected)
+            TEST_ERROR
+    } /* end for */
+
+    if (H5Sclose(mem_sid) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[14], fapl_id);
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    HDfree(data);
+    HDfree(sel_data);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(mem_sid);
+        H5Sclose(sid);
+        H5Dclose(did);
+        H5Fclose(fid);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+    HDfree(data);
+    HDfree(sel_data);
+    return -1;
+} /* end test_vector_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring
+ *
+ * Purpose:     Tests the io_uring file driver: its file access
+ *              properties, the file handle interface, dataset I/O and
+ *              vector I/O through a small submission queue.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring(void)
+{
+#ifdef H5_HAVE_IOURING_VFD
+    hid_t    fid            = H5I_INVALID_HID; /* file ID                      */
+    hid_t    fapl_id        = H5I_INVALID_HID; /* file access property list ID */
+    hid_t    fapl_id_out    = H5I_INVALID_HID; /* from H5Fget_access_plist     */
+    hid_t    sid            = H5I_INVALID_HID; /* dataspace ID                 */
+    hid_t    did            = H5I_INVALID_HID; /* dataset ID                   */
+    hsize_t  dims[1]        = {VECTOR_DSET_DIM};
+    unsigned queue_depth    = 0;    /* queue depth from the fapl */
+    void *   os_file_handle = NULL; /* OS file handle            */
+    int *    wdata          = NULL;
+    int *    rdata          = NULL;
+    char     filename[1024];
+    size_t   u;
+#endif /* H5_HAVE_IOURING_VFD */
+
+    TESTING("io_uring file driver");
+
+#ifndef H5_HAVE_IOURING_VFD
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_IOURING_VFD */
+
+    /* Set property list and file name for the io_uring driver */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_iouring(fapl_id, IOURING_QUEUE_DEPTH) < 0)
+        TEST_ERROR
+    h5_fixname(FILENAME[15], fapl_id, filename, sizeof(filename));
+
+    /* Verify the file access properties */
+    if (H5Pget_fapl_iouring(fapl_id, &queue_depth) < 0)
+        TEST_ERROR
+    if (IOURING_QUEUE_DEPTH != queue_depth)
+        TEST_ERROR
+
+    /* Kernels (or sandboxes) without io_uring can't set up the rings */
+    H5E_BEGIN_TRY { fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id); }
+    H5E_END_TRY;
+    if (fid < 0) {
+        H5Pclose(fapl_id);
+        SKIPPED();
+        HDprintf("  Probably the kernel doesn't support io_uring\n");
+        return 0;
+    }
+
+    /* Check that the driver and its properties survive the round trip */
+    if ((fapl_id_out = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR
+    if (H5FD_IOURING != H5Pget_driver(fapl_id_out))
+        TEST_ERROR
+    queue_depth = 0;
+    if (H5Pget_fapl_iouring(fapl_id_out, &queue_depth) < 0)
+        TEST_ERROR
+    if (IOURING_QUEUE_DEPTH != queue_depth)
+        TEST_ERROR
+    if (H5Pclose(fapl_id_out) < 0)
+        TEST_ERROR
+
+    if (H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+        TEST_ERROR
+    if (os_file_handle == NULL)
+        FAIL_PUTS_ERROR("NULL os-specific vfd/file handle was returned from H5Fget_vfd_handle");
+
+    /* Write a dataset and read it back */
+    if (NULL == (wdata = (int *)HDmalloc(VECTOR_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rdata = (int *)HDcalloc(VECTOR_DSET_DIM, sizeof(int))))
+        TEST_ERROR
+    for (u = 0; u < VECTOR_DSET_DIM; u++)
+        wdata[u] = (int)u;
+
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, VECTOR_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT,
+                          H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0)
+        TEST_ERROR
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR
+    if ((did = H5Dopen2(fid, VECTOR_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR
+    if (HDmemcmp(wdata, rdata, VECTOR_DSET_DIM * sizeof(int)) != 0)
+        TEST_ERROR
+
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[15], fapl_id);
+
+    /* More vector blocks than the queue has entries */
+    if (test_vector_io_driver(fapl_id) < 0)
+        TEST_ERROR
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    HDfree(wdata);
+    HDfree(rdata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(fapl_id_out);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(wdata);
+    HDfree(rdata);
+    return -1;
+#endif /* H5_HAVE_IOURING_VFD */
+} /* end test_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_mmap
+ *
+ * Purpose:     Tests the read-only mmap file driver: its file access
+ *              properties, the refusal of writable opens, and reading a
+ *              file written with the default driver under each access
+ *              pattern hint, both through datasets and through
+ *              H5FDread_vector() across the end of the file.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_mmap(void)
+{
+#ifdef H5_HAVE_MMAP_VFD
+    hid_t              fid          = H5I_INVALID_HID; /* file ID                      */
+    hid_t              fapl_id      = H5I_INVALID_HID; /* file access property list ID */
+    hid_t              fapl_id_out  = H5I_INVALID_HID; /* from H5Fget_access_plist     */
+    hid_t              sid          = H5I_INVALID_HID; /* dataspace ID                 */
+    hid_t              mem_sid      = H5I_INVALID_HID; /* memory dataspace ID          */
+    hid_t              did          = H5I_INVALID_HID; /* dataset ID                   */
+    unsigned long      driver_flags = 0;               /* VFD feature flags            */
+    H5FD_t *           lf           = NULL;            /* low-level file               */
+    hsize_t            dims[1]      = {VECTOR_DSET_DIM};
+    hsize_t            start[1] = {1}, stride[1] = {3}, count[1] = {VECTOR_DSET_DIM / 3 - 1};
+    H5FD_mmap_advice_t advice;
+    haddr_t            eof;
+    haddr_t            addrs[2];
+    size_t             sizes[2] = {64, 64};
+    void *             bufs[2];
+    unsigned char      head[64], tail[64];
+    void *             os_file_handle = NULL; /* OS file handle */
+    int *              wdata          = NULL;
+    int *              rdata          = NULL;
+    char               filename[1024];
+    size_t             u;
+#endif /* H5_HAVE_MMAP_VFD */
+
+    TESTING("mmap file driver");
+
+#ifndef H5_HAVE_MMAP_VFD
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_MMAP_VFD */
+
+    /* Set property list and file name for the mmap driver */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_mmap(fapl_id, H5FD_MMAP_ADVICE_SEQUENTIAL) < 0)
+        TEST_ERROR
+    h5_fixname(FILENAME[16], fapl_id, filename, sizeof(filename));
+
+    /* Verify the file access properties */
+    if (H5Pget_fapl_mmap(fapl_id, &advice) < 0)
+        TEST_ERROR
+    if (H5FD_MMAP_ADVICE_SEQUENTIAL != advice)
+        TEST_ERROR
+
+    /* Only the POSIX handle & default VFD compatibility flags are set */
+    if (H5FDdriver_query(H5FD_MMAP, &driver_flags) < 0)
+        TEST_ERROR
+    if (driver_flags !=
+        (H5FD_FEAT_POSIX_COMPAT_HANDLE | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE | H5FD_FEAT_CONCURRENT_READ))
+        TEST_ERROR
+
+    /* Files can't be created through the driver */
+    H5E_BEGIN_TRY { fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id); }
+    H5E_END_TRY;
+    if (fid >= 0)
+        TEST_ERROR
+
+    /* Write a file with the default driver */
+    if (NULL == (wdata = (int *)HDmalloc(VECTOR_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rdata = (int *)HDmalloc(VECTOR_DSET_DIM * sizeof(int))))
+        TEST_ERROR
+    for (u = 0; u < VECTOR_DSET_DIM; u++)
+        wdata[u] = (int)u;
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, VECTOR_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT,
+                          H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0)
+        TEST_ERROR
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    /* ...which the driver won't open for writing */
+    H5E_BEGIN_TRY { fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id); }
+    H5E_END_TRY;
+    if (fid >= 0)
+        TEST_ERROR
+
+    /* The selection to read through a strided hyperslab */
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        TEST_ERROR
+    if ((mem_sid = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR
+
+    /* Read the file back under each access pattern hint */
+    for (advice = H5FD_MMAP_ADVICE_NORMAL; advice <= H5FD_MMAP_ADVICE_WILLNEED; advice++) {
+        H5FD_mmap_advice_t advice_out = H5FD_MMAP_ADVICE_NORMAL;
+
+        if (H5Pset_fapl_mmap(fapl_id, advice) < 0)
+            TEST_ERROR
+        if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+            TEST_ERROR
+
+        /* Check that the driver and its properties are correct */
+        if ((fapl_id_out = H5Fget_access_plist(fid)) < 0)
+            TEST_ERROR
+        if (H5FD_MMAP != H5Pget_driver(fapl_id_out))
+            TEST_ERROR
+        if (H5Pget_fapl_mmap(fapl_id_out, &advice_out) < 0)
+            TEST_ERROR
+        if (advice != advice_out)
+            TEST_ERROR
+        if (H5Pclose(fapl_id_out) < 0)
+            TEST_ERROR
+        fapl_id_out = H5I_INVALID_HID;
+
+        if (H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+            TEST_ERROR
+        if (os_file_handle == NULL)
+            FAIL_PUTS_ERROR("NULL os-specific vfd/file handle was returned from H5Fget_vfd_handle");
+
+        if ((did = H5Dopen2(fid, VECTOR_DSET_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        HDmemset(rdata, 0, VECTOR_DSET_DIM * sizeof(int));
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+            TEST_ERROR
+        if (HDmemcmp(wdata, rdata, VECTOR_DSET_DIM * sizeof(int)) != 0)
+            TEST_ERROR
+
+        HDmemset(rdata, 0, VECTOR_DSET_DIM * sizeof(int));
+        if (H5Dread(did, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, rdata) < 0)
+            TEST_ERROR
+        for (u = 0; u < count[0]; u++)
+            if (rdata[u] != wdata[start[0] + u * stride[0]])
+                TEST_ERROR
+
+        if (H5Dclose(did) < 0)
+            TEST_ERROR
+        if (H5Fclose(fid) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    /* Read blocks at the start of the file and across its end */
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDONLY, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if (HADDR_UNDEF == (eof = H5FDget_eof(lf, H5FD_MEM_DEFAULT)) || eof < sizes[0])
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DEFAULT, eof + sizes[1]) < 0)
+        TEST_ERROR
+    addrs[0] = 0;
+    addrs[1] = eof - sizes[1] / 2;
+    bufs[0]  = head;
+    bufs[1]  = tail;
+    HDmemset(tail, 0xff, sizeof(tail));
+    if (H5FDread_vector(lf, H5FD_MEM_DRAW, H5P_DEFAULT, 2, addrs, sizes, bufs) < 0)
+        TEST_ERROR
+    if (HDmemcmp(head, "\211HDF\r\n\032\n", (size_t)8) != 0) /* the superblock signature */
+        TEST_ERROR
+    for (u = sizes[1] / 2; u < sizes[1]; u++)
+        if (tail[u] != 0)
+            TEST_ERROR
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+
+    if (H5Sclose(mem_sid) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    h5_delete_test_file(FILENAME[16], fapl_id);
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    HDfree(wdata);
+    HDfree(rdata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (lf)
+            H5FDclose(lf);
+        H5Dclose(did);
+        H5Sclose(mem_sid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(fapl_id_out);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(wdata);
+    HDfree(rdata);
+    return -1;
+#endif /* H5_HAVE_MMAP_VFD */
+} /* end test_mmap() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -3337,6 +3960,9 @@ main(void)
     nerrors += test_windows() < 0 ? 1 : 0;
     nerrors += test_ros3() < 0 ? 1 : 0;
     nerrors += test_splitter() < 0 ? 1 : 0;
+    nerrors += test_vector_io() < 0 ? 1 : 0;
+    nerrors += test_iouring() < 0 ? 1 : 0;
+    nerrors += test_mmap() < 0 ? 1 : 0;
 
     if (nerrors) {
         HDprintf("***** %d Virtual File Driver TEST%s FAILED! *****\n", nerrors, nerrors > 1 ? "S" : "");
@@ -41,7 +41,7 @@ const char *FILENAME[] = {"native_vol_test", NULL};
  * functionality.
  */
 static const H5VL_class_t fake_vol_g = {
-    0,              /* version      */
+    H5VL_VERSION,   /* version      */
     FAKE_VOL_VALUE, /* value        */
     FAKE_VOL_NAME,  /* name         */
     0,              /* capability flags */
@@ -157,7 +157,12 @@ static const H5VL_class_t fake_vol_g = {
         NULL, /* to_str           */
         NULL  /* from_str         */
     },
-    NULL /* optional     */
+    NULL, /* optional     */
+    {
+        /* dataset_multi_cls */
+        NULL, /* read         */
+        NULL  /* write        */
+    }
 };
 
 /*-------------------------------------------------------------------------
@@ -173,13 +178,15 @@ static const H5VL_class_t fake_vol_g = {
 static herr_t
 test_vol_registration(void)
 {
-    hid_t  native_id     = H5I_INVALID_HID;
-    hid_t  lapl_id       = H5I_INVALID_HID;
-    hid_t  vipl_id       = H5I_INVALID_HID;
-    herr_t ret           = SUCCEED;
-    htri_t is_registered = FAIL;
-    hid_t  vol_id        = H5I_INVALID_HID;
-    hid_t  vol_id2       = H5I_INVALID_HID;
+    hid_t         native_id     = H5I_INVALID_HID;
+    hid_t         lapl_id       = H5I_INVALID_HID;
+    hid_t         vipl_id       = H5I_INVALID_HID;
+    herr_t        ret           = SUCCEED;
+    htri_t        is_registered = FAIL;
+    hid_t         vol_id        = H5I_INVALID_HID;
+    hid_t         vol_id2       = H5I_INVALID_HID;
+    H5VL_class_t  cls;
+    void *        v0_cls        = NULL;
 
     TESTING("VOL registration");
 
@@ -257,6 +264,20 @@ test_vol_registration(void)
     if (H5VLunregister_connector(vol_id) < 0)
         TEST_ERROR;
 
+    /* A version 0 class, which ends before the callbacks added in version 1,
+     * can still be registered */
+    cls         = fake_vol_g;
+    cls.version = 0;
+    if (NULL == (v0_cls = HDmalloc(offsetof(H5VL_class_t, dataset_multi_cls))))
+        TEST_ERROR;
+    HDmemcpy(v0_cls, &cls, offsetof(H5VL_class_t, dataset_multi_cls));
+    if ((vol_id = H5VLregister_connector((const H5VL_class_t *)v0_cls, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDfree(v0_cls);
+    v0_cls = NULL;
+    if (H5VLunregister_connector(vol_id) < 0)
+        TEST_ERROR;
+
     /* Try to unregister the native VOL connector (should fail) */
     if (H5I_INVALID_HID == (native_id = H5VLget_connector_id_by_name(H5VL_NATIVE_NAME)))
         TEST_ERROR;
@@ -276,6 +297,7 @@ error:
         H5Pclose(vipl_id);
     }
     H5E_END_TRY;
+    HDfree(v0_cls);
     return FAIL;
 
 } /* end test_vol_registration() */
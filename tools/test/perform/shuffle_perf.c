@@ -0,0 +1,196 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *  Purpose: measure the throughput of the shuffle filter for different
+ *           element sizes.  Datasets are written to and read from a file
+ *           held in memory by the core driver, with the chunk cache turned
+ *           off so that every chunk goes through the filter, and the rates
+ *           are compared with those of the same datasets without the filter.
+ */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define FILENAME "shuffle_perf.h5"
+
+#define DSET_NBYTES  (32 * 1024 * 1024) /* Bytes in each dataset */
+#define CHUNK_NBYTES (1024 * 1024)      /* Bytes in each chunk */
+#define NTRIALS      3                  /* Best of this many trials is reported */
+
+/* Element sizes to measure */
+static const size_t elmt_sizes_g[] = {2, 3, 4, 8, 16};
+
+/*-------------------------------------------------------------------------
+ * Function:    time_dataset
+ *
+ * Purpose:     Write and read back a dataset of SIZE-byte opaque elements,
+ *              with or without the shuffle filter, and report the best
+ *              rates seen in GB/s.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static int
+time_dataset(hid_t file, size_t size, hbool_t shuffle, const void *wbuf, void *rbuf, double *write_rate,
+             double *read_rate)
+{
+    hid_t    type = H5I_INVALID_HID, space = H5I_INVALID_HID;
+    hid_t    dcpl = H5I_INVALID_HID, dapl = H5I_INVALID_HID, dset = H5I_INVALID_HID;
+    hsize_t  dims[1], chunk_dims[1];
+    char     name[32];
+    uint64_t t0, t1;
+    double   best_write = 0.0, best_read = 0.0;
+    int      i;
+
+    dims[0]       = DSET_NBYTES / size;
+    chunk_dims[0] = CHUNK_NBYTES / size;
+
+    if ((type = H5Tcreate(H5T_OPAQUE, size)) < 0)
+        goto error;
+    if ((space = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dcpl, 1, chunk_dims) < 0)
+        goto error;
+    if (H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0)
+        goto error;
+    if (shuffle && H5Pset_shuffle(dcpl) < 0)
+        goto error;
+
+    /* Don't cache chunks, so that each one is [un]shuffled on each access */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        goto error;
+    if (H5Pset_chunk_cache(dapl, 0, 0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        goto error;
+
+    HDsnprintf(name, sizeof(name), "%s_%u", shuffle ? "shuffle" : "none", (unsigned)size);
+    if ((dset = H5Dcreate2(file, name, type, space, H5P_DEFAULT, dcpl, dapl)) < 0)
+        goto error;
+
+    for (i = 0; i < NTRIALS; i++) {
+        t0 = H5_now_usec();
+        if (H5Dwrite(dset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            goto error;
+        t1 = H5_now_usec();
+        if (t1 > t0 && (double)DSET_NBYTES / (double)(t1 - t0) / 1000.0 > best_write)
+            best_write = (double)DSET_NBYTES / (double)(t1 - t0) / 1000.0;
+
+        t0 = H5_now_usec();
+        if (H5Dread(dset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            goto error;
+        t1 = H5_now_usec();
+        if (t1 > t0 && (double)DSET_NBYTES / (double)(t1 - t0) / 1000.0 > best_read)
+            best_read = (double)DSET_NBYTES / (double)(t1 - t0) / 1000.0;
+
+        if (HDmemcmp(wbuf, rbuf, DSET_NBYTES) != 0) {
+            HDfprintf(stderr, "data read differs from data written for %u-byte elements\n", (unsigned)size);
+            goto error;
+        }
+    }
+
+    *write_rate = best_write;
+    *read_rate  = best_read;
+
+    H5Dclose(dset);
+    H5Pclose(dapl);
+    H5Pclose(dcpl);
+    H5Sclose(space);
+    H5Tclose(type);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Sclose(space);
+        H5Tclose(type);
+    }
+    H5E_END_TRY;
+
+    return -1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Report the write and read rates of datasets with and
+ *              without the shuffle filter for each element size.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *-------------------------------------------------------------------------
+ */
+int
+main(void)
+{
+    hid_t          fapl = H5I_INVALID_HID, file = H5I_INVALID_HID;
+    unsigned char *wbuf = NULL, *rbuf = NULL;
+    double         shuf_write, shuf_read, none_write, none_read;
+    size_t         u;
+
+    if (NULL == (wbuf = (unsigned char *)HDmalloc(DSET_NBYTES)))
+        goto error;
+    if (NULL == (rbuf = (unsigned char *)HDmalloc(DSET_NBYTES)))
+        goto error;
+    for (u = 0; u < DSET_NBYTES; u++)
+        wbuf[u] = (unsigned char)HDrandom();
+
+    /* Keep the file in memory, so that only the filter is measured */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+    if (H5Pset_fapl_core(fapl, (size_t)DSET_NBYTES, FALSE) < 0)
+        goto error;
+    if ((file = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+
+    HDfprintf(stdout, "Shuffle filter throughput (GB/s), %d MiB datasets of %d KiB chunks\n",
+              DSET_NBYTES / (1024 * 1024), CHUNK_NBYTES / 1024);
+    HDfprintf(stdout, "%5s %12s %12s %12s %12s\n", "size", "write", "read", "write/none", "read/none");
+
+    for (u = 0; u < NELMTS(elmt_sizes_g); u++) {
+        if (time_dataset(file, elmt_sizes_g[u], FALSE, wbuf, rbuf, &none_write, &none_read) < 0)
+            goto error;
+        if (time_dataset(file, elmt_sizes_g[u], TRUE, wbuf, rbuf, &shuf_write, &shuf_read) < 0)
+            goto error;
+
+        HDfprintf(stdout, "%5u %12.2f %12.2f %12.2f %12.2f\n", (unsigned)elmt_sizes_g[u], shuf_write,
+                  shuf_read, none_write > 0.0 ? shuf_write / none_write : 0.0,
+                  none_read > 0.0 ? shuf_read / none_read : 0.0);
+    }
+
+    if (H5Fclose(file) < 0)
+        goto error;
+    if (H5Pclose(fapl) < 0)
+        goto error;
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 1;
+}